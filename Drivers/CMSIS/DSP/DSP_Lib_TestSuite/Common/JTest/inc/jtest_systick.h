@@ -40,6 +40,8 @@
   #include "ARMv8MML_DP.h"
 #elif defined ARMv8MML_DSP_DP
   #include "ARMv8MML_DSP_DP.h"
+#elif defined ARM_MATH_HOST
+  /* Host build: the cycles are read from the host counter, see below */
 
 #else
   #warning "no appropriate header file found!"
@@ -57,6 +59,30 @@
  */
 #define JTEST_SYSTICK_INITIAL_VALUE 0xFFFFFF
 
+#if defined ARM_MATH_HOST
+
+/**
+ *  Host build: the SysTick is emulated with the host cycle counter (time stamp
+ *  counter, or nanoseconds where there is none) read by jtest_host_cycles().
+ */
+extern uint32_t jtest_host_cycles(void);
+extern uint32_t jtest_host_systick_start;
+
+#define JTEST_SYSTICK_RESET(systick_ptr)                    \
+    do                                                      \
+    {                                                       \
+        jtest_host_systick_start = jtest_host_cycles();     \
+    } while (0)
+
+#define JTEST_SYSTICK_START(systick_ptr)                    \
+    JTEST_SYSTICK_RESET(systick_ptr)
+
+#define JTEST_SYSTICK_VALUE(systick_ptr)                    \
+    (JTEST_SYSTICK_INITIAL_VALUE -                          \
+     (jtest_host_cycles() - jtest_host_systick_start))
+
+#else
+
 /**
  *  Reset the SysTick, decrementing timer to it's maximum value and disable it.
  *
@@ -89,5 +115,7 @@
  */
 #define JTEST_SYSTICK_VALUE(systick_ptr)        \
     ((systick_ptr)->VAL)
+
+#endif /* ARM_MATH_HOST */
            
 #endif /* _JTEST_SYSTICK_H_ */
@@ -104,6 +104,12 @@
 #define REF_mat_mult_INPUT_INTERFACE(input_a_ptr, input_b_ptr)      \
     PAREN(input_a_ptr, input_b_ptr, (void *) &matrix_output_ref)
 
+#define ARM_mat_mult_bt_INPUT_INTERFACE(input_a_ptr, input_b_ptr)   \
+    PAREN(input_a_ptr, input_b_ptr, (void *) &matrix_output_fut)
+
+#define REF_mat_mult_bt_INPUT_INTERFACE(input_a_ptr, input_b_ptr)   \
+    PAREN(input_a_ptr, input_b_ptr, (void *) &matrix_output_ref)
+
 #define ARM_mat_mult_fast_INPUT_INTERFACE(input_a_ptr, input_b_ptr) \
     PAREN(input_a_ptr, input_b_ptr, (void *) &matrix_output_fut)
 
@@ -140,6 +146,12 @@
     (((input_type) (matrix_a_ptr))->numCols ==                      \
      ((input_type) (matrix_b_ptr))->numRows)
 
+#define MATRIX_TEST_VALID_TRANSPOSED_MULTIPLICATIVE_DIMENSIONS(input_type,    \
+                                                               matrix_a_ptr,  \
+                                                               matrix_b_ptr)  \
+    (((input_type) (matrix_a_ptr))->numCols ==                                 \
+     ((input_type) (matrix_b_ptr))->numCols)
+
 #define MATRIX_TEST_VALID_SQUARE_DIMENSIONS(input_type, \
                                             matrix_ptr) \
     (((input_type)(matrix_ptr))->numRows ==             \
@@ -186,6 +198,21 @@
             ((input_type)(matrix_b_ptr))->numCols;              \
     } while (0)
 
+#define MATRIX_TEST_CONFIG_TRANSPOSED_MULTIPLICATIVE_OUTPUT(input_type,     \
+                                                            matrix_a_ptr,   \
+                                                            matrix_b_ptr)   \
+    do                                                                      \
+    {                                                                       \
+        ((input_type) &matrix_output_fut)->numRows =                        \
+            ((input_type)(matrix_a_ptr))->numRows;                          \
+        ((input_type) &matrix_output_fut)->numCols =                        \
+            ((input_type)(matrix_b_ptr))->numRows;                          \
+        ((input_type) &matrix_output_ref)->numRows =                        \
+            ((input_type)(matrix_a_ptr))->numRows;                          \
+        ((input_type) &matrix_output_ref)->numCols =                        \
+            ((input_type)(matrix_b_ptr))->numRows;                          \
+    } while (0)
+
 #define MATRIX_TEST_CONFIG_SAMESIZE_OUTPUT(input_type,  \
                                            matrix_ptr)  \
     do                                                  \
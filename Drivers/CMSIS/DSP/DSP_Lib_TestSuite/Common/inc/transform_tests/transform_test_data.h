@@ -13,6 +13,7 @@
 /*--------------------------------------------------------------------------------*/
 
 #define TRANSFORM_MAX_FFT_LEN 4096
+#define TRANSFORM_MAX_MIXED_FFT_LEN 3000
 #define TRANFORM_BIGGEST_INPUT_TYPE float32_t
 
 /*--------------------------------------------------------------------------------*/
@@ -38,6 +39,7 @@ ARR_DESC_DECLARE(transform_radix2_fftlens);
 ARR_DESC_DECLARE(transform_radix4_fftlens);
 ARR_DESC_DECLARE(transform_rfft_fftlens);
 ARR_DESC_DECLARE(transform_rfft_fast_fftlens);
+ARR_DESC_DECLARE(transform_mixed_fftlens);
 ARR_DESC_DECLARE(transform_dct_fftlens);
 
 /* CFFT Structs */
@@ -112,6 +112,120 @@
             return JTEST_TEST_PASSED;                                         \
    }
 
+/*
+ * The resampler is fed FIR_RESAMPLE_INPUTS samples by calls of blockSize,
+ * 2 * blockSize + 1 (several chunks) and 3 input samples, every other call
+ * having room for 2 output samples only, which stops it within an input sample.
+ */
+#define FIR_RESAMPLE_INPUTS (8 * FILTERING_MAX_BLOCKSIZE)
+
+#define FIR_RESAMPLE_DEFINE_TEST(suffix, output_type)                         \
+   JTEST_DEFINE_TEST(arm_fir_resample_##suffix##_test,                        \
+         arm_fir_resample_##suffix)                                           \
+   {                                                                          \
+      arm_fir_resample_instance_##suffix fir_inst_fut = { 0 };                \
+      arm_fir_resample_instance_##suffix fir_inst_ref = { 0 };                \
+      uint32_t srcPos, dstPos, srcLen, dstLen, call, numOutputs;              \
+                                                                              \
+      if (arm_fir_resample_init_##suffix(                                     \
+                &fir_inst_fut, 2, 3, 5,                                       \
+                (output_type*)filtering_coeffs_##suffix,                      \
+                (void *) filtering_pState, 1) != ARM_MATH_LENGTH_ERROR)       \
+      {                                                                       \
+         JTEST_DUMP_STRF("%s accepted numTaps 5 for L 2\n",                   \
+                         "arm_fir_resample_init_" #suffix);                   \
+         return JTEST_TEST_FAILED;                                            \
+      }                                                                       \
+                                                                              \
+      TEMPLATE_DO_ARR_DESC(                                                   \
+            blocksize_idx, uint32_t, blockSize, filtering_blocksizes          \
+            ,                                                                 \
+         TEMPLATE_DO_ARR_DESC(                                                \
+               numtaps_idx, uint16_t, numTaps, filtering_numtaps2             \
+               ,                                                              \
+            TEMPLATE_DO_ARR_DESC(                                             \
+                  L_idx, uint8_t, L, filtering_Ls                             \
+                  ,                                                           \
+               TEMPLATE_DO_ARR_DESC(                                          \
+                     M_idx, uint8_t, M, filtering_Ms                          \
+                     ,                                                        \
+                     /* Display test parameter values */                      \
+                     JTEST_DUMP_STRF("Block Size: %d\n"                       \
+                                    "Number of Taps: %d\n"                    \
+                                    "Upsample factor: %d\n"                   \
+                                    "Downsample factor: %d\n",                \
+                                   (int)blockSize,                            \
+                                   (int)numTaps,                              \
+                                   (int)L,                                    \
+                                   (int)M);                                   \
+                                                                              \
+                     /* Initialize the FIR Instances */                       \
+                     arm_fir_resample_init_##suffix(                          \
+                           &fir_inst_fut, L, M, numTaps,                      \
+                           (output_type*)filtering_coeffs_##suffix,           \
+                           (void *) filtering_pState, blockSize);             \
+                                                                              \
+                     srcPos = 0;                                              \
+                     dstPos = 0;                                              \
+                     call = 0;                                                \
+                     while (srcPos < FIR_RESAMPLE_INPUTS)                     \
+                     {                                                        \
+                        srcLen = ((call % 3) == 0) ? blockSize :              \
+                                 ((call % 3) == 1) ? 2 * blockSize + 1 : 3;   \
+                        if (srcLen > FIR_RESAMPLE_INPUTS - srcPos)            \
+                        {                                                     \
+                           srcLen = FIR_RESAMPLE_INPUTS - srcPos;             \
+                        }                                                     \
+                        dstLen = (call & 1) ? 2 : 3 * FIR_RESAMPLE_INPUTS;    \
+                                                                              \
+                        JTEST_COUNT_CYCLES(                                   \
+                              numOutputs = arm_fir_resample_##suffix(         \
+                                    &fir_inst_fut,                            \
+                                    (output_type *)                           \
+                                    filtering_##suffix##_inputs + srcPos,     \
+                                    (output_type *)                           \
+                                    filtering_output_fut + dstPos,            \
+                                    &srcLen, dstLen));                        \
+                                                                              \
+                        if (numOutputs > dstLen)                              \
+                        {                                                     \
+                           JTEST_DUMP_STRF("%d output samples, room %d\n",    \
+                                           (int)numOutputs,                   \
+                                           (int)dstLen);                      \
+                           return JTEST_TEST_FAILED;                          \
+                        }                                                     \
+                                                                              \
+                        srcPos += srcLen;                                     \
+                        dstPos += numOutputs;                                 \
+                        call++;                                               \
+                     }                                                        \
+                                                                              \
+                     arm_fir_resample_init_##suffix(                          \
+                           &fir_inst_ref, L, M, numTaps,                      \
+                           (output_type*)filtering_coeffs_##suffix,           \
+                           (void *) filtering_pState, blockSize);             \
+                                                                              \
+                     numOutputs = ref_fir_resample_##suffix(                  \
+                           &fir_inst_ref,                                     \
+                           (void *) filtering_##suffix##_inputs,              \
+                           (void *) filtering_output_ref,                     \
+                           FIR_RESAMPLE_INPUTS);                              \
+                                                                              \
+                     if (dstPos != numOutputs)                                \
+                     {                                                        \
+                        JTEST_DUMP_STRF("%d output samples instead of %d\n",  \
+                                        (int)dstPos,                          \
+                                        (int)numOutputs);                     \
+                        return JTEST_TEST_FAILED;                             \
+                     }                                                        \
+                                                                              \
+                     FILTERING_SNR_COMPARE_INTERFACE(                         \
+                           numOutputs,                                        \
+                           output_type)))));                                  \
+                                                                              \
+            return JTEST_TEST_PASSED;                                         \
+   }
+
 #define FIR_DECIMATE_DEFINE_TEST(suffix, config_suffix, output_type)       \
    JTEST_DEFINE_TEST(arm_fir_decimate##config_suffix##_##suffix##_test,    \
          arm_fir_decimate##config_suffix##_##suffix)                       \
@@ -354,6 +468,10 @@ FIR_INTERPOLATE_DEFINE_TEST(f32,float32_t);
 FIR_INTERPOLATE_DEFINE_TEST(q31,q31_t);
 FIR_INTERPOLATE_DEFINE_TEST(q15,q15_t);
 
+FIR_RESAMPLE_DEFINE_TEST(f32,float32_t);
+FIR_RESAMPLE_DEFINE_TEST(q31,q31_t);
+FIR_RESAMPLE_DEFINE_TEST(q15,q15_t);
+
 FIR_DECIMATE_DEFINE_TEST(f32,,float32_t);
 FIR_DECIMATE_DEFINE_TEST(q31,,q31_t);
 FIR_DECIMATE_DEFINE_TEST(q15,,q15_t);
@@ -389,6 +507,10 @@ JTEST_DEFINE_GROUP(fir_tests)
    JTEST_TEST_CALL(arm_fir_interpolate_q31_test);
    JTEST_TEST_CALL(arm_fir_interpolate_q15_test);
 
+   JTEST_TEST_CALL(arm_fir_resample_f32_test);
+   JTEST_TEST_CALL(arm_fir_resample_q31_test);
+   JTEST_TEST_CALL(arm_fir_resample_q15_test);
+
    JTEST_TEST_CALL(arm_fir_decimate_f32_test);
    JTEST_TEST_CALL(arm_fir_decimate_q31_test);
    JTEST_TEST_CALL(arm_fir_decimate_q15_test);
@@ -0,0 +1,314 @@
+#include "jtest.h"
+#include "matrix_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "matrix_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Symmetric Positive Definite Inputs */
+/*--------------------------------------------------------------------------------*/
+
+/* The decompositions take M * M' + 1000 * I, built from the square invertible
+ * inputs M. The inputs are also used as right-hand sides of the solves. */
+static float32_t matrix_spd_f32_data[MATRIX_TEST_MAX_ELTS];
+static float64_t matrix_spd_f64_data[MATRIX_TEST_MAX_ELTS];
+static float32_t matrix_fact_f32_data[MATRIX_TEST_MAX_ELTS];
+static float64_t matrix_fact_f64_data[MATRIX_TEST_MAX_ELTS];
+
+static arm_matrix_instance_f32 matrix_spd_f32 = {0, 0, matrix_spd_f32_data};
+static arm_matrix_instance_f64 matrix_spd_f64 = {0, 0, matrix_spd_f64_data};
+static arm_matrix_instance_f32 matrix_fact_f32 = {0, 0, matrix_fact_f32_data};
+static arm_matrix_instance_f64 matrix_fact_f64 = {0, 0, matrix_fact_f64_data};
+
+static void matrix_make_spd(const arm_matrix_instance_f32 * m)
+{
+    uint32_t i, j, k, n = m->numRows;
+    float64_t sum;
+
+    matrix_spd_f32.numRows = matrix_spd_f32.numCols = n;
+    matrix_spd_f64.numRows = matrix_spd_f64.numCols = n;
+    matrix_fact_f32.numRows = matrix_fact_f32.numCols = n;
+    matrix_fact_f64.numRows = matrix_fact_f64.numCols = n;
+
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            sum = (i == j) ? 1000.0 : 0.0;
+
+            for (k = 0; k < n; k++)
+            {
+                sum += (float64_t) m->pData[i*n + k] * m->pData[j*n + k];
+            }
+
+            matrix_spd_f64_data[i*n + j] = sum;
+            matrix_spd_f32_data[i*n + j] = (float32_t) sum;
+        }
+    }
+}
+
+/* The rhs of the f64 solves are the f32 inputs, converted */
+static float64_t matrix_rhs_f64_data[MATRIX_TEST_MAX_ELTS];
+static arm_matrix_instance_f64 matrix_rhs_f64 = {0, 0, matrix_rhs_f64_data};
+
+static void matrix_make_rhs_f64(const arm_matrix_instance_f32 * m)
+{
+    uint32_t i;
+
+    matrix_rhs_f64.numRows = m->numRows;
+    matrix_rhs_f64.numCols = m->numCols;
+
+    for (i = 0; i < (uint32_t) m->numRows * m->numCols; i++)
+    {
+        matrix_rhs_f64_data[i] = m->pData[i];
+    }
+}
+
+#define MATRIX_DBL_OUTPUT_SNR_COMPARE()                                 \
+    TEST_ASSERT_DBL_SNR(matrix_output_ref64.pData,                      \
+                        matrix_output_fut64.pData,                      \
+                        matrix_output_fut64.numRows *                   \
+                        matrix_output_fut64.numCols,                    \
+                        MATRIX_SNR_THRESHOLD)
+
+/*--------------------------------------------------------------------------------*/
+/* Decompositions */
+/*--------------------------------------------------------------------------------*/
+
+/* fn is cholesky or ldlt */
+#define JTEST_ARM_MAT_DECOMPOSITION_F32_TEST(fn)                        \
+    JTEST_DEFINE_TEST(arm_mat_##fn##_f32_test, arm_mat_##fn##_f32)      \
+    {                                                                   \
+        arm_status fut_status;                                          \
+                                                                        \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            mat_idx, arm_matrix_instance_f32 *, mat_ptr,                \
+            matrix_f32_invertible_inputs                                \
+            ,                                                           \
+            JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n",               \
+                            (int)mat_ptr->numRows,                      \
+                            (int)mat_ptr->numCols);                     \
+                                                                        \
+            matrix_make_spd(mat_ptr);                                   \
+            MATRIX_TEST_CONFIG_SAMESIZE_OUTPUT(                         \
+                arm_matrix_instance_f32 *, &matrix_spd_f32);            \
+                                                                        \
+            JTEST_COUNT_CYCLES(                                         \
+                fut_status = arm_mat_##fn##_f32(&matrix_spd_f32,        \
+                                                &matrix_output_fut));   \
+            ref_mat_##fn##_f32(&matrix_spd_f32, &matrix_output_ref);    \
+                                                                        \
+            TEST_ASSERT_EQUAL(fut_status, ARM_MATH_SUCCESS);            \
+            MATRIX_SNR_COMPARE_INTERFACE(arm_matrix_instance_f32,       \
+                                         float32_t);                    \
+                                                                        \
+            /* In-place */                                              \
+            fut_status = arm_mat_##fn##_f32(&matrix_spd_f32,            \
+                                            &matrix_spd_f32);           \
+            TEST_ASSERT_EQUAL(fut_status, ARM_MATH_SUCCESS);            \
+            TEST_ASSERT_BUFFERS_EQUAL(matrix_spd_f32.pData,             \
+                                      matrix_output_fut.pData,          \
+                                      matrix_spd_f32.numRows *          \
+                                      matrix_spd_f32.numCols *          \
+                                      sizeof(float32_t)));              \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+JTEST_ARM_MAT_DECOMPOSITION_F32_TEST(cholesky);
+JTEST_ARM_MAT_DECOMPOSITION_F32_TEST(ldlt);
+
+JTEST_DEFINE_TEST(arm_mat_cholesky_f64_test, arm_mat_cholesky_f64)
+{
+    arm_status fut_status;
+
+    TEMPLATE_DO_ARR_DESC(
+        mat_idx, arm_matrix_instance_f32 *, mat_ptr, matrix_f32_invertible_inputs
+        ,
+        JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n",
+                        (int)mat_ptr->numRows,
+                        (int)mat_ptr->numCols);
+
+        matrix_make_spd(mat_ptr);
+        matrix_output_fut64.numRows = matrix_output_ref64.numRows = mat_ptr->numRows;
+        matrix_output_fut64.numCols = matrix_output_ref64.numCols = mat_ptr->numCols;
+
+        JTEST_COUNT_CYCLES(
+            fut_status = arm_mat_cholesky_f64(&matrix_spd_f64, &matrix_output_fut64));
+        ref_mat_cholesky_f64(&matrix_spd_f64, &matrix_output_ref64);
+
+        TEST_ASSERT_EQUAL(fut_status, ARM_MATH_SUCCESS);
+        MATRIX_DBL_OUTPUT_SNR_COMPARE());
+
+    return JTEST_TEST_PASSED;
+}
+
+/* A negative definite matrix has no Cholesky decomposition */
+JTEST_DEFINE_TEST(arm_mat_cholesky_f32_failure_test, arm_mat_cholesky_f32)
+{
+    uint32_t i;
+
+    matrix_make_spd(ARR_DESC_ELT(arm_matrix_instance_f32 *, 2,
+                                 &matrix_f32_invertible_inputs));
+
+    for (i = 0; i < (uint32_t) matrix_spd_f32.numRows * matrix_spd_f32.numCols; i++)
+    {
+        matrix_spd_f32.pData[i] = -matrix_spd_f32.pData[i];
+    }
+
+    TEST_ASSERT_EQUAL(arm_mat_cholesky_f32(&matrix_spd_f32, &matrix_fact_f32),
+                      ARM_MATH_DECOMPOSITION_FAILURE);
+
+    /* The LDL' decomposition of a negative definite matrix exists */
+    TEST_ASSERT_EQUAL(arm_mat_ldlt_f32(&matrix_spd_f32, &matrix_fact_f32),
+                      ARM_MATH_SUCCESS);
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Solves */
+/*--------------------------------------------------------------------------------*/
+
+/* Solves (M * M' + 1000 * I) * X = M with the factors of the reference
+ * decomposition. fn is cholesky or ldlt. */
+#define JTEST_ARM_MAT_SOLVE_F32_TEST(fn)                                \
+    JTEST_DEFINE_TEST(arm_mat_##fn##_solve_f32_test,                    \
+                      arm_mat_##fn##_solve_f32)                         \
+    {                                                                   \
+        arm_status fut_status;                                          \
+                                                                        \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            mat_idx, arm_matrix_instance_f32 *, mat_ptr,                \
+            matrix_f32_invertible_inputs                                \
+            ,                                                           \
+            JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n",               \
+                            (int)mat_ptr->numRows,                      \
+                            (int)mat_ptr->numCols);                     \
+                                                                        \
+            matrix_make_spd(mat_ptr);                                   \
+            ref_mat_##fn##_f32(&matrix_spd_f32, &matrix_fact_f32);      \
+            MATRIX_TEST_CONFIG_SAMESIZE_OUTPUT(                         \
+                arm_matrix_instance_f32 *, mat_ptr);                    \
+                                                                        \
+            JTEST_COUNT_CYCLES(                                         \
+                fut_status = arm_mat_##fn##_solve_f32(&matrix_fact_f32, \
+                                                      mat_ptr,          \
+                                                      &matrix_output_fut)); \
+            ref_mat_##fn##_solve_f32(&matrix_fact_f32, mat_ptr,         \
+                                     &matrix_output_ref);               \
+                                                                        \
+            TEST_ASSERT_EQUAL(fut_status, ARM_MATH_SUCCESS);            \
+            MATRIX_SNR_COMPARE_INTERFACE(arm_matrix_instance_f32,       \
+                                         float32_t));                   \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+JTEST_ARM_MAT_SOLVE_F32_TEST(cholesky);
+JTEST_ARM_MAT_SOLVE_F32_TEST(ldlt);
+
+JTEST_DEFINE_TEST(arm_mat_cholesky_solve_f64_test, arm_mat_cholesky_solve_f64)
+{
+    arm_status fut_status;
+
+    TEMPLATE_DO_ARR_DESC(
+        mat_idx, arm_matrix_instance_f32 *, mat_ptr, matrix_f32_invertible_inputs
+        ,
+        JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n",
+                        (int)mat_ptr->numRows,
+                        (int)mat_ptr->numCols);
+
+        matrix_make_spd(mat_ptr);
+        matrix_make_rhs_f64(mat_ptr);
+        ref_mat_cholesky_f64(&matrix_spd_f64, &matrix_fact_f64);
+        matrix_output_fut64.numRows = matrix_output_ref64.numRows = mat_ptr->numRows;
+        matrix_output_fut64.numCols = matrix_output_ref64.numCols = mat_ptr->numCols;
+
+        JTEST_COUNT_CYCLES(
+            fut_status = arm_mat_cholesky_solve_f64(&matrix_fact_f64,
+                                                    &matrix_rhs_f64,
+                                                    &matrix_output_fut64));
+        ref_mat_cholesky_solve_f64(&matrix_fact_f64, &matrix_rhs_f64, &matrix_output_ref64);
+
+        TEST_ASSERT_EQUAL(fut_status, ARM_MATH_SUCCESS);
+        MATRIX_DBL_OUTPUT_SNR_COMPARE());
+
+    return JTEST_TEST_PASSED;
+}
+
+/* The triangular solves use the Cholesky factor L and its transpose */
+#define JTEST_ARM_MAT_SOLVE_TRIANGULAR_F32_TEST(fn, transpose)          \
+    JTEST_DEFINE_TEST(arm_mat_solve_##fn##_triangular_f32_test,         \
+                      arm_mat_solve_##fn##_triangular_f32)              \
+    {                                                                   \
+        arm_status fut_status;                                          \
+                                                                        \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            mat_idx, arm_matrix_instance_f32 *, mat_ptr,                \
+            matrix_f32_invertible_inputs                                \
+            ,                                                           \
+            JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n",               \
+                            (int)mat_ptr->numRows,                      \
+                            (int)mat_ptr->numCols);                     \
+                                                                        \
+            matrix_make_spd(mat_ptr);                                   \
+            ref_mat_cholesky_f32(&matrix_spd_f32, &matrix_fact_f32);    \
+            if (transpose)                                              \
+            {                                                           \
+                ref_mat_trans_f32(&matrix_fact_f32, &matrix_spd_f32);   \
+            }                                                           \
+            else                                                        \
+            {                                                           \
+                ref_copy_f32(matrix_fact_f32.pData, matrix_spd_f32.pData, \
+                             matrix_fact_f32.numRows *                  \
+                             matrix_fact_f32.numCols);                  \
+            }                                                           \
+            MATRIX_TEST_CONFIG_SAMESIZE_OUTPUT(                         \
+                arm_matrix_instance_f32 *, mat_ptr);                    \
+                                                                        \
+            JTEST_COUNT_CYCLES(                                         \
+                fut_status = arm_mat_solve_##fn##_triangular_f32(       \
+                    &matrix_spd_f32, mat_ptr, &matrix_output_fut));     \
+            ref_mat_solve_##fn##_triangular_f32(                        \
+                &matrix_spd_f32, mat_ptr, &matrix_output_ref);          \
+                                                                        \
+            TEST_ASSERT_EQUAL(fut_status, ARM_MATH_SUCCESS);            \
+            MATRIX_SNR_COMPARE_INTERFACE(arm_matrix_instance_f32,       \
+                                         float32_t);                    \
+                                                                        \
+            /* A zero on the diagonal */                                \
+            matrix_spd_f32.pData[0] = 0.0f;                             \
+            TEST_ASSERT_EQUAL(arm_mat_solve_##fn##_triangular_f32(      \
+                                  &matrix_spd_f32, mat_ptr,             \
+                                  &matrix_output_fut),                  \
+                              ARM_MATH_SINGULAR));                      \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+JTEST_ARM_MAT_SOLVE_TRIANGULAR_F32_TEST(lower, 0);
+JTEST_ARM_MAT_SOLVE_TRIANGULAR_F32_TEST(upper, 1);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(mat_cholesky_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_mat_cholesky_f32_test);
+    JTEST_TEST_CALL(arm_mat_cholesky_f64_test);
+    JTEST_TEST_CALL(arm_mat_cholesky_f32_failure_test);
+    JTEST_TEST_CALL(arm_mat_cholesky_solve_f32_test);
+    JTEST_TEST_CALL(arm_mat_cholesky_solve_f64_test);
+    JTEST_TEST_CALL(arm_mat_ldlt_f32_test);
+    JTEST_TEST_CALL(arm_mat_ldlt_solve_f32_test);
+    JTEST_TEST_CALL(arm_mat_solve_lower_triangular_f32_test);
+    JTEST_TEST_CALL(arm_mat_solve_upper_triangular_f32_test);
+}
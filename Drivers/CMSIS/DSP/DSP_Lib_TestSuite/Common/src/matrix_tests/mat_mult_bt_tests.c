@@ -0,0 +1,35 @@
+#include "jtest.h"
+#include "matrix_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "matrix_templates.h"
+#include "type_abbrev.h"
+
+/* The b inputs are used as the transposed second matrices. */
+#define JTEST_ARM_MAT_MULT_BT_TEST(suffix)                      \
+    MATRIX_DEFINE_TEST_TEMPLATE_ELT2(                           \
+        mat_mult_bt,                                            \
+        suffix,                                                 \
+        MATRIX_TEST_CONFIG_TRANSPOSED_MULTIPLICATIVE_OUTPUT,    \
+        MATRIX_TEST_VALID_TRANSPOSED_MULTIPLICATIVE_DIMENSIONS, \
+        MATRIX_COMPARE_INTERFACE)
+
+JTEST_ARM_MAT_MULT_BT_TEST(f32);
+JTEST_ARM_MAT_MULT_BT_TEST(q31);
+JTEST_ARM_MAT_MULT_BT_TEST(q15);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(mat_mult_bt_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_mat_mult_bt_f32_test);
+    JTEST_TEST_CALL(arm_mat_mult_bt_q31_test);
+    JTEST_TEST_CALL(arm_mat_mult_bt_q15_test);
+}
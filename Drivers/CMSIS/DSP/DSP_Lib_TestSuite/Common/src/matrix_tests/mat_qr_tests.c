@@ -0,0 +1,133 @@
+#include "jtest.h"
+#include "matrix_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "matrix_templates.h"
+#include "type_abbrev.h"
+
+/* The decomposition takes the transposes of the a inputs: square or tall
+ * matrices. The wide inputs themselves must be rejected. */
+static float32_t matrix_qr_input_data[MATRIX_TEST_MAX_ELTS];
+static float32_t matrix_qr_fact_data[MATRIX_TEST_MAX_ELTS];
+static float32_t matrix_qr_rhs_data[MATRIX_TEST_MAX_ELTS];
+static float32_t matrix_qr_rhs_ref_data[MATRIX_TEST_MAX_ELTS];
+static float32_t matrix_qr_tau_fut[MATRIX_TEST_MAX_COLS];
+static float32_t matrix_qr_tau_ref[MATRIX_TEST_MAX_COLS];
+
+static arm_matrix_instance_f32 matrix_qr_input = {0, 0, matrix_qr_input_data};
+static arm_matrix_instance_f32 matrix_qr_fact = {0, 0, matrix_qr_fact_data};
+static arm_matrix_instance_f32 matrix_qr_rhs = {0, 0, matrix_qr_rhs_data};
+static arm_matrix_instance_f32 matrix_qr_rhs_ref = {0, 0, matrix_qr_rhs_ref_data};
+
+JTEST_DEFINE_TEST(arm_mat_qr_f32_test, arm_mat_qr_f32)
+{
+    arm_status fut_status;
+
+    TEMPLATE_DO_ARR_DESC(
+        mat_idx, arm_matrix_instance_f32 *, mat_ptr, matrix_f32_a_inputs
+        ,
+        JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n",
+                        (int)mat_ptr->numCols,
+                        (int)mat_ptr->numRows);
+
+        if (mat_ptr->numRows < mat_ptr->numCols)
+        {
+            MATRIX_TEST_CONFIG_SAMESIZE_OUTPUT(arm_matrix_instance_f32 *, mat_ptr);
+            TEST_ASSERT_EQUAL(arm_mat_qr_f32(mat_ptr, &matrix_output_fut,
+                                             matrix_qr_tau_fut),
+                              ARM_MATH_SIZE_MISMATCH);
+        }
+
+        MATRIX_TEST_CONFIG_TRANSPOSE_OUTPUT(arm_matrix_instance_f32 *, mat_ptr);
+        matrix_qr_input.numRows = mat_ptr->numCols;
+        matrix_qr_input.numCols = mat_ptr->numRows;
+        ref_mat_trans_f32(mat_ptr, &matrix_qr_input);
+
+        JTEST_COUNT_CYCLES(
+            fut_status = arm_mat_qr_f32(&matrix_qr_input, &matrix_output_fut,
+                                        matrix_qr_tau_fut));
+        ref_mat_qr_f32(&matrix_qr_input, &matrix_output_ref, matrix_qr_tau_ref);
+
+        TEST_ASSERT_EQUAL(fut_status, ARM_MATH_SUCCESS);
+        MATRIX_SNR_COMPARE_INTERFACE(arm_matrix_instance_f32, float32_t);
+        TEST_ASSERT_SNR(matrix_qr_tau_ref, matrix_qr_tau_fut,
+                        matrix_qr_input.numCols, MATRIX_SNR_THRESHOLD);
+
+        /* In-place */
+        fut_status = arm_mat_qr_f32(&matrix_qr_input, &matrix_qr_input,
+                                    matrix_qr_tau_fut);
+        TEST_ASSERT_EQUAL(fut_status, ARM_MATH_SUCCESS);
+        TEST_ASSERT_BUFFERS_EQUAL(matrix_qr_input.pData,
+                                  matrix_output_fut.pData,
+                                  matrix_qr_input.numRows *
+                                  matrix_qr_input.numCols *
+                                  sizeof(float32_t)));
+
+    return JTEST_TEST_PASSED;
+}
+
+/* Least squares solves of M' * x = b, b being the first elements of the b
+ * input of the same index, with the reference decomposition of M' */
+JTEST_DEFINE_TEST(arm_mat_qr_solve_f32_test, arm_mat_qr_solve_f32)
+{
+    arm_status fut_status;
+    arm_matrix_instance_f32 * rhs_ptr;
+    uint32_t i;
+
+    TEMPLATE_DO_ARR_DESC(
+        mat_idx, arm_matrix_instance_f32 *, mat_ptr, matrix_f32_a_inputs
+        ,
+        JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n",
+                        (int)mat_ptr->numCols,
+                        (int)mat_ptr->numRows);
+
+        matrix_qr_input.numRows = mat_ptr->numCols;
+        matrix_qr_input.numCols = mat_ptr->numRows;
+        ref_mat_trans_f32(mat_ptr, &matrix_qr_input);
+        matrix_qr_fact.numRows = matrix_qr_input.numRows;
+        matrix_qr_fact.numCols = matrix_qr_input.numCols;
+        ref_mat_qr_f32(&matrix_qr_input, &matrix_qr_fact, matrix_qr_tau_ref);
+
+        rhs_ptr = ARR_DESC_ELT(arm_matrix_instance_f32 *, mat_idx,
+                               &matrix_f32_b_inputs);
+        matrix_qr_rhs.numRows = matrix_qr_rhs_ref.numRows = matrix_qr_input.numRows;
+        matrix_qr_rhs.numCols = matrix_qr_rhs_ref.numCols = 1;
+        for (i = 0; i < matrix_qr_input.numRows; i++)
+        {
+            matrix_qr_rhs.pData[i] = rhs_ptr->pData[i];
+            matrix_qr_rhs_ref.pData[i] = rhs_ptr->pData[i];
+        }
+
+        matrix_output_fut.numRows = matrix_output_ref.numRows = matrix_qr_input.numCols;
+        matrix_output_fut.numCols = matrix_output_ref.numCols = 1;
+
+        JTEST_COUNT_CYCLES(
+            fut_status = arm_mat_qr_solve_f32(&matrix_qr_fact, matrix_qr_tau_ref,
+                                              &matrix_qr_rhs, &matrix_output_fut));
+        ref_mat_qr_solve_f32(&matrix_qr_fact, matrix_qr_tau_ref,
+                             &matrix_qr_rhs_ref, &matrix_output_ref);
+
+        TEST_ASSERT_EQUAL(fut_status, ARM_MATH_SUCCESS);
+        MATRIX_SNR_COMPARE_INTERFACE(arm_matrix_instance_f32, float32_t);
+
+        /* Q' * b, the residuals in its last rows */
+        TEST_ASSERT_SNR(matrix_qr_rhs_ref.pData, matrix_qr_rhs.pData,
+                        matrix_qr_rhs.numRows, MATRIX_SNR_THRESHOLD));
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(mat_qr_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_mat_qr_f32_test);
+    JTEST_TEST_CALL(arm_mat_qr_solve_f32_test);
+}
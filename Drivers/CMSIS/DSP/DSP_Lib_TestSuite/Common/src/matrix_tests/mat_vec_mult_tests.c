@@ -0,0 +1,64 @@
+#include "jtest.h"
+#include "matrix_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "matrix_templates.h"
+#include "type_abbrev.h"
+
+/* The data of the b inputs are used as the vectors: each one holds at least
+ * as many elements as the columns of the a input of the same index. The
+ * outputs are the column matrices of the products. */
+#define JTEST_ARM_MAT_VEC_MULT_TEST(suffix)                             \
+    JTEST_DEFINE_TEST(arm_mat_vec_mult_##suffix##_test,                 \
+                      arm_mat_vec_mult_##suffix)                        \
+    {                                                                   \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            mat_idx, arm_matrix_instance_##suffix *,                    \
+            mat_ptr, matrix_##suffix##_a_inputs                         \
+            ,                                                           \
+            arm_matrix_instance_##suffix * vec_ptr = ARR_DESC_ELT(      \
+                arm_matrix_instance_##suffix *, mat_idx,                \
+                &(matrix_##suffix##_b_inputs));                         \
+                                                                        \
+            MATRIX_TEST_CONFIG_MULTIPLICATIVE_OUTPUT(                   \
+                arm_matrix_instance_##suffix *, mat_ptr, mat_ptr);      \
+            matrix_output_fut.numCols = 1;                              \
+            matrix_output_ref.numCols = 1;                              \
+                                                                        \
+            JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n",               \
+                            (int)mat_ptr->numRows,                      \
+                            (int)mat_ptr->numCols);                     \
+                                                                        \
+            TEST_CALL_FUT_AND_REF(                                      \
+                arm_mat_vec_mult_##suffix,                              \
+                (mat_ptr, vec_ptr->pData,                               \
+                 ((arm_matrix_instance_##suffix *) &matrix_output_fut)->pData), \
+                ref_mat_vec_mult_##suffix,                              \
+                (mat_ptr, vec_ptr->pData,                               \
+                 ((arm_matrix_instance_##suffix *) &matrix_output_ref)->pData)); \
+                                                                        \
+            MATRIX_COMPARE_INTERFACE(arm_matrix_instance_##suffix,      \
+                                     TYPE_FROM_ABBREV(suffix)));        \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+JTEST_ARM_MAT_VEC_MULT_TEST(f32);
+JTEST_ARM_MAT_VEC_MULT_TEST(q31);
+JTEST_ARM_MAT_VEC_MULT_TEST(q15);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(mat_vec_mult_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_mat_vec_mult_f32_test);
+    JTEST_TEST_CALL(arm_mat_vec_mult_q31_test);
+    JTEST_TEST_CALL(arm_mat_vec_mult_q15_test);
+}
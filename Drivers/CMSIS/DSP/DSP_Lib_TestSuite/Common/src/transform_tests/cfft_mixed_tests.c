@@ -0,0 +1,174 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+
+/* The transforms are compared to the direct DFT in double precision */
+#define CFFT_MIXED_SNR_THRESHOLD 120
+
+/* Twiddle factors and work buffer of arm_cfft_mixed_init_f32() (4*fftLen values)
+   and arm_rfft_mixed_init_f32() (3*fftLen values) */
+static float32_t cfft_mixed_buffer[4 * TRANSFORM_MAX_MIXED_FFT_LEN];
+
+/*
+  Mixed-radix CFFT function test template. Argument is the inverse-transform
+  flag.
+*/
+#define CFFT_MIXED_DEFINE_TEST(config_suffix, ifft_flag)                \
+    JTEST_DEFINE_TEST(arm_cfft_mixed_f32_##config_suffix##_test,        \
+                      arm_cfft_mixed_f32)                               \
+    {                                                                   \
+        arm_cfft_mixed_instance_f32 cfft_inst_fut;                      \
+                                                                        \
+        /* Go through all FFT lengths */                                \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            fftlen_idx, uint16_t, fftlen, transform_mixed_fftlens       \
+            ,                                                           \
+                                                                        \
+            if (arm_cfft_mixed_init_f32(&cfft_inst_fut, fftlen,         \
+                    cfft_mixed_buffer) != ARM_MATH_SUCCESS)             \
+            {                                                           \
+                JTEST_DUMP_STRF("%s failed\n",                          \
+                                "arm_cfft_mixed_init_f32");             \
+                return JTEST_TEST_FAILED;                               \
+            }                                                           \
+                                                                        \
+            TRANSFORM_PREPARE_INPLACE_INPUTS(                           \
+                transform_fft_f32_inputs,                               \
+                fftlen *                                                \
+                sizeof(float32_t) *                                     \
+                2 /*complex_inputs*/);                                  \
+                                                                        \
+            /* Display parameter values */                              \
+            JTEST_DUMP_STRF("Block Size: %d\n"                          \
+                            "Inverse-transform flag: %d\n",             \
+                            (int)fftlen,                                \
+                            (int)ifft_flag);                            \
+                                                                        \
+            /* Display cycle count and run test */                      \
+            JTEST_COUNT_CYCLES(                                         \
+                arm_cfft_mixed_f32(&cfft_inst_fut,                      \
+                    (void *) transform_fft_inplace_input_fut,           \
+                    ifft_flag));                                        \
+            ref_cfft_mixed_f32(&cfft_inst_fut,                          \
+                (void *) transform_fft_inplace_input_ref,               \
+                ifft_flag);                                             \
+                                                                        \
+            /* Test correctness */                                      \
+            TEST_CONVERT_AND_ASSERT_SNR(                                \
+                transform_fft_output_f32_ref,                           \
+                (float32_t *) transform_fft_output_ref,                 \
+                transform_fft_output_f32_fut,                           \
+                (float32_t *) transform_fft_output_fut,                 \
+                fftlen * 2,                                             \
+                float32_t,                                              \
+                CFFT_MIXED_SNR_THRESHOLD));                             \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+/*
+  Mixed-radix RFFT function test template. Argument is the inverse-transform
+  flag: the inverse transform input is a packed spectrum.
+*/
+#define RFFT_MIXED_DEFINE_TEST(config_suffix, ifft_flag)                \
+    JTEST_DEFINE_TEST(arm_rfft_mixed_f32_##config_suffix##_test,        \
+                      arm_rfft_mixed_f32)                               \
+    {                                                                   \
+        arm_rfft_mixed_instance_f32 rfft_inst_fut;                      \
+                                                                        \
+        /* Go through all FFT lengths */                                \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            fftlen_idx, uint16_t, fftlen, transform_mixed_fftlens       \
+            ,                                                           \
+                                                                        \
+            if (arm_rfft_mixed_init_f32(&rfft_inst_fut, fftlen,         \
+                    cfft_mixed_buffer) != ARM_MATH_SUCCESS)             \
+            {                                                           \
+                JTEST_DUMP_STRF("%s failed\n",                          \
+                                "arm_rfft_mixed_init_f32");             \
+                return JTEST_TEST_FAILED;                               \
+            }                                                           \
+                                                                        \
+            TRANSFORM_COPY_INPUTS(                                      \
+                transform_fft_f32_inputs,                               \
+                fftlen *                                                \
+                sizeof(float32_t));                                     \
+                                                                        \
+            /* Display parameter values */                              \
+            JTEST_DUMP_STRF("Block Size: %d\n"                          \
+                            "Inverse-transform flag: %d\n",             \
+                            (int)fftlen,                                \
+                            (int)ifft_flag);                            \
+                                                                        \
+            /* Display cycle count and run test */                      \
+            JTEST_COUNT_CYCLES(                                         \
+                arm_rfft_mixed_f32(&rfft_inst_fut,                      \
+                    (void *) transform_fft_input_fut,                   \
+                    (void *) transform_fft_output_fut,                  \
+                    ifft_flag));                                        \
+            ref_rfft_mixed_f32(&rfft_inst_fut,                          \
+                (void *) transform_fft_input_ref,                       \
+                (void *) transform_fft_output_ref,                      \
+                ifft_flag);                                             \
+                                                                        \
+            /* Test correctness */                                      \
+            TEST_CONVERT_AND_ASSERT_SNR(                                \
+                transform_fft_output_f32_ref,                           \
+                (float32_t *) transform_fft_output_ref,                 \
+                transform_fft_output_f32_fut,                           \
+                (float32_t *) transform_fft_output_fut,                 \
+                fftlen,                                                 \
+                float32_t,                                              \
+                CFFT_MIXED_SNR_THRESHOLD));                             \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+CFFT_MIXED_DEFINE_TEST(forward, 0U);
+CFFT_MIXED_DEFINE_TEST(inverse, 1U);
+RFFT_MIXED_DEFINE_TEST(forward, 0U);
+RFFT_MIXED_DEFINE_TEST(inverse, 1U);
+
+/* Lengths with other prime factors than 2, 3 and 5, and odd real lengths */
+JTEST_DEFINE_TEST(arm_cfft_mixed_init_f32_test, arm_cfft_mixed_init_f32)
+{
+    arm_cfft_mixed_instance_f32 cfft_inst_fut;
+    arm_rfft_mixed_instance_f32 rfft_inst_fut;
+
+    if ((arm_cfft_mixed_init_f32(&cfft_inst_fut, 0U, cfft_mixed_buffer) != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_cfft_mixed_init_f32(&cfft_inst_fut, 7U, cfft_mixed_buffer) != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_cfft_mixed_init_f32(&cfft_inst_fut, 1000U * 7U, cfft_mixed_buffer) != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_rfft_mixed_init_f32(&rfft_inst_fut, 1005U, cfft_mixed_buffer) != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_rfft_mixed_init_f32(&rfft_inst_fut, 2U * 11U, cfft_mixed_buffer) != ARM_MATH_ARGUMENT_ERROR))
+    {
+        JTEST_DUMP_STRF("%s failed\n", "arm_cfft_mixed_init_f32");
+        return JTEST_TEST_FAILED;
+    }
+
+    /* 3000 = 4 * 2 * 3 * 5 * 5 * 5 */
+    if ((arm_cfft_mixed_init_f32(&cfft_inst_fut, 3000U, cfft_mixed_buffer) != ARM_MATH_SUCCESS) ||
+        (cfft_inst_fut.numStages != 6U) ||
+        (cfft_inst_fut.radix[0] != 4U) || (cfft_inst_fut.radix[1] != 2U) ||
+        (cfft_inst_fut.radix[2] != 3U) || (cfft_inst_fut.radix[5] != 5U))
+    {
+        JTEST_DUMP_STRF("%s failed\n", "arm_cfft_mixed_init_f32");
+        return JTEST_TEST_FAILED;
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(cfft_mixed_tests)
+{
+    JTEST_TEST_CALL(arm_cfft_mixed_init_f32_test);
+    JTEST_TEST_CALL(arm_cfft_mixed_f32_forward_test);
+    JTEST_TEST_CALL(arm_cfft_mixed_f32_inverse_test);
+    JTEST_TEST_CALL(arm_rfft_mixed_f32_forward_test);
+    JTEST_TEST_CALL(arm_rfft_mixed_f32_inverse_test);
+}
@@ -96,6 +96,78 @@
     } while (0)
 
 
+/* Twiddle factors of arm_cfft_init_twiddle_xxx(), up to the 256 points CFFT */
+static float32_t cfft_twiddle_buffer_f32[2 * 256];
+static q31_t cfft_twiddle_buffer_q31[3 * 256 / 2];
+static q15_t cfft_twiddle_buffer_q15[3 * 256 / 2];
+
+/*
+  CFFT function test template, the instance being initialized by
+  arm_cfft_init_xxx() and arm_cfft_init_twiddle_xxx(). Arguments are:
+  inverse-transform flag, function suffix (q15/q31/f32) and the output type
+  (q15_t, q31_t, float32_t). The reference uses the constant instance.
+*/
+#define CFFT_INIT_TEST_BODY(ifft_flag, suffix, output_type)                             \
+    do                                                                                  \
+    {                                                                                   \
+        arm_cfft_instance_##suffix cfft_inst_fut;                                       \
+                                                                                        \
+        /* Go through all arm_cfft_instances */                                         \
+        TEMPLATE_DO_ARR_DESC(                                                           \
+            cfft_inst_idx, const arm_cfft_instance_##suffix *, cfft_inst_ptr,           \
+            transform_cfft_##suffix##_structs                                           \
+            ,                                                                           \
+                                                                                        \
+            /* The flash tables are the ones of the constant instance */                \
+            if ((arm_cfft_init_##suffix(&cfft_inst_fut, cfft_inst_ptr->fftLen) !=       \
+                 ARM_MATH_SUCCESS) ||                                                   \
+                (cfft_inst_fut.pTwiddle != cfft_inst_ptr->pTwiddle) ||                  \
+                (cfft_inst_fut.pBitRevTable != cfft_inst_ptr->pBitRevTable) ||          \
+                (cfft_inst_fut.bitRevLength != cfft_inst_ptr->bitRevLength))            \
+            {                                                                           \
+                JTEST_DUMP_STRF("%s failed\n", "arm_cfft_init_" #suffix);               \
+                return JTEST_TEST_FAILED;                                               \
+            }                                                                           \
+                                                                                        \
+            if (arm_cfft_init_twiddle_##suffix(&cfft_inst_fut, cfft_inst_ptr->fftLen,   \
+                    cfft_twiddle_buffer_##suffix) != ARM_MATH_SUCCESS)                  \
+            {                                                                           \
+                JTEST_DUMP_STRF("%s failed\n", "arm_cfft_init_twiddle_" #suffix);       \
+                return JTEST_TEST_FAILED;                                               \
+            }                                                                           \
+                                                                                        \
+            TRANSFORM_PREPARE_INPLACE_INPUTS(                                           \
+                transform_fft_##suffix##_inputs,                                        \
+                cfft_inst_ptr->fftLen *                                                 \
+                sizeof(output_type) *                                                   \
+                2 /*complex_inputs*/);                                                  \
+                                                                                        \
+            /* Display parameter values */                                              \
+            JTEST_DUMP_STRF("Block Size: %d\n"                                          \
+                            "Inverse-transform flag: %d\n",                             \
+                            (int)cfft_inst_ptr->fftLen,                                 \
+                            (int)ifft_flag);                                            \
+                                                                                        \
+            /* Display cycle count and run test */                                      \
+            JTEST_COUNT_CYCLES(                                                         \
+                arm_cfft_##suffix(&cfft_inst_fut,                                       \
+                             (void *) transform_fft_inplace_input_fut,                  \
+                             ifft_flag,              /* IFFT Flag */                    \
+                             1));            /* Bitreverse flag */                      \
+            ref_cfft_##suffix(cfft_inst_ptr,                                            \
+                         (void *) transform_fft_inplace_input_ref,                      \
+                         ifft_flag,         /* IFFT Flag */                             \
+                         1);        /* Bitreverse flag */                               \
+                                                                                        \
+            /* Test correctness */                                                      \
+            TRANSFORM_SNR_COMPARE_CMPLX_INTERFACE(                                      \
+                cfft_inst_ptr->fftLen,                                                  \
+                output_type));                                                          \
+                                                                                        \
+        return JTEST_TEST_PASSED;                                                       \
+    } while (0)
+
+
 /* Test declarations */
 JTEST_DEFINE_TEST(cfft_f32_test, cfft_f32)
 {
@@ -127,6 +199,26 @@ JTEST_DEFINE_TEST(cfft_q15_ifft_test, cfft_q15)
     CFFT_TEST_BODY((uint8_t) 1, q15, q15_t);
 }
 
+JTEST_DEFINE_TEST(cfft_init_f32_test, cfft_f32)
+{
+    CFFT_INIT_TEST_BODY((uint8_t) 0, f32, float32_t);
+}
+
+JTEST_DEFINE_TEST(cfft_init_f32_ifft_test, cfft_f32)
+{
+    CFFT_INIT_TEST_BODY((uint8_t) 1, f32, float32_t);
+}
+
+JTEST_DEFINE_TEST(cfft_init_q31_test, cfft_q31)
+{
+    CFFT_INIT_TEST_BODY((uint8_t) 0, q31, q31_t);
+}
+
+JTEST_DEFINE_TEST(cfft_init_q15_test, cfft_q15)
+{
+    CFFT_INIT_TEST_BODY((uint8_t) 0, q15, q15_t);
+}
+
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group */
 /*--------------------------------------------------------------------------------*/
@@ -141,4 +233,9 @@ JTEST_DEFINE_GROUP(cfft_tests)
 
     JTEST_TEST_CALL(cfft_q15_test);
     JTEST_TEST_CALL(cfft_q15_ifft_test);
+
+    JTEST_TEST_CALL(cfft_init_f32_test);
+    JTEST_TEST_CALL(cfft_init_f32_ifft_test);
+    JTEST_TEST_CALL(cfft_init_q31_test);
+    JTEST_TEST_CALL(cfft_init_q15_test);
 }
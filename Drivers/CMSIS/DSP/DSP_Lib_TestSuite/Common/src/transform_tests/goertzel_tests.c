@@ -0,0 +1,243 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Macros and Defines */
+/*--------------------------------------------------------------------------------*/
+
+/* Samples streamed through the Goertzel filters and the sliding DFT */
+#define GOERTZEL_SIGNAL_LEN 4096
+#define SDFT_SIGNAL_LEN 2048
+#define GOERTZEL_MAX_LEN 1000
+#define GOERTZEL_MAX_BINS 8
+
+/*--------------------------------------------------------------------------------*/
+/* Input Data */
+/*--------------------------------------------------------------------------------*/
+
+/* Block lengths and their bins: DC and Nyquist, DTMF detection at 8 kHz, bins
+   near the ends of the spectrum and a length which is not an FFT length */
+static const uint16_t goertzel_lens[] = { 64, 205, 256, 1000 };
+static const uint16_t goertzel_num_bins[] = { 4, 8, 5, 3 };
+static const uint16_t goertzel_bins[] =
+{
+    0, 1, 5, 32,
+    18, 20, 22, 24, 31, 34, 38, 42,
+    1, 3, 100, 128, 255,
+    7, 50, 333
+};
+#define GOERTZEL_NUM_CONFIGS (sizeof(goertzel_lens) / sizeof(goertzel_lens[0]))
+
+/* Sizes of the input blocks, used in turn */
+static const uint16_t goertzel_block_sizes[] = { 1, 5, 17, 64, 3, 200, 0, 129 };
+#define GOERTZEL_NUM_BLOCK_SIZES (sizeof(goertzel_block_sizes) / sizeof(goertzel_block_sizes[0]))
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Goertzel filter bank test template. Arguments are the function suffix, the
+  input/output type and the types of the coefficients and filter states. The sets of bins of the
+  signal streamed in blocks of varying sizes are compared to the DFT of each
+  detection block.
+*/
+#define GOERTZEL_DEFINE_TEST(suffix, type, coeff_type, state_type)      \
+    JTEST_DEFINE_TEST(arm_goertzel_##suffix##_test,                     \
+                      arm_goertzel_##suffix)                            \
+    {                                                                   \
+        static coeff_type coeffs[2 * GOERTZEL_MAX_BINS];                \
+        static state_type state[2 * GOERTZEL_MAX_BINS];                 \
+        arm_goertzel_instance_##suffix goertzel_inst_fut;               \
+        const uint16_t * bins = goertzel_bins;                          \
+        uint32_t cfg, done, n, b, sets_fut, sets_ref;                   \
+                                                                        \
+        for (cfg = 0; cfg < GOERTZEL_NUM_CONFIGS; cfg++)                \
+        {                                                               \
+            if (arm_goertzel_init_##suffix(&goertzel_inst_fut,          \
+                                           goertzel_num_bins[cfg],      \
+                                           goertzel_lens[cfg], bins,    \
+                                           coeffs, state)               \
+                != ARM_MATH_SUCCESS)                                    \
+            {                                                           \
+                JTEST_DUMP_STRF("%s failed\n",                          \
+                                "arm_goertzel_init_" #suffix);          \
+                return JTEST_TEST_FAILED;                               \
+            }                                                           \
+                                                                        \
+            TRANSFORM_COPY_INPUTS(                                      \
+                transform_fft_##suffix##_inputs,                        \
+                GOERTZEL_SIGNAL_LEN *                                   \
+                sizeof(type));                                          \
+                                                                        \
+            /* Display parameter values */                              \
+            JTEST_DUMP_STRF("Block Length: %d\n"                        \
+                            "Number of Bins: %d\n",                     \
+                            (int)goertzel_lens[cfg],                    \
+                            (int)goertzel_num_bins[cfg]);               \
+                                                                        \
+            sets_fut = 0;                                               \
+            done = 0;                                                   \
+            b = 0;                                                      \
+            while (done < GOERTZEL_SIGNAL_LEN)                          \
+            {                                                           \
+                n = goertzel_block_sizes[b++ % GOERTZEL_NUM_BLOCK_SIZES]; \
+                if (n > GOERTZEL_SIGNAL_LEN - done)                     \
+                {                                                       \
+                    n = GOERTZEL_SIGNAL_LEN - done;                     \
+                }                                                       \
+                                                                        \
+                sets_fut += arm_goertzel_##suffix(                      \
+                    &goertzel_inst_fut,                                 \
+                    (type *) transform_fft_input_fut + done,            \
+                    (type *) transform_fft_output_fut +                 \
+                    sets_fut * 2 * goertzel_num_bins[cfg],              \
+                    n);                                                 \
+                done += n;                                              \
+            }                                                           \
+                                                                        \
+            sets_ref = ref_goertzel_##suffix(                           \
+                &goertzel_inst_fut, bins,                               \
+                (type *) transform_fft_input_ref,                       \
+                (type *) transform_fft_output_ref,                      \
+                GOERTZEL_SIGNAL_LEN);                                   \
+                                                                        \
+            if (sets_fut != sets_ref)                                   \
+            {                                                           \
+                JTEST_DUMP_STRF("%d sets of bins instead of %d\n",      \
+                                (int)sets_fut, (int)sets_ref);          \
+                return JTEST_TEST_FAILED;                               \
+            }                                                           \
+                                                                        \
+            /* Test correctness */                                      \
+            TRANSFORM_SNR_COMPARE_INTERFACE(                            \
+                sets_ref * 2 * goertzel_num_bins[cfg],                  \
+                type);                                                  \
+                                                                        \
+            bins += goertzel_num_bins[cfg];                             \
+        }                                                               \
+                                                                        \
+        /* A bin must be below the block length */                      \
+        if (arm_goertzel_init_##suffix(&goertzel_inst_fut, 1, 16,       \
+                                       goertzel_lens, coeffs, state)    \
+            != ARM_MATH_ARGUMENT_ERROR)                                 \
+        {                                                               \
+            JTEST_DUMP_STRF("%s failed\n",                              \
+                            "arm_goertzel_init_" #suffix);              \
+            return JTEST_TEST_FAILED;                                   \
+        }                                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+GOERTZEL_DEFINE_TEST(f32, float32_t, float32_t, float32_t);
+GOERTZEL_DEFINE_TEST(q31, q31_t, q31_t, q63_t);
+GOERTZEL_DEFINE_TEST(q15, q15_t, q31_t, q31_t);
+
+/*
+  Sliding DFT test template. Arguments are the function suffix, the
+  input/output type and the type of the sums. The bins output after each block
+  of the stream are compared to the DFT of the last fftLen samples.
+*/
+#define SDFT_DEFINE_TEST(suffix, type, sum_type)                        \
+    JTEST_DEFINE_TEST(arm_sdft_##suffix##_test,                         \
+                      arm_sdft_##suffix)                                \
+    {                                                                   \
+        static type coeffs[2 * GOERTZEL_MAX_LEN];                       \
+        static type state[GOERTZEL_MAX_LEN];                            \
+        static sum_type sums[2 * GOERTZEL_MAX_BINS];                    \
+        arm_sdft_instance_##suffix sdft_inst_fut;                       \
+        const uint16_t * bins = goertzel_bins;                          \
+        uint32_t cfg, done, n, b, size;                                 \
+                                                                        \
+        for (cfg = 0; cfg < GOERTZEL_NUM_CONFIGS; cfg++)                \
+        {                                                               \
+            if (arm_sdft_init_##suffix(&sdft_inst_fut,                  \
+                                       goertzel_num_bins[cfg],          \
+                                       goertzel_lens[cfg], bins,        \
+                                       coeffs, state, sums)             \
+                != ARM_MATH_SUCCESS)                                    \
+            {                                                           \
+                JTEST_DUMP_STRF("%s failed\n",                          \
+                                "arm_sdft_init_" #suffix);              \
+                return JTEST_TEST_FAILED;                               \
+            }                                                           \
+                                                                        \
+            TRANSFORM_COPY_INPUTS(                                      \
+                transform_fft_##suffix##_inputs,                        \
+                SDFT_SIGNAL_LEN *                                       \
+                sizeof(type));                                          \
+                                                                        \
+            /* Display parameter values */                              \
+            JTEST_DUMP_STRF("FFT Length: %d\n"                          \
+                            "Number of Bins: %d\n",                     \
+                            (int)goertzel_lens[cfg],                    \
+                            (int)goertzel_num_bins[cfg]);               \
+                                                                        \
+            size = 0;                                                   \
+            done = 0;                                                   \
+            b = 0;                                                      \
+            while (done < SDFT_SIGNAL_LEN)                              \
+            {                                                           \
+                n = goertzel_block_sizes[b++ % GOERTZEL_NUM_BLOCK_SIZES]; \
+                if (n > SDFT_SIGNAL_LEN - done)                         \
+                {                                                       \
+                    n = SDFT_SIGNAL_LEN - done;                         \
+                }                                                       \
+                                                                        \
+                arm_sdft_##suffix(                                      \
+                    &sdft_inst_fut,                                     \
+                    (type *) transform_fft_input_fut + done,            \
+                    (type *) transform_fft_output_fut + size,           \
+                    n);                                                 \
+                done += n;                                              \
+                                                                        \
+                ref_sdft_##suffix(                                      \
+                    &sdft_inst_fut,                                     \
+                    (type *) transform_fft_input_ref,                   \
+                    (type *) transform_fft_output_ref + size,           \
+                    done);                                              \
+                size += 2 * goertzel_num_bins[cfg];                     \
+            }                                                           \
+                                                                        \
+            /* Test correctness */                                      \
+            TRANSFORM_SNR_COMPARE_INTERFACE(                            \
+                size,                                                   \
+                type);                                                  \
+                                                                        \
+            bins += goertzel_num_bins[cfg];                             \
+        }                                                               \
+                                                                        \
+        /* A bin must be below the FFT length */                        \
+        if (arm_sdft_init_##suffix(&sdft_inst_fut, 1, 16,               \
+                                   goertzel_lens, coeffs, state, sums)  \
+            != ARM_MATH_ARGUMENT_ERROR)                                 \
+        {                                                               \
+            JTEST_DUMP_STRF("%s failed\n",                              \
+                            "arm_sdft_init_" #suffix);                  \
+            return JTEST_TEST_FAILED;                                   \
+        }                                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+SDFT_DEFINE_TEST(f32, float32_t, float32_t);
+SDFT_DEFINE_TEST(q31, q31_t, q63_t);
+SDFT_DEFINE_TEST(q15, q15_t, q63_t);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(goertzel_tests)
+{
+    JTEST_TEST_CALL(arm_goertzel_f32_test);
+    JTEST_TEST_CALL(arm_goertzel_q31_test);
+    JTEST_TEST_CALL(arm_goertzel_q15_test);
+    JTEST_TEST_CALL(arm_sdft_f32_test);
+    JTEST_TEST_CALL(arm_sdft_q31_test);
+    JTEST_TEST_CALL(arm_sdft_q15_test);
+}
@@ -5,11 +5,20 @@
 #include "transform_test_data.h"
 #include "type_abbrev.h"
 
+/* Twiddle factors of arm_rfft_fast_init_twiddle_f32(), up to 2048 points */
+static float32_t rfft_fast_twiddle_buffer[2 * 2048];
+
+#define RFFT_FAST_INIT_TABLES(S, fftlen)                                \
+    arm_rfft_fast_init_f32(S, fftlen)
+#define RFFT_FAST_INIT_TWIDDLE(S, fftlen)                               \
+    arm_rfft_fast_init_twiddle_f32(S, fftlen, rfft_fast_twiddle_buffer)
+
 /*
-FFT fast function test template. Arguments are: function configuration suffix
-(q7/q15/q31/f32) and inverse-transform flag
+FFT fast function test template. Arguments are: function configuration suffix,
+inverse-transform flag and initialization of the instance under test
+(TABLES/TWIDDLE). The reference instance uses the tables.
 */
-#define RFFT_FAST_DEFINE_TEST(config_suffix, ifft_flag)                 \
+#define RFFT_FAST_DEFINE_TEST(config_suffix, ifft_flag, init)           \
     JTEST_DEFINE_TEST(arm_rfft_fast_f32_##config_suffix##_test,         \
                       arm_fft_f32)                                      \
     {                                                                   \
@@ -22,7 +31,7 @@ FFT fast function test template. Arguments are: function configuration suffix
             ,                                                           \
                                                                         \
             /* Initialize the RFFT and CFFT Instances */                \
-            arm_rfft_fast_init_f32(                                     \
+            RFFT_FAST_INIT_##init(                                      \
                 &rfft_inst_fut, fftlen);                                \
                                                                         \
             arm_rfft_fast_init_f32(                                     \
@@ -61,8 +70,73 @@ FFT fast function test template. Arguments are: function configuration suffix
         return JTEST_TEST_PASSED;                                       \
     }
 
-RFFT_FAST_DEFINE_TEST(forward, 0U);
-RFFT_FAST_DEFINE_TEST(inverse, 1U);
+RFFT_FAST_DEFINE_TEST(forward, 0U, TABLES);
+RFFT_FAST_DEFINE_TEST(inverse, 1U, TABLES);
+RFFT_FAST_DEFINE_TEST(twiddle_forward, 0U, TWIDDLE);
+RFFT_FAST_DEFINE_TEST(twiddle_inverse, 1U, TWIDDLE);
+
+/*
+  Fixed-point FFT fast function test template. Arguments are: function suffix
+  (q15/q31), function configuration suffix, inverse-transform flag and
+  input and output type. The inverse transform input is a packed spectrum.
+*/
+#define RFFT_FAST_FIXED_DEFINE_TEST(suffix, config_suffix,              \
+                                    ifft_flag, input_type, output_type) \
+    JTEST_DEFINE_TEST(arm_rfft_fast_##suffix##_##config_suffix##_test,  \
+                      arm_rfft_fast_##suffix)                           \
+    {                                                                   \
+        CONCAT(arm_rfft_fast_instance_, suffix) rfft_inst_fut = {0};    \
+        CONCAT(arm_rfft_fast_instance_, suffix) rfft_inst_ref = {0};    \
+                                                                        \
+        /* Go through all FFT lengths */                                \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            fftlen_idx, uint16_t, fftlen, transform_rfft_fast_fftlens   \
+            ,                                                           \
+                                                                        \
+            /* Initialize the RFFT Instances */                         \
+            arm_rfft_fast_init_##suffix(                                \
+                &rfft_inst_fut, fftlen);                                \
+                                                                        \
+            arm_rfft_fast_init_##suffix(                                \
+                &rfft_inst_ref, fftlen);                                \
+                                                                        \
+            TRANSFORM_COPY_INPUTS(                                      \
+                transform_fft_##suffix##_inputs,                        \
+                fftlen *                                                \
+                sizeof(input_type));                                    \
+                                                                        \
+            /* Display parameter values */                              \
+            JTEST_DUMP_STRF("Block Size: %d\n"                          \
+                            "Inverse-transform flag: %d\n",             \
+                         (int)fftlen,                                   \
+                         (int)ifft_flag);                               \
+                                                                        \
+            /* Display cycle count and run test */                      \
+            JTEST_COUNT_CYCLES(                                         \
+                arm_rfft_fast_##suffix(                                 \
+                    &rfft_inst_fut,                                     \
+                    (void *) transform_fft_input_fut,                   \
+                    (void *) transform_fft_output_fut,                  \
+                    ifft_flag));                                        \
+                                                                        \
+            ref_rfft_fast_##suffix(                                     \
+                &rfft_inst_ref,                                         \
+                (void *) transform_fft_input_ref,                       \
+                (void *) transform_fft_output_ref,                      \
+                ifft_flag);                                             \
+                                                                        \
+            /* Test correctness */                                      \
+            TRANSFORM_SNR_COMPARE_INTERFACE(                            \
+                fftlen,                                                 \
+                output_type));                                          \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+RFFT_FAST_FIXED_DEFINE_TEST(q31, forward, 0U, TYPE_FROM_ABBREV(q31), TYPE_FROM_ABBREV(q31));
+RFFT_FAST_FIXED_DEFINE_TEST(q15, forward, 0U, TYPE_FROM_ABBREV(q15), TYPE_FROM_ABBREV(q15));
+RFFT_FAST_FIXED_DEFINE_TEST(q31, inverse, 1U, TYPE_FROM_ABBREV(q31), TYPE_FROM_ABBREV(q31));
+RFFT_FAST_FIXED_DEFINE_TEST(q15, inverse, 1U, TYPE_FROM_ABBREV(q15), TYPE_FROM_ABBREV(q15));
 
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group */
@@ -72,4 +146,10 @@ JTEST_DEFINE_GROUP(rfft_fast_tests)
 {
     JTEST_TEST_CALL(arm_rfft_fast_f32_forward_test);
     JTEST_TEST_CALL(arm_rfft_fast_f32_inverse_test);
+    JTEST_TEST_CALL(arm_rfft_fast_f32_twiddle_forward_test);
+    JTEST_TEST_CALL(arm_rfft_fast_f32_twiddle_inverse_test);
+    JTEST_TEST_CALL(arm_rfft_fast_q31_forward_test);
+    JTEST_TEST_CALL(arm_rfft_fast_q15_forward_test);
+    JTEST_TEST_CALL(arm_rfft_fast_q31_inverse_test);
+    JTEST_TEST_CALL(arm_rfft_fast_q15_inverse_test);
 }
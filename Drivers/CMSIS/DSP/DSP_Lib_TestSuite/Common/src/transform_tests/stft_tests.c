@@ -0,0 +1,213 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Macros and Defines */
+/*--------------------------------------------------------------------------------*/
+
+/* Samples of transform_fft_f32_inputs streamed through the STFT */
+#define STFT_SIGNAL_LEN 2048
+#define STFT_MAX_FFT_LEN 1024
+
+/*--------------------------------------------------------------------------------*/
+/* Input Data */
+/*--------------------------------------------------------------------------------*/
+
+/* FFT lengths and hop sizes, 24 not dividing 64 */
+static const uint16_t stft_fftlens[] = { 32, 64, 256, 1024, 1024 };
+static const uint16_t stft_hopsizes[] = { 8, 24, 64, 256, 1000 };
+#define STFT_NUM_CONFIGS (sizeof(stft_fftlens) / sizeof(stft_fftlens[0]))
+
+/* Sizes of the input blocks, used in turn */
+static const uint16_t stft_block_sizes[] = { 1, 5, 17, 64, 3, 200, 0, 129 };
+#define STFT_NUM_BLOCK_SIZES (sizeof(stft_block_sizes) / sizeof(stft_block_sizes[0]))
+
+static float32_t stft_window[STFT_MAX_FFT_LEN];
+static float32_t stft_state[3 * STFT_MAX_FFT_LEN];
+static float32_t stft_spectra[TRANSFORM_MAX_FFT_LEN * 2];
+
+/* Periodic Hann window */
+static void stft_hann(uint32_t fftLen)
+{
+    uint32_t i;
+
+    for (i = 0; i < fftLen; i++)
+    {
+        stft_window[i] = 0.5f - 0.5f * cosf(6.2831853f * i / fftLen);
+    }
+}
+
+/* Streams the signal through the STFT in blocks of varying sizes */
+static uint32_t stft_stream(arm_stft_instance_f32 * S, float32_t * pDst)
+{
+    uint32_t frameSize = (S->outputType == ARM_STFT_SPECTRUM) ?
+        S->fftLen : S->fftLen / 2U + 1U;
+    uint32_t done = 0, numFrames = 0, n, b = 0;
+
+    while (done < STFT_SIGNAL_LEN)
+    {
+        n = stft_block_sizes[b++ % STFT_NUM_BLOCK_SIZES];
+        if (n > STFT_SIGNAL_LEN - done)
+        {
+            n = STFT_SIGNAL_LEN - done;
+        }
+
+        numFrames += arm_stft_f32(S, transform_fft_input_fut + done,
+                                  pDst + numFrames * frameSize, n);
+        done += n;
+    }
+
+    return numFrames;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  STFT function test template. Argument is the output type: the frames of the
+  streamed signal are compared to the ones of the whole signal.
+*/
+#define STFT_DEFINE_TEST(config_suffix, output_type)                    \
+    JTEST_DEFINE_TEST(arm_stft_f32_##config_suffix##_test,              \
+                      arm_stft_f32)                                     \
+    {                                                                   \
+        arm_stft_instance_f32 stft_inst_fut;                            \
+        uint32_t cfg, frames_fut, frames_ref, frame_size;               \
+                                                                        \
+        for (cfg = 0; cfg < STFT_NUM_CONFIGS; cfg++)                    \
+        {                                                               \
+            stft_hann(stft_fftlens[cfg]);                               \
+            if (arm_stft_init_f32(&stft_inst_fut, stft_fftlens[cfg],    \
+                                  stft_hopsizes[cfg], stft_window,      \
+                                  stft_state, output_type)              \
+                != ARM_MATH_SUCCESS)                                    \
+            {                                                           \
+                JTEST_DUMP_STRF("%s failed\n", "arm_stft_init_f32");    \
+                return JTEST_TEST_FAILED;                               \
+            }                                                           \
+                                                                        \
+            TRANSFORM_COPY_INPUTS(                                      \
+                transform_fft_f32_inputs,                               \
+                STFT_SIGNAL_LEN *                                       \
+                sizeof(float32_t));                                     \
+                                                                        \
+            /* Display parameter values */                              \
+            JTEST_DUMP_STRF("FFT Length: %d\n"                          \
+                            "Hop Size: %d\n",                           \
+                            (int)stft_fftlens[cfg],                     \
+                            (int)stft_hopsizes[cfg]);                   \
+                                                                        \
+            /* Display cycle count and run test */                      \
+            JTEST_COUNT_CYCLES(                                         \
+                frames_fut = stft_stream(&stft_inst_fut,                \
+                                         transform_fft_output_fut));    \
+            frames_ref = ref_stft_f32(&stft_inst_fut,                   \
+                                      transform_fft_input_ref,          \
+                                      transform_fft_output_ref,         \
+                                      STFT_SIGNAL_LEN);                 \
+                                                                        \
+            if (frames_fut != frames_ref)                               \
+            {                                                           \
+                JTEST_DUMP_STRF("%d frames instead of %d\n",            \
+                                (int)frames_fut, (int)frames_ref);      \
+                return JTEST_TEST_FAILED;                               \
+            }                                                           \
+                                                                        \
+            frame_size = (output_type == ARM_STFT_SPECTRUM) ?           \
+                stft_fftlens[cfg] : stft_fftlens[cfg] / 2 + 1;          \
+                                                                        \
+            /* Test correctness */                                      \
+            TRANSFORM_SNR_COMPARE_INTERFACE(                            \
+                frames_ref * frame_size,                                \
+                float32_t);                                             \
+        }                                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+STFT_DEFINE_TEST(spectrum, ARM_STFT_SPECTRUM);
+STFT_DEFINE_TEST(magnitude, ARM_STFT_MAGNITUDE);
+STFT_DEFINE_TEST(power, ARM_STFT_POWER);
+
+/*
+  The inverse STFT of the STFT of the signal is the signal, delayed by
+  fftLen - hopSize samples.
+*/
+JTEST_DEFINE_TEST(arm_istft_f32_test, arm_istft_f32)
+{
+    arm_stft_instance_f32 stft_inst;
+    arm_istft_instance_f32 istft_inst_fut;
+    uint32_t cfg, frames, delay, i;
+
+    for (cfg = 0; cfg < STFT_NUM_CONFIGS; cfg++)
+    {
+        stft_hann(stft_fftlens[cfg]);
+        arm_stft_init_f32(&stft_inst, stft_fftlens[cfg], stft_hopsizes[cfg],
+                          stft_window, stft_state, ARM_STFT_SPECTRUM);
+
+        TRANSFORM_COPY_INPUTS(
+            transform_fft_f32_inputs,
+            STFT_SIGNAL_LEN *
+            sizeof(float32_t));
+
+        frames = stft_stream(&stft_inst, stft_spectra);
+
+        if (arm_istft_init_f32(&istft_inst_fut, stft_fftlens[cfg],
+                               stft_hopsizes[cfg], stft_window, stft_state)
+            != ARM_MATH_SUCCESS)
+        {
+            JTEST_DUMP_STRF("%s failed\n", "arm_istft_init_f32");
+            return JTEST_TEST_FAILED;
+        }
+
+        /* Display parameter values */
+        JTEST_DUMP_STRF("FFT Length: %d\n"
+                        "Hop Size: %d\n",
+                        (int)stft_fftlens[cfg],
+                        (int)stft_hopsizes[cfg]);
+
+        /* Display cycle count and run test */
+        JTEST_COUNT_CYCLES(
+            arm_istft_f32(&istft_inst_fut, stft_spectra,
+                          transform_fft_output_fut, frames));
+
+        delay = stft_fftlens[cfg] - stft_hopsizes[cfg];
+        for (i = 0; i < frames * stft_hopsizes[cfg]; i++)
+        {
+            transform_fft_output_ref[i] = (i < delay) ?
+                0.0f : transform_fft_input_ref[i - delay];
+        }
+
+        /* Test correctness */
+        TRANSFORM_SNR_COMPARE_INTERFACE(
+            frames * stft_hopsizes[cfg],
+            float32_t);
+    }
+
+    /* The Hann window is zero at the frame edges: no overlap without hop */
+    stft_hann(256);
+    if (arm_istft_init_f32(&istft_inst_fut, 256, 256, stft_window, stft_state)
+        != ARM_MATH_ARGUMENT_ERROR)
+    {
+        JTEST_DUMP_STRF("%s failed\n", "arm_istft_init_f32");
+        return JTEST_TEST_FAILED;
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(stft_tests)
+{
+    JTEST_TEST_CALL(arm_stft_f32_spectrum_test);
+    JTEST_TEST_CALL(arm_stft_f32_magnitude_test);
+    JTEST_TEST_CALL(arm_stft_f32_power_test);
+    JTEST_TEST_CALL(arm_istft_f32_test);
+}
@@ -3250,6 +3250,14 @@ ARR_DESC_DEFINE(uint16_t,
                       32, 64, 128, 256,
                       512, 1024, 2048));
 
+/* Mixed-radix FFT lengths, even for the real FFT */
+ARR_DESC_DEFINE(uint16_t,
+                transform_mixed_fftlens,
+                9,
+                CURLY(
+                      6, 12, 30, 100, 256,
+                      360, 1000, 1200, TRANSFORM_MAX_MIXED_FFT_LEN));
+
 /*--------------------------------------------------------------------------------*/
 /* CFFT_F32 Structs */
 /*--------------------------------------------------------------------------------*/
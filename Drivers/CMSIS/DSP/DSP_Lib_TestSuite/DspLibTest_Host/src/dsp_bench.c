@@ -0,0 +1,1544 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        dsp_bench.c
+ * Description:  Host benchmark runner: cycles per sample and MB/s of the
+ *               library functions for several block sizes, the outputs being
+ *               checked against the reference library (RefLibs)
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Host (ARM_MATH_HOST)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Usage: dsp_bench [-n size] [-t ms] [name ...]
+ *
+ *   name   runs only the functions whose name contains one of the strings
+ *   -n     runs only the given block size (FFT length, matrix dimension)
+ *   -t     minimum duration of a timed batch, in milliseconds (default 2)
+ *
+ * Each function is first run once on the same inputs as its RefLibs
+ * counterpart and the SNR of the output is checked against the threshold
+ * the DSP_Lib test suite uses for the function group ("exact" when the
+ * outputs are bit identical). The function is then called back to back,
+ * the best of BENCH_BATCHES batches being reported:
+ *   - ticks per sample: TSC cycles on x86, nanoseconds elsewhere. The sample
+ *     is an input sample, an FFT point, an output matrix element or, for the
+ *     linear solvers, a solved system and, for the STFT, a frame.
+ *   - MB/s: bytes read and written per sample over wall clock time, "-" for
+ *     the linear solvers. For the STFT, frames per second instead.
+ *
+ * The exit status is not zero if a check fails.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#if defined (__x86_64__) || defined (__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "arm_math.h"
+#include "arm_const_structs.h"
+#include "ref.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Configuration */
+/*--------------------------------------------------------------------------------*/
+
+#define BENCH_MAX_SAMPLES  65536U   /* 256 x 256 matrices */
+#define BENCH_BATCHES      5U
+#define BENCH_FIR_TAPS     32U
+#define BENCH_BIQUAD_STAGES 4U
+#define BENCH_DECIM_FACTOR 4U
+
+#if defined (ARM_MATH_DSP)
+#define BENCH_PROFILE "cm4 (ARM_MATH_DSP)"
+#elif defined (ARM_MATH_CM0_FAMILY)
+#define BENCH_PROFILE "cm0 (ARM_MATH_CM0_FAMILY)"
+#else
+#define BENCH_PROFILE "cm3"
+#endif
+
+#if !defined (ARM_MATH_HOST_SIMD)
+#define BENCH_SIMD ""
+#elif defined (__AVX2__)
+#define BENCH_SIMD " + host vector code AVX2"
+#elif defined (__SSE4_1__)
+#define BENCH_SIMD " + host vector code SSE4.1"
+#else
+#define BENCH_SIMD " + host vector code"
+#endif
+
+#if defined (__x86_64__) || defined (__i386__)
+#define BENCH_TICKS_NAME "cyc/smp"
+#define BENCH_TICKS_UNIT "TSC cycles"
+#else
+#define BENCH_TICKS_NAME "ns/smp"
+#define BENCH_TICKS_UNIT "nanoseconds"
+#endif
+
+typedef enum
+{
+  BENCH_VECTOR,                     /* vectors and filters: 16 to 4096 samples */
+  BENCH_RESAMPLE,                   /* 44.1 kHz to 16 kHz resamplers: 441 to 3528 samples */
+  BENCH_FFT,                        /* transforms: 64 to 4096 points */
+  BENCH_FFT_MIXED,                  /* mixed-radix transforms: the BENCH_FFT lengths and 1000, 1200, 3000 */
+  BENCH_STFT,                       /* STFT frames: the BENCH_FFT lengths */
+  BENCH_MATRIX,                     /* square matrices: 4 to 256 */
+  BENCH_SOLVE                       /* symmetric positive definite systems: 3 to 32 */
+} bench_kind;
+
+typedef struct
+{
+  const char * name;                /* function under test */
+  bench_kind   kind;                /* default block sizes */
+  uint32_t     bytes;               /* bytes read and written per sample */
+  float32_t    snrMin;              /* SNR threshold against RefLibs, dB */
+  uint32_t  (* setup)(uint32_t n);  /* inits instances and inputs, returns samples per call, 0 if n is not supported */
+  void      (* run)(uint32_t n);    /* one call of the function under test */
+  void      (* check)(uint32_t n);  /* runs the function and its reference on the same inputs */
+  uint32_t  (* outLen)(uint32_t n); /* number of output values compared */
+  char         outType;             /* 'f', 'l' (q31) or 's' (q15) */
+} bench_entry;
+
+static const uint32_t bench_sizes_vector[] = { 16U, 64U, 256U, 1024U, 4096U, 0U };
+static const uint32_t bench_sizes_fft[]    = { 64U, 256U, 1024U, 4096U, 0U };
+static const uint32_t bench_sizes_mixed[]  = { 64U, 256U, 1000U, 1024U, 1200U, 3000U, 4096U, 0U };
+static const uint32_t bench_sizes_matrix[] = { 4U, 8U, 16U, 32U, 64U, 128U, 256U, 0U };
+static const uint32_t bench_sizes_solve[]  = { 3U, 4U, 6U, 8U, 12U, 16U, 24U, 32U, 0U };
+static const uint32_t bench_sizes_resample[] = { 441U, 882U, 1764U, 3528U, 0U };
+
+/*--------------------------------------------------------------------------------*/
+/* Buffers */
+/*--------------------------------------------------------------------------------*/
+
+/* Complex data, in any of the types */
+#define BENCH_WORDS (2U * BENCH_MAX_SAMPLES + 64U)
+
+static uint32_t bufA  [BENCH_WORDS] __attribute__((aligned(32)));
+static uint32_t bufB  [BENCH_WORDS] __attribute__((aligned(32)));
+static uint32_t bufFut[BENCH_WORDS] __attribute__((aligned(32)));
+static uint32_t bufRef[BENCH_WORDS] __attribute__((aligned(32)));
+static uint32_t bufRefIn[BENCH_WORDS] __attribute__((aligned(32)));
+static uint32_t bufStateFut[BENCH_WORDS] __attribute__((aligned(32)));
+static uint32_t bufStateRef[BENCH_WORDS] __attribute__((aligned(32)));
+static float32_t bufTmp[BENCH_WORDS];
+static float32_t bufCmpFut[BENCH_WORDS];
+static float32_t bufCmpRef[BENCH_WORDS];
+
+#define F32(buf) ((float32_t *) (buf))
+#define Q31(buf) ((q31_t *) (buf))
+#define Q15(buf) ((q15_t *) (buf))
+
+static uint32_t bench_seed = 1U;
+
+/* Uniform values in [-amplitude, amplitude), same sequence on every host */
+static void bench_fill_f32(float32_t * pDst, uint32_t n, float32_t amplitude)
+{
+  uint32_t i;
+
+  for (i = 0U; i < n; i++)
+  {
+    bench_seed = bench_seed * 1664525U + 1013904223U;
+    pDst[i] = amplitude * ((float32_t) (int32_t) bench_seed / 2147483648.0f);
+  }
+}
+
+static void bench_fill_q31(q31_t * pDst, uint32_t n, float32_t amplitude)
+{
+  bench_fill_f32(bufTmp, n, amplitude);
+  arm_float_to_q31(bufTmp, pDst, n);
+}
+
+static void bench_fill_q15(q15_t * pDst, uint32_t n, float32_t amplitude)
+{
+  bench_fill_f32(bufTmp, n, amplitude);
+  arm_float_to_q15(bufTmp, pDst, n);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Basic math */
+/*--------------------------------------------------------------------------------*/
+
+static float32_t dotF32Fut, dotF32Ref;
+static q63_t     dotQ63Fut, dotQ63Ref;
+
+static uint32_t one_output(uint32_t n) { (void) n; return 1U; }
+static uint32_t n_outputs(uint32_t n) { return n; }
+static uint32_t cmplx_outputs(uint32_t n) { return 2U * n; }
+
+static uint32_t setup_vec_f32(uint32_t n)
+{
+  bench_fill_f32(F32(bufA), n, 0.5f);
+  bench_fill_f32(F32(bufB), n, 0.5f);
+  return n;
+}
+
+static uint32_t setup_vec_q31(uint32_t n)
+{
+  bench_fill_q31(Q31(bufA), n, 0.5f);
+  bench_fill_q31(Q31(bufB), n, 0.5f);
+  return n;
+}
+
+static uint32_t setup_vec_q15(uint32_t n)
+{
+  bench_fill_q15(Q15(bufA), n, 0.5f);
+  bench_fill_q15(Q15(bufB), n, 0.5f);
+  return n;
+}
+
+static void run_add_f32(uint32_t n) { arm_add_f32(F32(bufA), F32(bufB), F32(bufFut), n); }
+static void run_add_q31(uint32_t n) { arm_add_q31(Q31(bufA), Q31(bufB), Q31(bufFut), n); }
+static void run_add_q15(uint32_t n) { arm_add_q15(Q15(bufA), Q15(bufB), Q15(bufFut), n); }
+
+static void check_add_f32(uint32_t n) { run_add_f32(n); ref_add_f32(F32(bufA), F32(bufB), F32(bufRef), n); }
+static void check_add_q31(uint32_t n) { run_add_q31(n); ref_add_q31(Q31(bufA), Q31(bufB), Q31(bufRef), n); }
+static void check_add_q15(uint32_t n) { run_add_q15(n); ref_add_q15(Q15(bufA), Q15(bufB), Q15(bufRef), n); }
+
+static void run_dot_prod_f32(uint32_t n) { arm_dot_prod_f32(F32(bufA), F32(bufB), n, &dotF32Fut); }
+static void run_dot_prod_q31(uint32_t n) { arm_dot_prod_q31(Q31(bufA), Q31(bufB), n, &dotQ63Fut); }
+static void run_dot_prod_q15(uint32_t n) { arm_dot_prod_q15(Q15(bufA), Q15(bufB), n, &dotQ63Fut); }
+
+static void check_dot_prod_f32(uint32_t n)
+{
+  run_dot_prod_f32(n);
+  ref_dot_prod_f32(F32(bufA), F32(bufB), n, &dotF32Ref);
+  F32(bufFut)[0] = dotF32Fut;
+  F32(bufRef)[0] = dotF32Ref;
+}
+
+/* The q63 results are compared as floats, as the test suite does */
+static void check_dot_prod_q31(uint32_t n)
+{
+  run_dot_prod_q31(n);
+  ref_dot_prod_q31(Q31(bufA), Q31(bufB), n, &dotQ63Ref);
+  F32(bufFut)[0] = (float32_t) dotQ63Fut;
+  F32(bufRef)[0] = (float32_t) dotQ63Ref;
+}
+
+static void check_dot_prod_q15(uint32_t n)
+{
+  run_dot_prod_q15(n);
+  ref_dot_prod_q15(Q15(bufA), Q15(bufB), n, &dotQ63Ref);
+  F32(bufFut)[0] = (float32_t) dotQ63Fut;
+  F32(bufRef)[0] = (float32_t) dotQ63Ref;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Complex math */
+/*--------------------------------------------------------------------------------*/
+
+static uint32_t setup_cmplx_f32(uint32_t n)
+{
+  bench_fill_f32(F32(bufA), 2U * n, 0.5f);
+  bench_fill_f32(F32(bufB), 2U * n, 0.5f);
+  return n;
+}
+
+static void run_cmplx_mag_f32(uint32_t n) { arm_cmplx_mag_f32(F32(bufA), F32(bufFut), n); }
+static void check_cmplx_mag_f32(uint32_t n) { run_cmplx_mag_f32(n); ref_cmplx_mag_f32(F32(bufA), F32(bufRef), n); }
+
+static void run_cmplx_mult_cmplx_f32(uint32_t n) { arm_cmplx_mult_cmplx_f32(F32(bufA), F32(bufB), F32(bufFut), n); }
+static void check_cmplx_mult_cmplx_f32(uint32_t n)
+{
+  run_cmplx_mult_cmplx_f32(n);
+  ref_cmplx_mult_cmplx_f32(F32(bufA), F32(bufB), F32(bufRef), n);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Filtering */
+/*--------------------------------------------------------------------------------*/
+
+static float32_t firCoeffsF32[BENCH_FIR_TAPS];
+static q31_t     firCoeffsQ31[BENCH_FIR_TAPS];
+static q15_t     firCoeffsQ15[BENCH_FIR_TAPS];
+
+static arm_fir_instance_f32 firF32Fut, firF32Ref;
+static arm_fir_instance_q31 firQ31Fut, firQ31Ref;
+static arm_fir_instance_q15 firQ15Fut, firQ15Ref;
+static arm_fir_decimate_instance_f32 decimF32Fut, decimF32Ref;
+static arm_fir_interpolate_instance_f32 interpF32Fut, interpF32Ref;
+
+static uint32_t setup_fir_f32(uint32_t n)
+{
+  bench_fill_f32(firCoeffsF32, BENCH_FIR_TAPS, 1.0f / 16.0f);
+  memset(bufStateFut, 0, sizeof(bufStateFut));
+  memset(bufStateRef, 0, sizeof(bufStateRef));
+  arm_fir_init_f32(&firF32Fut, BENCH_FIR_TAPS, firCoeffsF32, F32(bufStateFut), n);
+  arm_fir_init_f32(&firF32Ref, BENCH_FIR_TAPS, firCoeffsF32, F32(bufStateRef), n);
+  bench_fill_f32(F32(bufA), n, 0.5f);
+  return n;
+}
+
+static uint32_t setup_fir_q31(uint32_t n)
+{
+  bench_fill_q31(firCoeffsQ31, BENCH_FIR_TAPS, 1.0f / 16.0f);
+  memset(bufStateFut, 0, sizeof(bufStateFut));
+  memset(bufStateRef, 0, sizeof(bufStateRef));
+  arm_fir_init_q31(&firQ31Fut, BENCH_FIR_TAPS, firCoeffsQ31, Q31(bufStateFut), n);
+  arm_fir_init_q31(&firQ31Ref, BENCH_FIR_TAPS, firCoeffsQ31, Q31(bufStateRef), n);
+  bench_fill_q31(Q31(bufA), n, 0.5f);
+  return n;
+}
+
+static uint32_t setup_fir_q15(uint32_t n)
+{
+  bench_fill_q15(firCoeffsQ15, BENCH_FIR_TAPS, 1.0f / 16.0f);
+  memset(bufStateFut, 0, sizeof(bufStateFut));
+  memset(bufStateRef, 0, sizeof(bufStateRef));
+  arm_fir_init_q15(&firQ15Fut, BENCH_FIR_TAPS, firCoeffsQ15, Q15(bufStateFut), n);
+  arm_fir_init_q15(&firQ15Ref, BENCH_FIR_TAPS, firCoeffsQ15, Q15(bufStateRef), n);
+  bench_fill_q15(Q15(bufA), n, 0.5f);
+  return n;
+}
+
+static void run_fir_f32(uint32_t n) { arm_fir_f32(&firF32Fut, F32(bufA), F32(bufFut), n); }
+static void run_fir_q31(uint32_t n) { arm_fir_q31(&firQ31Fut, Q31(bufA), Q31(bufFut), n); }
+static void run_fir_q15(uint32_t n) { arm_fir_q15(&firQ15Fut, Q15(bufA), Q15(bufFut), n); }
+
+static void check_fir_f32(uint32_t n) { run_fir_f32(n); ref_fir_f32(&firF32Ref, F32(bufA), F32(bufRef), n); }
+static void check_fir_q31(uint32_t n) { run_fir_q31(n); ref_fir_q31(&firQ31Ref, Q31(bufA), Q31(bufRef), n); }
+static void check_fir_q15(uint32_t n) { run_fir_q15(n); ref_fir_q15(&firQ15Ref, Q15(bufA), Q15(bufRef), n); }
+
+static uint32_t setup_fir_decimate_f32(uint32_t n)
+{
+  bench_fill_f32(firCoeffsF32, BENCH_FIR_TAPS, 1.0f / 16.0f);
+  memset(bufStateFut, 0, sizeof(bufStateFut));
+  memset(bufStateRef, 0, sizeof(bufStateRef));
+  if ((arm_fir_decimate_init_f32(&decimF32Fut, BENCH_FIR_TAPS, BENCH_DECIM_FACTOR,
+                                 firCoeffsF32, F32(bufStateFut), n) != ARM_MATH_SUCCESS) ||
+      (arm_fir_decimate_init_f32(&decimF32Ref, BENCH_FIR_TAPS, BENCH_DECIM_FACTOR,
+                                 firCoeffsF32, F32(bufStateRef), n) != ARM_MATH_SUCCESS))
+  {
+    return 0U;
+  }
+  bench_fill_f32(F32(bufA), n, 0.5f);
+  return n;
+}
+
+static uint32_t decimated_outputs(uint32_t n) { return n / BENCH_DECIM_FACTOR; }
+
+static void run_fir_decimate_f32(uint32_t n) { arm_fir_decimate_f32(&decimF32Fut, F32(bufA), F32(bufFut), n); }
+static void check_fir_decimate_f32(uint32_t n)
+{
+  run_fir_decimate_f32(n);
+  ref_fir_decimate_f32(&decimF32Ref, F32(bufA), F32(bufRef), n);
+}
+
+static uint32_t setup_fir_interpolate_f32(uint32_t n)
+{
+  bench_fill_f32(firCoeffsF32, BENCH_FIR_TAPS, 1.0f / 4.0f);
+  memset(bufStateFut, 0, sizeof(bufStateFut));
+  memset(bufStateRef, 0, sizeof(bufStateRef));
+  if ((n * BENCH_DECIM_FACTOR > 2U * BENCH_MAX_SAMPLES) ||
+      (arm_fir_interpolate_init_f32(&interpF32Fut, BENCH_DECIM_FACTOR, BENCH_FIR_TAPS,
+                                    firCoeffsF32, F32(bufStateFut), n) != ARM_MATH_SUCCESS) ||
+      (arm_fir_interpolate_init_f32(&interpF32Ref, BENCH_DECIM_FACTOR, BENCH_FIR_TAPS,
+                                    firCoeffsF32, F32(bufStateRef), n) != ARM_MATH_SUCCESS))
+  {
+    return 0U;
+  }
+  bench_fill_f32(F32(bufA), n, 0.5f);
+  return n;
+}
+
+static uint32_t interpolated_outputs(uint32_t n) { return n * BENCH_DECIM_FACTOR; }
+
+static void run_fir_interpolate_f32(uint32_t n) { arm_fir_interpolate_f32(&interpF32Fut, F32(bufA), F32(bufFut), n); }
+static void check_fir_interpolate_f32(uint32_t n)
+{
+  run_fir_interpolate_f32(n);
+  ref_fir_interpolate_f32(&interpF32Ref, F32(bufA), F32(bufRef), n);
+}
+
+/* Stable low pass sections: y = b0 x + b1 x1 + b2 x2 + a1 y1 + a2 y2 */
+static const float32_t biquadSection[5] = { 0.2f, 0.4f, 0.2f, 0.6f, -0.2f };
+
+static float32_t biquadCoeffsF32[5U * BENCH_BIQUAD_STAGES];
+static q31_t     biquadCoeffsQ31[5U * BENCH_BIQUAD_STAGES];
+static q15_t     biquadCoeffsQ15[6U * BENCH_BIQUAD_STAGES];
+
+static arm_biquad_cascade_df2T_instance_f32 biquadF32Fut, biquadF32Ref;
+static arm_biquad_casd_df1_inst_q31 biquadQ31Fut, biquadQ31Ref;
+static arm_biquad_casd_df1_inst_q15 biquadQ15Fut, biquadQ15Ref;
+
+static uint32_t setup_biquad_df2T_f32(uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0U; i < 5U * BENCH_BIQUAD_STAGES; i++)
+  {
+    biquadCoeffsF32[i] = biquadSection[i % 5U];
+  }
+  memset(bufStateFut, 0, sizeof(bufStateFut));
+  memset(bufStateRef, 0, sizeof(bufStateRef));
+  arm_biquad_cascade_df2T_init_f32(&biquadF32Fut, BENCH_BIQUAD_STAGES, biquadCoeffsF32, F32(bufStateFut));
+  arm_biquad_cascade_df2T_init_f32(&biquadF32Ref, BENCH_BIQUAD_STAGES, biquadCoeffsF32, F32(bufStateRef));
+  bench_fill_f32(F32(bufA), n, 0.5f);
+  return n;
+}
+
+/* The fixed point coefficients are scaled by 1/2, postShift 1 */
+static uint32_t setup_biquad_df1_q31(uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0U; i < 5U * BENCH_BIQUAD_STAGES; i++)
+  {
+    biquadCoeffsQ31[i] = (q31_t) (biquadSection[i % 5U] * 0.5f * 2147483648.0f);
+  }
+  memset(bufStateFut, 0, sizeof(bufStateFut));
+  memset(bufStateRef, 0, sizeof(bufStateRef));
+  arm_biquad_cascade_df1_init_q31(&biquadQ31Fut, BENCH_BIQUAD_STAGES, biquadCoeffsQ31, Q31(bufStateFut), 1);
+  arm_biquad_cascade_df1_init_q31(&biquadQ31Ref, BENCH_BIQUAD_STAGES, biquadCoeffsQ31, Q31(bufStateRef), 1);
+  bench_fill_q31(Q31(bufA), n, 0.5f);
+  return n;
+}
+
+/* q15 coefficients are {b0, 0, b1, b2, a1, a2} */
+static uint32_t setup_biquad_df1_q15(uint32_t n)
+{
+  uint32_t i, j;
+
+  for (i = 0U; i < BENCH_BIQUAD_STAGES; i++)
+  {
+    biquadCoeffsQ15[6U * i] = (q15_t) (biquadSection[0] * 0.5f * 32768.0f);
+    biquadCoeffsQ15[6U * i + 1U] = 0;
+    for (j = 1U; j < 5U; j++)
+    {
+      biquadCoeffsQ15[6U * i + 1U + j] = (q15_t) (biquadSection[j] * 0.5f * 32768.0f);
+    }
+  }
+  memset(bufStateFut, 0, sizeof(bufStateFut));
+  memset(bufStateRef, 0, sizeof(bufStateRef));
+  arm_biquad_cascade_df1_init_q15(&biquadQ15Fut, BENCH_BIQUAD_STAGES, biquadCoeffsQ15, Q15(bufStateFut), 1);
+  arm_biquad_cascade_df1_init_q15(&biquadQ15Ref, BENCH_BIQUAD_STAGES, biquadCoeffsQ15, Q15(bufStateRef), 1);
+  bench_fill_q15(Q15(bufA), n, 0.5f);
+  return n;
+}
+
+static void run_biquad_df2T_f32(uint32_t n) { arm_biquad_cascade_df2T_f32(&biquadF32Fut, F32(bufA), F32(bufFut), n); }
+static void run_biquad_df1_q31(uint32_t n) { arm_biquad_cascade_df1_q31(&biquadQ31Fut, Q31(bufA), Q31(bufFut), n); }
+static void run_biquad_df1_q15(uint32_t n) { arm_biquad_cascade_df1_q15(&biquadQ15Fut, Q15(bufA), Q15(bufFut), n); }
+
+static void check_biquad_df2T_f32(uint32_t n)
+{
+  run_biquad_df2T_f32(n);
+  ref_biquad_cascade_df2T_f32(&biquadF32Ref, F32(bufA), F32(bufRef), n);
+}
+
+static void check_biquad_df1_q31(uint32_t n)
+{
+  run_biquad_df1_q31(n);
+  ref_biquad_cascade_df1_q31(&biquadQ31Ref, Q31(bufA), Q31(bufRef), n);
+}
+
+static void check_biquad_df1_q15(uint32_t n)
+{
+  run_biquad_df1_q15(n);
+  ref_biquad_cascade_df1_q15(&biquadQ15Ref, Q15(bufA), Q15(bufRef), n);
+}
+
+/* 44.1 kHz to 16 kHz: L = 160, M = 441, n input samples per call, a multiple
+ * of M. The cascade is arm_fir_interpolate_xxx() by L and two one tap
+ * arm_fir_decimate_xxx(), by 9 and 49 (M does not fit the uint8_t factor of
+ * the decimator), over chunks of M input samples: it gives the output samples
+ * of the resampler, and is checked against the same reference. */
+#define BENCH_RESAMPLE_L      160U
+#define BENCH_RESAMPLE_M      441U
+#define BENCH_RESAMPLE_M1     9U
+#define BENCH_RESAMPLE_M2     49U
+#define BENCH_RESAMPLE_PHASE  16U
+#define BENCH_RESAMPLE_TAPS   (BENCH_RESAMPLE_L * BENCH_RESAMPLE_PHASE)
+#define BENCH_RESAMPLE_INPUTS 3528U
+
+static arm_fir_resample_instance_f32 resampleF32;
+static arm_fir_resample_instance_q31 resampleQ31;
+static arm_fir_resample_instance_q15 resampleQ15;
+static arm_fir_interpolate_instance_f32 cascadeInterpF32;
+static arm_fir_interpolate_instance_q31 cascadeInterpQ31;
+static arm_fir_interpolate_instance_q15 cascadeInterpQ15;
+static arm_fir_decimate_instance_f32 cascadeDecim1F32, cascadeDecim2F32;
+static arm_fir_decimate_instance_q31 cascadeDecim1Q31, cascadeDecim2Q31;
+static arm_fir_decimate_instance_q15 cascadeDecim1Q15, cascadeDecim2Q15;
+static float32_t resampleCoeffsF32[BENCH_RESAMPLE_TAPS];
+static q31_t     resampleCoeffsQ31[BENCH_RESAMPLE_TAPS];
+static q15_t     resampleCoeffsQ15[BENCH_RESAMPLE_TAPS];
+static float32_t cascadeOneF32 = 1.0f;
+static q31_t     cascadeOneQ31 = 0x7FFFFFFF;
+static q15_t     cascadeOneQ15 = 0x7FFF;
+static uint32_t  resampleState[BENCH_RESAMPLE_INPUTS + BENCH_RESAMPLE_PHASE];
+static uint32_t  cascadeDecim2State[BENCH_RESAMPLE_M * BENCH_RESAMPLE_L / BENCH_RESAMPLE_M1];
+static uint32_t  cascadeDecim2In[BENCH_RESAMPLE_M * BENCH_RESAMPLE_L / BENCH_RESAMPLE_M1];
+
+static uint32_t resample_outputs(uint32_t n) { return n / BENCH_RESAMPLE_M * BENCH_RESAMPLE_L; }
+
+static uint32_t setup_fir_resample_f32(uint32_t n)
+{
+  if ((n % BENCH_RESAMPLE_M != 0U) || (n > BENCH_RESAMPLE_INPUTS))
+  {
+    return 0U;
+  }
+  bench_fill_f32(resampleCoeffsF32, BENCH_RESAMPLE_TAPS, 1.0f / 16.0f);
+  arm_fir_resample_init_f32(&resampleF32, BENCH_RESAMPLE_L, BENCH_RESAMPLE_M, BENCH_RESAMPLE_TAPS,
+                            resampleCoeffsF32, F32(resampleState), n);
+  bench_fill_f32(F32(bufA), n, 0.5f);
+  return n;
+}
+
+static uint32_t setup_fir_resample_q31(uint32_t n)
+{
+  if ((n % BENCH_RESAMPLE_M != 0U) || (n > BENCH_RESAMPLE_INPUTS))
+  {
+    return 0U;
+  }
+  bench_fill_q31(resampleCoeffsQ31, BENCH_RESAMPLE_TAPS, 1.0f / 16.0f);
+  arm_fir_resample_init_q31(&resampleQ31, BENCH_RESAMPLE_L, BENCH_RESAMPLE_M, BENCH_RESAMPLE_TAPS,
+                            resampleCoeffsQ31, Q31(resampleState), n);
+  bench_fill_q31(Q31(bufA), n, 0.5f);
+  return n;
+}
+
+static uint32_t setup_fir_resample_q15(uint32_t n)
+{
+  if ((n % BENCH_RESAMPLE_M != 0U) || (n > BENCH_RESAMPLE_INPUTS))
+  {
+    return 0U;
+  }
+  bench_fill_q15(resampleCoeffsQ15, BENCH_RESAMPLE_TAPS, 1.0f / 16.0f);
+  arm_fir_resample_init_q15(&resampleQ15, BENCH_RESAMPLE_L, BENCH_RESAMPLE_M, BENCH_RESAMPLE_TAPS,
+                            resampleCoeffsQ15, Q15(resampleState), n);
+  bench_fill_q15(Q15(bufA), n, 0.5f);
+  return n;
+}
+
+static uint32_t setup_fir_interp_decim_f32(uint32_t n)
+{
+  if ((setup_fir_resample_f32(n) == 0U) ||
+      (arm_fir_interpolate_init_f32(&cascadeInterpF32, BENCH_RESAMPLE_L, BENCH_RESAMPLE_TAPS, resampleCoeffsF32,
+                                    F32(resampleState), BENCH_RESAMPLE_M) != ARM_MATH_SUCCESS) ||
+      (arm_fir_decimate_init_f32(&cascadeDecim1F32, 1U, BENCH_RESAMPLE_M1, &cascadeOneF32, F32(bufStateFut),
+                                 BENCH_RESAMPLE_M * BENCH_RESAMPLE_L) != ARM_MATH_SUCCESS) ||
+      (arm_fir_decimate_init_f32(&cascadeDecim2F32, 1U, BENCH_RESAMPLE_M2, &cascadeOneF32, F32(cascadeDecim2State),
+                                 BENCH_RESAMPLE_M * BENCH_RESAMPLE_L / BENCH_RESAMPLE_M1) != ARM_MATH_SUCCESS))
+  {
+    return 0U;
+  }
+  return n;
+}
+
+static uint32_t setup_fir_interp_decim_q31(uint32_t n)
+{
+  if ((setup_fir_resample_q31(n) == 0U) ||
+      (arm_fir_interpolate_init_q31(&cascadeInterpQ31, BENCH_RESAMPLE_L, BENCH_RESAMPLE_TAPS, resampleCoeffsQ31,
+                                    Q31(resampleState), BENCH_RESAMPLE_M) != ARM_MATH_SUCCESS) ||
+      (arm_fir_decimate_init_q31(&cascadeDecim1Q31, 1U, BENCH_RESAMPLE_M1, &cascadeOneQ31, Q31(bufStateFut),
+                                 BENCH_RESAMPLE_M * BENCH_RESAMPLE_L) != ARM_MATH_SUCCESS) ||
+      (arm_fir_decimate_init_q31(&cascadeDecim2Q31, 1U, BENCH_RESAMPLE_M2, &cascadeOneQ31, Q31(cascadeDecim2State),
+                                 BENCH_RESAMPLE_M * BENCH_RESAMPLE_L / BENCH_RESAMPLE_M1) != ARM_MATH_SUCCESS))
+  {
+    return 0U;
+  }
+  return n;
+}
+
+static uint32_t setup_fir_interp_decim_q15(uint32_t n)
+{
+  if ((setup_fir_resample_q15(n) == 0U) ||
+      (arm_fir_interpolate_init_q15(&cascadeInterpQ15, BENCH_RESAMPLE_L, BENCH_RESAMPLE_TAPS, resampleCoeffsQ15,
+                                    Q15(resampleState), BENCH_RESAMPLE_M) != ARM_MATH_SUCCESS) ||
+      (arm_fir_decimate_init_q15(&cascadeDecim1Q15, 1U, BENCH_RESAMPLE_M1, &cascadeOneQ15, Q15(bufStateFut),
+                                 BENCH_RESAMPLE_M * BENCH_RESAMPLE_L) != ARM_MATH_SUCCESS) ||
+      (arm_fir_decimate_init_q15(&cascadeDecim2Q15, 1U, BENCH_RESAMPLE_M2, &cascadeOneQ15, Q15(cascadeDecim2State),
+                                 BENCH_RESAMPLE_M * BENCH_RESAMPLE_L / BENCH_RESAMPLE_M1) != ARM_MATH_SUCCESS))
+  {
+    return 0U;
+  }
+  return n;
+}
+
+static void run_fir_resample_f32(uint32_t n) { arm_fir_resample_f32(&resampleF32, F32(bufA), F32(bufFut), &n, resample_outputs(n)); }
+static void run_fir_resample_q31(uint32_t n) { arm_fir_resample_q31(&resampleQ31, Q31(bufA), Q31(bufFut), &n, resample_outputs(n)); }
+static void run_fir_resample_q15(uint32_t n) { arm_fir_resample_q15(&resampleQ15, Q15(bufA), Q15(bufFut), &n, resample_outputs(n)); }
+
+static void run_fir_interp_decim_f32(uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0U; i < n / BENCH_RESAMPLE_M; i++)
+  {
+    arm_fir_interpolate_f32(&cascadeInterpF32, F32(bufA) + i * BENCH_RESAMPLE_M, F32(bufB), BENCH_RESAMPLE_M);
+    arm_fir_decimate_f32(&cascadeDecim1F32, F32(bufB), F32(cascadeDecim2In), BENCH_RESAMPLE_M * BENCH_RESAMPLE_L);
+    arm_fir_decimate_f32(&cascadeDecim2F32, F32(cascadeDecim2In), F32(bufFut) + i * BENCH_RESAMPLE_L,
+                         BENCH_RESAMPLE_M * BENCH_RESAMPLE_L / BENCH_RESAMPLE_M1);
+  }
+}
+
+static void run_fir_interp_decim_q31(uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0U; i < n / BENCH_RESAMPLE_M; i++)
+  {
+    arm_fir_interpolate_q31(&cascadeInterpQ31, Q31(bufA) + i * BENCH_RESAMPLE_M, Q31(bufB), BENCH_RESAMPLE_M);
+    arm_fir_decimate_q31(&cascadeDecim1Q31, Q31(bufB), Q31(cascadeDecim2In), BENCH_RESAMPLE_M * BENCH_RESAMPLE_L);
+    arm_fir_decimate_q31(&cascadeDecim2Q31, Q31(cascadeDecim2In), Q31(bufFut) + i * BENCH_RESAMPLE_L,
+                         BENCH_RESAMPLE_M * BENCH_RESAMPLE_L / BENCH_RESAMPLE_M1);
+  }
+}
+
+static void run_fir_interp_decim_q15(uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0U; i < n / BENCH_RESAMPLE_M; i++)
+  {
+    arm_fir_interpolate_q15(&cascadeInterpQ15, Q15(bufA) + i * BENCH_RESAMPLE_M, Q15(bufB), BENCH_RESAMPLE_M);
+    arm_fir_decimate_q15(&cascadeDecim1Q15, Q15(bufB), Q15(cascadeDecim2In), BENCH_RESAMPLE_M * BENCH_RESAMPLE_L);
+    arm_fir_decimate_q15(&cascadeDecim2Q15, Q15(cascadeDecim2In), Q15(bufFut) + i * BENCH_RESAMPLE_L,
+                         BENCH_RESAMPLE_M * BENCH_RESAMPLE_L / BENCH_RESAMPLE_M1);
+  }
+}
+
+static void check_fir_resample_f32(uint32_t n) { run_fir_resample_f32(n); ref_fir_resample_f32(&resampleF32, F32(bufA), F32(bufRef), n); }
+static void check_fir_resample_q31(uint32_t n) { run_fir_resample_q31(n); ref_fir_resample_q31(&resampleQ31, Q31(bufA), Q31(bufRef), n); }
+static void check_fir_resample_q15(uint32_t n) { run_fir_resample_q15(n); ref_fir_resample_q15(&resampleQ15, Q15(bufA), Q15(bufRef), n); }
+static void check_fir_interp_decim_f32(uint32_t n) { run_fir_interp_decim_f32(n); ref_fir_resample_f32(&resampleF32, F32(bufA), F32(bufRef), n); }
+static void check_fir_interp_decim_q31(uint32_t n) { run_fir_interp_decim_q31(n); ref_fir_resample_q31(&resampleQ31, Q31(bufA), Q31(bufRef), n); }
+static void check_fir_interp_decim_q15(uint32_t n) { run_fir_interp_decim_q15(n); ref_fir_resample_q15(&resampleQ15, Q15(bufA), Q15(bufRef), n); }
+
+/*--------------------------------------------------------------------------------*/
+/* Transforms */
+/*--------------------------------------------------------------------------------*/
+
+static const arm_cfft_instance_f32 * cfftF32;
+static const arm_cfft_instance_q31 * cfftQ31;
+static const arm_cfft_instance_q15 * cfftQ15;
+static arm_rfft_fast_instance_f32 rfftFastF32Fut, rfftFastF32Ref;
+static arm_rfft_instance_q31 rfftQ31Fut, rfftQ31Ref;
+static arm_rfft_instance_q15 rfftQ15Fut, rfftQ15Ref;
+static arm_rfft_fast_instance_q31 rfftFastQ31Fut, rfftFastQ31Ref;
+static arm_rfft_fast_instance_q15 rfftFastQ15Fut, rfftFastQ15Ref;
+static uint8_t benchIfft;
+
+#define BENCH_CFFT_INSTANCE(suffix, n)                                  \
+  ((n) == 16U   ? &arm_cfft_sR_##suffix##_len16   :                     \
+   (n) == 32U   ? &arm_cfft_sR_##suffix##_len32   :                     \
+   (n) == 64U   ? &arm_cfft_sR_##suffix##_len64   :                     \
+   (n) == 128U  ? &arm_cfft_sR_##suffix##_len128  :                     \
+   (n) == 256U  ? &arm_cfft_sR_##suffix##_len256  :                     \
+   (n) == 512U  ? &arm_cfft_sR_##suffix##_len512  :                     \
+   (n) == 1024U ? &arm_cfft_sR_##suffix##_len1024 :                     \
+   (n) == 2048U ? &arm_cfft_sR_##suffix##_len2048 :                     \
+   (n) == 4096U ? &arm_cfft_sR_##suffix##_len4096 : NULL)
+
+static uint32_t setup_cfft_f32(uint32_t n)
+{
+  cfftF32 = BENCH_CFFT_INSTANCE(f32, n);
+  bench_fill_f32(F32(bufFut), 2U * n, 0.5f);
+  memcpy(bufRef, bufFut, 2U * n * sizeof(float32_t));
+  benchIfft = 0U;
+  return (cfftF32 != NULL) ? n : 0U;
+}
+
+static uint32_t setup_cfft_q31(uint32_t n)
+{
+  cfftQ31 = BENCH_CFFT_INSTANCE(q31, n);
+  bench_fill_q31(Q31(bufFut), 2U * n, 0.5f);
+  memcpy(bufRef, bufFut, 2U * n * sizeof(q31_t));
+  benchIfft = 0U;
+  return (cfftQ31 != NULL) ? n : 0U;
+}
+
+static uint32_t setup_cfft_q15(uint32_t n)
+{
+  cfftQ15 = BENCH_CFFT_INSTANCE(q15, n);
+  bench_fill_q15(Q15(bufFut), 2U * n, 0.5f);
+  memcpy(bufRef, bufFut, 2U * n * sizeof(q15_t));
+  benchIfft = 0U;
+  return (cfftQ15 != NULL) ? n : 0U;
+}
+
+/* In place: forward and inverse transforms alternate so that the data stays
+ * in range, both cost the same */
+static void run_cfft_f32(uint32_t n) { (void) n; arm_cfft_f32(cfftF32, F32(bufFut), benchIfft, 1U); benchIfft ^= 1U; }
+static void run_cfft_q31(uint32_t n) { (void) n; arm_cfft_q31(cfftQ31, Q31(bufFut), benchIfft, 1U); benchIfft ^= 1U; }
+static void run_cfft_q15(uint32_t n) { (void) n; arm_cfft_q15(cfftQ15, Q15(bufFut), benchIfft, 1U); benchIfft ^= 1U; }
+
+static void check_cfft_f32(uint32_t n) { run_cfft_f32(n); ref_cfft_f32(cfftF32, F32(bufRef), 0U, 1U); }
+static void check_cfft_q31(uint32_t n) { run_cfft_q31(n); ref_cfft_q31(cfftQ31, Q31(bufRef), 0U, 1U); }
+static void check_cfft_q15(uint32_t n) { run_cfft_q15(n); ref_cfft_q15(cfftQ15, Q15(bufRef), 0U, 1U); }
+
+static uint32_t setup_rfft_fast_f32(uint32_t n)
+{
+  if ((n > 4096U) ||
+      (arm_rfft_fast_init_f32(&rfftFastF32Fut, (uint16_t) n) != ARM_MATH_SUCCESS) ||
+      (arm_rfft_fast_init_f32(&rfftFastF32Ref, (uint16_t) n) != ARM_MATH_SUCCESS))
+  {
+    return 0U;
+  }
+  bench_fill_f32(F32(bufA), n, 0.5f);
+  memcpy(bufRefIn, bufA, n * sizeof(float32_t));
+  benchIfft = 0U;
+  return n;
+}
+
+/* The input is used as work buffer: the forward transform of A into Fut and
+ * the inverse of Fut into A alternate */
+static void run_rfft_fast_f32(uint32_t n)
+{
+  (void) n;
+  if (benchIfft == 0U)
+  {
+    arm_rfft_fast_f32(&rfftFastF32Fut, F32(bufA), F32(bufFut), 0U);
+  }
+  else
+  {
+    arm_rfft_fast_f32(&rfftFastF32Fut, F32(bufFut), F32(bufA), 1U);
+  }
+  benchIfft ^= 1U;
+}
+
+static void check_rfft_fast_f32(uint32_t n)
+{
+  run_rfft_fast_f32(n);
+  ref_rfft_fast_f32(&rfftFastF32Ref, F32(bufRefIn), F32(bufRef), 0U);
+}
+
+static uint32_t setup_rfft_q31(uint32_t n)
+{
+  if ((arm_rfft_init_q31(&rfftQ31Fut, n, 0U, 1U) != ARM_MATH_SUCCESS) ||
+      (arm_rfft_init_q31(&rfftQ31Ref, n, 0U, 1U) != ARM_MATH_SUCCESS))
+  {
+    return 0U;
+  }
+  bench_fill_q31(Q31(bufA), n, 0.5f);
+  memcpy(bufRefIn, bufA, n * sizeof(q31_t));
+  return n;
+}
+
+static uint32_t setup_rfft_q15(uint32_t n)
+{
+  if ((arm_rfft_init_q15(&rfftQ15Fut, n, 0U, 1U) != ARM_MATH_SUCCESS) ||
+      (arm_rfft_init_q15(&rfftQ15Ref, n, 0U, 1U) != ARM_MATH_SUCCESS))
+  {
+    return 0U;
+  }
+  bench_fill_q15(Q15(bufA), n, 0.5f);
+  memcpy(bufRefIn, bufA, n * sizeof(q15_t));
+  return n;
+}
+
+static void run_rfft_q31(uint32_t n) { (void) n; arm_rfft_q31(&rfftQ31Fut, Q31(bufA), Q31(bufFut)); }
+static void run_rfft_q15(uint32_t n) { (void) n; arm_rfft_q15(&rfftQ15Fut, Q15(bufA), Q15(bufFut)); }
+
+static void check_rfft_q31(uint32_t n) { run_rfft_q31(n); ref_rfft_q31(&rfftQ31Ref, Q31(bufRefIn), Q31(bufRef)); }
+static void check_rfft_q15(uint32_t n) { run_rfft_q15(n); ref_rfft_q15(&rfftQ15Ref, Q15(bufRefIn), Q15(bufRef)); }
+
+/* Forward transforms only, as arm_rfft_q31 and arm_rfft_q15 */
+static uint32_t setup_rfft_fast_q31(uint32_t n)
+{
+  if ((n > 4096U) ||
+      (arm_rfft_fast_init_q31(&rfftFastQ31Fut, (uint16_t) n) != ARM_MATH_SUCCESS) ||
+      (arm_rfft_fast_init_q31(&rfftFastQ31Ref, (uint16_t) n) != ARM_MATH_SUCCESS))
+  {
+    return 0U;
+  }
+  bench_fill_q31(Q31(bufA), n, 0.5f);
+  memcpy(bufRefIn, bufA, n * sizeof(q31_t));
+  return n;
+}
+
+static uint32_t setup_rfft_fast_q15(uint32_t n)
+{
+  if ((n > 4096U) ||
+      (arm_rfft_fast_init_q15(&rfftFastQ15Fut, (uint16_t) n) != ARM_MATH_SUCCESS) ||
+      (arm_rfft_fast_init_q15(&rfftFastQ15Ref, (uint16_t) n) != ARM_MATH_SUCCESS))
+  {
+    return 0U;
+  }
+  bench_fill_q15(Q15(bufA), n, 0.5f);
+  memcpy(bufRefIn, bufA, n * sizeof(q15_t));
+  return n;
+}
+
+static void run_rfft_fast_q31(uint32_t n) { (void) n; arm_rfft_fast_q31(&rfftFastQ31Fut, Q31(bufA), Q31(bufFut), 0U); }
+static void run_rfft_fast_q15(uint32_t n) { (void) n; arm_rfft_fast_q15(&rfftFastQ15Fut, Q15(bufA), Q15(bufFut), 0U); }
+
+static void check_rfft_fast_q31(uint32_t n) { run_rfft_fast_q31(n); ref_rfft_fast_q31(&rfftFastQ31Ref, Q31(bufRefIn), Q31(bufRef), 0U); }
+static void check_rfft_fast_q15(uint32_t n) { run_rfft_fast_q15(n); ref_rfft_fast_q15(&rfftFastQ15Ref, Q15(bufRefIn), Q15(bufRef), 0U); }
+
+/* Mixed-radix transforms, against the direct DFT of RefLibs: same runs as
+ * cfft_f32 and rfft_fast_f32 */
+static arm_cfft_mixed_instance_f32 cfftMixedF32;
+static arm_rfft_mixed_instance_f32 rfftMixedF32;
+static float32_t benchMixedBuffer[4U * 4096U];
+
+static uint32_t setup_cfft_mixed_f32(uint32_t n)
+{
+  if ((n > 4096U) ||
+      (arm_cfft_mixed_init_f32(&cfftMixedF32, (uint16_t) n, benchMixedBuffer) != ARM_MATH_SUCCESS))
+  {
+    return 0U;
+  }
+  bench_fill_f32(F32(bufFut), 2U * n, 0.5f);
+  memcpy(bufRef, bufFut, 2U * n * sizeof(float32_t));
+  benchIfft = 0U;
+  return n;
+}
+
+static uint32_t setup_rfft_mixed_f32(uint32_t n)
+{
+  if ((n > 4096U) ||
+      (arm_rfft_mixed_init_f32(&rfftMixedF32, (uint16_t) n, benchMixedBuffer) != ARM_MATH_SUCCESS))
+  {
+    return 0U;
+  }
+  bench_fill_f32(F32(bufA), n, 0.5f);
+  memcpy(bufRefIn, bufA, n * sizeof(float32_t));
+  benchIfft = 0U;
+  return n;
+}
+
+static void run_cfft_mixed_f32(uint32_t n) { (void) n; arm_cfft_mixed_f32(&cfftMixedF32, F32(bufFut), benchIfft); benchIfft ^= 1U; }
+
+static void run_rfft_mixed_f32(uint32_t n)
+{
+  (void) n;
+  if (benchIfft == 0U)
+  {
+    arm_rfft_mixed_f32(&rfftMixedF32, F32(bufA), F32(bufFut), 0U);
+  }
+  else
+  {
+    arm_rfft_mixed_f32(&rfftMixedF32, F32(bufFut), F32(bufA), 1U);
+  }
+  benchIfft ^= 1U;
+}
+
+static void check_cfft_mixed_f32(uint32_t n) { run_cfft_mixed_f32(n); ref_cfft_mixed_f32(&cfftMixedF32, F32(bufRef), 0U); }
+static void check_rfft_mixed_f32(uint32_t n) { run_rfft_mixed_f32(n); ref_rfft_mixed_f32(&rfftMixedF32, F32(bufRefIn), F32(bufRef), 0U); }
+
+/* STFT of 2 * n samples per call, hop size n / 4: 8 frames of n points, Hann
+ * window. The inverse STFT takes the 8 spectra of the STFT and is compared to
+ * the input, delayed by n - n / 4 samples. */
+#define BENCH_STFT_FRAMES 8U
+
+static arm_stft_instance_f32 stftF32;
+static arm_istft_instance_f32 istftF32;
+static float32_t benchWindow[4096];
+static float32_t benchStftState[3U * 4096U];
+
+static uint32_t setup_stft(uint32_t n, arm_stft_output outputType)
+{
+  uint32_t i;
+
+  if (n > 4096U)
+  {
+    return 0U;
+  }
+  for (i = 0U; i < n; i++)
+  {
+    benchWindow[i] = 0.5f - 0.5f * cosf(6.2831853f * (float32_t) i / (float32_t) n);
+  }
+  if (arm_stft_init_f32(&stftF32, (uint16_t) n, (uint16_t) (n / 4U), benchWindow,
+                        benchStftState, outputType) != ARM_MATH_SUCCESS)
+  {
+    return 0U;
+  }
+  bench_fill_f32(F32(bufA), 2U * n, 0.5f);
+  memcpy(bufRefIn, bufA, 2U * n * sizeof(float32_t));
+  return BENCH_STFT_FRAMES;
+}
+
+static uint32_t setup_stft_f32(uint32_t n)
+{
+  return setup_stft(n, ARM_STFT_MAGNITUDE);
+}
+
+static uint32_t setup_istft_f32(uint32_t n)
+{
+  if ((setup_stft(n, ARM_STFT_SPECTRUM) == 0U) ||
+      (arm_stft_f32(&stftF32, F32(bufA), F32(bufB), 2U * n) != BENCH_STFT_FRAMES) ||
+      (arm_istft_init_f32(&istftF32, (uint16_t) n, (uint16_t) (n / 4U), benchWindow,
+                          benchStftState) != ARM_MATH_SUCCESS))
+  {
+    return 0U;
+  }
+  return BENCH_STFT_FRAMES;
+}
+
+static void run_stft_f32(uint32_t n) { arm_stft_f32(&stftF32, F32(bufA), F32(bufFut), 2U * n); }
+static void run_istft_f32(uint32_t n) { (void) n; arm_istft_f32(&istftF32, F32(bufB), F32(bufFut), BENCH_STFT_FRAMES); }
+
+static void check_stft_f32(uint32_t n) { run_stft_f32(n); ref_stft_f32(&stftF32, F32(bufRefIn), F32(bufRef), 2U * n); }
+
+static void check_istft_f32(uint32_t n)
+{
+  uint32_t delay = n - n / 4U;
+
+  run_istft_f32(n);
+  memset(bufRef, 0, delay * sizeof(float32_t));
+  memcpy(bufRef + delay, bufRefIn, (2U * n - delay) * sizeof(float32_t));
+}
+
+static uint32_t stft_outputs(uint32_t n) { return BENCH_STFT_FRAMES * (n / 2U + 1U); }
+static uint32_t istft_outputs(uint32_t n) { return 2U * n; }
+
+/* Goertzel filters and sliding DFT of BENCH_BINS bins of an n point DFT, over
+ * n samples per call: the Goertzel filters output one set of bins per call,
+ * the sliding DFT the bins of the last n samples. */
+#define BENCH_BINS 8U
+
+static arm_goertzel_instance_f32 goertzelF32;
+static arm_goertzel_instance_q31 goertzelQ31;
+static arm_goertzel_instance_q15 goertzelQ15;
+static arm_sdft_instance_f32 sdftF32;
+static arm_sdft_instance_q31 sdftQ31;
+static arm_sdft_instance_q15 sdftQ15;
+static uint16_t benchBins[BENCH_BINS];
+static q31_t benchBinCoeffs[2U * 4096U];
+static q63_t benchBinState[2U * BENCH_BINS];
+static q31_t benchSdftState[4096];
+
+static uint32_t setup_bins(uint32_t n)
+{
+  uint32_t j;
+
+  if (n > 4096U)
+  {
+    return 0U;
+  }
+  for (j = 0U; j < BENCH_BINS; j++)
+  {
+    benchBins[j] = (uint16_t) ((j + 1U) * n / 20U);
+  }
+  return n;
+}
+
+static uint32_t setup_goertzel_f32(uint32_t n)
+{
+  if ((setup_bins(n) == 0U) ||
+      (arm_goertzel_init_f32(&goertzelF32, BENCH_BINS, (uint16_t) n, benchBins, (float32_t *) benchBinCoeffs,
+                             (float32_t *) benchBinState) != ARM_MATH_SUCCESS))
+  {
+    return 0U;
+  }
+  bench_fill_f32(F32(bufA), n, 0.5f);
+  return n;
+}
+
+static uint32_t setup_goertzel_q31(uint32_t n)
+{
+  if ((setup_bins(n) == 0U) ||
+      (arm_goertzel_init_q31(&goertzelQ31, BENCH_BINS, (uint16_t) n, benchBins, benchBinCoeffs,
+                             benchBinState) != ARM_MATH_SUCCESS))
+  {
+    return 0U;
+  }
+  bench_fill_q31(Q31(bufA), n, 0.5f);
+  return n;
+}
+
+static uint32_t setup_goertzel_q15(uint32_t n)
+{
+  if ((setup_bins(n) == 0U) ||
+      (arm_goertzel_init_q15(&goertzelQ15, BENCH_BINS, (uint16_t) n, benchBins, benchBinCoeffs,
+                             (q31_t *) benchBinState) != ARM_MATH_SUCCESS))
+  {
+    return 0U;
+  }
+  bench_fill_q15(Q15(bufA), n, 0.5f);
+  return n;
+}
+
+static uint32_t setup_sdft_f32(uint32_t n)
+{
+  if ((setup_bins(n) == 0U) ||
+      (arm_sdft_init_f32(&sdftF32, BENCH_BINS, (uint16_t) n, benchBins, (float32_t *) benchBinCoeffs,
+                         (float32_t *) benchSdftState, (float32_t *) benchBinState) != ARM_MATH_SUCCESS))
+  {
+    return 0U;
+  }
+  bench_fill_f32(F32(bufA), n, 0.5f);
+  return n;
+}
+
+static uint32_t setup_sdft_q31(uint32_t n)
+{
+  if ((setup_bins(n) == 0U) ||
+      (arm_sdft_init_q31(&sdftQ31, BENCH_BINS, (uint16_t) n, benchBins, benchBinCoeffs,
+                         benchSdftState, benchBinState) != ARM_MATH_SUCCESS))
+  {
+    return 0U;
+  }
+  bench_fill_q31(Q31(bufA), n, 0.5f);
+  return n;
+}
+
+static uint32_t setup_sdft_q15(uint32_t n)
+{
+  if ((setup_bins(n) == 0U) ||
+      (arm_sdft_init_q15(&sdftQ15, BENCH_BINS, (uint16_t) n, benchBins, (q15_t *) benchBinCoeffs,
+                         (q15_t *) benchSdftState, benchBinState) != ARM_MATH_SUCCESS))
+  {
+    return 0U;
+  }
+  bench_fill_q15(Q15(bufA), n, 0.5f);
+  return n;
+}
+
+static void run_goertzel_f32(uint32_t n) { arm_goertzel_f32(&goertzelF32, F32(bufA), F32(bufFut), n); }
+static void run_goertzel_q31(uint32_t n) { arm_goertzel_q31(&goertzelQ31, Q31(bufA), Q31(bufFut), n); }
+static void run_goertzel_q15(uint32_t n) { arm_goertzel_q15(&goertzelQ15, Q15(bufA), Q15(bufFut), n); }
+static void run_sdft_f32(uint32_t n) { arm_sdft_f32(&sdftF32, F32(bufA), F32(bufFut), n); }
+static void run_sdft_q31(uint32_t n) { arm_sdft_q31(&sdftQ31, Q31(bufA), Q31(bufFut), n); }
+static void run_sdft_q15(uint32_t n) { arm_sdft_q15(&sdftQ15, Q15(bufA), Q15(bufFut), n); }
+
+static void check_goertzel_f32(uint32_t n) { run_goertzel_f32(n); ref_goertzel_f32(&goertzelF32, benchBins, F32(bufA), F32(bufRef), n); }
+static void check_goertzel_q31(uint32_t n) { run_goertzel_q31(n); ref_goertzel_q31(&goertzelQ31, benchBins, Q31(bufA), Q31(bufRef), n); }
+static void check_goertzel_q15(uint32_t n) { run_goertzel_q15(n); ref_goertzel_q15(&goertzelQ15, benchBins, Q15(bufA), Q15(bufRef), n); }
+static void check_sdft_f32(uint32_t n) { run_sdft_f32(n); ref_sdft_f32(&sdftF32, F32(bufA), F32(bufRef), n); }
+static void check_sdft_q31(uint32_t n) { run_sdft_q31(n); ref_sdft_q31(&sdftQ31, Q31(bufA), Q31(bufRef), n); }
+static void check_sdft_q15(uint32_t n) { run_sdft_q15(n); ref_sdft_q15(&sdftQ15, Q15(bufA), Q15(bufRef), n); }
+
+static uint32_t bins_outputs(uint32_t n) { (void) n; return 2U * BENCH_BINS; }
+
+/*--------------------------------------------------------------------------------*/
+/* Matrix */
+/*--------------------------------------------------------------------------------*/
+
+static arm_matrix_instance_f32 matF32A, matF32B, matF32Fut, matF32Ref;
+static arm_matrix_instance_q31 matQ31A, matQ31B, matQ31Fut, matQ31Ref;
+static arm_matrix_instance_q15 matQ15A, matQ15B, matQ15Fut, matQ15Ref;
+
+static uint32_t mat_outputs(uint32_t n) { return n * n; }
+
+/* B is scaled by 1/n so that the fixed point products do not overflow */
+static uint32_t setup_mat_mult_f32(uint32_t n)
+{
+  if (n * n > BENCH_MAX_SAMPLES)
+  {
+    return 0U;
+  }
+  arm_mat_init_f32(&matF32A, n, n, F32(bufA));
+  arm_mat_init_f32(&matF32B, n, n, F32(bufB));
+  arm_mat_init_f32(&matF32Fut, n, n, F32(bufFut));
+  arm_mat_init_f32(&matF32Ref, n, n, F32(bufRef));
+  bench_fill_f32(F32(bufA), n * n, 0.5f);
+  bench_fill_f32(F32(bufB), n * n, 0.5f / (float32_t) n);
+  return n * n;
+}
+
+static uint32_t setup_mat_mult_q31(uint32_t n)
+{
+  if (n * n > BENCH_MAX_SAMPLES)
+  {
+    return 0U;
+  }
+  arm_mat_init_q31(&matQ31A, n, n, Q31(bufA));
+  arm_mat_init_q31(&matQ31B, n, n, Q31(bufB));
+  arm_mat_init_q31(&matQ31Fut, n, n, Q31(bufFut));
+  arm_mat_init_q31(&matQ31Ref, n, n, Q31(bufRef));
+  bench_fill_q31(Q31(bufA), n * n, 0.5f);
+  bench_fill_q31(Q31(bufB), n * n, 0.5f / (float32_t) n);
+  return n * n;
+}
+
+static uint32_t setup_mat_mult_q15(uint32_t n)
+{
+  if (n * n > BENCH_MAX_SAMPLES)
+  {
+    return 0U;
+  }
+  arm_mat_init_q15(&matQ15A, n, n, Q15(bufA));
+  arm_mat_init_q15(&matQ15B, n, n, Q15(bufB));
+  arm_mat_init_q15(&matQ15Fut, n, n, Q15(bufFut));
+  arm_mat_init_q15(&matQ15Ref, n, n, Q15(bufRef));
+  bench_fill_q15(Q15(bufA), n * n, 0.5f);
+  bench_fill_q15(Q15(bufB), n * n, 0.5f / (float32_t) n);
+  return n * n;
+}
+
+static void run_mat_mult_f32(uint32_t n) { (void) n; arm_mat_mult_f32(&matF32A, &matF32B, &matF32Fut); }
+static void run_mat_mult_q31(uint32_t n) { (void) n; arm_mat_mult_q31(&matQ31A, &matQ31B, &matQ31Fut); }
+static void run_mat_mult_q15(uint32_t n) { (void) n; arm_mat_mult_q15(&matQ15A, &matQ15B, &matQ15Fut, Q15(bufStateFut)); }
+
+static void check_mat_mult_f32(uint32_t n) { run_mat_mult_f32(n); ref_mat_mult_f32(&matF32A, &matF32B, &matF32Ref); }
+static void check_mat_mult_q31(uint32_t n) { run_mat_mult_q31(n); ref_mat_mult_q31(&matQ31A, &matQ31B, &matQ31Ref); }
+static void check_mat_mult_q15(uint32_t n) { run_mat_mult_q15(n); ref_mat_mult_q15(&matQ15A, &matQ15B, &matQ15Ref); }
+
+/* mat_mult_bt uses B as the transposed second matrix */
+static void run_mat_mult_bt_f32(uint32_t n) { (void) n; arm_mat_mult_bt_f32(&matF32A, &matF32B, &matF32Fut); }
+static void run_mat_mult_bt_q31(uint32_t n) { (void) n; arm_mat_mult_bt_q31(&matQ31A, &matQ31B, &matQ31Fut); }
+static void run_mat_mult_bt_q15(uint32_t n) { (void) n; arm_mat_mult_bt_q15(&matQ15A, &matQ15B, &matQ15Fut); }
+
+static void check_mat_mult_bt_f32(uint32_t n) { run_mat_mult_bt_f32(n); ref_mat_mult_bt_f32(&matF32A, &matF32B, &matF32Ref); }
+static void check_mat_mult_bt_q31(uint32_t n) { run_mat_mult_bt_q31(n); ref_mat_mult_bt_q31(&matQ31A, &matQ31B, &matQ31Ref); }
+static void check_mat_mult_bt_q15(uint32_t n) { run_mat_mult_bt_q15(n); ref_mat_mult_bt_q15(&matQ15A, &matQ15B, &matQ15Ref); }
+
+/* mat_vec_mult: the n x n matrix A times the first column of B, n outputs */
+static uint32_t setup_mat_vec_mult_f32(uint32_t n) { return (setup_mat_mult_f32(n) != 0U) ? n : 0U; }
+static uint32_t setup_mat_vec_mult_q31(uint32_t n) { return (setup_mat_mult_q31(n) != 0U) ? n : 0U; }
+static uint32_t setup_mat_vec_mult_q15(uint32_t n) { return (setup_mat_mult_q15(n) != 0U) ? n : 0U; }
+
+static void run_mat_vec_mult_f32(uint32_t n) { (void) n; arm_mat_vec_mult_f32(&matF32A, F32(bufB), F32(bufFut)); }
+static void run_mat_vec_mult_q31(uint32_t n) { (void) n; arm_mat_vec_mult_q31(&matQ31A, Q31(bufB), Q31(bufFut)); }
+static void run_mat_vec_mult_q15(uint32_t n) { (void) n; arm_mat_vec_mult_q15(&matQ15A, Q15(bufB), Q15(bufFut)); }
+
+static void check_mat_vec_mult_f32(uint32_t n) { run_mat_vec_mult_f32(n); ref_mat_vec_mult_f32(&matF32A, F32(bufB), F32(bufRef)); }
+static void check_mat_vec_mult_q31(uint32_t n) { run_mat_vec_mult_q31(n); ref_mat_vec_mult_q31(&matQ31A, Q31(bufB), Q31(bufRef)); }
+static void check_mat_vec_mult_q15(uint32_t n) { run_mat_vec_mult_q15(n); ref_mat_vec_mult_q15(&matQ15A, Q15(bufB), Q15(bufRef)); }
+
+/*--------------------------------------------------------------------------------*/
+/* Linear solvers */
+/*--------------------------------------------------------------------------------*/
+
+/* A * x = b, A = M * M' / n + I, M and b uniform in [-0.5, 0.5). Each run
+ * decomposes A and solves for x, mat_inverse_f32 computing inv(A) * b. The
+ * reference is the Cholesky solve in double precision. */
+static arm_matrix_instance_f32 spdA, spdFact, spdB, spdX;
+static arm_matrix_instance_f64 spdA64, spdFact64, spdB64, spdX64;
+
+#define BENCH_SOLVE_MAX 32U
+#define SPD_A64    ((float64_t *) bufRefIn)
+#define SPD_B64    (SPD_A64 + (BENCH_SOLVE_MAX * BENCH_SOLVE_MAX))
+#define SPD_FACT64 (SPD_B64 + BENCH_SOLVE_MAX)
+#define SPD_X64    (SPD_FACT64 + (BENCH_SOLVE_MAX * BENCH_SOLVE_MAX))
+
+static void spd_init_f64(arm_matrix_instance_f64 *m, uint32_t rows, uint32_t cols, float64_t *p)
+{
+  m->numRows = (uint16_t) rows;
+  m->numCols = (uint16_t) cols;
+  m->pData = p;
+}
+
+static uint32_t setup_spd(uint32_t n)
+{
+  uint32_t i, j, k;
+  float64_t sum;
+
+  if (n > BENCH_SOLVE_MAX)
+  {
+    return 0U;
+  }
+
+  bench_fill_f32(F32(bufB), n * n, 0.5f);
+  for (i = 0U; i < n; i++)
+  {
+    for (j = 0U; j < n; j++)
+    {
+      sum = (i == j) ? 1.0 : 0.0;
+      for (k = 0U; k < n; k++)
+      {
+        sum += (float64_t) F32(bufB)[(i * n) + k] * F32(bufB)[(j * n) + k] / (float64_t) n;
+      }
+      F32(bufA)[(i * n) + j] = (float32_t) sum;
+      SPD_A64[(i * n) + j] = F32(bufA)[(i * n) + j];
+    }
+  }
+  bench_fill_f32(F32(bufB), n, 0.5f);
+  for (i = 0U; i < n; i++)
+  {
+    SPD_B64[i] = F32(bufB)[i];
+  }
+
+  arm_mat_init_f32(&spdA, n, n, F32(bufA));
+  arm_mat_init_f32(&spdFact, n, n, F32(bufStateFut));
+  arm_mat_init_f32(&spdB, n, 1, F32(bufB));
+  arm_mat_init_f32(&spdX, n, 1, F32(bufFut));
+  spd_init_f64(&spdA64, n, n, SPD_A64);
+  spd_init_f64(&spdFact64, n, n, SPD_FACT64);
+  spd_init_f64(&spdB64, n, 1, SPD_B64);
+  spd_init_f64(&spdX64, n, 1, SPD_X64);
+  return 1U;
+}
+
+static void ref_spd(void)
+{
+  uint32_t i;
+
+  ref_mat_cholesky_f64(&spdA64, &spdFact64);
+  ref_mat_cholesky_solve_f64(&spdFact64, &spdB64, &spdX64);
+  for (i = 0U; i < spdX64.numRows; i++)
+  {
+    F32(bufRef)[i] = (float32_t) SPD_X64[i];
+  }
+}
+
+/* arm_mat_inverse_f32 overwrites its input: it inverts a copy */
+static void run_mat_inverse_f32(uint32_t n)
+{
+  arm_matrix_instance_f32 inv;
+
+  arm_mat_init_f32(&inv, n, n, F32(bufStateRef));
+  arm_copy_f32(F32(bufA), F32(bufStateFut), n * n);
+  arm_mat_inverse_f32(&spdFact, &inv);
+  arm_mat_vec_mult_f32(&inv, F32(bufB), F32(bufFut));
+}
+
+static void run_mat_cholesky_f32(uint32_t n)
+{
+  (void) n;
+  arm_mat_cholesky_f32(&spdA, &spdFact);
+  arm_mat_cholesky_solve_f32(&spdFact, &spdB, &spdX);
+}
+
+static void run_mat_ldlt_f32(uint32_t n)
+{
+  (void) n;
+  arm_mat_ldlt_f32(&spdA, &spdFact);
+  arm_mat_ldlt_solve_f32(&spdFact, &spdB, &spdX);
+}
+
+/* The QR solve overwrites b with Q' * b: x is solved in place of a copy of b */
+static void run_mat_qr_f32(uint32_t n)
+{
+  arm_mat_qr_f32(&spdA, &spdFact, F32(bufStateRef));
+  arm_copy_f32(F32(bufB), F32(bufFut), n);
+  arm_mat_qr_solve_f32(&spdFact, F32(bufStateRef), &spdX, &spdX);
+}
+
+static void run_mat_cholesky_f64(uint32_t n)
+{
+  arm_matrix_instance_f64 x;
+
+  spd_init_f64(&x, n, 1U, (float64_t *) bufStateRef);
+  arm_mat_cholesky_f64(&spdA64, &spdFact64);
+  arm_mat_cholesky_solve_f64(&spdFact64, &spdB64, &x);
+}
+
+static void check_mat_inverse_f32(uint32_t n)  { run_mat_inverse_f32(n);  ref_spd(); }
+static void check_mat_cholesky_f32(uint32_t n) { run_mat_cholesky_f32(n); ref_spd(); }
+static void check_mat_ldlt_f32(uint32_t n)     { run_mat_ldlt_f32(n);     ref_spd(); }
+static void check_mat_qr_f32(uint32_t n)       { run_mat_qr_f32(n);       ref_spd(); }
+static void check_mat_cholesky_f64(uint32_t n)
+{
+  uint32_t i;
+
+  run_mat_cholesky_f64(n);
+  for (i = 0U; i < n; i++)
+  {
+    F32(bufFut)[i] = (float32_t) ((float64_t *) bufStateRef)[i];
+  }
+  ref_spd();
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Function table */
+/*--------------------------------------------------------------------------------*/
+
+#define BENCH_ENTRY(name, kind, bytes, snr, setup, outLen, outType)     \
+  { #name, kind, bytes, snr, setup, run_##name, check_##name, outLen, outType }
+
+/* SNR thresholds are the ones of the DSP_Lib test suite groups. The q63
+ * results of dot_prod are compared as f32 ('f'). dot_prod_f32 is a single
+ * sum of up to 65536 products: its threshold allows for the addition order
+ * of the host vector code. */
+static const bench_entry bench_table[] =
+{
+  BENCH_ENTRY(add_f32,              BENCH_VECTOR, 12U, 120.0f, setup_vec_f32,   n_outputs, 'f'),
+  BENCH_ENTRY(add_q31,              BENCH_VECTOR, 12U, 100.0f, setup_vec_q31,   n_outputs, 'l'),
+  BENCH_ENTRY(add_q15,              BENCH_VECTOR,  6U,  75.0f, setup_vec_q15,   n_outputs, 's'),
+  BENCH_ENTRY(dot_prod_f32,         BENCH_VECTOR,  8U, 100.0f, setup_vec_f32,   one_output, 'f'),
+  BENCH_ENTRY(dot_prod_q31,         BENCH_VECTOR,  8U, 100.0f, setup_vec_q31,   one_output, 'f'),
+  BENCH_ENTRY(dot_prod_q15,         BENCH_VECTOR,  4U,  75.0f, setup_vec_q15,   one_output, 'f'),
+  BENCH_ENTRY(cmplx_mag_f32,        BENCH_VECTOR, 12U, 120.0f, setup_cmplx_f32, n_outputs, 'f'),
+  BENCH_ENTRY(cmplx_mult_cmplx_f32, BENCH_VECTOR, 24U, 120.0f, setup_cmplx_f32, cmplx_outputs, 'f'),
+  BENCH_ENTRY(fir_f32,              BENCH_VECTOR,  8U,  99.0f, setup_fir_f32,   n_outputs, 'f'),
+  BENCH_ENTRY(fir_q31,              BENCH_VECTOR,  8U,  90.0f, setup_fir_q31,   n_outputs, 'l'),
+  BENCH_ENTRY(fir_q15,              BENCH_VECTOR,  4U,  60.0f, setup_fir_q15,   n_outputs, 's'),
+  BENCH_ENTRY(fir_decimate_f32,     BENCH_VECTOR,  5U,  99.0f, setup_fir_decimate_f32, decimated_outputs, 'f'),
+  BENCH_ENTRY(fir_interpolate_f32,  BENCH_VECTOR, 20U,  99.0f, setup_fir_interpolate_f32, interpolated_outputs, 'f'),
+  BENCH_ENTRY(fir_resample_f32,     BENCH_RESAMPLE,  5U, 99.0f, setup_fir_resample_f32, resample_outputs, 'f'),
+  BENCH_ENTRY(fir_resample_q31,     BENCH_RESAMPLE,  5U, 90.0f, setup_fir_resample_q31, resample_outputs, 'l'),
+  BENCH_ENTRY(fir_resample_q15,     BENCH_RESAMPLE,  3U, 60.0f, setup_fir_resample_q15, resample_outputs, 's'),
+  BENCH_ENTRY(fir_interp_decim_f32, BENCH_RESAMPLE,  5U, 99.0f, setup_fir_interp_decim_f32, resample_outputs, 'f'),
+  BENCH_ENTRY(fir_interp_decim_q31, BENCH_RESAMPLE,  5U, 90.0f, setup_fir_interp_decim_q31, resample_outputs, 'l'),
+  BENCH_ENTRY(fir_interp_decim_q15, BENCH_RESAMPLE,  3U, 60.0f, setup_fir_interp_decim_q15, resample_outputs, 's'),
+  BENCH_ENTRY(biquad_df2T_f32,      BENCH_VECTOR,  8U,  99.0f, setup_biquad_df2T_f32, n_outputs, 'f'),
+  BENCH_ENTRY(biquad_df1_q31,       BENCH_VECTOR,  8U,  90.0f, setup_biquad_df1_q31,  n_outputs, 'l'),
+  BENCH_ENTRY(biquad_df1_q15,       BENCH_VECTOR,  4U,  60.0f, setup_biquad_df1_q15,  n_outputs, 's'),
+  BENCH_ENTRY(cfft_f32,             BENCH_FFT,    16U,  90.0f, setup_cfft_f32,  cmplx_outputs, 'f'),
+  BENCH_ENTRY(cfft_q31,             BENCH_FFT,    16U,  90.0f, setup_cfft_q31,  cmplx_outputs, 'l'),
+  BENCH_ENTRY(cfft_q15,             BENCH_FFT,     8U,  30.0f, setup_cfft_q15,  cmplx_outputs, 's'),
+  BENCH_ENTRY(rfft_fast_f32,        BENCH_FFT,     8U,  90.0f, setup_rfft_fast_f32, n_outputs, 'f'),
+  BENCH_ENTRY(rfft_q31,             BENCH_FFT,    12U,  90.0f, setup_rfft_q31,  n_outputs, 'l'),
+  BENCH_ENTRY(rfft_q15,             BENCH_FFT,     6U,  30.0f, setup_rfft_q15,  n_outputs, 's'),
+  BENCH_ENTRY(rfft_fast_q31,        BENCH_FFT,     8U,  90.0f, setup_rfft_fast_q31, n_outputs, 'l'),
+  BENCH_ENTRY(rfft_fast_q15,        BENCH_FFT,     4U,  30.0f, setup_rfft_fast_q15, n_outputs, 's'),
+  BENCH_ENTRY(cfft_mixed_f32,       BENCH_FFT_MIXED, 16U, 120.0f, setup_cfft_mixed_f32, cmplx_outputs, 'f'),
+  BENCH_ENTRY(rfft_mixed_f32,       BENCH_FFT_MIXED,  8U, 120.0f, setup_rfft_mixed_f32, n_outputs, 'f'),
+  BENCH_ENTRY(stft_f32,             BENCH_STFT,    0U,  90.0f, setup_stft_f32,  stft_outputs, 'f'),
+  BENCH_ENTRY(istft_f32,            BENCH_STFT,    0U,  90.0f, setup_istft_f32, istft_outputs, 'f'),
+  BENCH_ENTRY(goertzel_f32,         BENCH_FFT,     4U,  90.0f, setup_goertzel_f32, bins_outputs, 'f'),
+  BENCH_ENTRY(goertzel_q31,         BENCH_FFT,     4U,  90.0f, setup_goertzel_q31, bins_outputs, 'l'),
+  BENCH_ENTRY(goertzel_q15,         BENCH_FFT,     2U,  30.0f, setup_goertzel_q15, bins_outputs, 's'),
+  BENCH_ENTRY(sdft_f32,             BENCH_FFT,     4U,  90.0f, setup_sdft_f32,  bins_outputs, 'f'),
+  BENCH_ENTRY(sdft_q31,             BENCH_FFT,     4U,  90.0f, setup_sdft_q31,  bins_outputs, 'l'),
+  BENCH_ENTRY(sdft_q15,             BENCH_FFT,     2U,  30.0f, setup_sdft_q15,  bins_outputs, 's'),
+  BENCH_ENTRY(mat_mult_f32,         BENCH_MATRIX, 12U, 120.0f, setup_mat_mult_f32, mat_outputs, 'f'),
+  BENCH_ENTRY(mat_mult_q31,         BENCH_MATRIX, 12U, 100.0f, setup_mat_mult_q31, mat_outputs, 'l'),
+  BENCH_ENTRY(mat_mult_q15,         BENCH_MATRIX,  6U,  75.0f, setup_mat_mult_q15, mat_outputs, 's'),
+  BENCH_ENTRY(mat_mult_bt_f32,      BENCH_MATRIX, 12U, 120.0f, setup_mat_mult_f32, mat_outputs, 'f'),
+  BENCH_ENTRY(mat_mult_bt_q31,      BENCH_MATRIX, 12U, 100.0f, setup_mat_mult_q31, mat_outputs, 'l'),
+  BENCH_ENTRY(mat_mult_bt_q15,      BENCH_MATRIX,  6U,  75.0f, setup_mat_mult_q15, mat_outputs, 's'),
+  BENCH_ENTRY(mat_vec_mult_f32,     BENCH_MATRIX, 12U, 120.0f, setup_mat_vec_mult_f32, n_outputs, 'f'),
+  BENCH_ENTRY(mat_vec_mult_q31,     BENCH_MATRIX, 12U, 100.0f, setup_mat_vec_mult_q31, n_outputs, 'l'),
+  BENCH_ENTRY(mat_vec_mult_q15,     BENCH_MATRIX,  6U,  75.0f, setup_mat_vec_mult_q15, n_outputs, 's'),
+  BENCH_ENTRY(mat_inverse_f32,      BENCH_SOLVE,   0U,  90.0f, setup_spd, n_outputs, 'f'),
+  BENCH_ENTRY(mat_cholesky_f32,     BENCH_SOLVE,   0U,  90.0f, setup_spd, n_outputs, 'f'),
+  BENCH_ENTRY(mat_ldlt_f32,         BENCH_SOLVE,   0U,  90.0f, setup_spd, n_outputs, 'f'),
+  BENCH_ENTRY(mat_qr_f32,           BENCH_SOLVE,   0U,  90.0f, setup_spd, n_outputs, 'f'),
+  BENCH_ENTRY(mat_cholesky_f64,     BENCH_SOLVE,   0U, 130.0f, setup_spd, n_outputs, 'f'),
+};
+
+/*--------------------------------------------------------------------------------*/
+/* Runner */
+/*--------------------------------------------------------------------------------*/
+
+static uint64_t bench_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+static uint64_t bench_ticks(void)
+{
+#if defined (__x86_64__) || defined (__i386__)
+  return __rdtsc();
+#else
+  return bench_ns();
+#endif
+}
+
+/* Returns -1 when the outputs are bit identical, the SNR in dB otherwise */
+static double bench_snr(const bench_entry * e, uint32_t n)
+{
+  uint32_t len = e->outLen(n);
+  double signal = 0.0, noise = 0.0;
+  uint32_t i;
+
+  if (memcmp(bufFut, bufRef, len * ((e->outType == 's') ? 2U : 4U)) == 0)
+  {
+    return -1.0;
+  }
+
+  if (e->outType == 'l')
+  {
+    arm_q31_to_float(Q31(bufFut), bufCmpFut, len);
+    arm_q31_to_float(Q31(bufRef), bufCmpRef, len);
+  }
+  else if (e->outType == 's')
+  {
+    arm_q15_to_float(Q15(bufFut), bufCmpFut, len);
+    arm_q15_to_float(Q15(bufRef), bufCmpRef, len);
+  }
+  else
+  {
+    memcpy(bufCmpFut, bufFut, len * sizeof(float32_t));
+    memcpy(bufCmpRef, bufRef, len * sizeof(float32_t));
+  }
+
+  for (i = 0U; i < len; i++)
+  {
+    if (isnan(bufCmpFut[i]) || isinf(bufCmpFut[i]))
+    {
+      return 0.0;
+    }
+    signal += (double) bufCmpRef[i] * bufCmpRef[i];
+    noise  += ((double) bufCmpRef[i] - bufCmpFut[i]) * ((double) bufCmpRef[i] - bufCmpFut[i]);
+  }
+
+  return (noise == 0.0) ? 300.0 : 10.0 * log10(signal / noise);
+}
+
+static int bench_one(const bench_entry * e, uint32_t n, uint64_t minNs)
+{
+  uint32_t samples, reps, i, b;
+  uint64_t t0, t1, c0, c1, bestNs = ~0ULL, bestTicks = ~0ULL;
+  double snr;
+  int pass;
+
+  /* Check against RefLibs */
+  samples = e->setup(n);
+  if (samples == 0U)
+  {
+    return 0;
+  }
+  e->check(n);
+  snr = bench_snr(e, n);
+  pass = (snr < 0.0) || (snr >= e->snrMin);
+
+  /* Calibrate the batch length, then keep the best batch */
+  e->setup(n);
+  reps = 1U;
+  for (;;)
+  {
+    t0 = bench_ns();
+    for (i = 0U; i < reps; i++)
+    {
+      e->run(n);
+    }
+    t1 = bench_ns();
+    if ((t1 - t0 >= minNs) || (reps >= (1U << 30)))
+    {
+      break;
+    }
+    reps *= 2U;
+  }
+
+  for (b = 0U; b < BENCH_BATCHES; b++)
+  {
+    t0 = bench_ns();
+    c0 = bench_ticks();
+    for (i = 0U; i < reps; i++)
+    {
+      e->run(n);
+    }
+    c1 = bench_ticks();
+    t1 = bench_ns();
+    if (t1 - t0 < bestNs)
+    {
+      bestNs = t1 - t0;
+    }
+    if (c1 - c0 < bestTicks)
+    {
+      bestTicks = c1 - c0;
+    }
+  }
+
+  printf("%-22s %6u %10.2f ", e->name, (unsigned) n,
+         (double) bestTicks / ((double) reps * samples));
+  if (e->kind == BENCH_STFT)
+  {
+    printf("%10.0f ", (double) samples * reps * 1e9 / (double) bestNs);
+  }
+  else if (e->bytes != 0U)
+  {
+    printf("%10.1f ", (double) e->bytes * samples * reps * 1000.0 / (double) bestNs);
+  }
+  else
+  {
+    printf("%10s ", "-");
+  }
+  if (snr < 0.0)
+  {
+    printf("%8s", "exact");
+  }
+  else
+  {
+    printf("%8.1f", snr);
+  }
+  printf("  %s\n", pass ? "PASS" : "FAIL");
+
+  return pass ? 0 : 1;
+}
+
+int main(int argc, char ** argv)
+{
+  uint32_t onlySize = 0U, failed = 0U, e, s, f, nFilters = 0U;
+  uint64_t minNs = 2000000ULL;
+  const char * filters[64];
+  const uint32_t * sizes;
+  uint32_t single[2] = { 0U, 0U };
+  int i, selected;
+
+  for (i = 1; i < argc; i++)
+  {
+    if ((strcmp(argv[i], "-n") == 0) && (i + 1 < argc))
+    {
+      onlySize = (uint32_t) strtoul(argv[++i], NULL, 0);
+    }
+    else if ((strcmp(argv[i], "-t") == 0) && (i + 1 < argc))
+    {
+      minNs = (uint64_t) strtoul(argv[++i], NULL, 0) * 1000000ULL;
+    }
+    else if (argv[i][0] == '-')
+    {
+      fprintf(stderr, "usage: %s [-n size] [-t ms] [name ...]\n", argv[0]);
+      return 2;
+    }
+    else if (nFilters < 64U)
+    {
+      filters[nFilters++] = argv[i];
+    }
+  }
+
+  if (onlySize > BENCH_MAX_SAMPLES)
+  {
+    fprintf(stderr, "size %u larger than %u\n", (unsigned) onlySize, (unsigned) BENCH_MAX_SAMPLES);
+    return 2;
+  }
+
+  printf("Profile: %s%s, ticks: %s\n", BENCH_PROFILE, BENCH_SIMD, BENCH_TICKS_UNIT);
+  printf("%-22s %6s %10s %10s %8s  %s\n", "function", "N", BENCH_TICKS_NAME, "MB/s", "SNR dB", "RefLibs");
+
+  for (e = 0U; e < sizeof(bench_table) / sizeof(bench_table[0]); e++)
+  {
+    selected = (nFilters == 0U);
+    for (f = 0U; f < nFilters; f++)
+    {
+      if (strstr(bench_table[e].name, filters[f]) != NULL)
+      {
+        selected = 1;
+      }
+    }
+    if (!selected)
+    {
+      continue;
+    }
+
+    if (onlySize != 0U)
+    {
+      single[0] = onlySize;
+      sizes = single;
+    }
+    else
+    {
+      sizes = ((bench_table[e].kind == BENCH_FFT) ||
+               (bench_table[e].kind == BENCH_STFT)) ? bench_sizes_fft :
+              (bench_table[e].kind == BENCH_FFT_MIXED) ? bench_sizes_mixed :
+              (bench_table[e].kind == BENCH_RESAMPLE) ? bench_sizes_resample :
+              (bench_table[e].kind == BENCH_MATRIX) ? bench_sizes_matrix :
+              (bench_table[e].kind == BENCH_SOLVE)  ? bench_sizes_solve :
+                                                      bench_sizes_vector;
+    }
+
+    for (s = 0U; sizes[s] != 0U; s++)
+    {
+      failed += (uint32_t) bench_one(&bench_table[e], sizes[s], minNs);
+    }
+  }
+
+  if (failed != 0U)
+  {
+    printf("%u checks failed\n", (unsigned) failed);
+  }
+
+  return (failed == 0U) ? 0 : 1;
+}
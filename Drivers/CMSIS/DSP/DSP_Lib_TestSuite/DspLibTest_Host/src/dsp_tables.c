@@ -0,0 +1,140 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        dsp_tables.c
+ * Description:  Host program running one FFT, built for each FFT table
+ *               configuration of the "make tables" report
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Host (ARM_MATH_HOST)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * The program is linked with the CommonTables and TransformFunctions
+ * sources, built with the ARM_TABLE_ macros of the configuration and
+ * -ffunction-sections -fdata-sections, and with --gc-sections: its size is
+ * what the FFT costs in flash and RAM on target. The FFT is selected by one
+ * of the macros below, its value being the FFT length:
+ *
+ *   TABLES_CFFT_F32, TABLES_CFFT_Q15             arm_cfft_init_xxx()
+ *   TABLES_CFFT_F32_RAM, TABLES_CFFT_Q15_RAM     arm_cfft_init_twiddle_xxx()
+ *   TABLES_RFFT_FAST_F32, TABLES_RFFT_FAST_Q15   arm_rfft_fast_init_xxx()
+ *   TABLES_RFFT_FAST_F32_RAM                     arm_rfft_fast_init_twiddle_f32()
+ *
+ * None of them gives the program without FFT, the size the others are
+ * compared to. The program prints the time taken by the initialization
+ * function, in nanoseconds, and exits with a non zero status if it fails.
+ */
+
+#include <stdio.h>
+#include <time.h>
+
+#include "arm_math.h"
+
+#define TABLES_INITS 1000U
+
+#if defined (TABLES_CFFT_F32)
+static arm_cfft_instance_f32 S;
+static float32_t data[2U * TABLES_CFFT_F32];
+#define TABLES_LEN    (2U * TABLES_CFFT_F32)
+#define TABLES_INIT() arm_cfft_init_f32(&S, TABLES_CFFT_F32)
+#define TABLES_RUN()  arm_cfft_f32(&S, data, 0U, 1U)
+
+#elif defined (TABLES_CFFT_F32_RAM)
+static arm_cfft_instance_f32 S;
+static float32_t data[2U * TABLES_CFFT_F32_RAM];
+static float32_t twiddle[2U * TABLES_CFFT_F32_RAM];
+#define TABLES_LEN    (2U * TABLES_CFFT_F32_RAM)
+#define TABLES_INIT() arm_cfft_init_twiddle_f32(&S, TABLES_CFFT_F32_RAM, twiddle)
+#define TABLES_RUN()  arm_cfft_f32(&S, data, 0U, 1U)
+
+#elif defined (TABLES_CFFT_Q15)
+static arm_cfft_instance_q15 S;
+static q15_t data[2U * TABLES_CFFT_Q15];
+#define TABLES_LEN    (2U * TABLES_CFFT_Q15)
+#define TABLES_INIT() arm_cfft_init_q15(&S, TABLES_CFFT_Q15)
+#define TABLES_RUN()  arm_cfft_q15(&S, data, 0U, 1U)
+
+#elif defined (TABLES_CFFT_Q15_RAM)
+static arm_cfft_instance_q15 S;
+static q15_t data[2U * TABLES_CFFT_Q15_RAM];
+static q15_t twiddle[3U * TABLES_CFFT_Q15_RAM / 2U];
+#define TABLES_LEN    (2U * TABLES_CFFT_Q15_RAM)
+#define TABLES_INIT() arm_cfft_init_twiddle_q15(&S, TABLES_CFFT_Q15_RAM, twiddle)
+#define TABLES_RUN()  arm_cfft_q15(&S, data, 0U, 1U)
+
+#elif defined (TABLES_RFFT_FAST_F32)
+static arm_rfft_fast_instance_f32 S;
+static float32_t data[TABLES_RFFT_FAST_F32];
+static float32_t out[TABLES_RFFT_FAST_F32];
+#define TABLES_LEN    TABLES_RFFT_FAST_F32
+#define TABLES_INIT() arm_rfft_fast_init_f32(&S, TABLES_RFFT_FAST_F32)
+#define TABLES_RUN()  arm_rfft_fast_f32(&S, data, out, 0U)
+
+#elif defined (TABLES_RFFT_FAST_F32_RAM)
+static arm_rfft_fast_instance_f32 S;
+static float32_t data[TABLES_RFFT_FAST_F32_RAM];
+static float32_t out[TABLES_RFFT_FAST_F32_RAM];
+static float32_t twiddle[2U * TABLES_RFFT_FAST_F32_RAM];
+#define TABLES_LEN    TABLES_RFFT_FAST_F32_RAM
+#define TABLES_INIT() arm_rfft_fast_init_twiddle_f32(&S, TABLES_RFFT_FAST_F32_RAM, twiddle)
+#define TABLES_RUN()  arm_rfft_fast_f32(&S, data, out, 0U)
+
+#elif defined (TABLES_RFFT_FAST_Q15)
+static arm_rfft_fast_instance_q15 S;
+static q15_t data[TABLES_RFFT_FAST_Q15];
+#define TABLES_LEN    TABLES_RFFT_FAST_Q15
+#define TABLES_INIT() arm_rfft_fast_init_q15(&S, TABLES_RFFT_FAST_Q15)
+#define TABLES_RUN()  arm_rfft_fast_q15(&S, data, data, 0U)
+
+#endif
+
+int main(void)
+{
+#if defined (TABLES_LEN)
+  struct timespec t0, t1;
+  uint32_t i;
+
+  for (i = 0U; i < TABLES_LEN; i++)
+  {
+    data[i] = (i & 8U) ? 1 : -1;
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  for (i = 0U; i < TABLES_INITS; i++)
+  {
+    if (TABLES_INIT() != ARM_MATH_SUCCESS)
+    {
+      printf("init failed\n");
+      return (1);
+    }
+  }
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+
+  TABLES_RUN();
+
+  printf("%.0f\n", ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / TABLES_INITS);
+#else
+  printf("-\n");
+#endif
+
+  return (0);
+}
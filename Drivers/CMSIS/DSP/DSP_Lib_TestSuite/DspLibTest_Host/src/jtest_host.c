@@ -0,0 +1,123 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        jtest_host.c
+ * Description:  JTEST actions and cycle counter of the host build: the
+ *               output the Keil debugger scripts (jtest_fns.ini) produce on
+ *               target is printed directly
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Host (ARM_MATH_HOST)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <time.h>
+#if defined (__x86_64__) || defined (__i386__)
+#include <x86intrin.h>
+#endif
+#include "jtest_fw.h"
+#include "jtest_systick.h"
+
+uint32_t jtest_host_systick_start = 0;
+
+static void ban_line_thick(void)
+{
+    printf("==================================================\n");
+}
+
+static void ban_line_thin(void)
+{
+    printf("--------------------------------------------------\n");
+}
+
+static void ban_msg(const char * msg)
+{
+    ban_line_thick();
+    printf("%s\n", msg);
+    ban_line_thick();
+}
+
+/**
+ *  Host cycle counter: time stamp counter on x86, nanoseconds elsewhere.
+ */
+uint32_t jtest_host_cycles(void)
+{
+#if defined (__x86_64__) || defined (__i386__)
+    return (uint32_t) __rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t) ((uint64_t) ts.tv_sec * 1000000000U + (uint64_t) ts.tv_nsec);
+#endif
+}
+
+void test_start(void)
+{
+    JTEST_FW.test_start++;
+    ban_msg("Start: Test");
+}
+
+void test_end(void)
+{
+    JTEST_FW.test_end++;
+    ban_msg("End: Test");
+}
+
+void group_start(void)
+{
+    JTEST_FW.group_start++;
+    ban_msg("Start: Group");
+}
+
+void group_end(void)
+{
+    JTEST_FW.group_end++;
+    ban_msg("End: Group");
+}
+
+void dump_str(void)
+{
+    /* jtest_dump_str_segments() calls the action once per segment */
+    JTEST_FW.dump_str++;
+    printf("%.*s", JTEST_STR_MAX_OUTPUT_SIZE, JTEST_FW.str_buffer);
+}
+
+void dump_data(void)
+{
+    JTEST_FW.dump_data++;
+    ban_line_thin();
+    printf("Start Dump: Data\n");
+    ban_line_thin();
+    printf("%.*s\n", JTEST_BUF_SIZE, JTEST_FW.data_buffer);
+    ban_line_thin();
+    printf("End Dump: Data\n");
+    ban_line_thin();
+}
+
+void exit_fw(void)
+{
+    JTEST_FW.exit_fw++;
+    ban_line_thick();
+    printf("Tests passed: %u, failed: %u\n",
+           (unsigned int) JTEST_FW.passed, (unsigned int) JTEST_FW.failed);
+    ban_line_thick();
+    fflush(stdout);
+}
@@ -927,6 +927,26 @@ void ref_fir_interpolate_q15(
   const arm_fir_interpolate_instance_q15 * S,
   q15_t * pSrc,
   q15_t * pDst,
+  uint32_t blockSize);
+
+/* Output samples of blockSize input samples from a cleared state: the state of
+ * S is not used. Returns the number of output samples. */
+uint32_t ref_fir_resample_f32(
+  const arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+uint32_t ref_fir_resample_q31(
+  const arm_fir_resample_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+uint32_t ref_fir_resample_q15(
+  const arm_fir_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
   uint32_t blockSize);
 
 	/*
@@ -955,6 +975,54 @@ arm_status ref_mat_inverse_f64(
   const arm_matrix_instance_f64 * pSrc,
   arm_matrix_instance_f64 * pDst);
 
+arm_status ref_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst);
+
+arm_status ref_mat_cholesky_solve_f32(
+  const arm_matrix_instance_f32 * pL,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX);
+
+arm_status ref_mat_cholesky_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst);
+
+arm_status ref_mat_cholesky_solve_f64(
+  const arm_matrix_instance_f64 * pL,
+  const arm_matrix_instance_f64 * pB,
+  arm_matrix_instance_f64 * pX);
+
+arm_status ref_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst);
+
+arm_status ref_mat_ldlt_solve_f32(
+  const arm_matrix_instance_f32 * pLD,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX);
+
+arm_status ref_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pLT,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX);
+
+arm_status ref_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * pUT,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX);
+
+arm_status ref_mat_qr_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst,
+  float32_t * pTau);
+
+arm_status ref_mat_qr_solve_f32(
+  const arm_matrix_instance_f32 * pQR,
+  const float32_t * pTau,
+  arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX);
+
 arm_status ref_mat_mult_f32(
   const arm_matrix_instance_f32 * pSrcA,
   const arm_matrix_instance_f32 * pSrcB,
@@ -976,6 +1044,36 @@ arm_status ref_mat_mult_q15(
 /* Alias for testing purposes*/
 #define ref_mat_mult_fast_q15 ref_mat_mult_q15
 
+arm_status ref_mat_mult_bt_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcBT,
+  arm_matrix_instance_f32 * pDst);
+
+arm_status ref_mat_mult_bt_q31(
+  const arm_matrix_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcBT,
+  arm_matrix_instance_q31 * pDst);
+
+arm_status ref_mat_mult_bt_q15(
+  const arm_matrix_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcBT,
+  arm_matrix_instance_q15 * pDst);
+
+void ref_mat_vec_mult_f32(
+  const arm_matrix_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+  float32_t * pDst);
+
+void ref_mat_vec_mult_q31(
+  const arm_matrix_instance_q31 * pSrcMat,
+  const q31_t * pVec,
+  q31_t * pDst);
+
+void ref_mat_vec_mult_q15(
+  const arm_matrix_instance_q15 * pSrcMat,
+  const q15_t * pVec,
+  q15_t * pDst);
+
 arm_status ref_mat_scale_f32(
   const arm_matrix_instance_f32 * pSrc,
   float32_t scale,
@@ -1304,6 +1402,50 @@ void ref_cfft_q15(
     uint8_t ifftFlag,
     uint8_t bitReverseFlag);
 
+void ref_cfft_mixed_f32(
+	const arm_cfft_mixed_instance_f32 * S,
+	float32_t * p1,
+	uint8_t ifftFlag);
+
+uint32_t ref_goertzel_f32(
+	const arm_goertzel_instance_f32 * S,
+	const uint16_t * pBins,
+	float32_t * pSrc,
+	float32_t * pDst,
+	uint32_t blockSize);
+
+uint32_t ref_goertzel_q31(
+	const arm_goertzel_instance_q31 * S,
+	const uint16_t * pBins,
+	q31_t * pSrc,
+	q31_t * pDst,
+	uint32_t blockSize);
+
+uint32_t ref_goertzel_q15(
+	const arm_goertzel_instance_q15 * S,
+	const uint16_t * pBins,
+	q15_t * pSrc,
+	q15_t * pDst,
+	uint32_t blockSize);
+
+void ref_sdft_f32(
+	const arm_sdft_instance_f32 * S,
+	float32_t * pSrc,
+	float32_t * pDst,
+	uint32_t blockSize);
+
+void ref_sdft_q31(
+	const arm_sdft_instance_q31 * S,
+	q31_t * pSrc,
+	q31_t * pDst,
+	uint32_t blockSize);
+
+void ref_sdft_q15(
+	const arm_sdft_instance_q15 * S,
+	q15_t * pSrc,
+	q15_t * pDst,
+	uint32_t blockSize);
+
 void ref_cfft_radix2_f32(
 	const arm_cfft_radix2_instance_f32 * S,
 	float32_t * pSrc);
@@ -1338,6 +1480,17 @@ void ref_rfft_fast_f32(
 	float32_t * p, float32_t * pOut,
 	uint8_t ifftFlag);
 
+void ref_rfft_mixed_f32(
+	const arm_rfft_mixed_instance_f32 * S,
+	float32_t * p, float32_t * pOut,
+	uint8_t ifftFlag);
+
+uint32_t ref_stft_f32(
+	const arm_stft_instance_f32 * S,
+	float32_t * pSrc,
+	float32_t * pDst,
+	uint32_t blockSize);
+
 void ref_rfft_q31(
   const arm_rfft_instance_q31 * S,
   q31_t * pSrc,
@@ -1348,6 +1501,18 @@ void ref_rfft_q15(
   q15_t * pSrc,
   q15_t * pDst);
 
+void ref_rfft_fast_q31(
+  const arm_rfft_fast_instance_q31 * S,
+  q31_t * p,
+  q31_t * pOut,
+  uint8_t ifftFlag);
+
+void ref_rfft_fast_q15(
+  const arm_rfft_fast_instance_q15 * S,
+  q15_t * p,
+  q15_t * pOut,
+  uint8_t ifftFlag);
+
 void ref_dct4_f32(
   const arm_dct4_instance_f32 * S,
   float32_t * pState,
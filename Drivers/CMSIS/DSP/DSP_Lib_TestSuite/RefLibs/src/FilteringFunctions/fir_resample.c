@@ -0,0 +1,98 @@
+#include "ref.h"
+
+/*
+ * Direct form of the rational resampler: the output sample m is the upsampled
+ * sample m*M+M-1 of the FIR interpolator, that is the polyphase component p of
+ * the input samples up to n, with n*L+p = m*M+M-1.
+ */
+
+uint32_t ref_fir_resample_f32(
+  const arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t L = S->L, M = S->M, phaseLen = S->phaseLength;
+  uint32_t m, n, p, k;
+  uint64_t t;
+  float32_t sum;
+
+  for (m = 0U, t = M - 1U; t < (uint64_t) blockSize * L; m++, t += M)
+  {
+    n = (uint32_t) (t / L);
+    p = (uint32_t) (t % L);
+    sum = 0.0f;
+
+    /* Oldest input sample first, coefficients in time reversed order */
+    for (k = 0U; k < phaseLen; k++)
+    {
+      if (n + k + 1U >= phaseLen)
+      {
+        sum += pSrc[n + k + 1U - phaseLen] * S->pCoeffs[(L - 1U - p) + k * L];
+      }
+    }
+    pDst[m] = sum;
+  }
+
+  return m;
+}
+
+uint32_t ref_fir_resample_q31(
+  const arm_fir_resample_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t L = S->L, M = S->M, phaseLen = S->phaseLength;
+  uint32_t m, n, p, k;
+  uint64_t t;
+  q63_t sum;
+
+  for (m = 0U, t = M - 1U; t < (uint64_t) blockSize * L; m++, t += M)
+  {
+    n = (uint32_t) (t / L);
+    p = (uint32_t) (t % L);
+    sum = 0;
+
+    for (k = 0U; k < phaseLen; k++)
+    {
+      if (n + k + 1U >= phaseLen)
+      {
+        sum += (q63_t) pSrc[n + k + 1U - phaseLen] * S->pCoeffs[(L - 1U - p) + k * L];
+      }
+    }
+    pDst[m] = ref_sat_q31(sum >> 31);
+  }
+
+  return m;
+}
+
+uint32_t ref_fir_resample_q15(
+  const arm_fir_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t L = S->L, M = S->M, phaseLen = S->phaseLength;
+  uint32_t m, n, p, k;
+  uint64_t t;
+  q63_t sum;
+
+  for (m = 0U, t = M - 1U; t < (uint64_t) blockSize * L; m++, t += M)
+  {
+    n = (uint32_t) (t / L);
+    p = (uint32_t) (t % L);
+    sum = 0;
+
+    for (k = 0U; k < phaseLen; k++)
+    {
+      if (n + k + 1U >= phaseLen)
+      {
+        sum += (q31_t) pSrc[n + k + 1U - phaseLen] * S->pCoeffs[(L - 1U - p) + k * L];
+      }
+    }
+    pDst[m] = ref_sat_q15((q31_t) (sum >> 15));
+  }
+
+  return m;
+}
@@ -0,0 +1,301 @@
+#include "ref.h"
+
+arm_status ref_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+	uint32_t i,j,k,n;
+	float32_t sum;
+	float32_t *a = pSrc->pData;
+	float32_t *l = pDst->pData;
+	
+	n = pSrc->numRows;
+	
+	/* Column by column */
+	for(j=0;j<n;j++)
+	{
+		sum = a[j*n + j];
+		
+		for(k=0;k<j;k++)
+		{
+			sum -= l[j*n + k] * l[j*n + k];
+		}
+		
+		if(sum <= 0)
+		{
+			return ARM_MATH_DECOMPOSITION_FAILURE;
+		}
+		
+		l[j*n + j] = sqrtf(sum);
+		
+		for(i=j+1;i<n;i++)
+		{
+			sum = a[i*n + j];
+			
+			for(k=0;k<j;k++)
+			{
+				sum -= l[i*n + k] * l[j*n + k];
+			}
+			
+			l[i*n + j] = sum / l[j*n + j];
+		}
+	}
+	
+	for(i=0;i<n;i++)
+	{
+		for(j=i+1;j<n;j++)
+		{
+			l[i*n + j] = 0;
+		}
+	}
+	
+	return ARM_MATH_SUCCESS;
+}
+
+arm_status ref_mat_cholesky_solve_f32(
+  const arm_matrix_instance_f32 * pL,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX)
+{
+	int32_t i,k,n,c,nc;
+	float32_t sum;
+	float32_t *l = pL->pData;
+	float32_t *b = pB->pData;
+	float32_t *x = pX->pData;
+	
+	n = pL->numRows;
+	nc = pB->numCols;
+	
+	for(c=0;c<nc;c++)
+	{
+		/* L * y = b */
+		for(i=0;i<n;i++)
+		{
+			sum = b[i*nc + c];
+			
+			for(k=0;k<i;k++)
+			{
+				sum -= l[i*n + k] * x[k*nc + c];
+			}
+			
+			x[i*nc + c] = sum / l[i*n + i];
+		}
+		
+		/* L' * x = y */
+		for(i=n-1;i>=0;i--)
+		{
+			sum = x[i*nc + c];
+			
+			for(k=i+1;k<n;k++)
+			{
+				sum -= l[k*n + i] * x[k*nc + c];
+			}
+			
+			x[i*nc + c] = sum / l[i*n + i];
+		}
+	}
+	
+	return ARM_MATH_SUCCESS;
+}
+
+arm_status ref_mat_cholesky_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst)
+{
+	uint32_t i,j,k,n;
+	float64_t sum;
+	float64_t *a = pSrc->pData;
+	float64_t *l = pDst->pData;
+	
+	n = pSrc->numRows;
+	
+	/* Column by column */
+	for(j=0;j<n;j++)
+	{
+		sum = a[j*n + j];
+		
+		for(k=0;k<j;k++)
+		{
+			sum -= l[j*n + k] * l[j*n + k];
+		}
+		
+		if(sum <= 0)
+		{
+			return ARM_MATH_DECOMPOSITION_FAILURE;
+		}
+		
+		l[j*n + j] = sqrt(sum);
+		
+		for(i=j+1;i<n;i++)
+		{
+			sum = a[i*n + j];
+			
+			for(k=0;k<j;k++)
+			{
+				sum -= l[i*n + k] * l[j*n + k];
+			}
+			
+			l[i*n + j] = sum / l[j*n + j];
+		}
+	}
+	
+	for(i=0;i<n;i++)
+	{
+		for(j=i+1;j<n;j++)
+		{
+			l[i*n + j] = 0;
+		}
+	}
+	
+	return ARM_MATH_SUCCESS;
+}
+
+arm_status ref_mat_cholesky_solve_f64(
+  const arm_matrix_instance_f64 * pL,
+  const arm_matrix_instance_f64 * pB,
+  arm_matrix_instance_f64 * pX)
+{
+	int32_t i,k,n,c,nc;
+	float64_t sum;
+	float64_t *l = pL->pData;
+	float64_t *b = pB->pData;
+	float64_t *x = pX->pData;
+	
+	n = pL->numRows;
+	nc = pB->numCols;
+	
+	for(c=0;c<nc;c++)
+	{
+		/* L * y = b */
+		for(i=0;i<n;i++)
+		{
+			sum = b[i*nc + c];
+			
+			for(k=0;k<i;k++)
+			{
+				sum -= l[i*n + k] * x[k*nc + c];
+			}
+			
+			x[i*nc + c] = sum / l[i*n + i];
+		}
+		
+		/* L' * x = y */
+		for(i=n-1;i>=0;i--)
+		{
+			sum = x[i*nc + c];
+			
+			for(k=i+1;k<n;k++)
+			{
+				sum -= l[k*n + i] * x[k*nc + c];
+			}
+			
+			x[i*nc + c] = sum / l[i*n + i];
+		}
+	}
+	
+	return ARM_MATH_SUCCESS;
+}
+
+arm_status ref_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+	uint32_t i,j,k,n;
+	float32_t sum;
+	float32_t *a = pSrc->pData;
+	float32_t *l = pDst->pData;
+	
+	n = pSrc->numRows;
+	
+	/* Column by column: d(j), then the column j of L */
+	for(j=0;j<n;j++)
+	{
+		sum = a[j*n + j];
+		
+		for(k=0;k<j;k++)
+		{
+			sum -= l[j*n + k] * l[k*n + k] * l[j*n + k];
+		}
+		
+		if(sum == 0)
+		{
+			return ARM_MATH_DECOMPOSITION_FAILURE;
+		}
+		
+		l[j*n + j] = sum;
+		
+		for(i=j+1;i<n;i++)
+		{
+			sum = a[i*n + j];
+			
+			for(k=0;k<j;k++)
+			{
+				sum -= l[i*n + k] * l[k*n + k] * l[j*n + k];
+			}
+			
+			l[i*n + j] = sum / l[j*n + j];
+		}
+	}
+	
+	for(i=0;i<n;i++)
+	{
+		for(j=i+1;j<n;j++)
+		{
+			l[i*n + j] = 0;
+		}
+	}
+	
+	return ARM_MATH_SUCCESS;
+}
+
+arm_status ref_mat_ldlt_solve_f32(
+  const arm_matrix_instance_f32 * pLD,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX)
+{
+	int32_t i,k,n,c,nc;
+	float32_t sum;
+	float32_t *l = pLD->pData;
+	float32_t *b = pB->pData;
+	float32_t *x = pX->pData;
+	
+	n = pLD->numRows;
+	nc = pB->numCols;
+	
+	for(c=0;c<nc;c++)
+	{
+		/* L * y = b, unit diagonal */
+		for(i=0;i<n;i++)
+		{
+			sum = b[i*nc + c];
+			
+			for(k=0;k<i;k++)
+			{
+				sum -= l[i*n + k] * x[k*nc + c];
+			}
+			
+			x[i*nc + c] = sum;
+		}
+		
+		/* D * z = y */
+		for(i=0;i<n;i++)
+		{
+			x[i*nc + c] /= l[i*n + i];
+		}
+		
+		/* L' * x = z */
+		for(i=n-1;i>=0;i--)
+		{
+			sum = x[i*nc + c];
+			
+			for(k=i+1;k<n;k++)
+			{
+				sum -= l[k*n + i] * x[k*nc + c];
+			}
+			
+			x[i*nc + c] = sum;
+		}
+	}
+	
+	return ARM_MATH_SUCCESS;
+}
@@ -0,0 +1,133 @@
+#include "ref.h"
+
+arm_status ref_mat_qr_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst,
+  float32_t * pTau)
+{
+	uint32_t i,j,k,m,n;
+	float32_t norm,alpha,beta,dot;
+	float32_t *a = pDst->pData;
+	
+	m = pSrc->numRows;
+	n = pSrc->numCols;
+	
+	for(i=0;i<m*n;i++)
+	{
+		a[i] = pSrc->pData[i];
+	}
+	
+	for(j=0;j<n;j++)
+	{
+		norm = 0;
+		
+		for(i=j+1;i<m;i++)
+		{
+			norm += a[i*n + j] * a[i*n + j];
+		}
+		
+		if(norm == 0)
+		{
+			pTau[j] = 0;
+			continue;
+		}
+		
+		alpha = a[j*n + j];
+		beta = sqrtf(alpha * alpha + norm);
+		
+		if(alpha >= 0)
+		{
+			beta = -beta;
+		}
+		
+		pTau[j] = (beta - alpha) / beta;
+		
+		/* v = x / (alpha - beta), v(j) = 1 */
+		for(i=j+1;i<m;i++)
+		{
+			a[i*n + j] = a[i*n + j] / (alpha - beta);
+		}
+		
+		a[j*n + j] = beta;
+		
+		for(k=j+1;k<n;k++)
+		{
+			dot = a[j*n + k];
+			
+			for(i=j+1;i<m;i++)
+			{
+				dot += a[i*n + j] * a[i*n + k];
+			}
+			
+			a[j*n + k] -= pTau[j] * dot;
+			
+			for(i=j+1;i<m;i++)
+			{
+				a[i*n + k] -= pTau[j] * dot * a[i*n + j];
+			}
+		}
+	}
+	
+	return ARM_MATH_SUCCESS;
+}
+
+arm_status ref_mat_qr_solve_f32(
+  const arm_matrix_instance_f32 * pQR,
+  const float32_t * pTau,
+  arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX)
+{
+	int32_t i,j,k,m,n,c,nc;
+	float32_t dot;
+	float32_t *a = pQR->pData;
+	float32_t *b = pB->pData;
+	float32_t *x = pX->pData;
+	
+	m = pQR->numRows;
+	n = pQR->numCols;
+	nc = pB->numCols;
+	
+	for(j=0;j<n;j++)
+	{
+		if(a[j*n + j] == 0)
+		{
+			return ARM_MATH_SINGULAR;
+		}
+	}
+	
+	for(c=0;c<nc;c++)
+	{
+		/* b = Q' * b */
+		for(j=0;j<n;j++)
+		{
+			dot = b[j*nc + c];
+			
+			for(i=j+1;i<m;i++)
+			{
+				dot += a[i*n + j] * b[i*nc + c];
+			}
+			
+			b[j*nc + c] -= pTau[j] * dot;
+			
+			for(i=j+1;i<m;i++)
+			{
+				b[i*nc + c] -= pTau[j] * dot * a[i*n + j];
+			}
+		}
+		
+		/* R * x = b */
+		for(j=n-1;j>=0;j--)
+		{
+			dot = b[j*nc + c];
+			
+			for(k=j+1;k<n;k++)
+			{
+				dot -= a[j*n + k] * x[k*nc + c];
+			}
+			
+			x[j*nc + c] = dot / a[j*n + j];
+		}
+	}
+	
+	return ARM_MATH_SUCCESS;
+}
@@ -0,0 +1,81 @@
+#include "ref.h"
+
+arm_status ref_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pLT,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX)
+{
+	int32_t i,k,n,c,nc;
+	float32_t sum;
+	float32_t *t = pLT->pData;
+	float32_t *b = pB->pData;
+	float32_t *x = pX->pData;
+	
+	n = pLT->numRows;
+	nc = pB->numCols;
+	
+	for(i=0;i<n;i++)
+	{
+		if(t[i*n + i] == 0)
+		{
+			return ARM_MATH_SINGULAR;
+		}
+	}
+	
+	for(c=0;c<nc;c++)
+	{
+		for(i=0;i<n;i++)
+		{
+			sum = b[i*nc + c];
+			
+			for(k=0;k<i;k++)
+			{
+				sum -= t[i*n + k] * x[k*nc + c];
+			}
+			
+			x[i*nc + c] = sum / t[i*n + i];
+		}
+	}
+	
+	return ARM_MATH_SUCCESS;
+}
+
+arm_status ref_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * pUT,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX)
+{
+	int32_t i,k,n,c,nc;
+	float32_t sum;
+	float32_t *t = pUT->pData;
+	float32_t *b = pB->pData;
+	float32_t *x = pX->pData;
+	
+	n = pUT->numRows;
+	nc = pB->numCols;
+	
+	for(i=0;i<n;i++)
+	{
+		if(t[i*n + i] == 0)
+		{
+			return ARM_MATH_SINGULAR;
+		}
+	}
+	
+	for(c=0;c<nc;c++)
+	{
+		for(i=n-1;i>=0;i--)
+		{
+			sum = b[i*nc + c];
+			
+			for(k=i+1;k<n;k++)
+			{
+				sum -= t[i*n + k] * x[k*nc + c];
+			}
+			
+			x[i*nc + c] = sum / t[i*n + i];
+		}
+	}
+	
+	return ARM_MATH_SUCCESS;
+}
@@ -0,0 +1,73 @@
+#include "ref.h"
+
+void ref_mat_vec_mult_f32(
+  const arm_matrix_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+  float32_t * pDst)
+{
+	uint32_t r,i,numRows,numCols;
+	float32_t sum;
+	
+	numRows = pSrcMat->numRows;
+	numCols = pSrcMat->numCols;
+	
+	for(r=0;r<numRows;r++)
+	{
+		sum = 0;
+		
+		for(i=0;i<numCols;i++)
+		{
+			sum += pSrcMat->pData[r*numCols + i] * pVec[i];
+		}
+		
+		pDst[r] = sum;
+	}
+}
+
+void ref_mat_vec_mult_q31(
+  const arm_matrix_instance_q31 * pSrcMat,
+  const q31_t * pVec,
+  q31_t * pDst)
+{
+	uint32_t r,i,numRows,numCols;
+	q63_t sum;
+	
+	numRows = pSrcMat->numRows;
+	numCols = pSrcMat->numCols;
+	
+	for(r=0;r<numRows;r++)
+	{
+		sum = 0;
+		
+		for(i=0;i<numCols;i++)
+		{
+			sum += (q63_t)(pSrcMat->pData[r*numCols + i]) * pVec[i];
+		}
+		
+		pDst[r] = ref_sat_q31(sum >> 31);
+	}
+}
+
+void ref_mat_vec_mult_q15(
+  const arm_matrix_instance_q15 * pSrcMat,
+  const q15_t * pVec,
+  q15_t * pDst)
+{
+	uint32_t r,i,numRows,numCols;
+	q63_t sum;
+	
+	numRows = pSrcMat->numRows;
+	numCols = pSrcMat->numCols;
+	
+	for(r=0;r<numRows;r++)
+	{
+		sum = 0;
+		
+		for(i=0;i<numCols;i++)
+		{
+			sum += (q31_t)(pSrcMat->pData[r*numCols + i]) * pVec[i];
+		}
+		
+		pDst[r] = ref_sat_q15(sum >> 15);
+	}
+}
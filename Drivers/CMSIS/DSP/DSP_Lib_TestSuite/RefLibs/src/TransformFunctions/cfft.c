@@ -596,3 +596,249 @@ void ref_cfft_radix4_q15(
 		}
 	}
 }
+
+/* Direct DFT, in double precision, of up to 4096 points */
+static double ref_dft_twiddle[2 * 4096];
+static float32_t ref_dft_output[2 * 4096];
+
+void ref_cfft_mixed_f32(
+	const arm_cfft_mixed_instance_f32 * S,
+	float32_t * p1,
+	uint8_t ifftFlag)
+{
+	uint32_t N = S->fftLen;
+	uint32_t n, k, idx;
+	double sumr, sumi, wr, wi;
+	double dir = (ifftFlag) ? 1.0 : -1.0;
+
+	for (n = 0; n < N; n++)
+	{
+		ref_dft_twiddle[2*n]   = cos(6.283185307179586476925 * n / N);
+		ref_dft_twiddle[2*n+1] = dir * sin(6.283185307179586476925 * n / N);
+	}
+
+	for (k = 0; k < N; k++)
+	{
+		sumr = 0.0;
+		sumi = 0.0;
+		idx = 0;
+		for (n = 0; n < N; n++)
+		{
+			wr = ref_dft_twiddle[2*idx];
+			wi = ref_dft_twiddle[2*idx+1];
+			sumr += p1[2*n] * wr - p1[2*n+1] * wi;
+			sumi += p1[2*n] * wi + p1[2*n+1] * wr;
+			idx += k;
+			if (idx >= N)
+			{
+				idx -= N;
+			}
+		}
+
+		// Inverse transform is scaled by 1/N
+		if (ifftFlag)
+		{
+			sumr /= N;
+			sumi /= N;
+		}
+		ref_dft_output[2*k]   = (float32_t)sumr;
+		ref_dft_output[2*k+1] = (float32_t)sumi;
+	}
+
+	for (n = 0; n < 2*N; n++)
+	{
+		p1[n] = ref_dft_output[n];
+	}
+}
+
+/*
+ * Bins of the N points DFT of x[0] .. x[N-1], in double precision. The output
+ * is scaled by 1/N when scale is not 0, as the fixed-point functions do
+ */
+static double ref_dft_bins_input[4096];
+static double ref_dft_bins_output[2 * 256];
+
+static void ref_dft_bins(
+	uint32_t N,
+	const uint16_t * pBins,
+	uint32_t numBins,
+	uint32_t scale,
+	double * pOut)
+{
+	uint32_t b, n, idx;
+	double sumr, sumi;
+
+	for (b = 0; b < numBins; b++)
+	{
+		sumr = 0.0;
+		sumi = 0.0;
+		idx = 0;
+		for (n = 0; n < N; n++)
+		{
+			sumr += ref_dft_bins_input[n] * cos(6.283185307179586476925 * idx / N);
+			sumi -= ref_dft_bins_input[n] * sin(6.283185307179586476925 * idx / N);
+			idx += pBins[b];
+			if (idx >= N)
+			{
+				idx -= N;
+			}
+		}
+
+		if (scale)
+		{
+			sumr /= N;
+			sumi /= N;
+		}
+		pOut[2*b]   = sumr;
+		pOut[2*b+1] = sumi;
+	}
+}
+
+/* DFT of each block of N samples, the bins being the ones of the coefficients */
+uint32_t ref_goertzel_f32(
+	const arm_goertzel_instance_f32 * S,
+	const uint16_t * pBins,
+	float32_t * pSrc,
+	float32_t * pDst,
+	uint32_t blockSize)
+{
+	uint32_t N = S->blockLen;
+	uint32_t numBlocks = blockSize / N;
+	uint32_t m, n;
+
+	for (m = 0; m < numBlocks; m++)
+	{
+		for (n = 0; n < N; n++)
+		{
+			ref_dft_bins_input[n] = pSrc[m * N + n];
+		}
+		ref_dft_bins(N, pBins, S->numBins, 0, ref_dft_bins_output);
+		for (n = 0; n < 2 * S->numBins; n++)
+		{
+			*pDst++ = (float32_t)ref_dft_bins_output[n];
+		}
+	}
+
+	return numBlocks;
+}
+
+uint32_t ref_goertzel_q31(
+	const arm_goertzel_instance_q31 * S,
+	const uint16_t * pBins,
+	q31_t * pSrc,
+	q31_t * pDst,
+	uint32_t blockSize)
+{
+	uint32_t N = S->blockLen;
+	uint32_t numBlocks = blockSize / N;
+	uint32_t m, n;
+
+	for (m = 0; m < numBlocks; m++)
+	{
+		for (n = 0; n < N; n++)
+		{
+			ref_dft_bins_input[n] = pSrc[m * N + n] / 2147483648.0;
+		}
+		ref_dft_bins(N, pBins, S->numBins, 1, ref_dft_bins_output);
+		for (n = 0; n < 2 * S->numBins; n++)
+		{
+			*pDst++ = ref_sat_q31((q63_t)(ref_dft_bins_output[n] * 2147483648.0));
+		}
+	}
+
+	return numBlocks;
+}
+
+uint32_t ref_goertzel_q15(
+	const arm_goertzel_instance_q15 * S,
+	const uint16_t * pBins,
+	q15_t * pSrc,
+	q15_t * pDst,
+	uint32_t blockSize)
+{
+	uint32_t N = S->blockLen;
+	uint32_t numBlocks = blockSize / N;
+	uint32_t m, n;
+
+	for (m = 0; m < numBlocks; m++)
+	{
+		for (n = 0; n < N; n++)
+		{
+			ref_dft_bins_input[n] = pSrc[m * N + n] / 32768.0;
+		}
+		ref_dft_bins(N, pBins, S->numBins, 1, ref_dft_bins_output);
+		for (n = 0; n < 2 * S->numBins; n++)
+		{
+			*pDst++ = ref_sat_q15((q31_t)(ref_dft_bins_output[n] * 32768.0));
+		}
+	}
+
+	return numBlocks;
+}
+
+/* DFT of the last N samples, the samples before the first one being zeros */
+void ref_sdft_f32(
+	const arm_sdft_instance_f32 * S,
+	float32_t * pSrc,
+	float32_t * pDst,
+	uint32_t blockSize)
+{
+	uint32_t N = S->fftLen;
+	int32_t t;
+	uint32_t n;
+
+	for (n = 0; n < N; n++)
+	{
+		t = (int32_t)blockSize - (int32_t)N + (int32_t)n;
+		ref_dft_bins_input[n] = (t >= 0) ? pSrc[t] : 0.0;
+	}
+	ref_dft_bins(N, S->pBins, S->numBins, 0, ref_dft_bins_output);
+	for (n = 0; n < 2 * S->numBins; n++)
+	{
+		pDst[n] = (float32_t)ref_dft_bins_output[n];
+	}
+}
+
+void ref_sdft_q31(
+	const arm_sdft_instance_q31 * S,
+	q31_t * pSrc,
+	q31_t * pDst,
+	uint32_t blockSize)
+{
+	uint32_t N = S->fftLen;
+	int32_t t;
+	uint32_t n;
+
+	for (n = 0; n < N; n++)
+	{
+		t = (int32_t)blockSize - (int32_t)N + (int32_t)n;
+		ref_dft_bins_input[n] = (t >= 0) ? pSrc[t] / 2147483648.0 : 0.0;
+	}
+	ref_dft_bins(N, S->pBins, S->numBins, 1, ref_dft_bins_output);
+	for (n = 0; n < 2 * S->numBins; n++)
+	{
+		pDst[n] = ref_sat_q31((q63_t)(ref_dft_bins_output[n] * 2147483648.0));
+	}
+}
+
+void ref_sdft_q15(
+	const arm_sdft_instance_q15 * S,
+	q15_t * pSrc,
+	q15_t * pDst,
+	uint32_t blockSize)
+{
+	uint32_t N = S->fftLen;
+	int32_t t;
+	uint32_t n;
+
+	for (n = 0; n < N; n++)
+	{
+		t = (int32_t)blockSize - (int32_t)N + (int32_t)n;
+		ref_dft_bins_input[n] = (t >= 0) ? pSrc[t] / 32768.0 : 0.0;
+	}
+	ref_dft_bins(N, S->pBins, S->numBins, 1, ref_dft_bins_output);
+	for (n = 0; n < 2 * S->numBins; n++)
+	{
+		pDst[n] = ref_sat_q15((q31_t)(ref_dft_bins_output[n] * 32768.0));
+	}
+}
@@ -300,3 +300,215 @@ void ref_rfft_q15(
 		}
 	}
 }
+
+/* The fixed-point fast RFFT references run the floating-point one on the
+ * converted input: fftLen real samples or fftLen packed spectrum values */
+static float32_t ref_rfft_fast_input[4096];
+
+void ref_rfft_fast_q31(
+  const arm_rfft_fast_instance_q31 * S,
+  q31_t * p,
+  q31_t * pOut,
+  uint8_t ifftFlag)
+{
+	uint32_t i;
+	float32_t *fOut = (float32_t*)pOut;
+	arm_rfft_fast_instance_f32 Sf;
+	
+	Sf.fftLenRFFT = S->fftLenRFFT;
+	
+	for(i=0;i<S->fftLenRFFT;i++)
+	{
+		ref_rfft_fast_input[i] = (float32_t)p[i] / 2147483648.0f;
+	}
+	
+	ref_rfft_fast_f32(&Sf, ref_rfft_fast_input, fOut, ifftFlag);
+	
+	for(i=0;i<S->fftLenRFFT;i++)
+	{
+		if (ifftFlag)
+		{
+			pOut[i] = ref_sat_q31((q63_t)(fOut[i] * 2147483648.0f));
+		}
+		else
+		{
+			//scale down by the FFT length, as arm_rfft_q31
+			pOut[i] = (q31_t)(fOut[i] * 2147483648.0f / (float32_t)S->fftLenRFFT);
+		}
+	}
+}
+
+void ref_rfft_fast_q15(
+  const arm_rfft_fast_instance_q15 * S,
+  q15_t * p,
+  q15_t * pOut,
+  uint8_t ifftFlag)
+{
+	uint32_t i;
+	float32_t *fOut = (float32_t*)pOut;
+	arm_rfft_fast_instance_f32 Sf;
+	
+	Sf.fftLenRFFT = S->fftLenRFFT;
+	
+	for(i=0;i<S->fftLenRFFT;i++)
+	{
+		ref_rfft_fast_input[i] = (float32_t)p[i] / 32768.0f;
+	}
+	
+	ref_rfft_fast_f32(&Sf, ref_rfft_fast_input, fOut, ifftFlag);
+	
+	for(i=0;i<S->fftLenRFFT;i++)
+	{
+		if (ifftFlag)
+		{
+			pOut[i] = ref_sat_q15((q31_t)(fOut[i] * 32768.0f));
+		}
+		else
+		{
+			//scale down by the FFT length, as arm_rfft_q15
+			pOut[i] = (q15_t)(fOut[i] * 32768.0f / (float32_t)S->fftLenRFFT);
+		}
+	}
+}
+
+/* Direct real DFT, in double precision, of up to 4096 points */
+static double ref_rdft_twiddle[2 * 4096];
+
+void ref_rfft_mixed_f32(
+	const arm_rfft_mixed_instance_f32 * S,
+	float32_t * p, float32_t * pOut,
+	uint8_t ifftFlag)
+{
+	uint32_t N = S->fftLenRFFT;
+	uint32_t n, k, idx;
+	double sumr, sumi;
+
+	for (n = 0; n < N; n++)
+	{
+		ref_rdft_twiddle[2*n]   = cos(6.283185307179586476925 * n / N);
+		ref_rdft_twiddle[2*n+1] = sin(6.283185307179586476925 * n / N);
+	}
+
+	if (ifftFlag)
+	{
+		//x[n] = (X[0] + (-1)^n X[N/2] + 2 Re(sum X[k] exp(j2pi kn/N), 0 < k < N/2)) / N
+		for (n = 0; n < N; n++)
+		{
+			sumr = p[0] + ((n & 1) ? -p[1] : p[1]);
+			idx = n;
+			for (k = 1; k < N/2; k++)
+			{
+				sumr += 2.0 * (p[2*k] * ref_rdft_twiddle[2*idx] - p[2*k+1] * ref_rdft_twiddle[2*idx+1]);
+				idx += n;
+				if (idx >= N)
+				{
+					idx -= N;
+				}
+			}
+			pOut[n] = (float32_t)(sumr / N);
+		}
+	}
+	else
+	{
+		//X[0] and X[N/2] packed in the first complex value
+		for (k = 0; k < N/2; k++)
+		{
+			sumr = 0.0;
+			sumi = 0.0;
+			idx = 0;
+			for (n = 0; n < N; n++)
+			{
+				sumr += p[n] * ref_rdft_twiddle[2*idx];
+				sumi -= p[n] * ref_rdft_twiddle[2*idx+1];
+				idx += k;
+				if (idx >= N)
+				{
+					idx -= N;
+				}
+			}
+			pOut[2*k]   = (float32_t)sumr;
+			pOut[2*k+1] = (float32_t)sumi;
+		}
+		sumr = 0.0;
+		for (n = 0; n < N; n++)
+		{
+			sumr += (n & 1) ? -p[n] : p[n];
+		}
+		pOut[1] = (float32_t)sumr;
+	}
+}
+
+/* STFT of a whole signal, the samples before it being zeros */
+static float32_t ref_stft_frame[4096];
+static float32_t ref_stft_spectrum[2 * 4096];
+
+uint32_t ref_stft_f32(
+	const arm_stft_instance_f32 * S,
+	float32_t * pSrc,
+	float32_t * pDst,
+	uint32_t blockSize)
+{
+	arm_rfft_fast_instance_f32 Sf;
+	uint32_t N = S->fftLen;
+	uint32_t numFrames = blockSize / S->hopSize;
+	uint32_t m, i;
+	int32_t t;
+	double re, im;
+
+	Sf.fftLenRFFT = N;
+
+	for (m = 0; m < numFrames; m++)
+	{
+		//frame m ends with sample (m+1)*hopSize - 1
+		for (i = 0; i < N; i++)
+		{
+			t = (int32_t)((m + 1) * S->hopSize) - (int32_t)N + (int32_t)i;
+			ref_stft_frame[i] = (t >= 0) ? pSrc[t] * S->pWindow[i] : 0.0f;
+		}
+
+		ref_rfft_fast_f32(&Sf, ref_stft_frame, ref_stft_spectrum, 0);
+
+		if (S->outputType == ARM_STFT_SPECTRUM)
+		{
+			for (i = 0; i < N; i++)
+			{
+				pDst[i] = ref_stft_spectrum[i];
+			}
+			pDst += N;
+		}
+		else
+		{
+			//bins 0 and N/2 are packed in the first complex value
+			for (i = 0; i <= N / 2; i++)
+			{
+				if (i == 0)
+				{
+					re = ref_stft_spectrum[0];
+					im = 0.0;
+				}
+				else if (i == N / 2)
+				{
+					re = ref_stft_spectrum[1];
+					im = 0.0;
+				}
+				else
+				{
+					re = ref_stft_spectrum[2*i];
+					im = ref_stft_spectrum[2*i+1];
+				}
+
+				if (S->outputType == ARM_STFT_MAGNITUDE)
+				{
+					pDst[i] = (float32_t)sqrt(re * re + im * im);
+				}
+				else
+				{
+					pDst[i] = (float32_t)(re * re + im * im);
+				}
+			}
+			pDst += N / 2 + 1;
+		}
+	}
+
+	return numFrames;
+}
@@ -31,45 +31,1163 @@
 
 #include "arm_math.h"
 
+/*
+ * FFT table selection
+ *
+ * Without ARM_DSP_CONFIG_TABLES, or with ARM_ALL_FFT_TABLES, every FFT table is
+ * built. With ARM_DSP_CONFIG_TABLES, only the tables selected by an ARM_TABLE_
+ * macro are: an init function then returns ARM_MATH_ARGUMENT_ERROR for the
+ * lengths whose tables are not built. The macros must be the same for the
+ * library and for the application.
+ *
+ * Tables: ARM_TABLE_TWIDDLECOEF_{F32,Q31,Q15}_<len>, ARM_TABLE_TWIDDLECOEF_RFFT_F32_<len>,
+ * ARM_TABLE_BITREVIDX_{FLT,FXT}_<len>, ARM_TABLE_BITREV_1024 and
+ * ARM_TABLE_REALCOEF_{F32,Q31,Q15}.
+ *
+ * Per length, the tables of a transform:
+ *   ARM_TABLE_CFFT_{F32,Q31,Q15}_<len>       arm_cfft_f32, _q31, _q15
+ *   ARM_TABLE_RFFT_FAST_{F32,Q31,Q15}_<len>  arm_rfft_fast_f32, _q31, _q15
+ *   ARM_TABLE_RFFT_{Q31,Q15}_<len>           arm_rfft_q31, _q15
+ *   ARM_TABLE_DCT4_{F32,Q31,Q15}_<len>       arm_dct4_f32, _q31, _q15
+ * arm_rfft_f32 and the radix-2 and radix-4 functions use the 4096 point twiddle
+ * table of their type and ARM_TABLE_BITREV_1024.
+ * The twiddle factors of arm_cfft_init_twiddle_f32, _q31, _q15 and of
+ * arm_rfft_fast_init_twiddle_f32 are computed in RAM: they only need the bit
+ * reversal tables, ARM_TABLE_BITREVIDX_FLT_<len> or ARM_TABLE_BITREVIDX_FXT_<len>.
+ */
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES)
+#ifndef ARM_TABLE_BITREV_1024
+#define ARM_TABLE_BITREV_1024
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_16
+#define ARM_TABLE_TWIDDLECOEF_F32_16
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_32
+#define ARM_TABLE_TWIDDLECOEF_F32_32
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_64
+#define ARM_TABLE_TWIDDLECOEF_F32_64
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_128
+#define ARM_TABLE_TWIDDLECOEF_F32_128
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_256
+#define ARM_TABLE_TWIDDLECOEF_F32_256
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_512
+#define ARM_TABLE_TWIDDLECOEF_F32_512
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_1024
+#define ARM_TABLE_TWIDDLECOEF_F32_1024
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_2048
+#define ARM_TABLE_TWIDDLECOEF_F32_2048
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_4096
+#define ARM_TABLE_TWIDDLECOEF_F32_4096
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_16
+#define ARM_TABLE_TWIDDLECOEF_Q31_16
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_32
+#define ARM_TABLE_TWIDDLECOEF_Q31_32
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_64
+#define ARM_TABLE_TWIDDLECOEF_Q31_64
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_128
+#define ARM_TABLE_TWIDDLECOEF_Q31_128
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_256
+#define ARM_TABLE_TWIDDLECOEF_Q31_256
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_512
+#define ARM_TABLE_TWIDDLECOEF_Q31_512
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_1024
+#define ARM_TABLE_TWIDDLECOEF_Q31_1024
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_2048
+#define ARM_TABLE_TWIDDLECOEF_Q31_2048
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_4096
+#define ARM_TABLE_TWIDDLECOEF_Q31_4096
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_16
+#define ARM_TABLE_TWIDDLECOEF_Q15_16
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_32
+#define ARM_TABLE_TWIDDLECOEF_Q15_32
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_64
+#define ARM_TABLE_TWIDDLECOEF_Q15_64
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_128
+#define ARM_TABLE_TWIDDLECOEF_Q15_128
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_256
+#define ARM_TABLE_TWIDDLECOEF_Q15_256
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_512
+#define ARM_TABLE_TWIDDLECOEF_Q15_512
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_1024
+#define ARM_TABLE_TWIDDLECOEF_Q15_1024
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_2048
+#define ARM_TABLE_TWIDDLECOEF_Q15_2048
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_4096
+#define ARM_TABLE_TWIDDLECOEF_Q15_4096
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_RFFT_F32_32
+#define ARM_TABLE_TWIDDLECOEF_RFFT_F32_32
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_RFFT_F32_64
+#define ARM_TABLE_TWIDDLECOEF_RFFT_F32_64
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_RFFT_F32_128
+#define ARM_TABLE_TWIDDLECOEF_RFFT_F32_128
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_RFFT_F32_256
+#define ARM_TABLE_TWIDDLECOEF_RFFT_F32_256
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_RFFT_F32_512
+#define ARM_TABLE_TWIDDLECOEF_RFFT_F32_512
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_RFFT_F32_1024
+#define ARM_TABLE_TWIDDLECOEF_RFFT_F32_1024
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_RFFT_F32_2048
+#define ARM_TABLE_TWIDDLECOEF_RFFT_F32_2048
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_RFFT_F32_4096
+#define ARM_TABLE_TWIDDLECOEF_RFFT_F32_4096
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FLT_16
+#define ARM_TABLE_BITREVIDX_FLT_16
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FLT_32
+#define ARM_TABLE_BITREVIDX_FLT_32
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FLT_64
+#define ARM_TABLE_BITREVIDX_FLT_64
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FLT_128
+#define ARM_TABLE_BITREVIDX_FLT_128
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FLT_256
+#define ARM_TABLE_BITREVIDX_FLT_256
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FLT_512
+#define ARM_TABLE_BITREVIDX_FLT_512
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FLT_1024
+#define ARM_TABLE_BITREVIDX_FLT_1024
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FLT_2048
+#define ARM_TABLE_BITREVIDX_FLT_2048
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FLT_4096
+#define ARM_TABLE_BITREVIDX_FLT_4096
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_16
+#define ARM_TABLE_BITREVIDX_FXT_16
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_32
+#define ARM_TABLE_BITREVIDX_FXT_32
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_64
+#define ARM_TABLE_BITREVIDX_FXT_64
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_128
+#define ARM_TABLE_BITREVIDX_FXT_128
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_256
+#define ARM_TABLE_BITREVIDX_FXT_256
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_512
+#define ARM_TABLE_BITREVIDX_FXT_512
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_1024
+#define ARM_TABLE_BITREVIDX_FXT_1024
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_2048
+#define ARM_TABLE_BITREVIDX_FXT_2048
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_4096
+#define ARM_TABLE_BITREVIDX_FXT_4096
+#endif
+#ifndef ARM_TABLE_REALCOEF_F32
+#define ARM_TABLE_REALCOEF_F32
+#endif
+#ifndef ARM_TABLE_REALCOEF_Q31
+#define ARM_TABLE_REALCOEF_Q31
+#endif
+#ifndef ARM_TABLE_REALCOEF_Q15
+#define ARM_TABLE_REALCOEF_Q15
+#endif
+#ifndef ARM_TABLE_DCT4_F32_128
+#define ARM_TABLE_DCT4_F32_128
+#endif
+#ifndef ARM_TABLE_DCT4_F32_512
+#define ARM_TABLE_DCT4_F32_512
+#endif
+#ifndef ARM_TABLE_DCT4_F32_2048
+#define ARM_TABLE_DCT4_F32_2048
+#endif
+#ifndef ARM_TABLE_DCT4_F32_8192
+#define ARM_TABLE_DCT4_F32_8192
+#endif
+#ifndef ARM_TABLE_DCT4_Q31_128
+#define ARM_TABLE_DCT4_Q31_128
+#endif
+#ifndef ARM_TABLE_DCT4_Q31_512
+#define ARM_TABLE_DCT4_Q31_512
+#endif
+#ifndef ARM_TABLE_DCT4_Q31_2048
+#define ARM_TABLE_DCT4_Q31_2048
+#endif
+#ifndef ARM_TABLE_DCT4_Q31_8192
+#define ARM_TABLE_DCT4_Q31_8192
+#endif
+#ifndef ARM_TABLE_DCT4_Q15_128
+#define ARM_TABLE_DCT4_Q15_128
+#endif
+#ifndef ARM_TABLE_DCT4_Q15_512
+#define ARM_TABLE_DCT4_Q15_512
+#endif
+#ifndef ARM_TABLE_DCT4_Q15_2048
+#define ARM_TABLE_DCT4_Q15_2048
+#endif
+#ifndef ARM_TABLE_DCT4_Q15_8192
+#define ARM_TABLE_DCT4_Q15_8192
+#endif
+#endif
+
+#if defined(ARM_TABLE_CFFT_F32_16)
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_16
+#define ARM_TABLE_TWIDDLECOEF_F32_16
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FLT_16
+#define ARM_TABLE_BITREVIDX_FLT_16
+#endif
+#endif
+#if defined(ARM_TABLE_CFFT_F32_32)
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_32
+#define ARM_TABLE_TWIDDLECOEF_F32_32
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FLT_32
+#define ARM_TABLE_BITREVIDX_FLT_32
+#endif
+#endif
+#if defined(ARM_TABLE_CFFT_F32_64)
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_64
+#define ARM_TABLE_TWIDDLECOEF_F32_64
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FLT_64
+#define ARM_TABLE_BITREVIDX_FLT_64
+#endif
+#endif
+#if defined(ARM_TABLE_CFFT_F32_128)
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_128
+#define ARM_TABLE_TWIDDLECOEF_F32_128
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FLT_128
+#define ARM_TABLE_BITREVIDX_FLT_128
+#endif
+#endif
+#if defined(ARM_TABLE_CFFT_F32_256)
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_256
+#define ARM_TABLE_TWIDDLECOEF_F32_256
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FLT_256
+#define ARM_TABLE_BITREVIDX_FLT_256
+#endif
+#endif
+#if defined(ARM_TABLE_CFFT_F32_512)
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_512
+#define ARM_TABLE_TWIDDLECOEF_F32_512
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FLT_512
+#define ARM_TABLE_BITREVIDX_FLT_512
+#endif
+#endif
+#if defined(ARM_TABLE_CFFT_F32_1024)
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_1024
+#define ARM_TABLE_TWIDDLECOEF_F32_1024
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FLT_1024
+#define ARM_TABLE_BITREVIDX_FLT_1024
+#endif
+#endif
+#if defined(ARM_TABLE_CFFT_F32_2048)
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_2048
+#define ARM_TABLE_TWIDDLECOEF_F32_2048
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FLT_2048
+#define ARM_TABLE_BITREVIDX_FLT_2048
+#endif
+#endif
+#if defined(ARM_TABLE_CFFT_F32_4096)
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_4096
+#define ARM_TABLE_TWIDDLECOEF_F32_4096
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FLT_4096
+#define ARM_TABLE_BITREVIDX_FLT_4096
+#endif
+#endif
+#if defined(ARM_TABLE_CFFT_Q31_16)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_16
+#define ARM_TABLE_TWIDDLECOEF_Q31_16
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_16
+#define ARM_TABLE_BITREVIDX_FXT_16
+#endif
+#endif
+#if defined(ARM_TABLE_CFFT_Q31_32)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_32
+#define ARM_TABLE_TWIDDLECOEF_Q31_32
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_32
+#define ARM_TABLE_BITREVIDX_FXT_32
+#endif
+#endif
+#if defined(ARM_TABLE_CFFT_Q31_64)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_64
+#define ARM_TABLE_TWIDDLECOEF_Q31_64
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_64
+#define ARM_TABLE_BITREVIDX_FXT_64
+#endif
+#endif
+#if defined(ARM_TABLE_CFFT_Q31_128)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_128
+#define ARM_TABLE_TWIDDLECOEF_Q31_128
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_128
+#define ARM_TABLE_BITREVIDX_FXT_128
+#endif
+#endif
+#if defined(ARM_TABLE_CFFT_Q31_256)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_256
+#define ARM_TABLE_TWIDDLECOEF_Q31_256
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_256
+#define ARM_TABLE_BITREVIDX_FXT_256
+#endif
+#endif
+#if defined(ARM_TABLE_CFFT_Q31_512)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_512
+#define ARM_TABLE_TWIDDLECOEF_Q31_512
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_512
+#define ARM_TABLE_BITREVIDX_FXT_512
+#endif
+#endif
+#if defined(ARM_TABLE_CFFT_Q31_1024)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_1024
+#define ARM_TABLE_TWIDDLECOEF_Q31_1024
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_1024
+#define ARM_TABLE_BITREVIDX_FXT_1024
+#endif
+#endif
+#if defined(ARM_TABLE_CFFT_Q31_2048)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_2048
+#define ARM_TABLE_TWIDDLECOEF_Q31_2048
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_2048
+#define ARM_TABLE_BITREVIDX_FXT_2048
+#endif
+#endif
+#if defined(ARM_TABLE_CFFT_Q31_4096)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_4096
+#define ARM_TABLE_TWIDDLECOEF_Q31_4096
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_4096
+#define ARM_TABLE_BITREVIDX_FXT_4096
+#endif
+#endif
+#if defined(ARM_TABLE_CFFT_Q15_16)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_16
+#define ARM_TABLE_TWIDDLECOEF_Q15_16
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_16
+#define ARM_TABLE_BITREVIDX_FXT_16
+#endif
+#endif
+#if defined(ARM_TABLE_CFFT_Q15_32)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_32
+#define ARM_TABLE_TWIDDLECOEF_Q15_32
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_32
+#define ARM_TABLE_BITREVIDX_FXT_32
+#endif
+#endif
+#if defined(ARM_TABLE_CFFT_Q15_64)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_64
+#define ARM_TABLE_TWIDDLECOEF_Q15_64
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_64
+#define ARM_TABLE_BITREVIDX_FXT_64
+#endif
+#endif
+#if defined(ARM_TABLE_CFFT_Q15_128)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_128
+#define ARM_TABLE_TWIDDLECOEF_Q15_128
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_128
+#define ARM_TABLE_BITREVIDX_FXT_128
+#endif
+#endif
+#if defined(ARM_TABLE_CFFT_Q15_256)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_256
+#define ARM_TABLE_TWIDDLECOEF_Q15_256
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_256
+#define ARM_TABLE_BITREVIDX_FXT_256
+#endif
+#endif
+#if defined(ARM_TABLE_CFFT_Q15_512)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_512
+#define ARM_TABLE_TWIDDLECOEF_Q15_512
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_512
+#define ARM_TABLE_BITREVIDX_FXT_512
+#endif
+#endif
+#if defined(ARM_TABLE_CFFT_Q15_1024)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_1024
+#define ARM_TABLE_TWIDDLECOEF_Q15_1024
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_1024
+#define ARM_TABLE_BITREVIDX_FXT_1024
+#endif
+#endif
+#if defined(ARM_TABLE_CFFT_Q15_2048)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_2048
+#define ARM_TABLE_TWIDDLECOEF_Q15_2048
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_2048
+#define ARM_TABLE_BITREVIDX_FXT_2048
+#endif
+#endif
+#if defined(ARM_TABLE_CFFT_Q15_4096)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_4096
+#define ARM_TABLE_TWIDDLECOEF_Q15_4096
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_4096
+#define ARM_TABLE_BITREVIDX_FXT_4096
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_F32_32)
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_16
+#define ARM_TABLE_TWIDDLECOEF_F32_16
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FLT_16
+#define ARM_TABLE_BITREVIDX_FLT_16
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_RFFT_F32_32
+#define ARM_TABLE_TWIDDLECOEF_RFFT_F32_32
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_F32_64)
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_32
+#define ARM_TABLE_TWIDDLECOEF_F32_32
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FLT_32
+#define ARM_TABLE_BITREVIDX_FLT_32
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_RFFT_F32_64
+#define ARM_TABLE_TWIDDLECOEF_RFFT_F32_64
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_F32_128)
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_64
+#define ARM_TABLE_TWIDDLECOEF_F32_64
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FLT_64
+#define ARM_TABLE_BITREVIDX_FLT_64
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_RFFT_F32_128
+#define ARM_TABLE_TWIDDLECOEF_RFFT_F32_128
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_F32_256)
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_128
+#define ARM_TABLE_TWIDDLECOEF_F32_128
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FLT_128
+#define ARM_TABLE_BITREVIDX_FLT_128
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_RFFT_F32_256
+#define ARM_TABLE_TWIDDLECOEF_RFFT_F32_256
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_F32_512)
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_256
+#define ARM_TABLE_TWIDDLECOEF_F32_256
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FLT_256
+#define ARM_TABLE_BITREVIDX_FLT_256
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_RFFT_F32_512
+#define ARM_TABLE_TWIDDLECOEF_RFFT_F32_512
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_F32_1024)
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_512
+#define ARM_TABLE_TWIDDLECOEF_F32_512
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FLT_512
+#define ARM_TABLE_BITREVIDX_FLT_512
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_RFFT_F32_1024
+#define ARM_TABLE_TWIDDLECOEF_RFFT_F32_1024
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_F32_2048)
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_1024
+#define ARM_TABLE_TWIDDLECOEF_F32_1024
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FLT_1024
+#define ARM_TABLE_BITREVIDX_FLT_1024
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_RFFT_F32_2048
+#define ARM_TABLE_TWIDDLECOEF_RFFT_F32_2048
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_F32_4096)
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_2048
+#define ARM_TABLE_TWIDDLECOEF_F32_2048
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FLT_2048
+#define ARM_TABLE_BITREVIDX_FLT_2048
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_RFFT_F32_4096
+#define ARM_TABLE_TWIDDLECOEF_RFFT_F32_4096
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_Q31_32)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_16
+#define ARM_TABLE_TWIDDLECOEF_Q31_16
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_16
+#define ARM_TABLE_BITREVIDX_FXT_16
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_32
+#define ARM_TABLE_TWIDDLECOEF_Q31_32
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_Q31_64)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_32
+#define ARM_TABLE_TWIDDLECOEF_Q31_32
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_32
+#define ARM_TABLE_BITREVIDX_FXT_32
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_64
+#define ARM_TABLE_TWIDDLECOEF_Q31_64
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_Q31_128)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_64
+#define ARM_TABLE_TWIDDLECOEF_Q31_64
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_64
+#define ARM_TABLE_BITREVIDX_FXT_64
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_128
+#define ARM_TABLE_TWIDDLECOEF_Q31_128
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_Q31_256)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_128
+#define ARM_TABLE_TWIDDLECOEF_Q31_128
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_128
+#define ARM_TABLE_BITREVIDX_FXT_128
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_256
+#define ARM_TABLE_TWIDDLECOEF_Q31_256
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_Q31_512)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_256
+#define ARM_TABLE_TWIDDLECOEF_Q31_256
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_256
+#define ARM_TABLE_BITREVIDX_FXT_256
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_512
+#define ARM_TABLE_TWIDDLECOEF_Q31_512
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_Q31_1024)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_512
+#define ARM_TABLE_TWIDDLECOEF_Q31_512
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_512
+#define ARM_TABLE_BITREVIDX_FXT_512
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_1024
+#define ARM_TABLE_TWIDDLECOEF_Q31_1024
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_Q31_2048)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_1024
+#define ARM_TABLE_TWIDDLECOEF_Q31_1024
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_1024
+#define ARM_TABLE_BITREVIDX_FXT_1024
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_2048
+#define ARM_TABLE_TWIDDLECOEF_Q31_2048
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_Q31_4096)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_2048
+#define ARM_TABLE_TWIDDLECOEF_Q31_2048
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_2048
+#define ARM_TABLE_BITREVIDX_FXT_2048
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_4096
+#define ARM_TABLE_TWIDDLECOEF_Q31_4096
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_Q15_32)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_16
+#define ARM_TABLE_TWIDDLECOEF_Q15_16
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_16
+#define ARM_TABLE_BITREVIDX_FXT_16
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_32
+#define ARM_TABLE_TWIDDLECOEF_Q15_32
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_Q15_64)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_32
+#define ARM_TABLE_TWIDDLECOEF_Q15_32
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_32
+#define ARM_TABLE_BITREVIDX_FXT_32
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_64
+#define ARM_TABLE_TWIDDLECOEF_Q15_64
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_Q15_128)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_64
+#define ARM_TABLE_TWIDDLECOEF_Q15_64
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_64
+#define ARM_TABLE_BITREVIDX_FXT_64
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_128
+#define ARM_TABLE_TWIDDLECOEF_Q15_128
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_Q15_256)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_128
+#define ARM_TABLE_TWIDDLECOEF_Q15_128
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_128
+#define ARM_TABLE_BITREVIDX_FXT_128
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_256
+#define ARM_TABLE_TWIDDLECOEF_Q15_256
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_Q15_512)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_256
+#define ARM_TABLE_TWIDDLECOEF_Q15_256
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_256
+#define ARM_TABLE_BITREVIDX_FXT_256
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_512
+#define ARM_TABLE_TWIDDLECOEF_Q15_512
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_Q15_1024)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_512
+#define ARM_TABLE_TWIDDLECOEF_Q15_512
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_512
+#define ARM_TABLE_BITREVIDX_FXT_512
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_1024
+#define ARM_TABLE_TWIDDLECOEF_Q15_1024
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_Q15_2048)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_1024
+#define ARM_TABLE_TWIDDLECOEF_Q15_1024
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_1024
+#define ARM_TABLE_BITREVIDX_FXT_1024
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_2048
+#define ARM_TABLE_TWIDDLECOEF_Q15_2048
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_Q15_4096)
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_2048
+#define ARM_TABLE_TWIDDLECOEF_Q15_2048
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_2048
+#define ARM_TABLE_BITREVIDX_FXT_2048
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_4096
+#define ARM_TABLE_TWIDDLECOEF_Q15_4096
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_Q31_32)
+#ifndef ARM_TABLE_REALCOEF_Q31
+#define ARM_TABLE_REALCOEF_Q31
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_16
+#define ARM_TABLE_TWIDDLECOEF_Q31_16
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_16
+#define ARM_TABLE_BITREVIDX_FXT_16
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_Q31_64)
+#ifndef ARM_TABLE_REALCOEF_Q31
+#define ARM_TABLE_REALCOEF_Q31
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_32
+#define ARM_TABLE_TWIDDLECOEF_Q31_32
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_32
+#define ARM_TABLE_BITREVIDX_FXT_32
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_Q31_128)
+#ifndef ARM_TABLE_REALCOEF_Q31
+#define ARM_TABLE_REALCOEF_Q31
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_64
+#define ARM_TABLE_TWIDDLECOEF_Q31_64
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_64
+#define ARM_TABLE_BITREVIDX_FXT_64
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_Q31_256)
+#ifndef ARM_TABLE_REALCOEF_Q31
+#define ARM_TABLE_REALCOEF_Q31
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_128
+#define ARM_TABLE_TWIDDLECOEF_Q31_128
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_128
+#define ARM_TABLE_BITREVIDX_FXT_128
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_Q31_512)
+#ifndef ARM_TABLE_REALCOEF_Q31
+#define ARM_TABLE_REALCOEF_Q31
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_256
+#define ARM_TABLE_TWIDDLECOEF_Q31_256
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_256
+#define ARM_TABLE_BITREVIDX_FXT_256
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_Q31_1024)
+#ifndef ARM_TABLE_REALCOEF_Q31
+#define ARM_TABLE_REALCOEF_Q31
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_512
+#define ARM_TABLE_TWIDDLECOEF_Q31_512
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_512
+#define ARM_TABLE_BITREVIDX_FXT_512
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_Q31_2048)
+#ifndef ARM_TABLE_REALCOEF_Q31
+#define ARM_TABLE_REALCOEF_Q31
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_1024
+#define ARM_TABLE_TWIDDLECOEF_Q31_1024
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_1024
+#define ARM_TABLE_BITREVIDX_FXT_1024
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_Q31_4096)
+#ifndef ARM_TABLE_REALCOEF_Q31
+#define ARM_TABLE_REALCOEF_Q31
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_2048
+#define ARM_TABLE_TWIDDLECOEF_Q31_2048
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_2048
+#define ARM_TABLE_BITREVIDX_FXT_2048
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_Q31_8192)
+#ifndef ARM_TABLE_REALCOEF_Q31
+#define ARM_TABLE_REALCOEF_Q31
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_4096
+#define ARM_TABLE_TWIDDLECOEF_Q31_4096
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_4096
+#define ARM_TABLE_BITREVIDX_FXT_4096
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_Q15_32)
+#ifndef ARM_TABLE_REALCOEF_Q15
+#define ARM_TABLE_REALCOEF_Q15
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_16
+#define ARM_TABLE_TWIDDLECOEF_Q15_16
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_16
+#define ARM_TABLE_BITREVIDX_FXT_16
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_Q15_64)
+#ifndef ARM_TABLE_REALCOEF_Q15
+#define ARM_TABLE_REALCOEF_Q15
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_32
+#define ARM_TABLE_TWIDDLECOEF_Q15_32
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_32
+#define ARM_TABLE_BITREVIDX_FXT_32
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_Q15_128)
+#ifndef ARM_TABLE_REALCOEF_Q15
+#define ARM_TABLE_REALCOEF_Q15
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_64
+#define ARM_TABLE_TWIDDLECOEF_Q15_64
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_64
+#define ARM_TABLE_BITREVIDX_FXT_64
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_Q15_256)
+#ifndef ARM_TABLE_REALCOEF_Q15
+#define ARM_TABLE_REALCOEF_Q15
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_128
+#define ARM_TABLE_TWIDDLECOEF_Q15_128
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_128
+#define ARM_TABLE_BITREVIDX_FXT_128
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_Q15_512)
+#ifndef ARM_TABLE_REALCOEF_Q15
+#define ARM_TABLE_REALCOEF_Q15
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_256
+#define ARM_TABLE_TWIDDLECOEF_Q15_256
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_256
+#define ARM_TABLE_BITREVIDX_FXT_256
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_Q15_1024)
+#ifndef ARM_TABLE_REALCOEF_Q15
+#define ARM_TABLE_REALCOEF_Q15
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_512
+#define ARM_TABLE_TWIDDLECOEF_Q15_512
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_512
+#define ARM_TABLE_BITREVIDX_FXT_512
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_Q15_2048)
+#ifndef ARM_TABLE_REALCOEF_Q15
+#define ARM_TABLE_REALCOEF_Q15
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_1024
+#define ARM_TABLE_TWIDDLECOEF_Q15_1024
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_1024
+#define ARM_TABLE_BITREVIDX_FXT_1024
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_Q15_4096)
+#ifndef ARM_TABLE_REALCOEF_Q15
+#define ARM_TABLE_REALCOEF_Q15
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_2048
+#define ARM_TABLE_TWIDDLECOEF_Q15_2048
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_2048
+#define ARM_TABLE_BITREVIDX_FXT_2048
+#endif
+#endif
+#if defined(ARM_TABLE_RFFT_Q15_8192)
+#ifndef ARM_TABLE_REALCOEF_Q15
+#define ARM_TABLE_REALCOEF_Q15
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_4096
+#define ARM_TABLE_TWIDDLECOEF_Q15_4096
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_4096
+#define ARM_TABLE_BITREVIDX_FXT_4096
+#endif
+#endif
+#if defined(ARM_TABLE_DCT4_F32_128)
+#ifndef ARM_TABLE_REALCOEF_F32
+#define ARM_TABLE_REALCOEF_F32
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_4096
+#define ARM_TABLE_TWIDDLECOEF_F32_4096
+#endif
+#ifndef ARM_TABLE_BITREV_1024
+#define ARM_TABLE_BITREV_1024
+#endif
+#endif
+#if defined(ARM_TABLE_DCT4_F32_512)
+#ifndef ARM_TABLE_REALCOEF_F32
+#define ARM_TABLE_REALCOEF_F32
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_4096
+#define ARM_TABLE_TWIDDLECOEF_F32_4096
+#endif
+#ifndef ARM_TABLE_BITREV_1024
+#define ARM_TABLE_BITREV_1024
+#endif
+#endif
+#if defined(ARM_TABLE_DCT4_F32_2048)
+#ifndef ARM_TABLE_REALCOEF_F32
+#define ARM_TABLE_REALCOEF_F32
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_4096
+#define ARM_TABLE_TWIDDLECOEF_F32_4096
+#endif
+#ifndef ARM_TABLE_BITREV_1024
+#define ARM_TABLE_BITREV_1024
+#endif
+#endif
+#if defined(ARM_TABLE_DCT4_F32_8192)
+#ifndef ARM_TABLE_REALCOEF_F32
+#define ARM_TABLE_REALCOEF_F32
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_F32_4096
+#define ARM_TABLE_TWIDDLECOEF_F32_4096
+#endif
+#ifndef ARM_TABLE_BITREV_1024
+#define ARM_TABLE_BITREV_1024
+#endif
+#endif
+#if defined(ARM_TABLE_DCT4_Q31_128)
+#ifndef ARM_TABLE_REALCOEF_Q31
+#define ARM_TABLE_REALCOEF_Q31
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_64
+#define ARM_TABLE_TWIDDLECOEF_Q31_64
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_64
+#define ARM_TABLE_BITREVIDX_FXT_64
+#endif
+#endif
+#if defined(ARM_TABLE_DCT4_Q31_512)
+#ifndef ARM_TABLE_REALCOEF_Q31
+#define ARM_TABLE_REALCOEF_Q31
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_256
+#define ARM_TABLE_TWIDDLECOEF_Q31_256
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_256
+#define ARM_TABLE_BITREVIDX_FXT_256
+#endif
+#endif
+#if defined(ARM_TABLE_DCT4_Q31_2048)
+#ifndef ARM_TABLE_REALCOEF_Q31
+#define ARM_TABLE_REALCOEF_Q31
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_1024
+#define ARM_TABLE_TWIDDLECOEF_Q31_1024
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_1024
+#define ARM_TABLE_BITREVIDX_FXT_1024
+#endif
+#endif
+#if defined(ARM_TABLE_DCT4_Q31_8192)
+#ifndef ARM_TABLE_REALCOEF_Q31
+#define ARM_TABLE_REALCOEF_Q31
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q31_4096
+#define ARM_TABLE_TWIDDLECOEF_Q31_4096
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_4096
+#define ARM_TABLE_BITREVIDX_FXT_4096
+#endif
+#endif
+#if defined(ARM_TABLE_DCT4_Q15_128)
+#ifndef ARM_TABLE_REALCOEF_Q15
+#define ARM_TABLE_REALCOEF_Q15
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_64
+#define ARM_TABLE_TWIDDLECOEF_Q15_64
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_64
+#define ARM_TABLE_BITREVIDX_FXT_64
+#endif
+#endif
+#if defined(ARM_TABLE_DCT4_Q15_512)
+#ifndef ARM_TABLE_REALCOEF_Q15
+#define ARM_TABLE_REALCOEF_Q15
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_256
+#define ARM_TABLE_TWIDDLECOEF_Q15_256
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_256
+#define ARM_TABLE_BITREVIDX_FXT_256
+#endif
+#endif
+#if defined(ARM_TABLE_DCT4_Q15_2048)
+#ifndef ARM_TABLE_REALCOEF_Q15
+#define ARM_TABLE_REALCOEF_Q15
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_1024
+#define ARM_TABLE_TWIDDLECOEF_Q15_1024
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_1024
+#define ARM_TABLE_BITREVIDX_FXT_1024
+#endif
+#endif
+#if defined(ARM_TABLE_DCT4_Q15_8192)
+#ifndef ARM_TABLE_REALCOEF_Q15
+#define ARM_TABLE_REALCOEF_Q15
+#endif
+#ifndef ARM_TABLE_TWIDDLECOEF_Q15_4096
+#define ARM_TABLE_TWIDDLECOEF_Q15_4096
+#endif
+#ifndef ARM_TABLE_BITREVIDX_FXT_4096
+#define ARM_TABLE_BITREVIDX_FXT_4096
+#endif
+#endif
+
+#if defined(ARM_TABLE_BITREV_1024)
 extern const uint16_t armBitRevTable[1024];
+#endif
 extern const q15_t armRecipTableQ15[64];
 extern const q31_t armRecipTableQ31[64];
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_16)
 extern const float32_t twiddleCoef_16[32];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_32)
 extern const float32_t twiddleCoef_32[64];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_64)
 extern const float32_t twiddleCoef_64[128];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_128)
 extern const float32_t twiddleCoef_128[256];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_256)
 extern const float32_t twiddleCoef_256[512];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_512)
 extern const float32_t twiddleCoef_512[1024];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_1024)
 extern const float32_t twiddleCoef_1024[2048];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_2048)
 extern const float32_t twiddleCoef_2048[4096];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_4096)
 extern const float32_t twiddleCoef_4096[8192];
 #define twiddleCoef twiddleCoef_4096
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_16)
 extern const q31_t twiddleCoef_16_q31[24];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_32)
 extern const q31_t twiddleCoef_32_q31[48];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_64)
 extern const q31_t twiddleCoef_64_q31[96];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_128)
 extern const q31_t twiddleCoef_128_q31[192];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_256)
 extern const q31_t twiddleCoef_256_q31[384];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_512)
 extern const q31_t twiddleCoef_512_q31[768];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_1024)
 extern const q31_t twiddleCoef_1024_q31[1536];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_2048)
 extern const q31_t twiddleCoef_2048_q31[3072];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_4096)
 extern const q31_t twiddleCoef_4096_q31[6144];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_16)
 extern const q15_t twiddleCoef_16_q15[24];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_32)
 extern const q15_t twiddleCoef_32_q15[48];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_64)
 extern const q15_t twiddleCoef_64_q15[96];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_128)
 extern const q15_t twiddleCoef_128_q15[192];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_256)
 extern const q15_t twiddleCoef_256_q15[384];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_512)
 extern const q15_t twiddleCoef_512_q15[768];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_1024)
 extern const q15_t twiddleCoef_1024_q15[1536];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_2048)
 extern const q15_t twiddleCoef_2048_q15[3072];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_4096)
 extern const q15_t twiddleCoef_4096_q15[6144];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_32)
 extern const float32_t twiddleCoef_rfft_32[32];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_64)
 extern const float32_t twiddleCoef_rfft_64[64];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_128)
 extern const float32_t twiddleCoef_rfft_128[128];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_256)
 extern const float32_t twiddleCoef_rfft_256[256];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_512)
 extern const float32_t twiddleCoef_rfft_512[512];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_1024)
 extern const float32_t twiddleCoef_rfft_1024[1024];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_2048)
 extern const float32_t twiddleCoef_rfft_2048[2048];
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_4096)
 extern const float32_t twiddleCoef_rfft_4096[4096];
+#endif
 
 /* floating-point bit reversal tables */
 #define ARMBITREVINDEXTABLE_16_TABLE_LENGTH ((uint16_t)20)
@@ -82,15 +1200,33 @@ extern const float32_t twiddleCoef_rfft_4096[4096];
 #define ARMBITREVINDEXTABLE_2048_TABLE_LENGTH ((uint16_t)3808)
 #define ARMBITREVINDEXTABLE_4096_TABLE_LENGTH ((uint16_t)4032)
 
+#if defined(ARM_TABLE_BITREVIDX_FLT_16)
 extern const uint16_t armBitRevIndexTable16[ARMBITREVINDEXTABLE_16_TABLE_LENGTH];
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_32)
 extern const uint16_t armBitRevIndexTable32[ARMBITREVINDEXTABLE_32_TABLE_LENGTH];
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_64)
 extern const uint16_t armBitRevIndexTable64[ARMBITREVINDEXTABLE_64_TABLE_LENGTH];
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_128)
 extern const uint16_t armBitRevIndexTable128[ARMBITREVINDEXTABLE_128_TABLE_LENGTH];
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_256)
 extern const uint16_t armBitRevIndexTable256[ARMBITREVINDEXTABLE_256_TABLE_LENGTH];
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_512)
 extern const uint16_t armBitRevIndexTable512[ARMBITREVINDEXTABLE_512_TABLE_LENGTH];
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_1024)
 extern const uint16_t armBitRevIndexTable1024[ARMBITREVINDEXTABLE_1024_TABLE_LENGTH];
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_2048)
 extern const uint16_t armBitRevIndexTable2048[ARMBITREVINDEXTABLE_2048_TABLE_LENGTH];
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_4096)
 extern const uint16_t armBitRevIndexTable4096[ARMBITREVINDEXTABLE_4096_TABLE_LENGTH];
+#endif
 
 /* fixed-point bit reversal tables */
 #define ARMBITREVINDEXTABLE_FIXED_16_TABLE_LENGTH ((uint16_t)12)
@@ -103,15 +1239,33 @@ extern const uint16_t armBitRevIndexTable4096[ARMBITREVINDEXTABLE_4096_TABLE_LEN
 #define ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH ((uint16_t)1984)
 #define ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH ((uint16_t)4032)
 
+#if defined(ARM_TABLE_BITREVIDX_FXT_16)
 extern const uint16_t armBitRevIndexTable_fixed_16[ARMBITREVINDEXTABLE_FIXED_16_TABLE_LENGTH];
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FXT_32)
 extern const uint16_t armBitRevIndexTable_fixed_32[ARMBITREVINDEXTABLE_FIXED_32_TABLE_LENGTH];
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FXT_64)
 extern const uint16_t armBitRevIndexTable_fixed_64[ARMBITREVINDEXTABLE_FIXED_64_TABLE_LENGTH];
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FXT_128)
 extern const uint16_t armBitRevIndexTable_fixed_128[ARMBITREVINDEXTABLE_FIXED_128_TABLE_LENGTH];
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FXT_256)
 extern const uint16_t armBitRevIndexTable_fixed_256[ARMBITREVINDEXTABLE_FIXED_256_TABLE_LENGTH];
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FXT_512)
 extern const uint16_t armBitRevIndexTable_fixed_512[ARMBITREVINDEXTABLE_FIXED_512_TABLE_LENGTH];
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FXT_1024)
 extern const uint16_t armBitRevIndexTable_fixed_1024[ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH];
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FXT_2048)
 extern const uint16_t armBitRevIndexTable_fixed_2048[ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH];
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FXT_4096)
 extern const uint16_t armBitRevIndexTable_fixed_4096[ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH];
+#endif
 
 /* Tables for Fast Math Sine and Cosine */
 extern const float32_t sinTable_f32[FAST_MATH_TABLE_SIZE + 1];
@@ -33,34 +33,88 @@
 #include "arm_math.h"
 #include "arm_common_tables.h"
 
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_16) && defined(ARM_TABLE_BITREVIDX_FLT_16)
    extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len16;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_32) && defined(ARM_TABLE_BITREVIDX_FLT_32)
    extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len32;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_64) && defined(ARM_TABLE_BITREVIDX_FLT_64)
    extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len64;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_128) && defined(ARM_TABLE_BITREVIDX_FLT_128)
    extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len128;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_256) && defined(ARM_TABLE_BITREVIDX_FLT_256)
    extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len256;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_512) && defined(ARM_TABLE_BITREVIDX_FLT_512)
    extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len512;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_1024) && defined(ARM_TABLE_BITREVIDX_FLT_1024)
    extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len1024;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_2048) && defined(ARM_TABLE_BITREVIDX_FLT_2048)
    extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len2048;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_4096) && defined(ARM_TABLE_BITREVIDX_FLT_4096)
    extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len4096;
+#endif
 
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_16) && defined(ARM_TABLE_BITREVIDX_FXT_16)
    extern const arm_cfft_instance_q31 arm_cfft_sR_q31_len16;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_32) && defined(ARM_TABLE_BITREVIDX_FXT_32)
    extern const arm_cfft_instance_q31 arm_cfft_sR_q31_len32;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_64) && defined(ARM_TABLE_BITREVIDX_FXT_64)
    extern const arm_cfft_instance_q31 arm_cfft_sR_q31_len64;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_128) && defined(ARM_TABLE_BITREVIDX_FXT_128)
    extern const arm_cfft_instance_q31 arm_cfft_sR_q31_len128;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_256) && defined(ARM_TABLE_BITREVIDX_FXT_256)
    extern const arm_cfft_instance_q31 arm_cfft_sR_q31_len256;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_512) && defined(ARM_TABLE_BITREVIDX_FXT_512)
    extern const arm_cfft_instance_q31 arm_cfft_sR_q31_len512;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_1024) && defined(ARM_TABLE_BITREVIDX_FXT_1024)
    extern const arm_cfft_instance_q31 arm_cfft_sR_q31_len1024;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_2048) && defined(ARM_TABLE_BITREVIDX_FXT_2048)
    extern const arm_cfft_instance_q31 arm_cfft_sR_q31_len2048;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_4096) && defined(ARM_TABLE_BITREVIDX_FXT_4096)
    extern const arm_cfft_instance_q31 arm_cfft_sR_q31_len4096;
+#endif
 
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_16) && defined(ARM_TABLE_BITREVIDX_FXT_16)
    extern const arm_cfft_instance_q15 arm_cfft_sR_q15_len16;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_32) && defined(ARM_TABLE_BITREVIDX_FXT_32)
    extern const arm_cfft_instance_q15 arm_cfft_sR_q15_len32;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_64) && defined(ARM_TABLE_BITREVIDX_FXT_64)
    extern const arm_cfft_instance_q15 arm_cfft_sR_q15_len64;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_128) && defined(ARM_TABLE_BITREVIDX_FXT_128)
    extern const arm_cfft_instance_q15 arm_cfft_sR_q15_len128;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_256) && defined(ARM_TABLE_BITREVIDX_FXT_256)
    extern const arm_cfft_instance_q15 arm_cfft_sR_q15_len256;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_512) && defined(ARM_TABLE_BITREVIDX_FXT_512)
    extern const arm_cfft_instance_q15 arm_cfft_sR_q15_len512;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_1024) && defined(ARM_TABLE_BITREVIDX_FXT_1024)
    extern const arm_cfft_instance_q15 arm_cfft_sR_q15_len1024;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_2048) && defined(ARM_TABLE_BITREVIDX_FXT_2048)
    extern const arm_cfft_instance_q15 arm_cfft_sR_q15_len2048;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_4096) && defined(ARM_TABLE_BITREVIDX_FXT_4096)
    extern const arm_cfft_instance_q15 arm_cfft_sR_q15_len4096;
+#endif
 
 #endif
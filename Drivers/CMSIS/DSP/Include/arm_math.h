@@ -126,6 +126,29 @@
    * and ARM_MATH_CM0 for building library on Cortex-M0 target, ARM_MATH_CM0PLUS for building library on Cortex-M0+ target, and
    * ARM_MATH_CM7 for building the library on cortex-M7.
    *
+   * - ARM_MATH_HOST:
+   *
+   * Define macro ARM_MATH_HOST for building the library on a PC (x86, x86-64, AArch64) with GCC or Clang, for instance to
+   * test it or benchmark it. The Cortex-M3 code is built; define also ARM_MATH_DSP to build the Cortex-M4 code, the DSP
+   * instructions being emulated bit-exactly by arm_math_host.h, or ARM_MATH_CM0_FAMILY to build the Cortex-M0 code.
+   * See DSP_Lib_TestSuite/DspLibTest_Host.
+   *
+   * - ARM_MATH_HOST_SIMD:
+   *
+   * Define macro ARM_MATH_HOST_SIMD, with ARM_MATH_HOST, to build the host vector code of arm_fir_f32,
+   * arm_biquad_cascade_df2T_f32, arm_cfft_f32 (and the real FFTs built on it), arm_mat_mult_f32 and arm_dot_prod_f32.
+   * It is written with the GCC
+   * vector extensions: the instruction set is the one the compiler targets (SSE2 by default on x86-64, -msse4.1,
+   * -mavx2 for 256-bit vectors, NEON on AArch64). The fixed-point code is not changed, so its results stay
+   * bit-exact; the floating-point results differ from the scalar code by the order of the additions only.
+   *
+   * - ARM_DSP_CONFIG_TABLES:
+   *
+   * Define macro ARM_DSP_CONFIG_TABLES to build only the FFT tables selected by ARM_TABLE_ macros, for instance
+   * ARM_TABLE_CFFT_F32_256 or ARM_TABLE_RFFT_FAST_Q15_1024: the initialization functions then return
+   * ARM_MATH_ARGUMENT_ERROR for the other lengths. The macros are listed in arm_common_tables.h; the application
+   * must be built with the same macros as the library. ARM_ALL_FFT_TABLES builds all the tables again.
+   *
    * - ARM_MATH_ARMV8MxL:
    *
    * Define macro ARM_MATH_ARMV8MBL for building the library on Armv8-M Baseline target, ARM_MATH_ARMV8MML for building library
@@ -337,8 +360,10 @@
   #if (defined (__DSP_PRESENT) && (__DSP_PRESENT == 1))
     #define ARM_MATH_DSP
   #endif
+#elif defined (ARM_MATH_HOST)
+  #include "arm_math_host.h"
 #else
-  #error "Define according the used Cortex core ARM_MATH_CM7, ARM_MATH_CM4, ARM_MATH_CM3, ARM_MATH_CM0PLUS, ARM_MATH_CM0, ARM_MATH_ARMV8MBL, ARM_MATH_ARMV8MML"
+  #error "Define according the used Cortex core ARM_MATH_CM7, ARM_MATH_CM4, ARM_MATH_CM3, ARM_MATH_CM0PLUS, ARM_MATH_CM0, ARM_MATH_ARMV8MBL, ARM_MATH_ARMV8MML, ARM_MATH_HOST"
 #endif
 
 #undef  __CMSIS_GENERIC         /* enable NVIC and Systick functions */
@@ -404,7 +429,8 @@ extern "C"
     ARM_MATH_SIZE_MISMATCH = -3,         /**< Size of matrices is not compatible with the operation. */
     ARM_MATH_NANINF = -4,                /**< Not-a-number (NaN) or infinity is generated */
     ARM_MATH_SINGULAR = -5,              /**< Generated by matrix inversion if the input matrix is singular and cannot be inverted. */
-    ARM_MATH_TEST_FAILURE = -6           /**< Test Failed  */
+    ARM_MATH_TEST_FAILURE = -6,          /**< Test Failed  */
+    ARM_MATH_DECOMPOSITION_FAILURE = -7  /**< Generated by matrix decompositions if the input matrix is not positive definite or has a zero pivot. */
   } arm_status;
 
   /**
@@ -1581,6 +1607,84 @@ extern "C"
   arm_matrix_instance_q31 * pDst);
 
 
+  /**
+   * @brief Floating-point matrix multiplication with the second matrix transposed
+   * @param[in]  pSrcA   points to the first input matrix structure
+   * @param[in]  pSrcBT  points to the transpose of the second input matrix structure
+   * @param[out] pDst    points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+  arm_status arm_mat_mult_bt_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcBT,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Q15 matrix multiplication with the second matrix transposed
+   * @param[in]  pSrcA   points to the first input matrix structure
+   * @param[in]  pSrcBT  points to the transpose of the second input matrix structure
+   * @param[out] pDst    points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+  arm_status arm_mat_mult_bt_q15(
+  const arm_matrix_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcBT,
+  arm_matrix_instance_q15 * pDst);
+
+
+  /**
+   * @brief Q31 matrix multiplication with the second matrix transposed
+   * @param[in]  pSrcA   points to the first input matrix structure
+   * @param[in]  pSrcBT  points to the transpose of the second input matrix structure
+   * @param[out] pDst    points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+  arm_status arm_mat_mult_bt_q31(
+  const arm_matrix_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcBT,
+  arm_matrix_instance_q31 * pDst);
+
+
+  /**
+   * @brief Floating-point matrix and vector multiplication
+   * @param[in]  pSrcMat  points to the input matrix structure
+   * @param[in]  pVec     points to the input vector, of pSrcMat->numCols elements
+   * @param[out] pDst     points to the output vector, of pSrcMat->numRows elements
+   */
+  void arm_mat_vec_mult_f32(
+  const arm_matrix_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+  float32_t * pDst);
+
+
+  /**
+   * @brief Q15 matrix and vector multiplication
+   * @param[in]  pSrcMat  points to the input matrix structure
+   * @param[in]  pVec     points to the input vector, of pSrcMat->numCols elements
+   * @param[out] pDst     points to the output vector, of pSrcMat->numRows elements
+   */
+  void arm_mat_vec_mult_q15(
+  const arm_matrix_instance_q15 * pSrcMat,
+  const q15_t * pVec,
+  q15_t * pDst);
+
+
+  /**
+   * @brief Q31 matrix and vector multiplication
+   * @param[in]  pSrcMat  points to the input matrix structure
+   * @param[in]  pVec     points to the input vector, of pSrcMat->numCols elements
+   * @param[out] pDst     points to the output vector, of pSrcMat->numRows elements
+   */
+  void arm_mat_vec_mult_q31(
+  const arm_matrix_instance_q31 * pSrcMat,
+  const q31_t * pVec,
+  q31_t * pDst);
+
+
   /**
    * @brief Floating-point matrix subtraction
    * @param[in]  pSrcA  points to the first input matrix structure
@@ -2099,6 +2203,15 @@ void arm_cfft_q15(
     uint8_t ifftFlag,
     uint8_t bitReverseFlag);
 
+arm_status arm_cfft_init_q15(
+    arm_cfft_instance_q15 * S,
+    uint16_t fftLen);
+
+arm_status arm_cfft_init_twiddle_q15(
+    arm_cfft_instance_q15 * S,
+    uint16_t fftLen,
+    q15_t * pTwiddleBuffer);
+
   /**
    * @brief Instance structure for the fixed-point CFFT/CIFFT function.
    */
@@ -2116,6 +2229,15 @@ void arm_cfft_q31(
     uint8_t ifftFlag,
     uint8_t bitReverseFlag);
 
+arm_status arm_cfft_init_q31(
+    arm_cfft_instance_q31 * S,
+    uint16_t fftLen);
+
+arm_status arm_cfft_init_twiddle_q31(
+    arm_cfft_instance_q31 * S,
+    uint16_t fftLen,
+    q31_t * pTwiddleBuffer);
+
   /**
    * @brief Instance structure for the floating-point CFFT/CIFFT function.
    */
@@ -2133,6 +2255,15 @@ void arm_cfft_q31(
   uint8_t ifftFlag,
   uint8_t bitReverseFlag);
 
+  arm_status arm_cfft_init_f32(
+  arm_cfft_instance_f32 * S,
+  uint16_t fftLen);
+
+  arm_status arm_cfft_init_twiddle_f32(
+  arm_cfft_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddleBuffer);
+
   /**
    * @brief Instance structure for the Q15 RFFT/RIFFT function.
    */
@@ -2224,11 +2355,337 @@ arm_status arm_rfft_fast_init_f32 (
    arm_rfft_fast_instance_f32 * S,
    uint16_t fftLen);
 
+arm_status arm_rfft_fast_init_twiddle_f32(
+   arm_rfft_fast_instance_f32 * S,
+   uint16_t fftLen,
+   float32_t * pTwiddleBuffer);
+
 void arm_rfft_fast_f32(
   arm_rfft_fast_instance_f32 * S,
   float32_t * p, float32_t * pOut,
   uint8_t ifftFlag);
 
+  /**
+   * @brief Instance structure for the Q15 fast RFFT/RIFFT function.
+   */
+  typedef struct
+  {
+    const arm_cfft_instance_q15 *pCfft;  /**< points to the fftLenRFFT/2 points complex FFT instance. */
+    uint16_t fftLenRFFT;                 /**< length of the real sequence */
+    const q15_t *pTwiddleRFFT;           /**< Twiddle factors real stage */
+  } arm_rfft_fast_instance_q15;
+
+arm_status arm_rfft_fast_init_q15(
+  arm_rfft_fast_instance_q15 * S,
+  uint16_t fftLen);
+
+void arm_rfft_fast_q15(
+  const arm_rfft_fast_instance_q15 * S,
+  q15_t * p,
+  q15_t * pOut,
+  uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the Q31 fast RFFT/RIFFT function.
+   */
+  typedef struct
+  {
+    const arm_cfft_instance_q31 *pCfft;  /**< points to the fftLenRFFT/2 points complex FFT instance. */
+    uint16_t fftLenRFFT;                 /**< length of the real sequence */
+    const q31_t *pTwiddleRFFT;           /**< Twiddle factors real stage */
+  } arm_rfft_fast_instance_q31;
+
+arm_status arm_rfft_fast_init_q31(
+  arm_rfft_fast_instance_q31 * S,
+  uint16_t fftLen);
+
+void arm_rfft_fast_q31(
+  const arm_rfft_fast_instance_q31 * S,
+  q31_t * p,
+  q31_t * pOut,
+  uint8_t ifftFlag);
+
+  /**
+   * @brief Maximum number of radix stages of the mixed-radix CFFT.
+   */
+#define ARM_CFFT_MIXED_MAX_STAGES   16U
+
+  /**
+   * @brief Instance structure for the floating-point mixed-radix CFFT/CIFFT function.
+   */
+  typedef struct
+  {
+    uint16_t fftLen;                              /**< length of the FFT. */
+    uint16_t numStages;                           /**< number of radix stages. */
+    uint8_t radix[ARM_CFFT_MIXED_MAX_STAGES];     /**< radix of each stage: 4, 2, 3 or 5. */
+    const float32_t *pTwiddle;                    /**< points to the twiddle factors of the stages. */
+    float32_t *pScratch;                          /**< points to the work buffer of 2*fftLen values. */
+  } arm_cfft_mixed_instance_f32;
+
+  void arm_cfft_mixed_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+  float32_t * p1,
+  uint8_t ifftFlag);
+
+  arm_status arm_cfft_mixed_init_f32(
+  arm_cfft_mixed_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pBuffer);
+
+  /**
+   * @brief Instance structure for the floating-point mixed-radix RFFT/RIFFT function.
+   */
+  typedef struct
+  {
+    arm_cfft_mixed_instance_f32 Sint;  /**< Internal fftLenRFFT/2 points CFFT structure. */
+    uint16_t fftLenRFFT;               /**< length of the real sequence */
+    const float32_t *pTwiddleRFFT;     /**< Twiddle factors real stage */
+  } arm_rfft_mixed_instance_f32;
+
+  void arm_rfft_mixed_f32(
+  const arm_rfft_mixed_instance_f32 * S,
+  float32_t * p,
+  float32_t * pOut,
+  uint8_t ifftFlag);
+
+  arm_status arm_rfft_mixed_init_f32(
+  arm_rfft_mixed_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pBuffer);
+
+  /**
+   * @brief Frames output by the floating-point STFT.
+   */
+  typedef enum
+  {
+    ARM_STFT_SPECTRUM = 0,             /**< packed spectrum of arm_rfft_fast_f32(), fftLen values per frame */
+    ARM_STFT_MAGNITUDE = 1,            /**< magnitude of the bins 0 to fftLen/2, fftLen/2+1 values per frame */
+    ARM_STFT_POWER = 2                 /**< squared magnitude of the bins 0 to fftLen/2, fftLen/2+1 values per frame */
+  } arm_stft_output;
+
+  /**
+   * @brief Instance structure for the floating-point STFT.
+   */
+  typedef struct
+  {
+    arm_rfft_fast_instance_f32 Srfft;  /**< fftLen points real FFT structure. */
+    uint16_t fftLen;                   /**< length of the frames and of the FFT. */
+    uint16_t hopSize;                  /**< number of input samples between two frames. */
+    uint16_t stateIndex;               /**< state buffer index. Points to the oldest sample of the ring. */
+    uint16_t hopCount;                 /**< number of input samples since the last frame. */
+    arm_stft_output outputType;        /**< frames output. */
+    const float32_t *pWindow;          /**< points to the analysis window of fftLen values. */
+    float32_t *pState;                 /**< points to the state buffer of 3*fftLen values: ring of the last fftLen input samples and work buffers. */
+  } arm_stft_instance_f32;
+
+  arm_status arm_stft_init_f32(
+  arm_stft_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  const float32_t * pWindow,
+  float32_t * pState,
+  arm_stft_output outputType);
+
+  uint32_t arm_stft_f32(
+  arm_stft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point inverse STFT.
+   */
+  typedef struct
+  {
+    arm_rfft_fast_instance_f32 Srfft;  /**< fftLen points real FFT structure. */
+    uint16_t fftLen;                   /**< length of the frames and of the FFT. */
+    uint16_t hopSize;                  /**< number of output samples per frame. */
+    uint16_t stateIndex;               /**< state buffer index. Points to the oldest sample of the overlap-add ring. */
+    float32_t *pState;                 /**< points to the state buffer of 3*fftLen values: synthesis window, overlap-add ring and work buffer. */
+  } arm_istft_instance_f32;
+
+  arm_status arm_istft_init_f32(
+  arm_istft_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  const float32_t * pWindow,
+  float32_t * pState);
+
+  void arm_istft_f32(
+  arm_istft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numFrames);
+
+  /**
+   * @brief Instance structure for the floating-point Goertzel filter bank.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                  /**< number of frequency bins. */
+    uint16_t blockLen;                 /**< length N of the detection blocks: bin k is at k/N times the sampling rate. */
+    uint16_t sampleCount;              /**< number of samples of the current block already processed. */
+    float32_t *pCoeffs;                /**< points to the coefficients lambda, sin(2*pi*k/N) of the bins, array of length 2*numBins. */
+    float32_t *pState;                 /**< points to the state s[n-1], d[n-1] of the bins, array of length 2*numBins. */
+  } arm_goertzel_instance_f32;
+
+  arm_status arm_goertzel_init_f32(
+  arm_goertzel_instance_f32 * S,
+  uint16_t numBins,
+  uint16_t blockLen,
+  const uint16_t * pBins,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
+  uint32_t arm_goertzel_f32(
+  arm_goertzel_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q31 Goertzel filter bank.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                  /**< number of frequency bins. */
+    uint16_t blockLen;                 /**< length N of the detection blocks: bin k is at k/N times the sampling rate. */
+    uint16_t sampleCount;              /**< number of samples of the current block already processed. */
+    q31_t invBlockLen;                 /**< 1/N in Q31, scaling of the outputs. */
+    q31_t *pCoeffs;                    /**< points to the coefficients cos(2*pi*k/N), sin(2*pi*k/N) of the bins, array of length 2*numBins. */
+    q63_t *pState;                     /**< points to the state s[n-1], s[n-2] of the bins, array of length 2*numBins. */
+  } arm_goertzel_instance_q31;
+
+  arm_status arm_goertzel_init_q31(
+  arm_goertzel_instance_q31 * S,
+  uint16_t numBins,
+  uint16_t blockLen,
+  const uint16_t * pBins,
+  q31_t * pCoeffs,
+  q63_t * pState);
+
+  uint32_t arm_goertzel_q31(
+  arm_goertzel_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q15 Goertzel filter bank.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                  /**< number of frequency bins. */
+    uint16_t blockLen;                 /**< length N of the detection blocks: bin k is at k/N times the sampling rate. */
+    uint16_t sampleCount;              /**< number of samples of the current block already processed. */
+    q31_t invBlockLen;                 /**< 1/N in Q31, scaling of the outputs. */
+    q31_t *pCoeffs;                    /**< points to the coefficients cos(2*pi*k/N), sin(2*pi*k/N) of the bins, array of length 2*numBins. */
+    q31_t *pState;                     /**< points to the state s[n-1], s[n-2] of the bins, array of length 2*numBins. */
+  } arm_goertzel_instance_q15;
+
+  arm_status arm_goertzel_init_q15(
+  arm_goertzel_instance_q15 * S,
+  uint16_t numBins,
+  uint16_t blockLen,
+  const uint16_t * pBins,
+  q31_t * pCoeffs,
+  q31_t * pState);
+
+  uint32_t arm_goertzel_q15(
+  arm_goertzel_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point sliding DFT.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                  /**< number of frequency bins. */
+    uint16_t fftLen;                   /**< length N of the sliding window. */
+    uint16_t stateIndex;               /**< delay line index. Points to the oldest sample of the window. */
+    const uint16_t *pBins;             /**< points to the bins k, array of length numBins. */
+    float32_t *pCoeffs;                /**< points to the factors cos(2*pi*m/N), sin(2*pi*m/N), array of length 2*fftLen. */
+    float32_t *pState;                 /**< points to the delay line of the last N input samples, array of length fftLen. */
+    float32_t *pSum;                   /**< points to the modulated sums of the bins, array of length 2*numBins. */
+  } arm_sdft_instance_f32;
+
+  arm_status arm_sdft_init_f32(
+  arm_sdft_instance_f32 * S,
+  uint16_t numBins,
+  uint16_t fftLen,
+  const uint16_t * pBins,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t * pSum);
+
+  void arm_sdft_f32(
+  arm_sdft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q31 sliding DFT.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                  /**< number of frequency bins. */
+    uint16_t fftLen;                   /**< length N of the sliding window. */
+    uint16_t stateIndex;               /**< delay line index. Points to the oldest sample of the window. */
+    q31_t invFftLen;                   /**< 1/N in Q31, scaling of the outputs. */
+    const uint16_t *pBins;             /**< points to the bins k, array of length numBins. */
+    q31_t *pCoeffs;                    /**< points to the factors cos(2*pi*m/N), sin(2*pi*m/N), array of length 2*fftLen. */
+    q31_t *pState;                     /**< points to the delay line of the last N input samples, array of length fftLen. */
+    q63_t *pSum;                       /**< points to the modulated sums of the bins, array of length 2*numBins. */
+  } arm_sdft_instance_q31;
+
+  arm_status arm_sdft_init_q31(
+  arm_sdft_instance_q31 * S,
+  uint16_t numBins,
+  uint16_t fftLen,
+  const uint16_t * pBins,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  q63_t * pSum);
+
+  void arm_sdft_q31(
+  arm_sdft_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q15 sliding DFT.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                  /**< number of frequency bins. */
+    uint16_t fftLen;                   /**< length N of the sliding window. */
+    uint16_t stateIndex;               /**< delay line index. Points to the oldest sample of the window. */
+    q31_t invFftLen;                   /**< 1/N in Q31, scaling of the outputs. */
+    const uint16_t *pBins;             /**< points to the bins k, array of length numBins. */
+    q15_t *pCoeffs;                    /**< points to the factors cos(2*pi*m/N), sin(2*pi*m/N), array of length 2*fftLen. */
+    q15_t *pState;                     /**< points to the delay line of the last N input samples, array of length fftLen. */
+    q63_t *pSum;                       /**< points to the modulated sums of the bins, array of length 2*numBins. */
+  } arm_sdft_instance_q15;
+
+  arm_status arm_sdft_init_q15(
+  arm_sdft_instance_q15 * S,
+  uint16_t numBins,
+  uint16_t fftLen,
+  const uint16_t * pBins,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  q63_t * pSum);
+
+  void arm_sdft_q15(
+  arm_sdft_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
   /**
    * @brief Instance structure for the floating-point DCT4/IDCT4 function.
    */
@@ -3543,6 +4000,171 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief Instance structure for the Q15 FIR rational resampler.
+   */
+  typedef struct
+  {
+    uint16_t L;                     /**< upsample factor. */
+    uint16_t M;                     /**< downsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    uint32_t blockSize;             /**< number of input samples the state buffer holds, besides the phaseLength-1 previous ones. */
+    uint32_t phase;                 /**< position of the next output sample, at the upsampled rate, from the next input sample. */
+    q15_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q15_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_resample_instance_q15;
+
+
+  /**
+   * @brief Processing function for the Q15 FIR rational resampler.
+   * @param[in]     S        points to an instance of the Q15 FIR rational resampler structure.
+   * @param[in]     pSrc     points to the block of input data.
+   * @param[out]    pDst     points to the block of output data.
+   * @param[in,out] pSrcLen  on input, number of input samples available, on output, number of input samples consumed.
+   * @param[in]     dstLen   number of output samples the output buffer can hold.
+   * @return        number of output samples written.
+   */
+  uint32_t arm_fir_resample_q15(
+  arm_fir_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t * pSrcLen,
+  uint32_t dstLen);
+
+
+  /**
+   * @brief  Initialization function for the Q15 FIR rational resampler.
+   * @param[in,out] S          points to an instance of the Q15 FIR rational resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples processed at once.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * <code>L</code>, <code>M</code> or <code>blockSize</code> is zero or the filter length <code>numTaps</code> is
+   * not a non zero multiple of <code>L</code>.
+   */
+  arm_status arm_fir_resample_init_q15(
+  arm_fir_resample_instance_q15 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the Q31 FIR rational resampler.
+   */
+  typedef struct
+  {
+    uint16_t L;                     /**< upsample factor. */
+    uint16_t M;                     /**< downsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    uint32_t blockSize;             /**< number of input samples the state buffer holds, besides the phaseLength-1 previous ones. */
+    uint32_t phase;                 /**< position of the next output sample, at the upsampled rate, from the next input sample. */
+    q31_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q31_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_resample_instance_q31;
+
+
+  /**
+   * @brief Processing function for the Q31 FIR rational resampler.
+   * @param[in]     S        points to an instance of the Q31 FIR rational resampler structure.
+   * @param[in]     pSrc     points to the block of input data.
+   * @param[out]    pDst     points to the block of output data.
+   * @param[in,out] pSrcLen  on input, number of input samples available, on output, number of input samples consumed.
+   * @param[in]     dstLen   number of output samples the output buffer can hold.
+   * @return        number of output samples written.
+   */
+  uint32_t arm_fir_resample_q31(
+  arm_fir_resample_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t * pSrcLen,
+  uint32_t dstLen);
+
+
+  /**
+   * @brief  Initialization function for the Q31 FIR rational resampler.
+   * @param[in,out] S          points to an instance of the Q31 FIR rational resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples processed at once.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * <code>L</code>, <code>M</code> or <code>blockSize</code> is zero or the filter length <code>numTaps</code> is
+   * not a non zero multiple of <code>L</code>.
+   */
+  arm_status arm_fir_resample_init_q31(
+  arm_fir_resample_instance_q31 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the floating-point FIR rational resampler.
+   */
+  typedef struct
+  {
+    uint16_t L;                     /**< upsample factor. */
+    uint16_t M;                     /**< downsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    uint32_t blockSize;             /**< number of input samples the state buffer holds, besides the phaseLength-1 previous ones. */
+    uint32_t phase;                 /**< position of the next output sample, at the upsampled rate, from the next input sample. */
+    float32_t *pCoeffs;             /**< points to the coefficient array. The array is of length L*phaseLength. */
+    float32_t *pState;              /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_resample_instance_f32;
+
+
+  /**
+   * @brief Processing function for the floating-point FIR rational resampler.
+   * @param[in]     S        points to an instance of the floating-point FIR rational resampler structure.
+   * @param[in]     pSrc     points to the block of input data.
+   * @param[out]    pDst     points to the block of output data.
+   * @param[in,out] pSrcLen  on input, number of input samples available, on output, number of input samples consumed.
+   * @param[in]     dstLen   number of output samples the output buffer can hold.
+   * @return        number of output samples written.
+   */
+  uint32_t arm_fir_resample_f32(
+  arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t * pSrcLen,
+  uint32_t dstLen);
+
+
+  /**
+   * @brief  Initialization function for the floating-point FIR rational resampler.
+   * @param[in,out] S          points to an instance of the floating-point FIR rational resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples processed at once.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * <code>L</code>, <code>M</code> or <code>blockSize</code> is zero or the filter length <code>numTaps</code> is
+   * not a non zero multiple of <code>L</code>.
+   */
+  arm_status arm_fir_resample_init_f32(
+  arm_fir_resample_instance_f32 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+
   /**
    * @brief Instance structure for the high precision Q31 Biquad cascade filter.
    */
@@ -4925,6 +5547,141 @@ void arm_rfft_fast_f32(
   arm_matrix_instance_f64 * dst);
 
 
+  /**
+   * @brief Floating-point Cholesky decomposition of a symmetric positive definite matrix.
+   * @param[in]  pSrc  points to the input matrix structure, only its lower triangle is read.
+   * @param[out] pDst  points to the output matrix structure, lower triangular factor L. May be pSrc.
+   * @return ARM_MATH_SIZE_MISMATCH if the matrices are not square and of the same size,
+   * ARM_MATH_DECOMPOSITION_FAILURE if the input matrix is not positive definite, ARM_MATH_SUCCESS otherwise.
+   */
+  arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Floating-point solve of L * L' * X = B.
+   * @param[in]  pL  points to the Cholesky factor, N x N.
+   * @param[in]  pB  points to the right-hand sides, N x K.
+   * @param[out] pX  points to the solutions, N x K. May be pB.
+   * @return The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+  arm_status arm_mat_cholesky_solve_f32(
+  const arm_matrix_instance_f32 * pL,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX);
+
+
+  /**
+   * @brief Double precision floating-point Cholesky decomposition of a symmetric positive definite matrix.
+   * @param[in]  pSrc  points to the input matrix structure, only its lower triangle is read.
+   * @param[out] pDst  points to the output matrix structure, lower triangular factor L. May be pSrc.
+   * @return ARM_MATH_SIZE_MISMATCH if the matrices are not square and of the same size,
+   * ARM_MATH_DECOMPOSITION_FAILURE if the input matrix is not positive definite, ARM_MATH_SUCCESS otherwise.
+   */
+  arm_status arm_mat_cholesky_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst);
+
+
+  /**
+   * @brief Double precision floating-point solve of L * L' * X = B.
+   * @param[in]  pL  points to the Cholesky factor, N x N.
+   * @param[in]  pB  points to the right-hand sides, N x K.
+   * @param[out] pX  points to the solutions, N x K. May be pB.
+   * @return The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+  arm_status arm_mat_cholesky_solve_f64(
+  const arm_matrix_instance_f64 * pL,
+  const arm_matrix_instance_f64 * pB,
+  arm_matrix_instance_f64 * pX);
+
+
+  /**
+   * @brief Floating-point LDL' decomposition of a symmetric matrix, without pivoting.
+   * @param[in]  pSrc  points to the input matrix structure, only its lower triangle is read.
+   * @param[out] pDst  points to the output matrix structure: unit lower triangular L below
+   *                   the diagonal and D on the diagonal. May be pSrc.
+   * @return ARM_MATH_SIZE_MISMATCH if the matrices are not square and of the same size,
+   * ARM_MATH_DECOMPOSITION_FAILURE if a pivot is zero, ARM_MATH_SUCCESS otherwise.
+   */
+  arm_status arm_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Floating-point solve of L * D * L' * X = B.
+   * @param[in]  pLD  points to the factors computed by arm_mat_ldlt_f32, N x N.
+   * @param[in]  pB   points to the right-hand sides, N x K.
+   * @param[out] pX   points to the solutions, N x K. May be pB.
+   * @return The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+  arm_status arm_mat_ldlt_solve_f32(
+  const arm_matrix_instance_f32 * pLD,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX);
+
+
+  /**
+   * @brief Floating-point solve of a lower triangular system by forward substitution.
+   * @param[in]  pLT  points to the lower triangular matrix, N x N, its upper triangle is not read.
+   * @param[in]  pB   points to the right-hand sides, N x K.
+   * @param[out] pX   points to the solutions, N x K. May be pB.
+   * @return ARM_MATH_SIZE_MISMATCH, ARM_MATH_SINGULAR if a diagonal element is zero, or ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pLT,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX);
+
+
+  /**
+   * @brief Floating-point solve of an upper triangular system by back substitution.
+   * @param[in]  pUT  points to the upper triangular matrix, N x N, its lower triangle is not read.
+   * @param[in]  pB   points to the right-hand sides, N x K.
+   * @param[out] pX   points to the solutions, N x K. May be pB.
+   * @return ARM_MATH_SIZE_MISMATCH, ARM_MATH_SINGULAR if a diagonal element is zero, or ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * pUT,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX);
+
+
+  /**
+   * @brief Floating-point Householder QR decomposition.
+   * @param[in]  pSrc  points to the input matrix structure, M x N with M >= N.
+   * @param[out] pDst  points to the output matrix structure, M x N: R on and above the
+   *                   diagonal, Householder vectors below it. May be pSrc.
+   * @param[out] pTau  points to the N scalars of the Householder reflections.
+   * @return The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+  arm_status arm_mat_qr_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst,
+  float32_t * pTau);
+
+
+  /**
+   * @brief Floating-point least squares solve of A * X = B with the QR decomposition of A.
+   * @param[in]     pQR   points to the decomposition computed by arm_mat_qr_f32, M x N.
+   * @param[in]     pTau  points to the N scalars of the Householder reflections.
+   * @param[in,out] pB    points to the right-hand sides, M x K, overwritten by Q' * B.
+   * @param[out]    pX    points to the solutions, N x K. pX->pData may be pB->pData.
+   * @return ARM_MATH_SIZE_MISMATCH, ARM_MATH_SINGULAR if R has a zero on its diagonal, or ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_qr_solve_f32(
+  const arm_matrix_instance_f32 * pQR,
+  const float32_t * pTau,
+  arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX);
+
+
 
   /**
    * @ingroup groupController
@@ -5840,12 +6597,13 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0U;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    int32_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -5858,7 +6616,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if (dst == (int32_t *) dst_end)
+      if (dst == dst_end)
       {
         dst = dst_base;
       }
@@ -5939,13 +6697,14 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    q15_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
 
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -5958,7 +6717,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if (dst == (q15_t *) dst_end)
+      if (dst == dst_end)
       {
         dst = dst_base;
       }
@@ -6039,13 +6798,14 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    q7_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
 
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -6058,7 +6818,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if (dst == (q7_t *) dst_end)
+      if (dst == dst_end)
       {
         dst = dst_base;
       }
@@ -0,0 +1,367 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_math_host.h
+ * Description:  Core definitions and C emulation of the Cortex-M intrinsics
+ *               for host (PC) builds of the library
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: x86, x86-64, AArch64 hosts (GCC, Clang)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Included by arm_math.h in place of the core_cmX.h header when ARM_MATH_HOST
+ * is defined. The code path of the library is selected as for a target:
+ *   - ARM_MATH_HOST                     : Cortex-M3 code (no DSP extension)
+ *   - ARM_MATH_HOST and ARM_MATH_DSP    : Cortex-M4/M7 code, the SIMD
+ *                                         intrinsics being emulated
+ *   - ARM_MATH_HOST and ARM_MATH_CM0_FAMILY : Cortex-M0 code
+ * The emulated intrinsics return the same bits as the instructions, so the
+ * fixed-point results of a host build match the ones of the target build.
+ * The Q flag set by the saturating instructions is not modelled: the library
+ * does not read it.
+ * ARM_MATH_HOST_SIMD adds the vector types used by the host vector code.
+ */
+
+#ifndef _ARM_MATH_HOST_H
+#define _ARM_MATH_HOST_H
+
+#include <stdint.h>
+
+#if !defined ( __GNUC__ )
+  #error "ARM_MATH_HOST requires GCC or Clang"
+#endif
+
+#ifndef   __ASM
+  #define __ASM                         __asm
+#endif
+#ifndef   __INLINE
+  #define __INLINE                      inline
+#endif
+#ifndef   __STATIC_INLINE
+  #define __STATIC_INLINE               static inline
+#endif
+
+/* Floating-point operations are compiled for the host FPU, sqrtf() is used */
+#ifndef   __FPU_USED
+  #define __FPU_USED                    0U
+#endif
+
+/* Core instructions available on every Cortex-M */
+
+__attribute__((always_inline)) __STATIC_INLINE uint32_t __CLZ(uint32_t value)
+{
+  return (value == 0U) ? 32U : (uint32_t)__builtin_clz(value);
+}
+
+__attribute__((always_inline)) __STATIC_INLINE uint32_t __ROR(uint32_t op1, uint32_t op2)
+{
+  op2 %= 32U;
+  return (op2 == 0U) ? op1 : ((op1 >> op2) | (op1 << (32U - op2)));
+}
+
+__attribute__((always_inline)) __STATIC_INLINE int32_t __SSAT(int32_t val, uint32_t sat)
+{
+  if ((sat >= 1U) && (sat <= 32U))
+  {
+    const int32_t max = (int32_t)((1ULL << (sat - 1U)) - 1U);
+    const int32_t min = -1 - max;
+    if (val > max)
+    {
+      return max;
+    }
+    else if (val < min)
+    {
+      return min;
+    }
+  }
+  return val;
+}
+
+__attribute__((always_inline)) __STATIC_INLINE uint32_t __USAT(int32_t val, uint32_t sat)
+{
+  if (sat <= 31U)
+  {
+    const uint32_t max = ((1U << sat) - 1U);
+    if (val > (int32_t)max)
+    {
+      return max;
+    }
+    else if (val < 0)
+    {
+      return 0U;
+    }
+  }
+  return (uint32_t)val;
+}
+
+#if defined (ARM_MATH_DSP)
+
+/* Lanes of a packed operand: signed halfwords and bytes */
+#define __HOST_LO16(x)      ((int32_t)(int16_t)(uint16_t)((uint32_t)(x)))
+#define __HOST_HI16(x)      ((int32_t)(int16_t)(uint16_t)((uint32_t)(x) >> 16))
+#define __HOST_B(x, n)      ((int32_t)(int8_t)(uint8_t)((uint32_t)(x) >> (8U * (n))))
+#define __HOST_PACK16(lo, hi) \
+  ((((uint32_t)(lo)) & 0x0000FFFFU) | (((uint32_t)(hi)) << 16))
+
+__attribute__((always_inline)) __STATIC_INLINE uint32_t __QADD8(uint32_t op1, uint32_t op2)
+{
+  uint32_t r = 0U;
+  uint32_t n;
+  for (n = 0U; n < 4U; n++)
+  {
+    r |= ((uint32_t)__SSAT(__HOST_B(op1, n) + __HOST_B(op2, n), 8U) & 0xFFU) << (8U * n);
+  }
+  return r;
+}
+
+__attribute__((always_inline)) __STATIC_INLINE uint32_t __QSUB8(uint32_t op1, uint32_t op2)
+{
+  uint32_t r = 0U;
+  uint32_t n;
+  for (n = 0U; n < 4U; n++)
+  {
+    r |= ((uint32_t)__SSAT(__HOST_B(op1, n) - __HOST_B(op2, n), 8U) & 0xFFU) << (8U * n);
+  }
+  return r;
+}
+
+__attribute__((always_inline)) __STATIC_INLINE uint32_t __QADD16(uint32_t op1, uint32_t op2)
+{
+  return __HOST_PACK16(__SSAT(__HOST_LO16(op1) + __HOST_LO16(op2), 16U),
+                       __SSAT(__HOST_HI16(op1) + __HOST_HI16(op2), 16U));
+}
+
+__attribute__((always_inline)) __STATIC_INLINE uint32_t __SHADD16(uint32_t op1, uint32_t op2)
+{
+  return __HOST_PACK16((__HOST_LO16(op1) + __HOST_LO16(op2)) >> 1,
+                       (__HOST_HI16(op1) + __HOST_HI16(op2)) >> 1);
+}
+
+__attribute__((always_inline)) __STATIC_INLINE uint32_t __QSUB16(uint32_t op1, uint32_t op2)
+{
+  return __HOST_PACK16(__SSAT(__HOST_LO16(op1) - __HOST_LO16(op2), 16U),
+                       __SSAT(__HOST_HI16(op1) - __HOST_HI16(op2), 16U));
+}
+
+__attribute__((always_inline)) __STATIC_INLINE uint32_t __SHSUB16(uint32_t op1, uint32_t op2)
+{
+  return __HOST_PACK16((__HOST_LO16(op1) - __HOST_LO16(op2)) >> 1,
+                       (__HOST_HI16(op1) - __HOST_HI16(op2)) >> 1);
+}
+
+__attribute__((always_inline)) __STATIC_INLINE uint32_t __QASX(uint32_t op1, uint32_t op2)
+{
+  return __HOST_PACK16(__SSAT(__HOST_LO16(op1) - __HOST_HI16(op2), 16U),
+                       __SSAT(__HOST_HI16(op1) + __HOST_LO16(op2), 16U));
+}
+
+__attribute__((always_inline)) __STATIC_INLINE uint32_t __SHASX(uint32_t op1, uint32_t op2)
+{
+  return __HOST_PACK16((__HOST_LO16(op1) - __HOST_HI16(op2)) >> 1,
+                       (__HOST_HI16(op1) + __HOST_LO16(op2)) >> 1);
+}
+
+__attribute__((always_inline)) __STATIC_INLINE uint32_t __QSAX(uint32_t op1, uint32_t op2)
+{
+  return __HOST_PACK16(__SSAT(__HOST_LO16(op1) + __HOST_HI16(op2), 16U),
+                       __SSAT(__HOST_HI16(op1) - __HOST_LO16(op2), 16U));
+}
+
+__attribute__((always_inline)) __STATIC_INLINE uint32_t __SHSAX(uint32_t op1, uint32_t op2)
+{
+  return __HOST_PACK16((__HOST_LO16(op1) + __HOST_HI16(op2)) >> 1,
+                       (__HOST_HI16(op1) - __HOST_LO16(op2)) >> 1);
+}
+
+/* The dual multiplies wrap modulo 2^32 (or 2^64) like the instructions */
+__attribute__((always_inline)) __STATIC_INLINE uint32_t __SMUAD(uint32_t op1, uint32_t op2)
+{
+  return (uint32_t)(__HOST_LO16(op1) * __HOST_LO16(op2)) +
+         (uint32_t)(__HOST_HI16(op1) * __HOST_HI16(op2));
+}
+
+__attribute__((always_inline)) __STATIC_INLINE uint32_t __SMUADX(uint32_t op1, uint32_t op2)
+{
+  return (uint32_t)(__HOST_LO16(op1) * __HOST_HI16(op2)) +
+         (uint32_t)(__HOST_HI16(op1) * __HOST_LO16(op2));
+}
+
+__attribute__((always_inline)) __STATIC_INLINE uint32_t __SMUSD(uint32_t op1, uint32_t op2)
+{
+  return (uint32_t)(__HOST_LO16(op1) * __HOST_LO16(op2)) -
+         (uint32_t)(__HOST_HI16(op1) * __HOST_HI16(op2));
+}
+
+__attribute__((always_inline)) __STATIC_INLINE uint32_t __SMUSDX(uint32_t op1, uint32_t op2)
+{
+  return (uint32_t)(__HOST_LO16(op1) * __HOST_HI16(op2)) -
+         (uint32_t)(__HOST_HI16(op1) * __HOST_LO16(op2));
+}
+
+__attribute__((always_inline)) __STATIC_INLINE uint32_t __SMLAD(uint32_t op1, uint32_t op2, uint32_t op3)
+{
+  return __SMUAD(op1, op2) + op3;
+}
+
+__attribute__((always_inline)) __STATIC_INLINE uint32_t __SMLADX(uint32_t op1, uint32_t op2, uint32_t op3)
+{
+  return __SMUADX(op1, op2) + op3;
+}
+
+__attribute__((always_inline)) __STATIC_INLINE uint32_t __SMLSD(uint32_t op1, uint32_t op2, uint32_t op3)
+{
+  return __SMUSD(op1, op2) + op3;
+}
+
+__attribute__((always_inline)) __STATIC_INLINE uint32_t __SMLSDX(uint32_t op1, uint32_t op2, uint32_t op3)
+{
+  return __SMUSDX(op1, op2) + op3;
+}
+
+__attribute__((always_inline)) __STATIC_INLINE uint64_t __SMLALD(uint32_t op1, uint32_t op2, uint64_t acc)
+{
+  return acc + (uint64_t)(int64_t)(__HOST_LO16(op1) * __HOST_LO16(op2)) +
+               (uint64_t)(int64_t)(__HOST_HI16(op1) * __HOST_HI16(op2));
+}
+
+__attribute__((always_inline)) __STATIC_INLINE uint64_t __SMLALDX(uint32_t op1, uint32_t op2, uint64_t acc)
+{
+  return acc + (uint64_t)(int64_t)(__HOST_LO16(op1) * __HOST_HI16(op2)) +
+               (uint64_t)(int64_t)(__HOST_HI16(op1) * __HOST_LO16(op2));
+}
+
+__attribute__((always_inline)) __STATIC_INLINE uint32_t __SXTB16(uint32_t op1)
+{
+  return __HOST_PACK16(__HOST_B(op1, 0U), __HOST_B(op1, 2U));
+}
+
+__attribute__((always_inline)) __STATIC_INLINE int32_t __QADD(int32_t op1, int32_t op2)
+{
+  const int64_t r = (int64_t)op1 + op2;
+  return (r > INT32_MAX) ? INT32_MAX : ((r < INT32_MIN) ? INT32_MIN : (int32_t)r);
+}
+
+__attribute__((always_inline)) __STATIC_INLINE int32_t __QSUB(int32_t op1, int32_t op2)
+{
+  const int64_t r = (int64_t)op1 - op2;
+  return (r > INT32_MAX) ? INT32_MAX : ((r < INT32_MIN) ? INT32_MIN : (int32_t)r);
+}
+
+__attribute__((always_inline)) __STATIC_INLINE int32_t __SMMLA(int32_t op1, int32_t op2, int32_t op3)
+{
+  return (int32_t)((uint32_t)op3 + (uint32_t)(((int64_t)op1 * op2) >> 32));
+}
+
+#define __PKHBT(ARG1, ARG2, ARG3) \
+  ((int32_t)((((uint32_t)(ARG1)) & 0x0000FFFFU) | (((uint32_t)(ARG2) << (ARG3)) & 0xFFFF0000U)))
+#define __PKHTB(ARG1, ARG2, ARG3) \
+  ((int32_t)((((uint32_t)(ARG1)) & 0xFFFF0000U) | (((uint32_t)((int32_t)(ARG2) >> (ARG3))) & 0x0000FFFFU)))
+
+#endif /* defined (ARM_MATH_DSP) */
+
+#if defined (ARM_MATH_HOST_SIMD)
+
+/*
+ * Vector types of the host vector code (GCC vector extensions). The vectors
+ * are 256-bit when the compiler targets AVX, 128-bit otherwise.
+ */
+#if defined (__AVX__)
+  #define ARM_HOST_VBYTES               32
+#else
+  #define ARM_HOST_VBYTES               16
+#endif
+#define ARM_HOST_F32_LANES              (ARM_HOST_VBYTES / 4)
+
+typedef float   arm_host_f32v   __attribute__((vector_size(ARM_HOST_VBYTES)));
+typedef int32_t arm_host_i32v   __attribute__((vector_size(ARM_HOST_VBYTES)));
+typedef float   arm_host_f32x4  __attribute__((vector_size(16)));
+typedef int32_t arm_host_i32x4  __attribute__((vector_size(16)));
+
+/* Unaligned views of the sample buffers */
+typedef float   arm_host_f32v_u __attribute__((vector_size(ARM_HOST_VBYTES), aligned(4), may_alias));
+typedef float   arm_host_f32x4_u __attribute__((vector_size(16), aligned(4), may_alias));
+
+/* Lane permutation of two vectors, the mask type giving the lane count */
+#if defined (__clang__)
+  #define ARM_HOST_SHUFFLE(mask_t, a, b, ...)   __builtin_shufflevector((a), (b), __VA_ARGS__)
+#else
+  #define ARM_HOST_SHUFFLE(mask_t, a, b, ...)   __builtin_shuffle((a), (b), (mask_t){ __VA_ARGS__ })
+#endif
+
+__attribute__((always_inline)) __STATIC_INLINE arm_host_f32v arm_host_load_f32v(const float * p)
+{
+  return *(const arm_host_f32v_u *)p;
+}
+
+__attribute__((always_inline)) __STATIC_INLINE void arm_host_store_f32v(float * p, arm_host_f32v v)
+{
+  *(arm_host_f32v_u *)p = v;
+}
+
+__attribute__((always_inline)) __STATIC_INLINE arm_host_f32v arm_host_dup_f32v(float x)
+{
+  return (arm_host_f32v){ 0 } + x;
+}
+
+/* Sum of the lanes, by halves */
+__attribute__((always_inline)) __STATIC_INLINE float arm_host_hsum_f32v(arm_host_f32v v)
+{
+#if (ARM_HOST_VBYTES == 32)
+  v = v + ARM_HOST_SHUFFLE(arm_host_i32v, v, v, 4, 5, 6, 7, 0, 1, 2, 3);
+#endif
+  return (v[0] + v[2]) + (v[1] + v[3]);
+}
+
+/* ARM_HOST_F32_LANES complex values {re, im} from and to separate vectors */
+__attribute__((always_inline)) __STATIC_INLINE void arm_host_load_cmplx_f32v(
+  const float * p,
+  arm_host_f32v * re,
+  arm_host_f32v * im)
+{
+  const arm_host_f32v lo = arm_host_load_f32v(p);
+  const arm_host_f32v hi = arm_host_load_f32v(p + ARM_HOST_F32_LANES);
+#if (ARM_HOST_VBYTES == 32)
+  *re = ARM_HOST_SHUFFLE(arm_host_i32v, lo, hi, 0, 2, 4, 6, 8, 10, 12, 14);
+  *im = ARM_HOST_SHUFFLE(arm_host_i32v, lo, hi, 1, 3, 5, 7, 9, 11, 13, 15);
+#else
+  *re = ARM_HOST_SHUFFLE(arm_host_i32v, lo, hi, 0, 2, 4, 6);
+  *im = ARM_HOST_SHUFFLE(arm_host_i32v, lo, hi, 1, 3, 5, 7);
+#endif
+}
+
+__attribute__((always_inline)) __STATIC_INLINE void arm_host_store_cmplx_f32v(
+  float * p,
+  arm_host_f32v re,
+  arm_host_f32v im)
+{
+#if (ARM_HOST_VBYTES == 32)
+  arm_host_store_f32v(p, ARM_HOST_SHUFFLE(arm_host_i32v, re, im, 0, 8, 1, 9, 2, 10, 3, 11));
+  arm_host_store_f32v(p + ARM_HOST_F32_LANES, ARM_HOST_SHUFFLE(arm_host_i32v, re, im, 4, 12, 5, 13, 6, 14, 7, 15));
+#else
+  arm_host_store_f32v(p, ARM_HOST_SHUFFLE(arm_host_i32v, re, im, 0, 4, 1, 5));
+  arm_host_store_f32v(p + ARM_HOST_F32_LANES, ARM_HOST_SHUFFLE(arm_host_i32v, re, im, 2, 6, 3, 7));
+#endif
+}
+
+#endif /* defined (ARM_MATH_HOST_SIMD) */
+
+#endif /* _ARM_MATH_HOST_H */
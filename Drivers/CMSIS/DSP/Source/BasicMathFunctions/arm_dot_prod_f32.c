@@ -70,7 +70,48 @@ void arm_dot_prod_f32(
   uint32_t blkCnt;                               /* loop counter */
 
 
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_HOST_SIMD)
+
+  /* Run the below code for host vector builds */
+  arm_host_f32v acc0 = { 0 }, acc1 = { 0 }, acc2 = { 0 }, acc3 = { 0 };
+
+  /* Four vector accumulators: 4 * ARM_HOST_F32_LANES samples per loop */
+  blkCnt = blockSize / (4U * ARM_HOST_F32_LANES);
+
+  while (blkCnt > 0U)
+  {
+    acc0 += arm_host_load_f32v(pSrcA) * arm_host_load_f32v(pSrcB);
+    acc1 += arm_host_load_f32v(pSrcA + ARM_HOST_F32_LANES) * arm_host_load_f32v(pSrcB + ARM_HOST_F32_LANES);
+    acc2 += arm_host_load_f32v(pSrcA + 2U * ARM_HOST_F32_LANES) * arm_host_load_f32v(pSrcB + 2U * ARM_HOST_F32_LANES);
+    acc3 += arm_host_load_f32v(pSrcA + 3U * ARM_HOST_F32_LANES) * arm_host_load_f32v(pSrcB + 3U * ARM_HOST_F32_LANES);
+    pSrcA += 4U * ARM_HOST_F32_LANES;
+    pSrcB += 4U * ARM_HOST_F32_LANES;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  acc0 = (acc0 + acc1) + (acc2 + acc3);
+
+  /* One vector per loop for the remaining full vectors */
+  blkCnt = (blockSize % (4U * ARM_HOST_F32_LANES)) / ARM_HOST_F32_LANES;
+
+  while (blkCnt > 0U)
+  {
+    acc0 += arm_host_load_f32v(pSrcA) * arm_host_load_f32v(pSrcB);
+    pSrcA += ARM_HOST_F32_LANES;
+    pSrcB += ARM_HOST_F32_LANES;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  sum = arm_host_hsum_f32v(acc0);
+
+  /* The remaining samples are processed below */
+  blkCnt = blockSize % ARM_HOST_F32_LANES;
+
+#elif defined (ARM_MATH_DSP)
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
   /*loop Unrolling */
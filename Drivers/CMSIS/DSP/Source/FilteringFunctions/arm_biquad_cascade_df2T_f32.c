@@ -150,13 +150,103 @@ uint32_t blockSize)
    float32_t *pOut = pDst;                        /*  destination pointer       */
    float32_t *pState = S->pState;                 /*  State pointer             */
    float32_t *pCoeffs = S->pCoeffs;               /*  coefficient pointer       */
+   float32_t Xn1;                                 /*  temporary input           */
+   uint32_t stage = S->numStages;                 /*  loop counter              */
+#if !defined (ARM_MATH_HOST_SIMD)
    float32_t acc1;                                /*  accumulator               */
    float32_t b0, b1, b2, a1, a2;                  /*  Filter coefficients       */
-   float32_t Xn1;                                 /*  temporary input           */
    float32_t d1, d2;                              /*  state variables           */
-   uint32_t sample, stage = S->numStages;         /*  loop counters             */
+   uint32_t sample;                               /*  loop counter              */
+#endif
+
+#if defined (ARM_MATH_HOST_SIMD)
+
+   /* Run the below code for host vector builds.
+    * Up to 4 stages are processed together, one per vector lane: at step t
+    * lane k filters the sample t - k, its input being the output of lane k - 1
+    * at the previous step. Outputs are delayed by the number of stages - 1.
+    * During the first and last steps of a block some lanes have no sample,
+    * their state variables are then left unchanged. */
+   const arm_host_i32x4 laneIdx = { 0, 1, 2, 3 };
+   arm_host_f32x4 b0v, b1v, b2v, a1v, a2v;        /*  Filter coefficients       */
+   arm_host_f32x4 d1v, d2v, xv, yv, accv;         /*  State and working vectors */
+   arm_host_f32x4 nd1, nd2;                       /*  Updated state variables   */
+   arm_host_i32x4 active;                         /*  Lanes with a sample       */
+   uint32_t numLanes, lane, t, tEnd;
+
+   do
+   {
+      numLanes = (stage < 4U) ? stage : 4U;
+
+      /* Unused lanes have zero coefficients and state, their outputs stay zero */
+      b0v = b1v = b2v = a1v = a2v = d1v = d2v = yv = (arm_host_f32x4) { 0 };
+
+      for (lane = 0U; lane < numLanes; lane++)
+      {
+         b0v[lane] = pCoeffs[0];
+         b1v[lane] = pCoeffs[1];
+         b2v[lane] = pCoeffs[2];
+         a1v[lane] = pCoeffs[3];
+         a2v[lane] = pCoeffs[4];
+         pCoeffs += 5U;
+
+         d1v[lane] = pState[2U * lane];
+         d2v[lane] = pState[2U * lane + 1U];
+      }
+
+      tEnd = blockSize + numLanes - 1U;
+
+      for (t = 0U; t < tEnd; t++)
+      {
+         Xn1 = (t < blockSize) ? pIn[t] : 0.0f;
+
+         /* Lane 0 takes the new sample, lane k the output of lane k - 1 */
+         xv = ARM_HOST_SHUFFLE(arm_host_i32x4, yv, (arm_host_f32x4) { 0 } + Xn1, 4, 0, 1, 2);
+
+         /* y[n] = b0 * x[n] + d1 */
+         /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+         /* d2 = b2 * x[n] + a2 * y[n] */
+         accv = b0v * xv + d1v;
+         nd1 = (b1v * xv + a1v * accv) + d2v;
+         nd2 = b2v * xv + a2v * accv;
+
+         if ((t >= numLanes - 1U) && (t < blockSize))
+         {
+            /* All lanes have a sample */
+            d1v = nd1;
+            d2v = nd2;
+         }
+         else
+         {
+            /* Lane k has the sample t - k if 0 <= t - k < blockSize */
+            active = (laneIdx <= (int32_t) t) & (laneIdx > (int32_t) t - (int32_t) blockSize);
+            d1v = (arm_host_f32x4) (((arm_host_i32x4) nd1 & active) | ((arm_host_i32x4) d1v & ~active));
+            d2v = (arm_host_f32x4) (((arm_host_i32x4) nd2 & active) | ((arm_host_i32x4) d2v & ~active));
+         }
+
+         yv = accv;
+
+         if (t >= numLanes - 1U)
+         {
+            pOut[t - (numLanes - 1U)] = accv[numLanes - 1U];
+         }
+      }
+
+      /* Store the updated state variables back into the state array */
+      for (lane = 0U; lane < numLanes; lane++)
+      {
+         *pState++ = d1v[lane];
+         *pState++ = d2v[lane];
+      }
+
+      /* The current stages output is given as the input to the next stages */
+      pIn = pDst;
+
+      stage -= numLanes;
+
+   } while (stage > 0U);
 
-#if defined(ARM_MATH_CM7)
+#elif defined(ARM_MATH_CM7)
 
    float32_t Xn2, Xn3, Xn4, Xn5, Xn6, Xn7, Xn8;   /*  Input State variables     */
    float32_t Xn9, Xn10, Xn11, Xn12, Xn13, Xn14, Xn15, Xn16;
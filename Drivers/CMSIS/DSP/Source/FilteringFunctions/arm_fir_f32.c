@@ -119,7 +119,134 @@
 *
 */
 
-#if defined(ARM_MATH_CM7)
+#if defined (ARM_MATH_HOST_SIMD)
+
+/* Run the below code for host vector builds */
+
+void arm_fir_f32(
+const arm_fir_instance_f32 * S,
+float32_t * pSrc,
+float32_t * pDst,
+uint32_t blockSize)
+{
+   float32_t *pState = S->pState;                 /* State pointer */
+   float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+   float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+   float32_t *px, *pb;                            /* Temporary pointers for state and coefficient buffers */
+   arm_host_f32v acc0, acc1, acc2, acc3, c0;      /* Vector accumulators and coefficient */
+   float32_t acc;                                 /* Accumulator of the remaining samples */
+   uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+   uint32_t i, tapCnt, blkCnt;                    /* Loop counters */
+
+   /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
+   /* pStateCurnt points to the location where the new input data should be written */
+   pStateCurnt = &(S->pState[(numTaps - 1U)]);
+
+   /* Copy the new input samples into the state buffer */
+   memcpy(pStateCurnt, pSrc, blockSize * sizeof(float32_t));
+
+   /* Each lane of a vector accumulator holds one output:
+    * acc0[k] = b[numTaps-1] * x[n+k-numTaps+1] + ... + b[0] * x[n+k],
+    * the state vectors being read at consecutive offsets.
+    * Compute 4 * ARM_HOST_F32_LANES outputs at a time. */
+   blkCnt = blockSize / (4U * ARM_HOST_F32_LANES);
+
+   while (blkCnt > 0U)
+   {
+      acc0 = (arm_host_f32v) { 0 };
+      acc1 = (arm_host_f32v) { 0 };
+      acc2 = (arm_host_f32v) { 0 };
+      acc3 = (arm_host_f32v) { 0 };
+
+      px = pState;
+      pb = pCoeffs;
+      tapCnt = numTaps;
+
+      while (tapCnt > 0U)
+      {
+         c0 = arm_host_dup_f32v(*pb++);
+
+         acc0 += c0 * arm_host_load_f32v(px);
+         acc1 += c0 * arm_host_load_f32v(px + ARM_HOST_F32_LANES);
+         acc2 += c0 * arm_host_load_f32v(px + 2U * ARM_HOST_F32_LANES);
+         acc3 += c0 * arm_host_load_f32v(px + 3U * ARM_HOST_F32_LANES);
+         px++;
+
+         tapCnt--;
+      }
+
+      arm_host_store_f32v(pDst, acc0);
+      arm_host_store_f32v(pDst + ARM_HOST_F32_LANES, acc1);
+      arm_host_store_f32v(pDst + 2U * ARM_HOST_F32_LANES, acc2);
+      arm_host_store_f32v(pDst + 3U * ARM_HOST_F32_LANES, acc3);
+
+      /* Advance the state and destination pointers */
+      pState += 4U * ARM_HOST_F32_LANES;
+      pDst += 4U * ARM_HOST_F32_LANES;
+
+      blkCnt--;
+   }
+
+   /* Compute the remaining full vectors of outputs one vector at a time */
+   blkCnt = (blockSize % (4U * ARM_HOST_F32_LANES)) / ARM_HOST_F32_LANES;
+
+   while (blkCnt > 0U)
+   {
+      acc0 = (arm_host_f32v) { 0 };
+
+      px = pState;
+      pb = pCoeffs;
+      tapCnt = numTaps;
+
+      while (tapCnt > 0U)
+      {
+         acc0 += arm_host_dup_f32v(*pb++) * arm_host_load_f32v(px);
+         px++;
+
+         tapCnt--;
+      }
+
+      arm_host_store_f32v(pDst, acc0);
+
+      pState += ARM_HOST_F32_LANES;
+      pDst += ARM_HOST_F32_LANES;
+
+      blkCnt--;
+   }
+
+   /* Compute the remaining output samples one at a time */
+   blkCnt = blockSize % ARM_HOST_F32_LANES;
+
+   while (blkCnt > 0U)
+   {
+      acc = 0.0f;
+
+      px = pState;
+      pb = pCoeffs;
+      i = numTaps;
+
+      do
+      {
+         acc += *px++ * *pb++;
+         i--;
+
+      } while (i > 0U);
+
+      *pDst++ = acc;
+
+      /* Advance state pointer by 1 for the next sample */
+      pState = pState + 1;
+
+      blkCnt--;
+   }
+
+   /* Processing is complete.
+   ** Now copy the last numTaps - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+   memmove(S->pState, pState, (numTaps - 1U) * sizeof(float32_t));
+}
+
+#elif defined(ARM_MATH_CM7)
 
 void arm_fir_f32(
 const arm_fir_instance_f32 * S,
@@ -0,0 +1,235 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_f32.c
+ * Description:  Floating-point polyphase FIR rational resampler
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_Resample Finite Impulse Response (FIR) Rational Resampler
+ *
+ * These functions change the sample rate of a signal by a rational factor <code>L/M</code>,
+ * for instance from 44.1 kHz to 16 kHz with <code>L=160</code> and <code>M=441</code>.
+ * Conceptually, they are an FIR interpolator (upsampler by <code>L</code> and lowpass filter)
+ * followed by a downsampler by <code>M</code>, which keeps one sample out of <code>M</code>.
+ * The lowpass filter must remove the images of the upsampling and the aliases of the downsampling:
+ * its normalized cutoff frequency is the smallest of <code>1/L</code> and <code>1/M</code>.
+ * The user of the function is responsible for providing the filter coefficients.
+ *
+ * The functions only compute the output samples which are kept. Each of them is the output of one
+ * of the <code>L</code> polyphase components of the filter, of length <code>phaseLength=numTaps/L</code>,
+ * applied to the last <code>phaseLength</code> input samples:
+ * <pre>
+ *    v[n*L+p] = b[p] * x[n] + b[L+p] * x[n-1] + ... + b[L*(phaseLength-1)+p] * x[n-phaseLength+1]
+ *    y[m]     = v[m*M+M-1]
+ * </pre>
+ * <code>v</code> is the output of the FIR interpolator, the output samples <code>y</code> are the
+ * ones of <code>arm_fir_interpolate_xxx()</code> followed by <code>arm_fir_decimate_xxx()</code> with the
+ * one tap filter <code>{1}</code>. The resampler takes <code>phaseLength</code> multiply-accumulates
+ * per output sample, where the cascade takes <code>numTaps</code> per input sample, that is
+ * <code>M</code> times more for a downsampler, 441 times more from 44.1 kHz to 16 kHz.
+ *
+ * \par Block sizes
+ * The number of output samples of an input block is not constant: the functions take the number of
+ * input samples available in <code>*pSrcLen</code> and the room of the output buffer in <code>dstLen</code>.
+ * They return the number of output samples written and set <code>*pSrcLen</code> to the number of
+ * input samples consumed. They stop when all the input samples are consumed or when the output buffer
+ * is full, whichever comes first:
+ * - with input blocks of a fixed size, an output buffer of <code>ceil(srcLen*L/M)</code> samples
+ *   always consumes the whole input block.
+ * - with output blocks of a fixed size, the input samples which are not consumed are given
+ *   again, at the start of the input of the next call.
+ *
+ * The input is processed by chunks of at most <code>blockSize</code> samples, the parameter of the
+ * initialization function, any number of input samples can be given to a call.
+ *
+ * \par
+ * <code>pCoeffs</code> points to a coefficient array of size <code>numTaps</code>, which must be a multiple of
+ * the interpolation factor <code>L</code>. As for the FIR interpolator, coefficients are stored in time reversed order:
+ * \par
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[numTaps-3], ..., b[1], b[0]}
+ * </pre>
+ * \par
+ * <code>pState</code> points to a state array of size <code>blockSize + phaseLength - 1</code>.
+ * The state holds the last <code>phaseLength - 1</code> input samples consumed and the position,
+ * at the upsampled rate, of the next output sample: the state variables are updated after each call,
+ * the coefficients are untouched.
+ *
+ * \par Instance Structure
+ * The coefficients and state variables for a filter are stored together in an instance data structure.
+ * A separate instance structure must be defined for each filter.
+ * Coefficient arrays may be shared among several instances while state variable array should be allocated separately.
+ * There are separate instance structure declarations for each of the 3 supported data types.
+ *
+ * \par Initialization Functions
+ * There is also an associated initialization function for each data type.
+ * The initialization function performs the following operations:
+ * - Sets the values of the internal structure fields.
+ * - Zeros out the values in the state buffer.
+ * - Checks the factors, the block size and that the length of the filter is a multiple of the interpolation factor.
+ * To do this manually without calling the init function, assign the follow subfields of the instance structure:
+ * L, M, phaseLength (numTaps / L), blockSize, phase (M - 1), pCoeffs, pState. Also set all of the values in pState to zero.
+ *
+ * \par Fixed-Point Behavior
+ * Care must be taken when using the fixed-point versions of the FIR resampler functions.
+ * In particular, the overflow and saturation behavior of the accumulator used in each function must be considered.
+ * Refer to the function specific documentation below for usage guidelines.
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point FIR rational resampler.
+ * @param[in]     *S        points to an instance of the floating-point FIR rational resampler structure.
+ * @param[in]     *pSrc     points to the block of input data.
+ * @param[out]    *pDst     points to the block of output data.
+ * @param[in,out] *pSrcLen  on input, number of input samples available, on output, number of input samples consumed.
+ * @param[in]     dstLen    number of output samples the output buffer can hold.
+ * @return        number of output samples written.
+ */
+
+uint32_t arm_fir_resample_f32(
+  arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t * pSrcLen,
+  uint32_t dstLen)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *px, *pb;                            /* Temporary pointers for state and coefficient buffers */
+  float32_t sum;                                 /* Accumulator */
+  uint32_t L = S->L, M = S->M;                   /* Upsample and downsample factors */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t phase = S->phase;                     /* Position of the next output sample from the next input sample */
+  uint32_t srcLen = *pSrcLen;                    /* Number of input samples available */
+  uint32_t srcCnt = 0U, dstCnt = 0U;             /* Input samples consumed, output samples written */
+  uint32_t numInputs, i, n, tapCnt;              /* Chunk length, loop counters */
+
+  while (srcCnt < srcLen)
+  {
+    /* Copy a chunk of input samples after the phaseLen - 1 previous ones */
+    numInputs = srcLen - srcCnt;
+    if (numInputs > S->blockSize)
+    {
+      numInputs = S->blockSize;
+    }
+    memcpy(pState + (phaseLen - 1U), pSrc + srcCnt, numInputs * sizeof(float32_t));
+
+    /* i is the next input sample of the chunk */
+    i = 0U;
+    while (i < numInputs)
+    {
+      if (phase >= L)
+      {
+        /* The next output sample is phase / L input samples further */
+        n = phase / L;
+        if (n > numInputs - i)
+        {
+          n = numInputs - i;
+        }
+        i += n;
+        phase -= n * L;
+      }
+      else if (dstCnt == dstLen)
+      {
+        /* Output buffer full: input sample i is not consumed */
+        break;
+      }
+      else
+      {
+        /* Polyphase component phase applied to the input samples up to i, oldest first */
+        px = pState + i;
+        pb = pCoeffs + (L - 1U - phase);
+        sum = 0.0f;
+
+#if defined (ARM_MATH_DSP)
+
+        /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+        /* Loop unrolled by 4 */
+        tapCnt = phaseLen >> 2U;
+        while (tapCnt > 0U)
+        {
+          sum += px[0] * pb[0];
+          sum += px[1] * pb[L];
+          sum += px[2] * pb[2U * L];
+          sum += px[3] * pb[3U * L];
+          px += 4U;
+          pb += 4U * L;
+          tapCnt--;
+        }
+        tapCnt = phaseLen & 0x3U;
+
+#else
+
+        /* Run the below code for Cortex-M0 */
+        tapCnt = phaseLen;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+        while (tapCnt > 0U)
+        {
+          sum += *px++ * *pb;
+          pb += L;
+          tapCnt--;
+        }
+
+        *pDst++ = sum;
+        dstCnt++;
+
+        /* Upsampled position of the next output sample */
+        phase += M;
+      }
+    }
+
+    /* Keep the last phaseLen - 1 input samples consumed for the next chunk */
+    memmove(pState, pState + i, (phaseLen - 1U) * sizeof(float32_t));
+    srcCnt += i;
+
+    if (i < numInputs)
+    {
+      break;
+    }
+  }
+
+  S->phase = phase;
+  *pSrcLen = srcCnt;
+
+  return (dstCnt);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
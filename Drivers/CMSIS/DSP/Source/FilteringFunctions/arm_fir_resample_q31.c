@@ -0,0 +1,171 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_q31.c
+ * Description:  Q31 polyphase FIR rational resampler
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 FIR rational resampler.
+ * @param[in]     *S        points to an instance of the Q31 FIR rational resampler structure.
+ * @param[in]     *pSrc     points to the block of input data.
+ * @param[out]    *pDst     points to the block of output data.
+ * @param[in,out] *pSrcLen  on input, number of input samples available, on output, number of input samples consumed.
+ * @param[in]     dstLen    number of output samples the output buffer can hold.
+ * @return        number of output samples written.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using an internal 64-bit accumulator.
+ * The accumulator has a 2.62 format and maintains full precision of the intermediate multiplication results but provides only a single guard bit.
+ * Thus, if the accumulator result overflows it wraps around rather than clip.
+ * In order to avoid overflows completely the input signal must be scaled down by <code>1/phaseLength</code>.
+ * After all multiply-accumulates are performed, the 2.62 accumulator is truncated to 1.32 format and then saturated to 1.31 format.
+ */
+
+uint32_t arm_fir_resample_q31(
+  arm_fir_resample_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t * pSrcLen,
+  uint32_t dstLen)
+{
+  q31_t *pState = S->pState;                     /* State pointer */
+  q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q31_t *px, *pb;                                /* Temporary pointers for state and coefficient buffers */
+  q63_t sum;                                     /* Accumulator */
+  uint32_t L = S->L, M = S->M;                   /* Upsample and downsample factors */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t phase = S->phase;                     /* Position of the next output sample from the next input sample */
+  uint32_t srcLen = *pSrcLen;                    /* Number of input samples available */
+  uint32_t srcCnt = 0U, dstCnt = 0U;             /* Input samples consumed, output samples written */
+  uint32_t numInputs, i, n, tapCnt;              /* Chunk length, loop counters */
+
+  while (srcCnt < srcLen)
+  {
+    /* Copy a chunk of input samples after the phaseLen - 1 previous ones */
+    numInputs = srcLen - srcCnt;
+    if (numInputs > S->blockSize)
+    {
+      numInputs = S->blockSize;
+    }
+    memcpy(pState + (phaseLen - 1U), pSrc + srcCnt, numInputs * sizeof(q31_t));
+
+    /* i is the next input sample of the chunk */
+    i = 0U;
+    while (i < numInputs)
+    {
+      if (phase >= L)
+      {
+        /* The next output sample is phase / L input samples further */
+        n = phase / L;
+        if (n > numInputs - i)
+        {
+          n = numInputs - i;
+        }
+        i += n;
+        phase -= n * L;
+      }
+      else if (dstCnt == dstLen)
+      {
+        /* Output buffer full: input sample i is not consumed */
+        break;
+      }
+      else
+      {
+        /* Polyphase component phase applied to the input samples up to i, oldest first */
+        px = pState + i;
+        pb = pCoeffs + (L - 1U - phase);
+        sum = 0;
+
+#if defined (ARM_MATH_DSP)
+
+        /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+        /* Loop unrolled by 4 */
+        tapCnt = phaseLen >> 2U;
+        while (tapCnt > 0U)
+        {
+          sum += (q63_t) px[0] * pb[0];
+          sum += (q63_t) px[1] * pb[L];
+          sum += (q63_t) px[2] * pb[2U * L];
+          sum += (q63_t) px[3] * pb[3U * L];
+          px += 4U;
+          pb += 4U * L;
+          tapCnt--;
+        }
+        tapCnt = phaseLen & 0x3U;
+
+#else
+
+        /* Run the below code for Cortex-M0 */
+        tapCnt = phaseLen;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+        while (tapCnt > 0U)
+        {
+          sum += (q63_t) *px++ * *pb;
+          pb += L;
+          tapCnt--;
+        }
+
+        *pDst++ = clip_q63_to_q31(sum >> 31);
+        dstCnt++;
+
+        /* Upsampled position of the next output sample */
+        phase += M;
+      }
+    }
+
+    /* Keep the last phaseLen - 1 input samples consumed for the next chunk */
+    memmove(pState, pState + i, (phaseLen - 1U) * sizeof(q31_t));
+    srcCnt += i;
+
+    if (i < numInputs)
+    {
+      break;
+    }
+  }
+
+  S->phase = phase;
+  *pSrcLen = srcCnt;
+
+  return (dstCnt);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
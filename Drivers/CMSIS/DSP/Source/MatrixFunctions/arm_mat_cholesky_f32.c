@@ -0,0 +1,155 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_cholesky_f32.c
+ * Description:  Floating-point Cholesky decomposition
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixChol Cholesky and LDLT Decompositions
+ *
+ * Decomposes a symmetric matrix into triangular factors.
+ *
+ * The Cholesky decomposition of a symmetric positive definite matrix <code>A</code>
+ * is <code>A = L * L<sup>T</sup></code>, with <code>L</code> lower triangular with
+ * positive diagonal elements. The LDL<sup>T</sup> decomposition is
+ * <code>A = L * D * L<sup>T</sup></code>, with <code>L</code> lower triangular with ones
+ * on its diagonal and <code>D</code> diagonal: it needs no square root and also applies
+ * to the symmetric matrices whose leading minors are non-zero.
+ *
+ * Solving a linear system with the factors costs <code>O(n<sup>2</sup>)</code> operations
+ * once the matrix is decomposed, in <code>n<sup>3</sup>/6</code> multiply-accumulates.
+ * This is cheaper and more accurate than computing the inverse with
+ * <code>arm_mat_inverse_f32()</code>, in <code>n<sup>3</sup></code> operations, and
+ * multiplying by it: a Kalman filter gain, for instance, is better computed with
+ * <code>arm_mat_cholesky_f32()</code> and <code>arm_mat_cholesky_solve_f32()</code> on the
+ * innovation covariance.
+ *
+ * Only the lower triangle of the input matrix is read. The decompositions may be
+ * computed in-place, the source and destination matrices being the same.
+ * When matrix size checking is enabled, the functions check that the matrices are
+ * square and of the same size. The functions return <code>ARM_MATH_DECOMPOSITION_FAILURE</code>
+ * if the matrix is not positive definite (Cholesky) or if a pivot is zero (LDL<sup>T</sup>).
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Floating-point Cholesky decomposition of a positive definite matrix.
+ * @param[in]       *pSrc points to the input matrix structure, symmetric positive definite
+ * @param[out]      *pDst points to the output matrix structure, lower triangular <code>L</code>
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the
+ * matrices are not square and of the same size, <code>ARM_MATH_DECOMPOSITION_FAILURE</code>
+ * if the input matrix is not positive definite, <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * @details
+ * The elements of <code>L</code> are computed row by row: the element
+ * <code>l(i,j)</code> is the dot product of the first <code>j</code> elements of rows
+ * <code>i</code> and <code>j</code>, subtracted from <code>a(i,j)</code>, which is read
+ * just before being overwritten. The upper triangle of <code>pDst</code> is set to zero.
+ */
+
+arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pA = pSrc->pData;                   /* input data matrix pointer */
+  float32_t *pL = pDst->pData;                   /* output data matrix pointer */
+  float32_t *pRowI, *pRowJ;                      /* rows of L in the dot products */
+  float32_t sum;                                 /* Accumulator */
+  uint16_t n = pSrc->numRows;                    /* size of the matrices */
+  uint16_t i, j, k;                              /* loop counters */
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols)
+     || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    for (i = 0U; (i < n) && (status == ARM_MATH_SUCCESS); i++)
+    {
+      pRowI = pL + (i * n);
+
+      for (j = 0U; j <= i; j++)
+      {
+        pRowJ = pL + (j * n);
+
+        /* l(i,j) * l(j,j) = a(i,j) - l(i,1)*l(j,1) - .... - l(i,j-1)*l(j,j-1) */
+        sum = pA[(i * n) + j];
+
+        for (k = 0U; k < j; k++)
+        {
+          sum -= pRowI[k] * pRowJ[k];
+        }
+
+        if (j < i)
+        {
+          pRowI[j] = sum / pRowJ[j];
+        }
+        else if (sum > 0.0f)
+        {
+          /* Diagonal element */
+          (void) arm_sqrt_f32(sum, &pRowI[i]);
+        }
+        else
+        {
+          /* The matrix is not positive definite */
+          status = ARM_MATH_DECOMPOSITION_FAILURE;
+        }
+      }
+
+      /* Clear the upper triangle */
+      for (j = i + 1U; j < n; j++)
+      {
+        pRowI[j] = 0.0f;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixChol group
+ */
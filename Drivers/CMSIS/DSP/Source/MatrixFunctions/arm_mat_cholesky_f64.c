@@ -0,0 +1,128 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_cholesky_f64.c
+ * Description:  Double precision floating-point Cholesky decomposition
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Double precision floating-point Cholesky decomposition of a positive definite matrix.
+ * @param[in]       *pSrc points to the input matrix structure, symmetric positive definite
+ * @param[out]      *pDst points to the output matrix structure, lower triangular <code>L</code>
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the
+ * matrices are not square and of the same size, <code>ARM_MATH_DECOMPOSITION_FAILURE</code>
+ * if the input matrix is not positive definite, <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * @details
+ * The elements of <code>L</code> are computed row by row: the element
+ * <code>l(i,j)</code> is the dot product of the first <code>j</code> elements of rows
+ * <code>i</code> and <code>j</code>, subtracted from <code>a(i,j)</code>, which is read
+ * just before being overwritten. The upper triangle of <code>pDst</code> is set to zero.
+ */
+
+arm_status arm_mat_cholesky_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst)
+{
+  float64_t *pA = pSrc->pData;                   /* input data matrix pointer */
+  float64_t *pL = pDst->pData;                   /* output data matrix pointer */
+  float64_t *pRowI, *pRowJ;                      /* rows of L in the dot products */
+  float64_t sum;                                 /* Accumulator */
+  uint16_t n = pSrc->numRows;                    /* size of the matrices */
+  uint16_t i, j, k;                              /* loop counters */
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols)
+     || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    for (i = 0U; (i < n) && (status == ARM_MATH_SUCCESS); i++)
+    {
+      pRowI = pL + (i * n);
+
+      for (j = 0U; j <= i; j++)
+      {
+        pRowJ = pL + (j * n);
+
+        /* l(i,j) * l(j,j) = a(i,j) - l(i,1)*l(j,1) - .... - l(i,j-1)*l(j,j-1) */
+        sum = pA[(i * n) + j];
+
+        for (k = 0U; k < j; k++)
+        {
+          sum -= pRowI[k] * pRowJ[k];
+        }
+
+        if (j < i)
+        {
+          pRowI[j] = sum / pRowJ[j];
+        }
+        else if (sum > 0.0)
+        {
+          /* Diagonal element */
+          pRowI[i] = sqrt(sum);
+        }
+        else
+        {
+          /* The matrix is not positive definite */
+          status = ARM_MATH_DECOMPOSITION_FAILURE;
+        }
+      }
+
+      /* Clear the upper triangle */
+      for (j = i + 1U; j < n; j++)
+      {
+        pRowI[j] = 0.0;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixChol group
+ */
@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_cholesky_solve_f32.c
+ * Description:  Floating-point linear system solve with a Cholesky factor
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Floating-point solve of <code>L * L<sup>T</sup> * X = B</code>.
+ * @param[in]       *pL points to the Cholesky factor computed by <code>arm_mat_cholesky_f32()</code>, <code>N x N</code>
+ * @param[in]       *pB points to the right-hand sides, <code>N x K</code>
+ * @param[out]      *pX points to the solutions, <code>N x K</code>
+ * @return     		The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * @details
+ * Solves <code>L * Y = B</code> by forward substitution, then
+ * <code>L<sup>T</sup> * X = Y</code> by back substitution, reading the columns of
+ * <code>L</code> as the rows of <code>L<sup>T</sup></code>. Each column of
+ * <code>B</code> is a right-hand side. The solve may be computed in-place,
+ * <code>pX</code> being the same as <code>pB</code>.
+ */
+
+arm_status arm_mat_cholesky_solve_f32(
+  const arm_matrix_instance_f32 * pL,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX)
+{
+  float32_t *pLData = pL->pData;                 /* factor data pointer */
+  float32_t *pBData = pB->pData;                 /* right-hand sides data pointer */
+  float32_t *pXData = pX->pData;                 /* solutions data pointer */
+  float32_t *pRow;                               /* row of L */
+  float32_t sum;                                 /* Accumulator */
+  uint16_t n = pL->numRows;                      /* number of unknowns */
+  uint16_t numCols = pB->numCols;                /* number of right-hand sides */
+  uint16_t col;                                  /* column of B and X */
+  int32_t i, k;                                  /* loop counters */
+  arm_status status;                             /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pL->numRows != pL->numCols) || (pB->numRows != pL->numRows)
+     || (pX->numRows != pB->numRows) || (pX->numCols != pB->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    for (col = 0U; col < numCols; col++)
+    {
+      /* Forward substitution: y(i) = (b(i) - l(i,1)*y(1) - .... - l(i,i-1)*y(i-1)) / l(i,i) */
+      for (i = 0; i < (int32_t) n; i++)
+      {
+        pRow = pLData + (i * n);
+        sum = pBData[(i * numCols) + col];
+
+        for (k = 0; k < i; k++)
+        {
+          sum -= pRow[k] * pXData[(k * numCols) + col];
+        }
+
+        pXData[(i * numCols) + col] = sum / pRow[i];
+      }
+
+      /* Back substitution: x(i) = (y(i) - l(i+1,i)*x(i+1) - .... - l(n,i)*x(n)) / l(i,i) */
+      for (i = (int32_t) n - 1; i >= 0; i--)
+      {
+        sum = pXData[(i * numCols) + col];
+
+        for (k = i + 1; k < (int32_t) n; k++)
+        {
+          sum -= pLData[(k * n) + i] * pXData[(k * numCols) + col];
+        }
+
+        pXData[(i * numCols) + col] = sum / pLData[(i * n) + i];
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixChol group
+ */
@@ -0,0 +1,129 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_ldlt_f32.c
+ * Description:  Floating-point LDLT decomposition
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Floating-point LDL<sup>T</sup> decomposition of a symmetric matrix.
+ * @param[in]       *pSrc points to the input matrix structure, symmetric
+ * @param[out]      *pDst points to the output matrix structure, <code>L</code> and <code>D</code>
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the
+ * matrices are not square and of the same size, <code>ARM_MATH_DECOMPOSITION_FAILURE</code>
+ * if a pivot <code>d(i)</code> is zero, <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * @details
+ * The factors are stored in the lower triangle of <code>pDst</code>: the elements of
+ * <code>L</code> below the diagonal, its unit diagonal being implied, and
+ * <code>D</code> on the diagonal. The upper triangle is set to zero. There is no
+ * pivoting: the decomposition exists when the leading minors of the matrix are not
+ * zero, as for positive or negative definite matrices.
+ */
+
+arm_status arm_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pA = pSrc->pData;                   /* input data matrix pointer */
+  float32_t *pL = pDst->pData;                   /* output data matrix pointer */
+  float32_t *pRowI, *pRowJ;                      /* rows of L in the dot products */
+  float32_t sum;                                 /* Accumulator */
+  uint16_t n = pSrc->numRows;                    /* size of the matrices */
+  uint16_t i, j, k;                              /* loop counters */
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols)
+     || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    for (i = 0U; (i < n) && (status == ARM_MATH_SUCCESS); i++)
+    {
+      pRowI = pL + (i * n);
+
+      for (j = 0U; j <= i; j++)
+      {
+        pRowJ = pL + (j * n);
+
+        /* l(i,j) * d(j) = a(i,j) - l(i,1)*d(1)*l(j,1) - .... - l(i,j-1)*d(j-1)*l(j,j-1) */
+        sum = pA[(i * n) + j];
+
+        for (k = 0U; k < j; k++)
+        {
+          sum -= pRowI[k] * pL[(k * n) + k] * pRowJ[k];
+        }
+
+        if (j < i)
+        {
+          pRowI[j] = sum / pRowJ[j];
+        }
+        else if (sum != 0.0f)
+        {
+          /* d(i) */
+          pRowI[i] = sum;
+        }
+        else
+        {
+          /* Zero pivot */
+          status = ARM_MATH_DECOMPOSITION_FAILURE;
+        }
+      }
+
+      /* Clear the upper triangle */
+      for (j = i + 1U; j < n; j++)
+      {
+        pRowI[j] = 0.0f;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixChol group
+ */
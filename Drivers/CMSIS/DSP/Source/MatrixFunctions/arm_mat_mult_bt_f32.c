@@ -0,0 +1,289 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_bt_f32.c
+ * Description:  Floating-point matrix multiplication, second matrix transposed
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixMult
+ * @{
+ */
+
+/**
+ * @brief Floating-point matrix multiplication with the second matrix transposed.
+ * @param[in]       *pSrcA  points to the first input matrix structure, <code>M x N</code>
+ * @param[in]       *pSrcBT points to the transpose of the second input matrix, <code>P x N</code>
+ * @param[out]      *pDst   points to output matrix structure, <code>M x P</code>
+ * @return     		The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * @details
+ * Computes <code>pSrcA * transpose(pSrcBT)</code>. Both operands are then read
+ * along their rows, without the stride of <code>arm_mat_mult_f32()</code> on the
+ * columns of the second matrix: constant operands such as the weights of a
+ * layer or a model matrix can be stored transposed once with <code>arm_mat_trans_f32()</code>.
+ * The results are the same as the ones of <code>arm_mat_mult_f32()</code>.
+ * When size checking is enabled, the function checks that the numbers of columns of
+ * <code>pSrcA</code> and <code>pSrcBT</code> are equal and that the output matrix is
+ * <code>pSrcA->numRows x pSrcBT->numRows</code>.
+ */
+
+arm_status arm_mat_mult_bt_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcBT,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pInA = pSrcA->pData;                /* input data matrix pointer A */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float32_t *pIn1, *pIn2;                        /* row pointers of A and BT */
+  float32_t sum;                                 /* Accumulator */
+  uint16_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint16_t numRowsBT = pSrcBT->numRows;          /* number of rows of input matrix BT */
+  uint16_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint16_t col, row, colCnt;                     /* loop counters */
+  arm_status status;                             /* status of matrix multiplication */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  float32_t *pInB;                               /* row pointer of BT */
+  float32_t a0, a1, b0, b1;                      /* Elements of A and BT of a tile */
+  float32_t sum01, sum10, sum11;                 /* Accumulators of a tile, with sum */
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcBT->numCols) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcBT->numRows != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+
+#if defined (ARM_MATH_DSP)
+
+    /* The output is computed by 2 x 2 tiles: two rows of pSrcA times two
+     ** rows of pSrcBT, each element loaded being used twice */
+    row = numRowsA;
+
+    while (row > 1U)
+    {
+      pInB = pSrcBT->pData;
+
+      /* column loop, two columns of the output at a time */
+      col = numRowsBT >> 1U;
+
+      while (col > 0U)
+      {
+        sum = sum01 = sum10 = sum11 = 0.0f;
+
+        pIn1 = pInA;
+        pIn2 = pInB;
+
+        colCnt = numColsA;
+
+        while (colCnt > 0U)
+        {
+          /* c(m,n) = a(m,1)*bt(n,1) + a(m,2) * bt(n,2) + .... + a(m,p)*bt(n,p) */
+          a0 = pIn1[0];
+          a1 = pIn1[numColsA];
+          b0 = pIn2[0];
+          b1 = pIn2[numColsA];
+          pIn1++;
+          pIn2++;
+
+          sum   += a0 * b0;
+          sum01 += a0 * b1;
+          sum10 += a1 * b0;
+          sum11 += a1 * b1;
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        /* Store the results in the destination buffer */
+        pOut[0] = sum;
+        pOut[1] = sum01;
+        pOut[numRowsBT] = sum10;
+        pOut[numRowsBT + 1U] = sum11;
+        pOut += 2U;
+
+        pInB += 2U * numColsA;
+
+        /* Decrement the column loop counter */
+        col--;
+      }
+
+      /* Last column if the number of rows of pSrcBT is odd */
+      if ((numRowsBT & 1U) != 0U)
+      {
+        sum = sum10 = 0.0f;
+
+        pIn1 = pInA;
+        pIn2 = pInB;
+
+        colCnt = numColsA;
+
+        while (colCnt > 0U)
+        {
+          b0 = *pIn2++;
+
+          sum   += pIn1[0] * b0;
+          sum10 += pIn1[numColsA] * b0;
+          pIn1++;
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        pOut[0] = sum;
+        pOut[numRowsBT] = sum10;
+        pOut++;
+      }
+
+      /* Skip the second row of the tiles, already computed */
+      pOut += numRowsBT;
+      pInA += 2U * numColsA;
+      row -= 2U;
+    }
+
+    /* Last row if the number of rows of pSrcA is odd */
+    if (row > 0U)
+    {
+      pInB = pSrcBT->pData;
+
+      col = numRowsBT >> 1U;
+
+      while (col > 0U)
+      {
+        sum = sum01 = 0.0f;
+
+        pIn1 = pInA;
+        pIn2 = pInB;
+
+        colCnt = numColsA;
+
+        while (colCnt > 0U)
+        {
+          a0 = *pIn1++;
+
+          sum   += a0 * pIn2[0];
+          sum01 += a0 * pIn2[numColsA];
+          pIn2++;
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        *pOut++ = sum;
+        *pOut++ = sum01;
+
+        pInB += 2U * numColsA;
+
+        /* Decrement the column loop counter */
+        col--;
+      }
+
+      if ((numRowsBT & 1U) != 0U)
+      {
+        sum = 0.0f;
+
+        pIn1 = pInA;
+        pIn2 = pInB;
+
+        colCnt = numColsA;
+
+        while (colCnt > 0U)
+        {
+          sum += *pIn1++ * *pIn2++;
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        *pOut = sum;
+      }
+    }
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* row loop */
+    for (row = numRowsA; row > 0U; row--)
+    {
+      /* The rows of pSrcBT are the columns of the second matrix */
+      pIn2 = pSrcBT->pData;
+
+      /* column loop */
+      for (col = numRowsBT; col > 0U; col--)
+      {
+        sum = 0.0f;
+
+        pIn1 = pInA;
+
+        colCnt = numColsA;
+
+        while (colCnt > 0U)
+        {
+          /* c(m,n) = a(m,1)*bt(n,1) + a(m,2) * bt(n,2) + .... + a(m,p)*bt(n,p) */
+          sum += *pIn1++ * *pIn2++;
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        *pOut++ = sum;
+      }
+
+      pInA += numColsA;
+    }
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    /* set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixMult group
+ */
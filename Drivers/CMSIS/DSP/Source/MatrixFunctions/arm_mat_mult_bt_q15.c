@@ -0,0 +1,303 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_bt_q15.c
+ * Description:  Q15 matrix multiplication, second matrix transposed
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixMult
+ * @{
+ */
+
+/**
+ * @brief Q15 matrix multiplication with the second matrix transposed.
+ * @param[in]       *pSrcA  points to the first input matrix structure, <code>M x N</code>
+ * @param[in]       *pSrcBT points to the transpose of the second input matrix, <code>P x N</code>
+ * @param[out]      *pDst   points to output matrix structure, <code>M x P</code>
+ * @return     		The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * @details
+ * Computes <code>pSrcA * transpose(pSrcBT)</code>. <code>arm_mat_mult_q15()</code>
+ * transposes the second matrix into <code>pState</code> at each call: with constant
+ * operands such as the weights of a layer, stored transposed once with
+ * <code>arm_mat_trans_q15()</code>, this function skips the transposition and needs no
+ * state buffer. The results and the scaling are the same as the ones of
+ * <code>arm_mat_mult_q15()</code>: 34.30 accumulation, truncation to 34.15 and
+ * saturation to 1.15 format.
+ * When size checking is enabled, the function checks that the numbers of columns of
+ * <code>pSrcA</code> and <code>pSrcBT</code> are equal and that the output matrix is
+ * <code>pSrcA->numRows x pSrcBT->numRows</code>.
+ */
+
+arm_status arm_mat_mult_bt_q15(
+  const arm_matrix_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcBT,
+  arm_matrix_instance_q15 * pDst)
+{
+  q15_t *pInA = pSrcA->pData;                    /* input data matrix pointer A */
+  q15_t *pOut = pDst->pData;                     /* output data matrix pointer */
+  q15_t *pIn1, *pIn2;                            /* row pointers of A and BT */
+  q63_t sum;                                     /* Accumulator */
+  uint16_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint16_t numRowsBT = pSrcBT->numRows;          /* number of rows of input matrix BT */
+  uint16_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint16_t col, row, colCnt;                     /* loop counters */
+  arm_status status;                             /* status of matrix multiplication */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q15_t *pInB, *pIn1b, *pIn2b;                   /* row pointers of BT and second rows of a tile */
+  q63_t sum01, sum10, sum11;                     /* Accumulators of a tile, with sum */
+
+#ifndef UNALIGNED_SUPPORT_DISABLE
+
+  q31_t inA1, inA2, inB1, inB2;                  /* Two elements of each row of a tile */
+
+#else
+
+  q15_t inA1, inA2, inB1, inB2;
+
+#endif /* #ifndef UNALIGNED_SUPPORT_DISABLE */
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcBT->numCols) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcBT->numRows != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+
+#if defined (ARM_MATH_DSP)
+
+    /* The output is computed by 2 x 2 tiles: two rows of pSrcA times two
+     ** rows of pSrcBT, each pair of elements loaded being used twice */
+    row = numRowsA;
+
+    while (row > 1U)
+    {
+      pInB = pSrcBT->pData;
+
+      /* column loop, two columns of the output at a time */
+      col = numRowsBT >> 1U;
+
+      while (col > 0U)
+      {
+        sum = sum01 = sum10 = sum11 = 0;
+
+        pIn1 = pInA;
+        pIn1b = pInA + numColsA;
+        pIn2 = pInB;
+        pIn2b = pInB + numColsA;
+
+        /* Two columns of A at a time */
+        colCnt = numColsA >> 1U;
+
+        while (colCnt > 0U)
+        {
+          /* c(m,n) = a(m,1)*bt(n,1) + a(m,2) * bt(n,2) + .... + a(m,p)*bt(n,p) */
+#ifndef UNALIGNED_SUPPORT_DISABLE
+
+          inA1 = *__SIMD32(pIn1)++;
+          inA2 = *__SIMD32(pIn1b)++;
+          inB1 = *__SIMD32(pIn2)++;
+          inB2 = *__SIMD32(pIn2b)++;
+
+          sum   = __SMLALD(inA1, inB1, sum);
+          sum01 = __SMLALD(inA1, inB2, sum01);
+          sum10 = __SMLALD(inA2, inB1, sum10);
+          sum11 = __SMLALD(inA2, inB2, sum11);
+
+#else
+
+          inA1 = *pIn1++;
+          inA2 = *pIn1b++;
+          inB1 = *pIn2++;
+          inB2 = *pIn2b++;
+
+          sum   += (q31_t) inA1 * inB1;
+          sum01 += (q31_t) inA1 * inB2;
+          sum10 += (q31_t) inA2 * inB1;
+          sum11 += (q31_t) inA2 * inB2;
+
+          inA1 = *pIn1++;
+          inA2 = *pIn1b++;
+          inB1 = *pIn2++;
+          inB2 = *pIn2b++;
+
+          sum   += (q31_t) inA1 * inB1;
+          sum01 += (q31_t) inA1 * inB2;
+          sum10 += (q31_t) inA2 * inB1;
+          sum11 += (q31_t) inA2 * inB2;
+
+#endif /* #ifndef UNALIGNED_SUPPORT_DISABLE */
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        /* Last column of A if the number of columns is odd */
+        if ((numColsA & 1U) != 0U)
+        {
+          sum   += (q31_t) *pIn1 * *pIn2;
+          sum01 += (q31_t) *pIn1 * *pIn2b;
+          sum10 += (q31_t) *pIn1b * *pIn2;
+          sum11 += (q31_t) *pIn1b * *pIn2b;
+        }
+
+        /* Saturate and store the results in the destination buffer */
+        pOut[0] = (q15_t) (__SSAT((sum >> 15), 16));
+        pOut[1] = (q15_t) (__SSAT((sum01 >> 15), 16));
+        pOut[numRowsBT] = (q15_t) (__SSAT((sum10 >> 15), 16));
+        pOut[numRowsBT + 1U] = (q15_t) (__SSAT((sum11 >> 15), 16));
+        pOut += 2U;
+
+        pInB += 2U * numColsA;
+
+        /* Decrement the column loop counter */
+        col--;
+      }
+
+      /* Last column if the number of rows of pSrcBT is odd */
+      if ((numRowsBT & 1U) != 0U)
+      {
+        sum = sum10 = 0;
+
+        pIn1 = pInA;
+        pIn1b = pInA + numColsA;
+        pIn2 = pInB;
+
+        colCnt = numColsA;
+
+        while (colCnt > 0U)
+        {
+          sum   += (q31_t) *pIn1++ * *pIn2;
+          sum10 += (q31_t) *pIn1b++ * *pIn2;
+          pIn2++;
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        pOut[0] = (q15_t) (__SSAT((sum >> 15), 16));
+        pOut[numRowsBT] = (q15_t) (__SSAT((sum10 >> 15), 16));
+        pOut++;
+      }
+
+      /* Skip the second row of the tiles, already computed */
+      pOut += numRowsBT;
+      pInA += 2U * numColsA;
+      row -= 2U;
+    }
+
+    /* Last row if the number of rows of pSrcA is odd */
+    if (row > 0U)
+    {
+      pIn2 = pSrcBT->pData;
+
+      for (col = numRowsBT; col > 0U; col--)
+      {
+        sum = 0;
+
+        pIn1 = pInA;
+
+        colCnt = numColsA;
+
+        while (colCnt > 0U)
+        {
+          sum += (q31_t) *pIn1++ * *pIn2++;
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        *pOut++ = (q15_t) (__SSAT((sum >> 15), 16));
+      }
+    }
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* row loop */
+    for (row = numRowsA; row > 0U; row--)
+    {
+      /* The rows of pSrcBT are the columns of the second matrix */
+      pIn2 = pSrcBT->pData;
+
+      /* column loop */
+      for (col = numRowsBT; col > 0U; col--)
+      {
+        sum = 0;
+
+        pIn1 = pInA;
+
+        colCnt = numColsA;
+
+        while (colCnt > 0U)
+        {
+          /* c(m,n) = a(m,1)*bt(n,1) + a(m,2) * bt(n,2) + .... + a(m,p)*bt(n,p) */
+          sum += (q31_t) *pIn1++ * *pIn2++;
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        /* Saturate and store the result in the destination buffer */
+        *pOut++ = (q15_t) __SSAT((sum >> 15), 16);
+      }
+
+      pInA += numColsA;
+    }
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    /* set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixMult group
+ */
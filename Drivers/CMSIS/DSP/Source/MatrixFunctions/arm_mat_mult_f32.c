@@ -78,11 +78,11 @@ arm_status arm_mat_mult_f32(
   uint16_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
   uint16_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
 
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_HOST_SIMD)
 
-  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  /* Run the below code for host vector builds */
 
-  float32_t in1, in2, in3, in4;
+  arm_host_f32v acc0, acc1, acc2, acc3, a;       /* Vector accumulators and element of A */
   uint16_t col, i = 0U, j, row = numRowsA, colCnt;      /* loop counters */
   arm_status status;                             /* status of matrix multiplication */
 
@@ -101,68 +101,83 @@ arm_status arm_mat_mult_f32(
 #endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
 
   {
-    /* The following loop performs the dot-product of each row in pSrcA with each column in pSrcB */
+    /* Each vector lane computes one element of the output row: the row of A
+     ** is scaled into consecutive columns of pSrcB, the sums being done in
+     ** the same order as in the scalar code */
     /* row loop */
     do
     {
       /* Output pointer is set to starting address of the row being processed */
       px = pOut + i;
 
-      /* For every row wise process, the column loop counter is to be initiated */
-      col = numColsB;
-
-      /* For every row wise process, the pIn2 pointer is set
-       ** to the starting address of the pSrcB data */
-      pIn2 = pSrcB->pData;
-
       j = 0U;
 
-      /* column loop */
-      do
+      /* column loop, 4 * ARM_HOST_F32_LANES columns at a time */
+      for (col = numColsB / (4U * ARM_HOST_F32_LANES); col > 0U; col--)
       {
-        /* Set the variable sum, that acts as accumulator, to zero */
-        sum = 0.0f;
+        acc0 = acc1 = acc2 = acc3 = (arm_host_f32v) { 0 };
 
-        /* Initiate the pointer pIn1 to point to the starting address of the column being processed */
         pIn1 = pInA;
+        pIn2 = pSrcB->pData + j;
+        colCnt = numColsA;
 
-        /* Apply loop unrolling and compute 4 MACs simultaneously. */
-        colCnt = numColsA >> 2U;
-
-        /* matrix multiplication        */
         while (colCnt > 0U)
         {
           /* c(m,n) = a(1,1)*b(1,1) + a(1,2) * b(2,1) + .... + a(m,p)*b(p,n) */
-          in3 = *pIn2;
-          pIn2 += numColsB;
-          in1 = pIn1[0];
-          in2 = pIn1[1];
-          sum += in1 * in3;
-          in4 = *pIn2;
+          a = arm_host_dup_f32v(*pIn1++);
+          acc0 += a * arm_host_load_f32v(pIn2);
+          acc1 += a * arm_host_load_f32v(pIn2 + ARM_HOST_F32_LANES);
+          acc2 += a * arm_host_load_f32v(pIn2 + 2U * ARM_HOST_F32_LANES);
+          acc3 += a * arm_host_load_f32v(pIn2 + 3U * ARM_HOST_F32_LANES);
           pIn2 += numColsB;
-          sum += in2 * in4;
 
-          in3 = *pIn2;
-          pIn2 += numColsB;
-          in1 = pIn1[2];
-          in2 = pIn1[3];
-          sum += in1 * in3;
-          in4 = *pIn2;
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        /* Store the results in the destination buffer */
+        arm_host_store_f32v(px, acc0);
+        arm_host_store_f32v(px + ARM_HOST_F32_LANES, acc1);
+        arm_host_store_f32v(px + 2U * ARM_HOST_F32_LANES, acc2);
+        arm_host_store_f32v(px + 3U * ARM_HOST_F32_LANES, acc3);
+        px += 4U * ARM_HOST_F32_LANES;
+        j += 4U * ARM_HOST_F32_LANES;
+      }
+
+      /* Remaining full vectors of columns */
+      for (col = (numColsB % (4U * ARM_HOST_F32_LANES)) / ARM_HOST_F32_LANES; col > 0U; col--)
+      {
+        acc0 = (arm_host_f32v) { 0 };
+
+        pIn1 = pInA;
+        pIn2 = pSrcB->pData + j;
+        colCnt = numColsA;
+
+        while (colCnt > 0U)
+        {
+          acc0 += arm_host_dup_f32v(*pIn1++) * arm_host_load_f32v(pIn2);
           pIn2 += numColsB;
-          sum += in2 * in4;
-          pIn1 += 4U;
 
-          /* Decrement the loop count */
+          /* Decrement the loop counter */
           colCnt--;
         }
 
-        /* If the columns of pSrcA is not a multiple of 4, compute any remaining MACs here.
-         ** No loop unrolling is used. */
-        colCnt = numColsA % 0x4U;
+        arm_host_store_f32v(px, acc0);
+        px += ARM_HOST_F32_LANES;
+        j += ARM_HOST_F32_LANES;
+      }
+
+      /* Remaining columns, one at a time */
+      for (col = numColsB % ARM_HOST_F32_LANES; col > 0U; col--)
+      {
+        sum = 0.0f;
+
+        pIn1 = pInA;
+        pIn2 = pSrcB->pData + j;
+        colCnt = numColsA;
 
         while (colCnt > 0U)
         {
-          /* c(m,n) = a(1,1)*b(1,1) + a(1,2) * b(2,1) + .... + a(m,p)*b(p,n) */
           sum += *pIn1++ * (*pIn2);
           pIn2 += numColsB;
 
@@ -170,17 +185,185 @@ arm_status arm_mat_mult_f32(
           colCnt--;
         }
 
-        /* Store the result in the destination buffer */
         *px++ = sum;
-
-        /* Update the pointer pIn2 to point to the  starting address of the next column */
         j++;
-        pIn2 = pSrcB->pData + j;
+      }
 
-        /* Decrement the column loop counter */
-        col--;
+#elif defined (ARM_MATH_DSP)
 
-      } while (col > 0U);
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  float32_t *pInA2, *px2;                        /* Pointers to the second row of a tile in A and in the output */
+  float32_t a0, a1, b0, b1;                      /* Elements of A and B of a tile */
+  float32_t sum01, sum10, sum11;                 /* Accumulators of a tile, with sum */
+  uint16_t col, i = 0U, j, row = numRowsA, colCnt;      /* loop counters */
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* The output is computed by 2 x 2 tiles: two rows of pSrcA times two
+     ** columns of pSrcB, each element of A and B loaded being used twice.
+     ** Each output is still summed in the order of the columns of pSrcA. */
+    /* row loop */
+    do
+    {
+      /* Output pointer is set to starting address of the row being processed */
+      px = pOut + i;
+
+      j = 0U;
+
+      if (row > 1U)
+      {
+        /* Second row of the tiles */
+        pInA2 = pInA + numColsA;
+        px2 = px + numColsB;
+
+        /* column loop, two columns at a time */
+        col = numColsB >> 1U;
+
+        while (col > 0U)
+        {
+          /* Set the accumulators to zero */
+          sum = sum01 = sum10 = sum11 = 0.0f;
+
+          pIn1 = pInA;
+          pIn2 = pSrcB->pData + j;
+
+          colCnt = numColsA;
+
+          /* matrix multiplication */
+          while (colCnt > 0U)
+          {
+            /* c(m,n) = a(1,1)*b(1,1) + a(1,2) * b(2,1) + .... + a(m,p)*b(p,n) */
+            a0 = pIn1[0];
+            a1 = pIn1[numColsA];
+            b0 = pIn2[0];
+            b1 = pIn2[1];
+            pIn1++;
+            pIn2 += numColsB;
+
+            sum   += a0 * b0;
+            sum01 += a0 * b1;
+            sum10 += a1 * b0;
+            sum11 += a1 * b1;
+
+            /* Decrement the loop counter */
+            colCnt--;
+          }
+
+          /* Store the results in the destination buffer */
+          *px++  = sum;
+          *px++  = sum01;
+          *px2++ = sum10;
+          *px2++ = sum11;
+
+          j += 2U;
+
+          /* Decrement the column loop counter */
+          col--;
+        }
+
+        /* Last column if the number of columns of pSrcB is odd */
+        if ((numColsB & 1U) != 0U)
+        {
+          sum = sum10 = 0.0f;
+
+          pIn1 = pInA;
+          pIn2 = pSrcB->pData + j;
+
+          colCnt = numColsA;
+
+          while (colCnt > 0U)
+          {
+            b0 = *pIn2;
+            pIn2 += numColsB;
+
+            sum   += pIn1[0] * b0;
+            sum10 += pIn1[numColsA] * b0;
+            pIn1++;
+
+            /* Decrement the loop counter */
+            colCnt--;
+          }
+
+          *px = sum;
+          *px2 = sum10;
+        }
+
+        /* The second row of the tiles is done: skip it */
+        i = i + numColsB;
+        pInA = pInA2;
+        row--;
+      }
+      else
+      {
+        /* Last row if the number of rows of pSrcA is odd: 1 x 2 tiles */
+        col = numColsB >> 1U;
+
+        while (col > 0U)
+        {
+          sum = sum01 = 0.0f;
+
+          pIn1 = pInA;
+          pIn2 = pSrcB->pData + j;
+
+          colCnt = numColsA;
+
+          while (colCnt > 0U)
+          {
+            a0 = *pIn1++;
+
+            sum   += a0 * pIn2[0];
+            sum01 += a0 * pIn2[1];
+            pIn2 += numColsB;
+
+            /* Decrement the loop counter */
+            colCnt--;
+          }
+
+          *px++ = sum;
+          *px++ = sum01;
+
+          j += 2U;
+
+          /* Decrement the column loop counter */
+          col--;
+        }
+
+        if ((numColsB & 1U) != 0U)
+        {
+          sum = 0.0f;
+
+          pIn1 = pInA;
+          pIn2 = pSrcB->pData + j;
+
+          colCnt = numColsA;
+
+          while (colCnt > 0U)
+          {
+            sum += *pIn1++ * *pIn2;
+            pIn2 += numColsB;
+
+            /* Decrement the loop counter */
+            colCnt--;
+          }
+
+          *px = sum;
+        }
+      }
 
 #else
 
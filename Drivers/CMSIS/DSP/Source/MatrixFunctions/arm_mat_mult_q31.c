@@ -82,9 +82,11 @@ arm_status arm_mat_mult_q31(
 
   /* Run the below code for Cortex-M4 and Cortex-M3 */
 
+  q31_t *pInA2, *px2;                            /* Pointers to the second row of a tile in A and in the output */
+  q31_t a0, a1, b0, b1;                          /* Elements of A and B of a tile */
+  q63_t sum01, sum10, sum11;                     /* Accumulators of a tile, with sum */
   uint16_t col, i = 0U, j, row = numRowsA, colCnt;      /* loop counters */
   arm_status status;                             /* status of matrix multiplication */
-  q31_t a0, a1, a2, a3, b0, b1, b2, b3;
 
 #ifdef ARM_MATH_MATRIX_CHECK
 
@@ -93,100 +95,164 @@ arm_status arm_mat_mult_q31(
   if ((pSrcA->numCols != pSrcB->numRows) ||
      (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
   {
+
     /* Set status as ARM_MATH_SIZE_MISMATCH */
     status = ARM_MATH_SIZE_MISMATCH;
   }
   else
-#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
 
   {
-    /* The following loop performs the dot-product of each row in pSrcA with each column in pSrcB */
+    /* The output is computed by 2 x 2 tiles: two rows of pSrcA times two
+     ** columns of pSrcB, each element of A and B loaded being used twice.
+     ** Each output is still summed in the order of the columns of pSrcA. */
     /* row loop */
     do
     {
       /* Output pointer is set to starting address of the row being processed */
       px = pOut + i;
 
-      /* For every row wise process, the column loop counter is to be initiated */
-      col = numColsB;
-
-      /* For every row wise process, the pIn2 pointer is set
-       ** to the starting address of the pSrcB data */
-      pIn2 = pSrcB->pData;
-
       j = 0U;
 
-      /* column loop */
-      do
+      if (row > 1U)
       {
-        /* Set the variable sum, that acts as accumulator, to zero */
-        sum = 0;
-
-        /* Initiate the pointer pIn1 to point to the starting address of pInA */
-        pIn1 = pInA;
-
-        /* Apply loop unrolling and compute 4 MACs simultaneously. */
-        colCnt = numColsA >> 2;
+        /* Second row of the tiles */
+        pInA2 = pInA + numColsA;
+        px2 = px + numColsB;
 
+        /* column loop, two columns at a time */
+        col = numColsB >> 1U;
 
-        /* matrix multiplication */
-        while (colCnt > 0U)
+        while (col > 0U)
         {
-          /* c(m,n) = a(1,1)*b(1,1) + a(1,2) * b(2,1) + .... + a(m,p)*b(p,n) */
-          /* Perform the multiply-accumulates */
-          b0 = *pIn2;
-          pIn2 += numColsB;
+          /* Set the accumulators to zero */
+          sum = sum01 = sum10 = sum11 = 0;
+
+          pIn1 = pInA;
+          pIn2 = pSrcB->pData + j;
+
+          colCnt = numColsA;
+
+          /* matrix multiplication */
+          while (colCnt > 0U)
+          {
+            /* c(m,n) = a(1,1)*b(1,1) + a(1,2) * b(2,1) + .... + a(m,p)*b(p,n) */
+            a0 = pIn1[0];
+            a1 = pIn1[numColsA];
+            b0 = pIn2[0];
+            b1 = pIn2[1];
+            pIn1++;
+            pIn2 += numColsB;
+
+            sum   += (q63_t) a0 * b0;
+            sum01 += (q63_t) a0 * b1;
+            sum10 += (q63_t) a1 * b0;
+            sum11 += (q63_t) a1 * b1;
+
+            /* Decrement the loop counter */
+            colCnt--;
+          }
+
+          /* Convert the results from 2.62 to 1.31 format and store them in the destination buffer */
+          *px++  = (q31_t) (sum >> 31);
+          *px++  = (q31_t) (sum01 >> 31);
+          *px2++ = (q31_t) (sum10 >> 31);
+          *px2++ = (q31_t) (sum11 >> 31);
+
+          j += 2U;
+
+          /* Decrement the column loop counter */
+          col--;
+        }
 
-          a0 = *pIn1++;
-          a1 = *pIn1++;
+        /* Last column if the number of columns of pSrcB is odd */
+        if ((numColsB & 1U) != 0U)
+        {
+          sum = sum10 = 0;
 
-          b1 = *pIn2;
-          pIn2 += numColsB;
-          b2 = *pIn2;
-          pIn2 += numColsB;
+          pIn1 = pInA;
+          pIn2 = pSrcB->pData + j;
 
-          sum += (q63_t) a0 *b0;
-          sum += (q63_t) a1 *b1;
+          colCnt = numColsA;
 
-          a2 = *pIn1++;
-          a3 = *pIn1++;
+          while (colCnt > 0U)
+          {
+            b0 = *pIn2;
+            pIn2 += numColsB;
 
-          b3 = *pIn2;
-          pIn2 += numColsB;
+            sum   += (q63_t) pIn1[0] * b0;
+            sum10 += (q63_t) pIn1[numColsA] * b0;
+            pIn1++;
 
-          sum += (q63_t) a2 *b2;
-          sum += (q63_t) a3 *b3;
+            /* Decrement the loop counter */
+            colCnt--;
+          }
 
-          /* Decrement the loop counter */
-          colCnt--;
+          *px = (q31_t) (sum >> 31);
+          *px2 = (q31_t) (sum10 >> 31);
         }
 
-        /* If the columns of pSrcA is not a multiple of 4, compute any remaining output samples here.
-         ** No loop unrolling is used. */
-        colCnt = numColsA % 0x4U;
+        /* The second row of the tiles is done: skip it */
+        i = i + numColsB;
+        pInA = pInA2;
+        row--;
+      }
+      else
+      {
+        /* Last row if the number of rows of pSrcA is odd: 1 x 2 tiles */
+        col = numColsB >> 1U;
 
-        while (colCnt > 0U)
+        while (col > 0U)
         {
-          /* c(m,n) = a(1,1)*b(1,1) + a(1,2) * b(2,1) + .... + a(m,p)*b(p,n) */
-          /* Perform the multiply-accumulates */
-          sum += (q63_t) * pIn1++ * *pIn2;
-          pIn2 += numColsB;
+          sum = sum01 = 0;
 
-          /* Decrement the loop counter */
-          colCnt--;
+          pIn1 = pInA;
+          pIn2 = pSrcB->pData + j;
+
+          colCnt = numColsA;
+
+          while (colCnt > 0U)
+          {
+            a0 = *pIn1++;
+
+            sum   += (q63_t) a0 * pIn2[0];
+            sum01 += (q63_t) a0 * pIn2[1];
+            pIn2 += numColsB;
+
+            /* Decrement the loop counter */
+            colCnt--;
+          }
+
+          *px++ = (q31_t) (sum >> 31);
+          *px++ = (q31_t) (sum01 >> 31);
+
+          j += 2U;
+
+          /* Decrement the column loop counter */
+          col--;
         }
 
-        /* Convert the result from 2.62 to 1.31 format and store in destination buffer */
-        *px++ = (q31_t) (sum >> 31);
+        if ((numColsB & 1U) != 0U)
+        {
+          sum = 0;
 
-        /* Update the pointer pIn2 to point to the  starting address of the next column */
-        j++;
-        pIn2 = (pSrcB->pData) + j;
+          pIn1 = pInA;
+          pIn2 = pSrcB->pData + j;
 
-        /* Decrement the column loop counter */
-        col--;
+          colCnt = numColsA;
 
-      } while (col > 0U);
+          while (colCnt > 0U)
+          {
+            sum += (q63_t) *pIn1++ * *pIn2;
+            pIn2 += numColsB;
+
+            /* Decrement the loop counter */
+            colCnt--;
+          }
+
+          *px = (q31_t) (sum >> 31);
+        }
+      }
 
 #else
 
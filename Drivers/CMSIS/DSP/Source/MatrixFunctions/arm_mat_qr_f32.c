@@ -0,0 +1,175 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_qr_f32.c
+ * Description:  Floating-point Householder QR decomposition
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixQR QR Decomposition and Least Squares
+ *
+ * Decomposes an <code>M x N</code> matrix, <code>M >= N</code>, into
+ * <code>A = Q * R</code>, with <code>Q</code> orthogonal and <code>R</code> upper
+ * triangular, and solves the linear least squares problems
+ * <code>min || A * X - B ||</code>.
+ *
+ * \par Algorithm
+ * Householder reflections <code>H(j) = I - tau(j) * v(j) * v(j)<sup>T</sup></code>
+ * zero the elements below the diagonal, one column after the other:
+ * <code>Q = H(1) * H(2) * .... * H(N)</code>. As in LAPACK, <code>Q</code> is not formed:
+ * the output matrix holds <code>R</code> on and above the diagonal and the vectors
+ * <code>v(j)</code> below it, their first element being one, and the scalars
+ * <code>tau(j)</code> are stored in a separate array of <code>N</code> elements.
+ * The decomposition is stable without pivoting and takes
+ * <code>2 * N<sup>2</sup> * (M - N/3)</code> operations.
+ *
+ * When matrix size checking is enabled, the functions check the sizes of the matrices
+ * and that <code>M >= N</code>.
+ */
+
+/**
+ * @addtogroup MatrixQR
+ * @{
+ */
+
+/**
+ * @brief Floating-point Householder QR decomposition.
+ * @param[in]       *pSrc points to the input matrix structure, <code>M x N</code>, <code>M >= N</code>
+ * @param[out]      *pDst points to the output matrix structure, <code>M x N</code>: <code>R</code> and the Householder vectors
+ * @param[out]      *pTau points to the <code>N</code> scalars of the Householder reflections
+ * @return     		The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * @details
+ * The decomposition may be computed in-place, <code>pDst</code> being the same as
+ * <code>pSrc</code>. A column that is already zero below the diagonal gives
+ * <code>tau(j) = 0</code>. A zero on the diagonal of <code>R</code> means that the
+ * matrix is rank deficient.
+ */
+
+arm_status arm_mat_qr_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst,
+  float32_t * pTau)
+{
+  float32_t *pA = pDst->pData;                   /* output data matrix pointer */
+  float32_t alpha, beta, tau;                    /* reflection of the current column */
+  float32_t sum, scale;                          /* Accumulator and scale of v */
+  uint16_t numRows = pSrc->numRows;              /* number of rows of the matrix */
+  uint16_t numCols = pSrc->numCols;              /* number of columns of the matrix */
+  uint16_t i, j, k;                              /* loop counters */
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows < pSrc->numCols) || (pDst->numRows != pSrc->numRows)
+     || (pDst->numCols != pSrc->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* Copy the input matrix, unless in-place */
+    if (pSrc->pData != pA)
+    {
+      arm_copy_f32(pSrc->pData, pA, (uint32_t) numRows * numCols);
+    }
+
+    for (j = 0U; j < numCols; j++)
+    {
+      /* Norm of the column below the diagonal */
+      alpha = pA[(j * numCols) + j];
+      sum = 0.0f;
+
+      for (i = j + 1U; i < numRows; i++)
+      {
+        sum += pA[(i * numCols) + j] * pA[(i * numCols) + j];
+      }
+
+      if (sum == 0.0f)
+      {
+        /* Nothing to zero: H(j) = I */
+        pTau[j] = 0.0f;
+        continue;
+      }
+
+      /* beta = -sign(alpha) * || column ||, the sign avoiding a cancellation in alpha - beta */
+      (void) arm_sqrt_f32((alpha * alpha) + sum, &beta);
+      if (alpha >= 0.0f)
+      {
+        beta = -beta;
+      }
+
+      tau = (beta - alpha) / beta;
+      scale = 1.0f / (alpha - beta);
+      pTau[j] = tau;
+      pA[(j * numCols) + j] = beta;
+
+      /* v(j) = 1, v(i) = a(i,j) / (alpha - beta) */
+      for (i = j + 1U; i < numRows; i++)
+      {
+        pA[(i * numCols) + j] *= scale;
+      }
+
+      /* Apply H(j) to the remaining columns: a(:,k) -= tau * v * (v' * a(:,k)) */
+      for (k = j + 1U; k < numCols; k++)
+      {
+        sum = pA[(j * numCols) + k];
+
+        for (i = j + 1U; i < numRows; i++)
+        {
+          sum += pA[(i * numCols) + j] * pA[(i * numCols) + k];
+        }
+
+        sum *= tau;
+        pA[(j * numCols) + k] -= sum;
+
+        for (i = j + 1U; i < numRows; i++)
+        {
+          pA[(i * numCols) + k] -= sum * pA[(i * numCols) + j];
+        }
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixQR group
+ */
@@ -0,0 +1,141 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_qr_solve_f32.c
+ * Description:  Floating-point least squares solve with a QR decomposition
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixQR
+ * @{
+ */
+
+/**
+ * @brief Floating-point least squares solve of <code>A * X = B</code>.
+ * @param[in]       *pQR  points to the decomposition computed by <code>arm_mat_qr_f32()</code>, <code>M x N</code>
+ * @param[in]       *pTau points to the <code>N</code> scalars of the Householder reflections
+ * @param[in,out]   *pB   points to the right-hand sides, <code>M x K</code>, overwritten by <code>Q<sup>T</sup> * B</code>
+ * @param[out]      *pX   points to the solutions, <code>N x K</code>
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code>,
+ * <code>ARM_MATH_SINGULAR</code> if <code>R</code> has a zero on its diagonal,
+ * <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * @details
+ * Computes the <code>X</code> that minimizes <code>|| A * X - B ||</code> for each column
+ * of <code>B</code>: the reflections are applied to <code>B</code> in place, then
+ * <code>R * X = (Q<sup>T</sup> * B)(1:N,:)</code> is solved by back substitution. The last
+ * <code>M - N</code> rows of <code>Q<sup>T</sup> * B</code> are the components of the
+ * residuals: their norm is the norm of the residuals. <code>pX->pData</code> may be the same
+ * as <code>pB->pData</code>, the solutions overwriting the first <code>N</code> rows.
+ * For a square matrix, this solves the linear system <code>A * X = B</code>.
+ */
+
+arm_status arm_mat_qr_solve_f32(
+  const arm_matrix_instance_f32 * pQR,
+  const float32_t * pTau,
+  arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX)
+{
+  float32_t *pA = pQR->pData;                    /* decomposition data pointer */
+  float32_t *pBData = pB->pData;                 /* right-hand sides data pointer */
+  float32_t *pXData = pX->pData;                 /* solutions data pointer */
+  float32_t sum;                                 /* Accumulator */
+  uint16_t numRows = pQR->numRows;               /* number of rows of A */
+  uint16_t numCols = pQR->numCols;               /* number of columns of A, unknowns */
+  uint16_t numColsB = pB->numCols;               /* number of right-hand sides */
+  uint16_t i, j, k, col;                         /* loop counters */
+  arm_status status;                             /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pQR->numRows < pQR->numCols) || (pB->numRows != pQR->numRows)
+     || (pX->numRows != pQR->numCols) || (pX->numCols != pB->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    for (j = 0U; j < numCols; j++)
+    {
+      if (pA[(j * numCols) + j] == 0.0f)
+      {
+        status = ARM_MATH_SINGULAR;
+      }
+    }
+
+    for (col = 0U; (col < numColsB) && (status == ARM_MATH_SUCCESS); col++)
+    {
+      /* B = H(N) * .... * H(1) * B: b -= tau(j) * v(j) * (v(j)' * b) */
+      for (j = 0U; j < numCols; j++)
+      {
+        sum = pBData[(j * numColsB) + col];
+
+        for (i = j + 1U; i < numRows; i++)
+        {
+          sum += pA[(i * numCols) + j] * pBData[(i * numColsB) + col];
+        }
+
+        sum *= pTau[j];
+        pBData[(j * numColsB) + col] -= sum;
+
+        for (i = j + 1U; i < numRows; i++)
+        {
+          pBData[(i * numColsB) + col] -= sum * pA[(i * numCols) + j];
+        }
+      }
+
+      /* Back substitution: x(j) = (b(j) - r(j,j+1)*x(j+1) - .... - r(j,n)*x(n)) / r(j,j) */
+      for (j = numCols; j > 0U; j--)
+      {
+        sum = pBData[((j - 1U) * numColsB) + col];
+
+        for (k = j; k < numCols; k++)
+        {
+          sum -= pA[((j - 1U) * numCols) + k] * pXData[(k * numColsB) + col];
+        }
+
+        pXData[((j - 1U) * numColsB) + col] = sum / pA[((j - 1U) * numCols) + (j - 1U)];
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixQR group
+ */
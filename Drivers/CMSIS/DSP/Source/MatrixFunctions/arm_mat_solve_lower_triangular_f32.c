@@ -0,0 +1,128 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_solve_lower_triangular_f32.c
+ * Description:  Floating-point forward substitution
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixTriSolve Triangular Linear Systems
+ *
+ * Solves <code>T * X = B</code> with <code>T</code> lower triangular (forward
+ * substitution) or upper triangular (back substitution). Each column of
+ * <code>B</code> is a right-hand side.
+ *
+ * Only the triangle of <code>T</code> given by the function is read: the factor of
+ * <code>arm_mat_cholesky_f32()</code>, or the output of <code>arm_mat_qr_f32()</code> for
+ * a square matrix, can be used as it is. The solve may be computed in-place,
+ * <code>pX</code> being the same as <code>pB</code>.
+ * When matrix size checking is enabled, the functions check that <code>T</code> is
+ * square, that <code>B</code> has as many rows and that <code>X</code> is of the size of
+ * <code>B</code>. The functions return <code>ARM_MATH_SINGULAR</code> if a diagonal
+ * element of <code>T</code> is zero.
+ */
+
+/**
+ * @addtogroup MatrixTriSolve
+ * @{
+ */
+
+/**
+ * @brief Floating-point solve of a lower triangular system.
+ * @param[in]       *pLT points to the lower triangular matrix structure, <code>N x N</code>
+ * @param[in]       *pB  points to the right-hand sides, <code>N x K</code>
+ * @param[out]      *pX  points to the solutions, <code>N x K</code>
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code>,
+ * <code>ARM_MATH_SINGULAR</code> or <code>ARM_MATH_SUCCESS</code>.
+ */
+
+arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pLT,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX)
+{
+  float32_t *pT = pLT->pData;                    /* triangular matrix data pointer */
+  float32_t *pBData = pB->pData;                 /* right-hand sides data pointer */
+  float32_t *pXData = pX->pData;                 /* solutions data pointer */
+  float32_t *pRow;                               /* row of the triangular matrix */
+  float32_t sum;                                 /* Accumulator */
+  uint16_t n = pLT->numRows;                     /* number of unknowns */
+  uint16_t numCols = pB->numCols;                /* number of right-hand sides */
+  uint16_t i, k, col;                            /* loop counters */
+  arm_status status;                             /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pLT->numRows != pLT->numCols) || (pB->numRows != pLT->numRows)
+     || (pX->numRows != pB->numRows) || (pX->numCols != pB->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    for (i = 0U; i < n; i++)
+    {
+      if (pT[(i * n) + i] == 0.0f)
+      {
+        status = ARM_MATH_SINGULAR;
+      }
+    }
+
+    for (col = 0U; (col < numCols) && (status == ARM_MATH_SUCCESS); col++)
+    {
+      /* x(i) = (b(i) - t(i,1)*x(1) - .... - t(i,i-1)*x(i-1)) / t(i,i) */
+      for (i = 0U; i < n; i++)
+      {
+        pRow = pT + (i * n);
+        sum = pBData[(i * numCols) + col];
+
+        for (k = 0U; k < i; k++)
+        {
+          sum -= pRow[k] * pXData[(k * numCols) + col];
+        }
+
+        pXData[(i * numCols) + col] = sum / pRow[i];
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixTriSolve group
+ */
@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_solve_upper_triangular_f32.c
+ * Description:  Floating-point back substitution
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixTriSolve
+ * @{
+ */
+
+/**
+ * @brief Floating-point solve of an upper triangular system.
+ * @param[in]       *pUT points to the upper triangular matrix structure, <code>N x N</code>
+ * @param[in]       *pB  points to the right-hand sides, <code>N x K</code>
+ * @param[out]      *pX  points to the solutions, <code>N x K</code>
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code>,
+ * <code>ARM_MATH_SINGULAR</code> or <code>ARM_MATH_SUCCESS</code>.
+ */
+
+arm_status arm_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * pUT,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX)
+{
+  float32_t *pT = pUT->pData;                    /* triangular matrix data pointer */
+  float32_t *pBData = pB->pData;                 /* right-hand sides data pointer */
+  float32_t *pXData = pX->pData;                 /* solutions data pointer */
+  float32_t *pRow;                               /* row of the triangular matrix */
+  float32_t sum;                                 /* Accumulator */
+  uint16_t n = pUT->numRows;                     /* number of unknowns */
+  uint16_t numCols = pB->numCols;                /* number of right-hand sides */
+  uint16_t i, k, col;                            /* loop counters */
+  arm_status status;                             /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pUT->numRows != pUT->numCols) || (pB->numRows != pUT->numRows)
+     || (pX->numRows != pB->numRows) || (pX->numCols != pB->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    for (i = 0U; i < n; i++)
+    {
+      if (pT[(i * n) + i] == 0.0f)
+      {
+        status = ARM_MATH_SINGULAR;
+      }
+    }
+
+    for (col = 0U; (col < numCols) && (status == ARM_MATH_SUCCESS); col++)
+    {
+      /* x(i) = (b(i) - t(i,i+1)*x(i+1) - .... - t(i,n)*x(n)) / t(i,i) */
+      for (i = n; i > 0U; i--)
+      {
+        pRow = pT + ((i - 1U) * n);
+        sum = pBData[((i - 1U) * numCols) + col];
+
+        for (k = i; k < n; k++)
+        {
+          sum -= pRow[k] * pXData[(k * numCols) + col];
+        }
+
+        pXData[((i - 1U) * numCols) + col] = sum / pRow[i - 1U];
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixTriSolve group
+ */
@@ -0,0 +1,172 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_vec_mult_f32.c
+ * Description:  Floating-point matrix and vector multiplication
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixVectMult Matrix Vector Multiplication
+ *
+ * Multiplies a matrix and a vector.
+ *
+ * Multiplying an <code>M x N</code> matrix with a vector of <code>N</code> elements
+ * results in a vector of <code>M</code> elements, as with <code>arm_mat_mult_f32()</code>
+ * and an <code>N x 1</code> second matrix, without the matrix instances of the vectors
+ * nor the size checking: the vectors hold the numbers of elements given by the
+ * dimensions of the matrix.
+ */
+
+/**
+ * @addtogroup MatrixVectMult
+ * @{
+ */
+
+/**
+ * @brief Floating-point matrix and vector multiplication.
+ * @param[in]       *pSrcMat points to the input matrix structure, <code>M x N</code>
+ * @param[in]       *pVec    points to the input vector of <code>N</code> elements
+ * @param[out]      *pDst    points to the output vector of <code>M</code> elements
+ * @return none.
+ */
+
+void arm_mat_vec_mult_f32(
+  const arm_matrix_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+  float32_t * pDst)
+{
+  float32_t *pInA = pSrcMat->pData;              /* input data matrix pointer */
+  const float32_t *pInV;                         /* input vector pointer */
+  float32_t *pIn1;                               /* row pointer */
+  float32_t sum;                                 /* Accumulator */
+  uint16_t numRows = pSrcMat->numRows;           /* number of rows of input matrix */
+  uint16_t numCols = pSrcMat->numCols;           /* number of columns of input matrix */
+  uint16_t row, colCnt;                          /* loop counters */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  float32_t *pIn2;                               /* second row pointer */
+  float32_t sum2;                                /* Accumulator of the second row */
+  float32_t inV;                                 /* vector element */
+
+  /* Two rows at a time: each element of the vector is loaded once for both
+   ** rows. The products are accumulated in the order of the columns, the
+   ** results are the ones of arm_mat_mult_f32() with a column vector. */
+  row = numRows >> 1U;
+
+  while (row > 0U)
+  {
+    sum = 0.0f;
+    sum2 = 0.0f;
+
+    pIn1 = pInA;
+    pIn2 = pInA + numCols;
+    pInV = pVec;
+
+    /* Loop unrolling: two columns at a time */
+    colCnt = numCols >> 1U;
+
+    while (colCnt > 0U)
+    {
+      /* y(m) = a(m,1) * x(1) + a(m,2) * x(2) + .... + a(m,n) * x(n) */
+      inV = *pInV++;
+      sum += *pIn1++ * inV;
+      sum2 += *pIn2++ * inV;
+
+      inV = *pInV++;
+      sum += *pIn1++ * inV;
+      sum2 += *pIn2++ * inV;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Last column if the number of columns is odd */
+    if ((numCols & 1U) != 0U)
+    {
+      inV = *pInV;
+      sum += *pIn1 * inV;
+      sum2 += *pIn2 * inV;
+    }
+
+    /* Store the results in the destination vector */
+    *pDst++ = sum;
+    *pDst++ = sum2;
+
+    pInA += 2U * numCols;
+
+    /* Decrement the row loop counter */
+    row--;
+  }
+
+  /* Last row if the number of rows is odd */
+  row = numRows & 1U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  row = numRows;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (row > 0U)
+  {
+    sum = 0.0f;
+
+    pIn1 = pInA;
+    pInV = pVec;
+
+    colCnt = numCols;
+
+    while (colCnt > 0U)
+    {
+      /* y(m) = a(m,1) * x(1) + a(m,2) * x(2) + .... + a(m,n) * x(n) */
+      sum += *pIn1++ * *pInV++;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Store the result in the destination vector */
+    *pDst++ = sum;
+
+    pInA += numCols;
+
+    /* Decrement the row loop counter */
+    row--;
+  }
+}
+
+/**
+ * @} end of MatrixVectMult group
+ */
@@ -0,0 +1,186 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_vec_mult_q15.c
+ * Description:  Q15 matrix and vector multiplication
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixVectMult
+ * @{
+ */
+
+/**
+ * @brief Q15 matrix and vector multiplication.
+ * @param[in]       *pSrcMat points to the input matrix structure, <code>M x N</code>
+ * @param[in]       *pVec    points to the input vector of <code>N</code> elements
+ * @param[out]      *pDst    points to the output vector of <code>M</code> elements
+ * @return none.
+ *
+ * @details
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The products are accumulated in a 64-bit accumulator in 34.30 format, with no
+ * risk of overflow, which is truncated to 34.15 format by discarding its low 15 bits
+ * and saturated to 1.15 format, as in <code>arm_mat_mult_q15()</code>.
+ */
+
+void arm_mat_vec_mult_q15(
+  const arm_matrix_instance_q15 * pSrcMat,
+  const q15_t * pVec,
+  q15_t * pDst)
+{
+  q15_t *pInA = pSrcMat->pData;                  /* input data matrix pointer */
+  const q15_t *pInV;                             /* input vector pointer */
+  q15_t *pIn1;                                   /* row pointer */
+  q63_t sum;                                     /* Accumulator */
+  uint16_t numRows = pSrcMat->numRows;           /* number of rows of input matrix */
+  uint16_t numCols = pSrcMat->numCols;           /* number of columns of input matrix */
+  uint16_t row, colCnt;                          /* loop counters */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q15_t *pIn2;                                   /* second row pointer */
+  q63_t sum2;                                    /* Accumulator of the second row */
+
+#ifndef UNALIGNED_SUPPORT_DISABLE
+
+  q31_t inV;                                     /* two vector elements */
+
+#else
+
+  q15_t inV;                                     /* vector element */
+
+#endif /* #ifndef UNALIGNED_SUPPORT_DISABLE */
+
+  /* Two rows at a time: each element of the vector is loaded once for both
+   ** rows. The products are accumulated in the order of the columns, the
+   ** results are the ones of arm_mat_mult_q15() with a column vector. */
+  row = numRows >> 1U;
+
+  while (row > 0U)
+  {
+    sum = 0;
+    sum2 = 0;
+
+    pIn1 = pInA;
+    pIn2 = pInA + numCols;
+    pInV = pVec;
+
+    /* Loop unrolling: two columns at a time */
+    colCnt = numCols >> 1U;
+
+    while (colCnt > 0U)
+    {
+      /* y(m) = a(m,1) * x(1) + a(m,2) * x(2) + .... + a(m,n) * x(n) */
+#ifndef UNALIGNED_SUPPORT_DISABLE
+
+      inV = *__SIMD32(pInV)++;
+      sum = __SMLALD(*__SIMD32(pIn1)++, inV, sum);
+      sum2 = __SMLALD(*__SIMD32(pIn2)++, inV, sum2);
+
+#else
+
+      inV = *pInV++;
+      sum += (q31_t) *pIn1++ * inV;
+      sum2 += (q31_t) *pIn2++ * inV;
+
+      inV = *pInV++;
+      sum += (q31_t) *pIn1++ * inV;
+      sum2 += (q31_t) *pIn2++ * inV;
+
+#endif /* #ifndef UNALIGNED_SUPPORT_DISABLE */
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Last column if the number of columns is odd */
+    if ((numCols & 1U) != 0U)
+    {
+      sum += (q31_t) *pIn1 * *pInV;
+      sum2 += (q31_t) *pIn2 * *pInV;
+    }
+
+    /* Saturate and store the results in the destination vector */
+    *pDst++ = (q15_t) __SSAT((sum >> 15), 16);
+    *pDst++ = (q15_t) __SSAT((sum2 >> 15), 16);
+
+    pInA += 2U * numCols;
+
+    /* Decrement the row loop counter */
+    row--;
+  }
+
+  /* Last row if the number of rows is odd */
+  row = numRows & 1U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  row = numRows;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (row > 0U)
+  {
+    sum = 0;
+
+    pIn1 = pInA;
+    pInV = pVec;
+
+    colCnt = numCols;
+
+    while (colCnt > 0U)
+    {
+      /* y(m) = a(m,1) * x(1) + a(m,2) * x(2) + .... + a(m,n) * x(n) */
+      sum += (q31_t) *pIn1++ * *pInV++;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Store the result in the destination vector */
+    *pDst++ = (q15_t) __SSAT((sum >> 15), 16);
+
+    pInA += numCols;
+
+    /* Decrement the row loop counter */
+    row--;
+  }
+}
+
+/**
+ * @} end of MatrixVectMult group
+ */
@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_bitreversal2.c
+ * Description:  C version of arm_bitreversal_32 and arm_bitreversal_16 for
+ *               the builds that cannot use arm_bitreversal2.S
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Host (ARM_MATH_HOST)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+#if defined (ARM_MATH_HOST)
+
+/*
+* @brief  In-place bit reversal function.
+* @param[in, out] *pSrc        points to the in-place buffer of 32-bit data type (complex f32 or q31).
+* @param[in]      bitRevLen    bit reversal table length
+* @param[in]      *pBitRevTab  points to bit reversal table: pairs of byte offsets of complex 32-bit elements.
+* @return none.
+*/
+void arm_bitreversal_32(
+        uint32_t * pSrc,
+  const uint16_t   bitRevLen,
+  const uint16_t * pBitRevTab)
+{
+  uint32_t a, b, i, tmp;
+
+  for (i = 0U; i < bitRevLen; i += 2U)
+  {
+    a = pBitRevTab[i     ] >> 2U;
+    b = pBitRevTab[i + 1U] >> 2U;
+
+    /* real */
+    tmp = pSrc[a];
+    pSrc[a] = pSrc[b];
+    pSrc[b] = tmp;
+
+    /* imaginary */
+    tmp = pSrc[a + 1U];
+    pSrc[a + 1U] = pSrc[b + 1U];
+    pSrc[b + 1U] = tmp;
+  }
+}
+
+/*
+* @brief  In-place bit reversal function.
+* @param[in, out] *pSrc        points to the in-place buffer of 16-bit data type (complex q15).
+* @param[in]      bitRevLen    bit reversal table length
+* @param[in]      *pBitRevTab  points to bit reversal table, same as for arm_bitreversal_32.
+* @return none.
+*/
+void arm_bitreversal_16(
+        uint16_t * pSrc,
+  const uint16_t   bitRevLen,
+  const uint16_t * pBitRevTab)
+{
+  uint32_t a, b, i;
+  uint16_t tmp;
+
+  for (i = 0U; i < bitRevLen; i += 2U)
+  {
+    /* The table holds offsets for 8-byte elements, the elements are 4 bytes */
+    a = pBitRevTab[i     ] >> 2U;
+    b = pBitRevTab[i + 1U] >> 2U;
+
+    /* real */
+    tmp = pSrc[a];
+    pSrc[a] = pSrc[b];
+    pSrc[b] = tmp;
+
+    /* imaginary */
+    tmp = pSrc[a + 1U];
+    pSrc[a + 1U] = pSrc[b + 1U];
+    pSrc[b + 1U] = tmp;
+  }
+}
+
+#endif /* defined (ARM_MATH_HOST) */
@@ -211,8 +211,44 @@ void arm_cfft_radix8by2_f32( arm_cfft_instance_f32 * S, float32_t * p1)
     pMid1 = p1 + L;
     pMid2 = p2 + L;
 
+#if defined (ARM_MATH_HOST_SIMD)
+    {
+        arm_host_f32v a0, a1, b0, b1, c0, c1, d0, d1, wR, wI;
+
+        // do two dot Fourier transform, ARM_HOST_F32_LANES points per loop
+        for ( l = (L >> 1) / ARM_HOST_F32_LANES; l > 0; l-- )
+        {
+            arm_host_load_cmplx_f32v(p1, &a0, &a1);
+            arm_host_load_cmplx_f32v(p2, &b0, &b1);
+            arm_host_load_cmplx_f32v(pMid1, &c0, &c1);
+            arm_host_load_cmplx_f32v(pMid2, &d0, &d1);
+            arm_host_load_cmplx_f32v(tw, &wR, &wI);
+
+            arm_host_store_cmplx_f32v(p1, a0 + b0, a1 + b1);    // col 1
+            b0 = a0 - b0;
+            b1 = a1 - b1;                                       // for col 2
+            arm_host_store_cmplx_f32v(pMid1, c0 + d0, c1 + d1); // col 1
+            d0 = d0 - c0;
+            d1 = d1 - c1;                                       // for col 2
+
+            // multiply by twiddle factors, vertical symmetry for pMid2
+            arm_host_store_cmplx_f32v(p2, b0 * wR + b1 * wI, b1 * wR - b0 * wI);
+            arm_host_store_cmplx_f32v(pMid2, d0 * wI - d1 * wR, d1 * wI + d0 * wR);
+
+            p1 += 2U * ARM_HOST_F32_LANES;
+            p2 += 2U * ARM_HOST_F32_LANES;
+            pMid1 += 2U * ARM_HOST_F32_LANES;
+            pMid2 += 2U * ARM_HOST_F32_LANES;
+            tw += 2U * ARM_HOST_F32_LANES;
+        }
+    }
+
+    // remaining points, two per loop
+    for ( l = ((L >> 1) % ARM_HOST_F32_LANES) >> 1; l > 0; l-- )
+#else
     // do two dot Fourier transform
     for ( l = L >> 2; l > 0; l-- )
+#endif
     {
         t1[0] = p1[0];
         t1[1] = p1[1];
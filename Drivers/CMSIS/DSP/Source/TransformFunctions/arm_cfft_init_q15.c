@@ -0,0 +1,145 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_init_q15.c
+ * Description:  Q15 complex FFT initialization function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup ComplexFFT
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the Q15 complex FFT.
+* @param[out]    *S             points to an arm_cfft_instance_q15 structure.
+* @param[in]     fftLen         length of the FFT.
+* @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.
+*
+* \par Description:
+* \par
+* The parameter <code>fftLen</code> specifies the length of the CFFT/CIFFT process. Supported FFT lengths are 16, 32, 64, 128, 256, 512, 1024, 2048, 4096.
+* \par
+* This function initializes the instance with the twiddle factor and bit reversal tables
+* of <code>fftLen</code>, as the arm_cfft_sR_q15_len<code>fftLen</code> constant instances do.
+* Unlike these instances, only the tables of the lengths selected by the ARM_TABLE_ macros
+* (see arm_common_tables.h) are referenced: for the other lengths, the function returns
+* ARM_MATH_ARGUMENT_ERROR. arm_cfft_init_twiddle_q15() computes the twiddle factors in RAM instead.
+*/
+
+arm_status arm_cfft_init_q15(
+  arm_cfft_instance_q15 * S,
+  uint16_t fftLen)
+{
+  /*  Initialise the default arm status */
+  arm_status status = ARM_MATH_SUCCESS;
+
+  /*  Initialise the FFT length */
+  S->fftLen = fftLen;
+
+  /*  Initializations of structure parameters depending on the FFT length */
+  switch (fftLen)
+  {
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_4096) && defined(ARM_TABLE_BITREVIDX_FXT_4096)
+  case 4096U:
+    S->pTwiddle     = twiddleCoef_4096_q15;
+    S->pBitRevTable = armBitRevIndexTable_fixed_4096;
+    S->bitRevLength = ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_2048) && defined(ARM_TABLE_BITREVIDX_FXT_2048)
+  case 2048U:
+    S->pTwiddle     = twiddleCoef_2048_q15;
+    S->pBitRevTable = armBitRevIndexTable_fixed_2048;
+    S->bitRevLength = ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_1024) && defined(ARM_TABLE_BITREVIDX_FXT_1024)
+  case 1024U:
+    S->pTwiddle     = twiddleCoef_1024_q15;
+    S->pBitRevTable = armBitRevIndexTable_fixed_1024;
+    S->bitRevLength = ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_512) && defined(ARM_TABLE_BITREVIDX_FXT_512)
+  case 512U:
+    S->pTwiddle     = twiddleCoef_512_q15;
+    S->pBitRevTable = armBitRevIndexTable_fixed_512;
+    S->bitRevLength = ARMBITREVINDEXTABLE_FIXED_512_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_256) && defined(ARM_TABLE_BITREVIDX_FXT_256)
+  case 256U:
+    S->pTwiddle     = twiddleCoef_256_q15;
+    S->pBitRevTable = armBitRevIndexTable_fixed_256;
+    S->bitRevLength = ARMBITREVINDEXTABLE_FIXED_256_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_128) && defined(ARM_TABLE_BITREVIDX_FXT_128)
+  case 128U:
+    S->pTwiddle     = twiddleCoef_128_q15;
+    S->pBitRevTable = armBitRevIndexTable_fixed_128;
+    S->bitRevLength = ARMBITREVINDEXTABLE_FIXED_128_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_64) && defined(ARM_TABLE_BITREVIDX_FXT_64)
+  case 64U:
+    S->pTwiddle     = twiddleCoef_64_q15;
+    S->pBitRevTable = armBitRevIndexTable_fixed_64;
+    S->bitRevLength = ARMBITREVINDEXTABLE_FIXED_64_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_32) && defined(ARM_TABLE_BITREVIDX_FXT_32)
+  case 32U:
+    S->pTwiddle     = twiddleCoef_32_q15;
+    S->pBitRevTable = armBitRevIndexTable_fixed_32;
+    S->bitRevLength = ARMBITREVINDEXTABLE_FIXED_32_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_16) && defined(ARM_TABLE_BITREVIDX_FXT_16)
+  case 16U:
+    S->pTwiddle     = twiddleCoef_16_q15;
+    S->pBitRevTable = armBitRevIndexTable_fixed_16;
+    S->bitRevLength = ARMBITREVINDEXTABLE_FIXED_16_TABLE_LENGTH;
+    break;
+#endif
+  default:
+    /*  Reporting argument error if fftSize is not valid value */
+    status = ARM_MATH_ARGUMENT_ERROR;
+    break;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of ComplexFFT group
+ */
@@ -0,0 +1,467 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_init_twiddle.c
+ * Description:  FFT initialization functions computing the twiddle factors in RAM
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup ComplexFFT
+ * @{
+ */
+
+/**
+ * \par Twiddle factors computed in RAM
+ * The twiddle factor tables of the 4096 point FFT take 32 KB of flash in floating-point,
+ * 24 KB in Q31 and 12 KB in Q15. arm_cfft_init_twiddle_f32(), arm_cfft_init_twiddle_q31(),
+ * arm_cfft_init_twiddle_q15() and arm_rfft_fast_init_twiddle_f32() compute the factors at
+ * initialization in a buffer given by the application, only the bit reversal tables
+ * staying in flash. The instance is then used as one initialized from the tables: the
+ * buffer must stay allocated as long as the instance is used.
+ * \par
+ * The factors e<sup>j2&pi;k/fftLen</sup> are computed by a Q31 recurrence, a rotation by
+ * e<sup>j2&pi;/fftLen</sup> per factor, re-anchored every 16 factors on a value computed
+ * in double precision: the rounding errors of the recurrence do not grow with fftLen.
+ * The Q31 factors are within 5 LSB of the tables, the Q15 factors are the ones of the
+ * tables and the floating-point factors are within 1 ulp of them. The computation takes
+ * 4 integer multiplies per factor and 6 double precision multiplies per anchor, without
+ * any library call.
+ */
+
+/* Number of factors between two anchors, a power of 2 */
+#define TWIDDLE_ANCHOR_STEP      16U
+
+/* Twiddle factor formats */
+#define TWIDDLE_F32              0U  /* float32_t cos, sin: arm_cfft_f32 */
+#define TWIDDLE_F32_SIN_COS      1U  /* float32_t sin, cos: arm_rfft_fast_f32 split stage */
+#define TWIDDLE_Q31              2U  /* q31_t cos, sin: arm_cfft_q31 */
+#define TWIDDLE_Q15              3U  /* q15_t cos, sin: arm_cfft_q15 */
+
+static q31_t arm_twiddle_to_q31(
+  double x)
+{
+  double y = x * 2147483648.0;
+
+  /* Round and saturate cos(0) = 1.0 */
+  y = (y < 0.0) ? y - 0.5 : y + 0.5;
+
+  return (y >= 2147483647.0) ? 0x7FFFFFFF : (q31_t) y;
+}
+
+/*
+ * Writes the numFactors factors cos(2*pi*k/fftLen), sin(2*pi*k/fftLen),
+ * k = 0 .. numFactors - 1, in the given format
+ */
+static void arm_twiddle_gen(
+  void * pDst,
+  uint32_t fftLen,
+  uint32_t numFactors,
+  uint32_t format)
+{
+  double theta, term, c, s, cStep, sStep, cAnchor, sAnchor, t;
+  q31_t cosVal, sinVal, cosNext;                 /* Q31 recurrence */
+  q31_t alphaRot;                                /* 1 - cos(theta) in Q34 */
+  q31_t sinRot;                                  /* sin(theta) in Q32 */
+  float32_t *pF32 = (float32_t *) pDst;
+  q31_t *pQ31 = (q31_t *) pDst;
+  q15_t *pQ15 = (q15_t *) pDst;
+  uint32_t k, i, n;
+
+  /* e^(j*theta) from the Taylor series: theta <= pi / 8 */
+  theta = 6.283185307179586476925 / (double) fftLen;
+  c = 1.0;
+  s = 0.0;
+  term = 1.0;
+  for (n = 1U; n < 24U; n++)
+  {
+    term *= theta / (double) n;
+
+    switch (n & 3U)
+    {
+    case 0U: c += term; break;
+    case 1U: s += term; break;
+    case 2U: c -= term; break;
+    default: s -= term; break;
+    }
+  }
+
+  /* theta <= pi / 8: 1 - cos(theta) < 2^-3 and sin(theta) < 2^-1 keep 3 and 1
+     bits more than Q31 */
+  alphaRot = arm_twiddle_to_q31((1.0 - c) * 8.0);
+  sinRot = arm_twiddle_to_q31(s * 2.0);
+
+  /* Rotation from an anchor to the next one, by squaring e^(j*theta) */
+  cStep = c;
+  sStep = s;
+  for (n = TWIDDLE_ANCHOR_STEP; n > 1U; n >>= 1U)
+  {
+    t = cStep * cStep - sStep * sStep;
+    sStep = 2.0 * cStep * sStep;
+    cStep = t;
+  }
+
+  cAnchor = 1.0;
+  sAnchor = 0.0;
+
+  for (k = 0U; k < numFactors; k += TWIDDLE_ANCHOR_STEP)
+  {
+    /* Re-anchor the recurrence on the double precision value */
+    cosVal = arm_twiddle_to_q31(cAnchor);
+    sinVal = arm_twiddle_to_q31(sAnchor);
+
+    for (i = k; (i < k + TWIDDLE_ANCHOR_STEP) && (i < numFactors); i++)
+    {
+      switch (format)
+      {
+      case TWIDDLE_F32:
+        pF32[2U * i]      = (float32_t) cosVal / 2147483648.0f;
+        pF32[2U * i + 1U] = (float32_t) sinVal / 2147483648.0f;
+        break;
+      case TWIDDLE_F32_SIN_COS:
+        pF32[2U * i]      = (float32_t) sinVal / 2147483648.0f;
+        pF32[2U * i + 1U] = (float32_t) cosVal / 2147483648.0f;
+        break;
+      case TWIDDLE_Q31:
+        pQ31[2U * i]      = cosVal;
+        pQ31[2U * i + 1U] = sinVal;
+        break;
+      default:
+        /* As the tables: truncation of the Q31 value */
+        pQ15[2U * i]      = (q15_t) (cosVal >> 16);
+        pQ15[2U * i + 1U] = (q15_t) (sinVal >> 16);
+        break;
+      }
+
+      /* Rotation by theta, rounded: cos -= cos.(1 - cos(theta)) + sin.sin(theta) */
+      cosNext = clip_q63_to_q31((q63_t) cosVal -
+                ((((((q63_t) cosVal * alphaRot) >> 2) + ((q63_t) sinVal * sinRot)) + 0x80000000LL) >> 32));
+      sinVal  = clip_q63_to_q31((q63_t) sinVal +
+                ((((q63_t) cosVal * sinRot) - (((q63_t) sinVal * alphaRot) >> 2) + 0x80000000LL) >> 32));
+      cosVal  = cosNext;
+    }
+
+    t = cAnchor * cStep - sAnchor * sStep;
+    sAnchor = cAnchor * sStep + sAnchor * cStep;
+    cAnchor = t;
+  }
+}
+
+/* Bit reversal tables of the floating-point complex FFT */
+static arm_status arm_cfft_bitrev_flt(
+  uint16_t fftLen,
+  const uint16_t ** ppBitRevTable,
+  uint16_t * pBitRevLength)
+{
+  arm_status status = ARM_MATH_SUCCESS;
+
+  switch (fftLen)
+  {
+#if defined(ARM_TABLE_BITREVIDX_FLT_4096)
+  case 4096U:
+    *ppBitRevTable = armBitRevIndexTable4096;
+    *pBitRevLength = ARMBITREVINDEXTABLE_4096_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_2048)
+  case 2048U:
+    *ppBitRevTable = armBitRevIndexTable2048;
+    *pBitRevLength = ARMBITREVINDEXTABLE_2048_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_1024)
+  case 1024U:
+    *ppBitRevTable = armBitRevIndexTable1024;
+    *pBitRevLength = ARMBITREVINDEXTABLE_1024_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_512)
+  case 512U:
+    *ppBitRevTable = armBitRevIndexTable512;
+    *pBitRevLength = ARMBITREVINDEXTABLE_512_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_256)
+  case 256U:
+    *ppBitRevTable = armBitRevIndexTable256;
+    *pBitRevLength = ARMBITREVINDEXTABLE_256_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_128)
+  case 128U:
+    *ppBitRevTable = armBitRevIndexTable128;
+    *pBitRevLength = ARMBITREVINDEXTABLE_128_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_64)
+  case 64U:
+    *ppBitRevTable = armBitRevIndexTable64;
+    *pBitRevLength = ARMBITREVINDEXTABLE_64_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_32)
+  case 32U:
+    *ppBitRevTable = armBitRevIndexTable32;
+    *pBitRevLength = ARMBITREVINDEXTABLE_32_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_16)
+  case 16U:
+    *ppBitRevTable = armBitRevIndexTable16;
+    *pBitRevLength = ARMBITREVINDEXTABLE_16_TABLE_LENGTH;
+    break;
+#endif
+  default:
+    status = ARM_MATH_ARGUMENT_ERROR;
+    break;
+  }
+
+  return (status);
+}
+
+/* Bit reversal tables of the fixed-point complex FFT */
+static arm_status arm_cfft_bitrev_fxt(
+  uint16_t fftLen,
+  const uint16_t ** ppBitRevTable,
+  uint16_t * pBitRevLength)
+{
+  arm_status status = ARM_MATH_SUCCESS;
+
+  switch (fftLen)
+  {
+#if defined(ARM_TABLE_BITREVIDX_FXT_4096)
+  case 4096U:
+    *ppBitRevTable = armBitRevIndexTable_fixed_4096;
+    *pBitRevLength = ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FXT_2048)
+  case 2048U:
+    *ppBitRevTable = armBitRevIndexTable_fixed_2048;
+    *pBitRevLength = ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FXT_1024)
+  case 1024U:
+    *ppBitRevTable = armBitRevIndexTable_fixed_1024;
+    *pBitRevLength = ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FXT_512)
+  case 512U:
+    *ppBitRevTable = armBitRevIndexTable_fixed_512;
+    *pBitRevLength = ARMBITREVINDEXTABLE_FIXED_512_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FXT_256)
+  case 256U:
+    *ppBitRevTable = armBitRevIndexTable_fixed_256;
+    *pBitRevLength = ARMBITREVINDEXTABLE_FIXED_256_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FXT_128)
+  case 128U:
+    *ppBitRevTable = armBitRevIndexTable_fixed_128;
+    *pBitRevLength = ARMBITREVINDEXTABLE_FIXED_128_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FXT_64)
+  case 64U:
+    *ppBitRevTable = armBitRevIndexTable_fixed_64;
+    *pBitRevLength = ARMBITREVINDEXTABLE_FIXED_64_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FXT_32)
+  case 32U:
+    *ppBitRevTable = armBitRevIndexTable_fixed_32;
+    *pBitRevLength = ARMBITREVINDEXTABLE_FIXED_32_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FXT_16)
+  case 16U:
+    *ppBitRevTable = armBitRevIndexTable_fixed_16;
+    *pBitRevLength = ARMBITREVINDEXTABLE_FIXED_16_TABLE_LENGTH;
+    break;
+#endif
+  default:
+    status = ARM_MATH_ARGUMENT_ERROR;
+    break;
+  }
+
+  return (status);
+}
+
+/**
+* @brief  Initialization function for the floating-point complex FFT, with the twiddle factors computed in RAM.
+* @param[out]    *S               points to an arm_cfft_instance_f32 structure.
+* @param[in]     fftLen           length of the FFT.
+* @param[out]    *pTwiddleBuffer  points to the twiddle factor buffer, of <code>2*fftLen</code> values.
+* @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.
+*
+* \par
+* Supported FFT lengths are 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, with
+* ARM_TABLE_BITREVIDX_FLT_<code>fftLen</code> defined (see arm_common_tables.h).
+* The buffer receives the values of the twiddleCoef_<code>fftLen</code> table.
+*/
+
+arm_status arm_cfft_init_twiddle_f32(
+  arm_cfft_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddleBuffer)
+{
+  arm_status status;
+
+  S->fftLen = fftLen;
+  status = arm_cfft_bitrev_flt(fftLen, &S->pBitRevTable, &S->bitRevLength);
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    arm_twiddle_gen(pTwiddleBuffer, fftLen, fftLen, TWIDDLE_F32);
+    S->pTwiddle = pTwiddleBuffer;
+  }
+
+  return (status);
+}
+
+/**
+* @brief  Initialization function for the Q31 complex FFT, with the twiddle factors computed in RAM.
+* @param[out]    *S               points to an arm_cfft_instance_q31 structure.
+* @param[in]     fftLen           length of the FFT.
+* @param[out]    *pTwiddleBuffer  points to the twiddle factor buffer, of <code>3*fftLen/2</code> values.
+* @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.
+*
+* \par
+* Supported FFT lengths are 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, with
+* ARM_TABLE_BITREVIDX_FXT_<code>fftLen</code> defined (see arm_common_tables.h).
+* The buffer receives the values of the twiddleCoef_<code>fftLen</code>_q31 table, within 2 LSB.
+*/
+
+arm_status arm_cfft_init_twiddle_q31(
+  arm_cfft_instance_q31 * S,
+  uint16_t fftLen,
+  q31_t * pTwiddleBuffer)
+{
+  arm_status status;
+
+  S->fftLen = fftLen;
+  status = arm_cfft_bitrev_fxt(fftLen, &S->pBitRevTable, &S->bitRevLength);
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    arm_twiddle_gen(pTwiddleBuffer, fftLen, 3U * fftLen / 4U, TWIDDLE_Q31);
+    S->pTwiddle = pTwiddleBuffer;
+  }
+
+  return (status);
+}
+
+/**
+* @brief  Initialization function for the Q15 complex FFT, with the twiddle factors computed in RAM.
+* @param[out]    *S               points to an arm_cfft_instance_q15 structure.
+* @param[in]     fftLen           length of the FFT.
+* @param[out]    *pTwiddleBuffer  points to the twiddle factor buffer, of <code>3*fftLen/2</code> values.
+* @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.
+*
+* \par
+* Supported FFT lengths are 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, with
+* ARM_TABLE_BITREVIDX_FXT_<code>fftLen</code> defined (see arm_common_tables.h).
+* The buffer receives the values of the twiddleCoef_<code>fftLen</code>_q15 table, within 1 LSB.
+*/
+
+arm_status arm_cfft_init_twiddle_q15(
+  arm_cfft_instance_q15 * S,
+  uint16_t fftLen,
+  q15_t * pTwiddleBuffer)
+{
+  arm_status status;
+
+  S->fftLen = fftLen;
+  status = arm_cfft_bitrev_fxt(fftLen, &S->pBitRevTable, &S->bitRevLength);
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    arm_twiddle_gen(pTwiddleBuffer, fftLen, 3U * fftLen / 4U, TWIDDLE_Q15);
+    S->pTwiddle = pTwiddleBuffer;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of ComplexFFT group
+ */
+
+/**
+ * @addtogroup RealFFT
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the floating-point real FFT, with the twiddle factors computed in RAM.
+* @param[out]    *S               points to an arm_rfft_fast_instance_f32 structure.
+* @param[in]     fftLen           length of the Real Sequence.
+* @param[out]    *pTwiddleBuffer  points to the twiddle factor buffer, of <code>2*fftLen</code> values.
+* @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.
+*
+* \par
+* Supported FFT lengths are 32, 64, 128, 256, 512, 1024, 2048, 4096, with
+* ARM_TABLE_BITREVIDX_FLT_<code>fftLen/2</code> defined (see arm_common_tables.h).
+* The first <code>fftLen</code> values of the buffer receive the twiddle factors of
+* the <code>fftLen/2</code> points complex FFT, the next <code>fftLen</code> values
+* the ones of the split stage, as the twiddleCoef_rfft_<code>fftLen</code> table.
+*/
+
+arm_status arm_rfft_fast_init_twiddle_f32(
+  arm_rfft_fast_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddleBuffer)
+{
+  arm_status status;
+
+  if (fftLen < 32U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->fftLenRFFT = fftLen;
+  status = arm_cfft_init_twiddle_f32(&S->Sint, fftLen / 2U, pTwiddleBuffer);
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    arm_twiddle_gen(pTwiddleBuffer + fftLen, fftLen, fftLen / 2U, TWIDDLE_F32_SIN_COS);
+    S->pTwiddleRFFT = pTwiddleBuffer + fftLen;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of RealFFT group
+ */
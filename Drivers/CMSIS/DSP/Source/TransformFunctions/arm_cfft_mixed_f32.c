@@ -0,0 +1,431 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mixed_f32.c
+ * Description:  Mixed-radix (2, 3, 4, 5) Complex FFT Processing function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup ComplexFFT
+ * @{
+ */
+
+/**
+ * \par Mixed-radix FFT
+ * arm_cfft_mixed_f32() computes the floating-point complex FFT of any length
+ * 2<sup>a</sup>3<sup>b</sup>5<sup>c</sup>, e.g. 1000, 1200 or 3000 points, when
+ * arm_cfft_f32() supports the powers of 2 only. The length is factored at
+ * initialization by arm_cfft_mixed_init_f32() into radix-4 stages, at most one radix-2
+ * stage, then radix-3 and radix-5 stages, and the twiddle factors of the stages are
+ * computed in a buffer given by the application.
+ * \par
+ * The stages are self-sorting (Stockham algorithm): each stage reads the data from one
+ * buffer and writes it in order to the other, the input buffer and the work buffer
+ * alternating, and no bit or digit reversal is needed. The transform is computed in
+ * place, as arm_cfft_f32(), the work buffer being part of the instance: an instance
+ * must not be used by two transforms at the same time.
+ * \par
+ * The forward transform is not scaled, the inverse transform is scaled by 1/fftLen,
+ * as arm_cfft_f32(). The inverse transform uses the forward stages on the conjugate
+ * data: IFFT(x) = conj(FFT(conj(x))) / fftLen.
+ */
+
+/* Stockham stage of radix p: for k < l1 and i < ido, the p inputs
+ * in[i + ido * (j + p * k)], j < p, give the p outputs out[i + ido * (k + l1 * m)],
+ * m < p, of their p-point DFT multiplied by conj(twiddle[(p - 1) * i + m - 1]) =
+ * exp(-j*2*pi*m*l1*i/fftLen). For i = 0 the twiddle factors are 1. */
+
+static void arm_cfft_mixed_radix2_f32(
+  uint32_t ido,
+  uint32_t l1,
+  const float32_t * pIn,
+  float32_t * pOut,
+  const float32_t * pTwiddle)
+{
+  const float32_t *pX;                           /* Inputs of the butterfly */
+  const float32_t *pW;                           /* Twiddle factors */
+  float32_t *pY;                                 /* Outputs of the butterfly */
+  float32_t x0r, x0i, x1r, x1i, yr, yi, wr, wi;  /* Temporary variables */
+  uint32_t sIn = 2U * ido;                       /* Distance between two inputs */
+  uint32_t sOut = 2U * ido * l1;                 /* Distance between two outputs */
+  uint32_t i, k;                                 /* Loop counters */
+
+  for (k = 0U; k < l1; k++)
+  {
+    pX = pIn + 2U * sIn * k;
+    pY = pOut + sIn * k;
+    pW = pTwiddle;
+
+    for (i = 0U; i < ido; i++)
+    {
+      x0r = pX[0];
+      x0i = pX[1];
+      x1r = pX[sIn];
+      x1i = pX[sIn + 1U];
+
+      pY[0] = x0r + x1r;
+      pY[1] = x0i + x1i;
+
+      yr = x0r - x1r;
+      yi = x0i - x1i;
+
+      if (i == 0U)
+      {
+        pY[sOut]      = yr;
+        pY[sOut + 1U] = yi;
+      }
+      else
+      {
+        wr = pW[0];
+        wi = pW[1];
+        pY[sOut]      = yr * wr + yi * wi;
+        pY[sOut + 1U] = yi * wr - yr * wi;
+      }
+
+      pX += 2U;
+      pY += 2U;
+      pW += 2U;
+    }
+  }
+}
+
+static void arm_cfft_mixed_radix3_f32(
+  uint32_t ido,
+  uint32_t l1,
+  const float32_t * pIn,
+  float32_t * pOut,
+  const float32_t * pTwiddle)
+{
+  const float32_t c1 = -0.5f;                    /* cos(2*pi/3) */
+  const float32_t s1 = 0.866025403784438646764f; /* sin(2*pi/3) */
+  const float32_t *pX;                           /* Inputs of the butterfly */
+  const float32_t *pW;                           /* Twiddle factors */
+  float32_t *pY;                                 /* Outputs of the butterfly */
+  float32_t x0r, x0i, tr, ti, dr, di, mr, mi;    /* Temporary variables */
+  float32_t y1r, y1i, y2r, y2i;                  /* Temporary variables */
+  uint32_t sIn = 2U * ido;                       /* Distance between two inputs */
+  uint32_t sOut = 2U * ido * l1;                 /* Distance between two outputs */
+  uint32_t i, k;                                 /* Loop counters */
+
+  for (k = 0U; k < l1; k++)
+  {
+    pX = pIn + 3U * sIn * k;
+    pY = pOut + sIn * k;
+    pW = pTwiddle;
+
+    for (i = 0U; i < ido; i++)
+    {
+      x0r = pX[0];
+      x0i = pX[1];
+      tr = pX[sIn] + pX[2U * sIn];
+      ti = pX[sIn + 1U] + pX[2U * sIn + 1U];
+      dr = s1 * (pX[sIn] - pX[2U * sIn]);
+      di = s1 * (pX[sIn + 1U] - pX[2U * sIn + 1U]);
+
+      /* y0 = x0 + t, y1 = x0 + c1.t - j.s1.d, y2 = x0 + c1.t + j.s1.d */
+      pY[0] = x0r + tr;
+      pY[1] = x0i + ti;
+
+      mr = x0r + c1 * tr;
+      mi = x0i + c1 * ti;
+      y1r = mr + di;
+      y1i = mi - dr;
+      y2r = mr - di;
+      y2i = mi + dr;
+
+      if (i == 0U)
+      {
+        pY[sOut]           = y1r;
+        pY[sOut + 1U]      = y1i;
+        pY[2U * sOut]      = y2r;
+        pY[2U * sOut + 1U] = y2i;
+      }
+      else
+      {
+        pY[sOut]           = y1r * pW[0] + y1i * pW[1];
+        pY[sOut + 1U]      = y1i * pW[0] - y1r * pW[1];
+        pY[2U * sOut]      = y2r * pW[2] + y2i * pW[3];
+        pY[2U * sOut + 1U] = y2i * pW[2] - y2r * pW[3];
+      }
+
+      pX += 2U;
+      pY += 2U;
+      pW += 4U;
+    }
+  }
+}
+
+static void arm_cfft_mixed_radix4_f32(
+  uint32_t ido,
+  uint32_t l1,
+  const float32_t * pIn,
+  float32_t * pOut,
+  const float32_t * pTwiddle)
+{
+  const float32_t *pX;                           /* Inputs of the butterfly */
+  const float32_t *pW;                           /* Twiddle factors */
+  float32_t *pY;                                 /* Outputs of the butterfly */
+  float32_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i; /* Temporary variables */
+  float32_t y1r, y1i, y2r, y2i, y3r, y3i;        /* Temporary variables */
+  uint32_t sIn = 2U * ido;                       /* Distance between two inputs */
+  uint32_t sOut = 2U * ido * l1;                 /* Distance between two outputs */
+  uint32_t i, k;                                 /* Loop counters */
+
+  for (k = 0U; k < l1; k++)
+  {
+    pX = pIn + 4U * sIn * k;
+    pY = pOut + sIn * k;
+    pW = pTwiddle;
+
+    for (i = 0U; i < ido; i++)
+    {
+      t0r = pX[0] + pX[2U * sIn];
+      t0i = pX[1] + pX[2U * sIn + 1U];
+      t1r = pX[0] - pX[2U * sIn];
+      t1i = pX[1] - pX[2U * sIn + 1U];
+      t2r = pX[sIn] + pX[3U * sIn];
+      t2i = pX[sIn + 1U] + pX[3U * sIn + 1U];
+      t3r = pX[sIn] - pX[3U * sIn];
+      t3i = pX[sIn + 1U] - pX[3U * sIn + 1U];
+
+      /* y0 = t0 + t2, y1 = t1 - j.t3, y2 = t0 - t2, y3 = t1 + j.t3 */
+      pY[0] = t0r + t2r;
+      pY[1] = t0i + t2i;
+
+      y1r = t1r + t3i;
+      y1i = t1i - t3r;
+      y2r = t0r - t2r;
+      y2i = t0i - t2i;
+      y3r = t1r - t3i;
+      y3i = t1i + t3r;
+
+      if (i == 0U)
+      {
+        pY[sOut]           = y1r;
+        pY[sOut + 1U]      = y1i;
+        pY[2U * sOut]      = y2r;
+        pY[2U * sOut + 1U] = y2i;
+        pY[3U * sOut]      = y3r;
+        pY[3U * sOut + 1U] = y3i;
+      }
+      else
+      {
+        pY[sOut]           = y1r * pW[0] + y1i * pW[1];
+        pY[sOut + 1U]      = y1i * pW[0] - y1r * pW[1];
+        pY[2U * sOut]      = y2r * pW[2] + y2i * pW[3];
+        pY[2U * sOut + 1U] = y2i * pW[2] - y2r * pW[3];
+        pY[3U * sOut]      = y3r * pW[4] + y3i * pW[5];
+        pY[3U * sOut + 1U] = y3i * pW[4] - y3r * pW[5];
+      }
+
+      pX += 2U;
+      pY += 2U;
+      pW += 6U;
+    }
+  }
+}
+
+static void arm_cfft_mixed_radix5_f32(
+  uint32_t ido,
+  uint32_t l1,
+  const float32_t * pIn,
+  float32_t * pOut,
+  const float32_t * pTwiddle)
+{
+  const float32_t c1 =  0.309016994374947424102f; /* cos(2*pi/5) */
+  const float32_t c2 = -0.809016994374947424102f; /* cos(4*pi/5) */
+  const float32_t s1 =  0.951056516295153572116f; /* sin(2*pi/5) */
+  const float32_t s2 =  0.587785252292473129169f; /* sin(4*pi/5) */
+  const float32_t *pX;                           /* Inputs of the butterfly */
+  const float32_t *pW;                           /* Twiddle factors */
+  float32_t *pY;                                 /* Outputs of the butterfly */
+  float32_t x0r, x0i, t1r, t1i, t2r, t2i, d1r, d1i, d2r, d2i; /* Temporary variables */
+  float32_t a1r, a1i, a2r, a2i, b1r, b1i, b2r, b2i; /* Temporary variables */
+  float32_t y1r, y1i, y2r, y2i, y3r, y3i, y4r, y4i; /* Temporary variables */
+  uint32_t sIn = 2U * ido;                       /* Distance between two inputs */
+  uint32_t sOut = 2U * ido * l1;                 /* Distance between two outputs */
+  uint32_t i, k;                                 /* Loop counters */
+
+  for (k = 0U; k < l1; k++)
+  {
+    pX = pIn + 5U * sIn * k;
+    pY = pOut + sIn * k;
+    pW = pTwiddle;
+
+    for (i = 0U; i < ido; i++)
+    {
+      x0r = pX[0];
+      x0i = pX[1];
+      t1r = pX[sIn] + pX[4U * sIn];
+      t1i = pX[sIn + 1U] + pX[4U * sIn + 1U];
+      d1r = pX[sIn] - pX[4U * sIn];
+      d1i = pX[sIn + 1U] - pX[4U * sIn + 1U];
+      t2r = pX[2U * sIn] + pX[3U * sIn];
+      t2i = pX[2U * sIn + 1U] + pX[3U * sIn + 1U];
+      d2r = pX[2U * sIn] - pX[3U * sIn];
+      d2i = pX[2U * sIn + 1U] - pX[3U * sIn + 1U];
+
+      /* y0 = x0 + t1 + t2, y1 = a1 - j.b1, y4 = a1 + j.b1, y2 = a2 - j.b2, y3 = a2 + j.b2
+         with a1 = x0 + c1.t1 + c2.t2, a2 = x0 + c2.t1 + c1.t2, b1 = s1.d1 + s2.d2 and
+         b2 = s2.d1 - s1.d2 */
+      pY[0] = x0r + t1r + t2r;
+      pY[1] = x0i + t1i + t2i;
+
+      a1r = x0r + c1 * t1r + c2 * t2r;
+      a1i = x0i + c1 * t1i + c2 * t2i;
+      a2r = x0r + c2 * t1r + c1 * t2r;
+      a2i = x0i + c2 * t1i + c1 * t2i;
+      b1r = s1 * d1r + s2 * d2r;
+      b1i = s1 * d1i + s2 * d2i;
+      b2r = s2 * d1r - s1 * d2r;
+      b2i = s2 * d1i - s1 * d2i;
+
+      y1r = a1r + b1i;
+      y1i = a1i - b1r;
+      y4r = a1r - b1i;
+      y4i = a1i + b1r;
+      y2r = a2r + b2i;
+      y2i = a2i - b2r;
+      y3r = a2r - b2i;
+      y3i = a2i + b2r;
+
+      if (i == 0U)
+      {
+        pY[sOut]           = y1r;
+        pY[sOut + 1U]      = y1i;
+        pY[2U * sOut]      = y2r;
+        pY[2U * sOut + 1U] = y2i;
+        pY[3U * sOut]      = y3r;
+        pY[3U * sOut + 1U] = y3i;
+        pY[4U * sOut]      = y4r;
+        pY[4U * sOut + 1U] = y4i;
+      }
+      else
+      {
+        pY[sOut]           = y1r * pW[0] + y1i * pW[1];
+        pY[sOut + 1U]      = y1i * pW[0] - y1r * pW[1];
+        pY[2U * sOut]      = y2r * pW[2] + y2i * pW[3];
+        pY[2U * sOut + 1U] = y2i * pW[2] - y2r * pW[3];
+        pY[3U * sOut]      = y3r * pW[4] + y3i * pW[5];
+        pY[3U * sOut + 1U] = y3i * pW[4] - y3r * pW[5];
+        pY[4U * sOut]      = y4r * pW[6] + y4i * pW[7];
+        pY[4U * sOut + 1U] = y4i * pW[6] - y4r * pW[7];
+      }
+
+      pX += 2U;
+      pY += 2U;
+      pW += 8U;
+    }
+  }
+}
+
+/**
+ * @brief Processing function for the floating-point mixed-radix complex FFT.
+ * @param[in]      *S              points to an instance of the floating-point mixed-radix CFFT structure.
+ * @param[in, out] *p1             points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+ * @param[in]      ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+ * @return none.
+ */
+
+void arm_cfft_mixed_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+  float32_t * p1,
+  uint8_t ifftFlag)
+{
+  const float32_t *pTwiddle = S->pTwiddle;       /* Twiddle factors of the stage */
+  float32_t *pIn = p1;                           /* Input of the stage */
+  float32_t *pOut = S->pScratch;                 /* Output of the stage */
+  float32_t *pTmp;                               /* Temporary pointer */
+  float32_t invL;                                /* 1 / fftLen */
+  uint32_t L = S->fftLen;                        /* Length of the FFT */
+  uint32_t l1 = 1U;                              /* Butterflies per output block */
+  uint32_t ido;                                  /* Points per butterfly block */
+  uint32_t radix;                                /* Radix of the stage */
+  uint32_t stage, i;                             /* Loop counters */
+
+  /* Inverse transform on the conjugate data */
+  if (ifftFlag == 1U)
+  {
+    for (i = 0U; i < L; i++)
+    {
+      p1[2U * i + 1U] = -p1[2U * i + 1U];
+    }
+  }
+
+  for (stage = 0U; stage < S->numStages; stage++)
+  {
+    radix = S->radix[stage];
+    ido = L / (l1 * radix);
+
+    switch (radix)
+    {
+    case 4U:
+      arm_cfft_mixed_radix4_f32(ido, l1, pIn, pOut, pTwiddle);
+      break;
+    case 2U:
+      arm_cfft_mixed_radix2_f32(ido, l1, pIn, pOut, pTwiddle);
+      break;
+    case 3U:
+      arm_cfft_mixed_radix3_f32(ido, l1, pIn, pOut, pTwiddle);
+      break;
+    default:
+      arm_cfft_mixed_radix5_f32(ido, l1, pIn, pOut, pTwiddle);
+      break;
+    }
+
+    pTwiddle += 2U * (radix - 1U) * ido;
+    l1 *= radix;
+
+    pTmp = pIn;
+    pIn = pOut;
+    pOut = pTmp;
+  }
+
+  /* The output of the last stage is in pIn: copy it back to p1 if it is in
+     the work buffer, conjugating and scaling the inverse transform */
+  if (ifftFlag == 1U)
+  {
+    invL = 1.0f / (float32_t) L;
+
+    for (i = 0U; i < L; i++)
+    {
+      p1[2U * i]      =  pIn[2U * i] * invL;
+      p1[2U * i + 1U] = -pIn[2U * i + 1U] * invL;
+    }
+  }
+  else if (pIn != p1)
+  {
+    memcpy(p1, pIn, 2U * L * sizeof(float32_t));
+  }
+}
+
+/**
+ * @} end of ComplexFFT group
+ */
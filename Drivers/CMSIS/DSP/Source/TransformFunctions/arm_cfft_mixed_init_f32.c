@@ -0,0 +1,200 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mixed_init_f32.c
+ * Description:  Initialization functions of the mixed-radix Complex and Real FFTs
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern void arm_dft_cos_sin(
+  uint32_t k,
+  uint32_t n,
+  double * pCos,
+  double * pSin);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup ComplexFFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point mixed-radix complex FFT.
+ * @param[in,out] *S       points to an instance of the floating-point mixed-radix CFFT structure.
+ * @param[in]     fftLen   length of the FFT: 2<sup>a</sup>3<sup>b</sup>5<sup>c</sup>, not zero.
+ * @param[in]     *pBuffer points to a buffer of <code>4*fftLen</code> values, used for the
+ *                         twiddle factors and as work buffer of the transform.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or
+ *                ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported length.
+ *
+ * \par
+ * The twiddle factors of the stages are the first <code>2*(fftLen-1)</code> values of the
+ * buffer and the last <code>2*fftLen</code> values are the work buffer. The buffer must
+ * stay allocated as long as the instance is used, and be used by one instance only.
+ * The factors are computed in double precision: the initialization takes about 40 floating
+ * point operations per point.
+ */
+
+arm_status arm_cfft_mixed_init_f32(
+  arm_cfft_mixed_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pBuffer)
+{
+  float32_t *pTwiddle = pBuffer;                 /* Twiddle factors of the stage */
+  uint32_t n = fftLen;                           /* Part of the length left to factor */
+  uint32_t numStages = 0U;                       /* Number of stages */
+  uint32_t l1, ido, radix;                       /* Stage geometry */
+  uint32_t stage, i, m;                          /* Loop counters */
+  double c, s;                                   /* Twiddle factor */
+
+  if (fftLen == 0U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Radix-4 stages first, then radix 2, 3 and 5: a 16-bit length has at most
+     10 stages */
+  while ((n % 4U) == 0U)
+  {
+    S->radix[numStages++] = 4U;
+    n /= 4U;
+  }
+  if ((n % 2U) == 0U)
+  {
+    S->radix[numStages++] = 2U;
+    n /= 2U;
+  }
+  while ((n % 3U) == 0U)
+  {
+    S->radix[numStages++] = 3U;
+    n /= 3U;
+  }
+  while ((n % 5U) == 0U)
+  {
+    S->radix[numStages++] = 5U;
+    n /= 5U;
+  }
+
+  if (n != 1U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->fftLen = fftLen;
+  S->numStages = (uint16_t) numStages;
+  S->pTwiddle = pBuffer;
+  S->pScratch = pBuffer + 2U * fftLen;
+
+  /* Twiddle factors exp(j*2*pi*m*l1*i/fftLen), 0 < m < radix, of each i < ido,
+     in the order of use: (fftLen - 1) complex values over all stages */
+  l1 = 1U;
+  for (stage = 0U; stage < numStages; stage++)
+  {
+    radix = S->radix[stage];
+    ido = fftLen / (l1 * radix);
+
+    for (i = 0U; i < ido; i++)
+    {
+      for (m = 1U; m < radix; m++)
+      {
+        arm_dft_cos_sin(m * l1 * i, fftLen, &c, &s);
+        pTwiddle[0] = (float32_t) c;
+        pTwiddle[1] = (float32_t) s;
+        pTwiddle += 2U;
+      }
+    }
+
+    l1 *= radix;
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of ComplexFFT group
+ */
+
+/**
+ * @addtogroup RealFFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point mixed-radix real FFT.
+ * @param[in,out] *S       points to an arm_rfft_mixed_instance_f32 structure.
+ * @param[in]     fftLen   length of the real sequence: 2<sup>a</sup>3<sup>b</sup>5<sup>c</sup>,
+ *                         a > 0.
+ * @param[in]     *pBuffer points to a buffer of <code>3*fftLen</code> values, used for the
+ *                         twiddle factors and as work buffer of the transform.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or
+ *                ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported length.
+ *
+ * \par
+ * The first <code>2*fftLen</code> values of the buffer are the ones of the
+ * <code>fftLen/2</code> points complex FFT, given to arm_cfft_mixed_init_f32(), and the
+ * last <code>fftLen</code> values are the twiddle factors of the real stage. The buffer
+ * must stay allocated as long as the instance is used, and be used by one instance only.
+ */
+
+arm_status arm_rfft_mixed_init_f32(
+  arm_rfft_mixed_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pBuffer)
+{
+  float32_t *pTwiddle = pBuffer + 2U * fftLen;   /* Twiddle factors of the real stage */
+  arm_status status;
+  double c, s;                                   /* Twiddle factor */
+  uint32_t k;                                    /* Loop counter */
+
+  if ((fftLen & 1U) != 0U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  status = arm_cfft_mixed_init_f32(&(S->Sint), fftLen / 2U, pBuffer);
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    S->fftLenRFFT = fftLen;
+    S->pTwiddleRFFT = pTwiddle;
+
+    /* exp(j*2*pi*k/fftLen), k < fftLen/2 */
+    for (k = 0U; k < fftLen / 2U; k++)
+    {
+      arm_dft_cos_sin(k, fftLen, &c, &s);
+      pTwiddle[2U * k] = (float32_t) c;
+      pTwiddle[2U * k + 1U] = (float32_t) s;
+    }
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of RealFFT group
+ */
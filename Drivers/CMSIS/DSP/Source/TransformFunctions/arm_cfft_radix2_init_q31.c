@@ -71,6 +71,7 @@ arm_status arm_cfft_radix2_init_q31(
   /*  Initialise the default arm status */
   arm_status status = ARM_MATH_SUCCESS;
 
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_4096) && defined(ARM_TABLE_BITREV_1024)
   /*  Initialise the FFT length */
   S->fftLen = fftLen;
 
@@ -165,6 +166,9 @@ arm_status arm_cfft_radix2_init_q31(
     status = ARM_MATH_ARGUMENT_ERROR;
     break;
   }
+#else
+  status = ARM_MATH_ARGUMENT_ERROR;
+#endif
 
   return (status);
 }
@@ -70,6 +70,7 @@ arm_status arm_cfft_radix4_init_f32(
   /*  Initialise the default arm status */
   arm_status status = ARM_MATH_SUCCESS;
 
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_4096) && defined(ARM_TABLE_BITREV_1024)
   /*  Initialise the FFT length */
   S->fftLen = fftLen;
 
@@ -143,6 +144,9 @@ arm_status arm_cfft_radix4_init_f32(
     status = ARM_MATH_ARGUMENT_ERROR;
     break;
   }
+#else
+  status = ARM_MATH_ARGUMENT_ERROR;
+#endif
 
   return (status);
 }
@@ -70,6 +70,7 @@ arm_status arm_cfft_radix4_init_q15(
 {
   /*  Initialise the default arm status */
   arm_status status = ARM_MATH_SUCCESS;
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_4096) && defined(ARM_TABLE_BITREV_1024)
   /*  Initialise the FFT length */
   S->fftLen = fftLen;
   /*  Initialise the Twiddle coefficient pointer */
@@ -131,6 +132,9 @@ arm_status arm_cfft_radix4_init_q15(
     status = ARM_MATH_ARGUMENT_ERROR;
     break;
   }
+#else
+  status = ARM_MATH_ARGUMENT_ERROR;
+#endif
 
   return (status);
 }
@@ -33,6 +33,293 @@
  * Internal helper function used by the FFTs
  * -------------------------------------------------------------------- */
 
+#if defined (ARM_MATH_HOST_SIMD)
+
+/*
+* @brief  One radix-8 pass of arm_radix8_butterfly_f32 with the host vector types.
+* @param[in, out] *pSrc            points to the in-place buffer of floating-point data type.
+* @param[in]      fftLen           length of the FFT.
+* @param[in]      n2               number of butterflies per group, a multiple of ARM_HOST_F32_LANES.
+* @param[in]      *pCoef           points to the twiddle coefficient buffer.
+* @param[in]      twidCoefModifier twiddle coefficient modifier of the pass.
+* @return none.
+*
+* Each vector lane computes the butterfly of one index j of the group, the
+* operations being the ones of the scalar code. The j = 0 butterfly, which the
+* scalar code computes without twiddles, uses the twiddle 1 + 0i here: the
+* results are the same.
+*/
+static void arm_radix8_butterfly_pass_f32(
+float32_t * pSrc,
+uint32_t fftLen,
+uint32_t n2,
+const float32_t * pCoef,
+uint32_t twidCoefModifier)
+{
+   uint32_t n1 = n2 << 3;
+   uint32_t i1, j, l, ia;
+   float32_t *p;
+
+   arm_host_f32v x1, x2, x3, x4, x5, x6, x7, x8;
+   arm_host_f32v y1, y2, y3, y4, y5, y6, y7, y8;
+   arm_host_f32v r1, r2, r3, r4, r5, r6, r7, r8;
+   arm_host_f32v t1, t2;
+   arm_host_f32v s1, s2, s3, s4, s5, s6, s7, s8;
+   arm_host_f32v co2, co3, co4, co5, co6, co7, co8;
+   arm_host_f32v si2, si3, si4, si5, si6, si7, si8;
+   const arm_host_f32v C81 = arm_host_dup_f32v(0.70710678118f);
+
+   for (j = 0U; j < n2; j += ARM_HOST_F32_LANES)
+   {
+      /* Twiddles of the ARM_HOST_F32_LANES butterflies */
+      for (l = 0U; l < ARM_HOST_F32_LANES; l++)
+      {
+         ia = (j + l) * twidCoefModifier;
+
+         co2[l] = pCoef[2U * ia];
+         co3[l] = pCoef[4U * ia];
+         co4[l] = pCoef[6U * ia];
+         co5[l] = pCoef[8U * ia];
+         co6[l] = pCoef[10U * ia];
+         co7[l] = pCoef[12U * ia];
+         co8[l] = pCoef[14U * ia];
+         si2[l] = pCoef[2U * ia + 1U];
+         si3[l] = pCoef[4U * ia + 1U];
+         si4[l] = pCoef[6U * ia + 1U];
+         si5[l] = pCoef[8U * ia + 1U];
+         si6[l] = pCoef[10U * ia + 1U];
+         si7[l] = pCoef[12U * ia + 1U];
+         si8[l] = pCoef[14U * ia + 1U];
+      }
+
+      for (i1 = j; i1 < fftLen; i1 += n1)
+      {
+         p = pSrc + 2U * i1;
+
+         arm_host_load_cmplx_f32v(p,           &x1, &y1);
+         arm_host_load_cmplx_f32v(p + 2U * n2, &x2, &y2);
+         arm_host_load_cmplx_f32v(p + 4U * n2, &x3, &y3);
+         arm_host_load_cmplx_f32v(p + 6U * n2, &x4, &y4);
+         arm_host_load_cmplx_f32v(p + 8U * n2, &x5, &y5);
+         arm_host_load_cmplx_f32v(p + 10U * n2, &x6, &y6);
+         arm_host_load_cmplx_f32v(p + 12U * n2, &x7, &y7);
+         arm_host_load_cmplx_f32v(p + 14U * n2, &x8, &y8);
+
+         r1 = x1 + x5;
+         r5 = x1 - x5;
+         r2 = x2 + x6;
+         r6 = x2 - x6;
+         r3 = x3 + x7;
+         r7 = x3 - x7;
+         r4 = x4 + x8;
+         r8 = x4 - x8;
+         t1 = r1 - r3;
+         r1 = r1 + r3;
+         r3 = r2 - r4;
+         r2 = r2 + r4;
+         x1 = r1 + r2;
+         r2 = r1 - r2;
+         s1 = y1 + y5;
+         s5 = y1 - y5;
+         s2 = y2 + y6;
+         s6 = y2 - y6;
+         s3 = y3 + y7;
+         s7 = y3 - y7;
+         s4 = y4 + y8;
+         s8 = y4 - y8;
+         t2 = s1 - s3;
+         s1 = s1 + s3;
+         s3 = s2 - s4;
+         s2 = s2 + s4;
+         r1 = t1 + s3;
+         t1 = t1 - s3;
+         y1 = s1 + s2;
+         s2 = s1 - s2;
+         s1 = t2 - r3;
+         t2 = t2 + r3;
+         x5 = co5 * r2 + si5 * s2;
+         y5 = co5 * s2 - si5 * r2;
+         x3 = co3 * r1 + si3 * s1;
+         y3 = co3 * s1 - si3 * r1;
+         x7 = co7 * t1 + si7 * t2;
+         y7 = co7 * t2 - si7 * t1;
+         r1 = (r6 - r8) * C81;
+         r6 = (r6 + r8) * C81;
+         s1 = (s6 - s8) * C81;
+         s6 = (s6 + s8) * C81;
+         t1 = r5 - r1;
+         r5 = r5 + r1;
+         r8 = r7 - r6;
+         r7 = r7 + r6;
+         t2 = s5 - s1;
+         s5 = s5 + s1;
+         s8 = s7 - s6;
+         s7 = s7 + s6;
+         r1 = r5 + s7;
+         r5 = r5 - s7;
+         r6 = t1 + s8;
+         t1 = t1 - s8;
+         s1 = s5 - r7;
+         s5 = s5 + r7;
+         s6 = t2 - r8;
+         t2 = t2 + r8;
+         x2 = co2 * r1 + si2 * s1;
+         y2 = co2 * s1 - si2 * r1;
+         x8 = co8 * r5 + si8 * s5;
+         y8 = co8 * s5 - si8 * r5;
+         x6 = co6 * r6 + si6 * s6;
+         y6 = co6 * s6 - si6 * r6;
+         x4 = co4 * t1 + si4 * t2;
+         y4 = co4 * t2 - si4 * t1;
+
+         arm_host_store_cmplx_f32v(p,           x1, y1);
+         arm_host_store_cmplx_f32v(p + 2U * n2, x2, y2);
+         arm_host_store_cmplx_f32v(p + 4U * n2, x3, y3);
+         arm_host_store_cmplx_f32v(p + 6U * n2, x4, y4);
+         arm_host_store_cmplx_f32v(p + 8U * n2, x5, y5);
+         arm_host_store_cmplx_f32v(p + 10U * n2, x6, y6);
+         arm_host_store_cmplx_f32v(p + 12U * n2, x7, y7);
+         arm_host_store_cmplx_f32v(p + 14U * n2, x8, y8);
+      }
+   }
+}
+
+/* 4 x 4 transpose of the rows p[0..3], p[16..19], p[32..35], p[48..51] */
+__attribute__((always_inline)) __STATIC_INLINE void arm_radix8_transpose_f32x4(
+const float32_t * p,
+arm_host_f32x4 * c0,
+arm_host_f32x4 * c1,
+arm_host_f32x4 * c2,
+arm_host_f32x4 * c3)
+{
+   const arm_host_f32x4 v0 = *(const arm_host_f32x4_u *) p;
+   const arm_host_f32x4 v1 = *(const arm_host_f32x4_u *) (p + 16);
+   const arm_host_f32x4 v2 = *(const arm_host_f32x4_u *) (p + 32);
+   const arm_host_f32x4 v3 = *(const arm_host_f32x4_u *) (p + 48);
+   const arm_host_f32x4 a = ARM_HOST_SHUFFLE(arm_host_i32x4, v0, v1, 0, 4, 1, 5);
+   const arm_host_f32x4 b = ARM_HOST_SHUFFLE(arm_host_i32x4, v2, v3, 0, 4, 1, 5);
+   const arm_host_f32x4 c = ARM_HOST_SHUFFLE(arm_host_i32x4, v0, v1, 2, 6, 3, 7);
+   const arm_host_f32x4 d = ARM_HOST_SHUFFLE(arm_host_i32x4, v2, v3, 2, 6, 3, 7);
+
+   *c0 = ARM_HOST_SHUFFLE(arm_host_i32x4, a, b, 0, 1, 4, 5);
+   *c1 = ARM_HOST_SHUFFLE(arm_host_i32x4, a, b, 2, 3, 6, 7);
+   *c2 = ARM_HOST_SHUFFLE(arm_host_i32x4, c, d, 0, 1, 4, 5);
+   *c3 = ARM_HOST_SHUFFLE(arm_host_i32x4, c, d, 2, 3, 6, 7);
+}
+
+/* Inverse of arm_radix8_transpose_f32x4 */
+__attribute__((always_inline)) __STATIC_INLINE void arm_radix8_transpose_store_f32x4(
+float32_t * p,
+arm_host_f32x4 c0,
+arm_host_f32x4 c1,
+arm_host_f32x4 c2,
+arm_host_f32x4 c3)
+{
+   const arm_host_f32x4 a = ARM_HOST_SHUFFLE(arm_host_i32x4, c0, c1, 0, 4, 1, 5);
+   const arm_host_f32x4 b = ARM_HOST_SHUFFLE(arm_host_i32x4, c2, c3, 0, 4, 1, 5);
+   const arm_host_f32x4 c = ARM_HOST_SHUFFLE(arm_host_i32x4, c0, c1, 2, 6, 3, 7);
+   const arm_host_f32x4 d = ARM_HOST_SHUFFLE(arm_host_i32x4, c2, c3, 2, 6, 3, 7);
+
+   *(arm_host_f32x4_u *) p        = ARM_HOST_SHUFFLE(arm_host_i32x4, a, b, 0, 1, 4, 5);
+   *(arm_host_f32x4_u *) (p + 16) = ARM_HOST_SHUFFLE(arm_host_i32x4, a, b, 2, 3, 6, 7);
+   *(arm_host_f32x4_u *) (p + 32) = ARM_HOST_SHUFFLE(arm_host_i32x4, c, d, 0, 1, 4, 5);
+   *(arm_host_f32x4_u *) (p + 48) = ARM_HOST_SHUFFLE(arm_host_i32x4, c, d, 2, 3, 6, 7);
+}
+
+/*
+* @brief  Last radix-8 pass (one butterfly per group, no twiddles) with the host vector types.
+* @param[in, out] *pSrc            points to the in-place buffer of floating-point data type.
+* @param[in]      fftLen           length of the FFT, a multiple of 32.
+* @return none.
+*
+* Each lane of a 4-lane vector computes the butterfly of one group of 8 complex
+* values, the groups being transposed in and out of the lanes.
+*/
+static void arm_radix8_butterfly_last_f32(
+float32_t * pSrc,
+uint32_t fftLen)
+{
+   uint32_t i1, q;
+   float32_t *p;
+
+   arm_host_f32x4 x[8], y[8];
+   arm_host_f32x4 r1, r2, r3, r4, r5, r6, r7, r8;
+   arm_host_f32x4 t1, t2;
+   arm_host_f32x4 s3, s5, s6, s7, s8;
+   const arm_host_f32x4 C81 = (arm_host_f32x4) { 0 } + 0.70710678118f;
+
+   for (i1 = 0U; i1 < fftLen; i1 += 32U)
+   {
+      p = pSrc + 2U * i1;
+
+      /* {re, im, re, im} of 2 values of each of the 4 groups to x[], y[] */
+      for (q = 0U; q < 4U; q++)
+      {
+         arm_radix8_transpose_f32x4(p + 4U * q, &x[2U * q], &y[2U * q], &x[2U * q + 1U], &y[2U * q + 1U]);
+      }
+
+      r1 = x[0] + x[4];
+      r5 = x[0] - x[4];
+      r2 = x[1] + x[5];
+      r6 = x[1] - x[5];
+      r3 = x[2] + x[6];
+      r7 = x[2] - x[6];
+      r4 = x[3] + x[7];
+      r8 = x[3] - x[7];
+      t1 = r1 - r3;
+      r1 = r1 + r3;
+      r3 = r2 - r4;
+      r2 = r2 + r4;
+      x[0] = r1 + r2;
+      x[4] = r1 - r2;
+      r1 = y[0] + y[4];
+      s5 = y[0] - y[4];
+      r2 = y[1] + y[5];
+      s6 = y[1] - y[5];
+      s3 = y[2] + y[6];
+      s7 = y[2] - y[6];
+      r4 = y[3] + y[7];
+      s8 = y[3] - y[7];
+      t2 = r1 - s3;
+      r1 = r1 + s3;
+      s3 = r2 - r4;
+      r2 = r2 + r4;
+      y[0] = r1 + r2;
+      y[4] = r1 - r2;
+      x[2] = t1 + s3;
+      x[6] = t1 - s3;
+      y[2] = t2 - r3;
+      y[6] = t2 + r3;
+      r1 = (r6 - r8) * C81;
+      r6 = (r6 + r8) * C81;
+      r2 = (s6 - s8) * C81;
+      s6 = (s6 + s8) * C81;
+      t1 = r5 - r1;
+      r5 = r5 + r1;
+      r8 = r7 - r6;
+      r7 = r7 + r6;
+      t2 = s5 - r2;
+      s5 = s5 + r2;
+      s8 = s7 - s6;
+      s7 = s7 + s6;
+      x[1] = r5 + s7;
+      x[7] = r5 - s7;
+      x[5] = t1 + s8;
+      x[3] = t1 - s8;
+      y[1] = s5 - r7;
+      y[7] = s5 + r7;
+      y[5] = t2 - r8;
+      y[3] = t2 + r8;
+
+      for (q = 0U; q < 4U; q++)
+      {
+         arm_radix8_transpose_store_f32x4(p + 4U * q, x[2U * q], y[2U * q], x[2U * q + 1U], y[2U * q + 1U]);
+      }
+   }
+}
+
+#endif /* defined (ARM_MATH_HOST_SIMD) */
+
 /*
 * @brief  Core function for the floating-point CFFT butterfly process.
 * @param[in, out] *pSrc            points to the in-place buffer of floating-point data type.
@@ -63,6 +350,23 @@ uint16_t twidCoefModifier)
 
    n2 = fftLen;
 
+#if defined (ARM_MATH_HOST_SIMD)
+   /* Passes with ARM_HOST_F32_LANES butterflies per group or more run on
+    * vectors, the last ones on the scalar code below */
+   while ((n2 >> 3) >= ARM_HOST_F32_LANES)
+   {
+      n2 = n2 >> 3;
+      arm_radix8_butterfly_pass_f32(pSrc, fftLen, n2, pCoef, twidCoefModifier);
+      twidCoefModifier <<= 3;
+   }
+
+   if ((n2 == 8U) && (fftLen >= 32U))
+   {
+      arm_radix8_butterfly_last_f32(pSrc, fftLen);
+      return;
+   }
+#endif
+
    do
    {
       n1 = n2;
@@ -27,6 +27,7 @@
  */
 
 #include "arm_math.h"
+#include "arm_common_tables.h"
 
 /**
  * @ingroup DCT4_IDCT4
@@ -61,6 +62,7 @@
  * array length is <code>2*N</code>.
  */
 
+#if defined(ARM_TABLE_DCT4_Q15_128)
 static const q15_t ALIGN4 WeightsQ15_128[256] = {
   (q15_t)0x7fff, (q15_t)0x0, (q15_t)0x7ffd, (q15_t)0xfe6e, (q15_t)0x7ff6, (q15_t)0xfcdc, (q15_t)0x7fe9, (q15_t)0xfb4a,
   (q15_t)0x7fd8, (q15_t)0xf9b9, (q15_t)0x7fc2, (q15_t)0xf827, (q15_t)0x7fa7, (q15_t)0xf696, (q15_t)0x7f87, (q15_t)0xf505,
@@ -95,7 +97,9 @@ static const q15_t ALIGN4 WeightsQ15_128[256] = {
   (q15_t)0xc8b, (q15_t)0x809e, (q15_t)0xafb, (q15_t)0x8079, (q15_t)0x96a, (q15_t)0x8059, (q15_t)0x7d9, (q15_t)0x803e,
   (q15_t)0x647, (q15_t)0x8028, (q15_t)0x4b6, (q15_t)0x8017, (q15_t)0x324, (q15_t)0x800a, (q15_t)0x192, (q15_t)0x8003
 };
+#endif
 
+#if defined(ARM_TABLE_DCT4_Q15_512)
 static const q15_t ALIGN4 WeightsQ15_512[1024] = {
   (q15_t)0x7fff, (q15_t)0x0, (q15_t)0x7fff, (q15_t)0xff9c, (q15_t)0x7fff, (q15_t)0xff37, (q15_t)0x7ffe, (q15_t)0xfed3,
   (q15_t)0x7ffd, (q15_t)0xfe6e, (q15_t)0x7ffc, (q15_t)0xfe0a, (q15_t)0x7ffa, (q15_t)0xfda5, (q15_t)0x7ff8, (q15_t)0xfd41,
@@ -226,7 +230,9 @@ static const q15_t ALIGN4 WeightsQ15_512[1024] = {
   (q15_t)0x324, (q15_t)0x800a, (q15_t)0x2bf, (q15_t)0x8008, (q15_t)0x25b, (q15_t)0x8006, (q15_t)0x1f6, (q15_t)0x8004,
   (q15_t)0x192, (q15_t)0x8003, (q15_t)0x12d, (q15_t)0x8002, (q15_t)0xc9, (q15_t)0x8001, (q15_t)0x64, (q15_t)0x8001
 };
+#endif
 
+#if defined(ARM_TABLE_DCT4_Q15_2048)
 static const q15_t ALIGN4 WeightsQ15_2048[4096] = {
   (q15_t)0x7fff, (q15_t)0x0, (q15_t)0x7fff, (q15_t)0xffe7, (q15_t)0x7fff, (q15_t)0xffce, (q15_t)0x7fff, (q15_t)0xffb5,
   (q15_t)0x7fff, (q15_t)0xff9c, (q15_t)0x7fff, (q15_t)0xff83, (q15_t)0x7fff, (q15_t)0xff6a, (q15_t)0x7fff, (q15_t)0xff51,
@@ -741,7 +747,9 @@ static const q15_t ALIGN4 WeightsQ15_2048[4096] = {
   (q15_t)0xc9, (q15_t)0x8001, (q15_t)0xaf, (q15_t)0x8001, (q15_t)0x96, (q15_t)0x8001, (q15_t)0x7d, (q15_t)0x8001,
   (q15_t)0x64, (q15_t)0x8001, (q15_t)0x4b, (q15_t)0x8001, (q15_t)0x32, (q15_t)0x8001, (q15_t)0x19, (q15_t)0x8001
 };
+#endif
 
+#if defined(ARM_TABLE_DCT4_Q15_8192)
 static const q15_t ALIGN4 WeightsQ15_8192[16384] = {
   (q15_t)0x7fff, (q15_t)0x0, (q15_t)0x7fff, (q15_t)0xfffa, (q15_t)0x7fff, (q15_t)0xfff4, (q15_t)0x7fff, (q15_t)0xffee,
   (q15_t)0x7fff, (q15_t)0xffe7, (q15_t)0x7fff, (q15_t)0xffe1, (q15_t)0x7fff, (q15_t)0xffdb, (q15_t)0x7fff, (q15_t)0xffd5,
@@ -2792,6 +2800,7 @@ static const q15_t ALIGN4 WeightsQ15_8192[16384] = {
   (q15_t)0x32, (q15_t)0x8001, (q15_t)0x2b, (q15_t)0x8001, (q15_t)0x25, (q15_t)0x8001, (q15_t)0x1f, (q15_t)0x8001,
   (q15_t)0x19, (q15_t)0x8001, (q15_t)0x12, (q15_t)0x8001, (q15_t)0xc, (q15_t)0x8001, (q15_t)0x6, (q15_t)0x8001
 };
+#endif
 
 
 /**
@@ -2811,6 +2820,7 @@ static const q15_t ALIGN4 WeightsQ15_8192[16384] = {
 
 */
 
+#if defined(ARM_TABLE_DCT4_Q15_128)
 static const q15_t ALIGN4 cos_factorsQ15_128[128] = {
   (q15_t)0x7fff, (q15_t)0x7ffa, (q15_t)0x7ff0, (q15_t)0x7fe1, (q15_t)0x7fce, (q15_t)0x7fb5, (q15_t)0x7f97, (q15_t)0x7f75,
   (q15_t)0x7f4d, (q15_t)0x7f21, (q15_t)0x7ef0, (q15_t)0x7eba, (q15_t)0x7e7f, (q15_t)0x7e3f, (q15_t)0x7dfa, (q15_t)0x7db0,
@@ -2829,7 +2839,9 @@ static const q15_t ALIGN4 cos_factorsQ15_128[128] = {
   (q15_t)0x1833, (q15_t)0x16a8, (q15_t)0x151b, (q15_t)0x138e, (q15_t)0x1201, (q15_t)0x1072, (q15_t)0xee3, (q15_t)0xd53,
   (q15_t)0xbc3, (q15_t)0xa33, (q15_t)0x8a2, (q15_t)0x710, (q15_t)0x57f, (q15_t)0x3ed, (q15_t)0x25b, (q15_t)0xc9
 };
+#endif
 
+#if defined(ARM_TABLE_DCT4_Q15_512)
 static const q15_t ALIGN4 cos_factorsQ15_512[512] = {
   (q15_t)0x7fff, (q15_t)0x7fff, (q15_t)0x7fff, (q15_t)0x7ffe, (q15_t)0x7ffc, (q15_t)0x7ffb, (q15_t)0x7ff9, (q15_t)0x7ff7,
   (q15_t)0x7ff4, (q15_t)0x7ff2, (q15_t)0x7fee, (q15_t)0x7feb, (q15_t)0x7fe7, (q15_t)0x7fe3, (q15_t)0x7fdf, (q15_t)0x7fda,
@@ -2896,7 +2908,9 @@ static const q15_t ALIGN4 cos_factorsQ15_512[512] = {
   (q15_t)0x615, (q15_t)0x5b1, (q15_t)0x54c, (q15_t)0x4e8, (q15_t)0x483, (q15_t)0x41f, (q15_t)0x3ba, (q15_t)0x356,
   (q15_t)0x2f1, (q15_t)0x28d, (q15_t)0x228, (q15_t)0x1c4, (q15_t)0x15f, (q15_t)0xfb, (q15_t)0x96, (q15_t)0x32
 };
+#endif
 
+#if defined(ARM_TABLE_DCT4_Q15_2048)
 static const q15_t ALIGN4 cos_factorsQ15_2048[2048] = {
   (q15_t)0x7fff, (q15_t)0x7fff, (q15_t)0x7fff, (q15_t)0x7fff, (q15_t)0x7fff, (q15_t)0x7fff, (q15_t)0x7fff, (q15_t)0x7fff,
   (q15_t)0x7fff, (q15_t)0x7fff, (q15_t)0x7ffe, (q15_t)0x7ffe, (q15_t)0x7ffe, (q15_t)0x7ffe, (q15_t)0x7ffd, (q15_t)0x7ffd,
@@ -3156,7 +3170,9 @@ static const q15_t ALIGN4 cos_factorsQ15_2048[2048] = {
   (q15_t)0xbc, (q15_t)0xa3, (q15_t)0x8a, (q15_t)0x71, (q15_t)0x57, (q15_t)0x3e, (q15_t)0x25, (q15_t)0xc
 
 };
+#endif
 
+#if defined(ARM_TABLE_DCT4_Q15_8192)
 static const q15_t ALIGN4 cos_factorsQ15_8192[8192] = {
   (q15_t)0x7fff, (q15_t)0x7fff, (q15_t)0x7fff, (q15_t)0x7fff, (q15_t)0x7fff, (q15_t)0x7fff, (q15_t)0x7fff, (q15_t)0x7fff,
   (q15_t)0x7fff, (q15_t)0x7fff, (q15_t)0x7fff, (q15_t)0x7fff, (q15_t)0x7fff, (q15_t)0x7fff, (q15_t)0x7fff, (q15_t)0x7fff,
@@ -4183,6 +4199,7 @@ static const q15_t ALIGN4 cos_factorsQ15_8192[8192] = {
   (q15_t)0x61, (q15_t)0x5b, (q15_t)0x54, (q15_t)0x4e, (q15_t)0x48, (q15_t)0x41, (q15_t)0x3b, (q15_t)0x35,
   (q15_t)0x2f, (q15_t)0x28, (q15_t)0x22, (q15_t)0x1c, (q15_t)0x15, (q15_t)0xf, (q15_t)0x9, (q15_t)0x3
 };
+#endif
 
 /**
  * @} end of DCT4_IDCT4_Table group
@@ -4219,17 +4236,6 @@ arm_status arm_dct4_init_q15(
   /*  Initialise the default arm status */
   arm_status status = ARM_MATH_SUCCESS;
 
-  /* Initializing the pointer array with the weight table base addresses of different lengths */
-  q15_t *twiddlePtr[4] = { (q15_t *) WeightsQ15_128, (q15_t *) WeightsQ15_512,
-    (q15_t *) WeightsQ15_2048, (q15_t *) WeightsQ15_8192
-  };
-
-  /* Initializing the pointer array with the cos factor table base addresses of different lengths */
-  q15_t *pCosFactor[4] =
-    { (q15_t *) cos_factorsQ15_128, (q15_t *) cos_factorsQ15_512,
-    (q15_t *) cos_factorsQ15_2048, (q15_t *) cos_factorsQ15_8192
-  };
-
   /* Initialize the DCT4 length */
   S->N = N;
 
@@ -4248,22 +4254,30 @@ arm_status arm_dct4_init_q15(
   switch (N)
   {
     /* Initialize the table modifier values */
+#if defined(ARM_TABLE_DCT4_Q15_8192)
   case 8192U:
-    S->pTwiddle = twiddlePtr[3];
-    S->pCosFactor = pCosFactor[3];
+    S->pTwiddle = (q15_t *) WeightsQ15_8192;
+    S->pCosFactor = (q15_t *) cos_factorsQ15_8192;
     break;
+#endif
+#if defined(ARM_TABLE_DCT4_Q15_2048)
   case 2048U:
-    S->pTwiddle = twiddlePtr[2];
-    S->pCosFactor = pCosFactor[2];
+    S->pTwiddle = (q15_t *) WeightsQ15_2048;
+    S->pCosFactor = (q15_t *) cos_factorsQ15_2048;
     break;
+#endif
+#if defined(ARM_TABLE_DCT4_Q15_512)
   case 512U:
-    S->pTwiddle = twiddlePtr[1];
-    S->pCosFactor = pCosFactor[1];
+    S->pTwiddle = (q15_t *) WeightsQ15_512;
+    S->pCosFactor = (q15_t *) cos_factorsQ15_512;
     break;
+#endif
+#if defined(ARM_TABLE_DCT4_Q15_128)
   case 128U:
-    S->pTwiddle = twiddlePtr[0];
-    S->pCosFactor = pCosFactor[0];
+    S->pTwiddle = (q15_t *) WeightsQ15_128;
+    S->pCosFactor = (q15_t *) cos_factorsQ15_128;
     break;
+#endif
   default:
     status = ARM_MATH_ARGUMENT_ERROR;
   }
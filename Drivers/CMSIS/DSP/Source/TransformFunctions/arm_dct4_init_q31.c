@@ -27,6 +27,7 @@
  */
 
 #include "arm_math.h"
+#include "arm_common_tables.h"
 
 /**
  * @ingroup DCT4_IDCT4
@@ -61,6 +62,7 @@
  * array length is <code>2*N</code>.
  */
 
+#if defined(ARM_TABLE_DCT4_Q31_128)
 static const q31_t WeightsQ31_128[256] = {
   (q31_t)0x7fffffff, (q31_t)0x00000000, (q31_t)0x7ffd885a, (q31_t)0xfe6de2e0, (q31_t)0x7ff62182, (q31_t)0xfcdbd541, (q31_t)0x7fe9cbc0, (q31_t)0xfb49e6a3,
   (q31_t)0x7fd8878e, (q31_t)0xf9b82684, (q31_t)0x7fc25596, (q31_t)0xf826a462, (q31_t)0x7fa736b4, (q31_t)0xf6956fb7, (q31_t)0x7f872bf3, (q31_t)0xf50497fb,
@@ -95,7 +97,9 @@ static const q31_t WeightsQ31_128[256] = {
   (q31_t)0xc8bd35e, (q31_t)0x809dc971, (q31_t)0xafb6805, (q31_t)0x8078d40d, (q31_t)0x96a9049, (q31_t)0x8058c94c, (q31_t)0x7d95b9e, (q31_t)0x803daa6a,
   (q31_t)0x647d97c, (q31_t)0x80277872, (q31_t)0x4b6195d, (q31_t)0x80163440, (q31_t)0x3242abf, (q31_t)0x8009de7e, (q31_t)0x1921d20, (q31_t)0x800277a6
 };
+#endif
 
+#if defined(ARM_TABLE_DCT4_Q31_512)
 static const q31_t WeightsQ31_512[1024] = {
   (q31_t)0x7fffffff, (q31_t)0x00000000, (q31_t)0x7fffd886, (q31_t)0xff9b781d, (q31_t)0x7fff6216, (q31_t)0xff36f078, (q31_t)0x7ffe9cb2, (q31_t)0xfed2694f,
   (q31_t)0x7ffd885a, (q31_t)0xfe6de2e0, (q31_t)0x7ffc250f, (q31_t)0xfe095d69, (q31_t)0x7ffa72d1, (q31_t)0xfda4d929, (q31_t)0x7ff871a2, (q31_t)0xfd40565c,
@@ -226,7 +230,9 @@ static const q31_t WeightsQ31_512[1024] = {
   (q31_t)0x3242abf, (q31_t)0x8009de7e, (q31_t)0x2bfa9a4, (q31_t)0x80078e5e, (q31_t)0x25b26d7, (q31_t)0x80058d2f, (q31_t)0x1f6a297, (q31_t)0x8003daf1,
   (q31_t)0x1921d20, (q31_t)0x800277a6, (q31_t)0x12d96b1, (q31_t)0x8001634e, (q31_t)0xc90f88, (q31_t)0x80009dea, (q31_t)0x6487e3, (q31_t)0x8000277a
 };
+#endif
 
+#if defined(ARM_TABLE_DCT4_Q31_2048)
 static const q31_t WeightsQ31_2048[4096] = {
   (q31_t)0x7fffffff, (q31_t)0x00000000, (q31_t)0x7ffffd88, (q31_t)0xffe6de05, (q31_t)0x7ffff621, (q31_t)0xffcdbc0b, (q31_t)0x7fffe9cb, (q31_t)0xffb49a12,
   (q31_t)0x7fffd886, (q31_t)0xff9b781d, (q31_t)0x7fffc251, (q31_t)0xff82562c, (q31_t)0x7fffa72c, (q31_t)0xff69343f, (q31_t)0x7fff8719, (q31_t)0xff501258,
@@ -741,7 +747,9 @@ static const q31_t WeightsQ31_2048[4096] = {
   (q31_t)0xc90f88, (q31_t)0x80009dea, (q31_t)0xafeda8, (q31_t)0x800078e7, (q31_t)0x96cbc1, (q31_t)0x800058d4, (q31_t)0x7da9d4, (q31_t)0x80003daf,
   (q31_t)0x6487e3, (q31_t)0x8000277a, (q31_t)0x4b65ee, (q31_t)0x80001635, (q31_t)0x3243f5, (q31_t)0x800009df, (q31_t)0x1921fb, (q31_t)0x80000278
 };
+#endif
 
+#if defined(ARM_TABLE_DCT4_Q31_8192)
 static const q31_t WeightsQ31_8192[16384] = {
   (q31_t)0x7fffffff, (q31_t)0x0, (q31_t)0x7fffffd9, (q31_t)0xfff9b781, (q31_t)0x7fffff62, (q31_t)0xfff36f02, (q31_t)0x7ffffe9d,
     (q31_t)0xffed2684,
@@ -4841,6 +4849,7 @@ static const q31_t WeightsQ31_8192[16384] = {
     (q31_t)0x80000027
 
 };
+#endif
 
 /**
 * \par
@@ -4859,6 +4868,7 @@ static const q31_t WeightsQ31_8192[16384] = {
 */
 
 
+#if defined(ARM_TABLE_DCT4_Q31_128)
 static const q31_t cos_factorsQ31_128[128] = {
   (q31_t)0x7fff6216, (q31_t)0x7ffa72d1, (q31_t)0x7ff09478, (q31_t)0x7fe1c76b, (q31_t)0x7fce0c3e, (q31_t)0x7fb563b3,
   (q31_t)0x7f97cebd, (q31_t)0x7f754e80,
@@ -4893,7 +4903,9 @@ static const q31_t cos_factorsQ31_128[128] = {
   (q31_t)0xbc3ac35, (q31_t)0xa3308bd, (q31_t)0x8a2009a, (q31_t)0x710a345, (q31_t)0x57f0035, (q31_t)0x3ed26e6, (q31_t)0x25b26d7,
   (q31_t)0xc90f88
 };
+#endif
 
+#if defined(ARM_TABLE_DCT4_Q31_512)
 static const q31_t cos_factorsQ31_512[512] = {
   (q31_t)0x7ffff621, (q31_t)0x7fffa72c, (q31_t)0x7fff0943, (q31_t)0x7ffe1c65, (q31_t)0x7ffce093, (q31_t)0x7ffb55ce,
   (q31_t)0x7ff97c18, (q31_t)0x7ff75370,
@@ -5024,7 +5036,9 @@ static const q31_t cos_factorsQ31_512[512] = {
   (q31_t)0x2f1ea6c, (q31_t)0x28d6870, (q31_t)0x228e4e2, (q31_t)0x1c45ffe, (q31_t)0x15fda03, (q31_t)0xfb5330, (q31_t)0x96cbc1,
   (q31_t)0x3243f5
 };
+#endif
 
+#if defined(ARM_TABLE_DCT4_Q31_2048)
 static const q31_t cos_factorsQ31_2048[2048] = {
   (q31_t)0x7fffff62, (q31_t)0x7ffffa73, (q31_t)0x7ffff094, (q31_t)0x7fffe1c6, (q31_t)0x7fffce09, (q31_t)0x7fffb55c,
   (q31_t)0x7fff97c1, (q31_t)0x7fff7536,
@@ -5539,7 +5553,9 @@ static const q31_t cos_factorsQ31_2048[2048] = {
   (q31_t)0xbc7e99, (q31_t)0xa35cb5, (q31_t)0x8a3acb, (q31_t)0x7118dc, (q31_t)0x57f6e9, (q31_t)0x3ed4f2, (q31_t)0x25b2f8,
   (q31_t)0xc90fe
 };
+#endif
 
+#if defined(ARM_TABLE_DCT4_Q31_8192)
 static const q31_t cos_factorsQ31_8192[8192] = {
   (q31_t)0x7ffffff6, (q31_t)0x7fffffa7, (q31_t)0x7fffff09, (q31_t)0x7ffffe1c, (q31_t)0x7ffffce1, (q31_t)0x7ffffb56,
     (q31_t)0x7ffff97c, (q31_t)0x7ffff753,
@@ -7589,6 +7605,7 @@ static const q31_t cos_factorsQ31_8192[8192] = {
     (q31_t)0x356835,
   (q31_t)0x2f1fb6, (q31_t)0x28d738, (q31_t)0x228eb9, (q31_t)0x1c463b, (q31_t)0x15fdbc, (q31_t)0xfb53d, (q31_t)0x96cbe, (q31_t)0x3243f
 };
+#endif
 
 /**
  * @} end of DCT4_IDCT4_Table group
@@ -7625,17 +7642,6 @@ arm_status arm_dct4_init_q31(
   /*  Initialise the default arm status */
   arm_status status = ARM_MATH_SUCCESS;
 
-  /* Initializing the pointer array with the weight table base addresses of different lengths */
-  q31_t *twiddlePtr[4] = { (q31_t *) WeightsQ31_128, (q31_t *) WeightsQ31_512,
-    (q31_t *) WeightsQ31_2048, (q31_t *) WeightsQ31_8192
-  };
-
-  /* Initializing the pointer array with the cos factor table base addresses of different lengths */
-  q31_t *pCosFactor[4] =
-    { (q31_t *) cos_factorsQ31_128, (q31_t *) cos_factorsQ31_512,
-    (q31_t *) cos_factorsQ31_2048, (q31_t *) cos_factorsQ31_8192
-  };
-
   /* Initialize the DCT4 length */
   S->N = N;
 
@@ -7654,22 +7660,30 @@ arm_status arm_dct4_init_q31(
   switch (N)
   {
     /* Initialize the table modifier values */
+#if defined(ARM_TABLE_DCT4_Q31_8192)
   case 8192U:
-    S->pTwiddle = twiddlePtr[3];
-    S->pCosFactor = pCosFactor[3];
+    S->pTwiddle = (q31_t *) WeightsQ31_8192;
+    S->pCosFactor = (q31_t *) cos_factorsQ31_8192;
     break;
+#endif
+#if defined(ARM_TABLE_DCT4_Q31_2048)
   case 2048U:
-    S->pTwiddle = twiddlePtr[2];
-    S->pCosFactor = pCosFactor[2];
+    S->pTwiddle = (q31_t *) WeightsQ31_2048;
+    S->pCosFactor = (q31_t *) cos_factorsQ31_2048;
     break;
+#endif
+#if defined(ARM_TABLE_DCT4_Q31_512)
   case 512U:
-    S->pTwiddle = twiddlePtr[1];
-    S->pCosFactor = pCosFactor[1];
+    S->pTwiddle = (q31_t *) WeightsQ31_512;
+    S->pCosFactor = (q31_t *) cos_factorsQ31_512;
     break;
+#endif
+#if defined(ARM_TABLE_DCT4_Q31_128)
   case 128U:
-    S->pTwiddle = twiddlePtr[0];
-    S->pCosFactor = pCosFactor[0];
+    S->pTwiddle = (q31_t *) WeightsQ31_128;
+    S->pCosFactor = (q31_t *) cos_factorsQ31_128;
     break;
+#endif
   default:
     status = ARM_MATH_ARGUMENT_ERROR;
   }
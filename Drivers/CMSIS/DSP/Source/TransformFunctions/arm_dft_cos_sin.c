@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dft_cos_sin.c
+ * Description:  Twiddle factors of the DFT computed in double precision
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/*
+ * cos(2*pi*k/n) and sin(2*pi*k/n), in double precision: the angle is reduced
+ * exactly to [0, pi/4] with integers, its sine and cosine being given by the
+ * Taylor series. No library call. Used by the initialization functions of the
+ * mixed-radix FFTs, of the Goertzel filter bank and of the sliding DFT.
+ */
+void arm_dft_cos_sin(
+  uint32_t k,
+  uint32_t n,
+  double * pCos,
+  double * pSin)
+{
+  double phi, phi2, c, s, term, t;
+  uint32_t q, r, i;
+
+  /* 2*pi*k/n = q*pi/2 + (pi/2)*r/n, 0 <= r < n */
+  q = (4U * k) / n;
+  r = (4U * k) - q * n;
+
+  /* phi in [0, pi/4], the complement of the angle when above pi/4 */
+  phi = 1.570796326794896619231 * (double) ((2U * r <= n) ? r : n - r) / (double) n;
+  phi2 = phi * phi;
+
+  c = 1.0;
+  s = 1.0;
+  term = 1.0;
+  for (i = 1U; i < 10U; i++)
+  {
+    term = -term * phi2 / (double) ((2U * i - 1U) * (2U * i));
+    c += term;
+    s += term / (double) (2U * i + 1U);
+  }
+  s *= phi;
+
+  if (2U * r > n)
+  {
+    t = c;
+    c = s;
+    s = t;
+  }
+
+  /* Rotation by q quarters of turn */
+  switch (q & 3U)
+  {
+  case 0U: *pCos =  c; *pSin =  s; break;
+  case 1U: *pCos = -s; *pSin =  c; break;
+  case 2U: *pCos = -c; *pSin = -s; break;
+  default: *pCos =  s; *pSin = -c; break;
+  }
+}
@@ -0,0 +1,211 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_f32.c
+ * Description:  Floating-point Goertzel filter bank
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup Goertzel Goertzel Filter Bank
+ *
+ * The Goertzel algorithm computes one bin of the DFT of a block of <code>N</code>
+ * samples with a second order recursive filter per bin:
+ * <pre>
+ *    s[n] = x[n] + 2*cos(2*pi*k/N)*s[n-1] - s[n-2]
+ *    X(k) = exp(j*2*pi*k/N)*s[N-1] - s[N-2]
+ * </pre>
+ * <code>X(k)</code> being <code>sum(x[n]*exp(-j*2*pi*k*n/N))</code>, the bin
+ * <code>k</code> of the <code>N</code> points DFT of the block. A bank of Goertzel filters
+ * detects a few tones, DTMF digits or mains harmonics for instance, for a fraction of the
+ * cost of the FFT: one multiply per sample and per bin, against about
+ * <code>2*log2(N)</code> multiplies per sample for the complex FFT of the same block. It is
+ * the faster of the two below about <code>log2(N)</code> bins. The block length is not
+ * restricted to the FFT lengths: DTMF detection at 8 kHz uses the bins 18, 20, 22, 24, 31,
+ * 34, 38 and 42 of 205 samples blocks.
+ *
+ * \par Streaming
+ * The functions take blocks of any size: the samples are accumulated in the filter states
+ * and the <code>numBins</code> complex values <code>X(k)</code>, real and imaginary parts
+ * interleaved, are output each time <code>N</code> samples have been processed, the
+ * states being then cleared for the next block. A block of <code>blockSize</code> samples
+ * outputs <code>blockSize/N + 1</code> sets of bins at most. Calling the function sample
+ * per sample gives the same result as calling it once on the whole block.
+ *
+ * \par Floating-point behavior
+ * <code>2*cos(w)</code>, <code>w = 2*pi*k/N</code>, rounded to single precision moves the
+ * resonance of the filter by up to <code>2^-24/sin(w)</code> radians, and the rounding
+ * errors of the recurrence are amplified by <code>1/sin(w)</code>: the low and high bins of
+ * long blocks lose much of their accuracy. arm_goertzel_f32() uses Reinsch's form of the
+ * recurrence instead, which keeps <code>s[n]</code> and the difference
+ * <code>d[n] = s[n] -/+ s[n-1]</code>:
+ * <pre>
+ *    cos(w) >= 0: lambda = -4*sin(w/2)^2, d[n] = lambda*s[n-1] + d[n-1] + x[n], s[n] = s[n-1] + d[n]
+ *    cos(w) <  0: lambda =  4*cos(w/2)^2, d[n] = lambda*s[n-1] - d[n-1] + x[n], s[n] = d[n] - s[n-1]
+ * </pre>
+ * for one more addition per sample. <code>lambda</code> is exact for the bins 0 and
+ * <code>N/2</code> and keeps its relative accuracy near them.
+ *
+ * \par Fixed-point behavior
+ * The Q15 and Q31 functions output <code>X(k)/N</code>, as the fixed-point FFTs scale their
+ * output down. Both use Q31 coefficients: a Q15 <code>cos(w)</code> would move the bins by
+ * up to <code>2^-16/sin(w)</code> radians. The state of the Q31 filters is kept in Q63 and
+ * cannot overflow. The state of the Q15 filters is kept in Q31, with 16 guard bits. It is
+ * bounded by <code>N/|sin(w)|</code>, and by <code>N*(N+1)/2</code> for the bins 0 and
+ * <code>N/2</code>, times the input full scale: the bound must stay below 65536. A block of
+ * up to 361 samples meets it for any bin.
+ *
+ * \par Instance Structure
+ * The block length, the coefficients of the bins, <code>cos(2*pi*k/N)</code> and
+ * <code>sin(2*pi*k/N)</code> (<code>lambda</code> and <code>sin(2*pi*k/N)</code> in
+ * floating-point), and the filter states are stored in an instance data structure. The
+ * coefficient and state buffers, of <code>2*numBins</code> values each, are given by the
+ * application.
+ *
+ * \par Initialization Functions
+ * arm_goertzel_init_f32(), arm_goertzel_init_q31() and arm_goertzel_init_q15() compute the
+ * coefficients of the bins, in double precision, and clear the states.
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point Goertzel filter bank.
+ * @param[in,out] *S         points to an instance of the floating-point Goertzel structure.
+ * @param[in]     *pSrc      points to the block of input samples.
+ * @param[out]    *pDst      points to the block of output values, <code>2*numBins</code> values
+ *                           per detection block: <code>blockSize/blockLen + 1</code> sets at most.
+ * @param[in]     blockSize  number of input samples to process, any value.
+ * @return        number of sets of bins output.
+ */
+
+uint32_t arm_goertzel_f32(
+  arm_goertzel_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  const float32_t *pCoeffs;                      /* Coefficients of the bin */
+  float32_t *pState;                             /* State of the bin */
+  float32_t *pIn;                                /* Input pointer */
+  float32_t lambda, s1, d;                       /* Coefficient, s[n-1], difference term */
+  uint32_t numBins = S->numBins;                 /* Number of bins */
+  uint32_t blockLen = S->blockLen;               /* Length of the detection blocks */
+  uint32_t sampleCount = S->sampleCount;         /* Samples of the current block */
+  uint32_t numOutputs = 0U;                      /* Number of sets of bins output */
+  uint32_t n, bin, i;                            /* Samples processed, loop counters */
+
+  while (blockSize > 0U)
+  {
+    /* Input samples up to the end of the detection block */
+    n = blockLen - sampleCount;
+    if (n > blockSize)
+    {
+      n = blockSize;
+    }
+
+    pCoeffs = S->pCoeffs;
+    pState = S->pState;
+
+    for (bin = 0U; bin < numBins; bin++)
+    {
+      lambda = pCoeffs[0];
+      s1 = pState[0];
+      d = pState[1];
+      pIn = pSrc;
+      i = n;
+
+      if (lambda <= 0.0f)
+      {
+        /* cos(w) >= 0: d[n] = d[n-1] + lambda*s[n-1] + x[n], s[n] = s[n-1] + d[n] */
+        while (i > 0U)
+        {
+          d += lambda * s1 + *pIn++;
+          s1 += d;
+          i--;
+        }
+      }
+      else
+      {
+        /* cos(w) < 0: d[n] = -d[n-1] + lambda*s[n-1] + x[n], s[n] = d[n] - s[n-1] */
+        while (i > 0U)
+        {
+          d = lambda * s1 - d + *pIn++;
+          s1 = d - s1;
+          i--;
+        }
+      }
+
+      pState[0] = s1;
+      pState[1] = d;
+      pCoeffs += 2U;
+      pState += 2U;
+    }
+
+    pSrc += n;
+    blockSize -= n;
+    sampleCount += n;
+
+    if (sampleCount == blockLen)
+    {
+      sampleCount = 0U;
+
+      pCoeffs = S->pCoeffs;
+      pState = S->pState;
+
+      /* X(k) = exp(j*2*pi*k/N)*s[N-1] - s[N-2] = lambda/2*s[N-1] +/- d[N-1] + j*sin(w)*s[N-1] */
+      for (bin = 0U; bin < numBins; bin++)
+      {
+        lambda = pCoeffs[0];
+        s1 = pState[0];
+        d = pState[1];
+        *pDst++ = 0.5f * lambda * s1 + ((lambda <= 0.0f) ? d : -d);
+        *pDst++ = pCoeffs[1] * s1;
+
+        pState[0] = 0.0f;
+        pState[1] = 0.0f;
+        pCoeffs += 2U;
+        pState += 2U;
+      }
+
+      numOutputs++;
+    }
+  }
+
+  S->sampleCount = (uint16_t) sampleCount;
+
+  return (numOutputs);
+}
+
+/**
+ * @} end of Goertzel group
+ */
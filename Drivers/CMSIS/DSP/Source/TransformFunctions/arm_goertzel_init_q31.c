@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_init_q31.c
+ * Description:  Initialization function of the Q31 Goertzel filter bank
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern void arm_dft_cos_sin(
+  uint32_t k,
+  uint32_t n,
+  double * pCos,
+  double * pSin);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 Goertzel filter bank.
+ * @param[in,out] *S         points to an instance of the Q31 Goertzel structure.
+ * @param[in]     numBins    number of bins.
+ * @param[in]     blockLen   length N of the detection blocks, not zero.
+ * @param[in]     *pBins     points to the bins k, from 0 to <code>N-1</code>, array of length numBins.
+ * @param[in]     *pCoeffs   points to the coefficient buffer, of length <code>2*numBins</code>.
+ * @param[in]     *pState    points to the state buffer, of length <code>2*numBins</code>.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or
+ *                ARM_MATH_ARGUMENT_ERROR if <code>blockLen</code> is zero or a bin is not
+ *                below <code>blockLen</code>.
+ *
+ * \par
+ * The coefficients <code>cos(2*pi*k/N)</code>, <code>sin(2*pi*k/N)</code> of the bins are
+ * computed in double precision, rounded and saturated to Q31. The bin <code>k</code> is at the frequency
+ * <code>k*fs/N</code>, <code>fs</code> being the sampling rate. The buffers must stay
+ * allocated as long as the instance is used.
+ */
+
+arm_status arm_goertzel_init_q31(
+  arm_goertzel_instance_q31 * S,
+  uint16_t numBins,
+  uint16_t blockLen,
+  const uint16_t * pBins,
+  q31_t * pCoeffs,
+  q63_t * pState)
+{
+  double c, s;                                   /* cos(2*pi*k/N), sin(2*pi*k/N) */
+  uint32_t bin;                                  /* Loop counter */
+
+  if (blockLen == 0U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (bin = 0U; bin < numBins; bin++)
+  {
+    if (pBins[bin] >= blockLen)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    arm_dft_cos_sin(pBins[bin], blockLen, &c, &s);
+    pCoeffs[2U * bin] = clip_q63_to_q31((q63_t) (c * 2147483648.0 + ((c < 0.0) ? -0.5 : 0.5)));
+    pCoeffs[2U * bin + 1U] = clip_q63_to_q31((q63_t) (s * 2147483648.0 + ((s < 0.0) ? -0.5 : 0.5)));
+  }
+
+  S->numBins = numBins;
+  S->blockLen = blockLen;
+  S->sampleCount = 0U;
+  S->invBlockLen = (blockLen == 1U) ? 0x7FFFFFFF : (q31_t) ((0x80000000U + blockLen / 2U) / blockLen);
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  /* Clear the filter states */
+  memset(pState, 0, 2U * numBins * sizeof(q63_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,156 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_q15.c
+ * Description:  Q15 Goertzel filter bank
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 Goertzel filter bank.
+ * @param[in,out] *S         points to an instance of the Q15 Goertzel structure.
+ * @param[in]     *pSrc      points to the block of input samples.
+ * @param[out]    *pDst      points to the block of output values, <code>2*numBins</code> values
+ *                           per detection block: <code>blockSize/blockLen + 1</code> sets at most.
+ * @param[in]     blockSize  number of input samples to process, any value.
+ * @return        number of sets of bins output.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The coefficients are in 1.31 format. The filter states are kept in Q31 with 16 guard
+ * bits: the input full scale times <code>N/|sin(2*pi*k/N)|</code> must stay below 65536,
+ * which any bin meets for <code>N <= 361</code>. The outputs are <code>X(k)/N</code> in
+ * 1.15 format, saturated.
+ */
+
+uint32_t arm_goertzel_q15(
+  arm_goertzel_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  const q31_t *pCoeffs;                          /* Coefficients of the bin */
+  q31_t *pState;                                 /* State of the bin */
+  q15_t *pIn;                                    /* Input pointer */
+  q31_t coef, s1, s2, s0;                        /* cos(2*pi*k/N), s[n-1], s[n-2], s[n] */
+  q63_t re, im;                                  /* X(k) */
+  q31_t invBlockLen = S->invBlockLen;            /* 1/N, output scaling */
+  uint32_t numBins = S->numBins;                 /* Number of bins */
+  uint32_t blockLen = S->blockLen;               /* Length of the detection blocks */
+  uint32_t sampleCount = S->sampleCount;         /* Samples of the current block */
+  uint32_t numOutputs = 0U;                      /* Number of sets of bins output */
+  uint32_t n, bin, i;                            /* Samples processed, loop counters */
+
+  while (blockSize > 0U)
+  {
+    /* Input samples up to the end of the detection block */
+    n = blockLen - sampleCount;
+    if (n > blockSize)
+    {
+      n = blockSize;
+    }
+
+    pCoeffs = S->pCoeffs;
+    pState = S->pState;
+
+    for (bin = 0U; bin < numBins; bin++)
+    {
+      coef = pCoeffs[0];
+      s1 = pState[0];
+      s2 = pState[1];
+      pIn = pSrc;
+
+      /* Two samples per iteration, s[n-1] and s[n-2] exchanging their registers.
+         2*cos(2*pi*k/N)*s[n-1] is the 1.31 x 17.15 product shifted by 30 */
+      i = n >> 1U;
+      while (i > 0U)
+      {
+        s2 = pIn[0] + (q31_t) (((q63_t) coef * s1) >> 30) - s2;
+        s1 = pIn[1] + (q31_t) (((q63_t) coef * s2) >> 30) - s1;
+        pIn += 2U;
+        i--;
+      }
+
+      if ((n & 1U) != 0U)
+      {
+        s0 = pIn[0] + (q31_t) (((q63_t) coef * s1) >> 30) - s2;
+        s2 = s1;
+        s1 = s0;
+      }
+
+      pState[0] = s1;
+      pState[1] = s2;
+      pCoeffs += 2U;
+      pState += 2U;
+    }
+
+    pSrc += n;
+    blockSize -= n;
+    sampleCount += n;
+
+    if (sampleCount == blockLen)
+    {
+      sampleCount = 0U;
+
+      pCoeffs = S->pCoeffs;
+      pState = S->pState;
+
+      /* X(k) = exp(j*2*pi*k/N)*s[N-1] - s[N-2], scaled by 1/N */
+      for (bin = 0U; bin < numBins; bin++)
+      {
+        s1 = pState[0];
+        s2 = pState[1];
+        re = (((q63_t) pCoeffs[0] * s1) >> 31) - s2;
+        im = ((q63_t) pCoeffs[1] * s1) >> 31;
+        *pDst++ = (q15_t) __SSAT((q31_t) ((re * invBlockLen) >> 31), 16);
+        *pDst++ = (q15_t) __SSAT((q31_t) ((im * invBlockLen) >> 31), 16);
+
+        pState[0] = 0;
+        pState[1] = 0;
+        pCoeffs += 2U;
+        pState += 2U;
+      }
+
+      numOutputs++;
+    }
+  }
+
+  S->sampleCount = (uint16_t) sampleCount;
+
+  return (numOutputs);
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,163 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_q31.c
+ * Description:  Q31 Goertzel filter bank
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/* (a * b) >> 31 of a Q63 value and a Q31 value: the upper and lower words of
+   a are multiplied separately, the 95-bit product not fitting in 64 bits */
+static __INLINE q63_t arm_goertzel_mult_q31(
+  q63_t a,
+  q31_t b)
+{
+  return (((q63_t) ((q31_t) (a >> 32)) * b) * 2) + (((q63_t) ((uint32_t) a) * b) >> 31);
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 Goertzel filter bank.
+ * @param[in,out] *S         points to an instance of the Q31 Goertzel structure.
+ * @param[in]     *pSrc      points to the block of input samples.
+ * @param[out]    *pDst      points to the block of output values, <code>2*numBins</code> values
+ *                           per detection block: <code>blockSize/blockLen + 1</code> sets at most.
+ * @param[in]     blockSize  number of input samples to process, any value.
+ * @return        number of sets of bins output.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The filter states are kept in Q63 with 32 guard bits and cannot overflow. The outputs
+ * are <code>X(k)/N</code> in 1.31 format, saturated.
+ */
+
+uint32_t arm_goertzel_q31(
+  arm_goertzel_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  const q31_t *pCoeffs;                          /* Coefficients of the bin */
+  q63_t *pState;                                 /* State of the bin */
+  q31_t *pIn;                                    /* Input pointer */
+  q31_t coef;                                    /* cos(2*pi*k/N) */
+  q63_t s1, s2, s0;                              /* s[n-1], s[n-2], s[n] */
+  q63_t re, im;                                  /* X(k) */
+  q31_t invBlockLen = S->invBlockLen;            /* 1/N, output scaling */
+  uint32_t numBins = S->numBins;                 /* Number of bins */
+  uint32_t blockLen = S->blockLen;               /* Length of the detection blocks */
+  uint32_t sampleCount = S->sampleCount;         /* Samples of the current block */
+  uint32_t numOutputs = 0U;                      /* Number of sets of bins output */
+  uint32_t n, bin, i;                            /* Samples processed, loop counters */
+
+  while (blockSize > 0U)
+  {
+    /* Input samples up to the end of the detection block */
+    n = blockLen - sampleCount;
+    if (n > blockSize)
+    {
+      n = blockSize;
+    }
+
+    pCoeffs = S->pCoeffs;
+    pState = S->pState;
+
+    for (bin = 0U; bin < numBins; bin++)
+    {
+      coef = pCoeffs[0];
+      s1 = pState[0];
+      s2 = pState[1];
+      pIn = pSrc;
+
+      /* Two samples per iteration, s[n-1] and s[n-2] exchanging their registers */
+      i = n >> 1U;
+      while (i > 0U)
+      {
+        s2 = pIn[0] + 2 * arm_goertzel_mult_q31(s1, coef) - s2;
+        s1 = pIn[1] + 2 * arm_goertzel_mult_q31(s2, coef) - s1;
+        pIn += 2U;
+        i--;
+      }
+
+      if ((n & 1U) != 0U)
+      {
+        s0 = pIn[0] + 2 * arm_goertzel_mult_q31(s1, coef) - s2;
+        s2 = s1;
+        s1 = s0;
+      }
+
+      pState[0] = s1;
+      pState[1] = s2;
+      pCoeffs += 2U;
+      pState += 2U;
+    }
+
+    pSrc += n;
+    blockSize -= n;
+    sampleCount += n;
+
+    if (sampleCount == blockLen)
+    {
+      sampleCount = 0U;
+
+      pCoeffs = S->pCoeffs;
+      pState = S->pState;
+
+      /* X(k) = exp(j*2*pi*k/N)*s[N-1] - s[N-2], scaled by 1/N */
+      for (bin = 0U; bin < numBins; bin++)
+      {
+        s1 = pState[0];
+        s2 = pState[1];
+        re = arm_goertzel_mult_q31(s1, pCoeffs[0]) - s2;
+        im = arm_goertzel_mult_q31(s1, pCoeffs[1]);
+        *pDst++ = clip_q63_to_q31(arm_goertzel_mult_q31(re, invBlockLen));
+        *pDst++ = clip_q63_to_q31(arm_goertzel_mult_q31(im, invBlockLen));
+
+        pState[0] = 0;
+        pState[1] = 0;
+        pCoeffs += 2U;
+        pState += 2U;
+      }
+
+      numOutputs++;
+    }
+  }
+
+  S->sampleCount = (uint16_t) sampleCount;
+
+  return (numOutputs);
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,101 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_istft_f32.c
+ * Description:  Floating-point overlap-add inverse Short-Time Fourier Transform
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup STFT
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point overlap-add inverse STFT.
+ * @param[in,out] *S          points to an instance of the floating-point inverse STFT structure.
+ * @param[in]     *pSrc       points to the input frames, packed spectra of <code>fftLen</code> values
+ *                            as output by arm_stft_f32() with ARM_STFT_SPECTRUM. Not modified.
+ * @param[out]    *pDst       points to the block of <code>numFrames*hopSize</code> output samples.
+ * @param[in]     numFrames   number of frames to process.
+ * @return none.
+ */
+
+void arm_istft_f32(
+  arm_istft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numFrames)
+{
+  float32_t *pWindow = S->pState;                /* Synthesis window */
+  float32_t *pRing = pWindow + S->fftLen;        /* Overlap-add ring */
+  float32_t *pFrame = pRing + S->fftLen;         /* Inverse transform of the frame */
+  uint32_t fftLen = S->fftLen;                   /* Length of the frames */
+  uint32_t hopSize = S->hopSize;                 /* Output samples per frame */
+  uint32_t stateIndex = S->stateIndex;           /* Oldest sample of the ring */
+  uint32_t first;                                /* Samples before the end of the ring */
+
+  while (numFrames > 0U)
+  {
+    /* Windowed inverse transform: the inverse real FFT does not modify its input */
+    arm_rfft_fast_f32(&(S->Srfft), pSrc, pFrame, 1U);
+    arm_mult_f32(pFrame, pWindow, pFrame, fftLen);
+
+    /* Overlap-add from the oldest sample of the ring */
+    first = fftLen - stateIndex;
+    arm_add_f32(pRing + stateIndex, pFrame, pRing + stateIndex, first);
+    arm_add_f32(pRing, pFrame + first, pRing, stateIndex);
+
+    /* The hopSize oldest samples have all their frames: output and clear them */
+    if (hopSize < first)
+    {
+      memcpy(pDst, pRing + stateIndex, hopSize * sizeof(float32_t));
+      memset(pRing + stateIndex, 0, hopSize * sizeof(float32_t));
+      stateIndex += hopSize;
+    }
+    else
+    {
+      memcpy(pDst, pRing + stateIndex, first * sizeof(float32_t));
+      memset(pRing + stateIndex, 0, first * sizeof(float32_t));
+      memcpy(pDst + first, pRing, (hopSize - first) * sizeof(float32_t));
+      memset(pRing, 0, (hopSize - first) * sizeof(float32_t));
+      stateIndex = hopSize - first;
+    }
+
+    pSrc += fftLen;
+    pDst += hopSize;
+    numFrames--;
+  }
+
+  S->stateIndex = (uint16_t) stateIndex;
+}
+
+/**
+ * @} end of STFT group
+ */
@@ -0,0 +1,114 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_istft_init_f32.c
+ * Description:  Initialization function of the floating-point inverse STFT
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup STFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point overlap-add inverse STFT.
+ * @param[in,out] *S          points to an instance of the floating-point inverse STFT structure.
+ * @param[in]     fftLen      length of the frames: 32, 64, 128, 256, 512, 1024, 2048 or 4096.
+ * @param[in]     hopSize     number of output samples per frame, from 1 to <code>fftLen</code>.
+ * @param[in]     *pWindow    points to the analysis window of <code>fftLen</code> values.
+ * @param[in]     *pState     points to the state buffer of <code>3*fftLen</code> values.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or
+ *                ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> or <code>hopSize</code> is not
+ *                supported, or if the frames of the window do not overlap at some sample
+ *                (e.g. a Hann window, zero at its ends, with <code>hopSize = fftLen</code>).
+ *
+ * \par
+ * The synthesis window is computed in the first <code>fftLen</code> values of the state
+ * buffer: the analysis window is not used after initialization. The overlap-add ring
+ * is cleared.
+ */
+
+arm_status arm_istft_init_f32(
+  arm_istft_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  const float32_t * pWindow,
+  float32_t * pState)
+{
+  float32_t sum;                                 /* Sum of the squared overlapping window values */
+  arm_status status;
+  uint32_t n, m;                                 /* Loop counters */
+
+  if ((hopSize == 0U) || (hopSize > fftLen))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  status = arm_rfft_fast_init_f32(&(S->Srfft), fftLen);
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    /* w[n] / sum(w[m]^2), m = n mod hopSize, n mod hopSize + hopSize, ... below fftLen:
+       the sum is the same for all the n of a residue */
+    for (n = 0U; n < hopSize; n++)
+    {
+      sum = 0.0f;
+      for (m = n; m < fftLen; m += hopSize)
+      {
+        sum += pWindow[m] * pWindow[m];
+      }
+
+      if (sum == 0.0f)
+      {
+        return (ARM_MATH_ARGUMENT_ERROR);
+      }
+
+      sum = 1.0f / sum;
+      for (m = n; m < fftLen; m += hopSize)
+      {
+        pState[m] = pWindow[m] * sum;
+      }
+    }
+
+    S->fftLen = fftLen;
+    S->hopSize = hopSize;
+    S->stateIndex = 0U;
+    S->pState = pState;
+
+    /* Clear the overlap-add ring */
+    memset(pState + fftLen, 0, fftLen * sizeof(float32_t));
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of STFT group
+ */
@@ -236,6 +236,12 @@ float32_t * p, float32_t * pOut)
  * The real algorithms are defined in a similar manner and utilize N/2 complex
  * transforms behind the scenes.
  * \par
+ * arm_rfft_fast_q15() and arm_rfft_fast_q31(), initialized by arm_rfft_fast_init_q15()
+ * and arm_rfft_fast_init_q31(), use the packed layout of arm_rfft_fast_f32() and
+ * the twiddle factor tables of arm_cfft_q15() and arm_cfft_q31(). arm_rfft_q15() and
+ * arm_rfft_q31() output the whole spectrum, fftLen complex values, and use two
+ * split tables of 8192 values.
+ * \par
  * The complex transforms used internally include scaling to prevent fixed-point
  * overflows.  The overall scaling equals 1/(fftLen/2).
  * \par
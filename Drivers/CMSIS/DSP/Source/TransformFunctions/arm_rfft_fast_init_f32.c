@@ -65,6 +65,7 @@ arm_status arm_rfft_fast_init_f32(
   /*  Initializations of structure parameters depending on the FFT length */
   switch (Sint->fftLen)
   {
+#if defined(ARM_TABLE_BITREVIDX_FLT_2048) && defined(ARM_TABLE_TWIDDLECOEF_F32_2048) && defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_4096)
   case 2048U:
     /*  Initializations of structure parameters for 2048 point FFT */
     /*  Initialise the bit reversal table length */
@@ -75,48 +76,63 @@ arm_status arm_rfft_fast_init_f32(
 		Sint->pTwiddle     = (float32_t *) twiddleCoef_2048;
 		S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_4096;
     break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_1024) && defined(ARM_TABLE_TWIDDLECOEF_F32_1024) && defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_2048)
   case 1024U:
     Sint->bitRevLength = ARMBITREVINDEXTABLE_1024_TABLE_LENGTH;
     Sint->pBitRevTable = (uint16_t *)armBitRevIndexTable1024;
 		Sint->pTwiddle     = (float32_t *) twiddleCoef_1024;
 		S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_2048;
     break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_512) && defined(ARM_TABLE_TWIDDLECOEF_F32_512) && defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_1024)
   case 512U:
     Sint->bitRevLength = ARMBITREVINDEXTABLE_512_TABLE_LENGTH;
     Sint->pBitRevTable = (uint16_t *)armBitRevIndexTable512;
 		Sint->pTwiddle     = (float32_t *) twiddleCoef_512;
 		S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_1024;
     break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_256) && defined(ARM_TABLE_TWIDDLECOEF_F32_256) && defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_512)
   case 256U:
     Sint->bitRevLength = ARMBITREVINDEXTABLE_256_TABLE_LENGTH;
     Sint->pBitRevTable = (uint16_t *)armBitRevIndexTable256;
 		Sint->pTwiddle     = (float32_t *) twiddleCoef_256;
 		S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_512;
     break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_128) && defined(ARM_TABLE_TWIDDLECOEF_F32_128) && defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_256)
   case 128U:
     Sint->bitRevLength = ARMBITREVINDEXTABLE_128_TABLE_LENGTH;
     Sint->pBitRevTable = (uint16_t *)armBitRevIndexTable128;
 		Sint->pTwiddle     = (float32_t *) twiddleCoef_128;
 		S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_256;
     break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_64) && defined(ARM_TABLE_TWIDDLECOEF_F32_64) && defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_128)
   case 64U:
     Sint->bitRevLength = ARMBITREVINDEXTABLE_64_TABLE_LENGTH;
     Sint->pBitRevTable = (uint16_t *)armBitRevIndexTable64;
 		Sint->pTwiddle     = (float32_t *) twiddleCoef_64;
 		S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_128;
     break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_32) && defined(ARM_TABLE_TWIDDLECOEF_F32_32) && defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_64)
   case 32U:
     Sint->bitRevLength = ARMBITREVINDEXTABLE_32_TABLE_LENGTH;
     Sint->pBitRevTable = (uint16_t *)armBitRevIndexTable32;
 		Sint->pTwiddle     = (float32_t *) twiddleCoef_32;
 		S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_64;
     break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_16) && defined(ARM_TABLE_TWIDDLECOEF_F32_16) && defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_32)
   case 16U:
     Sint->bitRevLength = ARMBITREVINDEXTABLE_16_TABLE_LENGTH;
     Sint->pBitRevTable = (uint16_t *)armBitRevIndexTable16;
 		Sint->pTwiddle     = (float32_t *) twiddleCoef_16;
 		S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_32;
     break;
+#endif
   default:
     /*  Reporting argument error if fftSize is not valid value */
     status = ARM_MATH_ARGUMENT_ERROR;
@@ -0,0 +1,129 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_fast_init_q15.c
+ * Description:  Fast real FFT Q15 initialization function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+#include "arm_const_structs.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup RealFFT
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the Q15 fast real FFT.
+* @param[in,out] *S             points to an arm_rfft_fast_instance_q15 structure.
+* @param[in]     fftLen         length of the Real Sequence.
+* @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.
+*
+* \par Description:
+* \par
+* The parameter <code>fftLen</code> Specifies length of RFFT/RIFFT process. Supported FFT Lengths are 32, 64, 128, 256, 512, 1024, 2048, 4096.
+* \par
+* This Function initializes the pointer to the fftLen/2 points complex FFT instance and
+* the split stage twiddle factor pointer. The split stage uses the twiddle factor table of
+* the fftLen points complex FFT: no table is added to the ones of arm_cfft_q15().
+*/
+
+arm_status arm_rfft_fast_init_q15(
+  arm_rfft_fast_instance_q15 * S,
+  uint16_t fftLen)
+{
+  /*  Initialise the default arm status */
+  arm_status status = ARM_MATH_SUCCESS;
+
+  /*  Initialise the FFT length */
+  S->fftLenRFFT = fftLen;
+
+  /*  Initializations of structure parameters depending on the FFT length */
+  switch (fftLen)
+  {
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_2048) && defined(ARM_TABLE_BITREVIDX_FXT_2048) && defined(ARM_TABLE_TWIDDLECOEF_Q15_4096)
+  case 4096U:
+    S->pCfft        = &arm_cfft_sR_q15_len2048;
+    S->pTwiddleRFFT = twiddleCoef_4096_q15;
+    break;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_1024) && defined(ARM_TABLE_BITREVIDX_FXT_1024) && defined(ARM_TABLE_TWIDDLECOEF_Q15_2048)
+  case 2048U:
+    S->pCfft        = &arm_cfft_sR_q15_len1024;
+    S->pTwiddleRFFT = twiddleCoef_2048_q15;
+    break;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_512) && defined(ARM_TABLE_BITREVIDX_FXT_512) && defined(ARM_TABLE_TWIDDLECOEF_Q15_1024)
+  case 1024U:
+    S->pCfft        = &arm_cfft_sR_q15_len512;
+    S->pTwiddleRFFT = twiddleCoef_1024_q15;
+    break;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_256) && defined(ARM_TABLE_BITREVIDX_FXT_256) && defined(ARM_TABLE_TWIDDLECOEF_Q15_512)
+  case 512U:
+    S->pCfft        = &arm_cfft_sR_q15_len256;
+    S->pTwiddleRFFT = twiddleCoef_512_q15;
+    break;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_128) && defined(ARM_TABLE_BITREVIDX_FXT_128) && defined(ARM_TABLE_TWIDDLECOEF_Q15_256)
+  case 256U:
+    S->pCfft        = &arm_cfft_sR_q15_len128;
+    S->pTwiddleRFFT = twiddleCoef_256_q15;
+    break;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_64) && defined(ARM_TABLE_BITREVIDX_FXT_64) && defined(ARM_TABLE_TWIDDLECOEF_Q15_128)
+  case 128U:
+    S->pCfft        = &arm_cfft_sR_q15_len64;
+    S->pTwiddleRFFT = twiddleCoef_128_q15;
+    break;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_32) && defined(ARM_TABLE_BITREVIDX_FXT_32) && defined(ARM_TABLE_TWIDDLECOEF_Q15_64)
+  case 64U:
+    S->pCfft        = &arm_cfft_sR_q15_len32;
+    S->pTwiddleRFFT = twiddleCoef_64_q15;
+    break;
+#endif
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_16) && defined(ARM_TABLE_BITREVIDX_FXT_16) && defined(ARM_TABLE_TWIDDLECOEF_Q15_32)
+  case 32U:
+    S->pCfft        = &arm_cfft_sR_q15_len16;
+    S->pTwiddleRFFT = twiddleCoef_32_q15;
+    break;
+#endif
+  default:
+    /*  Reporting argument error if fftSize is not valid value */
+    status = ARM_MATH_ARGUMENT_ERROR;
+    break;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of RealFFT group
+ */
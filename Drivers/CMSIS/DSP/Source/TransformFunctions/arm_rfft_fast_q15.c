@@ -0,0 +1,276 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_fast_q15.c
+ * Description:  Fast real FFT & RIFFT Q15 process function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/* ----------------------------------------------------------------------
+ * Internal functions
+ * -------------------------------------------------------------------- */
+
+/*
+ * With Z the fftLen/2 points complex FFT of x[2n] + j x[2n+1], scaled by
+ * 2/fftLen by arm_cfft_q15(), and W = exp(-2 pi j / fftLen):
+ *   X(k) = (Z(k) + conj(Z(N/2-k))) / 2 - j W^k (Z(k) - conj(Z(N/2-k))) / 2
+ * The bins k and N/2-k are computed together from the same two inputs, so
+ * that the stage can run in place. s and d are the half sums and differences
+ * of Z(k) and conj(Z(N/2-k)), tw is (cos, sin) of 2 pi k / fftLen.
+ */
+static void stage_rfft_q15(
+  const arm_rfft_fast_instance_q15 * S,
+  const q15_t * p,
+  q15_t * pOut)
+{
+  uint32_t k;                                    /* Loop counter */
+  uint32_t fftLenBy2 = S->fftLenRFFT >> 1U;      /* Length of the complex FFT */
+  const q15_t *pCoef = S->pTwiddleRFFT + 2;      /* Twiddle factors, from k = 1 */
+  const q15_t *pA = p + 2;                       /* Increasing input pointer */
+  const q15_t *pB = p + (2U * (fftLenBy2 - 1U)); /* Decreasing input pointer */
+  q15_t *pOutA = pOut + 2;                       /* Increasing output pointer */
+  q15_t *pOutB = pOut + (2U * (fftLenBy2 - 1U)); /* Decreasing output pointer */
+  q31_t sR, sI;                                  /* Half sum */
+  q31_t t1, t2;                                  /* Twiddle products */
+  q31_t xR, xI;                                  /* Bin 0 */
+#if defined (ARM_MATH_DSP)
+  q31_t a, b, s, d, tw;                          /* Packed complex values */
+#else
+  q31_t dR, dI;                                  /* Half difference */
+  q31_t twR, twI;                                /* Twiddle factor */
+#endif
+
+  /* Bins 0 and N/2 are real: they are packed in the first complex value */
+  xR = p[0];
+  xI = p[1];
+  pOut[0] = (q15_t) ((xR + xI) >> 1);
+  pOut[1] = (q15_t) ((xR - xI) >> 1);
+
+  /* Pairs (k, N/2-k) for k = 1 to N/4, bin N/4 being computed twice */
+  k = fftLenBy2 >> 1U;
+
+  while (k > 0U)
+  {
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+    a  = *__SIMD32(pA);
+    b  = (q31_t) __ROR((uint32_t) *__SIMD32(pB), 16U);
+    tw = *__SIMD32(pCoef);
+
+    /* s = (Z(k) + conj(Z(N/2-k))) / 2, d = (Z(k) - conj(Z(N/2-k))) / 2 */
+    s = (q31_t) __SHSAX((uint32_t) a, (uint32_t) b);
+    d = (q31_t) __SHASX((uint32_t) a, (uint32_t) b);
+
+    /* -j W^k d = (cos * dI - sin * dR) + j (-cos * dR - sin * dI) */
+    t1 = (q31_t) __SMUSDX((uint32_t) tw, (uint32_t) d);
+    t2 = -(q31_t) __SMUAD((uint32_t) tw, (uint32_t) d);
+
+    sR = (q15_t) s;
+    sI = (q15_t) (s >> 16);
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+    twR = pCoef[0];
+    twI = pCoef[1];
+
+    /* s = (Z(k) + conj(Z(N/2-k))) / 2, d = (Z(k) - conj(Z(N/2-k))) / 2 */
+    sR = (pA[0] + pB[0]) >> 1;
+    sI = (pA[1] - pB[1]) >> 1;
+    dR = (pA[0] - pB[0]) >> 1;
+    dI = (pA[1] + pB[1]) >> 1;
+
+    /* -j W^k d = (cos * dI - sin * dR) + j (-cos * dR - sin * dI) */
+    t1 = (twR * dI) - (twI * dR);
+    t2 = -((twR * dR) + (twI * dI));
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    /* X(k) / N = (s - j W^k d) / 2, X(N/2-k) / N = (conj(s) + j conj(W^k d)) / 2 */
+    pOutA[0] = (q15_t) (((sR << 15) + t1) >> 16);
+    pOutA[1] = (q15_t) (((sI << 15) + t2) >> 16);
+    pOutB[0] = (q15_t) (((sR << 15) - t1) >> 16);
+    pOutB[1] = (q15_t) ((t2 - (sI << 15)) >> 16);
+
+    pA += 2;
+    pB -= 2;
+    pOutA += 2;
+    pOutB -= 2;
+    pCoef += 2;
+    k--;
+  }
+}
+
+/*
+ * Inverse of the above: Z(k) = (X(k) + conj(X(N/2-k))) / 2
+ *                            + j W^-k (X(k) - conj(X(N/2-k))) / 2
+ * computed as Z(k) / 2 so that it does not overflow, the scaling being
+ * restored after the complex inverse FFT.
+ */
+static void merge_rfft_q15(
+  const arm_rfft_fast_instance_q15 * S,
+  const q15_t * p,
+  q15_t * pOut)
+{
+  uint32_t k;                                    /* Loop counter */
+  uint32_t fftLenBy2 = S->fftLenRFFT >> 1U;      /* Length of the complex FFT */
+  const q15_t *pCoef = S->pTwiddleRFFT + 2;      /* Twiddle factors, from k = 1 */
+  const q15_t *pA = p + 2;                       /* Increasing input pointer */
+  const q15_t *pB = p + (2U * (fftLenBy2 - 1U)); /* Decreasing input pointer */
+  q15_t *pOutA = pOut + 2;                       /* Increasing output pointer */
+  q15_t *pOutB = pOut + (2U * (fftLenBy2 - 1U)); /* Decreasing output pointer */
+  q31_t sR, sI;                                  /* Half sum */
+  q31_t t1, t2;                                  /* Twiddle products */
+  q31_t xR, xI;                                  /* Bins 0 and N/2 */
+#if defined (ARM_MATH_DSP)
+  q31_t a, b, s, d, tw;                          /* Packed complex values */
+#else
+  q31_t dR, dI;                                  /* Half difference */
+  q31_t twR, twI;                                /* Twiddle factor */
+#endif
+
+  xR = p[0];
+  xI = p[1];
+  pOut[0] = (q15_t) ((xR + xI) >> 2);
+  pOut[1] = (q15_t) ((xR - xI) >> 2);
+
+  k = fftLenBy2 >> 1U;
+
+  while (k > 0U)
+  {
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+    a  = *__SIMD32(pA);
+    b  = (q31_t) __ROR((uint32_t) *__SIMD32(pB), 16U);
+    tw = *__SIMD32(pCoef);
+
+    s = (q31_t) __SHSAX((uint32_t) a, (uint32_t) b);
+    d = (q31_t) __SHASX((uint32_t) a, (uint32_t) b);
+
+    /* j W^-k d = (-sin * dR - cos * dI) + j (cos * dR - sin * dI) */
+    t1 = -(q31_t) __SMUADX((uint32_t) tw, (uint32_t) d);
+    t2 = (q31_t) __SMUSD((uint32_t) tw, (uint32_t) d);
+
+    sR = (q15_t) s;
+    sI = (q15_t) (s >> 16);
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+    twR = pCoef[0];
+    twI = pCoef[1];
+
+    sR = (pA[0] + pB[0]) >> 1;
+    sI = (pA[1] - pB[1]) >> 1;
+    dR = (pA[0] - pB[0]) >> 1;
+    dI = (pA[1] + pB[1]) >> 1;
+
+    /* j W^-k d = (-sin * dR - cos * dI) + j (cos * dR - sin * dI) */
+    t1 = -((twI * dR) + (twR * dI));
+    t2 = (twR * dR) - (twI * dI);
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    pOutA[0] = (q15_t) (((sR << 15) + t1) >> 16);
+    pOutA[1] = (q15_t) (((sI << 15) + t2) >> 16);
+    pOutB[0] = (q15_t) (((sR << 15) - t1) >> 16);
+    pOutB[1] = (q15_t) ((t2 - (sI << 15)) >> 16);
+
+    pA += 2;
+    pB -= 2;
+    pOutA += 2;
+    pOutB -= 2;
+    pCoef += 2;
+    k--;
+  }
+}
+
+/**
+* @addtogroup RealFFT
+* @{
+*/
+
+/**
+* @brief Processing function for the Q15 fast real FFT.
+* @param[in]  *S              points to an arm_rfft_fast_instance_q15 structure.
+* @param[in]  *p              points to the input buffer.
+* @param[out] *pOut           points to the output buffer.
+* @param[in]  ifftFlag        RFFT if flag is 0, RIFFT if flag is 1
+* @return none.
+*
+* \par
+* The spectrum has the packed layout of arm_rfft_fast_f32(): fftLen values,
+* X[0] and X[fftLen/2] (both real) first, then the real and imaginary parts
+* of X[1] to X[fftLen/2 - 1].
+* \par Scaling
+* The forward transform computes the DFT scaled by 1/fftLen, as arm_rfft_q15():
+* with a 1.15 input, the output format is (1 + log2(fftLen)).(15 - log2(fftLen)),
+* 6.10 for fftLen = 32 and 13.3 for fftLen = 4096. The input buffer is used
+* as work buffer and is overwritten.
+* \par
+* The inverse transform computes x[n] = 1/fftLen sum(X[k] exp(2 pi j k n / fftLen))
+* over the spectrum completed by symmetry, as arm_rfft_q15(). A forward transform
+* followed by an inverse one returns the input scaled by 1/fftLen. The output saturates and the input
+* buffer is not modified.
+* \par
+* pOut may be equal to p.
+*/
+
+void arm_rfft_fast_q15(
+  const arm_rfft_fast_instance_q15 * S,
+  q15_t * p,
+  q15_t * pOut,
+  uint8_t ifftFlag)
+{
+  uint32_t i;                                    /* Loop counter */
+
+  if (ifftFlag)
+  {
+    /* Half complex spectrum, scaled by 1/2 */
+    merge_rfft_q15(S, p, pOut);
+
+    /* Complex IFFT of fftLen/2 points */
+    arm_cfft_q15(S->pCfft, pOut, ifftFlag, 1U);
+
+    for (i = 0U; i < S->fftLenRFFT; i++)
+    {
+      pOut[i] = clip_q31_to_q15((q31_t) pOut[i] << 1);
+    }
+  }
+  else
+  {
+    /* Complex FFT of fftLen/2 points, in place */
+    arm_cfft_q15(S->pCfft, p, ifftFlag, 1U);
+
+    /* Real FFT extraction */
+    stage_rfft_q15(S, p, pOut);
+  }
+}
+
+/**
+* @} end of RealFFT group
+*/
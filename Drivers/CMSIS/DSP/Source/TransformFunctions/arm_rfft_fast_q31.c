@@ -0,0 +1,220 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_fast_q31.c
+ * Description:  Fast real FFT & RIFFT Q31 process function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/* ----------------------------------------------------------------------
+ * Internal functions
+ * -------------------------------------------------------------------- */
+
+/*
+ * Same split as stage_rfft_q15(): with Z the fftLen/2 points complex FFT
+ * of x[2n] + j x[2n+1], scaled by 2/fftLen, and W = exp(-2 pi j / fftLen),
+ *   X(k) = (Z(k) + conj(Z(N/2-k))) / 2 - j W^k (Z(k) - conj(Z(N/2-k))) / 2
+ * the bins k and N/2-k being computed together. The products keep the upper
+ * 32 bits of the 64 bits result, which halves them.
+ */
+static void stage_rfft_q31(
+  const arm_rfft_fast_instance_q31 * S,
+  const q31_t * p,
+  q31_t * pOut)
+{
+  uint32_t k;                                    /* Loop counter */
+  uint32_t fftLenBy2 = S->fftLenRFFT >> 1U;      /* Length of the complex FFT */
+  const q31_t *pCoef = S->pTwiddleRFFT + 2;      /* Twiddle factors, from k = 1 */
+  const q31_t *pA = p + 2;                       /* Increasing input pointer */
+  const q31_t *pB = p + (2U * (fftLenBy2 - 1U)); /* Decreasing input pointer */
+  q31_t *pOutA = pOut + 2;                       /* Increasing output pointer */
+  q31_t *pOutB = pOut + (2U * (fftLenBy2 - 1U)); /* Decreasing output pointer */
+  q31_t sR, sI, dR, dI;                          /* Half sums and differences */
+  q31_t twR, twI;                                /* Twiddle factor */
+  q31_t t1, t2;                                  /* Twiddle products */
+  q31_t xR, xI;                                  /* Bin 0 */
+
+  /* Bins 0 and N/2 are real: they are packed in the first complex value */
+  xR = p[0] >> 1;
+  xI = p[1] >> 1;
+  pOut[0] = xR + xI;
+  pOut[1] = xR - xI;
+
+  /* Pairs (k, N/2-k) for k = 1 to N/4, bin N/4 being computed twice */
+  k = fftLenBy2 >> 1U;
+
+  while (k > 0U)
+  {
+    twR = pCoef[0];
+    twI = pCoef[1];
+
+    /* s = (Z(k) + conj(Z(N/2-k))) / 2, d = (Z(k) - conj(Z(N/2-k))) / 2 */
+    sR = (pA[0] >> 1) + (pB[0] >> 1);
+    sI = (pA[1] >> 1) - (pB[1] >> 1);
+    dR = (pA[0] >> 1) - (pB[0] >> 1);
+    dI = (pA[1] >> 1) + (pB[1] >> 1);
+
+    /* -j W^k d / 2 = (cos * dI - sin * dR) / 2 + j (-cos * dR - sin * dI) / 2 */
+    t1 = (q31_t) ((((q63_t) twR * dI) - ((q63_t) twI * dR)) >> 32);
+    t2 = (q31_t) ((-((q63_t) twR * dR) - ((q63_t) twI * dI)) >> 32);
+
+    /* X(k) / N = (s - j W^k d) / 2, X(N/2-k) / N = (conj(s) + j conj(W^k d)) / 2 */
+    pOutA[0] = (sR >> 1) + t1;
+    pOutA[1] = (sI >> 1) + t2;
+    pOutB[0] = (sR >> 1) - t1;
+    pOutB[1] = t2 - (sI >> 1);
+
+    pA += 2;
+    pB -= 2;
+    pOutA += 2;
+    pOutB -= 2;
+    pCoef += 2;
+    k--;
+  }
+}
+
+/*
+ * Inverse of the above: Z(k) = (X(k) + conj(X(N/2-k))) / 2
+ *                            + j W^-k (X(k) - conj(X(N/2-k))) / 2
+ * computed as Z(k) / 2 so that it does not overflow, the scaling being
+ * restored after the complex inverse FFT.
+ */
+static void merge_rfft_q31(
+  const arm_rfft_fast_instance_q31 * S,
+  const q31_t * p,
+  q31_t * pOut)
+{
+  uint32_t k;                                    /* Loop counter */
+  uint32_t fftLenBy2 = S->fftLenRFFT >> 1U;      /* Length of the complex FFT */
+  const q31_t *pCoef = S->pTwiddleRFFT + 2;      /* Twiddle factors, from k = 1 */
+  const q31_t *pA = p + 2;                       /* Increasing input pointer */
+  const q31_t *pB = p + (2U * (fftLenBy2 - 1U)); /* Decreasing input pointer */
+  q31_t *pOutA = pOut + 2;                       /* Increasing output pointer */
+  q31_t *pOutB = pOut + (2U * (fftLenBy2 - 1U)); /* Decreasing output pointer */
+  q31_t sR, sI, dR, dI;                          /* Half sums and differences */
+  q31_t twR, twI;                                /* Twiddle factor */
+  q31_t t1, t2;                                  /* Twiddle products */
+  q31_t xR, xI;                                  /* Bins 0 and N/2 */
+
+  xR = p[0] >> 2;
+  xI = p[1] >> 2;
+  pOut[0] = xR + xI;
+  pOut[1] = xR - xI;
+
+  k = fftLenBy2 >> 1U;
+
+  while (k > 0U)
+  {
+    twR = pCoef[0];
+    twI = pCoef[1];
+
+    sR = (pA[0] >> 1) + (pB[0] >> 1);
+    sI = (pA[1] >> 1) - (pB[1] >> 1);
+    dR = (pA[0] >> 1) - (pB[0] >> 1);
+    dI = (pA[1] >> 1) + (pB[1] >> 1);
+
+    /* j W^-k d / 2 = (-sin * dR - cos * dI) / 2 + j (cos * dR - sin * dI) / 2 */
+    t1 = (q31_t) ((-((q63_t) twI * dR) - ((q63_t) twR * dI)) >> 32);
+    t2 = (q31_t) ((((q63_t) twR * dR) - ((q63_t) twI * dI)) >> 32);
+
+    pOutA[0] = (sR >> 1) + t1;
+    pOutA[1] = (sI >> 1) + t2;
+    pOutB[0] = (sR >> 1) - t1;
+    pOutB[1] = t2 - (sI >> 1);
+
+    pA += 2;
+    pB -= 2;
+    pOutA += 2;
+    pOutB -= 2;
+    pCoef += 2;
+    k--;
+  }
+}
+
+/**
+* @addtogroup RealFFT
+* @{
+*/
+
+/**
+* @brief Processing function for the Q31 fast real FFT.
+* @param[in]  *S              points to an arm_rfft_fast_instance_q31 structure.
+* @param[in]  *p              points to the input buffer.
+* @param[out] *pOut           points to the output buffer.
+* @param[in]  ifftFlag        RFFT if flag is 0, RIFFT if flag is 1
+* @return none.
+*
+* \par
+* The spectrum has the packed layout of arm_rfft_fast_f32(): fftLen values,
+* X[0] and X[fftLen/2] (both real) first, then the real and imaginary parts
+* of X[1] to X[fftLen/2 - 1].
+* \par Scaling
+* The forward transform computes the DFT scaled by 1/fftLen, as arm_rfft_q31():
+* with a 1.31 input, the output format is (1 + log2(fftLen)).(31 - log2(fftLen)),
+* 6.26 for fftLen = 32 and 13.19 for fftLen = 4096. The input buffer is used
+* as work buffer and is overwritten.
+* \par
+* The inverse transform computes x[n] = 1/fftLen sum(X[k] exp(2 pi j k n / fftLen))
+* over the spectrum completed by symmetry, as arm_rfft_q31(). A forward transform
+* followed by an inverse one returns the input scaled by 1/fftLen. The output
+* saturates and the input buffer is not modified.
+* \par
+* pOut may be equal to p.
+*/
+
+void arm_rfft_fast_q31(
+  const arm_rfft_fast_instance_q31 * S,
+  q31_t * p,
+  q31_t * pOut,
+  uint8_t ifftFlag)
+{
+  uint32_t i;                                    /* Loop counter */
+
+  if (ifftFlag)
+  {
+    /* Half complex spectrum, scaled by 1/2 */
+    merge_rfft_q31(S, p, pOut);
+
+    /* Complex IFFT of fftLen/2 points */
+    arm_cfft_q31(S->pCfft, pOut, ifftFlag, 1U);
+
+    for (i = 0U; i < S->fftLenRFFT; i++)
+    {
+      pOut[i] = clip_q63_to_q31((q63_t) pOut[i] << 1);
+    }
+  }
+  else
+  {
+    /* Complex FFT of fftLen/2 points, in place */
+    arm_cfft_q31(S->pCfft, p, ifftFlag, 1U);
+
+    /* Real FFT extraction */
+    stage_rfft_q31(S, p, pOut);
+  }
+}
+
+/**
+* @} end of RealFFT group
+*/
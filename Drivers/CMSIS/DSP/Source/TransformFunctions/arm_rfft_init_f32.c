@@ -27,6 +27,7 @@
  */
 
 #include "arm_math.h"
+#include "arm_common_tables.h"
 
 /**
  * @ingroup RealFFT
@@ -48,6 +49,7 @@
 *    pATable[2 * i + 1] = 0.5 * (-1.0 * cos (2 * PI / (double) (2 * n) * (double) i));
 *  } </pre>
 */
+#if defined(ARM_TABLE_REALCOEF_F32)
 static const float32_t realCoefA[8192] = {
   0.500000000000000f, -0.500000000000000f, 0.499616503715515f, -0.499999850988388f,
   0.499233007431030f, -0.499999403953552f, 0.498849511146545f, -0.499998688697815f,
@@ -2098,6 +2100,7 @@ static const float32_t realCoefA[8192] = {
   0.498466014862061f, 0.499997645616531f, 0.498849511146545f, 0.499998688697815f,
   0.499233007431030f, 0.499999403953552f, 0.499616503715515f, 0.499999850988388f,
 };
+#endif
 
 
 /**
@@ -2112,6 +2115,7 @@ static const float32_t realCoefA[8192] = {
 *  } </pre>
 *
 */
+#if defined(ARM_TABLE_REALCOEF_F32)
 static const float32_t realCoefB[8192] = {
   0.500000000000000f, 0.500000000000000f, 0.500383496284485f, 0.499999850988388f,
   0.500766992568970f, 0.499999403953552f, 0.501150488853455f, 0.499998688697815f,
@@ -4162,6 +4166,7 @@ static const float32_t realCoefB[8192] = {
   0.501533985137939f, -0.499997645616531f, 0.501150488853455f, -0.499998688697815f,
   0.500766992568970f, -0.499999403953552f, 0.500383496284485f, -0.499999850988388f,
 };
+#endif
 
 
 
@@ -4209,6 +4214,7 @@ arm_status arm_rfft_init_f32(
   /*  Initialise the default arm status */
   arm_status status = ARM_MATH_SUCCESS;
 
+#if defined(ARM_TABLE_REALCOEF_F32) && defined(ARM_TABLE_TWIDDLECOEF_F32_4096) && defined(ARM_TABLE_BITREV_1024)
   /*  Initialize the Real FFT length */
   S->fftLenReal = (uint16_t) fftLenReal;
 
@@ -4262,6 +4268,9 @@ arm_status arm_rfft_init_f32(
     /* Initializes the CFFT Module for fftLenreal/2 length */
     arm_cfft_radix4_init_f32(S->pCfft, S->fftLenBy2, 0U, 0U);
   }
+#else
+  status = ARM_MATH_ARGUMENT_ERROR;
+#endif
 
   /* return the status of RFFT Init function */
   return (status);
@@ -0,0 +1,144 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_mixed_f32.c
+ * Description:  Mixed-radix (2, 3, 4, 5) Real FFT Processing function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup RealFFT
+ * @{
+ */
+
+/**
+ * \par Mixed-radix real FFT
+ * arm_rfft_mixed_f32(), initialized by arm_rfft_mixed_init_f32(), computes the real FFT
+ * of any even length 2<sup>a</sup>3<sup>b</sup>5<sup>c</sup>, e.g. 1000, 1200 or 3000
+ * points, on top of the fftLen/2 points mixed-radix complex FFT arm_cfft_mixed_f32().
+ * Its input and output are the ones of arm_rfft_fast_f32(): the forward transform
+ * outputs the packed fftLen/2 complex values, X[0] and X[fftLen/2] being the real and
+ * imaginary parts of the first one, and the inverse transform takes them as input. The
+ * input buffer is modified.
+ */
+
+/**
+ * @brief Processing function for the floating-point mixed-radix real FFT.
+ * @param[in]  *S              points to an arm_rfft_mixed_instance_f32 structure.
+ * @param[in]  *p              points to the input buffer of size <code>fftLen</code>, modified.
+ * @param[out] *pOut           points to the output buffer of size <code>fftLen</code>.
+ * @param[in]  ifftFlag        RFFT if flag is 0, RIFFT if flag is 1
+ * @return none.
+ */
+
+void arm_rfft_mixed_f32(
+  const arm_rfft_mixed_instance_f32 * S,
+  float32_t * p,
+  float32_t * pOut,
+  uint8_t ifftFlag)
+{
+  const float32_t *pCoeff = S->pTwiddleRFFT;     /* Twiddle factors exp(j*2*pi*k/fftLen) */
+  float32_t *pA, *pB;                            /* Increasing and decreasing pointers */
+  float32_t ar, ai, br, bi;                      /* A = Z[k] or X[k], B = conj of the mirror value */
+  float32_t evR, evI, odR, odI, dr, di;          /* Temporary variables */
+  float32_t twR, twI;                            /* Twiddle factor */
+  uint32_t M = S->fftLenRFFT / 2U;               /* Length of the complex FFT */
+  uint32_t k;                                    /* Loop counter */
+
+  if (ifftFlag == 0U)
+  {
+    /* Z = FFT(x[2n] + j.x[2n+1]), in place */
+    arm_cfft_mixed_f32(&(S->Sint), p, 0U);
+
+    /* X[0] and X[M], real, packed together */
+    pOut[0] = p[0] + p[1];
+    pOut[1] = p[0] - p[1];
+
+    /* X[k] = E[k] - j.exp(-j*2*pi*k/fftLen).O[k], E and O being the even and odd
+       parts 1/2 (Z[k] +/- conj(Z[M-k])) */
+    pA = p + 2U;
+    pB = p + 2U * (M - 1U);
+    for (k = 1U; k < M; k++)
+    {
+      ar = pA[0];
+      ai = pA[1];
+      br = pB[0];
+      bi = -pB[1];
+      twR = pCoeff[2U * k];
+      twI = pCoeff[2U * k + 1U];
+
+      evR = 0.5f * (ar + br);
+      evI = 0.5f * (ai + bi);
+      odR = 0.5f * (ar - br);
+      odI = 0.5f * (ai - bi);
+
+      pOut[2U * k]      = evR - twI * odR + twR * odI;
+      pOut[2U * k + 1U] = evI - twI * odI - twR * odR;
+
+      pA += 2U;
+      pB -= 2U;
+    }
+  }
+  else
+  {
+    /* Z[0] from X[0] and X[M] */
+    pOut[0] = 0.5f * (p[0] + p[1]);
+    pOut[1] = 0.5f * (p[0] - p[1]);
+
+    /* Z[k] = E[k] + O[k], E[k] = 1/2 (X[k] + conj(X[M-k])) and
+       O[k] = 1/2 (conj(X[M-k]) - X[k]).(-j).exp(j*2*pi*k/fftLen) */
+    pA = p + 2U;
+    pB = p + 2U * (M - 1U);
+    for (k = 1U; k < M; k++)
+    {
+      ar = pA[0];
+      ai = pA[1];
+      br = pB[0];
+      bi = -pB[1];
+      twR = pCoeff[2U * k];
+      twI = pCoeff[2U * k + 1U];
+
+      dr = br - ar;
+      di = bi - ai;
+
+      pOut[2U * k]      = 0.5f * (ar + br + dr * twI + di * twR);
+      pOut[2U * k + 1U] = 0.5f * (ai + bi + di * twI - dr * twR);
+
+      pA += 2U;
+      pB -= 2U;
+    }
+
+    /* x[2n] + j.x[2n+1] = IFFT(Z), in place */
+    arm_cfft_mixed_f32(&(S->Sint), pOut, 1U);
+  }
+}
+
+/**
+ * @} end of RealFFT group
+ */
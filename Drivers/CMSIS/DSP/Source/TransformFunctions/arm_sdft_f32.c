@@ -0,0 +1,186 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_f32.c
+ * Description:  Floating-point sliding DFT
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup SlidingDFT Sliding DFT
+ *
+ * The sliding DFT computes a few bins <code>k</code> of the <code>N</code> points DFT of
+ * the last <code>N</code> input samples, updating them at each sample:
+ * <pre>
+ *    X(k) = sum(x[n-N+1+i]*exp(-j*2*pi*k*i/N)), i = 0 .. N-1
+ * </pre>
+ * where the Goertzel filters give the bins once per block of <code>N</code> samples. The
+ * cost is two multiplies per sample and per bin, four in Q31, against about
+ * <code>2*log2(N)</code> per sample for a complex FFT of the same length computed once per
+ * block, and <code>N</code> times more if it is computed at each sample.
+ *
+ * \par Algorithm
+ * The functions implement the modulated sliding DFT. Each bin keeps the sum
+ * <code>A(k) = sum(x[p]*exp(-j*2*pi*k*p/N))</code> over the samples <code>p</code> of the
+ * window: the new sample is added and the one leaving the window subtracted, both
+ * multiplied by the same factor <code>exp(-j*2*pi*k*p/N)</code>, read from a table of the
+ * <code>N</code> factors at index <code>k*p mod N</code>. The bin is
+ * <code>X(k) = A(k)*exp(j*2*pi*k*(n+1)/N)</code>, computed when it is output. The
+ * recursive form of the sliding DFT rotates its state at each sample and accumulates the
+ * rounding errors of the rotations; here no error goes through more than one multiply.
+ * In Q15 and Q31, the product subtracted is bit-exact the one added <code>N</code>
+ * samples earlier and the sums are exact: the output does not drift, however long the
+ * stream. In floating-point, the rounding errors of the additions accumulate as a random
+ * walk, to about <code>sqrt(n)</code> times the rounding of one sample after
+ * <code>n</code> samples; calling the initialization function again clears them along
+ * with the window.
+ *
+ * \par Streaming
+ * The functions take blocks of any size and output the <code>numBins</code> complex bins
+ * of the last <code>N</code> samples, real and imaginary parts interleaved: a call per
+ * sample updates the bins per sample, a call per block updates them per block. The
+ * window initially holds <code>N</code> zeros.
+ *
+ * \par Fixed-point behavior
+ * The Q15 and Q31 functions output <code>X(k)/N</code>, as the fixed-point FFTs scale their
+ * output down. The sums are kept in Q63 and cannot overflow.
+ *
+ * \par Instance Structure
+ * The window length, the bins, the table of factors, the delay line of the last
+ * <code>N</code> samples and the sums of the bins are stored in an instance data
+ * structure. The table, of <code>2*fftLen</code> values, the delay line, of
+ * <code>fftLen</code> values, and the sums, of <code>2*numBins</code> values, are given by
+ * the application.
+ *
+ * \par Initialization Functions
+ * arm_sdft_init_f32(), arm_sdft_init_q31() and arm_sdft_init_q15() compute the table of
+ * factors, in double precision, and clear the delay line and the sums.
+ */
+
+/**
+ * @addtogroup SlidingDFT
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point sliding DFT.
+ * @param[in,out] *S         points to an instance of the floating-point sliding DFT structure.
+ * @param[in]     *pSrc      points to the block of input samples.
+ * @param[out]    *pDst      points to the <code>2*numBins</code> output values, the bins of the
+ *                           last <code>fftLen</code> samples.
+ * @param[in]     blockSize  number of input samples to process, any value.
+ */
+
+void arm_sdft_f32(
+  arm_sdft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  const float32_t *pCoeffs = S->pCoeffs;         /* Table of exp(j*2*pi*m/N) */
+  float32_t *pState = S->pState;                 /* Delay line */
+  float32_t *pSum;                               /* Sum of the bin */
+  float32_t *pIn, *pOld;                         /* New and leaving samples */
+  float32_t sumRe, sumIm, diff, c, s;            /* Sum, difference of the samples, factor */
+  uint32_t numBins = S->numBins;                 /* Number of bins */
+  uint32_t fftLen = S->fftLen;                   /* Length of the window */
+  uint32_t stateIndex = S->stateIndex;           /* Oldest sample of the window */
+  uint32_t n, bin, k, idx, i;                    /* Samples processed, bin, table index, loop counter */
+
+  while (blockSize > 0U)
+  {
+    /* Input samples up to the end of the delay line */
+    n = fftLen - stateIndex;
+    if (n > blockSize)
+    {
+      n = blockSize;
+    }
+
+    pSum = S->pSum;
+
+    for (bin = 0U; bin < numBins; bin++)
+    {
+      k = S->pBins[bin];
+      idx = (k * stateIndex) % fftLen;
+      sumRe = pSum[0];
+      sumIm = pSum[1];
+      pIn = pSrc;
+      pOld = pState + stateIndex;
+
+      /* A(k) += (x[p] - x[p-N])*exp(-j*2*pi*k*p/N) */
+      i = n;
+      while (i > 0U)
+      {
+        diff = *pIn++ - *pOld++;
+        sumRe += diff * pCoeffs[2U * idx];
+        sumIm -= diff * pCoeffs[2U * idx + 1U];
+
+        idx += k;
+        if (idx >= fftLen)
+        {
+          idx -= fftLen;
+        }
+        i--;
+      }
+
+      pSum[0] = sumRe;
+      pSum[1] = sumIm;
+      pSum += 2U;
+    }
+
+    /* The new samples replace the ones leaving the window */
+    memcpy(pState + stateIndex, pSrc, n * sizeof(float32_t));
+    stateIndex += n;
+    if (stateIndex == fftLen)
+    {
+      stateIndex = 0U;
+    }
+
+    pSrc += n;
+    blockSize -= n;
+  }
+
+  S->stateIndex = (uint16_t) stateIndex;
+
+  /* X(k) = A(k)*exp(j*2*pi*k*(n+1)/N), (n+1) mod N being the oldest sample index */
+  pSum = S->pSum;
+  for (bin = 0U; bin < numBins; bin++)
+  {
+    idx = (S->pBins[bin] * stateIndex) % fftLen;
+    c = pCoeffs[2U * idx];
+    s = pCoeffs[2U * idx + 1U];
+    *pDst++ = pSum[0] * c - pSum[1] * s;
+    *pDst++ = pSum[0] * s + pSum[1] * c;
+    pSum += 2U;
+  }
+}
+
+/**
+ * @} end of SlidingDFT group
+ */
@@ -0,0 +1,116 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_init_q31.c
+ * Description:  Initialization function of the Q31 sliding DFT
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern void arm_dft_cos_sin(
+  uint32_t k,
+  uint32_t n,
+  double * pCos,
+  double * pSin);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup SlidingDFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 sliding DFT.
+ * @param[in,out] *S         points to an instance of the Q31 sliding DFT structure.
+ * @param[in]     numBins    number of bins.
+ * @param[in]     fftLen     length N of the window, not zero.
+ * @param[in]     *pBins     points to the bins k, from 0 to <code>N-1</code>, array of length numBins.
+ * @param[in]     *pCoeffs   points to the table of factors, of length <code>2*fftLen</code>.
+ * @param[in]     *pState    points to the delay line, of length <code>fftLen</code>.
+ * @param[in]     *pSum      points to the sums of the bins, of length <code>2*numBins</code>.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or
+ *                ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is zero or a bin is not
+ *                below <code>fftLen</code>.
+ *
+ * \par
+ * The factors <code>cos(2*pi*m/N)</code>, <code>sin(2*pi*m/N)</code>, <code>0 <= m < N</code>,
+ * are computed in double precision, rounded and saturated to Q31. The bin <code>k</code> is at
+ * the frequency <code>k*fs/N</code>, <code>fs</code> being the sampling rate. The bins
+ * array and the buffers must stay allocated as long as the instance is used.
+ */
+
+arm_status arm_sdft_init_q31(
+  arm_sdft_instance_q31 * S,
+  uint16_t numBins,
+  uint16_t fftLen,
+  const uint16_t * pBins,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  q63_t * pSum)
+{
+  double c, s;                                   /* cos(2*pi*m/N), sin(2*pi*m/N) */
+  uint32_t i;                                    /* Loop counter */
+
+  if (fftLen == 0U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (i = 0U; i < numBins; i++)
+  {
+    if (pBins[i] >= fftLen)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+  }
+
+  for (i = 0U; i < fftLen; i++)
+  {
+    arm_dft_cos_sin(i, fftLen, &c, &s);
+    pCoeffs[2U * i] = clip_q63_to_q31((q63_t) (c * 2147483648.0 + ((c < 0.0) ? -0.5 : 0.5)));
+    pCoeffs[2U * i + 1U] = clip_q63_to_q31((q63_t) (s * 2147483648.0 + ((s < 0.0) ? -0.5 : 0.5)));
+  }
+
+  S->numBins = numBins;
+  S->fftLen = fftLen;
+  S->stateIndex = 0U;
+  S->invFftLen = (fftLen == 1U) ? 0x7FFFFFFF : (q31_t) ((0x80000000U + fftLen / 2U) / fftLen);
+  S->pBins = pBins;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+  S->pSum = pSum;
+
+  /* Window of zeros */
+  memset(pState, 0, fftLen * sizeof(q31_t));
+  memset(pSum, 0, 2U * numBins * sizeof(q63_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of SlidingDFT group
+ */
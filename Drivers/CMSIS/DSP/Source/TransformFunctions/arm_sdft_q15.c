@@ -0,0 +1,148 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_q15.c
+ * Description:  Q15 sliding DFT
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup SlidingDFT
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 sliding DFT.
+ * @param[in,out] *S         points to an instance of the Q15 sliding DFT structure.
+ * @param[in]     *pSrc      points to the block of input samples.
+ * @param[out]    *pDst      points to the <code>2*numBins</code> output values, the bins of the
+ *                           last <code>fftLen</code> samples.
+ * @param[in]     blockSize  number of input samples to process, any value.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The difference of the new and leaving samples, in 2.15 format, times the 1.15 factor
+ * fits in 32 bits and is accumulated without rounding in a Q63 sum, in 34.30 format. The
+ * outputs are <code>X(k)/N</code> in 1.15 format, saturated.
+ */
+
+void arm_sdft_q15(
+  arm_sdft_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  const q15_t *pCoeffs = S->pCoeffs;             /* Table of exp(j*2*pi*m/N) */
+  q15_t *pState = S->pState;                     /* Delay line */
+  q63_t *pSum;                                   /* Sum of the bin */
+  q15_t *pIn, *pOld;                             /* New and leaving samples */
+  q63_t sumRe, sumIm, re, im;                    /* Sum, X(k) */
+  q31_t diff, c, s;                              /* Difference of the samples, factor */
+  q31_t invFftLen = S->invFftLen;                /* 1/N, output scaling */
+  uint32_t numBins = S->numBins;                 /* Number of bins */
+  uint32_t fftLen = S->fftLen;                   /* Length of the window */
+  uint32_t stateIndex = S->stateIndex;           /* Oldest sample of the window */
+  uint32_t n, bin, k, idx, i;                    /* Samples processed, bin, table index, loop counter */
+
+  while (blockSize > 0U)
+  {
+    /* Input samples up to the end of the delay line */
+    n = fftLen - stateIndex;
+    if (n > blockSize)
+    {
+      n = blockSize;
+    }
+
+    pSum = S->pSum;
+
+    for (bin = 0U; bin < numBins; bin++)
+    {
+      k = S->pBins[bin];
+      idx = (k * stateIndex) % fftLen;
+      sumRe = pSum[0];
+      sumIm = pSum[1];
+      pIn = pSrc;
+      pOld = pState + stateIndex;
+
+      /* A(k) += (x[p] - x[p-N])*exp(-j*2*pi*k*p/N) */
+      i = n;
+      while (i > 0U)
+      {
+        diff = (q31_t) *pIn++ - *pOld++;
+        sumRe += diff * pCoeffs[2U * idx];
+        sumIm -= diff * pCoeffs[2U * idx + 1U];
+
+        idx += k;
+        if (idx >= fftLen)
+        {
+          idx -= fftLen;
+        }
+        i--;
+      }
+
+      pSum[0] = sumRe;
+      pSum[1] = sumIm;
+      pSum += 2U;
+    }
+
+    /* The new samples replace the ones leaving the window */
+    memcpy(pState + stateIndex, pSrc, n * sizeof(q15_t));
+    stateIndex += n;
+    if (stateIndex == fftLen)
+    {
+      stateIndex = 0U;
+    }
+
+    pSrc += n;
+    blockSize -= n;
+  }
+
+  S->stateIndex = (uint16_t) stateIndex;
+
+  /* X(k) = A(k)*exp(j*2*pi*k*(n+1)/N), (n+1) mod N being the oldest sample index.
+     The sum is brought to 17.15 format before the rotation, scaled by 1/N after */
+  pSum = S->pSum;
+  for (bin = 0U; bin < numBins; bin++)
+  {
+    idx = (S->pBins[bin] * stateIndex) % fftLen;
+    c = pCoeffs[2U * idx];
+    s = pCoeffs[2U * idx + 1U];
+    sumRe = pSum[0] >> 15;
+    sumIm = pSum[1] >> 15;
+    re = (sumRe * c - sumIm * s) >> 15;
+    im = (sumRe * s + sumIm * c) >> 15;
+    *pDst++ = (q15_t) __SSAT((q31_t) ((re * invFftLen) >> 31), 16);
+    *pDst++ = (q15_t) __SSAT((q31_t) ((im * invFftLen) >> 31), 16);
+    pSum += 2U;
+  }
+}
+
+/**
+ * @} end of SlidingDFT group
+ */
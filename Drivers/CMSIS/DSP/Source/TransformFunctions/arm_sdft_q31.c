@@ -0,0 +1,161 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_q31.c
+ * Description:  Q31 sliding DFT
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/* (a * b) >> 31 of a Q63 value and a Q31 value: the upper and lower words of
+   a are multiplied separately, the 95-bit product not fitting in 64 bits */
+static __INLINE q63_t arm_sdft_mult_q31(
+  q63_t a,
+  q31_t b)
+{
+  return (((q63_t) ((q31_t) (a >> 32)) * b) * 2) + (((q63_t) ((uint32_t) a) * b) >> 31);
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup SlidingDFT
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 sliding DFT.
+ * @param[in,out] *S         points to an instance of the Q31 sliding DFT structure.
+ * @param[in]     *pSrc      points to the block of input samples.
+ * @param[out]    *pDst      points to the <code>2*numBins</code> output values, the bins of the
+ *                           last <code>fftLen</code> samples.
+ * @param[in]     blockSize  number of input samples to process, any value.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The new and leaving samples are multiplied separately by the 1.31 factor, each product
+ * being truncated to 2.30 format: the product subtracted is bit-exact the one added
+ * <code>N</code> samples earlier. The products are accumulated in a Q63 sum, in 34.30
+ * format. The outputs are <code>X(k)/N</code> in 1.31 format, saturated.
+ */
+
+void arm_sdft_q31(
+  arm_sdft_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  const q31_t *pCoeffs = S->pCoeffs;             /* Table of exp(j*2*pi*m/N) */
+  q31_t *pState = S->pState;                     /* Delay line */
+  q63_t *pSum;                                   /* Sum of the bin */
+  q31_t *pIn, *pOld;                             /* New and leaving samples */
+  q63_t sumRe, sumIm, re, im;                    /* Sum, X(k) */
+  q31_t x, xOld, c, s;                           /* New and leaving samples, factor */
+  q31_t invFftLen = S->invFftLen;                /* 1/N, output scaling */
+  uint32_t numBins = S->numBins;                 /* Number of bins */
+  uint32_t fftLen = S->fftLen;                   /* Length of the window */
+  uint32_t stateIndex = S->stateIndex;           /* Oldest sample of the window */
+  uint32_t n, bin, k, idx, i;                    /* Samples processed, bin, table index, loop counter */
+
+  while (blockSize > 0U)
+  {
+    /* Input samples up to the end of the delay line */
+    n = fftLen - stateIndex;
+    if (n > blockSize)
+    {
+      n = blockSize;
+    }
+
+    pSum = S->pSum;
+
+    for (bin = 0U; bin < numBins; bin++)
+    {
+      k = S->pBins[bin];
+      idx = (k * stateIndex) % fftLen;
+      sumRe = pSum[0];
+      sumIm = pSum[1];
+      pIn = pSrc;
+      pOld = pState + stateIndex;
+
+      /* A(k) += x[p]*exp(-j*2*pi*k*p/N) - x[p-N]*exp(-j*2*pi*k*p/N) */
+      i = n;
+      while (i > 0U)
+      {
+        x = *pIn++;
+        xOld = *pOld++;
+        c = pCoeffs[2U * idx];
+        s = pCoeffs[2U * idx + 1U];
+        sumRe += (q31_t) (((q63_t) x * c) >> 32) - (q31_t) (((q63_t) xOld * c) >> 32);
+        sumIm -= (q31_t) (((q63_t) x * s) >> 32) - (q31_t) (((q63_t) xOld * s) >> 32);
+
+        idx += k;
+        if (idx >= fftLen)
+        {
+          idx -= fftLen;
+        }
+        i--;
+      }
+
+      pSum[0] = sumRe;
+      pSum[1] = sumIm;
+      pSum += 2U;
+    }
+
+    /* The new samples replace the ones leaving the window */
+    memcpy(pState + stateIndex, pSrc, n * sizeof(q31_t));
+    stateIndex += n;
+    if (stateIndex == fftLen)
+    {
+      stateIndex = 0U;
+    }
+
+    pSrc += n;
+    blockSize -= n;
+  }
+
+  S->stateIndex = (uint16_t) stateIndex;
+
+  /* X(k) = A(k)*exp(j*2*pi*k*(n+1)/N), (n+1) mod N being the oldest sample index.
+     The sum is scaled by 1/N before the rotation */
+  pSum = S->pSum;
+  for (bin = 0U; bin < numBins; bin++)
+  {
+    idx = (S->pBins[bin] * stateIndex) % fftLen;
+    c = pCoeffs[2U * idx];
+    s = pCoeffs[2U * idx + 1U];
+    sumRe = arm_sdft_mult_q31(pSum[0], invFftLen);
+    sumIm = arm_sdft_mult_q31(pSum[1], invFftLen);
+    re = (sumRe * c - sumIm * s) >> 30;
+    im = (sumRe * s + sumIm * c) >> 30;
+    *pDst++ = clip_q63_to_q31(re);
+    *pDst++ = clip_q63_to_q31(im);
+    pSum += 2U;
+  }
+}
+
+/**
+ * @} end of SlidingDFT group
+ */
@@ -0,0 +1,185 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stft_f32.c
+ * Description:  Floating-point streaming Short-Time Fourier Transform
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup STFT Short-Time Fourier Transform Functions
+ *
+ * The short-time Fourier transform (STFT) cuts a signal into overlapping frames of
+ * <code>fftLen</code> samples, <code>hopSize</code> samples apart, multiplies each frame
+ * by a window and computes its real FFT with arm_rfft_fast_f32(). The inverse STFT
+ * computes the inverse real FFT of each frame, multiplies it by a synthesis window and
+ * overlap-adds the frames.
+ *
+ * \par Streaming analysis
+ * arm_stft_f32() takes blocks of any size: the input samples go to a ring of the last
+ * <code>fftLen</code> samples and a frame is output every <code>hopSize</code> samples,
+ * the first one after the first <code>hopSize</code> samples, the ring being initially
+ * filled with zeros. A block of <code>blockSize</code> samples outputs at most
+ * <code>blockSize/hopSize + 1</code> frames. The frames are the packed spectra of
+ * arm_rfft_fast_f32() (ARM_STFT_SPECTRUM), or the magnitude (ARM_STFT_MAGNITUDE, by
+ * arm_cmplx_mag_f32()) or squared magnitude (ARM_STFT_POWER, by arm_cmplx_mag_squared_f32())
+ * of the <code>fftLen/2+1</code> bins 0 to <code>fftLen/2</code>.
+ *
+ * \par Overlap-add synthesis
+ * arm_istft_f32() takes packed spectra and outputs <code>hopSize</code> samples per frame.
+ * The synthesis window <code>w[n] / sum(w[n + m*hopSize]^2)</code>, the sum being over
+ * all the <code>m</code> for which <code>0 <= n + m*hopSize < fftLen</code>, is computed at
+ * initialization from the analysis window: the inverse STFT of the STFT of a signal
+ * gives the signal back, delayed by <code>fftLen - hopSize</code> samples, for any window
+ * and hop size for which the sums are not zero.
+ *
+ * \par Lengths supported
+ * The lengths of arm_rfft_fast_f32(): 32, 64, 128, 256, 512, 1024, 2048 and 4096 points,
+ * with a hop size from 1 to <code>fftLen</code>.
+ *
+ * \par Instance Structure
+ * The window, hop size, real FFT instance and the state of the stream are stored in an
+ * instance data structure. The state buffer, of <code>3*fftLen</code> values, is given
+ * by the application: no memory is allocated.
+ *
+ * \par Initialization Functions
+ * arm_stft_init_f32() and arm_istft_init_f32() initialize the real FFT, clear the state
+ * and, for the inverse STFT, compute the synthesis window. A stream is restarted by
+ * calling the initialization function again.
+ */
+
+/**
+ * @addtogroup STFT
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point streaming STFT.
+ * @param[in,out] *S         points to an instance of the floating-point STFT structure.
+ * @param[in]     *pSrc      points to the block of input samples.
+ * @param[out]    *pDst      points to the block of output frames, of <code>blockSize/hopSize + 1</code>
+ *                           frames at most.
+ * @param[in]     blockSize  number of input samples to process, any value.
+ * @return        number of frames output.
+ */
+
+uint32_t arm_stft_f32(
+  arm_stft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pRing = S->pState;                  /* Ring of the last fftLen input samples */
+  float32_t *pFrame = pRing + S->fftLen;         /* Windowed frame */
+  float32_t *pSpectrum = pFrame + S->fftLen;     /* Spectrum of the frame */
+  const float32_t *pWindow = S->pWindow;         /* Analysis window */
+  float32_t re;                                  /* Real value of bin 0 or fftLen/2 */
+  uint32_t fftLen = S->fftLen;                   /* Length of the frames */
+  uint32_t half = fftLen / 2U;                   /* Index of the last bin */
+  uint32_t stateIndex = S->stateIndex;           /* Oldest sample of the ring */
+  uint32_t hopCount = S->hopCount;               /* Input samples since the last frame */
+  uint32_t numFrames = 0U;                       /* Number of frames output */
+  uint32_t n, first;                             /* Samples copied, samples before the end of the ring */
+
+  while (blockSize > 0U)
+  {
+    /* Input samples up to the next frame, written over the oldest ones */
+    n = S->hopSize - hopCount;
+    if (n > blockSize)
+    {
+      n = blockSize;
+    }
+
+    first = fftLen - stateIndex;
+    if (n < first)
+    {
+      memcpy(pRing + stateIndex, pSrc, n * sizeof(float32_t));
+      stateIndex += n;
+    }
+    else
+    {
+      memcpy(pRing + stateIndex, pSrc, first * sizeof(float32_t));
+      memcpy(pRing, pSrc + first, (n - first) * sizeof(float32_t));
+      stateIndex = n - first;
+    }
+
+    pSrc += n;
+    blockSize -= n;
+    hopCount += n;
+
+    if (hopCount == S->hopSize)
+    {
+      hopCount = 0U;
+
+      /* Windowed frame of the last fftLen samples, from the oldest one */
+      first = fftLen - stateIndex;
+      arm_mult_f32(pRing + stateIndex, (float32_t *) pWindow, pFrame, first);
+      arm_mult_f32(pRing, (float32_t *) pWindow + first, pFrame + first, stateIndex);
+
+      if (S->outputType == ARM_STFT_SPECTRUM)
+      {
+        arm_rfft_fast_f32(&(S->Srfft), pFrame, pDst, 0U);
+        pDst += fftLen;
+      }
+      else
+      {
+        arm_rfft_fast_f32(&(S->Srfft), pFrame, pSpectrum, 0U);
+
+        /* Bins 1 to fftLen/2 - 1 are complex, bins 0 and fftLen/2 are real and
+           packed in the first complex value */
+        if (S->outputType == ARM_STFT_MAGNITUDE)
+        {
+          arm_cmplx_mag_f32(pSpectrum + 2, pDst + 1, half - 1U);
+          re = pSpectrum[0];
+          pDst[0] = (re < 0.0f) ? -re : re;
+          re = pSpectrum[1];
+          pDst[half] = (re < 0.0f) ? -re : re;
+        }
+        else
+        {
+          arm_cmplx_mag_squared_f32(pSpectrum + 2, pDst + 1, half - 1U);
+          pDst[0] = pSpectrum[0] * pSpectrum[0];
+          pDst[half] = pSpectrum[1] * pSpectrum[1];
+        }
+        pDst += half + 1U;
+      }
+
+      numFrames++;
+    }
+  }
+
+  S->stateIndex = (uint16_t) stateIndex;
+  S->hopCount = (uint16_t) hopCount;
+
+  return (numFrames);
+}
+
+/**
+ * @} end of STFT group
+ */
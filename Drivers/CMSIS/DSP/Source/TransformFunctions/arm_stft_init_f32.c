@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stft_init_f32.c
+ * Description:  Initialization function of the floating-point STFT
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 STMicroelectronics. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup STFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point streaming STFT.
+ * @param[in,out] *S          points to an instance of the floating-point STFT structure.
+ * @param[in]     fftLen      length of the frames: 32, 64, 128, 256, 512, 1024, 2048 or 4096.
+ * @param[in]     hopSize     number of input samples between two frames, from 1 to <code>fftLen</code>.
+ * @param[in]     *pWindow    points to the analysis window of <code>fftLen</code> values.
+ * @param[in]     *pState     points to the state buffer of <code>3*fftLen</code> values.
+ * @param[in]     outputType  frames output: ARM_STFT_SPECTRUM, ARM_STFT_MAGNITUDE or ARM_STFT_POWER.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or
+ *                ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> or <code>hopSize</code> is not supported.
+ *
+ * \par
+ * The window and the state buffer must stay allocated as long as the instance is used.
+ * The ring of input samples is cleared.
+ */
+
+arm_status arm_stft_init_f32(
+  arm_stft_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  const float32_t * pWindow,
+  float32_t * pState,
+  arm_stft_output outputType)
+{
+  arm_status status;
+
+  if ((hopSize == 0U) || (hopSize > fftLen))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  status = arm_rfft_fast_init_f32(&(S->Srfft), fftLen);
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    S->fftLen = fftLen;
+    S->hopSize = hopSize;
+    S->stateIndex = 0U;
+    S->hopCount = 0U;
+    S->outputType = outputType;
+    S->pWindow = pWindow;
+    S->pState = pState;
+
+    /* Clear the ring of input samples */
+    memset(pState, 0, fftLen * sizeof(float32_t));
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of STFT group
+ */
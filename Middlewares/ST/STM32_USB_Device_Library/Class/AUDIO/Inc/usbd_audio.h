@@ -50,8 +50,27 @@
 #define USBD_MAX_NUM_INTERFACES                       1U
 #endif /* USBD_AUDIO_FREQ */
 
+/* Asynchronous sink with explicit feedback endpoint: the device reports the
+   rate it actually consumes samples at and the host adapts the packet sizes,
+   so the ring never has to be re-centered by skipping or replaying data.
+   Requirements of the low level driver (usbd_conf.c):
+   - the feedback value is refreshed from the SOF callback: the PCD has to be
+     initialized with the SOF interrupt enabled (Init.Sof_enable = 1), else
+     the host keeps the value sent when the streaming interface is selected
+   - AUDIO_FB_EP (0x81) is an IN endpoint of its own: it needs its own packet
+     memory buffer on the FS device peripheral (HAL_PCDEx_PMAConfig) or its
+     own TX FIFO on the OTG one (HAL_PCDEx_SetTxFiFo) */
+#ifndef USBD_AUDIO_FEEDBACK
+#define USBD_AUDIO_FEEDBACK                           0U
+#endif /* USBD_AUDIO_FEEDBACK */
+
 #define AUDIO_OUT_EP                                  0x01U
+#define AUDIO_FB_EP                                   0x81U
+#if (USBD_AUDIO_FEEDBACK == 1U)
+#define USB_AUDIO_CONFIG_DESC_SIZ                     0x76U
+#else
 #define USB_AUDIO_CONFIG_DESC_SIZ                     0x6DU
+#endif /* USBD_AUDIO_FEEDBACK */
 #define AUDIO_INTERFACE_DESC_SIZE                     0x09U
 #define USB_AUDIO_DESC_SIZ                            0x09U
 #define AUDIO_STANDARD_ENDPOINT_DESC_SIZE             0x09U
@@ -96,11 +115,40 @@
 #define AUDIO_DEFAULT_VOLUME                          70U
 
 /* Number of sub-packets in the audio transfer buffer. You can modify this value but always make sure
-  that it is an even number and higher than 3 */
+  that it is an even number and higher than 3. The ring holds AUDIO_OUT_PACKET_NUM ms of audio and
+  the playback latency is half of it. With USBD_AUDIO_FEEDBACK the ring only absorbs USB jitter and
+  8 to 16 packets are usually enough */
+#ifndef AUDIO_OUT_PACKET_NUM
 #define AUDIO_OUT_PACKET_NUM                          80U
+#endif /* AUDIO_OUT_PACKET_NUM */
 /* Total size of the audio transfer buffer */
 #define AUDIO_TOTAL_BUF_SIZE                          ((uint16_t)(AUDIO_OUT_PACKET * AUDIO_OUT_PACKET_NUM))
 
+/* Largest OUT packet: in feedback mode the host may send one extra stereo sample per frame */
+#if (USBD_AUDIO_FEEDBACK == 1U)
+#define AUDIO_OUT_MAX_PACKET                          ((uint16_t)(AUDIO_OUT_PACKET + 4U))
+#else
+#define AUDIO_OUT_MAX_PACKET                          AUDIO_OUT_PACKET
+#endif /* USBD_AUDIO_FEEDBACK */
+
+/* Feedback value: samples per frame in 10.14 format, sent on 3 bytes (full speed) */
+#define AUDIO_FB_PACKET                               3U
+#define AUDIO_FB_NOMINAL                              (((USBD_AUDIO_FREQ / 1000U) << 14) + \
+                                                       (((USBD_AUDIO_FREQ % 1000U) << 14) / 1000U))
+/* Feedback is refreshed every 2^AUDIO_FB_REFRESH frames (bRefresh, 1..9) */
+#ifndef AUDIO_FB_REFRESH
+#define AUDIO_FB_REFRESH                              5U
+#endif /* AUDIO_FB_REFRESH */
+/* PI controller gains, in 10.14 units per stereo sample of ring fill error */
+#ifndef AUDIO_FB_KP
+#define AUDIO_FB_KP                                   32
+#endif /* AUDIO_FB_KP */
+#ifndef AUDIO_FB_KI
+#define AUDIO_FB_KI                                   2
+#endif /* AUDIO_FB_KI */
+/* Maximum deviation of the feedback from the nominal rate (nominal / 64 = 1.5%) */
+#define AUDIO_FB_MAX_DEVIATION                        (AUDIO_FB_NOMINAL >> 6)
+
     /* Audio Commands enumeration */
 typedef enum
 {
@@ -146,9 +194,25 @@ typedef struct
   uint16_t                   rd_ptr;
   uint16_t                   wr_ptr;
   USBD_AUDIO_ControlTypeDef control;
+#if (USBD_AUDIO_FEEDBACK == 1U)
+  uint8_t                   packet[AUDIO_OUT_MAX_PACKET];
+  uint8_t                   fb_buf[4];
+  uint32_t                  fb_value;
+  int32_t                   fb_integral;
+  uint16_t                  fb_sof_count;
+  uint8_t                   fb_busy;
+#endif /* USBD_AUDIO_FEEDBACK */
 }
 USBD_AUDIO_HandleTypeDef;
 
+/* RAM needed by the class data of one configuration, in bytes */
+#define USBD_AUDIO_CLASS_DATA_SIZE          (sizeof(USBD_AUDIO_HandleTypeDef))
+
+/* RAM needed by one configuration of the class, in bytes: the class data,
+   which holds the AUDIO_TOTAL_BUF_SIZE bytes ring, and the descriptors */
+#define USBD_AUDIO_CONFIG_RAM_SIZE          (USBD_AUDIO_CLASS_DATA_SIZE + USB_AUDIO_CONFIG_DESC_SIZ + \
+                                             USB_LEN_DEV_QUALIFIER_DESC)
+
 
 typedef struct
 {
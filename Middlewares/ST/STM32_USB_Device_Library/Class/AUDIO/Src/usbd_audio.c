@@ -32,6 +32,9 @@
   *             - No volume control
   *             - Mute/Unmute capability
   *             - Asynchronous Endpoints
+  *             - Optional explicit feedback endpoint (USBD_AUDIO_FEEDBACK) driven by
+  *               a PI control of the ring fill level, instead of re-centering the
+  *               read pointer
   *
   * @note     In HS mode and when the DMA is used, all variables and data structures
   *           dealing with the DMA during the transaction process should be 32-bit aligned.
@@ -95,8 +98,11 @@
   */
 #define AUDIO_SAMPLE_FREQ(frq)      (uint8_t)(frq), (uint8_t)((frq >> 8)), (uint8_t)((frq >> 16))
 
-#define AUDIO_PACKET_SZE(frq)          (uint8_t)(((frq * 2U * 2U)/1000U) & 0xFFU), \
-                                       (uint8_t)((((frq * 2U * 2U)/1000U) >> 8) & 0xFFU)
+/* Audio 1.0 standard endpoint descriptor: the USB 2.0 one (USBD_ENDPOINT_DESC)
+   followed by bRefresh and bSynchAddress, hence its own bLength of 9 */
+#define USBD_AUDIO_ENDPOINT_DESC(addr, attr, mps, interval, refresh, synch)   \
+  AUDIO_STANDARD_ENDPOINT_DESC_SIZE, USB_DESC_TYPE_ENDPOINT, (addr), (attr),  \
+  LOBYTE((mps)), HIBYTE((mps)), (interval), (refresh), (synch)
 
 /**
   * @}
@@ -141,6 +147,14 @@ static void AUDIO_REQ_GetCurrent(USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef
 
 static void AUDIO_REQ_SetCurrent(USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef *req);
 
+#if (USBD_AUDIO_FEEDBACK == 1U)
+static void AUDIO_RingWrite(USBD_AUDIO_HandleTypeDef *haudio, uint32_t len);
+
+static void AUDIO_FB_Update(USBD_AUDIO_HandleTypeDef *haudio);
+
+static void AUDIO_FB_Send(USBD_HandleTypeDef *pdev, USBD_AUDIO_HandleTypeDef *haudio);
+#endif /* USBD_AUDIO_FEEDBACK */
+
 /**
   * @}
   */
@@ -149,6 +163,12 @@ static void AUDIO_REQ_SetCurrent(USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef
   * @{
   */
 
+#if (USBD_STATIC_CLASS_DATA == 1U)
+/* AUDIO class data arenas, one per device instance (pdev->id), used instead of
+   USBD_malloc */
+static USBD_AUDIO_HandleTypeDef USBD_AUDIO_ClassData[USBD_MAX_NUM_INSTANCES];
+#endif /* USBD_STATIC_CLASS_DATA */
+
 USBD_ClassTypeDef  USBD_AUDIO =
 {
   USBD_AUDIO_Init,
@@ -168,31 +188,15 @@ USBD_ClassTypeDef  USBD_AUDIO =
 };
 
 /* USB AUDIO device Configuration Descriptor */
-__ALIGN_BEGIN static uint8_t USBD_AUDIO_CfgDesc[USB_AUDIO_CONFIG_DESC_SIZ] __ALIGN_END =
+__ALIGN_BEGIN static uint8_t USBD_AUDIO_CfgDesc[] __ALIGN_END =
 {
-  /* Configuration 1 */
-  0x09,                                 /* bLength */
-  USB_DESC_TYPE_CONFIGURATION,          /* bDescriptorType */
-  LOBYTE(USB_AUDIO_CONFIG_DESC_SIZ),    /* wTotalLength  109 bytes*/
-  HIBYTE(USB_AUDIO_CONFIG_DESC_SIZ),
-  0x02,                                 /* bNumInterfaces */
-  0x01,                                 /* bConfigurationValue */
-  0x00,                                 /* iConfiguration */
-  0xC0,                                 /* bmAttributes  BUS Powred*/
-  0x32,                                 /* bMaxPower = 100 mA*/
-  /* 09 byte*/
+  /* Configuration 1: 2 interfaces, self powered, 100 mA */
+  USBD_CONFIG_DESC(USB_DESC_TYPE_CONFIGURATION, USB_AUDIO_CONFIG_DESC_SIZ,
+                   0x02U, 0x01U, 0x00U, 0xC0U, 0x32U),
 
-  /* USB Speaker Standard interface descriptor */
-  AUDIO_INTERFACE_DESC_SIZE,            /* bLength */
-  USB_DESC_TYPE_INTERFACE,              /* bDescriptorType */
-  0x00,                                 /* bInterfaceNumber */
-  0x00,                                 /* bAlternateSetting */
-  0x00,                                 /* bNumEndpoints */
-  USB_DEVICE_CLASS_AUDIO,               /* bInterfaceClass */
-  AUDIO_SUBCLASS_AUDIOCONTROL,          /* bInterfaceSubClass */
-  AUDIO_PROTOCOL_UNDEFINED,             /* bInterfaceProtocol */
-  0x00,                                 /* iInterface */
-  /* 09 byte*/
+  /* USB Speaker Standard interface descriptor: Audio Control */
+  USBD_INTERFACE_DESC(0x00U, 0x00U, 0x00U, USB_DEVICE_CLASS_AUDIO,
+                      AUDIO_SUBCLASS_AUDIOCONTROL, AUDIO_PROTOCOL_UNDEFINED, 0x00U),
 
   /* USB Speaker Class-specific AC Interface Descriptor */
   AUDIO_INTERFACE_DESC_SIZE,            /* bLength */
@@ -247,29 +251,14 @@ __ALIGN_BEGIN static uint8_t USBD_AUDIO_CfgDesc[USB_AUDIO_CONFIG_DESC_SIZ] __ALI
 
   /* USB Speaker Standard AS Interface Descriptor - Audio Streaming Zero Bandwith */
   /* Interface 1, Alternate Setting 0                                             */
-  AUDIO_INTERFACE_DESC_SIZE,  /* bLength */
-  USB_DESC_TYPE_INTERFACE,        /* bDescriptorType */
-  0x01,                                 /* bInterfaceNumber */
-  0x00,                                 /* bAlternateSetting */
-  0x00,                                 /* bNumEndpoints */
-  USB_DEVICE_CLASS_AUDIO,               /* bInterfaceClass */
-  AUDIO_SUBCLASS_AUDIOSTREAMING,        /* bInterfaceSubClass */
-  AUDIO_PROTOCOL_UNDEFINED,             /* bInterfaceProtocol */
-  0x00,                                 /* iInterface */
-  /* 09 byte*/
+  USBD_INTERFACE_DESC(0x01U, 0x00U, 0x00U, USB_DEVICE_CLASS_AUDIO,
+                      AUDIO_SUBCLASS_AUDIOSTREAMING, AUDIO_PROTOCOL_UNDEFINED, 0x00U),
 
   /* USB Speaker Standard AS Interface Descriptor - Audio Streaming Operational */
-  /* Interface 1, Alternate Setting 1                                           */
-  AUDIO_INTERFACE_DESC_SIZE,  /* bLength */
-  USB_DESC_TYPE_INTERFACE,        /* bDescriptorType */
-  0x01,                                 /* bInterfaceNumber */
-  0x01,                                 /* bAlternateSetting */
-  0x01,                                 /* bNumEndpoints */
-  USB_DEVICE_CLASS_AUDIO,               /* bInterfaceClass */
-  AUDIO_SUBCLASS_AUDIOSTREAMING,        /* bInterfaceSubClass */
-  AUDIO_PROTOCOL_UNDEFINED,             /* bInterfaceProtocol */
-  0x00,                                 /* iInterface */
-  /* 09 byte*/
+  /* Interface 1, Alternate Setting 1: the data endpoint, and the feedback one */
+  USBD_INTERFACE_DESC(0x01U, 0x01U, (USBD_AUDIO_FEEDBACK == 1U) ? 0x02U : 0x01U,
+                      USB_DEVICE_CLASS_AUDIO, AUDIO_SUBCLASS_AUDIOSTREAMING,
+                      AUDIO_PROTOCOL_UNDEFINED, 0x00U),
 
   /* USB Speaker Audio Streaming Interface Descriptor */
   AUDIO_STREAMING_INTERFACE_DESC_SIZE,  /* bLength */
@@ -294,15 +283,16 @@ __ALIGN_BEGIN static uint8_t USBD_AUDIO_CfgDesc[USB_AUDIO_CONFIG_DESC_SIZ] __ALI
   /* 11 byte*/
 
   /* Endpoint 1 - Standard Descriptor */
-  AUDIO_STANDARD_ENDPOINT_DESC_SIZE,    /* bLength */
-  USB_DESC_TYPE_ENDPOINT,               /* bDescriptorType */
-  AUDIO_OUT_EP,                         /* bEndpointAddress 1 out endpoint*/
-  USBD_EP_TYPE_ISOC,                    /* bmAttributes */
-  AUDIO_PACKET_SZE(USBD_AUDIO_FREQ),    /* wMaxPacketSize in Bytes (Freq(Samples)*2(Stereo)*2(HalfWord)) */
-  0x01,                                 /* bInterval */
-  0x00,                                 /* bRefresh */
-  0x00,                                 /* bSynchAddress */
-  /* 09 byte*/
+#if (USBD_AUDIO_FEEDBACK == 1U)
+  /* Isochronous, asynchronous, nominal packet + 1 stereo sample, synchronized
+     by the feedback endpoint */
+  USBD_AUDIO_ENDPOINT_DESC(AUDIO_OUT_EP, USBD_EP_TYPE_ISOC | 0x04U,
+                           AUDIO_OUT_MAX_PACKET, 0x01U, 0x00U, AUDIO_FB_EP),
+#else
+  /* Isochronous, Freq(Samples)*2(Stereo)*2(HalfWord) bytes per packet */
+  USBD_AUDIO_ENDPOINT_DESC(AUDIO_OUT_EP, USBD_EP_TYPE_ISOC,
+                           AUDIO_OUT_MAX_PACKET, 0x01U, 0x00U, 0x00U),
+#endif /* USBD_AUDIO_FEEDBACK */
 
   /* Endpoint - Audio Streaming Descriptor*/
   AUDIO_STREAMING_ENDPOINT_DESC_SIZE,   /* bLength */
@@ -313,6 +303,12 @@ __ALIGN_BEGIN static uint8_t USBD_AUDIO_CfgDesc[USB_AUDIO_CONFIG_DESC_SIZ] __ALI
   0x00,                                 /* wLockDelay */
   0x00,
   /* 07 byte*/
+#if (USBD_AUDIO_FEEDBACK == 1U)
+
+  /* Endpoint 1 - Standard Descriptor: feedback, 10.14 samples per frame */
+  USBD_AUDIO_ENDPOINT_DESC(AUDIO_FB_EP, USBD_EP_TYPE_ISOC, AUDIO_FB_PACKET,
+                           0x01U, AUDIO_FB_REFRESH, 0x00U),
+#endif /* USBD_AUDIO_FEEDBACK */
 } ;
 
 /* USB Standard Device Descriptor */
@@ -330,6 +326,14 @@ __ALIGN_BEGIN static uint8_t USBD_AUDIO_DeviceQualifierDesc[USB_LEN_DEV_QUALIFIE
   0x00,
 };
 
+/* Enumeration breaks silently on a wrong wTotalLength (0x6D bytes, 0x76 with
+   the feedback endpoint): reject it at build time */
+USBD_STATIC_ASSERT(sizeof(USBD_AUDIO_CfgDesc) == USB_AUDIO_CONFIG_DESC_SIZ, AUDIO_CfgDesc);
+
+/* The isochronous packet size follows USBD_AUDIO_FREQ: reject sampling
+   rates that do not fit a full speed isochronous endpoint */
+USBD_STATIC_ASSERT(IS_USBD_FS_ISOC_MPS(AUDIO_OUT_MAX_PACKET), AUDIO_OUT_MAX_PACKET);
+
 /**
   * @}
   */
@@ -350,11 +354,22 @@ static uint8_t  USBD_AUDIO_Init (USBD_HandleTypeDef *pdev, uint8_t cfgidx)
   USBD_AUDIO_HandleTypeDef   *haudio;
 
   /* Open EP OUT */
-  USBD_LL_OpenEP(pdev, AUDIO_OUT_EP, USBD_EP_TYPE_ISOC, AUDIO_OUT_PACKET);
+  USBD_LL_OpenEP(pdev, AUDIO_OUT_EP, USBD_EP_TYPE_ISOC, AUDIO_OUT_MAX_PACKET);
   pdev->ep_out[AUDIO_OUT_EP & 0xFU].is_used = 1U;
 
+#if (USBD_AUDIO_FEEDBACK == 1U)
+  /* Open feedback EP IN */
+  USBD_LL_OpenEP(pdev, AUDIO_FB_EP, USBD_EP_TYPE_ISOC, AUDIO_FB_PACKET);
+  pdev->ep_in[AUDIO_FB_EP & 0xFU].is_used = 1U;
+#endif /* USBD_AUDIO_FEEDBACK */
+
   /* Allocate Audio structure */
+#if (USBD_STATIC_CLASS_DATA == 1U)
+  pdev->pClassData = (pdev->id < USBD_MAX_NUM_INSTANCES) ?
+                     &USBD_AUDIO_ClassData[pdev->id] : NULL;
+#else
   pdev->pClassData = USBD_malloc(sizeof (USBD_AUDIO_HandleTypeDef));
+#endif /* USBD_STATIC_CLASS_DATA */
 
   if(pdev->pClassData == NULL)
   {
@@ -368,6 +383,12 @@ static uint8_t  USBD_AUDIO_Init (USBD_HandleTypeDef *pdev, uint8_t cfgidx)
     haudio->wr_ptr = 0U;
     haudio->rd_ptr = 0U;
     haudio->rd_enable = 0U;
+#if (USBD_AUDIO_FEEDBACK == 1U)
+    haudio->fb_value = AUDIO_FB_NOMINAL;
+    haudio->fb_integral = 0;
+    haudio->fb_sof_count = 0U;
+    haudio->fb_busy = 0U;
+#endif /* USBD_AUDIO_FEEDBACK */
 
     /* Initialize the Audio output Hardware layer */
     if (((USBD_AUDIO_ItfTypeDef *)pdev->pUserData)->Init(USBD_AUDIO_FREQ,
@@ -378,8 +399,13 @@ static uint8_t  USBD_AUDIO_Init (USBD_HandleTypeDef *pdev, uint8_t cfgidx)
     }
 
     /* Prepare Out endpoint to receive 1st packet */
+#if (USBD_AUDIO_FEEDBACK == 1U)
+    USBD_LL_PrepareReceive(pdev, AUDIO_OUT_EP, haudio->packet,
+                           AUDIO_OUT_MAX_PACKET);
+#else
     USBD_LL_PrepareReceive(pdev, AUDIO_OUT_EP, haudio->buffer,
                            AUDIO_OUT_PACKET);
+#endif /* USBD_AUDIO_FEEDBACK */
   }
   return USBD_OK;
 }
@@ -399,11 +425,19 @@ static uint8_t  USBD_AUDIO_DeInit (USBD_HandleTypeDef *pdev,
   USBD_LL_CloseEP(pdev, AUDIO_OUT_EP);
   pdev->ep_out[AUDIO_OUT_EP & 0xFU].is_used = 0U;
 
+#if (USBD_AUDIO_FEEDBACK == 1U)
+  /* Close feedback EP IN */
+  USBD_LL_CloseEP(pdev, AUDIO_FB_EP);
+  pdev->ep_in[AUDIO_FB_EP & 0xFU].is_used = 0U;
+#endif /* USBD_AUDIO_FEEDBACK */
+
   /* DeInit  physical Interface components */
   if(pdev->pClassData != NULL)
   {
    ((USBD_AUDIO_ItfTypeDef *)pdev->pUserData)->DeInit(0U);
+#if (USBD_STATIC_CLASS_DATA == 0U)
     USBD_free(pdev->pClassData);
+#endif /* USBD_STATIC_CLASS_DATA */
     pdev->pClassData = NULL;
   }
 
@@ -491,6 +525,19 @@ static uint8_t  USBD_AUDIO_Setup (USBD_HandleTypeDef *pdev,
          if ((uint8_t)(req->wValue) <= USBD_MAX_NUM_INTERFACES)
          {
            haudio->alt_setting = (uint8_t)(req->wValue);
+#if (USBD_AUDIO_FEEDBACK == 1U)
+           if (haudio->alt_setting == 1U)
+           {
+             /* Streaming (re)starts: report the current rate right away */
+             haudio->fb_sof_count = 0U;
+             AUDIO_FB_Send(pdev, haudio);
+           }
+           else
+           {
+             USBD_LL_FlushEP(pdev, AUDIO_FB_EP);
+             haudio->fb_busy = 0U;
+           }
+#endif /* USBD_AUDIO_FEEDBACK */
          }
          else
          {
@@ -545,6 +592,16 @@ static uint8_t  *USBD_AUDIO_GetCfgDesc (uint16_t *length)
 static uint8_t  USBD_AUDIO_DataIn (USBD_HandleTypeDef *pdev,
                               uint8_t epnum)
 {
+#if (USBD_AUDIO_FEEDBACK == 1U)
+  USBD_AUDIO_HandleTypeDef   *haudio;
+  haudio = (USBD_AUDIO_HandleTypeDef*) pdev->pClassData;
+
+  if (epnum == (AUDIO_FB_EP & 0x7FU))
+  {
+    /* Feedback value read by the host */
+    haudio->fb_busy = 0U;
+  }
+#endif /* USBD_AUDIO_FEEDBACK */
 
   /* Only OUT data are processed */
   return USBD_OK;
@@ -593,6 +650,23 @@ static uint8_t  USBD_AUDIO_EP0_TxReady (USBD_HandleTypeDef *pdev)
   */
 static uint8_t  USBD_AUDIO_SOF (USBD_HandleTypeDef *pdev)
 {
+#if (USBD_AUDIO_FEEDBACK == 1U)
+  USBD_AUDIO_HandleTypeDef   *haudio;
+  haudio = (USBD_AUDIO_HandleTypeDef*) pdev->pClassData;
+
+  if ((haudio != NULL) && (haudio->alt_setting == 1U))
+  {
+    haudio->fb_sof_count++;
+
+    /* Refresh the feedback once per host polling period */
+    if (haudio->fb_sof_count >= (1U << AUDIO_FB_REFRESH))
+    {
+      haudio->fb_sof_count = 0U;
+      AUDIO_FB_Send(pdev, haudio);
+    }
+  }
+#endif /* USBD_AUDIO_FEEDBACK */
+
   return USBD_OK;
 }
 
@@ -610,6 +684,25 @@ void  USBD_AUDIO_Sync (USBD_HandleTypeDef *pdev, AUDIO_OffsetTypeDef offset)
 
   haudio->offset =  offset;
 
+#if (USBD_AUDIO_FEEDBACK == 1U)
+  /* The codec DMA just crossed the middle or the end of the ring: no pointer
+     is moved here, the drift is corrected by the host through the feedback */
+  if (offset == AUDIO_OFFSET_HALF)
+  {
+    haudio->rd_ptr = (uint16_t)(AUDIO_TOTAL_BUF_SIZE / 2U);
+  }
+  else
+  {
+    haudio->rd_ptr = 0U;
+  }
+
+  if(haudio->rd_enable == 1U)
+  {
+    AUDIO_FB_Update(haudio);
+  }
+
+  cmd = AUDIO_TOTAL_BUF_SIZE / 2U;
+#else
   if(haudio->rd_enable == 1U)
   {
     haudio->rd_ptr += (uint16_t)(AUDIO_TOTAL_BUF_SIZE / 2U);
@@ -649,6 +742,7 @@ void  USBD_AUDIO_Sync (USBD_HandleTypeDef *pdev, AUDIO_OffsetTypeDef offset)
       }
     }
   }
+#endif /* USBD_AUDIO_FEEDBACK */
 
   if(haudio->offset == AUDIO_OFFSET_FULL)
   {
@@ -698,6 +792,25 @@ static uint8_t  USBD_AUDIO_DataOut (USBD_HandleTypeDef *pdev,
 
   if (epnum == AUDIO_OUT_EP)
   {
+#if (USBD_AUDIO_FEEDBACK == 1U)
+    /* Packet size follows the feedback: append it to the ring */
+    AUDIO_RingWrite(haudio, USBD_LL_GetRxDataSize(pdev, epnum));
+
+    if ((haudio->rd_enable == 0U) &&
+        (haudio->wr_ptr >= (AUDIO_TOTAL_BUF_SIZE / 2U)))
+    {
+      /* Half of the ring is primed: start playback on the fill level target */
+      haudio->rd_enable = 1U;
+      ((USBD_AUDIO_ItfTypeDef *)pdev->pUserData)->AudioCmd(&haudio->buffer[0],
+                                                           AUDIO_TOTAL_BUF_SIZE / 2U,
+                                                           AUDIO_CMD_START);
+      haudio->offset = AUDIO_OFFSET_NONE;
+    }
+
+    /* Prepare Out endpoint to receive next audio packet */
+    USBD_LL_PrepareReceive(pdev, AUDIO_OUT_EP, haudio->packet,
+                           AUDIO_OUT_MAX_PACKET);
+#else
     /* Increment the Buffer pointer or roll it back when all buffers are full */
 
     haudio->wr_ptr += AUDIO_OUT_PACKET;
@@ -727,6 +840,7 @@ static uint8_t  USBD_AUDIO_DataOut (USBD_HandleTypeDef *pdev,
     /* Prepare Out endpoint to receive next audio packet */
     USBD_LL_PrepareReceive(pdev, AUDIO_OUT_EP, &haudio->buffer[haudio->wr_ptr],
                            AUDIO_OUT_PACKET);
+#endif /* USBD_AUDIO_FEEDBACK */
   }
 
   return USBD_OK;
@@ -775,6 +889,102 @@ static void AUDIO_REQ_SetCurrent(USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef
   }
 }
 
+#if (USBD_AUDIO_FEEDBACK == 1U)
+/**
+  * @brief  AUDIO_RingWrite
+  *         Append the last received packet to the audio ring
+  * @param  haudio: audio class handle
+  * @param  len: received packet length
+  * @retval None
+  */
+static void AUDIO_RingWrite(USBD_AUDIO_HandleTypeDef *haudio, uint32_t len)
+{
+  uint32_t first;
+
+  /* Whole stereo samples only */
+  len = MIN(len, AUDIO_OUT_MAX_PACKET) & ~3U;
+  first = MIN(len, (uint32_t)AUDIO_TOTAL_BUF_SIZE - haudio->wr_ptr);
+
+  (void)memcpy(&haudio->buffer[haudio->wr_ptr], haudio->packet, first);
+  (void)memcpy(&haudio->buffer[0], &haudio->packet[first], len - first);
+
+  if ((haudio->wr_ptr + len) >= AUDIO_TOTAL_BUF_SIZE)
+  {
+    haudio->wr_ptr = (uint16_t)(haudio->wr_ptr + len - AUDIO_TOTAL_BUF_SIZE);
+  }
+  else
+  {
+    haudio->wr_ptr = (uint16_t)(haudio->wr_ptr + len);
+  }
+}
+
+/**
+  * @brief  AUDIO_FB_Update
+  *         PI control of the feedback value from the ring fill level,
+  *         the target being half of the ring
+  * @param  haudio: audio class handle
+  * @retval None
+  */
+static void AUDIO_FB_Update(USBD_AUDIO_HandleTypeDef *haudio)
+{
+  int32_t level;
+  int32_t error;
+  int32_t fb;
+  int32_t max_integral = (int32_t)AUDIO_FB_MAX_DEVIATION / AUDIO_FB_KI;
+
+  level = (int32_t)haudio->wr_ptr - (int32_t)haudio->rd_ptr;
+  if (level < 0)
+  {
+    level += (int32_t)AUDIO_TOTAL_BUF_SIZE;
+  }
+
+  /* Fill level error in stereo samples: positive when the host is ahead */
+  error = (level - (int32_t)(AUDIO_TOTAL_BUF_SIZE / 2U)) / 4;
+
+  haudio->fb_integral += error;
+  if (haudio->fb_integral > max_integral)
+  {
+    haudio->fb_integral = max_integral;
+  }
+  else if (haudio->fb_integral < -max_integral)
+  {
+    haudio->fb_integral = -max_integral;
+  }
+
+  fb = (int32_t)AUDIO_FB_NOMINAL - (AUDIO_FB_KP * error) -
+       (AUDIO_FB_KI * haudio->fb_integral);
+
+  fb = MAX(fb, (int32_t)(AUDIO_FB_NOMINAL - AUDIO_FB_MAX_DEVIATION));
+  fb = MIN(fb, (int32_t)(AUDIO_FB_NOMINAL + AUDIO_FB_MAX_DEVIATION));
+
+  haudio->fb_value = (uint32_t)fb;
+}
+
+/**
+  * @brief  AUDIO_FB_Send
+  *         Queue the current feedback value on the feedback endpoint
+  * @param  pdev: device instance
+  * @param  haudio: audio class handle
+  * @retval None
+  */
+static void AUDIO_FB_Send(USBD_HandleTypeDef *pdev, USBD_AUDIO_HandleTypeDef *haudio)
+{
+  uint32_t fb = haudio->fb_value;
+
+  if (haudio->fb_busy != 0U)
+  {
+    /* Previous value was never polled by the host */
+    USBD_LL_FlushEP(pdev, AUDIO_FB_EP);
+  }
+
+  haudio->fb_buf[0] = (uint8_t)(fb);
+  haudio->fb_buf[1] = (uint8_t)(fb >> 8);
+  haudio->fb_buf[2] = (uint8_t)(fb >> 16);
+  haudio->fb_busy = 1U;
+
+  USBD_LL_Transmit(pdev, AUDIO_FB_EP, haudio->fb_buf, AUDIO_FB_PACKET);
+}
+#endif /* USBD_AUDIO_FEEDBACK */
 
 /**
 * @brief  DeviceQualifierDescriptor
@@ -54,11 +54,20 @@
 #endif /* CDC_FS_BINTERVAL */
 
 /* CDC Endpoints parameters: you can fine tune these values depending on the needed baudrates and performance. */
+#ifndef CDC_DATA_HS_MAX_PACKET_SIZE
 #define CDC_DATA_HS_MAX_PACKET_SIZE                 512U  /* Endpoint IN & OUT Packet size */
+#endif /* CDC_DATA_HS_MAX_PACKET_SIZE */
+#ifndef CDC_DATA_FS_MAX_PACKET_SIZE
 #define CDC_DATA_FS_MAX_PACKET_SIZE                 64U  /* Endpoint IN & OUT Packet size */
+#endif /* CDC_DATA_FS_MAX_PACKET_SIZE */
+#ifndef CDC_CMD_PACKET_SIZE
 #define CDC_CMD_PACKET_SIZE                         8U  /* Control Endpoint Packet size */
+#endif /* CDC_CMD_PACKET_SIZE */
 
-#define USB_CDC_CONFIG_DESC_SIZ                     67U
+/* Header, call management, ACM and union functional descriptors */
+#define CDC_FUNC_DESC_SIZ                           19U
+#define USB_CDC_CONFIG_DESC_SIZ                     (USB_LEN_CFG_DESC + (2U * USB_LEN_IF_DESC) + \
+                                                     CDC_FUNC_DESC_SIZ + (3U * USB_LEN_EP_DESC))
 #define CDC_DATA_HS_IN_PACKET_SIZE                  CDC_DATA_HS_MAX_PACKET_SIZE
 #define CDC_DATA_HS_OUT_PACKET_SIZE                 CDC_DATA_HS_MAX_PACKET_SIZE
 
@@ -123,6 +132,15 @@ typedef struct
 }
 USBD_CDC_HandleTypeDef;
 
+/* RAM needed by the class data of one configuration, in bytes */
+#define USBD_CDC_CLASS_DATA_SIZE            (sizeof(USBD_CDC_HandleTypeDef))
+
+/* RAM needed by one configuration of the class, in bytes: the class data and
+   the HS, FS and other speed descriptors. The reception and transmission
+   buffers given with USBD_CDC_SetRxBuffer/USBD_CDC_SetTxBuffer come on top */
+#define USBD_CDC_CONFIG_RAM_SIZE            (USBD_CDC_CLASS_DATA_SIZE + (3U * USB_CDC_CONFIG_DESC_SIZ) + \
+                                             USB_LEN_DEV_QUALIFIER_DESC)
+
 
 
 /** @defgroup USBD_CORE_Exported_Macros
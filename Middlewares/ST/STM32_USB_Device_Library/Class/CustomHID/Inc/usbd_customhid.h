@@ -41,23 +41,60 @@
 /** @defgroup USBD_CUSTOM_HID_Exported_Defines
   * @{
   */
+/* Stream transport: the application writes and reads byte streams, packed
+   into full reports. Each report carries its payload length in byte 0.
+   OUT reports are then signalled by the StreamEvent callback instead of
+   OutEvent, which is left to the reports received by SET_REPORT */
+#ifndef USBD_CUSTOMHID_STREAM
+  #define USBD_CUSTOMHID_STREAM              0U
+#endif /* USBD_CUSTOMHID_STREAM */
+
 #define CUSTOM_HID_EPIN_ADDR                 0x81U
-#define CUSTOM_HID_EPIN_SIZE                 0x02U
+#ifndef CUSTOM_HID_EPIN_SIZE
+#if (USBD_CUSTOMHID_STREAM == 1U)
+  #define CUSTOM_HID_EPIN_SIZE               0x40U
+#else
+  #define CUSTOM_HID_EPIN_SIZE               0x02U
+#endif /* USBD_CUSTOMHID_STREAM */
+#endif /* CUSTOM_HID_EPIN_SIZE */
 
 #define CUSTOM_HID_EPOUT_ADDR                0x01U
-#define CUSTOM_HID_EPOUT_SIZE                0x02U
-
-#define USB_CUSTOM_HID_CONFIG_DESC_SIZ       41U
+#ifndef CUSTOM_HID_EPOUT_SIZE
+#if (USBD_CUSTOMHID_STREAM == 1U)
+  #define CUSTOM_HID_EPOUT_SIZE              0x40U
+#else
+  #define CUSTOM_HID_EPOUT_SIZE              0x02U
+#endif /* USBD_CUSTOMHID_STREAM */
+#endif /* CUSTOM_HID_EPOUT_SIZE */
+
+#define USB_CUSTOM_HID_CONFIG_DESC_SIZ       (USB_LEN_CFG_DESC + USB_LEN_IF_DESC + USB_CUSTOM_HID_DESC_SIZ + \
+                                              (2U * USB_LEN_EP_DESC))
 #define USB_CUSTOM_HID_DESC_SIZ              9U
 
 #ifndef CUSTOM_HID_HS_BINTERVAL
+#if (USBD_CUSTOMHID_STREAM == 1U)
+  #define CUSTOM_HID_HS_BINTERVAL            0x04U
+#else
   #define CUSTOM_HID_HS_BINTERVAL            0x05U
+#endif /* USBD_CUSTOMHID_STREAM */
 #endif /* CUSTOM_HID_HS_BINTERVAL */
 
 #ifndef CUSTOM_HID_FS_BINTERVAL
+#if (USBD_CUSTOMHID_STREAM == 1U)
+  #define CUSTOM_HID_FS_BINTERVAL            0x01U
+#else
   #define CUSTOM_HID_FS_BINTERVAL            0x05U
+#endif /* USBD_CUSTOMHID_STREAM */
 #endif /* CUSTOM_HID_FS_BINTERVAL */
 
+/* Stream transport queues: IN bytes and OUT reports, both powers of two */
+#ifndef USBD_CUSTOMHID_TX_QUEUE_SIZE
+  #define USBD_CUSTOMHID_TX_QUEUE_SIZE       512U
+#endif /* USBD_CUSTOMHID_TX_QUEUE_SIZE */
+#ifndef USBD_CUSTOMHID_RX_QUEUE_LEN
+  #define USBD_CUSTOMHID_RX_QUEUE_LEN        4U
+#endif /* USBD_CUSTOMHID_RX_QUEUE_LEN */
+
 #ifndef USBD_CUSTOMHID_OUTREPORT_BUF_SIZE
   #define USBD_CUSTOMHID_OUTREPORT_BUF_SIZE  0x02U
 #endif /* USBD_CUSTOMHID_OUTREPORT_BUF_SIZE */
@@ -97,6 +134,12 @@ typedef struct _USBD_CUSTOM_HID_Itf
   int8_t (* Init)          (void);
   int8_t (* DeInit)        (void);
   int8_t (* OutEvent)      (uint8_t event_idx, uint8_t state);
+#if (USBD_CUSTOMHID_STREAM == 1U)
+  /* Optional (NULL when the application polls USBD_CUSTOM_HID_Read): called
+     from the USB interrupt when an OUT report is queued, len being its
+     payload length */
+  int8_t (* StreamEvent)   (uint16_t len);
+#endif /* USBD_CUSTOMHID_STREAM */
 
 }USBD_CUSTOM_HID_ItfTypeDef;
 
@@ -108,8 +151,29 @@ typedef struct
   uint32_t             AltSetting;
   uint32_t             IsReportAvailable;
   CUSTOM_HID_StateTypeDef     state;
+#if (USBD_CUSTOMHID_STREAM == 1U)
+  uint8_t              tx_queue[USBD_CUSTOMHID_TX_QUEUE_SIZE];
+  uint8_t              tx_report[CUSTOM_HID_EPIN_SIZE];
+  uint8_t              rx_queue[USBD_CUSTOMHID_RX_QUEUE_LEN][CUSTOM_HID_EPOUT_SIZE];
+  __IO uint16_t        tx_head;
+  __IO uint16_t        tx_tail;
+  __IO uint8_t         rx_head;
+  __IO uint8_t         rx_tail;
+  __IO uint8_t         rx_stalled;
+#endif /* USBD_CUSTOMHID_STREAM */
 }
 USBD_CUSTOM_HID_HandleTypeDef;
+
+/* RAM needed by the class data of one configuration, in bytes */
+#define USBD_CUSTOM_HID_CLASS_DATA_SIZE     (sizeof(USBD_CUSTOM_HID_HandleTypeDef))
+
+/* RAM needed by one configuration of the class, in bytes: the class data,
+   which holds the stream queues, the HS, FS and other speed descriptors and
+   the report descriptor of the interface */
+#define USBD_CUSTOM_HID_CONFIG_RAM_SIZE     (USBD_CUSTOM_HID_CLASS_DATA_SIZE + (3U * USB_CUSTOM_HID_CONFIG_DESC_SIZ) + \
+                                             USB_CUSTOM_HID_DESC_SIZ + USB_LEN_DEV_QUALIFIER_DESC + \
+                                             USBD_CUSTOM_HID_REPORT_DESC_SIZE)
+
 /**
   * @}
   */
@@ -141,6 +205,16 @@ uint8_t USBD_CUSTOM_HID_SendReport (USBD_HandleTypeDef *pdev,
                                  uint8_t *report,
                                  uint16_t len);
 
+#if (USBD_CUSTOMHID_STREAM == 1U)
+uint16_t USBD_CUSTOM_HID_Write (USBD_HandleTypeDef *pdev,
+                                const uint8_t *buf,
+                                uint16_t len);
+
+uint16_t USBD_CUSTOM_HID_Read (USBD_HandleTypeDef *pdev,
+                               uint8_t *buf,
+                               uint16_t len);
+#endif /* USBD_CUSTOMHID_STREAM */
+
 
 
 uint8_t  USBD_CUSTOM_HID_RegisterInterface  (USBD_HandleTypeDef   *pdev,
@@ -17,6 +17,15 @@
   *             - Usage : Vendor
   *             - Collection : Application
   *
+  *           With USBD_CUSTOMHID_STREAM the class also provides a byte stream
+  *           transport (USBD_CUSTOM_HID_Write/USBD_CUSTOM_HID_Read): bytes written
+  *           while a report is in flight are coalesced into the next report, and
+  *           OUT reports are queued until read and signalled by the StreamEvent
+  *           callback (not OutEvent). Each report carries its payload length in
+  *           byte 0, the report descriptor of the application must declare
+  *           CUSTOM_HID_EPIN_SIZE/CUSTOM_HID_EPOUT_SIZE byte reports without
+  *           report ID.
+  *
   * @note     In HS mode and when the DMA is used, all variables and data structures
   *           dealing with the DMA during the transaction process should be 32-bit aligned.
   *
@@ -77,6 +86,28 @@
 /** @defgroup USBD_CUSTOM_HID_Private_Macros
   * @{
   */
+/* HID class descriptor: HID 1.11, not localized, one report descriptor */
+#define USBD_CUSTOM_HID_CLASS_DESC                                            \
+  USB_CUSTOM_HID_DESC_SIZ, CUSTOM_HID_DESCRIPTOR_TYPE, 0x11U, 0x01U, 0x00U,   \
+  0x01U, CUSTOM_HID_REPORT_DESC, LOBYTE(USBD_CUSTOM_HID_REPORT_DESC_SIZE),    \
+  HIBYTE(USBD_CUSTOM_HID_REPORT_DESC_SIZE)
+
+/* Configuration descriptor shared by the HS, FS and other speed variants:
+   only the polling interval of the endpoints differs */
+#define USBD_CUSTOM_HID_CFG_DESC(interval)                                    \
+  /* Configuration: 1 interface, bus powered, 100 mA */                       \
+  USBD_CONFIG_DESC(USB_DESC_TYPE_CONFIGURATION,                               \
+                   USB_CUSTOM_HID_CONFIG_DESC_SIZ, 0x01U, 0x01U, 0x00U,       \
+                   0xC0U, 0x32U),                                             \
+  /* CUSTOM HID interface: HID, no boot subclass, no protocol */              \
+  USBD_INTERFACE_DESC(0x00U, 0x00U, 0x02U, 0x03U, 0x00U, 0x00U, 0x00U),       \
+  /* CUSTOM HID descriptor */                                                 \
+  USBD_CUSTOM_HID_CLASS_DESC,                                                 \
+  /* Custom HID endpoints */                                                  \
+  USBD_ENDPOINT_DESC(CUSTOM_HID_EPIN_ADDR, USBD_EP_TYPE_INTR,                 \
+                     CUSTOM_HID_EPIN_SIZE, (interval)),                       \
+  USBD_ENDPOINT_DESC(CUSTOM_HID_EPOUT_ADDR, USBD_EP_TYPE_INTR,                \
+                     CUSTOM_HID_EPOUT_SIZE, (interval))
 /**
   * @}
   */
@@ -106,6 +137,10 @@ static uint8_t  USBD_CUSTOM_HID_DataIn (USBD_HandleTypeDef *pdev, uint8_t epnum)
 
 static uint8_t  USBD_CUSTOM_HID_DataOut (USBD_HandleTypeDef *pdev, uint8_t epnum);
 static uint8_t  USBD_CUSTOM_HID_EP0_RxReady (USBD_HandleTypeDef  *pdev);
+
+#if (USBD_CUSTOMHID_STREAM == 1U)
+static void     USBD_CUSTOM_HID_SendNext (USBD_HandleTypeDef *pdev);
+#endif /* USBD_CUSTOMHID_STREAM */
 /**
   * @}
   */
@@ -114,6 +149,12 @@ static uint8_t  USBD_CUSTOM_HID_EP0_RxReady (USBD_HandleTypeDef  *pdev);
   * @{
   */
 
+#if (USBD_STATIC_CLASS_DATA == 1U)
+/* Custom HID class data arenas, one per device instance (pdev->id), used instead of
+   USBD_malloc */
+static USBD_CUSTOM_HID_HandleTypeDef USBD_CUSTOM_HID_ClassData[USBD_MAX_NUM_INSTANCES];
+#endif /* USBD_STATIC_CLASS_DATA */
+
 USBD_ClassTypeDef  USBD_CUSTOM_HID =
 {
   USBD_CUSTOM_HID_Init,
@@ -133,195 +174,27 @@ USBD_ClassTypeDef  USBD_CUSTOM_HID =
 };
 
 /* USB CUSTOM_HID device FS Configuration Descriptor */
-__ALIGN_BEGIN static uint8_t USBD_CUSTOM_HID_CfgFSDesc[USB_CUSTOM_HID_CONFIG_DESC_SIZ] __ALIGN_END =
+__ALIGN_BEGIN static uint8_t USBD_CUSTOM_HID_CfgFSDesc[] __ALIGN_END =
 {
-  0x09, /* bLength: Configuration Descriptor size */
-  USB_DESC_TYPE_CONFIGURATION, /* bDescriptorType: Configuration */
-  USB_CUSTOM_HID_CONFIG_DESC_SIZ,
-  /* wTotalLength: Bytes returned */
-  0x00,
-  0x01,         /*bNumInterfaces: 1 interface*/
-  0x01,         /*bConfigurationValue: Configuration value*/
-  0x00,         /*iConfiguration: Index of string descriptor describing
-  the configuration*/
-  0xC0,         /*bmAttributes: bus powered */
-  0x32,         /*MaxPower 100 mA: this current is used for detecting Vbus*/
-
-  /************** Descriptor of CUSTOM HID interface ****************/
-  /* 09 */
-  0x09,         /*bLength: Interface Descriptor size*/
-  USB_DESC_TYPE_INTERFACE,/*bDescriptorType: Interface descriptor type*/
-  0x00,         /*bInterfaceNumber: Number of Interface*/
-  0x00,         /*bAlternateSetting: Alternate setting*/
-  0x02,         /*bNumEndpoints*/
-  0x03,         /*bInterfaceClass: CUSTOM_HID*/
-  0x00,         /*bInterfaceSubClass : 1=BOOT, 0=no boot*/
-  0x00,         /*nInterfaceProtocol : 0=none, 1=keyboard, 2=mouse*/
-  0,            /*iInterface: Index of string descriptor*/
-  /******************** Descriptor of CUSTOM_HID *************************/
-  /* 18 */
-  0x09,         /*bLength: CUSTOM_HID Descriptor size*/
-  CUSTOM_HID_DESCRIPTOR_TYPE, /*bDescriptorType: CUSTOM_HID*/
-  0x11,         /*bCUSTOM_HIDUSTOM_HID: CUSTOM_HID Class Spec release number*/
-  0x01,
-  0x00,         /*bCountryCode: Hardware target country*/
-  0x01,         /*bNumDescriptors: Number of CUSTOM_HID class descriptors to follow*/
-  0x22,         /*bDescriptorType*/
-  USBD_CUSTOM_HID_REPORT_DESC_SIZE,/*wItemLength: Total length of Report descriptor*/
-  0x00,
-  /******************** Descriptor of Custom HID endpoints ********************/
-  /* 27 */
-  0x07,          /*bLength: Endpoint Descriptor size*/
-  USB_DESC_TYPE_ENDPOINT, /*bDescriptorType:*/
-
-  CUSTOM_HID_EPIN_ADDR,     /*bEndpointAddress: Endpoint Address (IN)*/
-  0x03,          /*bmAttributes: Interrupt endpoint*/
-  CUSTOM_HID_EPIN_SIZE, /*wMaxPacketSize: 2 Byte max */
-  0x00,
-  CUSTOM_HID_FS_BINTERVAL,          /*bInterval: Polling Interval */
-  /* 34 */
-
-  0x07,	         /* bLength: Endpoint Descriptor size */
-  USB_DESC_TYPE_ENDPOINT,	/* bDescriptorType: */
-  CUSTOM_HID_EPOUT_ADDR,  /*bEndpointAddress: Endpoint Address (OUT)*/
-  0x03,	/* bmAttributes: Interrupt endpoint */
-  CUSTOM_HID_EPOUT_SIZE,	/* wMaxPacketSize: 2 Bytes max  */
-  0x00,
-  CUSTOM_HID_FS_BINTERVAL,	/* bInterval: Polling Interval */
-  /* 41 */
+  USBD_CUSTOM_HID_CFG_DESC(CUSTOM_HID_FS_BINTERVAL)
 };
 
 /* USB CUSTOM_HID device HS Configuration Descriptor */
-__ALIGN_BEGIN static uint8_t USBD_CUSTOM_HID_CfgHSDesc[USB_CUSTOM_HID_CONFIG_DESC_SIZ] __ALIGN_END =
+__ALIGN_BEGIN static uint8_t USBD_CUSTOM_HID_CfgHSDesc[] __ALIGN_END =
 {
-  0x09, /* bLength: Configuration Descriptor size */
-  USB_DESC_TYPE_CONFIGURATION, /* bDescriptorType: Configuration */
-  USB_CUSTOM_HID_CONFIG_DESC_SIZ,
-  /* wTotalLength: Bytes returned */
-  0x00,
-  0x01,         /*bNumInterfaces: 1 interface*/
-  0x01,         /*bConfigurationValue: Configuration value*/
-  0x00,         /*iConfiguration: Index of string descriptor describing
-  the configuration*/
-  0xC0,         /*bmAttributes: bus powered */
-  0x32,         /*MaxPower 100 mA: this current is used for detecting Vbus*/
-
-  /************** Descriptor of CUSTOM HID interface ****************/
-  /* 09 */
-  0x09,         /*bLength: Interface Descriptor size*/
-  USB_DESC_TYPE_INTERFACE,/*bDescriptorType: Interface descriptor type*/
-  0x00,         /*bInterfaceNumber: Number of Interface*/
-  0x00,         /*bAlternateSetting: Alternate setting*/
-  0x02,         /*bNumEndpoints*/
-  0x03,         /*bInterfaceClass: CUSTOM_HID*/
-  0x00,         /*bInterfaceSubClass : 1=BOOT, 0=no boot*/
-  0x00,         /*nInterfaceProtocol : 0=none, 1=keyboard, 2=mouse*/
-  0,            /*iInterface: Index of string descriptor*/
-  /******************** Descriptor of CUSTOM_HID *************************/
-  /* 18 */
-  0x09,         /*bLength: CUSTOM_HID Descriptor size*/
-  CUSTOM_HID_DESCRIPTOR_TYPE, /*bDescriptorType: CUSTOM_HID*/
-  0x11,         /*bCUSTOM_HIDUSTOM_HID: CUSTOM_HID Class Spec release number*/
-  0x01,
-  0x00,         /*bCountryCode: Hardware target country*/
-  0x01,         /*bNumDescriptors: Number of CUSTOM_HID class descriptors to follow*/
-  0x22,         /*bDescriptorType*/
-  USBD_CUSTOM_HID_REPORT_DESC_SIZE,/*wItemLength: Total length of Report descriptor*/
-  0x00,
-  /******************** Descriptor of Custom HID endpoints ********************/
-  /* 27 */
-  0x07,          /*bLength: Endpoint Descriptor size*/
-  USB_DESC_TYPE_ENDPOINT, /*bDescriptorType:*/
-
-  CUSTOM_HID_EPIN_ADDR,     /*bEndpointAddress: Endpoint Address (IN)*/
-  0x03,          /*bmAttributes: Interrupt endpoint*/
-  CUSTOM_HID_EPIN_SIZE, /*wMaxPacketSize: 2 Byte max */
-  0x00,
-  CUSTOM_HID_HS_BINTERVAL,          /*bInterval: Polling Interval */
-  /* 34 */
-
-  0x07,	         /* bLength: Endpoint Descriptor size */
-  USB_DESC_TYPE_ENDPOINT,	/* bDescriptorType: */
-  CUSTOM_HID_EPOUT_ADDR,  /*bEndpointAddress: Endpoint Address (OUT)*/
-  0x03,	/* bmAttributes: Interrupt endpoint */
-  CUSTOM_HID_EPOUT_SIZE,	/* wMaxPacketSize: 2 Bytes max  */
-  0x00,
-  CUSTOM_HID_HS_BINTERVAL,	/* bInterval: Polling Interval */
-  /* 41 */
+  USBD_CUSTOM_HID_CFG_DESC(CUSTOM_HID_HS_BINTERVAL)
 };
 
 /* USB CUSTOM_HID device Other Speed Configuration Descriptor */
-__ALIGN_BEGIN static uint8_t USBD_CUSTOM_HID_OtherSpeedCfgDesc[USB_CUSTOM_HID_CONFIG_DESC_SIZ] __ALIGN_END =
+__ALIGN_BEGIN static uint8_t USBD_CUSTOM_HID_OtherSpeedCfgDesc[] __ALIGN_END =
 {
-  0x09, /* bLength: Configuration Descriptor size */
-  USB_DESC_TYPE_CONFIGURATION, /* bDescriptorType: Configuration */
-  USB_CUSTOM_HID_CONFIG_DESC_SIZ,
-  /* wTotalLength: Bytes returned */
-  0x00,
-  0x01,         /*bNumInterfaces: 1 interface*/
-  0x01,         /*bConfigurationValue: Configuration value*/
-  0x00,         /*iConfiguration: Index of string descriptor describing
-  the configuration*/
-  0xC0,         /*bmAttributes: bus powered */
-  0x32,         /*MaxPower 100 mA: this current is used for detecting Vbus*/
-
-  /************** Descriptor of CUSTOM HID interface ****************/
-  /* 09 */
-  0x09,         /*bLength: Interface Descriptor size*/
-  USB_DESC_TYPE_INTERFACE,/*bDescriptorType: Interface descriptor type*/
-  0x00,         /*bInterfaceNumber: Number of Interface*/
-  0x00,         /*bAlternateSetting: Alternate setting*/
-  0x02,         /*bNumEndpoints*/
-  0x03,         /*bInterfaceClass: CUSTOM_HID*/
-  0x00,         /*bInterfaceSubClass : 1=BOOT, 0=no boot*/
-  0x00,         /*nInterfaceProtocol : 0=none, 1=keyboard, 2=mouse*/
-  0,            /*iInterface: Index of string descriptor*/
-  /******************** Descriptor of CUSTOM_HID *************************/
-  /* 18 */
-  0x09,         /*bLength: CUSTOM_HID Descriptor size*/
-  CUSTOM_HID_DESCRIPTOR_TYPE, /*bDescriptorType: CUSTOM_HID*/
-  0x11,         /*bCUSTOM_HIDUSTOM_HID: CUSTOM_HID Class Spec release number*/
-  0x01,
-  0x00,         /*bCountryCode: Hardware target country*/
-  0x01,         /*bNumDescriptors: Number of CUSTOM_HID class descriptors to follow*/
-  0x22,         /*bDescriptorType*/
-  USBD_CUSTOM_HID_REPORT_DESC_SIZE,/*wItemLength: Total length of Report descriptor*/
-  0x00,
-  /******************** Descriptor of Custom HID endpoints ********************/
-  /* 27 */
-  0x07,          /*bLength: Endpoint Descriptor size*/
-  USB_DESC_TYPE_ENDPOINT, /*bDescriptorType:*/
-
-  CUSTOM_HID_EPIN_ADDR,     /*bEndpointAddress: Endpoint Address (IN)*/
-  0x03,          /*bmAttributes: Interrupt endpoint*/
-  CUSTOM_HID_EPIN_SIZE, /*wMaxPacketSize: 2 Byte max */
-  0x00,
-  CUSTOM_HID_FS_BINTERVAL,          /*bInterval: Polling Interval */
-  /* 34 */
-
-  0x07,	         /* bLength: Endpoint Descriptor size */
-  USB_DESC_TYPE_ENDPOINT,	/* bDescriptorType: */
-  CUSTOM_HID_EPOUT_ADDR,  /*bEndpointAddress: Endpoint Address (OUT)*/
-  0x03,	/* bmAttributes: Interrupt endpoint */
-  CUSTOM_HID_EPOUT_SIZE,	/* wMaxPacketSize: 2 Bytes max  */
-  0x00,
-  CUSTOM_HID_FS_BINTERVAL,	/* bInterval: Polling Interval */
-  /* 41 */
+  USBD_CUSTOM_HID_CFG_DESC(CUSTOM_HID_FS_BINTERVAL)
 };
 
 /* USB CUSTOM_HID device Configuration Descriptor */
-__ALIGN_BEGIN static uint8_t USBD_CUSTOM_HID_Desc[USB_CUSTOM_HID_DESC_SIZ] __ALIGN_END =
+__ALIGN_BEGIN static uint8_t USBD_CUSTOM_HID_Desc[] __ALIGN_END =
 {
-  /* 18 */
-  0x09,         /*bLength: CUSTOM_HID Descriptor size*/
-  CUSTOM_HID_DESCRIPTOR_TYPE, /*bDescriptorType: CUSTOM_HID*/
-  0x11,         /*bCUSTOM_HIDUSTOM_HID: CUSTOM_HID Class Spec release number*/
-  0x01,
-  0x00,         /*bCountryCode: Hardware target country*/
-  0x01,         /*bNumDescriptors: Number of CUSTOM_HID class descriptors to follow*/
-  0x22,         /*bDescriptorType*/
-  USBD_CUSTOM_HID_REPORT_DESC_SIZE,/*wItemLength: Total length of Report descriptor*/
-  0x00,
+  USBD_CUSTOM_HID_CLASS_DESC
 };
 
 /* USB Standard Device Descriptor */
@@ -339,6 +212,35 @@ __ALIGN_BEGIN static uint8_t USBD_CUSTOM_HID_DeviceQualifierDesc[USB_LEN_DEV_QUA
   0x00,
 };
 
+/* Enumeration breaks silently on a wrong wTotalLength: reject it at build
+   time */
+USBD_STATIC_ASSERT(sizeof(USBD_CUSTOM_HID_CfgFSDesc) == USB_CUSTOM_HID_CONFIG_DESC_SIZ, CUSTOM_HID_CfgFSDesc);
+USBD_STATIC_ASSERT(sizeof(USBD_CUSTOM_HID_CfgHSDesc) == USB_CUSTOM_HID_CONFIG_DESC_SIZ, CUSTOM_HID_CfgHSDesc);
+USBD_STATIC_ASSERT(sizeof(USBD_CUSTOM_HID_OtherSpeedCfgDesc) == USB_CUSTOM_HID_CONFIG_DESC_SIZ,
+                   CUSTOM_HID_OtherSpeedCfgDesc);
+USBD_STATIC_ASSERT(sizeof(USBD_CUSTOM_HID_Desc) == USB_CUSTOM_HID_DESC_SIZ, CUSTOM_HID_Desc);
+
+/* The same endpoint sizes are reported at full and high speed: they must
+   fit the full speed interrupt endpoint range */
+USBD_STATIC_ASSERT(IS_USBD_FS_INTR_MPS(CUSTOM_HID_EPIN_SIZE), CUSTOM_HID_EPIN_SIZE);
+USBD_STATIC_ASSERT(IS_USBD_FS_INTR_MPS(CUSTOM_HID_EPOUT_SIZE), CUSTOM_HID_EPOUT_SIZE);
+USBD_STATIC_ASSERT(IS_USBD_HS_INTERVAL(CUSTOM_HID_HS_BINTERVAL), CUSTOM_HID_HS_BINTERVAL);
+USBD_STATIC_ASSERT(IS_USBD_FS_INTR_INTERVAL(CUSTOM_HID_FS_BINTERVAL), CUSTOM_HID_FS_BINTERVAL);
+
+#if (USBD_CUSTOMHID_STREAM == 1U)
+/* The queues are indexed modulo their size by free-running counters
+   (uint8_t for RX, uint16_t for TX): the sizes must be powers of two no
+   larger than half the counter range */
+USBD_STATIC_ASSERT((USBD_CUSTOMHID_RX_QUEUE_LEN != 0U) &&
+                   ((USBD_CUSTOMHID_RX_QUEUE_LEN & (USBD_CUSTOMHID_RX_QUEUE_LEN - 1U)) == 0U) &&
+                   (USBD_CUSTOMHID_RX_QUEUE_LEN <= 0x80U), USBD_CUSTOMHID_RX_QUEUE_LEN);
+USBD_STATIC_ASSERT((USBD_CUSTOMHID_TX_QUEUE_SIZE != 0U) &&
+                   ((USBD_CUSTOMHID_TX_QUEUE_SIZE & (USBD_CUSTOMHID_TX_QUEUE_SIZE - 1U)) == 0U) &&
+                   (USBD_CUSTOMHID_TX_QUEUE_SIZE <= 0x8000U), USBD_CUSTOMHID_TX_QUEUE_SIZE);
+/* Byte 0 of each report carries the payload length */
+USBD_STATIC_ASSERT((CUSTOM_HID_EPIN_SIZE > 1U) && (CUSTOM_HID_EPOUT_SIZE > 1U), CUSTOM_HID_STREAM_REPORT);
+#endif /* USBD_CUSTOMHID_STREAM */
+
 /**
   * @}
   */
@@ -372,7 +274,12 @@ static uint8_t  USBD_CUSTOM_HID_Init (USBD_HandleTypeDef *pdev,
 
   pdev->ep_out[CUSTOM_HID_EPOUT_ADDR & 0xFU].is_used = 1U;
 
+#if (USBD_STATIC_CLASS_DATA == 1U)
+  pdev->pClassData = (pdev->id < USBD_MAX_NUM_INSTANCES) ?
+                     &USBD_CUSTOM_HID_ClassData[pdev->id] : NULL;
+#else
   pdev->pClassData = USBD_malloc(sizeof (USBD_CUSTOM_HID_HandleTypeDef));
+#endif /* USBD_STATIC_CLASS_DATA */
 
   if(pdev->pClassData == NULL)
   {
@@ -385,9 +292,21 @@ static uint8_t  USBD_CUSTOM_HID_Init (USBD_HandleTypeDef *pdev,
     hhid->state = CUSTOM_HID_IDLE;
     ((USBD_CUSTOM_HID_ItfTypeDef *)pdev->pUserData)->Init();
 
+#if (USBD_CUSTOMHID_STREAM == 1U)
+    hhid->tx_head = 0U;
+    hhid->tx_tail = 0U;
+    hhid->rx_head = 0U;
+    hhid->rx_tail = 0U;
+    hhid->rx_stalled = 0U;
+
+    /* OUT reports are received straight into the queue */
+    USBD_LL_PrepareReceive(pdev, CUSTOM_HID_EPOUT_ADDR, hhid->rx_queue[0],
+                           CUSTOM_HID_EPOUT_SIZE);
+#else
     /* Prepare Out endpoint to receive 1st packet */
     USBD_LL_PrepareReceive(pdev, CUSTOM_HID_EPOUT_ADDR, hhid->Report_buf,
                            USBD_CUSTOMHID_OUTREPORT_BUF_SIZE);
+#endif /* USBD_CUSTOMHID_STREAM */
   }
 
   return ret;
@@ -415,7 +334,9 @@ static uint8_t  USBD_CUSTOM_HID_DeInit (USBD_HandleTypeDef *pdev,
   if(pdev->pClassData != NULL)
   {
     ((USBD_CUSTOM_HID_ItfTypeDef *)pdev->pUserData)->DeInit();
+#if (USBD_STATIC_CLASS_DATA == 0U)
     USBD_free(pdev->pClassData);
+#endif /* USBD_STATIC_CLASS_DATA */
     pdev->pClassData = NULL;
   }
   return USBD_OK;
@@ -623,6 +544,11 @@ static uint8_t  USBD_CUSTOM_HID_DataIn (USBD_HandleTypeDef *pdev,
   be caused by  a new transfer before the end of the previous transfer */
   ((USBD_CUSTOM_HID_HandleTypeDef *)pdev->pClassData)->state = CUSTOM_HID_IDLE;
 
+#if (USBD_CUSTOMHID_STREAM == 1U)
+  /* Whatever was written meanwhile goes out in the next report */
+  USBD_CUSTOM_HID_SendNext(pdev);
+#endif /* USBD_CUSTOMHID_STREAM */
+
   return USBD_OK;
 }
 
@@ -639,11 +565,35 @@ static uint8_t  USBD_CUSTOM_HID_DataOut (USBD_HandleTypeDef *pdev,
 
   USBD_CUSTOM_HID_HandleTypeDef     *hhid = (USBD_CUSTOM_HID_HandleTypeDef*)pdev->pClassData;
 
+#if (USBD_CUSTOMHID_STREAM == 1U)
+  uint8_t *report = hhid->rx_queue[hhid->rx_head % USBD_CUSTOMHID_RX_QUEUE_LEN];
+
+  hhid->rx_head++;
+
+  if (((USBD_CUSTOM_HID_ItfTypeDef *)pdev->pUserData)->StreamEvent != NULL)
+  {
+    ((USBD_CUSTOM_HID_ItfTypeDef *)pdev->pUserData)->StreamEvent(MIN((uint16_t)report[0],
+                                                                     (uint16_t)(CUSTOM_HID_EPOUT_SIZE - 1U)));
+  }
+
+  if ((uint8_t)(hhid->rx_head - hhid->rx_tail) < USBD_CUSTOMHID_RX_QUEUE_LEN)
+  {
+    USBD_LL_PrepareReceive(pdev, CUSTOM_HID_EPOUT_ADDR,
+                           hhid->rx_queue[hhid->rx_head % USBD_CUSTOMHID_RX_QUEUE_LEN],
+                           CUSTOM_HID_EPOUT_SIZE);
+  }
+  else
+  {
+    /* Queue full: the endpoint NAKs until USBD_CUSTOM_HID_Read frees a slot */
+    hhid->rx_stalled = 1U;
+  }
+#else
   ((USBD_CUSTOM_HID_ItfTypeDef *)pdev->pUserData)->OutEvent(hhid->Report_buf[0],
                                                             hhid->Report_buf[1]);
 
   USBD_LL_PrepareReceive(pdev, CUSTOM_HID_EPOUT_ADDR , hhid->Report_buf,
                          USBD_CUSTOMHID_OUTREPORT_BUF_SIZE);
+#endif /* USBD_CUSTOMHID_STREAM */
 
   return USBD_OK;
 }
@@ -699,6 +649,125 @@ uint8_t  USBD_CUSTOM_HID_RegisterInterface  (USBD_HandleTypeDef   *pdev,
 
   return ret;
 }
+
+#if (USBD_CUSTOMHID_STREAM == 1U)
+/**
+  * @brief  USBD_CUSTOM_HID_Write
+  *         Queue bytes on the IN stream. Must always be called from the same
+  *         context (single producer).
+  * @param  pdev: device instance
+  * @param  buf: data to send
+  * @param  len: data length
+  * @retval number of bytes queued
+  */
+uint16_t USBD_CUSTOM_HID_Write (USBD_HandleTypeDef *pdev,
+                                const uint8_t *buf,
+                                uint16_t len)
+{
+  USBD_CUSTOM_HID_HandleTypeDef     *hhid = (USBD_CUSTOM_HID_HandleTypeDef*)pdev->pClassData;
+  uint16_t head;
+  uint16_t count;
+
+  if ((hhid == NULL) || (pdev->dev_state != USBD_STATE_CONFIGURED))
+  {
+    return 0U;
+  }
+
+  head = hhid->tx_head;
+  len = MIN(len, (uint16_t)(USBD_CUSTOMHID_TX_QUEUE_SIZE - (uint16_t)(head - hhid->tx_tail)));
+
+  for (count = 0U; count < len; count++)
+  {
+    hhid->tx_queue[(uint16_t)(head + count) % USBD_CUSTOMHID_TX_QUEUE_SIZE] = buf[count];
+  }
+  hhid->tx_head = (uint16_t)(head + len);
+
+  /* No report in flight means no DataIn will pick the data up: start here */
+  if (hhid->state == CUSTOM_HID_IDLE)
+  {
+    USBD_CUSTOM_HID_SendNext(pdev);
+  }
+
+  return len;
+}
+
+/**
+  * @brief  USBD_CUSTOM_HID_Read
+  *         Get the oldest queued OUT report payload.
+  * @param  pdev: device instance
+  * @param  buf: destination buffer
+  * @param  len: destination buffer size
+  * @retval payload length, 0 if no report is pending
+  */
+uint16_t USBD_CUSTOM_HID_Read (USBD_HandleTypeDef *pdev,
+                               uint8_t *buf,
+                               uint16_t len)
+{
+  USBD_CUSTOM_HID_HandleTypeDef     *hhid = (USBD_CUSTOM_HID_HandleTypeDef*)pdev->pClassData;
+  uint8_t *report;
+  uint16_t count;
+
+  if ((hhid == NULL) || (hhid->rx_head == hhid->rx_tail))
+  {
+    return 0U;
+  }
+
+  report = hhid->rx_queue[hhid->rx_tail % USBD_CUSTOMHID_RX_QUEUE_LEN];
+  len = MIN(len, MIN((uint16_t)report[0], (uint16_t)(CUSTOM_HID_EPOUT_SIZE - 1U)));
+
+  for (count = 0U; count < len; count++)
+  {
+    buf[count] = report[count + 1U];
+  }
+  hhid->rx_tail++;
+
+  if (hhid->rx_stalled != 0U)
+  {
+    /* A slot is free again: resume the reception */
+    hhid->rx_stalled = 0U;
+    USBD_LL_PrepareReceive(pdev, CUSTOM_HID_EPOUT_ADDR,
+                           hhid->rx_queue[hhid->rx_head % USBD_CUSTOMHID_RX_QUEUE_LEN],
+                           CUSTOM_HID_EPOUT_SIZE);
+  }
+
+  return len;
+}
+
+/**
+  * @brief  USBD_CUSTOM_HID_SendNext
+  *         Pack as many queued bytes as fit into the next IN report.
+  * @param  pdev: device instance
+  * @retval None
+  */
+static void USBD_CUSTOM_HID_SendNext (USBD_HandleTypeDef *pdev)
+{
+  USBD_CUSTOM_HID_HandleTypeDef     *hhid = (USBD_CUSTOM_HID_HandleTypeDef*)pdev->pClassData;
+  uint16_t tail = hhid->tx_tail;
+  uint16_t len = (uint16_t)(hhid->tx_head - tail);
+  uint16_t count;
+
+  if (len == 0U)
+  {
+    return;
+  }
+
+  len = MIN(len, (uint16_t)(CUSTOM_HID_EPIN_SIZE - 1U));
+
+  hhid->tx_report[0] = (uint8_t)len;
+  for (count = 0U; count < len; count++)
+  {
+    hhid->tx_report[count + 1U] = hhid->tx_queue[(uint16_t)(tail + count) % USBD_CUSTOMHID_TX_QUEUE_SIZE];
+  }
+  for (; count < (CUSTOM_HID_EPIN_SIZE - 1U); count++)
+  {
+    hhid->tx_report[count + 1U] = 0U;
+  }
+  hhid->tx_tail = (uint16_t)(tail + len);
+
+  hhid->state = CUSTOM_HID_BUSY;
+  USBD_LL_Transmit (pdev, CUSTOM_HID_EPIN_ADDR, hhid->tx_report, CUSTOM_HID_EPIN_SIZE);
+}
+#endif /* USBD_CUSTOMHID_STREAM */
 /**
   * @}
   */
@@ -34,6 +34,9 @@
 static int8_t TEMPLATE_CUSTOM_HID_Init     (void);
 static int8_t TEMPLATE_CUSTOM_HID_DeInit   (void);
 static int8_t TEMPLATE_CUSTOM_HID_OutEvent (uint8_t event_idx, uint8_t state);
+#if (USBD_CUSTOMHID_STREAM == 1U)
+static int8_t TEMPLATE_CUSTOM_HID_StreamEvent (uint16_t len);
+#endif /* USBD_CUSTOMHID_STREAM */
 /* Private variables ---------------------------------------------------------*/
 USBD_CUSTOM_HID_ItfTypeDef USBD_CustomHID_template_fops =
 {
@@ -41,6 +44,9 @@ USBD_CUSTOM_HID_ItfTypeDef USBD_CustomHID_template_fops =
   TEMPLATE_CUSTOM_HID_Init,
   TEMPLATE_CUSTOM_HID_DeInit,
   TEMPLATE_CUSTOM_HID_OutEvent,
+#if (USBD_CUSTOMHID_STREAM == 1U)
+  TEMPLATE_CUSTOM_HID_StreamEvent,
+#endif /* USBD_CUSTOMHID_STREAM */
 };
 
 /* Private functions ---------------------------------------------------------*/
@@ -84,4 +90,19 @@ static int8_t TEMPLATE_CUSTOM_HID_OutEvent  (uint8_t event_idx, uint8_t state)
 
   return (0);
 }
+
+#if (USBD_CUSTOMHID_STREAM == 1U)
+/**
+  * @brief  TEMPLATE_CUSTOM_HID_StreamEvent
+  *         Manage the OUT reports of the stream transport
+  * @param  len: payload length of the report queued, to be fetched with
+  *         USBD_CUSTOM_HID_Read
+  * @retval Result of the operation: USBD_OK if all operations are OK else USBD_FAIL
+  */
+static int8_t TEMPLATE_CUSTOM_HID_StreamEvent  (uint16_t len)
+{
+
+  return (0);
+}
+#endif /* USBD_CUSTOMHID_STREAM */
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -53,8 +53,25 @@
 #define USBD_DFU_APP_DEFAULT_ADD       0x08008000U /* The first sector (32 KB) is reserved for DFU code */
 #endif /* USBD_DFU_APP_DEFAULT_ADD */
 
-#define USB_DFU_CONFIG_DESC_SIZ        (18U + (9U * USBD_DFU_MAX_ITF_NUM))
+/* Pipelined download: each received block (or erase command) is handed over
+   to USBD_DFU_Process(), called from the application main loop, and the host
+   is released immediately so the next block travels while flash is busy.
+   The media timings behind bwPollTimeout are measured in frames counted by
+   the SOF callback: the PCD has to be initialized with the SOF interrupt
+   enabled (Init.Sof_enable = 1). Without it every operation measures 1 ms,
+   and the host polls every millisecond instead of sleeping until the
+   operation is done.
+   With the pipeline, the media Init and DeInit calls of a (re)configuration
+   that happens during a media operation are run by USBD_DFU_Process(), so
+   that they never interrupt an Erase or Write call, and the class must run
+   on a device instance (pdev->id) below USBD_MAX_NUM_INSTANCES */
+#ifndef USBD_DFU_PIPELINE
+#define USBD_DFU_PIPELINE              0U
+#endif /* USBD_DFU_PIPELINE */
+
 #define USB_DFU_DESC_SIZ               9U
+#define USB_DFU_CONFIG_DESC_SIZ        (USB_LEN_CFG_DESC + (USB_LEN_IF_DESC * USBD_DFU_MAX_ITF_NUM) + \
+                                        USB_DFU_DESC_SIZ)
 
 #define DFU_DESCRIPTOR_TYPE            0x21U
 
@@ -111,6 +128,13 @@
 #define DFU_MEDIA_ERASE                0x00U
 #define DFU_MEDIA_PROGRAM              0x01U
 
+/**************************************************/
+/* Background media job state (USBD_DFU_PIPELINE) */
+/**************************************************/
+#define DFU_JOB_NONE                   0x00U
+#define DFU_JOB_QUEUED                 0x01U
+#define DFU_JOB_RUNNING                0x02U
+
 /**************************************************/
 /* Other defines                                  */
 /**************************************************/
@@ -133,15 +157,10 @@ typedef  void (*pFunction)(void);
 
 
 /**********  Descriptor of DFU interface 0 Alternate setting n ****************/
-#define USBD_DFU_IF_DESC(n)            0x09,   /* bLength: Interface Descriptor size */ \
-                                      USB_DESC_TYPE_INTERFACE,   /* bDescriptorType */ \
-                                      0x00,   /* bInterfaceNumber: Number of Interface */ \
-                                      (n),      /* bAlternateSetting: Alternate setting */ \
-                                      0x00,   /* bNumEndpoints*/ \
-                                      0xFE,   /* bInterfaceClass: Application Specific Class Code */ \
-                                      0x01,   /* bInterfaceSubClass : Device Firmware Upgrade Code */ \
-                                      0x02,   /* nInterfaceProtocol: DFU mode protocol */ \
-                                      USBD_IDX_INTERFACE_STR + (n) + 1U /* iInterface: Index of string descriptor */ \
+/* Interface 0, alternate setting n, no endpoint, Application Specific Class,
+   Device Firmware Upgrade subclass, DFU mode protocol */
+#define USBD_DFU_IF_DESC(n)            USBD_INTERFACE_DESC(0x00U, (n), 0x00U, 0xFEU, 0x01U, 0x02U, \
+                                                           USBD_IDX_INTERFACE_STR + (n) + 1U)
 
 #define TRANSFER_SIZE_BYTES(size)      ((uint8_t)(size)), /* XFERSIZEB0 */\
                                        ((uint8_t)(size >> 8)) /* XFERSIZEB1 */
@@ -174,9 +193,47 @@ typedef struct
   uint8_t              ReservedForAlign[2];
   uint8_t              dev_state;
   uint8_t              manif_state;
+#if (USBD_DFU_PIPELINE == 1U)
+  union
+  {
+    uint32_t d32[USBD_DFU_XFER_SIZE / 4U];
+    uint8_t  d8[USBD_DFU_XFER_SIZE];
+  }job_buffer;
+
+  uint32_t             job_addr;
+  uint32_t             job_len;
+  uint32_t             job_start;
+  __IO uint32_t        sof_count;
+  __IO uint32_t        prog_time;
+  __IO uint32_t        erase_time;
+  __IO uint32_t        erase_next;    /* erase-ahead range: first page not erased yet */
+  __IO uint32_t        erase_end;     /* erase-ahead range: end of the pages to erase */
+  __IO uint32_t        ahead_start;
+  __IO uint8_t         ahead_busy;
+  __IO uint8_t         job_state;
+  __IO uint8_t         job_error;
+  uint8_t              job_cmd;
+  __IO uint8_t         session;       /* incremented by each USBD_DFU_Init */
+  uint8_t              job_session;
+  __IO uint8_t         error_session;
+#endif /* USBD_DFU_PIPELINE */
 }
 USBD_DFU_HandleTypeDef;
 
+/* RAM needed by the class data of one configuration, in bytes */
+#define USBD_DFU_CLASS_DATA_SIZE            (sizeof(USBD_DFU_HandleTypeDef))
+
+/* RAM needed by one configuration of the class, in bytes: the class data,
+   which holds the transfer buffers, the descriptors and the user string
+   buffer */
+#if (USBD_SUPPORT_USER_STRING == 1U)
+#define USBD_DFU_CONFIG_RAM_SIZE            (USBD_DFU_CLASS_DATA_SIZE + USB_DFU_CONFIG_DESC_SIZ + \
+                                             USB_LEN_DEV_QUALIFIER_DESC + 255U)
+#else
+#define USBD_DFU_CONFIG_RAM_SIZE            (USBD_DFU_CLASS_DATA_SIZE + USB_DFU_CONFIG_DESC_SIZ + \
+                                             USB_LEN_DEV_QUALIFIER_DESC)
+#endif /* USBD_SUPPORT_USER_STRING */
+
 typedef struct
 {
   const uint8_t* pStrDesc;
@@ -186,6 +243,15 @@ typedef struct
   uint16_t (* Write)    (uint8_t *src, uint8_t *dest, uint32_t Len);
   uint8_t* (* Read)     (uint8_t *src, uint8_t *dest, uint32_t Len);
   uint16_t (* GetStatus)(uint32_t Add, uint8_t cmd, uint8_t *buff);
+#if (USBD_DFU_PIPELINE == 1U)
+  /* Erase-ahead (optional, NULL to disable): size of the erase unit (page or
+     sector) starting at Add, 0 when Add cannot be erased ahead. Erase
+     commands of the host on consecutive units are then acknowledged at
+     once, and the units are erased by USBD_DFU_Process() while the host is
+     busy elsewhere, or before a block is programmed in them. Called from
+     the USB interrupt and from USBD_DFU_Process() */
+  uint32_t (* EraseSize)(uint32_t Add);
+#endif /* USBD_DFU_PIPELINE */
 }
 USBD_DFU_MediaTypeDef;
 /**
@@ -217,6 +283,10 @@ extern USBD_ClassTypeDef  USBD_DFU;
   */
 uint8_t  USBD_DFU_RegisterMedia    (USBD_HandleTypeDef   *pdev,
                                     USBD_DFU_MediaTypeDef *fops);
+
+#if (USBD_DFU_PIPELINE == 1U)
+void     USBD_DFU_Process          (USBD_HandleTypeDef   *pdev);
+#endif /* USBD_DFU_PIPELINE */
 /**
   * @}
   */
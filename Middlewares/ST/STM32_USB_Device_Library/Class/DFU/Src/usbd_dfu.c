@@ -18,6 +18,11 @@
   *             - Requests management (supporting ST DFU sub-protocol)
   *             - Memory operations management (Download/Upload/Erase/Detach/GetState/GetStatus)
   *             - DFU state machine implementation.
+  *             - Optional pipelined download (USBD_DFU_PIPELINE): erase and program
+  *               run in USBD_DFU_Process() while the next block is transferred,
+  *               bwPollTimeout being derived from the measured media timings,
+  *               and pages erased ahead of the blocks when the media has an
+  *               EraseSize callback
   *
   *           @note
   *            ST DFU sub-protocol is compliant with DFU protocol and use sub-requests to manage
@@ -147,6 +152,28 @@ static void DFU_Abort     (USBD_HandleTypeDef *pdev);
 
 static void DFU_Leave  (USBD_HandleTypeDef *pdev);
 
+#if (USBD_DFU_PIPELINE == 1U)
+static uint8_t DFU_QueueJob (USBD_DFU_HandleTypeDef *hdfu, uint8_t cmd, uint32_t addr);
+
+static void DFU_RunJob (USBD_DFU_HandleTypeDef *hdfu, USBD_DFU_MediaTypeDef *media);
+
+static uint8_t DFU_ScheduleErase (USBD_DFU_HandleTypeDef *hdfu, USBD_DFU_MediaTypeDef *media, uint32_t addr);
+
+static uint8_t DFU_EraseAhead (USBD_DFU_HandleTypeDef *hdfu, USBD_DFU_MediaTypeDef *media, uint32_t limit);
+
+static uint32_t DFU_PendingErases (USBD_DFU_HandleTypeDef *hdfu, USBD_DFU_MediaTypeDef *media, uint32_t limit);
+
+static uint32_t DFU_JobRemaining (USBD_DFU_HandleTypeDef *hdfu, USBD_DFU_MediaTypeDef *media);
+
+static uint8_t DFU_MediaBusy (USBD_DFU_HandleTypeDef *hdfu);
+
+static void DFU_MediaSync (USBD_HandleTypeDef *pdev);
+
+static void DFU_SetPollTimeout (USBD_DFU_HandleTypeDef *hdfu, uint32_t timeout);
+#endif /* USBD_DFU_PIPELINE */
+
+static void DFU_Release (USBD_HandleTypeDef *pdev, USBD_DFU_HandleTypeDef *hdfu);
+
 
 /**
   * @}
@@ -156,6 +183,29 @@ static void DFU_Leave  (USBD_HandleTypeDef *pdev);
   * @{
   */
 
+#if (USBD_STATIC_CLASS_DATA == 1U)
+/* DFU class data arenas, one per device instance (pdev->id), used instead of
+   USBD_malloc */
+static USBD_DFU_HandleTypeDef USBD_DFU_ClassData[USBD_MAX_NUM_INSTANCES];
+#endif /* USBD_STATIC_CLASS_DATA */
+
+#if (USBD_DFU_PIPELINE == 1U)
+/* Per device instance (pdev->id) state shared by the USB interrupt and
+   USBD_DFU_Process. Each variable has a single writer at a time, so that no
+   critical section is needed:
+   - ProcessBusy: set during USBD_DFU_Process, which then owns the media calls
+   - ProcessHandle: class data USBD_DFU_Process works on
+   - PendingRelease: that class data, freed by USBD_DFU_Process once
+     USBD_DFU_DeInit detached it
+   - MediaWant: media state requested by USBD_DFU_Init/DeInit (1 = initialized)
+   - MediaReady: media state reached */
+static __IO uint8_t USBD_DFU_ProcessBusy[USBD_MAX_NUM_INSTANCES];
+static USBD_DFU_HandleTypeDef *__IO USBD_DFU_ProcessHandle[USBD_MAX_NUM_INSTANCES];
+static USBD_DFU_HandleTypeDef *__IO USBD_DFU_PendingRelease[USBD_MAX_NUM_INSTANCES];
+static __IO uint8_t USBD_DFU_MediaWant[USBD_MAX_NUM_INSTANCES];
+static __IO uint8_t USBD_DFU_MediaReady[USBD_MAX_NUM_INSTANCES];
+#endif /* USBD_DFU_PIPELINE */
+
 USBD_ClassTypeDef  USBD_DFU =
 {
   USBD_DFU_Init,
@@ -178,19 +228,12 @@ USBD_ClassTypeDef  USBD_DFU =
 };
 
 /* USB DFU device Configuration Descriptor */
-__ALIGN_BEGIN static uint8_t USBD_DFU_CfgDesc[USB_DFU_CONFIG_DESC_SIZ] __ALIGN_END =
+__ALIGN_BEGIN static uint8_t USBD_DFU_CfgDesc[] __ALIGN_END =
 {
-  0x09, /* bLength: Configuation Descriptor size */
-  USB_DESC_TYPE_CONFIGURATION, /* bDescriptorType: Configuration */
-  USB_DFU_CONFIG_DESC_SIZ,
-  /* wTotalLength: Bytes returned */
-  0x00,
-  0x01,         /*bNumInterfaces: 1 interface*/
-  0x01,         /*bConfigurationValue: Configuration value*/
-  0x02,         /*iConfiguration: Index of string descriptor describing the configuration*/
-  0xC0,         /*bmAttributes: bus powered and Supprts Remote Wakeup */
-  0x32,         /*MaxPower 100 mA: this current is used for detecting Vbus*/
-  /* 09 */
+  /* Configuration: 1 interface, iConfiguration 2, self powered, 100 mA
+     (this current is used for detecting Vbus) */
+  USBD_CONFIG_DESC(USB_DESC_TYPE_CONFIGURATION, USB_DFU_CONFIG_DESC_SIZ,
+                   0x01U, 0x01U, 0x02U, 0xC0U, 0x32U),
 
   /**********  Descriptor of DFU interface 0 Alternate setting 0 **************/
   USBD_DFU_IF_DESC(0U), /* This interface is mandatory for all devices */
@@ -245,6 +288,12 @@ __ALIGN_BEGIN static uint8_t USBD_DFU_CfgDesc[USB_DFU_CONFIG_DESC_SIZ] __ALIGN_E
   /* 9*/
 };
 
+USBD_STATIC_ASSERT(sizeof(USBD_DFU_CfgDesc) == USB_DFU_CONFIG_DESC_SIZ, DFU_CfgDesc);
+/* wTransferSize is a multiple of the control endpoint size so that each
+   block ends on a full packet */
+USBD_STATIC_ASSERT(((USBD_DFU_XFER_SIZE % USB_MAX_EP0_SIZE) == 0U) &&
+                   (USBD_DFU_XFER_SIZE <= 0xFFFFU), USBD_DFU_XFER_SIZE);
+
 /* USB Standard Device Descriptor */
 __ALIGN_BEGIN static uint8_t USBD_DFU_DeviceQualifierDesc[USB_LEN_DEV_QUALIFIER_DESC] __ALIGN_END =
 {
@@ -280,8 +329,20 @@ static uint8_t  USBD_DFU_Init (USBD_HandleTypeDef *pdev,
 {
   USBD_DFU_HandleTypeDef   *hdfu;
 
+#if (USBD_DFU_PIPELINE == 1U)
+  if (pdev->id >= USBD_MAX_NUM_INSTANCES)
+  {
+    return USBD_FAIL;
+  }
+#endif /* USBD_DFU_PIPELINE */
+
  /* Allocate Audio structure */
+#if (USBD_STATIC_CLASS_DATA == 1U)
+  pdev->pClassData = (pdev->id < USBD_MAX_NUM_INSTANCES) ?
+                     &USBD_DFU_ClassData[pdev->id] : NULL;
+#else
   pdev->pClassData = USBD_malloc(sizeof (USBD_DFU_HandleTypeDef));
+#endif /* USBD_STATIC_CLASS_DATA */
 
   if(pdev->pClassData == NULL)
   {
@@ -306,11 +367,47 @@ static uint8_t  USBD_DFU_Init (USBD_HandleTypeDef *pdev,
     hdfu->dev_status[4] = DFU_STATE_IDLE;
     hdfu->dev_status[5] = 0U;
 
-    /* Initialize Hardware layer */
-    if (((USBD_DFU_MediaTypeDef *)pdev->pUserData)->Init() != USBD_OK)
+#if (USBD_DFU_PIPELINE == 1U)
+    /* A job of the previous session may still run in USBD_DFU_Process (fast
+       replug): it is finished there, and the media initialization waits for
+       it. With the static arena the job state is the one of that job, which
+       the new session waits for before queuing its own */
+#if (USBD_STATIC_CLASS_DATA == 0U)
+    hdfu->job_state = DFU_JOB_NONE;
+    hdfu->job_error = DFU_ERROR_NONE;
+    hdfu->ahead_busy = 0U;
+    hdfu->erase_next = 0U;
+    hdfu->sof_count = 0U;
+    hdfu->session = 0U;
+#endif /* USBD_STATIC_CLASS_DATA */
+    /* Errors of the previous session jobs are not reported to this one, nor
+       are its pending erase-ahead pages erased */
+    hdfu->session++;
+    hdfu->erase_end = hdfu->erase_next;
+
+    USBD_DFU_MediaWant[pdev->id] = 1U;
+    if ((USBD_DFU_ProcessBusy[pdev->id] == 0U) && (USBD_DFU_MediaReady[pdev->id] == 0U))
+#endif /* USBD_DFU_PIPELINE */
     {
-      return USBD_FAIL;
+      /* Initialize Hardware layer */
+      if (((USBD_DFU_MediaTypeDef *)pdev->pUserData)->Init() != USBD_OK)
+      {
+        return USBD_FAIL;
+      }
+#if (USBD_DFU_PIPELINE == 1U)
+      USBD_DFU_MediaReady[pdev->id] = 1U;
+#endif /* USBD_DFU_PIPELINE */
     }
+
+#if (USBD_DFU_PIPELINE == 1U)
+
+    /* Media timings are the first estimates, refined by measurement */
+    ((USBD_DFU_MediaTypeDef *)pdev->pUserData)->GetStatus(hdfu->data_ptr, DFU_MEDIA_PROGRAM, hdfu->dev_status);
+    hdfu->prog_time = hdfu->dev_status[1] | ((uint32_t)hdfu->dev_status[2] << 8) | ((uint32_t)hdfu->dev_status[3] << 16);
+    ((USBD_DFU_MediaTypeDef *)pdev->pUserData)->GetStatus(hdfu->data_ptr, DFU_MEDIA_ERASE, hdfu->dev_status);
+    hdfu->erase_time = hdfu->dev_status[1] | ((uint32_t)hdfu->dev_status[2] << 8) | ((uint32_t)hdfu->dev_status[3] << 16);
+    DFU_SetPollTimeout(hdfu, 0U);
+#endif /* USBD_DFU_PIPELINE */
   }
   return USBD_OK;
 }
@@ -328,25 +425,65 @@ static uint8_t  USBD_DFU_DeInit (USBD_HandleTypeDef *pdev,
   USBD_DFU_HandleTypeDef   *hdfu;
   hdfu = (USBD_DFU_HandleTypeDef*) pdev->pClassData;
 
-  hdfu->wblock_num = 0U;
-  hdfu->wlength = 0U;
-
-  hdfu->dev_state = DFU_STATE_IDLE;
-  hdfu->dev_status[0] = DFU_ERROR_NONE;
-  hdfu->dev_status[4] = DFU_STATE_IDLE;
-
   /* DeInit  physical Interface components */
-  if(pdev->pClassData != NULL)
+  if(hdfu != NULL)
   {
-    /* De-Initialize Hardware layer */
-    ((USBD_DFU_MediaTypeDef *)pdev->pUserData)->DeInit();
-    USBD_free(pdev->pClassData);
+    hdfu->wblock_num = 0U;
+    hdfu->wlength = 0U;
+
+    hdfu->dev_state = DFU_STATE_IDLE;
+    hdfu->dev_status[0] = DFU_ERROR_NONE;
+    hdfu->dev_status[4] = DFU_STATE_IDLE;
+
     pdev->pClassData = NULL;
+
+#if (USBD_DFU_PIPELINE == 1U)
+    /* The media is de-initialized here, or by USBD_DFU_Process when it runs,
+       unless a new session wants it again by then */
+    USBD_DFU_MediaWant[pdev->id] = 0U;
+    if (USBD_DFU_ProcessBusy[pdev->id] == 0U)
+    {
+      DFU_MediaSync(pdev);
+    }
+
+    if (hdfu == USBD_DFU_ProcessHandle[pdev->id])
+    {
+      /* USBD_DFU_Process may be in an Erase or Write call on this handle */
+      USBD_DFU_PendingRelease[pdev->id] = hdfu;
+    }
+    else
+    {
+      DFU_Release(pdev, hdfu);
+    }
+#else
+    DFU_Release(pdev, hdfu);
+#endif /* USBD_DFU_PIPELINE */
   }
 
   return USBD_OK;
 }
 
+/**
+  * @brief  DFU_Release
+  *         De-Initialize the media (without pipeline, see DFU_MediaSync
+  *         otherwise) and free the class data
+  * @param  pdev: device instance
+  * @param  hdfu: DFU class handle, already detached from pdev
+  * @retval None
+  */
+static void DFU_Release(USBD_HandleTypeDef *pdev, USBD_DFU_HandleTypeDef *hdfu)
+{
+#if (USBD_DFU_PIPELINE == 0U)
+  /* De-Initialize Hardware layer */
+  ((USBD_DFU_MediaTypeDef *)pdev->pUserData)->DeInit();
+#endif /* USBD_DFU_PIPELINE */
+#if (USBD_STATIC_CLASS_DATA == 0U)
+  USBD_free(hdfu);
+#else
+  UNUSED(hdfu);
+#endif /* USBD_STATIC_CLASS_DATA */
+}
+
 /**
   * @brief  USBD_DFU_Setup
   *         Handle the DFU specific requests
@@ -555,10 +692,19 @@ static uint8_t  USBD_DFU_EP0_TxReady (USBD_HandleTypeDef *pdev)
         hdfu->data_ptr += (uint32_t)hdfu->buffer.d8[3] << 16;
         hdfu->data_ptr += (uint32_t)hdfu->buffer.d8[4] << 24;
 
+#if (USBD_DFU_PIPELINE == 1U)
+        if ((DFU_ScheduleErase(hdfu, (USBD_DFU_MediaTypeDef *)pdev->pUserData, hdfu->data_ptr) == 0U) &&
+            (DFU_QueueJob(hdfu, DFU_MEDIA_ERASE, hdfu->data_ptr) == 0U))
+        {
+          /* Previous job still running: keep the command, the host polls again */
+          return USBD_OK;
+        }
+#else
         if (((USBD_DFU_MediaTypeDef *)pdev->pUserData)->Erase(hdfu->data_ptr) != USBD_OK)
         {
           return USBD_FAIL;
         }
+#endif /* USBD_DFU_PIPELINE */
       }
       else
       {
@@ -579,12 +725,20 @@ static uint8_t  USBD_DFU_EP0_TxReady (USBD_HandleTypeDef *pdev)
         /* Decode the required address */
         addr = ((hdfu->wblock_num - 2U) * USBD_DFU_XFER_SIZE) + hdfu->data_ptr;
 
+#if (USBD_DFU_PIPELINE == 1U)
+        if (DFU_QueueJob(hdfu, DFU_MEDIA_PROGRAM, addr) == 0U)
+        {
+          /* Previous job still running: keep the block, the host polls again */
+          return USBD_OK;
+        }
+#else
         /* Preform the write operation */
         if (((USBD_DFU_MediaTypeDef *)pdev->pUserData)->Write(hdfu->buffer.d8,
                                      (uint8_t *)addr, hdfu->wlength) != USBD_OK)
         {
           return USBD_FAIL;
         }
+#endif /* USBD_DFU_PIPELINE */
       }
     }
 
@@ -605,6 +759,16 @@ static uint8_t  USBD_DFU_EP0_TxReady (USBD_HandleTypeDef *pdev)
   {
     if (hdfu->dev_state == DFU_STATE_MANIFEST)/* Manifestation in progress */
     {
+#if (USBD_DFU_PIPELINE == 1U)
+      if (DFU_MediaBusy(hdfu) != 0U)
+      {
+        /* Last block still being programmed, or pages still to erase: the
+           host polls again */
+        hdfu->dev_state = DFU_STATE_MANIFEST_SYNC;
+        hdfu->dev_status[4] = hdfu->dev_state;
+        return USBD_OK;
+      }
+#endif /* USBD_DFU_PIPELINE */
       /* Start leaving DFU mode */
       DFU_Leave(pdev);
     }
@@ -620,6 +784,17 @@ static uint8_t  USBD_DFU_EP0_TxReady (USBD_HandleTypeDef *pdev)
   */
 static uint8_t  USBD_DFU_SOF (USBD_HandleTypeDef *pdev)
 {
+#if (USBD_DFU_PIPELINE == 1U)
+  USBD_DFU_HandleTypeDef   *hdfu;
+
+  hdfu = (USBD_DFU_HandleTypeDef*) pdev->pClassData;
+
+  if (hdfu != NULL)
+  {
+    /* 1 ms timebase used to measure the media operations */
+    hdfu->sof_count++;
+  }
+#endif /* USBD_DFU_PIPELINE */
 
   return USBD_OK;
 }
@@ -925,6 +1100,19 @@ static void DFU_GetStatus(USBD_HandleTypeDef *pdev)
 
  hdfu = (USBD_DFU_HandleTypeDef*) pdev->pClassData;
 
+#if (USBD_DFU_PIPELINE == 1U)
+  if ((hdfu->job_error != DFU_ERROR_NONE) && (hdfu->error_session == hdfu->session))
+  {
+    /* A background erase or program operation failed */
+    hdfu->dev_state = DFU_STATE_ERROR;
+    hdfu->dev_status[0] = hdfu->job_error;
+    hdfu->dev_status[4] = hdfu->dev_state;
+    hdfu->wlength = 0U;
+    hdfu->wblock_num = 0U;
+  }
+  hdfu->job_error = DFU_ERROR_NONE;
+#endif /* USBD_DFU_PIPELINE */
+
   switch (hdfu->dev_state)
   {
   case   DFU_STATE_DNLOAD_SYNC:
@@ -937,6 +1125,11 @@ static void DFU_GetStatus(USBD_HandleTypeDef *pdev)
       hdfu->dev_status[3] = 0U;
       hdfu->dev_status[4] = hdfu->dev_state;
 
+#if (USBD_DFU_PIPELINE == 1U)
+      /* The block is queued as soon as the previous job is done: only that
+         wait is reported, not the programming time of the block itself */
+      DFU_SetPollTimeout(hdfu, DFU_JobRemaining(hdfu, (USBD_DFU_MediaTypeDef *)pdev->pUserData));
+#else
       if ((hdfu->wblock_num == 0U) && (hdfu->buffer.d8[0] == DFU_CMD_ERASE))
       {
         ((USBD_DFU_MediaTypeDef *)pdev->pUserData)->GetStatus(hdfu->data_ptr, DFU_MEDIA_ERASE, hdfu->dev_status);
@@ -945,6 +1138,7 @@ static void DFU_GetStatus(USBD_HandleTypeDef *pdev)
       {
         ((USBD_DFU_MediaTypeDef *)pdev->pUserData)->GetStatus(hdfu->data_ptr, DFU_MEDIA_PROGRAM, hdfu->dev_status);
       }
+#endif /* USBD_DFU_PIPELINE */
     }
     else  /* (hdfu->wlength==0)*/
     {
@@ -957,7 +1151,30 @@ static void DFU_GetStatus(USBD_HandleTypeDef *pdev)
     }
     break;
 
+#if (USBD_DFU_PIPELINE == 1U)
+  case   DFU_STATE_DNLOAD_BUSY:
+    /* Host polls again while the previous job blocks the current one */
+    DFU_SetPollTimeout(hdfu, DFU_JobRemaining(hdfu, (USBD_DFU_MediaTypeDef *)pdev->pUserData));
+    break;
+#endif /* USBD_DFU_PIPELINE */
+
   case   DFU_STATE_MANIFEST_SYNC :
+#if (USBD_DFU_PIPELINE == 1U)
+    if ((hdfu->manif_state == DFU_MANIFEST_IN_PROGRESS) && (DFU_MediaBusy(hdfu) != 0U))
+    {
+      /* Last block still being programmed, or pages still to erase: stay in
+         MANIFEST-SYNC, the host polls again */
+      if (hdfu->job_state != DFU_JOB_NONE)
+      {
+        DFU_SetPollTimeout(hdfu, DFU_JobRemaining(hdfu, (USBD_DFU_MediaTypeDef *)pdev->pUserData) + 1U);
+      }
+      else
+      {
+        DFU_SetPollTimeout(hdfu, DFU_PendingErases(hdfu, (USBD_DFU_MediaTypeDef *)pdev->pUserData, 0xFFFFFFFFU) + 1U);
+      }
+    }
+    else
+#endif /* USBD_DFU_PIPELINE */
     if (hdfu->manif_state == DFU_MANIFEST_IN_PROGRESS)
     {
       hdfu->dev_state = DFU_STATE_MANIFEST;
@@ -1115,6 +1332,384 @@ static void DFU_Leave(USBD_HandleTypeDef *pdev)
   }
 }
 
+#if (USBD_DFU_PIPELINE == 1U)
+/**
+  * @brief  USBD_DFU_Process
+  *         Runs the pending erase or program job, or else erases one page
+  *         ahead of the download. To be called from the application main
+  *         loop (or a low priority task), never from the USB interrupt.
+  *         When the class is de-initialized (USB reset, detach) during the
+  *         job, the class data is released and the media de-initialized here
+  *         once the media call returns.
+  * @param  pdev: device instance
+  * @retval None
+  */
+void USBD_DFU_Process(USBD_HandleTypeDef *pdev)
+{
+  USBD_DFU_HandleTypeDef   *hdfu;
+  USBD_DFU_MediaTypeDef    *media = (USBD_DFU_MediaTypeDef *)pdev->pUserData;
+  uint8_t id = pdev->id;
+
+  if (id >= USBD_MAX_NUM_INSTANCES)
+  {
+    return;
+  }
+
+  /* From here USBD_DFU_Init/DeInit leave the media calls to this function */
+  USBD_DFU_ProcessBusy[id] = 1U;
+  DFU_MediaSync(pdev);
+
+  /* Claim the class data, USBD_DFU_DeInit then defers its release */
+  hdfu = (USBD_DFU_HandleTypeDef*) (*(void *__IO *)&pdev->pClassData);
+  USBD_DFU_ProcessHandle[id] = hdfu;
+  if (hdfu != (USBD_DFU_HandleTypeDef*) (*(void *__IO *)&pdev->pClassData))
+  {
+    hdfu = NULL;
+  }
+
+  if ((hdfu != NULL) && (USBD_DFU_MediaReady[id] != 0U))
+  {
+    if (hdfu->job_state == DFU_JOB_QUEUED)
+    {
+      DFU_RunJob(hdfu, media);
+    }
+    else
+    {
+      (void)DFU_EraseAhead(hdfu, media, 0xFFFFFFFFU);
+    }
+  }
+
+  USBD_DFU_ProcessHandle[id] = NULL;
+  hdfu = USBD_DFU_PendingRelease[id];
+  if (hdfu != NULL)
+  {
+    USBD_DFU_PendingRelease[id] = NULL;
+    DFU_Release(pdev, hdfu);
+  }
+
+  DFU_MediaSync(pdev);
+  USBD_DFU_ProcessBusy[id] = 0U;
+}
+
+/**
+  * @brief  DFU_MediaSync
+  *         Initializes or de-initializes the media as last requested by
+  *         USBD_DFU_Init/DeInit
+  * @param  pdev: device instance
+  * @retval None
+  */
+static void DFU_MediaSync(USBD_HandleTypeDef *pdev)
+{
+  USBD_DFU_MediaTypeDef *media = (USBD_DFU_MediaTypeDef *)pdev->pUserData;
+  uint8_t want;
+
+  want = USBD_DFU_MediaWant[pdev->id];
+  while (want != USBD_DFU_MediaReady[pdev->id])
+  {
+    if (want != 0U)
+    {
+      /* A failure shows up as media errors during the download */
+      (void)media->Init();
+    }
+    else
+    {
+      (void)media->DeInit();
+    }
+    USBD_DFU_MediaReady[pdev->id] = want;
+    want = USBD_DFU_MediaWant[pdev->id];
+  }
+}
+
+/**
+  * @brief  DFU_RunJob
+  *         Runs the queued erase or program job
+  * @param  hdfu: DFU class handle
+  * @param  media: media interface
+  * @retval None
+  */
+static void DFU_RunJob(USBD_DFU_HandleTypeDef *hdfu, USBD_DFU_MediaTypeDef *media)
+{
+  uint16_t status;
+  uint32_t elapsed;
+
+  hdfu->job_state = DFU_JOB_RUNNING;
+
+  if (hdfu->job_cmd == DFU_MEDIA_PROGRAM)
+  {
+    /* Pages of the block not erased ahead yet */
+    while (DFU_EraseAhead(hdfu, media, hdfu->job_addr + hdfu->job_len) != 0U)
+    {
+    }
+  }
+
+  hdfu->job_start = hdfu->sof_count;
+
+  if (hdfu->job_cmd == DFU_MEDIA_ERASE)
+  {
+    status = media->Erase(hdfu->job_addr);
+  }
+  else
+  {
+    status = media->Write(hdfu->job_buffer.d8, (uint8_t *)hdfu->job_addr, hdfu->job_len);
+  }
+
+  /* Track the measured duration so that bwPollTimeout follows the media */
+  elapsed = hdfu->sof_count - hdfu->job_start + 1U;
+  if (hdfu->job_cmd == DFU_MEDIA_ERASE)
+  {
+    hdfu->erase_time = (hdfu->erase_time + elapsed + 1U) / 2U;
+  }
+  else
+  {
+    hdfu->prog_time = (hdfu->prog_time + elapsed + 1U) / 2U;
+  }
+
+  if (status != USBD_OK)
+  {
+    hdfu->error_session = hdfu->job_session;
+    hdfu->job_error = (hdfu->job_cmd == DFU_MEDIA_ERASE) ? DFU_ERROR_ERASE : DFU_ERROR_PROG;
+  }
+
+  hdfu->job_state = DFU_JOB_NONE;
+}
+
+/**
+  * @brief  DFU_ScheduleErase
+  *         Adds the page of an erase command to the erase-ahead range,
+  *         erased by USBD_DFU_Process between the blocks.
+  * @param  hdfu: DFU class handle
+  * @param  media: media interface
+  * @param  addr: address of the page
+  * @retval 1 if scheduled, 0 if the page has to be erased by a job
+  */
+static uint8_t DFU_ScheduleErase(USBD_DFU_HandleTypeDef *hdfu, USBD_DFU_MediaTypeDef *media,
+                                 uint32_t addr)
+{
+  uint32_t size;
+
+  if (media->EraseSize == NULL)
+  {
+    return 0U;
+  }
+
+  size = media->EraseSize(addr);
+  if (size == 0U)
+  {
+    return 0U;
+  }
+
+  if ((addr >= hdfu->erase_next) && (addr < hdfu->erase_end))
+  {
+    /* Already pending */
+    return 1U;
+  }
+
+  if (addr == hdfu->erase_end)
+  {
+    /* Next page of the range (dfu-util erases the pages in order) */
+    hdfu->erase_end = addr + size;
+    return 1U;
+  }
+
+  if ((hdfu->erase_next >= hdfu->erase_end) && (hdfu->ahead_busy == 0U))
+  {
+    /* New range */
+    hdfu->erase_next = addr;
+    hdfu->erase_end = addr + size;
+    return 1U;
+  }
+
+  return 0U;
+}
+
+/**
+  * @brief  DFU_EraseAhead
+  *         Erases the next page of the erase-ahead range
+  * @param  hdfu: DFU class handle
+  * @param  media: media interface
+  * @param  limit: only erase a page starting below this address
+  * @retval 1 if a page was erased, 0 otherwise
+  */
+static uint8_t DFU_EraseAhead(USBD_DFU_HandleTypeDef *hdfu, USBD_DFU_MediaTypeDef *media,
+                              uint32_t limit)
+{
+  uint32_t addr;
+  uint32_t end;
+  uint32_t size;
+  uint32_t elapsed;
+  uint8_t session;
+
+  /* From here DFU_ScheduleErase only extends the range */
+  hdfu->ahead_busy = 1U;
+  addr = hdfu->erase_next;
+  end = hdfu->erase_end;
+  session = hdfu->session;
+
+  /* USBD_DFU_Init empties the range by moving erase_end back to erase_next,
+     which this function may have moved past it meanwhile */
+  if ((addr >= end) || (addr >= limit))
+  {
+    hdfu->ahead_busy = 0U;
+    return 0U;
+  }
+
+  hdfu->ahead_start = hdfu->sof_count;
+  size = media->EraseSize(addr);
+
+  if (media->Erase(addr) != USBD_OK)
+  {
+    hdfu->error_session = session;
+    hdfu->job_error = DFU_ERROR_ERASE;
+  }
+
+  elapsed = hdfu->sof_count - hdfu->ahead_start + 1U;
+  hdfu->erase_time = (hdfu->erase_time + elapsed + 1U) / 2U;
+
+  hdfu->erase_next = (size != 0U) ? (addr + size) : hdfu->erase_end;
+  hdfu->ahead_busy = 0U;
+
+  return 1U;
+}
+
+/**
+  * @brief  DFU_PendingErases
+  *         Estimates the time taken by the erase-ahead pages
+  * @param  hdfu: DFU class handle
+  * @param  media: media interface
+  * @param  limit: only count the pages starting below this address
+  * @retval time in ms
+  */
+static uint32_t DFU_PendingErases(USBD_DFU_HandleTypeDef *hdfu, USBD_DFU_MediaTypeDef *media,
+                                  uint32_t limit)
+{
+  uint32_t addr = hdfu->erase_next;
+  uint32_t end = hdfu->erase_end;
+  uint32_t size;
+  uint32_t estimate = 0U;
+  uint32_t elapsed;
+
+  if (media->EraseSize == NULL)
+  {
+    return 0U;
+  }
+
+  if (hdfu->ahead_busy != 0U)
+  {
+    /* Page being erased */
+    elapsed = hdfu->sof_count - hdfu->ahead_start;
+    estimate = (elapsed < hdfu->erase_time) ? (hdfu->erase_time - elapsed) : 1U;
+    size = media->EraseSize(addr);
+    addr = (size != 0U) ? (addr + size) : end;
+  }
+
+  end = MIN(end, limit);
+  while (addr < end)
+  {
+    size = media->EraseSize(addr);
+    if (size == 0U)
+    {
+      break;
+    }
+    estimate += hdfu->erase_time;
+    addr += size;
+  }
+
+  return estimate;
+}
+
+/**
+  * @brief  DFU_QueueJob
+  *         Hands the current command or block over to USBD_DFU_Process.
+  * @param  hdfu: DFU class handle
+  * @param  cmd: DFU_MEDIA_ERASE or DFU_MEDIA_PROGRAM
+  * @param  addr: media address
+  * @retval 1 if queued, 0 if the previous job is not finished yet
+  */
+static uint8_t DFU_QueueJob(USBD_DFU_HandleTypeDef *hdfu, uint8_t cmd, uint32_t addr)
+{
+  if (hdfu->job_state != DFU_JOB_NONE)
+  {
+    return 0U;
+  }
+
+  if (cmd == DFU_MEDIA_PROGRAM)
+  {
+    /* Frees the reception buffer for the next block */
+    (void)memcpy(hdfu->job_buffer.d8, hdfu->buffer.d8, hdfu->wlength);
+  }
+
+  hdfu->job_cmd = cmd;
+  hdfu->job_addr = addr;
+  hdfu->job_len = hdfu->wlength;
+  hdfu->job_session = hdfu->session;
+  hdfu->job_state = DFU_JOB_QUEUED;
+
+  return 1U;
+}
+
+/**
+  * @brief  DFU_JobRemaining
+  *         Estimates the time left before the pending job is done,
+  *         including the pages it has to erase ahead first.
+  * @param  hdfu: DFU class handle
+  * @param  media: media interface
+  * @retval time in ms
+  */
+static uint32_t DFU_JobRemaining(USBD_DFU_HandleTypeDef *hdfu, USBD_DFU_MediaTypeDef *media)
+{
+  uint32_t estimate;
+  uint32_t erases;
+  uint32_t elapsed;
+  uint8_t state = hdfu->job_state;
+
+  if (state == DFU_JOB_NONE)
+  {
+    return 0U;
+  }
+
+  estimate = (hdfu->job_cmd == DFU_MEDIA_ERASE) ? hdfu->erase_time : hdfu->prog_time;
+  erases = 0U;
+  if (hdfu->job_cmd == DFU_MEDIA_PROGRAM)
+  {
+    erases = DFU_PendingErases(hdfu, media, hdfu->job_addr + hdfu->job_len);
+  }
+
+  if ((state == DFU_JOB_RUNNING) && (erases == 0U))
+  {
+    elapsed = hdfu->sof_count - hdfu->job_start;
+    estimate = (elapsed < estimate) ? (estimate - elapsed) : 1U;
+  }
+
+  return estimate + erases;
+}
+
+/**
+  * @brief  DFU_MediaBusy
+  *         Tells whether a job or erase-ahead page is left to the media.
+  * @param  hdfu: DFU class handle
+  * @retval 1 if busy, 0 otherwise
+  */
+static uint8_t DFU_MediaBusy(USBD_DFU_HandleTypeDef *hdfu)
+{
+  return ((hdfu->job_state != DFU_JOB_NONE) || (hdfu->ahead_busy != 0U) ||
+          (hdfu->erase_next < hdfu->erase_end)) ? 1U : 0U;
+}
+
+/**
+  * @brief  DFU_SetPollTimeout
+  *         Sets bwPollTimeout in the status returned to the host.
+  * @param  hdfu: DFU class handle
+  * @param  timeout: time in ms
+  * @retval None
+  */
+static void DFU_SetPollTimeout(USBD_DFU_HandleTypeDef *hdfu, uint32_t timeout)
+{
+  hdfu->dev_status[1] = (uint8_t)(timeout);
+  hdfu->dev_status[2] = (uint8_t)(timeout >> 8);
+  hdfu->dev_status[3] = (uint8_t)(timeout >> 16);
+}
+#endif /* USBD_DFU_PIPELINE */
+
 /**
   * @}
   */
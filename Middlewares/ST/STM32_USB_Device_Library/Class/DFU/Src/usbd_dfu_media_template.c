@@ -39,6 +39,9 @@ uint16_t MEM_If_Write (uint8_t *src, uint8_t *dest, uint32_t Len);
 uint8_t *MEM_If_Read  (uint8_t *src, uint8_t *dest, uint32_t Len);
 uint16_t MEM_If_DeInit(void);
 uint16_t MEM_If_GetStatus (uint32_t Add, uint8_t Cmd, uint8_t *buffer);
+#if (USBD_DFU_PIPELINE == 1U)
+uint32_t MEM_If_EraseSize (uint32_t Add);
+#endif /* USBD_DFU_PIPELINE */
 
 USBD_DFU_MediaTypeDef USBD_DFU_MEDIA_Template_fops =
 {
@@ -49,7 +52,9 @@ USBD_DFU_MediaTypeDef USBD_DFU_MEDIA_Template_fops =
     MEM_If_Write,
     MEM_If_Read,
     MEM_If_GetStatus,
-
+#if (USBD_DFU_PIPELINE == 1U)
+    MEM_If_EraseSize,
+#endif /* USBD_DFU_PIPELINE */
 };
 /**
   * @brief  MEM_If_Init
@@ -131,5 +136,19 @@ uint16_t MEM_If_GetStatus (uint32_t Add, uint8_t Cmd, uint8_t *buffer)
   }
   return  (0);
 }
+
+#if (USBD_DFU_PIPELINE == 1U)
+/**
+  * @brief  MEM_If_EraseSize
+  *         Erase unit size, for the erase-ahead.
+  * @param  Add: Address of the unit.
+  * @retval Size of the page or sector starting at Add, 0 to erase it on
+  *         the host command only.
+  */
+uint32_t MEM_If_EraseSize (uint32_t Add)
+{
+  return  (0);
+}
+#endif /* USBD_DFU_PIPELINE */
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
 
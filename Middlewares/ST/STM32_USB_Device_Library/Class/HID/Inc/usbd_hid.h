@@ -44,7 +44,8 @@
 #define HID_EPIN_ADDR                 0x81U
 #define HID_EPIN_SIZE                 0x04U
 
-#define USB_HID_CONFIG_DESC_SIZ       34U
+#define USB_HID_CONFIG_DESC_SIZ       (USB_LEN_CFG_DESC + USB_LEN_IF_DESC + USB_HID_DESC_SIZ + \
+                                       USB_LEN_EP_DESC)
 #define USB_HID_DESC_SIZ              9U
 #define HID_MOUSE_REPORT_DESC_SIZE    74U
 
@@ -91,6 +92,16 @@ typedef struct
   HID_StateTypeDef     state;
 }
 USBD_HID_HandleTypeDef;
+
+/* RAM needed by the class data of one configuration, in bytes */
+#define USBD_HID_CLASS_DATA_SIZE            (sizeof(USBD_HID_HandleTypeDef))
+
+/* RAM needed by one configuration of the class, in bytes: the class data,
+   the HS, FS and other speed descriptors and the mouse report descriptor */
+#define USBD_HID_CONFIG_RAM_SIZE            (USBD_HID_CLASS_DATA_SIZE + (3U * USB_HID_CONFIG_DESC_SIZ) + \
+                                             USB_HID_DESC_SIZ + USB_LEN_DEV_QUALIFIER_DESC + \
+                                             HID_MOUSE_REPORT_DESC_SIZE)
+
 /**
   * @}
   */
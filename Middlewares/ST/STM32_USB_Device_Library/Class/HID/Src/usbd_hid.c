@@ -78,6 +78,25 @@
 /** @defgroup USBD_HID_Private_Macros
   * @{
   */
+/* HID class descriptor: HID 1.11, not localized, one report descriptor */
+#define USBD_HID_CLASS_DESC                                                   \
+  USB_HID_DESC_SIZ, HID_DESCRIPTOR_TYPE, 0x11U, 0x01U, 0x00U, 0x01U,          \
+  HID_REPORT_DESC, LOBYTE(HID_MOUSE_REPORT_DESC_SIZE),                        \
+  HIBYTE(HID_MOUSE_REPORT_DESC_SIZE)
+
+/* Configuration descriptor shared by the HS, FS and other speed variants:
+   only the polling interval of the mouse endpoint differs */
+#define USBD_HID_CFG_DESC(interval)                                           \
+  /* Configuration: 1 interface, bus powered, remote wakeup, 100 mA */        \
+  USBD_CONFIG_DESC(USB_DESC_TYPE_CONFIGURATION, USB_HID_CONFIG_DESC_SIZ,      \
+                   0x01U, 0x01U, 0x00U, 0xE0U, 0x32U),                        \
+  /* Joystick Mouse interface: HID, boot subclass, mouse protocol */          \
+  USBD_INTERFACE_DESC(0x00U, 0x00U, 0x01U, 0x03U, 0x01U, 0x02U, 0x00U),       \
+  /* Joystick Mouse HID descriptor */                                         \
+  USBD_HID_CLASS_DESC,                                                        \
+  /* Mouse endpoint */                                                        \
+  USBD_ENDPOINT_DESC(HID_EPIN_ADDR, USBD_EP_TYPE_INTR, HID_EPIN_SIZE,         \
+                     (interval))
 /**
   * @}
   */
@@ -116,6 +135,12 @@ static uint8_t  USBD_HID_DataIn (USBD_HandleTypeDef *pdev, uint8_t epnum);
   * @{
   */
 
+#if (USBD_STATIC_CLASS_DATA == 1U)
+/* HID class data arenas, one per device instance (pdev->id), used instead of
+   USBD_malloc */
+static USBD_HID_HandleTypeDef USBD_HID_ClassData[USBD_MAX_NUM_INSTANCES];
+#endif /* USBD_STATIC_CLASS_DATA */
+
 USBD_ClassTypeDef  USBD_HID =
 {
   USBD_HID_Init,
@@ -135,169 +160,28 @@ USBD_ClassTypeDef  USBD_HID =
 };
 
 /* USB HID device FS Configuration Descriptor */
-__ALIGN_BEGIN static uint8_t USBD_HID_CfgFSDesc[USB_HID_CONFIG_DESC_SIZ]  __ALIGN_END =
+__ALIGN_BEGIN static uint8_t USBD_HID_CfgFSDesc[]  __ALIGN_END =
 {
-  0x09, /* bLength: Configuration Descriptor size */
-  USB_DESC_TYPE_CONFIGURATION, /* bDescriptorType: Configuration */
-  USB_HID_CONFIG_DESC_SIZ,
-  /* wTotalLength: Bytes returned */
-  0x00,
-  0x01,         /*bNumInterfaces: 1 interface*/
-  0x01,         /*bConfigurationValue: Configuration value*/
-  0x00,         /*iConfiguration: Index of string descriptor describing
-  the configuration*/
-  0xE0,         /*bmAttributes: bus powered and Support Remote Wake-up */
-  0x32,         /*MaxPower 100 mA: this current is used for detecting Vbus*/
-
-  /************** Descriptor of Joystick Mouse interface ****************/
-  /* 09 */
-  0x09,         /*bLength: Interface Descriptor size*/
-  USB_DESC_TYPE_INTERFACE,/*bDescriptorType: Interface descriptor type*/
-  0x00,         /*bInterfaceNumber: Number of Interface*/
-  0x00,         /*bAlternateSetting: Alternate setting*/
-  0x01,         /*bNumEndpoints*/
-  0x03,         /*bInterfaceClass: HID*/
-  0x01,         /*bInterfaceSubClass : 1=BOOT, 0=no boot*/
-  0x02,         /*nInterfaceProtocol : 0=none, 1=keyboard, 2=mouse*/
-  0,            /*iInterface: Index of string descriptor*/
-  /******************** Descriptor of Joystick Mouse HID ********************/
-  /* 18 */
-  0x09,         /*bLength: HID Descriptor size*/
-  HID_DESCRIPTOR_TYPE, /*bDescriptorType: HID*/
-  0x11,         /*bcdHID: HID Class Spec release number*/
-  0x01,
-  0x00,         /*bCountryCode: Hardware target country*/
-  0x01,         /*bNumDescriptors: Number of HID class descriptors to follow*/
-  0x22,         /*bDescriptorType*/
-  HID_MOUSE_REPORT_DESC_SIZE,/*wItemLength: Total length of Report descriptor*/
-  0x00,
-  /******************** Descriptor of Mouse endpoint ********************/
-  /* 27 */
-  0x07,          /*bLength: Endpoint Descriptor size*/
-  USB_DESC_TYPE_ENDPOINT, /*bDescriptorType:*/
-
-  HID_EPIN_ADDR,     /*bEndpointAddress: Endpoint Address (IN)*/
-  0x03,          /*bmAttributes: Interrupt endpoint*/
-  HID_EPIN_SIZE, /*wMaxPacketSize: 4 Byte max */
-  0x00,
-  HID_FS_BINTERVAL,          /*bInterval: Polling Interval */
-  /* 34 */
+  USBD_HID_CFG_DESC(HID_FS_BINTERVAL)
 };
 
 /* USB HID device HS Configuration Descriptor */
-__ALIGN_BEGIN static uint8_t USBD_HID_CfgHSDesc[USB_HID_CONFIG_DESC_SIZ]  __ALIGN_END =
+__ALIGN_BEGIN static uint8_t USBD_HID_CfgHSDesc[]  __ALIGN_END =
 {
-  0x09, /* bLength: Configuration Descriptor size */
-  USB_DESC_TYPE_CONFIGURATION, /* bDescriptorType: Configuration */
-  USB_HID_CONFIG_DESC_SIZ,
-  /* wTotalLength: Bytes returned */
-  0x00,
-  0x01,         /*bNumInterfaces: 1 interface*/
-  0x01,         /*bConfigurationValue: Configuration value*/
-  0x00,         /*iConfiguration: Index of string descriptor describing
-  the configuration*/
-  0xE0,         /*bmAttributes: bus powered and Support Remote Wake-up */
-  0x32,         /*MaxPower 100 mA: this current is used for detecting Vbus*/
-
-  /************** Descriptor of Joystick Mouse interface ****************/
-  /* 09 */
-  0x09,         /*bLength: Interface Descriptor size*/
-  USB_DESC_TYPE_INTERFACE,/*bDescriptorType: Interface descriptor type*/
-  0x00,         /*bInterfaceNumber: Number of Interface*/
-  0x00,         /*bAlternateSetting: Alternate setting*/
-  0x01,         /*bNumEndpoints*/
-  0x03,         /*bInterfaceClass: HID*/
-  0x01,         /*bInterfaceSubClass : 1=BOOT, 0=no boot*/
-  0x02,         /*nInterfaceProtocol : 0=none, 1=keyboard, 2=mouse*/
-  0,            /*iInterface: Index of string descriptor*/
-  /******************** Descriptor of Joystick Mouse HID ********************/
-  /* 18 */
-  0x09,         /*bLength: HID Descriptor size*/
-  HID_DESCRIPTOR_TYPE, /*bDescriptorType: HID*/
-  0x11,         /*bcdHID: HID Class Spec release number*/
-  0x01,
-  0x00,         /*bCountryCode: Hardware target country*/
-  0x01,         /*bNumDescriptors: Number of HID class descriptors to follow*/
-  0x22,         /*bDescriptorType*/
-  HID_MOUSE_REPORT_DESC_SIZE,/*wItemLength: Total length of Report descriptor*/
-  0x00,
-  /******************** Descriptor of Mouse endpoint ********************/
-  /* 27 */
-  0x07,          /*bLength: Endpoint Descriptor size*/
-  USB_DESC_TYPE_ENDPOINT, /*bDescriptorType:*/
-
-  HID_EPIN_ADDR,     /*bEndpointAddress: Endpoint Address (IN)*/
-  0x03,          /*bmAttributes: Interrupt endpoint*/
-  HID_EPIN_SIZE, /*wMaxPacketSize: 4 Byte max */
-  0x00,
-  HID_HS_BINTERVAL,          /*bInterval: Polling Interval */
-  /* 34 */
+  USBD_HID_CFG_DESC(HID_HS_BINTERVAL)
 };
 
 /* USB HID device Other Speed Configuration Descriptor */
-__ALIGN_BEGIN static uint8_t USBD_HID_OtherSpeedCfgDesc[USB_HID_CONFIG_DESC_SIZ]  __ALIGN_END =
+__ALIGN_BEGIN static uint8_t USBD_HID_OtherSpeedCfgDesc[]  __ALIGN_END =
 {
-  0x09, /* bLength: Configuration Descriptor size */
-  USB_DESC_TYPE_CONFIGURATION, /* bDescriptorType: Configuration */
-  USB_HID_CONFIG_DESC_SIZ,
-  /* wTotalLength: Bytes returned */
-  0x00,
-  0x01,         /*bNumInterfaces: 1 interface*/
-  0x01,         /*bConfigurationValue: Configuration value*/
-  0x00,         /*iConfiguration: Index of string descriptor describing
-  the configuration*/
-  0xE0,         /*bmAttributes: bus powered and Support Remote Wake-up */
-  0x32,         /*MaxPower 100 mA: this current is used for detecting Vbus*/
-
-  /************** Descriptor of Joystick Mouse interface ****************/
-  /* 09 */
-  0x09,         /*bLength: Interface Descriptor size*/
-  USB_DESC_TYPE_INTERFACE,/*bDescriptorType: Interface descriptor type*/
-  0x00,         /*bInterfaceNumber: Number of Interface*/
-  0x00,         /*bAlternateSetting: Alternate setting*/
-  0x01,         /*bNumEndpoints*/
-  0x03,         /*bInterfaceClass: HID*/
-  0x01,         /*bInterfaceSubClass : 1=BOOT, 0=no boot*/
-  0x02,         /*nInterfaceProtocol : 0=none, 1=keyboard, 2=mouse*/
-  0,            /*iInterface: Index of string descriptor*/
-  /******************** Descriptor of Joystick Mouse HID ********************/
-  /* 18 */
-  0x09,         /*bLength: HID Descriptor size*/
-  HID_DESCRIPTOR_TYPE, /*bDescriptorType: HID*/
-  0x11,         /*bcdHID: HID Class Spec release number*/
-  0x01,
-  0x00,         /*bCountryCode: Hardware target country*/
-  0x01,         /*bNumDescriptors: Number of HID class descriptors to follow*/
-  0x22,         /*bDescriptorType*/
-  HID_MOUSE_REPORT_DESC_SIZE,/*wItemLength: Total length of Report descriptor*/
-  0x00,
-  /******************** Descriptor of Mouse endpoint ********************/
-  /* 27 */
-  0x07,          /*bLength: Endpoint Descriptor size*/
-  USB_DESC_TYPE_ENDPOINT, /*bDescriptorType:*/
-
-  HID_EPIN_ADDR,     /*bEndpointAddress: Endpoint Address (IN)*/
-  0x03,          /*bmAttributes: Interrupt endpoint*/
-  HID_EPIN_SIZE, /*wMaxPacketSize: 4 Byte max */
-  0x00,
-  HID_FS_BINTERVAL,          /*bInterval: Polling Interval */
-  /* 34 */
+  USBD_HID_CFG_DESC(HID_FS_BINTERVAL)
 };
 
 
 /* USB HID device Configuration Descriptor */
-__ALIGN_BEGIN static uint8_t USBD_HID_Desc[USB_HID_DESC_SIZ]  __ALIGN_END  =
+__ALIGN_BEGIN static uint8_t USBD_HID_Desc[]  __ALIGN_END  =
 {
-  /* 18 */
-  0x09,         /*bLength: HID Descriptor size*/
-  HID_DESCRIPTOR_TYPE, /*bDescriptorType: HID*/
-  0x11,         /*bcdHID: HID Class Spec release number*/
-  0x01,
-  0x00,         /*bCountryCode: Hardware target country*/
-  0x01,         /*bNumDescriptors: Number of HID class descriptors to follow*/
-  0x22,         /*bDescriptorType*/
-  HID_MOUSE_REPORT_DESC_SIZE,/*wItemLength: Total length of Report descriptor*/
-  0x00,
+  USBD_HID_CLASS_DESC
 };
 
 /* USB Standard Device Descriptor */
@@ -315,6 +199,16 @@ __ALIGN_BEGIN static uint8_t USBD_HID_DeviceQualifierDesc[USB_LEN_DEV_QUALIFIER_
   0x00,
 };
 
+/* Enumeration breaks silently on a wrong wTotalLength or on endpoint
+   parameters out of the USB 2.0 ranges: reject them at build time */
+USBD_STATIC_ASSERT(sizeof(USBD_HID_CfgFSDesc) == USB_HID_CONFIG_DESC_SIZ, HID_CfgFSDesc);
+USBD_STATIC_ASSERT(sizeof(USBD_HID_CfgHSDesc) == USB_HID_CONFIG_DESC_SIZ, HID_CfgHSDesc);
+USBD_STATIC_ASSERT(sizeof(USBD_HID_OtherSpeedCfgDesc) == USB_HID_CONFIG_DESC_SIZ, HID_OtherSpeedCfgDesc);
+USBD_STATIC_ASSERT(sizeof(USBD_HID_Desc) == USB_HID_DESC_SIZ, HID_Desc);
+USBD_STATIC_ASSERT(IS_USBD_FS_INTR_MPS(HID_EPIN_SIZE), HID_EPIN_SIZE);
+USBD_STATIC_ASSERT(IS_USBD_HS_INTERVAL(HID_HS_BINTERVAL), HID_HS_BINTERVAL);
+USBD_STATIC_ASSERT(IS_USBD_FS_INTR_INTERVAL(HID_FS_BINTERVAL), HID_FS_BINTERVAL);
+
 __ALIGN_BEGIN static uint8_t HID_MOUSE_ReportDesc[HID_MOUSE_REPORT_DESC_SIZE]  __ALIGN_END =
 {
   0x05,   0x01,
@@ -386,7 +280,12 @@ static uint8_t  USBD_HID_Init (USBD_HandleTypeDef *pdev, uint8_t cfgidx)
   USBD_LL_OpenEP(pdev, HID_EPIN_ADDR, USBD_EP_TYPE_INTR, HID_EPIN_SIZE);
   pdev->ep_in[HID_EPIN_ADDR & 0xFU].is_used = 1U;
 
+#if (USBD_STATIC_CLASS_DATA == 1U)
+  pdev->pClassData = (pdev->id < USBD_MAX_NUM_INSTANCES) ?
+                     &USBD_HID_ClassData[pdev->id] : NULL;
+#else
   pdev->pClassData = USBD_malloc(sizeof (USBD_HID_HandleTypeDef));
+#endif /* USBD_STATIC_CLASS_DATA */
 
   if (pdev->pClassData == NULL)
   {
@@ -415,7 +314,9 @@ static uint8_t  USBD_HID_DeInit (USBD_HandleTypeDef *pdev,
   /* FRee allocated memory */
   if(pdev->pClassData != NULL)
   {
+#if (USBD_STATIC_CLASS_DATA == 0U)
     USBD_free(pdev->pClassData);
+#endif /* USBD_STATIC_CLASS_DATA */
     pdev->pClassData = NULL;
   }
 
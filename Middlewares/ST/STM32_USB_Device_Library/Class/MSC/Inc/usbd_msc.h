@@ -48,12 +48,14 @@
 #define MSC_MEDIA_PACKET             512U
 #endif /* MSC_MEDIA_PACKET */
 
+#ifndef MSC_MAX_FS_PACKET
 #define MSC_MAX_FS_PACKET            0x40U
+#endif /* MSC_MAX_FS_PACKET */
 #define MSC_MAX_HS_PACKET            0x200U
 
 #define BOT_GET_MAX_LUN              0xFE
 #define BOT_RESET                    0xFF
-#define USB_MSC_CONFIG_DESC_SIZ      32
+#define USB_MSC_CONFIG_DESC_SIZ      (USB_LEN_CFG_DESC + USB_LEN_IF_DESC + (2U * USB_LEN_EP_DESC))
 
 
 #define MSC_EPIN_ADDR                0x81U
@@ -103,6 +105,15 @@ typedef struct
 }
 USBD_MSC_BOT_HandleTypeDef;
 
+/* RAM needed by the class data of one configuration, in bytes */
+#define USBD_MSC_CLASS_DATA_SIZE            (sizeof(USBD_MSC_BOT_HandleTypeDef))
+
+/* RAM needed by one configuration of the class, in bytes: the class data,
+   which holds the MSC_MEDIA_PACKET bytes BOT/SCSI buffer, and the HS, FS and
+   other speed descriptors */
+#define USBD_MSC_CONFIG_RAM_SIZE            (USBD_MSC_CLASS_DATA_SIZE + (3U * USB_MSC_CONFIG_DESC_SIZ) + \
+                                             USB_LEN_DEV_QUALIFIER_DESC)
+
 /* Structure for MSC process */
 extern USBD_ClassTypeDef  USBD_MSC;
 #define USBD_MSC_CLASS    &USBD_MSC
@@ -72,6 +72,17 @@
 /** @defgroup MSC_CORE_Private_Macros
   * @{
   */
+/* Configuration descriptor shared by the HS, FS and other speed variants:
+   one SCSI transparent Bulk-Only interface with two bulk endpoints */
+#define USBD_MSC_CFG_DESC(type, mps)                                           \
+  /* Configuration: 1 interface, self powered, 100 mA */                      \
+  USBD_CONFIG_DESC((type), USB_MSC_CONFIG_DESC_SIZ, 0x01U, 0x01U, 0x04U,       \
+                   0xC0U, 0x32U),                                              \
+  /* Mass Storage interface: SCSI transparent, Bulk-Only transport */         \
+  USBD_INTERFACE_DESC(0x00U, 0x00U, 0x02U, 0x08U, 0x06U, 0x50U, 0x05U),       \
+  /* Mass Storage endpoints */                                                 \
+  USBD_ENDPOINT_DESC(MSC_EPIN_ADDR, USBD_EP_TYPE_BULK, (mps), 0x00U),          \
+  USBD_ENDPOINT_DESC(MSC_EPOUT_ADDR, USBD_EP_TYPE_BULK, (mps), 0x00U)
 /**
   * @}
   */
@@ -114,6 +125,12 @@ uint8_t  *USBD_MSC_GetDeviceQualifierDescriptor (uint16_t *length);
   * @{
   */
 
+#if (USBD_STATIC_CLASS_DATA == 1U)
+/* MSC class data arenas, one per device instance (pdev->id), used instead of
+   USBD_malloc */
+static USBD_MSC_BOT_HandleTypeDef USBD_MSC_ClassData[USBD_MAX_NUM_INSTANCES];
+#endif /* USBD_STATIC_CLASS_DATA */
+
 
 USBD_ClassTypeDef  USBD_MSC =
 {
@@ -135,134 +152,30 @@ USBD_ClassTypeDef  USBD_MSC =
 
 /* USB Mass storage device Configuration Descriptor */
 /*   All Descriptors (Configuration, Interface, Endpoint, Class, Vendor */
-__ALIGN_BEGIN uint8_t USBD_MSC_CfgHSDesc[USB_MSC_CONFIG_DESC_SIZ]  __ALIGN_END =
+__ALIGN_BEGIN uint8_t USBD_MSC_CfgHSDesc[]  __ALIGN_END =
 {
-
-  0x09,   /* bLength: Configuation Descriptor size */
-  USB_DESC_TYPE_CONFIGURATION,   /* bDescriptorType: Configuration */
-  USB_MSC_CONFIG_DESC_SIZ,
-
-  0x00,
-  0x01,   /* bNumInterfaces: 1 interface */
-  0x01,   /* bConfigurationValue: */
-  0x04,   /* iConfiguration: */
-  0xC0,   /* bmAttributes: */
-  0x32,   /* MaxPower 100 mA */
-
-  /********************  Mass Storage interface ********************/
-  0x09,   /* bLength: Interface Descriptor size */
-  0x04,   /* bDescriptorType: */
-  0x00,   /* bInterfaceNumber: Number of Interface */
-  0x00,   /* bAlternateSetting: Alternate setting */
-  0x02,   /* bNumEndpoints*/
-  0x08,   /* bInterfaceClass: MSC Class */
-  0x06,   /* bInterfaceSubClass : SCSI transparent*/
-  0x50,   /* nInterfaceProtocol */
-  0x05,          /* iInterface: */
-  /********************  Mass Storage Endpoints ********************/
-  0x07,   /*Endpoint descriptor length = 7*/
-  0x05,   /*Endpoint descriptor type */
-  MSC_EPIN_ADDR,   /*Endpoint address (IN, address 1) */
-  0x02,   /*Bulk endpoint type */
-  LOBYTE(MSC_MAX_HS_PACKET),
-  HIBYTE(MSC_MAX_HS_PACKET),
-  0x00,   /*Polling interval in milliseconds */
-
-  0x07,   /*Endpoint descriptor length = 7 */
-  0x05,   /*Endpoint descriptor type */
-  MSC_EPOUT_ADDR,   /*Endpoint address (OUT, address 1) */
-  0x02,   /*Bulk endpoint type */
-  LOBYTE(MSC_MAX_HS_PACKET),
-  HIBYTE(MSC_MAX_HS_PACKET),
-  0x00     /*Polling interval in milliseconds*/
+  USBD_MSC_CFG_DESC(USB_DESC_TYPE_CONFIGURATION, MSC_MAX_HS_PACKET)
 };
 
 /* USB Mass storage device Configuration Descriptor */
 /*   All Descriptors (Configuration, Interface, Endpoint, Class, Vendor */
-uint8_t USBD_MSC_CfgFSDesc[USB_MSC_CONFIG_DESC_SIZ]  __ALIGN_END =
+__ALIGN_BEGIN uint8_t USBD_MSC_CfgFSDesc[]  __ALIGN_END =
 {
-
-  0x09,   /* bLength: Configuation Descriptor size */
-  USB_DESC_TYPE_CONFIGURATION,   /* bDescriptorType: Configuration */
-  USB_MSC_CONFIG_DESC_SIZ,
-
-  0x00,
-  0x01,   /* bNumInterfaces: 1 interface */
-  0x01,   /* bConfigurationValue: */
-  0x04,   /* iConfiguration: */
-  0xC0,   /* bmAttributes: */
-  0x32,   /* MaxPower 100 mA */
-
-  /********************  Mass Storage interface ********************/
-  0x09,   /* bLength: Interface Descriptor size */
-  0x04,   /* bDescriptorType: */
-  0x00,   /* bInterfaceNumber: Number of Interface */
-  0x00,   /* bAlternateSetting: Alternate setting */
-  0x02,   /* bNumEndpoints*/
-  0x08,   /* bInterfaceClass: MSC Class */
-  0x06,   /* bInterfaceSubClass : SCSI transparent*/
-  0x50,   /* nInterfaceProtocol */
-  0x05,          /* iInterface: */
-  /********************  Mass Storage Endpoints ********************/
-  0x07,   /*Endpoint descriptor length = 7*/
-  0x05,   /*Endpoint descriptor type */
-  MSC_EPIN_ADDR,   /*Endpoint address (IN, address 1) */
-  0x02,   /*Bulk endpoint type */
-  LOBYTE(MSC_MAX_FS_PACKET),
-  HIBYTE(MSC_MAX_FS_PACKET),
-  0x00,   /*Polling interval in milliseconds */
-
-  0x07,   /*Endpoint descriptor length = 7 */
-  0x05,   /*Endpoint descriptor type */
-  MSC_EPOUT_ADDR,   /*Endpoint address (OUT, address 1) */
-  0x02,   /*Bulk endpoint type */
-  LOBYTE(MSC_MAX_FS_PACKET),
-  HIBYTE(MSC_MAX_FS_PACKET),
-  0x00     /*Polling interval in milliseconds*/
+  USBD_MSC_CFG_DESC(USB_DESC_TYPE_CONFIGURATION, MSC_MAX_FS_PACKET)
 };
 
-__ALIGN_BEGIN uint8_t USBD_MSC_OtherSpeedCfgDesc[USB_MSC_CONFIG_DESC_SIZ]   __ALIGN_END  =
+__ALIGN_BEGIN uint8_t USBD_MSC_OtherSpeedCfgDesc[]   __ALIGN_END  =
 {
-
-  0x09,   /* bLength: Configuation Descriptor size */
-  USB_DESC_TYPE_OTHER_SPEED_CONFIGURATION,
-  USB_MSC_CONFIG_DESC_SIZ,
-
-  0x00,
-  0x01,   /* bNumInterfaces: 1 interface */
-  0x01,   /* bConfigurationValue: */
-  0x04,   /* iConfiguration: */
-  0xC0,   /* bmAttributes: */
-  0x32,   /* MaxPower 100 mA */
-
-  /********************  Mass Storage interface ********************/
-  0x09,   /* bLength: Interface Descriptor size */
-  0x04,   /* bDescriptorType: */
-  0x00,   /* bInterfaceNumber: Number of Interface */
-  0x00,   /* bAlternateSetting: Alternate setting */
-  0x02,   /* bNumEndpoints*/
-  0x08,   /* bInterfaceClass: MSC Class */
-  0x06,   /* bInterfaceSubClass : SCSI transparent command set*/
-  0x50,   /* nInterfaceProtocol */
-  0x05,          /* iInterface: */
-  /********************  Mass Storage Endpoints ********************/
-  0x07,   /*Endpoint descriptor length = 7*/
-  0x05,   /*Endpoint descriptor type */
-  MSC_EPIN_ADDR,   /*Endpoint address (IN, address 1) */
-  0x02,   /*Bulk endpoint type */
-  0x40,
-  0x00,
-  0x00,   /*Polling interval in milliseconds */
-
-  0x07,   /*Endpoint descriptor length = 7 */
-  0x05,   /*Endpoint descriptor type */
-  MSC_EPOUT_ADDR,   /*Endpoint address (OUT, address 1) */
-  0x02,   /*Bulk endpoint type */
-  0x40,
-  0x00,
-  0x00     /*Polling interval in milliseconds*/
+  USBD_MSC_CFG_DESC(USB_DESC_TYPE_OTHER_SPEED_CONFIGURATION, MSC_MAX_FS_PACKET)
 };
 
+USBD_STATIC_ASSERT(sizeof(USBD_MSC_CfgHSDesc) == USB_MSC_CONFIG_DESC_SIZ, MSC_CfgHSDesc);
+USBD_STATIC_ASSERT(sizeof(USBD_MSC_CfgFSDesc) == USB_MSC_CONFIG_DESC_SIZ, MSC_CfgFSDesc);
+USBD_STATIC_ASSERT(sizeof(USBD_MSC_OtherSpeedCfgDesc) == USB_MSC_CONFIG_DESC_SIZ, MSC_OtherSpeedCfgDesc);
+USBD_STATIC_ASSERT(IS_USBD_HS_BULK_MPS(MSC_MAX_HS_PACKET), MSC_MAX_HS_PACKET);
+USBD_STATIC_ASSERT(IS_USBD_FS_BULK_MPS(MSC_MAX_FS_PACKET), MSC_MAX_FS_PACKET);
+USBD_STATIC_ASSERT((MSC_MEDIA_PACKET % MSC_MAX_FS_PACKET) == 0U, MSC_MEDIA_PACKET);
+
 /* USB Standard Device Descriptor */
 __ALIGN_BEGIN  uint8_t USBD_MSC_DeviceQualifierDesc[USB_LEN_DEV_QUALIFIER_DESC]  __ALIGN_END =
 {
@@ -315,7 +228,12 @@ uint8_t  USBD_MSC_Init (USBD_HandleTypeDef *pdev, uint8_t cfgidx)
     USBD_LL_OpenEP(pdev, MSC_EPIN_ADDR, USBD_EP_TYPE_BULK, MSC_MAX_FS_PACKET);
     pdev->ep_in[MSC_EPIN_ADDR & 0xFU].is_used = 1U;
   }
+#if (USBD_STATIC_CLASS_DATA == 1U)
+  pdev->pClassData = (pdev->id < USBD_MAX_NUM_INSTANCES) ?
+                     &USBD_MSC_ClassData[pdev->id] : NULL;
+#else
   pdev->pClassData = USBD_malloc(sizeof (USBD_MSC_BOT_HandleTypeDef));
+#endif /* USBD_STATIC_CLASS_DATA */
 
   if(pdev->pClassData == NULL)
   {
@@ -352,7 +270,9 @@ uint8_t  USBD_MSC_DeInit (USBD_HandleTypeDef *pdev,
   /* Free MSC Class Resources */
   if(pdev->pClassData != NULL)
   {
+#if (USBD_STATIC_CLASS_DATA == 0U)
     USBD_free(pdev->pClassData);
+#endif /* USBD_STATIC_CLASS_DATA */
     pdev->pClassData  = NULL;
   }
   return USBD_OK;
@@ -51,6 +51,16 @@
 #define USBD_SELF_POWERED                     1U
 #define USBD_DEBUG_LEVEL                      2U
 
+/* Class data allocation: 0 = USBD_malloc/USBD_free on every (de)configuration,
+   1 = statically reserved arenas, the heap is never used. Each class reserves
+   one arena per device instance, indexed by the id given to USBD_Init
+   (pdev->id): a build running both cores (e.g. DEVICE_FS = 0 and
+   DEVICE_HS = 1) sets USBD_MAX_NUM_INSTANCES to 2, and a class configured on
+   an instance whose id is not below USBD_MAX_NUM_INSTANCES fails to
+   initialize */
+#define USBD_STATIC_CLASS_DATA                0U
+#define USBD_MAX_NUM_INSTANCES                1U
+
 /* MSC Class Config */
 #define MSC_MEDIA_PACKET                       8192U
 
@@ -63,6 +73,10 @@
 
  /* AUDIO Class Config */
 #define USBD_AUDIO_FREQ                       22100U
+/* Explicit feedback endpoint: needs the SOF interrupt (PCD Init.Sof_enable =
+   1) and a packet memory buffer or TX FIFO for the IN endpoint 0x81, see
+   usbd_audio.h */
+#define USBD_AUDIO_FEEDBACK                   0U
 
 /** @defgroup USBD_Exported_Macros
   * @{
@@ -65,6 +65,14 @@
 #define USBD_SUPPORT_USER_STRING                        0U
 #endif /* USBD_SUPPORT_USER_STRING */
 
+#ifndef USBD_STATIC_CLASS_DATA
+#define USBD_STATIC_CLASS_DATA                          0U
+#endif /* USBD_STATIC_CLASS_DATA */
+
+#ifndef USBD_MAX_NUM_INSTANCES
+#define USBD_MAX_NUM_INSTANCES                          1U
+#endif /* USBD_MAX_NUM_INSTANCES */
+
 #define  USB_LEN_DEV_QUALIFIER_DESC                     0x0AU
 #define  USB_LEN_DEV_DESC                               0x12U
 #define  USB_LEN_CFG_DESC                               0x09U
@@ -277,6 +285,35 @@ typedef struct _USBD_HandleTypeDef
 #define MIN(a, b)  (((a) < (b)) ? (a) : (b))
 #define MAX(a, b)  (((a) > (b)) ? (a) : (b))
 
+/* Descriptor builders: each macro expands to the bytes of one standard
+   descriptor, so that class configuration descriptors are assembled from
+   constant expressions and follow the class defines (packet sizes,
+   intervals, endpoint addresses) without hand-edited bytes */
+#define USBD_CONFIG_DESC(type, total, nb_itf, cfg_val, str_idx, attr, power) \
+  USB_LEN_CFG_DESC, (type), LOBYTE((total)), HIBYTE((total)), (nb_itf),     \
+  (cfg_val), (str_idx), (attr), (power)
+
+#define USBD_INTERFACE_DESC(itf, alt, nb_ep, cls, subcls, protocol, str_idx) \
+  USB_LEN_IF_DESC, USB_DESC_TYPE_INTERFACE, (itf), (alt), (nb_ep), (cls),   \
+  (subcls), (protocol), (str_idx)
+
+#define USBD_ENDPOINT_DESC(addr, type, mps, interval)                        \
+  USB_LEN_EP_DESC, USB_DESC_TYPE_ENDPOINT, (addr), (type), LOBYTE((mps)),   \
+  HIBYTE((mps)), (interval)
+
+/* Build-time check: breaks the compilation when cond is false */
+#define USBD_STATIC_ASSERT(cond, name) \
+  typedef char USBD_StaticAssert_##name[(cond) ? 1 : -1]
+
+/* Endpoint constraints of the USB 2.0 specification (chapter 5 and 9.6.6) */
+#define IS_USBD_FS_BULK_MPS(mps)     (((mps) == 8U) || ((mps) == 16U) || \
+                                      ((mps) == 32U) || ((mps) == 64U))
+#define IS_USBD_HS_BULK_MPS(mps)     ((mps) == 512U)
+#define IS_USBD_FS_INTR_MPS(mps)     (((mps) >= 1U) && ((mps) <= 64U))
+#define IS_USBD_FS_ISOC_MPS(mps)     ((mps) <= 1023U)
+#define IS_USBD_FS_INTR_INTERVAL(i)  (((i) >= 1U) && ((i) <= 255U))
+#define IS_USBD_HS_INTERVAL(i)       (((i) >= 1U) && ((i) <= 16U))
+
 
 #if  defined ( __GNUC__ )
   #ifndef __weak
@@ -0,0 +1,92 @@
+/**
+  ******************************************************************************
+  * @file    usbd_mem_report_template.c
+  * @author  MCD Application Team
+  * @brief   Build-time RAM footprint report of the USB device classes.
+  *          This template should be copied to the user folder, renamed and
+  *          reduced to the classes used by the application.
+  *
+  *          Each USBD_MEM_REPORT_CLASS() line emits const words readable
+  *          from the map file, with "nm -S" or in the debugger without
+  *          running the target, all in bytes:
+  *           - "USBD_MemReport_<class>": the class data, allocated on each
+  *             configuration (USBD_malloc or static arena);
+  *           - "USBD_MemReport_<class>_Config": the RAM one configuration of
+  *             the class needs on one device instance: the device core
+  *             (USBD_MemReport_Core), the class data, including the buffers
+  *             it holds (USBD_MemReport_MSC_Buffer, USBD_MemReport_AUDIO_Ring),
+  *             and the descriptors kept in RAM;
+  *           - "USBD_MemReport_<class>_Arena": with USBD_STATIC_CLASS_DATA,
+  *             the static arenas of the USBD_MAX_NUM_INSTANCES instances;
+  *          and breaks the build if MAX_STATIC_ALLOC_SIZE (in 32-bit words,
+  *          as used by USBD_static_malloc) is too small for the class data.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2015 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                      http://www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_core.h"
+#include "usbd_audio.h"
+#include "usbd_cdc.h"
+#include "usbd_customhid.h"
+#include "usbd_dfu.h"
+#include "usbd_hid.h"
+#include "usbd_msc.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+#define USBD_MEM_REPORT(name, size) \
+  const uint32_t USBD_MemReport_##name = (uint32_t)(size)
+
+#ifdef MAX_STATIC_ALLOC_SIZE
+#define USBD_MEM_CHECK(name) \
+  USBD_STATIC_ASSERT(USBD_##name##_CLASS_DATA_SIZE <= (MAX_STATIC_ALLOC_SIZE * 4U), MemReport_##name)
+#else
+#define USBD_MEM_CHECK(name) \
+  USBD_STATIC_ASSERT(1, MemReport_##name)
+#endif /* MAX_STATIC_ALLOC_SIZE */
+
+#if (USBD_STATIC_CLASS_DATA == 1U)
+#define USBD_MEM_ARENA(name) \
+  USBD_MEM_REPORT(name##_Arena, USBD_MAX_NUM_INSTANCES * USBD_##name##_CLASS_DATA_SIZE)
+#else
+#define USBD_MEM_ARENA(name) \
+  USBD_MEM_REPORT(name##_Arena, 0U)
+#endif /* USBD_STATIC_CLASS_DATA */
+
+#define USBD_MEM_REPORT_CLASS(name) \
+  USBD_MEM_REPORT(name, USBD_##name##_CLASS_DATA_SIZE); \
+  USBD_MEM_REPORT(name##_Config, USBD_MEM_CORE_SIZE + USBD_##name##_CONFIG_RAM_SIZE); \
+  USBD_MEM_ARENA(name); \
+  USBD_MEM_CHECK(name)
+
+/* Device core: device handle and string descriptor buffer (usbd_desc.c) */
+#define USBD_MEM_CORE_SIZE    (sizeof(USBD_HandleTypeDef) + USBD_MAX_STR_DESC_SIZ)
+
+/* Private variables ---------------------------------------------------------*/
+USBD_MEM_REPORT(Core, USBD_MEM_CORE_SIZE);
+USBD_MEM_REPORT(AUDIO_Ring, AUDIO_TOTAL_BUF_SIZE);
+USBD_MEM_REPORT(MSC_Buffer, MSC_MEDIA_PACKET);
+
+USBD_MEM_REPORT_CLASS(AUDIO);
+USBD_MEM_REPORT_CLASS(CDC);
+USBD_MEM_REPORT_CLASS(CUSTOM_HID);
+USBD_MEM_REPORT_CLASS(DFU);
+USBD_MEM_REPORT_CLASS(HID);
+USBD_MEM_REPORT_CLASS(MSC);
+
+/* Private function prototypes -----------------------------------------------*/
+/* Private functions ---------------------------------------------------------*/
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
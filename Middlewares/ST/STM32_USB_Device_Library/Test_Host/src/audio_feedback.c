@@ -0,0 +1,296 @@
+/*
+ * AUDIO class with the explicit feedback endpoint (USBD_AUDIO_FEEDBACK),
+ * built once per ring size (AUDIO_OUT_PACKET_NUM of 80, 16 and 8 packets).
+ *
+ * The host runs 1 ms full speed frames: each one starts with a SOF, reads the
+ * feedback endpoint when the class queued a value, and sends an OUT packet
+ * of the number of stereo samples the last feedback value asks for (10.14
+ * samples per frame, accumulated as a host driver does).  Every stereo
+ * sample carries its 32-bit index.
+ *
+ * The codec runs on its own clock: 48 kHz off by a fixed offset (-500 to
+ * +500 ppm) plus a slow wander of 20 ppm.  It reads the ring as a circular
+ * DMA does, calls USBD_AUDIO_Sync() at the half and full transfer points and
+ * checks the index of every sample it plays: a repeated or old index is an
+ * underrun, a skipped one an overrun.
+ *
+ * The checks cover the absence of underruns and overruns, the fill level
+ * staying within the ring and the feedback converging on the codec rate.
+ * The benchmark streams 2 hours per clock offset, and reports the fill level
+ * range (in stereo samples), the range and mean of the feedback read by the
+ * host once settled, against the mean codec offset.
+ */
+
+#include <math.h>
+
+#include "usbd_sim.h"
+#include "usbd_audio.h"
+#include "harness.h"
+
+#ifndef AUDIO_FEEDBACK_NAME
+#define AUDIO_FEEDBACK_NAME     "audio_feedback"
+#endif /* AUDIO_FEEDBACK_NAME */
+
+#define SAMPLE_SIZE             4U
+#define RING_SAMPLES            (AUDIO_TOTAL_BUF_SIZE / SAMPLE_SIZE)
+#define NOMINAL_SAMPLES         (USBD_AUDIO_FREQ / 1000U)
+
+#define WANDER_PPM              20.0
+#define WANDER_PERIOD_S         600.0
+
+/* Frames after which the feedback has settled, for the feedback checks */
+#define SETTLE_FRAMES           30000UL
+
+static USBD_HandleTypeDef hdev;
+static uint8_t cfg_desc[256];
+
+/* Codec: circular DMA over the ring */
+static uint8_t *dma_buf;
+static int dma_running;
+static uint32_t dma_pos;
+static uint32_t expected;
+static unsigned long underruns, overruns;
+
+static int8_t Codec_Init(uint32_t AudioFreq, uint32_t Volume, uint32_t options)
+{
+  dma_buf = NULL;
+  dma_running = 0;
+  return 0;
+}
+
+static int8_t Codec_DeInit(uint32_t options)
+{
+  dma_running = 0;
+  return 0;
+}
+
+static int8_t Codec_AudioCmd(uint8_t *pbuf, uint32_t size, uint8_t cmd)
+{
+  if (cmd == AUDIO_CMD_START)
+  {
+    /* Circular transfer of the whole ring, as the BSP codec drivers do */
+    dma_buf = pbuf;
+    dma_pos = 0U;
+    dma_running = 1;
+  }
+  return 0;
+}
+
+static int8_t Codec_VolumeCtl(uint8_t vol)
+{
+  return 0;
+}
+
+static int8_t Codec_MuteCtl(uint8_t cmd)
+{
+  return 0;
+}
+
+static int8_t Codec_PeriodicTC(uint8_t cmd)
+{
+  return 0;
+}
+
+static int8_t Codec_GetState(void)
+{
+  return 0;
+}
+
+static USBD_AUDIO_ItfTypeDef codec_fops =
+{
+  Codec_Init,
+  Codec_DeInit,
+  Codec_AudioCmd,
+  Codec_VolumeCtl,
+  Codec_MuteCtl,
+  Codec_PeriodicTC,
+  Codec_GetState,
+};
+
+/* Plays one stereo sample, calling the DMA half and full transfer
+   callbacks */
+static void Codec_Play(void)
+{
+  uint32_t index;
+
+  memcpy(&index, &dma_buf[dma_pos * SAMPLE_SIZE], sizeof(index));
+  if (index != expected)
+  {
+    if (index < expected)
+    {
+      underruns++;
+    }
+    else
+    {
+      overruns++;
+    }
+  }
+  expected = index + 1U;
+
+  dma_pos++;
+  if (dma_pos == (RING_SAMPLES / 2U))
+  {
+    USBD_AUDIO_Sync(&hdev, AUDIO_OFFSET_HALF);
+  }
+  else if (dma_pos == RING_SAMPLES)
+  {
+    dma_pos = 0U;
+    USBD_AUDIO_Sync(&hdev, AUDIO_OFFSET_FULL);
+  }
+}
+
+typedef struct
+{
+  double   ppm;
+  long     level_min;     /* samples buffered (sent but not played), after the start */
+  long     level_max;
+  double   fb_min_ppm;    /* feedback values read by the host, once settled */
+  double   fb_max_ppm;
+  double   fb_mean_ppm;
+  double   codec_mean_ppm;
+} Run_TypeDef;
+
+static void Run(Run_TypeDef *run, double ppm, unsigned long frames)
+{
+  uint8_t packet[AUDIO_OUT_MAX_PACKET];
+  uint8_t fb_buf[AUDIO_FB_PACKET];
+  uint32_t fb = AUDIO_FB_NOMINAL;
+  uint32_t fb_phase = 0U;
+  uint32_t sent = 0U;
+  uint32_t n, i;
+  unsigned long frame;
+  unsigned long fb_count = 0UL;
+  unsigned long settled = 0UL;
+  double fb_sum = 0.0;
+  double codec_sum = 0.0;
+  double codec_phase = 0.0;
+  double rate;
+  double fb_ppm;
+  long level;
+  int len;
+
+  memset(&hdev, 0, sizeof(hdev));
+  underruns = 0UL;
+  overruns = 0UL;
+  expected = 0U;
+
+  USBD_Init(&hdev, &USBD_SIM_Desc, 0U);
+  USBD_RegisterClass(&hdev, USBD_AUDIO_CLASS);
+  USBD_AUDIO_RegisterInterface(&hdev, &codec_fops);
+  USBD_Start(&hdev);
+
+  len = USBD_SIM_Enumerate(&hdev, cfg_desc, sizeof(cfg_desc));
+  CHECK(len == USB_AUDIO_CONFIG_DESC_SIZ);
+  CHECK(USBD_SIM_Control(&hdev, 0x01U, USB_REQ_SET_INTERFACE, 1U, 1U, 0U, NULL) == 0);
+
+  run->ppm = ppm;
+  run->level_min = (long)RING_SAMPLES;
+  run->level_max = 0L;
+  run->fb_min_ppm = 1e9;
+  run->fb_max_ppm = -1e9;
+
+  for (frame = 0UL; frame < frames; frame++)
+  {
+    USBD_SIM_Sof(&hdev);
+
+    /* Feedback endpoint, queued every 2^bRefresh frames */
+    if (USBD_SIM_In(&hdev, AUDIO_FB_EP, fb_buf, sizeof(fb_buf)) == (int)AUDIO_FB_PACKET)
+    {
+      fb = fb_buf[0] | (fb_buf[1] << 8) | ((uint32_t)fb_buf[2] << 16);
+      if (frame >= SETTLE_FRAMES)
+      {
+        fb_ppm = ((double)fb / (double)AUDIO_FB_NOMINAL - 1.0) * 1e6;
+        run->fb_min_ppm = MIN(run->fb_min_ppm, fb_ppm);
+        run->fb_max_ppm = MAX(run->fb_max_ppm, fb_ppm);
+        fb_sum += fb_ppm;
+        fb_count++;
+      }
+    }
+
+    /* OUT packet of the size the feedback asks for */
+    fb_phase += fb;
+    n = fb_phase >> 14;
+    fb_phase &= 0x3FFFU;
+    n = MIN(n, AUDIO_OUT_MAX_PACKET / SAMPLE_SIZE);
+    for (i = 0U; i < n; i++)
+    {
+      memcpy(&packet[i * SAMPLE_SIZE], &sent, sizeof(sent));
+      sent++;
+    }
+    CHECK(USBD_SIM_Out(&hdev, AUDIO_OUT_EP, packet, n * SAMPLE_SIZE) == (int)(n * SAMPLE_SIZE));
+
+    if (dma_running != 0)
+    {
+      level = (long)(sent - expected);
+      run->level_max = MAX(run->level_max, level);
+    }
+
+    /* Codec samples played during the frame */
+    rate = 1.0 + (ppm + WANDER_PPM * sin(2.0 * M_PI * (double)frame / (WANDER_PERIOD_S * 1000.0))) * 1e-6;
+    if (frame >= SETTLE_FRAMES)
+    {
+      codec_sum += (rate - 1.0) * 1e6;
+      settled++;
+    }
+    if (dma_running != 0)
+    {
+      codec_phase += (double)NOMINAL_SAMPLES * rate;
+      while (codec_phase >= 1.0)
+      {
+        codec_phase -= 1.0;
+        Codec_Play();
+      }
+
+      level = (long)(sent - expected);
+      run->level_min = MIN(run->level_min, level);
+    }
+  }
+
+  run->fb_mean_ppm = (fb_count != 0UL) ? fb_sum / (double)fb_count : 0.0;
+  run->codec_mean_ppm = (settled != 0UL) ? codec_sum / (double)settled : 0.0;
+
+  CHECK(USBD_SIM_Control(&hdev, 0x01U, USB_REQ_SET_INTERFACE, 0U, 1U, 0U, NULL) == 0);
+  USBD_DeInit(&hdev);
+}
+
+int main(int argc, char **argv)
+{
+  static const double ppms[] = { -500.0, -100.0, 0.0, 100.0, 500.0 };
+  Run_TypeDef run;
+  unsigned long frames;
+  uint32_t i;
+
+  harness_init(argc, argv);
+
+  /* 5 minutes per offset, 2 hours for the benchmark */
+  frames = (harness_bench != 0) ? 7200000UL : 300000UL;
+
+  if (harness_bench != 0)
+  {
+    printf("%s: ring %u packets (%u samples), %lu s per offset\n", AUDIO_FEEDBACK_NAME,
+           (unsigned)AUDIO_OUT_PACKET_NUM, (unsigned)RING_SAMPLES, frames / 1000UL);
+    printf("  codec ppm  level min..max  feedback ppm min..max  mean   codec mean  glitches\n");
+  }
+
+  for (i = 0U; i < (sizeof(ppms) / sizeof(ppms[0])); i++)
+  {
+    Run(&run, ppms[i], frames);
+
+    CHECK(underruns == 0UL);
+    CHECK(overruns == 0UL);
+    CHECK(run.level_min > 0L);
+    CHECK(run.level_max < (long)RING_SAMPLES);
+    CHECK(fabs(run.fb_mean_ppm - run.codec_mean_ppm) < 5.0);
+
+    if (harness_bench != 0)
+    {
+      printf("  %+9.0f  %9ld..%-4ld  %+9.1f..%-+9.1f  %+6.1f  %+6.1f      %lu\n",
+             run.ppm, run.level_min, run.level_max,
+             run.fb_min_ppm, run.fb_max_ppm, run.fb_mean_ppm, run.codec_mean_ppm,
+             underruns + overruns);
+    }
+  }
+
+  harness_exit(AUDIO_FEEDBACK_NAME);
+  return 0;
+}
@@ -0,0 +1,345 @@
+/*
+ * CustomHID stream transport (USBD_CUSTOMHID_STREAM): throughput and
+ * latency of the byte streams over 64-byte interrupt reports at full speed.
+ *
+ * The host runs 1 ms frames: each one starts with an OUT report when the
+ * host has one to send, and an IN poll of the interrupt endpoint.  Between
+ * frame starts the application writes on the IN stream (USBD_CUSTOM_HID_Write)
+ * and reads the OUT stream (USBD_CUSTOM_HID_Read), each byte carrying its
+ * position in the stream, at the times of the load pattern.
+ *
+ * IN patterns: saturated (the application writes whatever the queue takes,
+ * every 250 us), light (1 to 32 bytes at random times, 2 ms apart on
+ * average) and bursts (200 bytes every 10 ms).  OUT patterns: a reader
+ * emptying the queue every frame, and a slow one every 8 frames, which lets
+ * the queue of 4 reports fill up and the endpoint NAK.
+ *
+ * Checks: every byte received once and in order in both directions, the
+ * StreamEvent callback called once per OUT report and OutEvent never, IN
+ * rate of the saturated patterns at 63 bytes per frame, latency of the light
+ * pattern under 3 frames (a report in flight, the next one, and the one of
+ * a backlog of more than 63 bytes).  The benchmark runs 10 minutes per
+ * pattern and reports the rate in bytes/s, and the latency from the write of
+ * a byte to the IN transaction that carries it.
+ */
+
+#include "usbd_sim.h"
+#include "usbd_customhid.h"
+#include "harness.h"
+
+#define FRAME_US                1000U
+#define PAYLOAD                 (CUSTOM_HID_EPIN_SIZE - 1U)
+
+static USBD_HandleTypeDef hdev;
+static uint8_t cfg_desc[64];
+
+/* Vendor defined reports of CUSTOM_HID_EPIN_SIZE/CUSTOM_HID_EPOUT_SIZE
+   bytes, without report ID */
+static uint8_t report_desc[USBD_CUSTOM_HID_REPORT_DESC_SIZE] =
+{
+  0x06, 0x00, 0xFF,                     /* Usage Page (Vendor Defined)   */
+  0x09, 0x01,                           /* Usage (1)                     */
+  0xA1, 0x01,                           /* Collection (Application)      */
+  0x15, 0x00,                           /*   Logical Minimum (0)         */
+  0x26, 0xFF, 0x00,                     /*   Logical Maximum (255)       */
+  0x75, 0x08,                           /*   Report Size (8)             */
+  0x95, CUSTOM_HID_EPIN_SIZE,           /*   Report Count                */
+  0x09, 0x01,                           /*   Usage (1)                   */
+  0x81, 0x02,                           /*   Input (Data, Var, Abs)      */
+  0x95, CUSTOM_HID_EPOUT_SIZE,          /*   Report Count                */
+  0x09, 0x01,                           /*   Usage (1)                   */
+  0x91, 0x02,                           /*   Output (Data, Var, Abs)     */
+  0xC0                                  /* End Collection                */
+};
+
+static unsigned long out_events;
+static unsigned long stream_events;
+
+static int8_t App_Init(void)
+{
+  return 0;
+}
+
+static int8_t App_DeInit(void)
+{
+  return 0;
+}
+
+static int8_t App_OutEvent(uint8_t event_idx, uint8_t state)
+{
+  out_events++;
+  return 0;
+}
+
+static int8_t App_StreamEvent(uint16_t len)
+{
+  stream_events++;
+  return 0;
+}
+
+static USBD_CUSTOM_HID_ItfTypeDef app_fops =
+{
+  report_desc,
+  App_Init,
+  App_DeInit,
+  App_OutEvent,
+  App_StreamEvent,
+};
+
+typedef enum
+{
+  LOAD_NONE = 0,
+  LOAD_SATURATED,
+  LOAD_LIGHT,
+  LOAD_BURST,
+  READ_EVERY_FRAME,
+  READ_EVERY_8_FRAMES,
+} Load_TypeDef;
+
+typedef struct
+{
+  const char    *name;
+  Load_TypeDef  load;
+  double        rate;           /* payload bytes/s */
+  double        latency_mean;   /* us */
+  uint32_t      latency_max;
+  unsigned long naks;
+} Result_TypeDef;
+
+/* Write time of the IN stream bytes, indexed by stream position modulo the
+   window, larger than any backlog */
+#define WINDOW                  4096U
+static uint64_t write_us[WINDOW];
+
+static void Device_Start(void)
+{
+  memset(&hdev, 0, sizeof(hdev));
+  USBD_Init(&hdev, &USBD_SIM_Desc, 0U);
+  USBD_RegisterClass(&hdev, USBD_CUSTOM_HID_CLASS);
+  USBD_CUSTOM_HID_RegisterInterface(&hdev, &app_fops);
+  USBD_Start(&hdev);
+
+  CHECK(USBD_SIM_Enumerate(&hdev, cfg_desc, sizeof(cfg_desc)) == USB_CUSTOM_HID_CONFIG_DESC_SIZ);
+}
+
+/* IN stream: the application writes bytes in order from position *sent */
+static void App_Write(uint32_t *sent, uint32_t len, uint64_t now)
+{
+  uint8_t buf[USBD_CUSTOMHID_TX_QUEUE_SIZE];
+  uint32_t i;
+  uint16_t n;
+
+  len = MIN(len, (uint32_t)sizeof(buf));
+  for (i = 0U; i < len; i++)
+  {
+    buf[i] = (uint8_t)(*sent + i);
+    write_us[(*sent + i) % WINDOW] = now;
+  }
+  n = USBD_CUSTOM_HID_Write(&hdev, buf, (uint16_t)len);
+  *sent += n;
+}
+
+static void Run_In(Result_TypeDef *result, unsigned long frames)
+{
+  unsigned long seed = 1UL;
+  uint8_t report[CUSTOM_HID_EPIN_SIZE];
+  uint64_t frame_us;
+  uint64_t next_write = 0U;
+  uint64_t t;
+  uint64_t latency_sum = 0U;
+  unsigned long latency_count = 0UL;
+  uint32_t sent = 0U;
+  uint32_t received = 0U;
+  uint32_t latency;
+  uint32_t len;
+  uint32_t i;
+  unsigned long frame;
+  int errors = 0;
+
+  Device_Start();
+  result->latency_max = 0U;
+
+  for (frame = 0UL; frame < frames; frame++)
+  {
+    frame_us = (uint64_t)frame * FRAME_US;
+
+    /* IN transaction at the start of the frame */
+    if (USBD_SIM_In(&hdev, CUSTOM_HID_EPIN_ADDR, report, sizeof(report)) == (int)sizeof(report))
+    {
+      len = report[0];
+      CHECK(len <= PAYLOAD);
+      for (i = 0U; i < MIN(len, PAYLOAD); i++)
+      {
+        if (report[i + 1U] != (uint8_t)received)
+        {
+          errors++;
+        }
+        latency = (uint32_t)(frame_us - write_us[received % WINDOW]);
+        result->latency_max = MAX(result->latency_max, latency);
+        latency_sum += latency;
+        latency_count++;
+        received++;
+      }
+    }
+
+    /* Application writes during the frame */
+    while (next_write < (frame_us + FRAME_US))
+    {
+      t = MAX(next_write, frame_us + 1U);
+      switch (result->load)
+      {
+      case LOAD_SATURATED:
+        App_Write(&sent, USBD_CUSTOMHID_TX_QUEUE_SIZE, t);
+        next_write = t + 250U;
+        break;
+
+      case LOAD_LIGHT:
+        len = 1U + (uint32_t)(harness_rand(&seed) % 32UL);
+        App_Write(&sent, len, t);
+        CHECK((uint32_t)(sent - received) <= USBD_CUSTOMHID_TX_QUEUE_SIZE);
+        /* Uniform over 0 to 4 ms */
+        next_write = t + 1U + (harness_rand(&seed) % (4UL * FRAME_US));
+        break;
+
+      default:
+        App_Write(&sent, 200U, t);
+        next_write = t + (10U * FRAME_US);
+        break;
+      }
+    }
+  }
+
+  CHECK(errors == 0);
+  result->rate = (double)received / ((double)frames * FRAME_US / 1e6);
+  result->latency_mean = (latency_count != 0UL) ? (double)latency_sum / (double)latency_count : 0.0;
+  result->naks = 0UL;
+
+  USBD_DeInit(&hdev);
+}
+
+static void Run_Out(Result_TypeDef *result, unsigned long frames)
+{
+  uint8_t report[CUSTOM_HID_EPOUT_SIZE];
+  uint8_t buf[PAYLOAD];
+  uint32_t sent = 0U;
+  uint32_t received = 0U;
+  uint32_t i;
+  uint16_t len;
+  unsigned long frame;
+  unsigned long reports = 0UL;
+  int errors = 0;
+
+  Device_Start();
+  out_events = 0UL;
+  stream_events = 0UL;
+  result->naks = 0UL;
+
+  for (frame = 0UL; frame < frames; frame++)
+  {
+    /* OUT transaction at the start of the frame: a full report, sent again
+       on the next frame after a NAK */
+    report[0] = PAYLOAD;
+    for (i = 0U; i < PAYLOAD; i++)
+    {
+      report[i + 1U] = (uint8_t)(sent + i);
+    }
+    if (USBD_SIM_Out(&hdev, CUSTOM_HID_EPOUT_ADDR, report, sizeof(report)) < 0)
+    {
+      result->naks++;
+    }
+    else
+    {
+      sent += PAYLOAD;
+      reports++;
+    }
+
+    /* Application reads during the frame */
+    if ((result->load == READ_EVERY_FRAME) || ((frame % 8UL) == 7UL))
+    {
+      while ((len = USBD_CUSTOM_HID_Read(&hdev, buf, sizeof(buf))) != 0U)
+      {
+        for (i = 0U; i < len; i++)
+        {
+          if (buf[i] != (uint8_t)received)
+          {
+            errors++;
+          }
+          received++;
+        }
+      }
+    }
+  }
+
+  CHECK(errors == 0);
+  CHECK(stream_events == reports);
+  CHECK(out_events == 0UL);
+  result->rate = (double)received / ((double)frames * FRAME_US / 1e6);
+  result->latency_mean = 0.0;
+  result->latency_max = 0U;
+
+  USBD_DeInit(&hdev);
+}
+
+int main(int argc, char **argv)
+{
+  static Result_TypeDef results[] =
+  {
+    { "IN saturated",          LOAD_SATURATED },
+    { "IN light",              LOAD_LIGHT },
+    { "IN 200 B bursts",       LOAD_BURST },
+    { "OUT read every frame",  READ_EVERY_FRAME },
+    { "OUT read every 8",      READ_EVERY_8_FRAMES },
+  };
+  Result_TypeDef *r;
+  unsigned long frames;
+  uint32_t i;
+
+  harness_init(argc, argv);
+
+  /* 10 s per pattern, 10 minutes for the benchmark */
+  frames = (harness_bench != 0) ? 600000UL : 10000UL;
+
+  if (harness_bench != 0)
+  {
+    printf("customhid_stream: %u byte reports, TX queue %u bytes, RX queue %u reports, %lu s per pattern\n",
+           (unsigned)CUSTOM_HID_EPIN_SIZE, (unsigned)USBD_CUSTOMHID_TX_QUEUE_SIZE,
+           (unsigned)USBD_CUSTOMHID_RX_QUEUE_LEN, frames / 1000UL);
+    printf("  pattern                 bytes/s   latency mean     max    NAKs\n");
+  }
+
+  for (i = 0U; i < (sizeof(results) / sizeof(results[0])); i++)
+  {
+    r = &results[i];
+    if (r->load < READ_EVERY_FRAME)
+    {
+      Run_In(r, frames);
+    }
+    else
+    {
+      Run_Out(r, frames);
+    }
+
+    if (harness_bench != 0)
+    {
+      if (r->load < READ_EVERY_FRAME)
+      {
+        printf("  %-20s %10.0f   %9.0f us  %6u us\n", r->name, r->rate, r->latency_mean,
+               (unsigned)r->latency_max);
+      }
+      else
+      {
+        printf("  %-20s %10.0f                         %6lu\n", r->name, r->rate, r->naks);
+      }
+    }
+  }
+
+  /* One report per frame */
+  CHECK(results[0].rate >= (0.99 * PAYLOAD * 1000.0));
+  CHECK(results[1].latency_max < (3U * FRAME_US));
+  CHECK(results[3].rate >= (0.99 * PAYLOAD * 1000.0));
+  CHECK(results[3].naks == 0UL);
+  CHECK(results[4].naks != 0UL);
+
+  harness_exit("customhid_stream");
+  return 0;
+}
@@ -0,0 +1,590 @@
+/*
+ * DFU download timing, built without (dfu_timing_sync) and with the
+ * pipelined download (dfu_timing_pipeline, USBD_DFU_PIPELINE).
+ *
+ * The host plays dfu-util downloading a DfuSe image: it erases every page of
+ * the image with the ERASE command, then sends each block as a SET_ADDRESS
+ * command followed by a DNLOAD, polling GETSTATUS with the bwPollTimeout of
+ * the device in between, and leaves with a zero-length DNLOAD.  A control
+ * transfer costs CTRL_US plus PACKET_US per data packet, a sleep overshoots
+ * by SLEEP_US.
+ *
+ * The media follows the template interface of usbd_dfu_media_template.c over
+ * a simulated flash: an erase or a program takes the time of the media
+ * profile, and programming a byte that is not erased is an error.  Without
+ * pipeline the media calls run in the USB interrupt, which delays the status
+ * stage of the request.  With the pipeline they run in the device main loop
+ * (a coroutine calling USBD_DFU_Process()), interrupted by the requests and
+ * by the start of frames of the host.  dfu_timing_pipeline runs the download
+ * without and with the erase-ahead (EraseSize callback), and checks that a
+ * bus reset and a new enumeration during a media operation (fast replug) do
+ * not fail.
+ *
+ * Checks: image programmed and read back, nothing programmed over unerased
+ * bytes, no media call while the media is not initialized, device reset at
+ * the end of the download.  The benchmark downloads a larger image, and
+ * reports the download time and rate per media profile.
+ */
+
+#include <setjmp.h>
+#include <ucontext.h>
+
+#include "usbd_sim.h"
+#include "usbd_dfu.h"
+#include "harness.h"
+
+#ifndef DFU_TIMING_NAME
+#define DFU_TIMING_NAME         "dfu_timing"
+#endif /* DFU_TIMING_NAME */
+
+/* Host timings, in us */
+#define CTRL_US                 200U
+#define PACKET_US               64U
+#define SLEEP_US                60U
+
+/* Idle period of the device main loop, in us */
+#define LOOP_US                 20U
+
+#define FLASH_BASE              0x08000000U
+#define FLASH_SIZE              (512U * 1024U)
+#define IMAGE_ADDR              USBD_DFU_APP_DEFAULT_ADD
+#define OLD_CONTENT             0x5AU
+
+#define DFUSE_SET_ADDRESS       0x21U
+#define DFUSE_ERASE             0x41U
+
+typedef struct
+{
+  const char *name;
+  uint32_t    page_size;        /* erase unit, in bytes */
+  uint32_t    erase_us;         /* per page */
+  uint32_t    prog_us;          /* per KB */
+  uint16_t    erase_poll;       /* bwPollTimeout declared by GetStatus, in ms */
+  uint16_t    prog_poll;
+} Profile_TypeDef;
+
+static const Profile_TypeDef profiles[] =
+{
+  /* 1 KB sectors programmed by half pages, as declared by the L1 DFU
+     application (usbd_dfu_flash.c) */
+  { "1 KB sectors, 13 ms erase, 51 ms/KB", 1024U, 13000U, 51000U, 50U, 50U },
+  /* 2 KB pages programmed by double words */
+  { "2 KB pages, 22 ms erase, 12 ms/KB", 2048U, 22000U, 12000U, 25U, 15U },
+};
+
+static USBD_HandleTypeDef hdev;
+static uint8_t cfg_desc[64];
+
+/* Simulated time -----------------------------------------------------------*/
+
+static uint64_t now_us;
+static uint64_t next_sof_us;
+/* End of the media operation run by the USB interrupt */
+static uint64_t irq_busy_until;
+
+#if (USBD_DFU_PIPELINE == 1U)
+static ucontext_t host_ctx;
+static ucontext_t device_ctx;
+static uint8_t device_stack[256U * 1024U];
+static int in_device;
+static uint64_t device_wake_us;
+
+/* Lets the host run until the device main loop wakes up */
+static void Device_Sleep(uint64_t us)
+{
+  device_wake_us = now_us + us;
+  in_device = 0;
+  swapcontext(&device_ctx, &host_ctx);
+  in_device = 1;
+}
+
+static void Device_Main(void)
+{
+  for (;;)
+  {
+    USBD_DFU_Process(&hdev);
+    Device_Sleep(LOOP_US);
+  }
+}
+#endif /* USBD_DFU_PIPELINE */
+
+/* Host waits: the start of frames and the device main loop run meanwhile */
+static void Host_Wait(uint64_t us)
+{
+  uint64_t end = now_us + us;
+  uint64_t t;
+
+  for (;;)
+  {
+    t = MIN(end, next_sof_us);
+#if (USBD_DFU_PIPELINE == 1U)
+    t = MIN(t, device_wake_us);
+#endif /* USBD_DFU_PIPELINE */
+    now_us = MAX(now_us, t);
+
+    if (now_us >= next_sof_us)
+    {
+      next_sof_us += 1000U;
+      USBD_SIM_Sof(&hdev);
+    }
+#if (USBD_DFU_PIPELINE == 1U)
+    else if (now_us >= device_wake_us)
+    {
+      in_device = 1;
+      swapcontext(&host_ctx, &device_ctx);
+      in_device = 0;
+    }
+#endif /* USBD_DFU_PIPELINE */
+    else if (now_us >= end)
+    {
+      break;
+    }
+  }
+}
+
+/* Media --------------------------------------------------------------------*/
+
+static const Profile_TypeDef *profile;
+static uint8_t flash[FLASH_SIZE];
+static int media_ready;
+static unsigned long media_errors;   /* media call while not initialized */
+static unsigned long prog_errors;    /* byte programmed while not erased */
+static unsigned long erases;
+static uint64_t media_us;            /* total erase and program time */
+static int media_active;             /* media operation of the main loop running */
+
+static void Media_Busy(uint64_t us)
+{
+  media_us += us;
+#if (USBD_DFU_PIPELINE == 1U)
+  if (in_device != 0)
+  {
+    media_active = 1;
+    Device_Sleep(us);
+    media_active = 0;
+    return;
+  }
+#endif /* USBD_DFU_PIPELINE */
+  irq_busy_until = MAX(irq_busy_until, now_us) + us;
+}
+
+static uint16_t Flash_Init(void)
+{
+  media_ready = 1;
+  return 0U;
+}
+
+static uint16_t Flash_DeInit(void)
+{
+  media_ready = 0;
+  return 0U;
+}
+
+static uint16_t Flash_Erase(uint32_t Add)
+{
+  if ((Add < FLASH_BASE) || ((Add - FLASH_BASE) >= FLASH_SIZE))
+  {
+    return 1U;
+  }
+  if (media_ready == 0)
+  {
+    media_errors++;
+  }
+  Add -= (Add - FLASH_BASE) % profile->page_size;
+  Media_Busy(profile->erase_us);
+  memset(&flash[Add - FLASH_BASE], 0xFF, profile->page_size);
+  erases++;
+  return 0U;
+}
+
+static uint16_t Flash_Write(uint8_t *src, uint8_t *dest, uint32_t Len)
+{
+  uint32_t addr = (uint32_t)(uintptr_t)dest;
+  uint32_t i;
+
+  if ((addr < FLASH_BASE) || ((addr - FLASH_BASE + Len) > FLASH_SIZE))
+  {
+    return 1U;
+  }
+  if (media_ready == 0)
+  {
+    media_errors++;
+  }
+  Media_Busy(((uint64_t)profile->prog_us * Len) / 1024U);
+  for (i = 0U; i < Len; i++)
+  {
+    if (flash[addr - FLASH_BASE + i] != 0xFFU)
+    {
+      prog_errors++;
+    }
+    flash[addr - FLASH_BASE + i] = src[i];
+  }
+  return 0U;
+}
+
+static uint8_t *Flash_Read(uint8_t *src, uint8_t *dest, uint32_t Len)
+{
+  return &flash[(uint32_t)(uintptr_t)src - FLASH_BASE];
+}
+
+static uint16_t Flash_GetStatus(uint32_t Add, uint8_t Cmd, uint8_t *buffer)
+{
+  uint16_t poll = (Cmd == DFU_MEDIA_ERASE) ? profile->erase_poll : profile->prog_poll;
+
+  buffer[1] = (uint8_t)poll;
+  buffer[2] = (uint8_t)(poll >> 8);
+  buffer[3] = 0U;
+  return 0U;
+}
+
+#if (USBD_DFU_PIPELINE == 1U)
+static uint32_t Flash_EraseSize(uint32_t Add)
+{
+  return ((Add >= FLASH_BASE) && ((Add - FLASH_BASE) < FLASH_SIZE)) ? profile->page_size : 0U;
+}
+#endif /* USBD_DFU_PIPELINE */
+
+static USBD_DFU_MediaTypeDef flash_fops =
+{
+  (uint8_t *)"@Internal Flash   /0x08000000/512*001Kg",
+  Flash_Init,
+  Flash_DeInit,
+  Flash_Erase,
+  Flash_Write,
+  Flash_Read,
+  Flash_GetStatus,
+};
+
+/* Host ---------------------------------------------------------------------*/
+
+static jmp_buf reset_jmp;
+static int device_reset;
+static unsigned long requests;
+
+static void Host_Reset(void)
+{
+  device_reset = 1;
+  longjmp(reset_jmp, 1);
+}
+
+static void Host_Sleep(uint32_t ms)
+{
+  if (ms != 0U)
+  {
+    Host_Wait(((uint64_t)ms * 1000U) + SLEEP_US);
+  }
+}
+
+static int Host_Control(uint8_t bmRequest, uint8_t bRequest, uint16_t wValue,
+                        uint16_t wLength, uint8_t *data)
+{
+  int len;
+
+  /* The interrupt still runs a media operation: the request waits */
+  if (irq_busy_until > now_us)
+  {
+    Host_Wait(irq_busy_until - now_us);
+  }
+  Host_Wait(CTRL_US + (PACKET_US * ((wLength + USB_MAX_EP0_SIZE - 1U) / USB_MAX_EP0_SIZE)));
+  requests++;
+  len = USBD_SIM_Control(&hdev, bmRequest, bRequest, wValue, 0U, wLength, data);
+
+  /* Status stage once the interrupt returns */
+  if (irq_busy_until > now_us)
+  {
+    Host_Wait(irq_busy_until - now_us);
+  }
+  return len;
+}
+
+/* GETSTATUS: returns bwPollTimeout, or -1 */
+static int Host_GetStatus(uint8_t *status)
+{
+  if (Host_Control(0xA1U, DFU_GETSTATUS, 0U, 6U, status) != 6)
+  {
+    return -1;
+  }
+  return status[1] | (status[2] << 8) | (status[3] << 16);
+}
+
+/* DNLOAD of a DfuSe command */
+static int Host_Dnload(uint8_t cmd, uint32_t addr)
+{
+  uint8_t buf[5];
+
+  buf[0] = cmd;
+  buf[1] = (uint8_t)addr;
+  buf[2] = (uint8_t)(addr >> 8);
+  buf[3] = (uint8_t)(addr >> 16);
+  buf[4] = (uint8_t)(addr >> 24);
+  return (Host_Control(0x21U, DFU_DNLOAD, 0U, sizeof(buf), buf) == (int)sizeof(buf)) ? 0 : -1;
+}
+
+/* DfuSe command, as dfuse_special_command() of dfu-util */
+static int Host_Command(uint8_t cmd, uint32_t addr)
+{
+  uint8_t status[6];
+  int poll;
+
+  if (Host_Dnload(cmd, addr) != 0)
+  {
+    return -1;
+  }
+
+  poll = Host_GetStatus(status);
+  if ((poll < 0) || (status[4] != DFU_STATE_DNLOAD_BUSY))
+  {
+    return -1;
+  }
+  Host_Sleep((uint32_t)poll);
+
+  for (;;)
+  {
+    poll = Host_GetStatus(status);
+    if ((poll < 0) || (status[0] != DFU_ERROR_NONE))
+    {
+      return -1;
+    }
+    if (status[4] != DFU_STATE_DNLOAD_BUSY)
+    {
+      return 0;
+    }
+    Host_Sleep((uint32_t)poll);
+  }
+}
+
+/* DNLOAD of a block, as dfuse_dnload_chunk() of dfu-util */
+static int Host_Block(const uint8_t *data, uint32_t len)
+{
+  uint8_t status[6];
+  int poll;
+
+  if (Host_Control(0x21U, DFU_DNLOAD, 2U, (uint16_t)len, (uint8_t *)data) != (int)len)
+  {
+    return -1;
+  }
+
+  do
+  {
+    poll = Host_GetStatus(status);
+    if ((poll < 0) || (status[4] == DFU_STATE_ERROR))
+    {
+      return -1;
+    }
+    Host_Sleep((uint32_t)poll);
+  } while (status[4] != DFU_STATE_DNLOAD_IDLE);
+
+  return 0;
+}
+
+/* Zero-length DNLOAD, then GETSTATUS until the device resets */
+static int Host_Leave(void)
+{
+  uint8_t status[6];
+  uint32_t i;
+  int poll;
+
+  if (Host_Control(0x21U, DFU_DNLOAD, 2U, 0U, NULL) != 0)
+  {
+    return -1;
+  }
+
+  for (i = 0U; i < 1000U; i++)
+  {
+    poll = Host_GetStatus(status);
+    if ((poll < 0) || (status[4] == DFU_STATE_ERROR))
+    {
+      return -1;
+    }
+    Host_Sleep((uint32_t)poll);
+  }
+  return -1;
+}
+
+/* Run ----------------------------------------------------------------------*/
+
+typedef struct
+{
+  uint64_t       total_us;
+  uint64_t       media_us;
+  unsigned long  requests;
+} Result_TypeDef;
+
+static uint8_t image[512U * 1024U];
+
+static void Device_Start(void)
+{
+  memset(&hdev, 0, sizeof(hdev));
+  irq_busy_until = now_us;
+
+  USBD_Init(&hdev, &USBD_SIM_Desc, 0U);
+  USBD_RegisterClass(&hdev, USBD_DFU_CLASS);
+  USBD_DFU_RegisterMedia(&hdev, &flash_fops);
+  USBD_Start(&hdev);
+
+#if (USBD_DFU_PIPELINE == 1U)
+  getcontext(&device_ctx);
+  device_ctx.uc_stack.ss_sp = device_stack;
+  device_ctx.uc_stack.ss_size = sizeof(device_stack);
+  device_ctx.uc_link = NULL;
+  makecontext(&device_ctx, Device_Main, 0);
+  device_wake_us = now_us;
+#endif /* USBD_DFU_PIPELINE */
+}
+
+/* Downloads the image of size len; with replug, the host enumerates the
+   device again in the middle of the erase of the first page */
+static int Download(uint32_t len, int replug)
+{
+  uint8_t status[6];
+  uint32_t addr;
+  uint32_t block;
+
+  if (setjmp(reset_jmp) != 0)
+  {
+    return 0;
+  }
+
+  if (USBD_SIM_Enumerate(&hdev, cfg_desc, sizeof(cfg_desc)) != USB_DFU_CONFIG_DESC_SIZ)
+  {
+    return -1;
+  }
+
+  if (replug != 0)
+  {
+    if ((Host_Dnload(DFUSE_ERASE, IMAGE_ADDR) != 0) || (Host_GetStatus(status) < 0))
+    {
+      return -1;
+    }
+    Host_Wait(profile->erase_us / 2U);
+    CHECK(media_active != 0);
+    if (USBD_SIM_Enumerate(&hdev, cfg_desc, sizeof(cfg_desc)) != USB_DFU_CONFIG_DESC_SIZ)
+    {
+      return -1;
+    }
+  }
+
+  for (addr = IMAGE_ADDR; addr < (IMAGE_ADDR + len); addr += profile->page_size)
+  {
+    if (Host_Command(DFUSE_ERASE, addr) != 0)
+    {
+      return -1;
+    }
+  }
+
+  for (block = 0U; (block * USBD_DFU_XFER_SIZE) < len; block++)
+  {
+    addr = IMAGE_ADDR + (block * USBD_DFU_XFER_SIZE);
+    if ((Host_Command(DFUSE_SET_ADDRESS, addr) != 0) ||
+        (Host_Block(&image[block * USBD_DFU_XFER_SIZE],
+                    MIN(USBD_DFU_XFER_SIZE, len - (block * USBD_DFU_XFER_SIZE))) != 0))
+    {
+      return -1;
+    }
+  }
+
+  return Host_Leave();
+}
+
+static void Run(Result_TypeDef *result, const Profile_TypeDef *p, uint32_t len, int ahead, int replug)
+{
+  uint64_t start;
+  uint32_t pages;
+
+  profile = p;
+  memset(flash, OLD_CONTENT, sizeof(flash));
+  media_errors = 0UL;
+  prog_errors = 0UL;
+  erases = 0UL;
+  media_us = 0U;
+  requests = 0UL;
+  device_reset = 0;
+
+#if (USBD_DFU_PIPELINE == 1U)
+  flash_fops.EraseSize = (ahead != 0) ? Flash_EraseSize : NULL;
+#endif /* USBD_DFU_PIPELINE */
+
+  Device_Start();
+  start = now_us;
+  CHECK(Download(len, replug) == 0);
+
+  result->total_us = now_us - start;
+  result->media_us = media_us;
+  result->requests = requests;
+
+  CHECK(device_reset != 0);
+  CHECK(memcmp(&flash[IMAGE_ADDR - FLASH_BASE], image, len) == 0);
+  CHECK(flash[IMAGE_ADDR - FLASH_BASE - 1U] == OLD_CONTENT);
+  CHECK(prog_errors == 0UL);
+  CHECK(media_errors == 0UL);
+  pages = (len + p->page_size - 1U) / p->page_size;
+  CHECK((replug != 0) ? (erases >= pages) : (erases == pages));
+}
+
+static void Print(const char *mode, uint32_t len, const Result_TypeDef *result)
+{
+  printf("  %-22s %9.1f ms  %6.1f KB/s  %5.1f %% media busy  %lu requests\n", mode,
+         (double)result->total_us / 1000.0,
+         ((double)len / 1024.0) / ((double)result->total_us / 1e6),
+         100.0 * (double)result->media_us / (double)result->total_us,
+         result->requests);
+}
+
+int main(int argc, char **argv)
+{
+  unsigned long seed = 1UL;
+  Result_TypeDef result;
+#if (USBD_DFU_PIPELINE == 1U)
+  Result_TypeDef ahead;
+#endif /* USBD_DFU_PIPELINE */
+  uint32_t len;
+  uint32_t i;
+
+  harness_init(argc, argv);
+  USBD_SIM_ResetHook = Host_Reset;
+
+  /* Not a multiple of the pages nor of the blocks */
+  len = (harness_bench != 0) ? ((256U * 1024U) - 100U) : ((32U * 1024U) - 100U);
+  for (i = 0U; i < len; i++)
+  {
+    image[i] = (uint8_t)harness_rand(&seed);
+  }
+
+  if (harness_bench != 0)
+  {
+    printf("%s: %lu bytes, %u byte blocks\n", DFU_TIMING_NAME, (unsigned long)len,
+           (unsigned)USBD_DFU_XFER_SIZE);
+  }
+
+  for (i = 0U; i < (sizeof(profiles) / sizeof(profiles[0])); i++)
+  {
+    if (harness_bench != 0)
+    {
+      printf(" %s\n", profiles[i].name);
+    }
+
+#if (USBD_DFU_PIPELINE == 1U)
+    Run(&result, &profiles[i], len, 0, 0);
+    Run(&ahead, &profiles[i], len, 1, 0);
+    /* The erase-ahead only hides the host round trips of the erases */
+    CHECK(ahead.total_us <= result.total_us);
+    if (harness_bench != 0)
+    {
+      Print("pipeline", len, &result);
+      Print("pipeline, erase-ahead", len, &ahead);
+    }
+
+    Run(&result, &profiles[i], len, 0, 1);
+    Run(&result, &profiles[i], len, 1, 1);
+#else
+    Run(&result, &profiles[i], len, 0, 0);
+    if (harness_bench != 0)
+    {
+      Print("synchronous", len, &result);
+    }
+#endif /* USBD_DFU_PIPELINE */
+  }
+
+  harness_exit(DFU_TIMING_NAME);
+  return 0;
+}
@@ -0,0 +1,63 @@
+/*
+ * Helpers shared by the host test and benchmark programs.  Each program is a
+ * single source file built with the core and one class: it includes this
+ * header once.
+ */
+
+#ifndef HARNESS_H
+#define HARNESS_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Number of failed checks, reported by harness_exit() */
+static unsigned long harness_failures;
+
+/* Set when the program is run with the "bench" argument: the figures are
+   then measured on longer runs, and printed */
+static int harness_bench;
+
+#define CHECK(x)                                                            \
+  do {                                                                      \
+    if (!(x))                                                               \
+    {                                                                       \
+      printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #x);          \
+      harness_failures++;                                                   \
+    }                                                                       \
+  } while (0)
+
+/* Monotonic time, in nanoseconds */
+static inline double harness_now(void)
+{
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (double)t.tv_sec * 1e9 + (double)t.tv_nsec;
+}
+
+/* Small deterministic generator, so that every run replays the same
+   sequence */
+static inline unsigned long harness_rand(unsigned long *state)
+{
+  *state = *state * 1103515245UL + 12345UL;
+  return (*state >> 8) & 0xffffffUL;
+}
+
+static inline void harness_init(int argc, char **argv)
+{
+  harness_bench = (argc > 1) && (strcmp(argv[1], "bench") == 0);
+  setvbuf(stdout, NULL, _IOLBF, 0);
+}
+
+/* Ends the program with the test verdict */
+static inline void harness_exit(const char *name)
+{
+  printf("%s: %s (%lu failed checks)\n", name,
+         (harness_failures == 0U) ? "PASS" : "FAIL", harness_failures);
+  fflush(stdout);
+  exit((harness_failures == 0U) ? 0 : 1);
+}
+
+#endif /* HARNESS_H */
@@ -0,0 +1,63 @@
+/*
+ * USB device library configuration of the host programs: the defines of
+ * Core/Inc/usbd_conf_template.h, with host replacements for the HAL.  Each
+ * program may override the class options with -D (see the Makefile).
+ */
+
+#ifndef __USBD_CONF_H
+#define __USBD_CONF_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define USBD_MAX_NUM_INTERFACES               1U
+#define USBD_MAX_NUM_CONFIGURATION            1U
+#define USBD_MAX_STR_DESC_SIZ                 0x100U
+#define USBD_SUPPORT_USER_STRING              0U
+#define USBD_SELF_POWERED                     1U
+#define USBD_DEBUG_LEVEL                      0U
+
+#ifndef USBD_STATIC_CLASS_DATA
+#define USBD_STATIC_CLASS_DATA                1U
+#endif /* USBD_STATIC_CLASS_DATA */
+#define USBD_MAX_NUM_INSTANCES                1U
+
+/* MSC Class Config */
+#define MSC_MEDIA_PACKET                      512U
+
+/* DFU Class Config */
+#define USBD_DFU_MAX_ITF_NUM                  1U
+#define USBD_DFU_XFER_SIZE                    1024U
+#define USBD_DFU_APP_DEFAULT_ADD              0x08007000U
+
+/* AUDIO Class Config */
+#define USBD_AUDIO_FREQ                       48000U
+
+/* Memory management macros */
+#define USBD_malloc               malloc
+#define USBD_free                 free
+#define USBD_memset               memset
+#define USBD_memcpy               memcpy
+
+#define USBD_UsrLog(...) do {} while (0)
+#define USBD_ErrLog(...) do {} while (0)
+#define USBD_DbgLog(...) do {} while (0)
+
+/* HAL replacements */
+#define __IO                      volatile
+#define UNUSED(x)                 ((void)(x))
+
+typedef struct
+{
+  struct
+  {
+    uint32_t maxpacket;
+  } IN_ep[16];
+} PCD_HandleTypeDef;
+
+void NVIC_SystemReset(void);
+void USBD_Delay(uint32_t Delay);
+
+#endif /* __USBD_CONF_H */
@@ -0,0 +1,376 @@
+/*
+ * Host simulation of the USB device controller, see usbd_sim.h.
+ */
+
+#include "usbd_sim.h"
+
+USBD_SIM_EPTypeDef USBD_SIM_EpIn[16];
+USBD_SIM_EPTypeDef USBD_SIM_EpOut[16];
+void (*USBD_SIM_DelayHook)(uint32_t Delay);
+void (*USBD_SIM_ResetHook)(void);
+
+static PCD_HandleTypeDef USBD_SIM_Pcd;
+
+static USBD_SIM_EPTypeDef *USBD_SIM_Ep(uint8_t ep_addr)
+{
+  return ((ep_addr & 0x80U) != 0U) ? &USBD_SIM_EpIn[ep_addr & 0xFU] :
+                                     &USBD_SIM_EpOut[ep_addr & 0xFU];
+}
+
+/* Device descriptors ------------------------------------------------------*/
+
+static uint8_t USBD_SIM_DeviceDesc[USB_LEN_DEV_DESC] =
+{
+  0x12, USB_DESC_TYPE_DEVICE, 0x00, 0x02, 0x00, 0x00, 0x00, USB_MAX_EP0_SIZE,
+  0x83, 0x04, 0x00, 0x00, 0x00, 0x02, 0x01, 0x02, 0x03, 0x01
+};
+
+static uint8_t USBD_SIM_LangIDDesc[USB_LEN_LANGID_STR_DESC] =
+{
+  USB_LEN_LANGID_STR_DESC, USB_DESC_TYPE_STRING, 0x09, 0x04
+};
+
+static uint8_t USBD_SIM_StrDesc[USBD_MAX_STR_DESC_SIZ];
+
+static uint8_t *USBD_SIM_DeviceDescriptor(USBD_SpeedTypeDef speed, uint16_t *length)
+{
+  *length = sizeof(USBD_SIM_DeviceDesc);
+  return USBD_SIM_DeviceDesc;
+}
+
+static uint8_t *USBD_SIM_LangIDStrDescriptor(USBD_SpeedTypeDef speed, uint16_t *length)
+{
+  *length = sizeof(USBD_SIM_LangIDDesc);
+  return USBD_SIM_LangIDDesc;
+}
+
+static uint8_t *USBD_SIM_StrDescriptor(USBD_SpeedTypeDef speed, uint16_t *length)
+{
+  USBD_GetString((uint8_t *)"Host simulation", USBD_SIM_StrDesc, length);
+  return USBD_SIM_StrDesc;
+}
+
+USBD_DescriptorsTypeDef USBD_SIM_Desc =
+{
+  USBD_SIM_DeviceDescriptor,
+  USBD_SIM_LangIDStrDescriptor,
+  USBD_SIM_StrDescriptor,
+  USBD_SIM_StrDescriptor,
+  USBD_SIM_StrDescriptor,
+  USBD_SIM_StrDescriptor,
+  USBD_SIM_StrDescriptor,
+};
+
+/* Low level driver --------------------------------------------------------*/
+
+USBD_StatusTypeDef USBD_LL_Init(USBD_HandleTypeDef *pdev)
+{
+  memset(USBD_SIM_EpIn, 0, sizeof(USBD_SIM_EpIn));
+  memset(USBD_SIM_EpOut, 0, sizeof(USBD_SIM_EpOut));
+  pdev->pData = &USBD_SIM_Pcd;
+  return USBD_OK;
+}
+
+USBD_StatusTypeDef USBD_LL_DeInit(USBD_HandleTypeDef *pdev)
+{
+  return USBD_OK;
+}
+
+USBD_StatusTypeDef USBD_LL_Start(USBD_HandleTypeDef *pdev)
+{
+  return USBD_OK;
+}
+
+USBD_StatusTypeDef USBD_LL_Stop(USBD_HandleTypeDef *pdev)
+{
+  return USBD_OK;
+}
+
+USBD_StatusTypeDef USBD_LL_OpenEP(USBD_HandleTypeDef *pdev, uint8_t ep_addr,
+                                  uint8_t ep_type, uint16_t ep_mps)
+{
+  USBD_SIM_EPTypeDef *ep = USBD_SIM_Ep(ep_addr);
+
+  memset(ep, 0, sizeof(*ep));
+  ep->open = 1U;
+  ep->type = ep_type;
+  ep->mps = ep_mps;
+  if ((ep_addr & 0x80U) != 0U)
+  {
+    USBD_SIM_Pcd.IN_ep[ep_addr & 0xFU].maxpacket = ep_mps;
+  }
+  return USBD_OK;
+}
+
+USBD_StatusTypeDef USBD_LL_CloseEP(USBD_HandleTypeDef *pdev, uint8_t ep_addr)
+{
+  USBD_SIM_EPTypeDef *ep = USBD_SIM_Ep(ep_addr);
+
+  ep->open = 0U;
+  ep->armed = 0U;
+  return USBD_OK;
+}
+
+USBD_StatusTypeDef USBD_LL_FlushEP(USBD_HandleTypeDef *pdev, uint8_t ep_addr)
+{
+  USBD_SIM_Ep(ep_addr)->armed = 0U;
+  return USBD_OK;
+}
+
+USBD_StatusTypeDef USBD_LL_StallEP(USBD_HandleTypeDef *pdev, uint8_t ep_addr)
+{
+  USBD_SIM_Ep(ep_addr)->stall = 1U;
+  return USBD_OK;
+}
+
+USBD_StatusTypeDef USBD_LL_ClearStallEP(USBD_HandleTypeDef *pdev, uint8_t ep_addr)
+{
+  USBD_SIM_Ep(ep_addr)->stall = 0U;
+  return USBD_OK;
+}
+
+uint8_t USBD_LL_IsStallEP(USBD_HandleTypeDef *pdev, uint8_t ep_addr)
+{
+  return USBD_SIM_Ep(ep_addr)->stall;
+}
+
+USBD_StatusTypeDef USBD_LL_SetUSBAddress(USBD_HandleTypeDef *pdev, uint8_t dev_addr)
+{
+  return USBD_OK;
+}
+
+USBD_StatusTypeDef USBD_LL_Transmit(USBD_HandleTypeDef *pdev, uint8_t ep_addr,
+                                    uint8_t *pbuf, uint16_t size)
+{
+  USBD_SIM_EPTypeDef *ep = USBD_SIM_Ep(ep_addr | 0x80U);
+
+  ep->buf = pbuf;
+  ep->len = size;
+  ep->rx_size = 0U;
+  ep->armed = 1U;
+  return USBD_OK;
+}
+
+USBD_StatusTypeDef USBD_LL_PrepareReceive(USBD_HandleTypeDef *pdev, uint8_t ep_addr,
+                                          uint8_t *pbuf, uint16_t size)
+{
+  USBD_SIM_EPTypeDef *ep = USBD_SIM_Ep(ep_addr & 0x7FU);
+
+  ep->buf = pbuf;
+  ep->len = size;
+  ep->rx_size = 0U;
+  ep->armed = 1U;
+  return USBD_OK;
+}
+
+uint32_t USBD_LL_GetRxDataSize(USBD_HandleTypeDef *pdev, uint8_t ep_addr)
+{
+  return USBD_SIM_EpOut[ep_addr & 0xFU].rx_size;
+}
+
+void USBD_LL_Delay(uint32_t Delay)
+{
+  if (USBD_SIM_DelayHook != NULL)
+  {
+    USBD_SIM_DelayHook(Delay);
+  }
+}
+
+void USBD_Delay(uint32_t Delay)
+{
+  USBD_LL_Delay(Delay);
+}
+
+void NVIC_SystemReset(void)
+{
+  if (USBD_SIM_ResetHook != NULL)
+  {
+    USBD_SIM_ResetHook();
+  }
+  printf("NVIC_SystemReset called\n");
+  exit(3);
+}
+
+/* Host side ---------------------------------------------------------------*/
+
+int USBD_SIM_Control(USBD_HandleTypeDef *pdev, uint8_t bmRequest,
+                     uint8_t bRequest, uint16_t wValue, uint16_t wIndex,
+                     uint16_t wLength, uint8_t *data)
+{
+  USBD_SIM_EPTypeDef *in = &USBD_SIM_EpIn[0];
+  USBD_SIM_EPTypeDef *out = &USBD_SIM_EpOut[0];
+  uint8_t setup[8];
+  uint32_t done = 0U;
+  uint32_t chunk;
+
+  setup[0] = bmRequest;
+  setup[1] = bRequest;
+  setup[2] = LOBYTE(wValue);
+  setup[3] = HIBYTE(wValue);
+  setup[4] = LOBYTE(wIndex);
+  setup[5] = HIBYTE(wIndex);
+  setup[6] = LOBYTE(wLength);
+  setup[7] = HIBYTE(wLength);
+
+  /* A SETUP packet clears the control endpoint stall */
+  in->stall = 0U;
+  out->stall = 0U;
+  in->armed = 0U;
+  out->armed = 0U;
+  USBD_LL_SetupStage(pdev, setup);
+
+  if ((wLength != 0U) && ((bmRequest & 0x80U) != 0U))
+  {
+    /* Data IN stage, one max packet per transaction */
+    for (;;)
+    {
+      if (in->stall != 0U)
+      {
+        return -1;
+      }
+      if (in->armed == 0U)
+      {
+        return -1;
+      }
+      chunk = MIN(MIN(in->len, (uint32_t)USB_MAX_EP0_SIZE), wLength - done);
+      if (chunk != 0U)
+      {
+        memcpy(&data[done], in->buf, chunk);
+      }
+      done += chunk;
+      in->armed = 0U;
+      USBD_LL_DataInStage(pdev, 0U, (in->buf != NULL) ? in->buf + chunk : NULL);
+      if ((chunk < USB_MAX_EP0_SIZE) || (done >= wLength))
+      {
+        break;
+      }
+    }
+
+    /* Status OUT stage */
+    if (out->armed == 0U)
+    {
+      return -1;
+    }
+    out->armed = 0U;
+    out->rx_size = 0U;
+    USBD_LL_DataOutStage(pdev, 0U, NULL);
+    return (int)done;
+  }
+
+  if (wLength != 0U)
+  {
+    /* Data OUT stage */
+    while (done < wLength)
+    {
+      if ((out->stall != 0U) || (out->armed == 0U))
+      {
+        return -1;
+      }
+      chunk = MIN(MIN(out->len, (uint32_t)USB_MAX_EP0_SIZE), wLength - done);
+      memcpy(out->buf, &data[done], chunk);
+      done += chunk;
+      out->armed = 0U;
+      out->rx_size = chunk;
+      USBD_LL_DataOutStage(pdev, 0U, out->buf + chunk);
+    }
+  }
+
+  /* Status IN stage */
+  if ((in->stall != 0U) || (in->armed == 0U))
+  {
+    return -1;
+  }
+  in->armed = 0U;
+  USBD_LL_DataInStage(pdev, 0U, NULL);
+  return (int)done;
+}
+
+int USBD_SIM_Enumerate(USBD_HandleTypeDef *pdev, uint8_t *cfg,
+                       uint16_t cfg_size)
+{
+  uint8_t dev[USB_LEN_DEV_DESC];
+  int len;
+
+  USBD_LL_SetSpeed(pdev, USBD_SPEED_FULL);
+  USBD_LL_Reset(pdev);
+
+  if (USBD_SIM_Control(pdev, 0x80U, USB_REQ_GET_DESCRIPTOR,
+                       USB_DESC_TYPE_DEVICE << 8, 0U, sizeof(dev), dev) != (int)sizeof(dev))
+  {
+    return -1;
+  }
+  if (USBD_SIM_Control(pdev, 0x00U, USB_REQ_SET_ADDRESS, 1U, 0U, 0U, NULL) < 0)
+  {
+    return -1;
+  }
+  if (USBD_SIM_Control(pdev, 0x80U, USB_REQ_GET_DESCRIPTOR,
+                       USB_DESC_TYPE_CONFIGURATION << 8, 0U, USB_LEN_CFG_DESC, cfg) != USB_LEN_CFG_DESC)
+  {
+    return -1;
+  }
+  len = cfg[2] | (cfg[3] << 8);
+  if ((len > cfg_size) ||
+      (USBD_SIM_Control(pdev, 0x80U, USB_REQ_GET_DESCRIPTOR,
+                        USB_DESC_TYPE_CONFIGURATION << 8, 0U, (uint16_t)len, cfg) != len))
+  {
+    return -1;
+  }
+  if (USBD_SIM_Control(pdev, 0x00U, USB_REQ_SET_CONFIGURATION, 1U, 0U, 0U, NULL) < 0)
+  {
+    return -1;
+  }
+  return len;
+}
+
+int USBD_SIM_Out(USBD_HandleTypeDef *pdev, uint8_t ep_addr,
+                 const uint8_t *data, uint32_t len)
+{
+  USBD_SIM_EPTypeDef *ep = &USBD_SIM_EpOut[ep_addr & 0xFU];
+  uint32_t chunk;
+
+  if ((ep->armed == 0U) || (ep->stall != 0U))
+  {
+    return -1;
+  }
+  chunk = MIN(MIN(len, (uint32_t)ep->mps), ep->len - ep->rx_size);
+  memcpy(ep->buf + ep->rx_size, data, chunk);
+  ep->rx_size += chunk;
+
+  /* Transfer complete on a short packet or when the buffer is full */
+  if ((chunk < ep->mps) || (ep->rx_size == ep->len))
+  {
+    ep->armed = 0U;
+    USBD_LL_DataOutStage(pdev, ep_addr & 0xFU, ep->buf);
+  }
+  return (int)chunk;
+}
+
+int USBD_SIM_In(USBD_HandleTypeDef *pdev, uint8_t ep_addr, uint8_t *data,
+                uint32_t max)
+{
+  USBD_SIM_EPTypeDef *ep = &USBD_SIM_EpIn[ep_addr & 0xFU];
+  uint32_t chunk;
+
+  if ((ep->armed == 0U) || (ep->stall != 0U))
+  {
+    return -1;
+  }
+  chunk = MIN(MIN(ep->len - ep->rx_size, (uint32_t)ep->mps), max);
+  if (chunk != 0U)
+  {
+    memcpy(data, ep->buf + ep->rx_size, chunk);
+  }
+  ep->rx_size += chunk;
+
+  if (ep->rx_size == ep->len)
+  {
+    ep->armed = 0U;
+    USBD_LL_DataInStage(pdev, ep_addr & 0xFU, ep->buf);
+  }
+  return (int)chunk;
+}
+
+void USBD_SIM_Sof(USBD_HandleTypeDef *pdev)
+{
+  USBD_LL_SOF(pdev);
+}
@@ -0,0 +1,63 @@
+/*
+ * Host simulation of the USB device controller: the USBD_LL_* functions of
+ * Core/Src/usbd_conf_template.c, keeping the state of each endpoint, and a
+ * host side that runs control transfers, OUT and IN transactions and start
+ * of frames through the USBD_LL_* callbacks of the core, as the HAL PCD
+ * interrupt handler does on target.
+ */
+
+#ifndef __USBD_SIM_H
+#define __USBD_SIM_H
+
+#include "usbd_core.h"
+#include "usbd_ctlreq.h"
+
+typedef struct
+{
+  uint8_t  *buf;          /* buffer given to USBD_LL_Transmit/PrepareReceive */
+  uint32_t len;           /* length of the transfer */
+  uint32_t rx_size;       /* bytes of the last OUT transfer */
+  uint16_t mps;
+  uint8_t  type;
+  uint8_t  open;
+  uint8_t  armed;
+  uint8_t  stall;
+} USBD_SIM_EPTypeDef;
+
+extern USBD_SIM_EPTypeDef USBD_SIM_EpIn[16];
+extern USBD_SIM_EPTypeDef USBD_SIM_EpOut[16];
+extern USBD_DescriptorsTypeDef USBD_SIM_Desc;
+
+/* Called by USBD_Delay() and USBD_LL_Delay(), in ms, when set */
+extern void (*USBD_SIM_DelayHook)(uint32_t Delay);
+
+/* Called by NVIC_SystemReset() when set, which must not return (longjmp);
+   else the program exits with status 3 */
+extern void (*USBD_SIM_ResetHook)(void);
+
+/* Control transfer: returns the data stage length, or -1 when the device
+   stalls the request */
+int USBD_SIM_Control(USBD_HandleTypeDef *pdev, uint8_t bmRequest,
+                     uint8_t bRequest, uint16_t wValue, uint16_t wIndex,
+                     uint16_t wLength, uint8_t *data);
+
+/* Bus reset, device descriptor, SET_ADDRESS, configuration descriptor (cfg,
+   of size cfg_size) and SET_CONFIGURATION 1: returns the configuration
+   descriptor length, or -1 */
+int USBD_SIM_Enumerate(USBD_HandleTypeDef *pdev, uint8_t *cfg,
+                       uint16_t cfg_size);
+
+/* OUT transaction on a non-control endpoint: returns -1 (NAK) when no
+   reception is prepared, else the number of bytes taken */
+int USBD_SIM_Out(USBD_HandleTypeDef *pdev, uint8_t ep_addr,
+                 const uint8_t *data, uint32_t len);
+
+/* IN transaction on a non-control endpoint, of at most one max packet (the
+   transfer completes on a short packet): returns -1 (NAK) when nothing is
+   queued, else the packet length */
+int USBD_SIM_In(USBD_HandleTypeDef *pdev, uint8_t ep_addr, uint8_t *data,
+                uint32_t max);
+
+void USBD_SIM_Sof(USBD_HandleTypeDef *pdev);
+
+#endif /* __USBD_SIM_H */
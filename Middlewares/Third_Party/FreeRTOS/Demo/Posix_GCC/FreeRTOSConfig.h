@@ -0,0 +1,91 @@
+/*
+ * FreeRTOS configuration of the host test and benchmark programs, built on
+ * the POSIX/Linux simulator port (see readme.txt).  The settings a program
+ * needs to vary are guarded so that the Makefile can set them with -D.
+ */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#define configUSE_PREEMPTION                    1
+#ifndef configUSE_IDLE_HOOK
+#define configUSE_IDLE_HOOK                     0
+#endif
+#ifndef configUSE_TICK_HOOK
+#define configUSE_TICK_HOOK                     0
+#endif
+#define configCPU_CLOCK_HZ                      ( 1000000UL )
+#define configTICK_RATE_HZ                      ( ( TickType_t ) 1000 )
+/* The CMSIS-RTOS v2 programs build with 56 priorities (osPriorityISR) and
+with static allocation (see CMSIS_V2 in the Makefile). */
+#ifndef configMAX_PRIORITIES
+#define configMAX_PRIORITIES                    ( 7 )
+#endif
+#define configMINIMAL_STACK_SIZE                ( ( uint16_t ) 128 )
+#ifndef configTOTAL_HEAP_SIZE
+#define configTOTAL_HEAP_SIZE                   ( ( size_t ) ( 256 * 1024 ) )
+#endif
+#define configMAX_TASK_NAME_LEN                 ( 16 )
+#define configUSE_TRACE_FACILITY                1
+#define configUSE_16_BIT_TICKS                  0
+#define configIDLE_SHOULD_YIELD                 1
+#define configUSE_MUTEXES                       1
+#define configQUEUE_REGISTRY_SIZE               8
+#define configCHECK_FOR_STACK_OVERFLOW          0
+#define configUSE_RECURSIVE_MUTEXES             1
+#define configUSE_MALLOC_FAILED_HOOK            0
+#define configUSE_APPLICATION_TASK_TAG          0
+#define configUSE_COUNTING_SEMAPHORES           1
+#define configUSE_QUEUE_SETS                    1
+#define configGENERATE_RUN_TIME_STATS           1
+#define configUSE_STATS_FORMATTING_FUNCTIONS    1
+#ifndef configSUPPORT_STATIC_ALLOCATION
+#define configSUPPORT_STATIC_ALLOCATION         0
+#endif
+#define configSUPPORT_DYNAMIC_ALLOCATION        1
+
+/* Software timer definitions. */
+#define configUSE_TIMERS                        1
+#ifndef configTIMER_TASK_PRIORITY
+#define configTIMER_TASK_PRIORITY               ( 5 )
+#endif
+#ifndef configTIMER_QUEUE_LENGTH
+#define configTIMER_QUEUE_LENGTH                16
+#endif
+#define configTIMER_TASK_STACK_DEPTH            ( configMINIMAL_STACK_SIZE * 2 )
+
+/* Set the following definitions to 1 to include the API function, or zero
+to exclude the API function. */
+#define INCLUDE_vTaskPrioritySet                1
+#define INCLUDE_uxTaskPriorityGet               1
+#define INCLUDE_vTaskDelete                     1
+#define INCLUDE_vTaskCleanUpResources           0
+#define INCLUDE_vTaskSuspend                    1
+#define INCLUDE_vTaskDelayUntil                 1
+#define INCLUDE_vTaskDelay                      1
+#define INCLUDE_xTaskGetCurrentTaskHandle       1
+#define INCLUDE_xTaskGetSchedulerState          1
+#define INCLUDE_uxTaskGetStackHighWaterMark     1
+#define INCLUDE_xTimerPendFunctionCall          1
+#define INCLUDE_eTaskGetState                   1
+#define INCLUDE_xSemaphoreGetMutexHolder        1
+#define INCLUDE_xTaskGetIdleTaskHandle          1
+
+/* The tickless_lp programs set configUSE_TICKLESS_IDLE, and run the tickless
+idle mode of the ARM_CM3 port on a simulated MCU (src/tickless_lp.c). */
+#if defined( configUSE_TICKLESS_IDLE ) && ( configUSE_TICKLESS_IDLE != 0 )
+void vSimSuppressTicksAndSleep( uint32_t ulExpectedIdleTime );
+#define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime ) vSimSuppressTicksAndSleep( xExpectedIdleTime )
+#endif
+
+/* A failed assertion ends the program with an error. */
+void vAssertCalled( const char *pcFile, int iLine );
+#define configASSERT( x ) if( ( x ) == 0 ) { vAssertCalled( __FILE__, __LINE__ ); }
+
+/* The programs built with a Utilities/CPU module include its trace macros,
+named by the Makefile. */
+#ifdef HOST_TRACE_HEADER
+#include HOST_TRACE_HEADER
+#endif
+
+#endif /* FREERTOS_CONFIG_H */
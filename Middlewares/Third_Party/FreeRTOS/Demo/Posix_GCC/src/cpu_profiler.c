@@ -0,0 +1,364 @@
+/*
+ * Task profiler of Utilities/CPU (cpu_profiler.c), fed by the trace macros
+ * of cpu_profiler_trace.h, with the host clock as timebase (src/main.h).
+ *
+ * The tasks cover every wait kind and the two kinds of wake ups: a task
+ * delayed by one tick, a task notified from an application interrupt (the
+ * tick hook, flagged as a peripheral interrupt), a producer and a consumer on
+ * a queue of one item (receive and send waits), an event group and a mutex
+ * shared by a low priority task that holds it for 3 ms and a high priority
+ * one.  The queue and the mutex are watched with PROF_WatchObject().
+ *
+ * The checks read a snapshot: header fields, one record per task with its
+ * priority, switches, stack and run times adding up to the elapsed time,
+ * tick wake ups kept out of max_isr_wakeup, histogram counts matching their
+ * bins and their maximum, then a buffer too small, PROF_Reset(),
+ * PROF_GetCPULoad() and the PROF_MAX_OBJECTS limit of PROF_WatchObject().
+ *
+ * The benchmark runs the tasks for 20 s and prints the snapshot.
+ */
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "event_groups.h"
+#include "cpu_profiler.h"
+#include "harness.h"
+
+#define STACK_DEPTH     256
+#define HOLD_NS         3000000UL
+#define ISR_PERIOD      3
+#define TASK_COUNT      10          /* Those of the program, idle and timer tasks */
+
+volatile BaseType_t xSimPeripheralIsr = pdFALSE;
+
+static TaskHandle_t xIsrRx;
+static QueueHandle_t xQueue;
+static SemaphoreHandle_t xBus;
+static EventGroupHandle_t xEvent;
+static double dStart;
+
+static uint32_t ulSnapshot[ PROF_SNAPSHOT_SIZE / sizeof( uint32_t ) ];
+
+/* Application interrupt, every ISR_PERIOD ticks. */
+void vApplicationTickHook( void )
+{
+static unsigned long ulTicks;
+BaseType_t xWoken = pdFALSE;
+
+    if( ( xIsrRx != NULL ) && ( ( ++ulTicks % ISR_PERIOD ) == 0 ) )
+    {
+        xSimPeripheralIsr = pdTRUE;
+        vTaskNotifyGiveFromISR( xIsrRx, &xWoken );
+        xSimPeripheralIsr = pdFALSE;
+    }
+}
+
+static void prvTicker( void *pvParameters )
+{
+    for( ;; )
+    {
+        vTaskDelay( 1 );
+    }
+}
+
+static void prvIsrRx( void *pvParameters )
+{
+    for( ;; )
+    {
+        ( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+    }
+}
+
+/* Two items in a row on a queue of one: the second send waits for the
+consumer. */
+static void prvProducer( void *pvParameters )
+{
+uint32_t ulItem = 0;
+
+    for( ;; )
+    {
+        ( void ) xQueueSend( xQueue, &ulItem, portMAX_DELAY );
+        ulItem++;
+        ( void ) xQueueSend( xQueue, &ulItem, portMAX_DELAY );
+        ulItem++;
+        ( void ) xEventGroupSetBits( xEvent, 0x01 );
+        vTaskDelay( 2 );
+    }
+}
+
+static void prvConsumer( void *pvParameters )
+{
+uint32_t ulItem;
+
+    for( ;; )
+    {
+        ( void ) xQueueReceive( xQueue, &ulItem, portMAX_DELAY );
+    }
+}
+
+static void prvEventWaiter( void *pvParameters )
+{
+    for( ;; )
+    {
+        ( void ) xEventGroupWaitBits( xEvent, 0x01, pdTRUE, pdFALSE, portMAX_DELAY );
+    }
+}
+
+static void prvLow( void *pvParameters )
+{
+uint32_t ulStart;
+
+    for( ;; )
+    {
+        ( void ) xSemaphoreTake( xBus, portMAX_DELAY );
+        ulStart = ulHostTimestamp();
+        while( ( uint32_t ) ( ulHostTimestamp() - ulStart ) < HOLD_NS )
+        {
+        }
+        ( void ) xSemaphoreGive( xBus );
+        vTaskDelay( 1 );
+    }
+}
+
+static void prvHigh( void *pvParameters )
+{
+    for( ;; )
+    {
+        vTaskDelay( 2 );
+        ( void ) xSemaphoreTake( xBus, portMAX_DELAY );
+        ( void ) xSemaphoreGive( xBus );
+    }
+}
+
+static PROF_SnapshotTask_t *prvFindTask( const PROF_SnapshotHeader_t *pxHeader, const char *pcName )
+{
+PROF_SnapshotTask_t *pxTask = ( PROF_SnapshotTask_t * ) ( pxHeader + 1 );
+uint32_t i;
+
+    for( i = 0; i < pxHeader->task_count; i++, pxTask++ )
+    {
+        if( strncmp( pxTask->name, pcName, PROF_NAME_LEN ) == 0 )
+        {
+            return pxTask;
+        }
+    }
+    printf( "task %s: no record\n", pcName );
+    return NULL;
+}
+
+static PROF_SnapshotHist_t *prvHist( const PROF_SnapshotHeader_t *pxHeader, uint32_t ulIndex )
+{
+    return ( PROF_SnapshotHist_t * ) ( ( PROF_SnapshotTask_t * ) ( pxHeader + 1 ) + pxHeader->task_count ) + ulIndex;
+}
+
+static uint64_t prvRunTime( const PROF_SnapshotTask_t *pxTask )
+{
+    return ( ( uint64_t ) pxTask->runtime_hi << 32 ) | pxTask->runtime_lo;
+}
+
+/* Task record of one of the program tasks. */
+static void prvCheckTask( const PROF_SnapshotHeader_t *pxHeader, const char *pcName, uint32_t ulPriority )
+{
+PROF_SnapshotTask_t *pxTask = prvFindTask( pxHeader, pcName );
+
+    CHECK( pxTask != NULL );
+    if( pxTask != NULL )
+    {
+        /* Low inherits the priority of High while it holds the mutex */
+        CHECK( ( pxTask->priority == ulPriority ) || ( ( ulPriority == 1 ) && ( pxTask->priority == 3 ) ) );
+        CHECK( pxTask->switches > 0 );
+        CHECK( prvRunTime( pxTask ) > 0 );
+        CHECK( pxTask->max_isr_wakeup <= pxTask->max_latency );
+        CHECK( ( pxTask->stack_free > 0 ) && ( pxTask->stack_free <= STACK_DEPTH * sizeof( StackType_t ) ) );
+    }
+}
+
+/* The bins add up to the count, and the last used bin holds the maximum. */
+static void prvCheckHist( const PROF_SnapshotHist_t *pxHist, const char *pcName, uint32_t ulKind )
+{
+uint32_t ulSum = 0, ulLast = 0, i;
+
+    CHECK( strncmp( pxHist->name, pcName, PROF_NAME_LEN ) == 0 );
+    CHECK( pxHist->kind == ulKind );
+    CHECK( pxHist->count > 0 );
+    for( i = 0; i < PROF_HIST_BINS; i++ )
+    {
+        ulSum += pxHist->bins[ i ];
+        if( pxHist->bins[ i ] != 0 )
+        {
+            ulLast = i;
+        }
+    }
+    CHECK( ulSum == pxHist->count );
+    if( ulLast == 0 )
+    {
+        CHECK( pxHist->max < ( 1UL << PROF_HIST_SHIFT ) );
+    }
+    else
+    {
+        CHECK( pxHist->max >= ( 1UL << ( PROF_HIST_SHIFT + ulLast - 1 ) ) );
+        CHECK( ( ulLast == PROF_HIST_BINS - 1 ) || ( pxHist->max < ( 1UL << ( PROF_HIST_SHIFT + ulLast ) ) ) );
+    }
+}
+
+static void prvPrint( const PROF_SnapshotHeader_t *pxHeader, double dElapsed, uint16_t usLoad )
+{
+const PROF_SnapshotTask_t *pxTask = ( const PROF_SnapshotTask_t * ) ( pxHeader + 1 );
+const PROF_SnapshotHist_t *pxHist;
+uint32_t i, j;
+
+    printf( "cpu_profiler: %.1f s, snapshot %u bytes, CPU load %u%% (last second)\n", dElapsed / 1e9,
+            ( unsigned ) pxHeader->size, ( unsigned ) usLoad );
+    printf( "  task          prio  run time  switches  max latency  max ISR wake up  stack free\n" );
+    for( i = 0; i < pxHeader->task_count; i++, pxTask++ )
+    {
+        printf( "  %-12.16s %5u  %7.2f%%  %8u  %8.1f us  %12.1f us  %8u B\n", pxTask->name, ( unsigned ) pxTask->priority,
+                ( double ) prvRunTime( pxTask ) * 100.0 / dElapsed, ( unsigned ) pxTask->switches,
+                pxTask->max_latency / 1e3, pxTask->max_isr_wakeup / 1e3, ( unsigned ) pxTask->stack_free );
+    }
+    printf( "  wait        count       max  histogram (bin n: waits under 2^(%u+n) ns)\n", ( unsigned ) pxHeader->hist_shift );
+    for( i = 0; i < pxHeader->hist_count; i++ )
+    {
+        pxHist = prvHist( pxHeader, i );
+        printf( "  %-8.16s %8u %6.0f us ", pxHist->name, ( unsigned ) pxHist->count, pxHist->max / 1e3 );
+        for( j = 0; j < pxHeader->hist_bins; j++ )
+        {
+            printf( " %u", ( unsigned ) pxHist->bins[ j ] );
+        }
+        printf( "\n" );
+    }
+}
+
+static void prvTestTask( void *pvParameters )
+{
+static const char *pcKinds[ PROF_WAIT_KINDS ] = { "receive", "send", "notify", "event" };
+PROF_SnapshotHeader_t *pxHeader = ( PROF_SnapshotHeader_t * ) ulSnapshot;
+PROF_SnapshotTask_t *pxTask;
+uint32_t ulSize, ulSwitches, ulCount, i;
+uint64_t ullRunTime = 0;
+int iSeconds = ( xHarnessBench != 0 ) ? 20 : 2, s;
+uint16_t usLoad = 0;
+double dElapsed;
+
+    xQueue = xQueueCreate( 1, sizeof( uint32_t ) );
+    xBus = xSemaphoreCreateMutex();
+    xEvent = xEventGroupCreate();
+    CHECK( ( xQueue != NULL ) && ( xBus != NULL ) && ( xEvent != NULL ) );
+    CHECK( PROF_WatchObject( xQueue, "queue" ) == 0 );
+    CHECK( PROF_WatchObject( xBus, "bus" ) == 0 );
+
+    xTaskCreate( prvTicker, "Ticker", STACK_DEPTH, NULL, 3, NULL );
+    xTaskCreate( prvIsrRx, "IsrRx", STACK_DEPTH, NULL, 4, &xIsrRx );
+    xTaskCreate( prvProducer, "Producer", STACK_DEPTH, NULL, 2, NULL );
+    xTaskCreate( prvConsumer, "Consumer", STACK_DEPTH, NULL, 2, NULL );
+    xTaskCreate( prvEventWaiter, "EventWaiter", STACK_DEPTH, NULL, 2, NULL );
+    xTaskCreate( prvLow, "Low", STACK_DEPTH, NULL, 1, NULL );
+    xTaskCreate( prvHigh, "High", STACK_DEPTH, NULL, 3, NULL );
+
+    /* The load is measured over one second: the timestamp wraps after
+    4.3 s */
+    for( s = 0; s < iSeconds; s++ )
+    {
+        ( void ) PROF_GetCPULoad();
+        vTaskDelay( pdMS_TO_TICKS( 1000 ) );
+        usLoad = PROF_GetCPULoad();
+    }
+
+    ulSize = PROF_Snapshot( ulSnapshot, sizeof( ulSnapshot ) );
+    dElapsed = dHarnessNow() - dStart;
+
+    /* Header */
+    CHECK( ulSize == pxHeader->size );
+    CHECK( pxHeader->magic == PROF_SNAPSHOT_MAGIC );
+    CHECK( pxHeader->version == PROF_SNAPSHOT_VERSION );
+    CHECK( pxHeader->timestamp_freq == PROF_TIMESTAMP_FREQ );
+    CHECK( pxHeader->task_count == TASK_COUNT );
+    CHECK( pxHeader->hist_count == PROF_WAIT_KINDS + 2 );
+    CHECK( pxHeader->hist_bins == PROF_HIST_BINS );
+    CHECK( pxHeader->hist_shift == PROF_HIST_SHIFT );
+    CHECK( ulSize == sizeof( PROF_SnapshotHeader_t ) + pxHeader->task_count * sizeof( PROF_SnapshotTask_t ) +
+                     pxHeader->hist_count * sizeof( PROF_SnapshotHist_t ) );
+
+    /* Tasks: the run times cover the elapsed time */
+    prvCheckTask( pxHeader, "Ticker", 3 );
+    prvCheckTask( pxHeader, "IsrRx", 4 );
+    prvCheckTask( pxHeader, "Producer", 2 );
+    prvCheckTask( pxHeader, "Consumer", 2 );
+    prvCheckTask( pxHeader, "EventWaiter", 2 );
+    prvCheckTask( pxHeader, "Low", 1 );
+    prvCheckTask( pxHeader, "High", 3 );
+    CHECK( prvFindTask( pxHeader, "Test" ) != NULL );
+    CHECK( prvFindTask( pxHeader, "IDLE" ) != NULL );
+    pxTask = ( PROF_SnapshotTask_t * ) ( pxHeader + 1 );
+    for( i = 0; i < pxHeader->task_count; i++ )
+    {
+        ullRunTime += prvRunTime( &pxTask[ i ] );
+    }
+    CHECK( ( ( double ) ullRunTime > 0.9 * dElapsed ) && ( ( double ) ullRunTime <= dElapsed ) );
+    CHECK( ( iSeconds < 5 ) || ( prvFindTask( pxHeader, "Low" )->runtime_hi != 0 ) );
+
+    /* Wake ups: the end of a delay is not an interrupt wake up, the
+    notification from the application interrupt is */
+    pxTask = prvFindTask( pxHeader, "Ticker" );
+    CHECK( ( pxTask->max_latency > 0 ) && ( pxTask->max_isr_wakeup == 0 ) );
+    pxTask = prvFindTask( pxHeader, "IsrRx" );
+    CHECK( pxTask->max_isr_wakeup > 0 );
+
+    /* Histograms: the wait kinds, then the watched objects */
+    for( i = 0; i < PROF_WAIT_KINDS; i++ )
+    {
+        prvCheckHist( prvHist( pxHeader, i ), pcKinds[ i ], i );
+    }
+    prvCheckHist( prvHist( pxHeader, PROF_WAIT_KINDS ), "queue", PROF_HIST_OBJECT );
+    prvCheckHist( prvHist( pxHeader, PROF_WAIT_KINDS + 1 ), "bus", PROF_HIST_OBJECT );
+    CHECK( prvHist( pxHeader, PROF_WAIT_KINDS )->count + prvHist( pxHeader, PROF_WAIT_KINDS + 1 )->count <=
+           prvHist( pxHeader, PROF_WAIT_RECEIVE )->count + prvHist( pxHeader, PROF_WAIT_SEND )->count );
+    CHECK( prvHist( pxHeader, PROF_WAIT_KINDS + 1 )->max >= HOLD_NS / 2 );
+
+    CHECK( ( usLoad > 0 ) && ( usLoad <= 100 ) );
+
+    if( xHarnessBench != 0 )
+    {
+        prvPrint( pxHeader, dElapsed, usLoad );
+    }
+
+    /* A buffer too small is left untouched */
+    memset( ulSnapshot, 0, sizeof( ulSnapshot ) );
+    CHECK( PROF_Snapshot( ulSnapshot, ulSize - 1 ) == 0 );
+    CHECK( pxHeader->magic == 0 );
+    CHECK( PROF_Snapshot( NULL, ulSize ) == 0 );
+
+    /* Reset: the counts start again, the tasks and objects stay */
+    ulSize = PROF_Snapshot( ulSnapshot, sizeof( ulSnapshot ) );
+    ulSwitches = prvFindTask( pxHeader, "Ticker" )->switches;
+    ulCount = prvHist( pxHeader, PROF_WAIT_RECEIVE )->count;
+    PROF_Reset();
+    CHECK( PROF_Snapshot( ulSnapshot, sizeof( ulSnapshot ) ) == ulSize );
+    CHECK( prvFindTask( pxHeader, "Ticker" )->switches < ulSwitches );
+    CHECK( prvHist( pxHeader, PROF_WAIT_RECEIVE )->count < ulCount );
+    CHECK( prvHist( pxHeader, PROF_WAIT_KINDS + 1 )->max < HOLD_NS / 2 );
+
+    /* PROF_MAX_OBJECTS watched objects, renaming does not take a slot */
+    CHECK( PROF_WatchObject( xBus, "mutex" ) == 0 );
+    for( i = 2; i < PROF_MAX_OBJECTS; i++ )
+    {
+        CHECK( PROF_WatchObject( &ulSnapshot[ i ], "dummy" ) == 0 );
+    }
+    CHECK( PROF_WatchObject( &ulSnapshot[ 0 ], "dummy" ) == -1 );
+    CHECK( PROF_Snapshot( ulSnapshot, sizeof( ulSnapshot ) ) ==
+           ulSize + ( PROF_MAX_OBJECTS - 2 ) * sizeof( PROF_SnapshotHist_t ) );
+    CHECK( strcmp( prvHist( pxHeader, PROF_WAIT_KINDS + 1 )->name, "mutex" ) == 0 );
+
+    vHarnessExit( "cpu_profiler" );
+}
+
+int main( int argc, char **argv )
+{
+    vHarnessInit( argc, argv );
+    xTaskCreate( prvTestTask, "Test", 8192, NULL, 5, NULL );
+    dStart = dHarnessNow();
+    vTaskStartScheduler();
+    return 1;
+}
@@ -0,0 +1,450 @@
+/*
+ * Event tracer of Utilities/CPU (cpu_tracer.c), fed by the trace macros of
+ * cpu_tracer_trace.h, with the host clock as timebase (src/main.h).
+ *
+ * The tasks cover the traced kernel objects: a producer and a consumer on a
+ * queue of one item, an event group, a mutex shared by a low priority task
+ * that holds it for 3 ms and a high priority one (priority inheritance), and
+ * an application interrupt (the tick hook) notifying a task and sending to a
+ * stream buffer.  The objects are named with vQueueAddToRegistry() and
+ * TRC_NameObject().
+ *
+ * The trace is recorded three times and written to CPU_TRACER_OUT followed
+ * by _snapshot.bin, _stream.bin and _stream_slow.bin, which the Makefile
+ * decodes with Tools/cpu_tracer_decode.py:
+ *   - snapshot mode: TRC_Snapshot() after the ring has wrapped;
+ *   - stream mode, the header then TRC_Read() every tick;
+ *   - stream mode read every 50 ms, the ring overflowing in between.
+ *
+ * The checks read the traces: header fields, task and object tables, every
+ * event written with a known code and timestamps in order, interrupt events
+ * flagged, the mutex inheritance recorded, no event lost by the stream read
+ * every tick and the losses of the slow one reported by TRC_EV_LOST events.
+ *
+ * The benchmark records the streams for 10 s instead of 0.5 s.
+ */
+
+#include <errno.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "event_groups.h"
+#include "stream_buffer.h"
+#include "cpu_tracer.h"
+#include "harness.h"
+
+#ifndef CPU_TRACER_OUT
+#define CPU_TRACER_OUT  "cpu_tracer"
+#endif
+
+#define STACK_DEPTH     256
+#define HOLD_NS         3000000UL
+#define ISR_PERIOD      3
+#define STREAM_SIZE     64
+#define SLOW_READ_MS    50
+#define TASK_COUNT      10          /* Those of the program, idle and timer tasks */
+#define OBJECT_COUNT    5           /* Those of the program and the timer queue */
+
+/* Backward timestamp step allowed between consecutive events: an interrupt
+recording an event between the timestamp read and the slot claim of a task */
+#define REORDER_NS      1000000L
+
+volatile BaseType_t xSimPeripheralIsr = pdFALSE;
+
+static TaskHandle_t xIsrRx;
+static QueueHandle_t xQueue;
+static SemaphoreHandle_t xBus;
+static EventGroupHandle_t xEvent;
+static StreamBufferHandle_t xStream;
+
+static uint32_t ulTrace[ TRC_SNAPSHOT_SIZE / sizeof( uint32_t ) ];
+static TRC_Event_t xRead[ TRC_BUFFER_EVENTS ];
+
+/* Decoded counts of a trace */
+typedef struct
+{
+    uint32_t ulEvents;
+    uint32_t ulCodes[ 0x40 ];
+    uint32_t ulIsr;
+    uint32_t ulLost;
+    uint32_t ulBadCode;
+    uint32_t ulOutOfOrder;
+    uint32_t ulLastTime;
+} TraceCount_t;
+
+/* Application interrupt, every ISR_PERIOD ticks. */
+void vApplicationTickHook( void )
+{
+static unsigned long ulTicks;
+static uint8_t ucData[ 4 ];
+BaseType_t xWoken = pdFALSE;
+
+    if( ( xIsrRx != NULL ) && ( ( ++ulTicks % ISR_PERIOD ) == 0 ) )
+    {
+        xSimPeripheralIsr = pdTRUE;
+        vTaskNotifyGiveFromISR( xIsrRx, &xWoken );
+        ( void ) xStreamBufferSendFromISR( xStream, ucData, sizeof( ucData ), &xWoken );
+        xSimPeripheralIsr = pdFALSE;
+    }
+}
+
+static void prvIsrRx( void *pvParameters )
+{
+    for( ;; )
+    {
+        ( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+    }
+}
+
+static void prvStreamRx( void *pvParameters )
+{
+uint8_t ucData[ 8 ];
+
+    for( ;; )
+    {
+        ( void ) xStreamBufferReceive( xStream, ucData, sizeof( ucData ), portMAX_DELAY );
+    }
+}
+
+/* Two items in a row on a queue of one: the second send waits for the
+consumer. */
+static void prvProducer( void *pvParameters )
+{
+uint32_t ulItem = 0;
+
+    for( ;; )
+    {
+        ( void ) xQueueSend( xQueue, &ulItem, portMAX_DELAY );
+        ulItem++;
+        ( void ) xQueueSend( xQueue, &ulItem, portMAX_DELAY );
+        ulItem++;
+        ( void ) xEventGroupSetBits( xEvent, 0x01 );
+        vTaskDelay( 2 );
+    }
+}
+
+static void prvConsumer( void *pvParameters )
+{
+uint32_t ulItem;
+
+    for( ;; )
+    {
+        ( void ) xQueueReceive( xQueue, &ulItem, portMAX_DELAY );
+    }
+}
+
+static void prvEventWaiter( void *pvParameters )
+{
+    for( ;; )
+    {
+        ( void ) xEventGroupWaitBits( xEvent, 0x01, pdTRUE, pdFALSE, portMAX_DELAY );
+    }
+}
+
+static void prvLow( void *pvParameters )
+{
+uint32_t ulStart;
+
+    for( ;; )
+    {
+        ( void ) xSemaphoreTake( xBus, portMAX_DELAY );
+        ulStart = ulHostTimestamp();
+        while( ( uint32_t ) ( ulHostTimestamp() - ulStart ) < HOLD_NS )
+        {
+        }
+        ( void ) xSemaphoreGive( xBus );
+        vTaskDelay( 1 );
+    }
+}
+
+static void prvHigh( void *pvParameters )
+{
+    for( ;; )
+    {
+        vTaskDelay( 2 );
+        ( void ) xSemaphoreTake( xBus, portMAX_DELAY );
+        ( void ) xSemaphoreGive( xBus );
+    }
+}
+
+static void prvCount( TraceCount_t *pxCount, const TRC_Event_t *pxEvent, uint32_t ulCount )
+{
+uint32_t ulCode, i;
+
+    for( i = 0; i < ulCount; i++, pxEvent++ )
+    {
+        ulCode = pxEvent->info & 0x7FU;
+        if( ( ulCode == TRC_EV_NONE ) || ( ulCode >= 0x40 ) )
+        {
+            pxCount->ulBadCode++;
+            continue;
+        }
+        pxCount->ulCodes[ ulCode ]++;
+        pxCount->ulEvents++;
+        if( ( pxEvent->info & TRC_EV_ISR ) != 0 )
+        {
+            pxCount->ulIsr++;
+        }
+        if( ulCode == TRC_EV_LOST )
+        {
+            pxCount->ulLost += pxEvent->info >> 16;
+        }
+
+        /* The timestamp word of a name event holds characters */
+        if( ulCode != TRC_EV_NAME )
+        {
+            if( ( pxCount->ulEvents > 1 ) &&
+                ( ( int32_t ) ( pxEvent->timestamp - pxCount->ulLastTime ) < -REORDER_NS ) )
+            {
+                pxCount->ulOutOfOrder++;
+            }
+            pxCount->ulLastTime = pxEvent->timestamp;
+        }
+    }
+}
+
+static const TRC_TaskInfo_t *prvFindTask( const TRC_Header_t *pxHeader, const char *pcName )
+{
+const TRC_TaskInfo_t *pxTask = ( const TRC_TaskInfo_t * ) ( pxHeader + 1 );
+uint32_t i;
+
+    for( i = 0; i < pxHeader->task_count; i++, pxTask++ )
+    {
+        if( strncmp( pxTask->name, pcName, TRC_NAME_LEN ) == 0 )
+        {
+            return pxTask;
+        }
+    }
+    printf( "task %s: no record\n", pcName );
+    return NULL;
+}
+
+static const TRC_ObjectInfo_t *prvFindObject( const TRC_Header_t *pxHeader, const char *pcName )
+{
+const TRC_ObjectInfo_t *pxObject = ( const TRC_ObjectInfo_t * ) ( ( const TRC_TaskInfo_t * ) ( pxHeader + 1 ) +
+                                                                 pxHeader->task_count );
+uint32_t i;
+
+    for( i = 0; i < pxHeader->object_count; i++, pxObject++ )
+    {
+        if( strncmp( pxObject->name, pcName, TRC_NAME_LEN ) == 0 )
+        {
+            return pxObject;
+        }
+    }
+    printf( "object %s: no record\n", pcName );
+    return NULL;
+}
+
+/* Header and tables of a snapshot or of the start of a stream. */
+static void prvCheckHeader( const TRC_Header_t *pxHeader, uint32_t ulSize, uint32_t ulMode )
+{
+const TRC_TaskInfo_t *pxTask;
+const TRC_ObjectInfo_t *pxObject;
+
+    CHECK( ulSize == pxHeader->size );
+    CHECK( pxHeader->magic == TRC_TRACE_MAGIC );
+    CHECK( pxHeader->version == TRC_TRACE_VERSION );
+    CHECK( pxHeader->timestamp_freq == TRC_TIMESTAMP_FREQ );
+    CHECK( pxHeader->mode == ulMode );
+    CHECK( pxHeader->task_count == TASK_COUNT );
+    CHECK( pxHeader->object_count == OBJECT_COUNT );
+    CHECK( ulSize == sizeof( TRC_Header_t ) + pxHeader->task_count * sizeof( TRC_TaskInfo_t ) +
+                     pxHeader->object_count * sizeof( TRC_ObjectInfo_t ) +
+                     pxHeader->event_count * sizeof( TRC_Event_t ) );
+
+    pxTask = prvFindTask( pxHeader, "Low" );
+    CHECK( ( pxTask != NULL ) && ( pxTask->priority == 1 ) );
+    pxTask = prvFindTask( pxHeader, "High" );
+    CHECK( ( pxTask != NULL ) && ( pxTask->priority == 3 ) );
+    CHECK( prvFindTask( pxHeader, "IsrRx" ) != NULL );
+    CHECK( prvFindTask( pxHeader, "StreamRx" ) != NULL );
+    CHECK( prvFindTask( pxHeader, "Producer" ) != NULL );
+    CHECK( prvFindTask( pxHeader, "Consumer" ) != NULL );
+    CHECK( prvFindTask( pxHeader, "EventWaiter" ) != NULL );
+    CHECK( prvFindTask( pxHeader, "IDLE" ) != NULL );
+
+    pxObject = prvFindObject( pxHeader, "queue" );
+    CHECK( ( pxObject != NULL ) && ( pxObject->kind == TRC_KIND_QUEUE ) && ( pxObject->length == 1 ) );
+    pxObject = prvFindObject( pxHeader, "bus" );
+    CHECK( ( pxObject != NULL ) && ( pxObject->kind == TRC_KIND_MUTEX ) );
+    pxObject = prvFindObject( pxHeader, "event" );
+    CHECK( ( pxObject != NULL ) && ( pxObject->kind == TRC_KIND_EVENT_GROUP ) );
+    /* The length of a stream buffer is its storage, one byte more than the
+    size asked for */
+    pxObject = prvFindObject( pxHeader, "stream" );
+    CHECK( ( pxObject != NULL ) && ( pxObject->kind == TRC_KIND_STREAM_BUFFER ) &&
+           ( pxObject->length == STREAM_SIZE + 1 ) );
+}
+
+/* Events of a whole trace, with every object and wake up kind. */
+static void prvCheckEvents( const TraceCount_t *pxCount )
+{
+    CHECK( pxCount->ulBadCode == 0 );
+    CHECK( pxCount->ulOutOfOrder == 0 );
+    CHECK( pxCount->ulCodes[ TRC_EV_TASK_SWITCH_IN ] > 0 );
+    CHECK( pxCount->ulCodes[ TRC_EV_TASK_READY ] > 0 );
+    CHECK( pxCount->ulCodes[ TRC_EV_TASK_DELAY ] > 0 );
+    CHECK( pxCount->ulCodes[ TRC_EV_TASK_INHERIT ] > 0 );
+    CHECK( pxCount->ulCodes[ TRC_EV_TASK_DISINHERIT ] > 0 );
+    CHECK( pxCount->ulCodes[ TRC_EV_TASK_NOTIFY ] > 0 );
+    CHECK( pxCount->ulCodes[ TRC_EV_QUEUE_SEND ] > 0 );
+    CHECK( pxCount->ulCodes[ TRC_EV_QUEUE_RECEIVE ] > 0 );
+    CHECK( pxCount->ulCodes[ TRC_EV_BLOCK_SEND ] > 0 );
+    CHECK( pxCount->ulCodes[ TRC_EV_BLOCK_RECEIVE ] > 0 );
+    CHECK( pxCount->ulCodes[ TRC_EV_EVENT_GROUP_SET ] > 0 );
+    CHECK( pxCount->ulCodes[ TRC_EV_STREAM_SEND ] > 0 );
+    CHECK( pxCount->ulCodes[ TRC_EV_STREAM_RECEIVE ] > 0 );
+    CHECK( pxCount->ulIsr >= 2 );
+}
+
+static void prvWrite( const char *pcSuffix, const void *pvData, size_t xSize, FILE **ppxFile )
+{
+char cPath[ 256 ];
+
+    if( *ppxFile == NULL )
+    {
+        snprintf( cPath, sizeof( cPath ), "%s%s", CPU_TRACER_OUT, pcSuffix );
+        *ppxFile = fopen( cPath, "wb" );
+        CHECK( *ppxFile != NULL );
+        if( *ppxFile == NULL )
+        {
+            printf( "%s: %s\n", cPath, strerror( errno ) );
+        }
+    }
+    if( *ppxFile != NULL )
+    {
+        CHECK( fwrite( pvData, 1, xSize, *ppxFile ) == xSize );
+    }
+}
+
+static void prvSnapshot( void )
+{
+TRC_Header_t *pxHeader = ( TRC_Header_t * ) ulTrace;
+TraceCount_t xCount;
+FILE *pxFile = NULL;
+uint32_t ulSize;
+
+    TRC_Start( TRC_MODE_SNAPSHOT );
+    vTaskDelay( pdMS_TO_TICKS( 200 ) );
+    ulSize = TRC_Snapshot( ulTrace, sizeof( ulTrace ) );
+    TRC_Stop();
+
+    /* The ring has wrapped: it holds the newest events */
+    prvCheckHeader( pxHeader, ulSize, TRC_MODE_SNAPSHOT );
+    CHECK( pxHeader->event_count == TRC_BUFFER_EVENTS );
+    CHECK( pxHeader->lost > 0 );
+
+    memset( &xCount, 0, sizeof( xCount ) );
+    prvCount( &xCount, ( const TRC_Event_t * ) ( ( const uint8_t * ) ulTrace + ulSize ) - pxHeader->event_count,
+              pxHeader->event_count );
+    CHECK( xCount.ulEvents == pxHeader->event_count );
+    prvCheckEvents( &xCount );
+
+    /* Nothing to read in snapshot mode, nothing to copy in stream mode */
+    CHECK( TRC_Read( xRead, sizeof( xRead ) ) == 0 );
+    TRC_Start( TRC_MODE_STREAM );
+    CHECK( TRC_Snapshot( ulTrace, sizeof( ulTrace ) ) == 0 );
+    TRC_Stop();
+
+    prvWrite( "_snapshot.bin", ulTrace, ulSize, &pxFile );
+    if( pxFile != NULL )
+    {
+        fclose( pxFile );
+    }
+}
+
+/* Stream read every ulPeriodMs for ulDurationMs. */
+static void prvStream( const char *pcSuffix, uint32_t ulPeriodMs, uint32_t ulDurationMs, TraceCount_t *pxCount )
+{
+TRC_Header_t *pxHeader = ( TRC_Header_t * ) ulTrace;
+TickType_t xEnd;
+FILE *pxFile = NULL;
+uint32_t ulSize;
+
+    memset( pxCount, 0, sizeof( *pxCount ) );
+    TRC_Start( TRC_MODE_STREAM );
+    ulSize = TRC_GetHeader( ulTrace, sizeof( ulTrace ) );
+    prvCheckHeader( pxHeader, ulSize, TRC_MODE_STREAM );
+    CHECK( pxHeader->event_count == 0 );
+    CHECK( TRC_GetHeader( ulTrace, ulSize - 1 ) == 0 );
+    ulSize = TRC_GetHeader( ulTrace, sizeof( ulTrace ) );
+    prvWrite( pcSuffix, ulTrace, ulSize, &pxFile );
+
+    xEnd = xTaskGetTickCount() + pdMS_TO_TICKS( ulDurationMs );
+    while( ( int32_t ) ( xTaskGetTickCount() - xEnd ) < 0 )
+    {
+        vTaskDelay( pdMS_TO_TICKS( ulPeriodMs ) );
+        while( ( ulSize = TRC_Read( xRead, sizeof( xRead ) ) ) != 0 )
+        {
+            CHECK( ( ulSize % sizeof( TRC_Event_t ) ) == 0 );
+            prvCount( pxCount, xRead, ulSize / sizeof( TRC_Event_t ) );
+            prvWrite( pcSuffix, xRead, ulSize, &pxFile );
+        }
+    }
+    TRC_Stop();
+    CHECK( TRC_Read( xRead, sizeof( xRead ) ) == 0 );
+
+    if( pxFile != NULL )
+    {
+        fclose( pxFile );
+    }
+}
+
+static void prvTestTask( void *pvParameters )
+{
+TraceCount_t xFast, xSlow;
+uint32_t ulDurationMs = ( xHarnessBench != 0 ) ? 10000 : 500;
+
+    xQueue = xQueueCreate( 1, sizeof( uint32_t ) );
+    xBus = xSemaphoreCreateMutex();
+    xEvent = xEventGroupCreate();
+    xStream = xStreamBufferCreate( STREAM_SIZE, 1 );
+    CHECK( ( xQueue != NULL ) && ( xBus != NULL ) && ( xEvent != NULL ) && ( xStream != NULL ) );
+    vQueueAddToRegistry( xQueue, "queue" );
+    vQueueAddToRegistry( xBus, "bus" );
+    TRC_NameObject( xEvent, "event" );
+    TRC_NameObject( xStream, "stream" );
+
+    xTaskCreate( prvIsrRx, "IsrRx", STACK_DEPTH, NULL, 4, &xIsrRx );
+    xTaskCreate( prvStreamRx, "StreamRx", STACK_DEPTH, NULL, 4, NULL );
+    xTaskCreate( prvProducer, "Producer", STACK_DEPTH, NULL, 2, NULL );
+    xTaskCreate( prvConsumer, "Consumer", STACK_DEPTH, NULL, 2, NULL );
+    xTaskCreate( prvEventWaiter, "EventWaiter", STACK_DEPTH, NULL, 2, NULL );
+    xTaskCreate( prvLow, "Low", STACK_DEPTH, NULL, 1, NULL );
+    xTaskCreate( prvHigh, "High", STACK_DEPTH, NULL, 3, NULL );
+
+    prvSnapshot();
+
+    /* Read every tick: the ring never fills */
+    prvStream( "_stream.bin", 1, ulDurationMs, &xFast );
+    prvCheckEvents( &xFast );
+    CHECK( xFast.ulCodes[ TRC_EV_LOST ] == 0 );
+
+    /* Read every SLOW_READ_MS: the events that did not fit are reported */
+    prvStream( "_stream_slow.bin", SLOW_READ_MS, ulDurationMs, &xSlow );
+    CHECK( xSlow.ulBadCode == 0 );
+    CHECK( xSlow.ulCodes[ TRC_EV_LOST ] > 0 );
+    CHECK( xSlow.ulLost > 0 );
+
+    if( xHarnessBench != 0 )
+    {
+        printf( "cpu_tracer: ring of %u events, %.1f s per stream\n", ( unsigned ) TRC_BUFFER_EVENTS, ulDurationMs / 1e3 );
+        printf( "  read every tick:  %8u events, %6.0f events/s, %u lost\n", ( unsigned ) xFast.ulEvents,
+                xFast.ulEvents * 1e3 / ulDurationMs, ( unsigned ) xFast.ulLost );
+        printf( "  read every %u ms: %8u events, %6.0f events/s, %u lost\n", SLOW_READ_MS, ( unsigned ) xSlow.ulEvents,
+                xSlow.ulEvents * 1e3 / ulDurationMs, ( unsigned ) xSlow.ulLost );
+    }
+
+    vHarnessExit( "cpu_tracer" );
+}
+
+int main( int argc, char **argv )
+{
+    vHarnessInit( argc, argv );
+    xTaskCreate( prvTestTask, "Test", 8192, NULL, 5, NULL );
+    vTaskStartScheduler();
+    return 1;
+}
@@ -0,0 +1,68 @@
+/*
+ * Helpers shared by the host test and benchmark programs.  Each program is a
+ * single source file built with the kernel: it includes this header once.
+ */
+
+#ifndef HARNESS_H
+#define HARNESS_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Number of failed checks, reported by vHarnessExit(). */
+static unsigned long ulHarnessFailures;
+
+/* Set when the program is run with the "bench" argument: the figures are
+then measured on longer runs, and printed. */
+static int xHarnessBench;
+
+#define CHECK( x )                                                              \
+    do {                                                                        \
+        if( !( x ) )                                                            \
+        {                                                                       \
+            printf( "%s:%d: check failed: %s\n", __FILE__, __LINE__, #x );      \
+            ulHarnessFailures++;                                                \
+        }                                                                       \
+    } while( 0 )
+
+void vAssertCalled( const char *pcFile, int iLine )
+{
+    printf( "%s:%d: configASSERT failed\n", pcFile, iLine );
+    fflush( stdout );
+    exit( 2 );
+}
+
+/* Monotonic time, in nanoseconds. */
+static inline double dHarnessNow( void )
+{
+struct timespec xTime;
+
+    clock_gettime( CLOCK_MONOTONIC, &xTime );
+    return ( double ) xTime.tv_sec * 1e9 + ( double ) xTime.tv_nsec;
+}
+
+/* Small deterministic generator, so that every run replays the same
+sequence. */
+static inline unsigned long ulHarnessRand( unsigned long *pulState )
+{
+    *pulState = *pulState * 1103515245UL + 12345UL;
+    return ( *pulState >> 8 ) & 0xffffffUL;
+}
+
+static inline void vHarnessInit( int argc, char **argv )
+{
+    xHarnessBench = ( argc > 1 ) && ( strcmp( argv[ 1 ], "bench" ) == 0 );
+    setvbuf( stdout, NULL, _IOLBF, 0 );
+}
+
+/* Ends the program, from any task, with the test verdict. */
+static inline void vHarnessExit( const char *pcName )
+{
+    printf( "%s: %s (%lu failed checks)\n", pcName, ( ulHarnessFailures == 0 ) ? "PASS" : "FAIL", ulHarnessFailures );
+    fflush( stdout );
+    exit( ( ulHarnessFailures == 0 ) ? 0 : 1 );
+}
+
+#endif /* HARNESS_H */
@@ -0,0 +1,351 @@
+/*
+ * Replay of a random trace of pvPortMalloc() and vPortFree() calls on one of
+ * the heaps of portable/MemMang, selected when the program is built: heap_2.c,
+ * heap_4.c, heap_5.c (HEAP_REPLAY_REGIONS) or heap_tlsf.c (HEAP_REPLAY_REGIONS
+ * and HEAP_REPLAY_TLSF).
+ *
+ * The program does not start the scheduler: it is built without the kernel
+ * and provides vTaskSuspendAll() and xTaskResumeAll(), so that the times are
+ * those of the allocator alone.  Each trace runs in a child process, on a
+ * fresh heap:
+ *   + 64KB, mixed sizes from 8 bytes to 4KB, over-committed so that requests
+ *     get refused.  heap_2.c and heap_4.c get a 64KB heap by allocating the
+ *     rest of their array first, heap_5.c and heap_tlsf.c get a 40KB and a
+ *     24KB region.
+ *   + 256KB, up to 4096 live objects of 8 to 256 bytes.
+ *
+ * The checks cover the alignment of the blocks, their contents until they are
+ * freed, and the heap once every block is freed: the free size is back to its
+ * initial value and, for the heaps that coalesce, in as large a block as
+ * before.  heap_tlsf.c gets its regions out of address order, one of them
+ * misaligned, and its vPortGetHeapStats() counters are checked.
+ */
+
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "harness.h"
+
+#ifndef HEAP_REPLAY_NAME
+    #define HEAP_REPLAY_NAME    "heap_replay"
+#endif
+
+#ifndef HEAP_REPLAY_REGIONS
+    #define HEAP_REPLAY_REGIONS 0
+#endif
+
+#ifndef HEAP_REPLAY_TLSF
+    #define HEAP_REPLAY_TLSF    0
+#endif
+
+/* heap_2.c never merges free blocks. */
+#ifndef HEAP_REPLAY_COALESCES
+    #define HEAP_REPLAY_COALESCES   1
+#endif
+
+#define MAX_SLOTS       4096
+#define SECOND_REGION   ( 24 * 1024 )
+
+typedef struct
+{
+    const char *pcName;
+    size_t xHeapSize;       /* Bytes given to the heap. */
+    size_t xLiveTarget;     /* Bytes allocated above which most slots stay free. */
+    unsigned uxSlots;       /* Number of blocks that can be allocated at a time. */
+    int xSmall;             /* Sizes from 8 to 256 bytes only. */
+} Trace_t;
+
+static const Trace_t xTraces[] =
+{
+    { "64KB, mixed 8B..4KB", 64 * 1024, 40 * 1024, 512, 0 },
+    { "256KB, small objects", configTOTAL_HEAP_SIZE, 160 * 1024, MAX_SLOTS, 1 }
+};
+
+static void *pvSlots[ MAX_SLOTS ];
+static size_t xSlotSizes[ MAX_SLOTS ];
+static uint8_t ucSlotTags[ MAX_SLOTS ];
+
+#if( HEAP_REPLAY_REGIONS == 1 )
+    static uint8_t ucRegions[ configTOTAL_HEAP_SIZE + 64 ] __attribute__( ( aligned( 16 ) ) );
+#endif
+
+/* The heap is only used by this task, there is no scheduler. */
+void vTaskSuspendAll( void )
+{
+}
+
+BaseType_t xTaskResumeAll( void )
+{
+    return pdFALSE;
+}
+
+static int prvCompareTimes( const void *pvA, const void *pvB )
+{
+uint32_t ulA = *( const uint32_t * ) pvA, ulB = *( const uint32_t * ) pvB;
+
+    return ( ulA > ulB ) - ( ulA < ulB );
+}
+
+/* Prints the average and 99.9th percentile of ulCount times.  The maximum is
+not printed: on a host it is set by page faults and preemptions. */
+static void prvPrintTimes( uint32_t *pulTimes, unsigned long ulCount )
+{
+double dSum = 0.0;
+unsigned long i;
+
+    qsort( pulTimes, ulCount, sizeof( uint32_t ), prvCompareTimes );
+    for( i = 0; i < ulCount; i++ )
+    {
+        dSum += ( double ) pulTimes[ i ];
+    }
+    printf( "  %6.0f /%6lu", dSum / ( double ) ulCount,
+            ( unsigned long ) pulTimes[ ( unsigned long ) ( ( double ) ulCount * 0.999 ) ] );
+}
+
+/* Size of the largest block that can be allocated, by dichotomy. */
+static size_t prvLargestBlock( void )
+{
+size_t xLow = 0, xHigh = configTOTAL_HEAP_SIZE, xMiddle;
+void *pvBlock;
+
+    while( xLow < xHigh )
+    {
+        xMiddle = ( xLow + xHigh + 1 ) / 2;
+        pvBlock = pvPortMalloc( xMiddle );
+        if( pvBlock != NULL )
+        {
+            vPortFree( pvBlock );
+            xLow = xMiddle;
+        }
+        else
+        {
+            xHigh = xMiddle - 1;
+        }
+    }
+
+    return xLow;
+}
+
+static void prvCreateHeap( size_t xHeapSize )
+{
+#if( HEAP_REPLAY_REGIONS == 1 )
+    HeapRegion_t xRegions[ 3 ] = { { NULL, 0 }, { NULL, 0 }, { NULL, 0 } };
+    uint8_t *pucFirst = ucRegions, *pucSecond = ucRegions + ( xHeapSize - SECOND_REGION ) + 32;
+
+    #if( HEAP_REPLAY_TLSF == 1 )
+    {
+        /* heap_tlsf.c accepts the regions in any order and aligns them. */
+        pucFirst += 3;
+        xRegions[ 0 ].pucStartAddress = pucSecond;
+        xRegions[ 0 ].xSizeInBytes = SECOND_REGION;
+        xRegions[ 1 ].pucStartAddress = pucFirst;
+        xRegions[ 1 ].xSizeInBytes = xHeapSize - SECOND_REGION - 3;
+    }
+    #else
+    {
+        xRegions[ 0 ].pucStartAddress = pucFirst;
+        xRegions[ 0 ].xSizeInBytes = xHeapSize - SECOND_REGION;
+        xRegions[ 1 ].pucStartAddress = pucSecond;
+        xRegions[ 1 ].xSizeInBytes = SECOND_REGION;
+    }
+    #endif
+
+    vPortDefineHeapRegions( xRegions );
+#else
+    /* The start of the heap array is kept allocated. */
+    if( xHeapSize < configTOTAL_HEAP_SIZE )
+    {
+        CHECK( pvPortMalloc( configTOTAL_HEAP_SIZE - xHeapSize ) != NULL );
+    }
+#endif
+}
+
+/* Picks the size of the next allocation. */
+static size_t prvPickSize( const Trace_t *pxTrace, unsigned long *pulSeed )
+{
+unsigned long ulClass = ulHarnessRand( pulSeed ) % 100UL, ulRand = ulHarnessRand( pulSeed );
+
+    if( pxTrace->xSmall )
+    {
+        return 8 + ulRand % 249;
+    }
+    else if( ulClass < 40 )
+    {
+        return 8 + ulRand % 57;
+    }
+    else if( ulClass < 70 )
+    {
+        return 64 + ulRand % 193;
+    }
+    else if( ulClass < 90 )
+    {
+        return 256 + ulRand % 945;
+    }
+
+    return 1024 + ulRand % 3073;
+}
+
+/* Runs one trace, in the child process. */
+static void prvReplay( const Trace_t *pxTrace, unsigned long ulOps )
+{
+uint32_t *pulMallocTimes, *pulFreeTimes;
+unsigned long ulSeed = 1, ulMallocs = 0, ulFrees = 0, ulRefused = 0, ulOp;
+size_t xLive = 0, xInitialFree, xInitialLargest = 0, xEndFree, xEndLargest = 0, xSize, k;
+unsigned i;
+uint8_t *pucBlock;
+double dStart;
+
+    pulMallocTimes = malloc( ulOps * sizeof( uint32_t ) );
+    pulFreeTimes = malloc( ulOps * sizeof( uint32_t ) );
+    if( ( pulMallocTimes == NULL ) || ( pulFreeTimes == NULL ) )
+    {
+        exit( 2 );
+    }
+
+    /* heap_4.c only counts its free bytes from the first allocation. */
+    prvCreateHeap( pxTrace->xHeapSize );
+    if( HEAP_REPLAY_COALESCES )
+    {
+        xInitialLargest = prvLargestBlock();
+    }
+    xInitialFree = xPortGetFreeHeapSize();
+    CHECK( xInitialFree > pxTrace->xHeapSize - 256 );
+
+    for( ulOp = 0; ulOp < ulOps; ulOp++ )
+    {
+        i = ( unsigned ) ( ulHarnessRand( &ulSeed ) % pxTrace->uxSlots );
+
+        if( pvSlots[ i ] != NULL )
+        {
+            pucBlock = pvSlots[ i ];
+            for( k = 0; k < xSlotSizes[ i ]; k++ )
+            {
+                if( pucBlock[ k ] != ucSlotTags[ i ] )
+                {
+                    ulHarnessFailures++;
+                    break;
+                }
+            }
+
+            dStart = dHarnessNow();
+            vPortFree( pucBlock );
+            pulFreeTimes[ ulFrees++ ] = ( uint32_t ) ( dHarnessNow() - dStart );
+            xLive -= xSlotSizes[ i ];
+            pvSlots[ i ] = NULL;
+        }
+        else if( ( xLive < pxTrace->xLiveTarget ) || ( ( ulHarnessRand( &ulSeed ) & 7UL ) == 0 ) )
+        {
+            xSize = prvPickSize( pxTrace, &ulSeed );
+            dStart = dHarnessNow();
+            pucBlock = pvPortMalloc( xSize );
+            pulMallocTimes[ ulMallocs++ ] = ( uint32_t ) ( dHarnessNow() - dStart );
+
+            if( pucBlock == NULL )
+            {
+                ulRefused++;
+                continue;
+            }
+            CHECK( ( ( uintptr_t ) pucBlock & portBYTE_ALIGNMENT_MASK ) == 0 );
+
+            pvSlots[ i ] = pucBlock;
+            xSlotSizes[ i ] = xSize;
+            ucSlotTags[ i ] = ( uint8_t ) ulOp;
+            memset( pucBlock, ucSlotTags[ i ], xSize );
+            xLive += xSize;
+        }
+    }
+    CHECK( ulMallocs > 0 );
+    CHECK( ulFrees > 0 );
+
+    /* Fragmentation at the end of the trace, then the heap once everything is
+    freed. */
+    if( HEAP_REPLAY_COALESCES )
+    {
+        xEndLargest = prvLargestBlock();
+    }
+    xEndFree = xPortGetFreeHeapSize();
+    for( i = 0; i < pxTrace->uxSlots; i++ )
+    {
+        vPortFree( pvSlots[ i ] );
+        pvSlots[ i ] = NULL;
+    }
+    CHECK( xPortGetFreeHeapSize() == xInitialFree );
+    if( HEAP_REPLAY_COALESCES )
+    {
+        CHECK( prvLargestBlock() == xInitialLargest );
+    }
+
+    #if( HEAP_REPLAY_TLSF == 1 )
+    {
+    HeapStats_t xStats;
+
+        vPortGetHeapStats( &xStats );
+        CHECK( xStats.xAvailableHeapSpaceInBytes == xInitialFree );
+        CHECK( xStats.xNumberOfFreeBlocks == 2 );
+        CHECK( xStats.xSizeOfLargestFreeBlockInBytes >= xInitialLargest );
+        CHECK( xStats.xNumberOfSuccessfulAllocations == xStats.xNumberOfSuccessfulFrees );
+        CHECK( xStats.xMinimumEverFreeBytesRemaining < xInitialFree - pxTrace->xLiveTarget );
+    }
+    #endif
+
+    if( xHarnessBench )
+    {
+        printf( "  %-22s", pxTrace->pcName );
+        prvPrintTimes( pulMallocTimes, ulMallocs );
+        prvPrintTimes( pulFreeTimes, ulFrees );
+        printf( " %8lu", ulRefused );
+        if( HEAP_REPLAY_COALESCES )
+        {
+            printf( " %12.0f%%", 100.0 * ( double ) xEndLargest / ( double ) xEndFree );
+        }
+        else
+        {
+            printf( "             -" );
+        }
+        printf( "\n" );
+    }
+
+    free( pulMallocTimes );
+    free( pulFreeTimes );
+}
+
+int main( int argc, char **argv )
+{
+unsigned long ulOps;
+unsigned i;
+pid_t xChild;
+int iStatus;
+
+    vHarnessInit( argc, argv );
+    ulOps = xHarnessBench ? 2000000UL : 200000UL;
+
+    if( xHarnessBench )
+    {
+        printf( "%s, %lu random alloc/free, ns:\n  %-22s  malloc avg/p99.9    free avg/p99.9  refused  largest/free\n",
+                HEAP_REPLAY_NAME, ulOps, "" );
+    }
+
+    for( i = 0; i < sizeof( xTraces ) / sizeof( xTraces[ 0 ] ); i++ )
+    {
+        fflush( stdout );
+        xChild = fork();
+        if( xChild == 0 )
+        {
+            prvReplay( &xTraces[ i ], ulOps );
+            fflush( stdout );
+            _exit( ( ulHarnessFailures == 0 ) ? 0 : 1 );
+        }
+
+        CHECK( xChild > 0 );
+        if( xChild > 0 )
+        {
+            CHECK( ( waitpid( xChild, &iStatus, 0 ) == xChild ) && WIFEXITED( iStatus ) && ( WEXITSTATUS( iStatus ) == 0 ) );
+        }
+    }
+
+    vHarnessExit( HEAP_REPLAY_NAME );
+    return 0;
+}
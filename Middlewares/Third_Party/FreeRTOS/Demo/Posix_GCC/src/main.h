@@ -0,0 +1,42 @@
+/*
+ * main.h of the programs built with the Utilities/CPU modules, which
+ * include it for their timebase and interrupt context macros: the timebase
+ * is the host monotonic clock, the interrupt context the tick signal handler
+ * of the POSIX port.
+ */
+
+#ifndef MAIN_H
+#define MAIN_H
+
+#include <stdint.h>
+#include <time.h>
+
+#include "FreeRTOS.h"
+
+/* Host clock in nanoseconds, truncated to 32 bits: it wraps every 4.3 s,
+much less often than the tasks switch. */
+static inline uint32_t ulHostTimestamp( void )
+{
+struct timespec xTime;
+
+    clock_gettime( CLOCK_MONOTONIC, &xTime );
+    return ( uint32_t ) ( ( uint64_t ) xTime.tv_sec * 1000000000ULL + ( uint64_t ) xTime.tv_nsec );
+}
+
+/* The tick is the only interrupt of the port: the programs stand for an
+application interrupt with code run from the tick hook, and set this flag
+around it. */
+extern volatile BaseType_t xSimPeripheralIsr;
+
+#define PROF_TIMESTAMP()        ulHostTimestamp()
+#define PROF_TIMESTAMP_FREQ     1000000000U
+#define PROF_TIMEBASE_INIT()
+#define PROF_IN_ISR()           ( xPortIsInsideInterrupt() != pdFALSE )
+#define PROF_IN_TICK_ISR()      ( PROF_IN_ISR() && ( xSimPeripheralIsr == pdFALSE ) )
+
+#define TRC_TIMESTAMP()         ulHostTimestamp()
+#define TRC_TIMESTAMP_FREQ      1000000000U
+#define TRC_TIMEBASE_INIT()
+#define TRC_IN_ISR()            ( xPortIsInsideInterrupt() != pdFALSE )
+
+#endif /* MAIN_H */
@@ -0,0 +1,302 @@
+/*
+ * CMSIS-RTOS v2 memory pools (CMSIS_RTOS_V2/cmsis_os2.c): osMemoryPoolNew()
+ * with static or dynamic storage, osMemoryPoolAlloc() with a time-out,
+ * osMemoryPoolFree() and osMemoryPoolDelete().
+ *
+ * The checks cover the pool geometry, exhaustion and time-out, the release of
+ * invalid or already free blocks (also when the block contents look like a
+ * free list link), the hand-over of a freed block to a waiting thread, which
+ * foreign thread flags must not wake, and the release of the waiting threads
+ * when the pool is deleted.
+ *
+ * The benchmark passes 48-byte messages from a producer to a consumer through
+ * a message queue, allocated from the heap or from a pool, then times an
+ * uncontended alloc+free pair.
+ */
+
+#include "cmsis_os2.h"
+#include "FreeRTOS.h"
+#include "freertos_mpool.h"
+#include "harness.h"
+
+#define MESSAGE_SIZE    48
+
+static osMemoryPoolId_t xPool;
+static void * volatile pvWaiterBlock;
+static volatile int iWaiterStage;
+
+static osMessageQueueId_t xQueue;
+static volatile int xUsePool;
+static volatile unsigned long ulReceived;
+static unsigned long ulMessages;
+
+/* Waits for a block, then checks that the thread flags set while it was
+waiting are still there. */
+static void prvWaiterThread( void *argument )
+{
+uint32_t ulFlags;
+
+    ( void ) argument;
+
+    pvWaiterBlock = osMemoryPoolAlloc( xPool, osWaitForever );
+    iWaiterStage = 1;
+    ulFlags = osThreadFlagsWait( 0x4U, osFlagsWaitAny, 0U );
+    iWaiterStage = ( ulFlags == 0x4U ) ? 2 : -1;
+    osThreadExit();
+}
+
+/* Waits for a block of a pool that gets deleted. */
+static void prvDeletedWaiterThread( void *argument )
+{
+    ( void ) argument;
+
+    pvWaiterBlock = osMemoryPoolAlloc( xPool, osWaitForever );
+    iWaiterStage = 3;
+    osThreadExit();
+}
+
+static void prvCheckStaticPool( void )
+{
+static uint64_t ullControlBlock[ ( sizeof( MemPool_t ) + 7U ) / 8U ];
+static uint64_t ullStorage[ MEMPOOL_ARR_SIZE( 4U, 10U ) / 8U ];
+static uint64_t ullOutside[ 2 ];
+osMemoryPoolAttr_t xAttr = { 0 };
+osThreadId_t xWaiter;
+void *pvBlocks[ 4 ];
+uint32_t ulStart, ulElapsed;
+unsigned i;
+
+    xAttr.name = "static";
+    xAttr.cb_mem = ullControlBlock;
+    xAttr.cb_size = sizeof( ullControlBlock );
+    xAttr.mp_mem = ullStorage;
+    xAttr.mp_size = sizeof( ullStorage );
+
+    /* Blocks are rounded up to the alignment of a link. */
+    xPool = osMemoryPoolNew( 4U, 10U, &xAttr );
+    CHECK( xPool != NULL );
+    CHECK( osMemoryPoolGetBlockSize( xPool ) == 16U );
+    CHECK( osMemoryPoolGetCapacity( xPool ) == 4U );
+    CHECK( strcmp( osMemoryPoolGetName( xPool ), "static" ) == 0 );
+
+    for( i = 0; i < 4; i++ )
+    {
+        pvBlocks[ i ] = osMemoryPoolAlloc( xPool, 0U );
+        CHECK( pvBlocks[ i ] != NULL );
+    }
+    CHECK( osMemoryPoolGetSpace( xPool ) == 0U );
+    CHECK( osMemoryPoolGetCount( xPool ) == 4U );
+    CHECK( osMemoryPoolAlloc( xPool, 0U ) == NULL );
+
+    ulStart = osKernelGetTickCount();
+    CHECK( osMemoryPoolAlloc( xPool, 20U ) == NULL );
+    ulElapsed = osKernelGetTickCount() - ulStart;
+    CHECK( ( ulElapsed >= 20U ) && ( ulElapsed < 30U ) );
+
+    /* Invalid blocks and blocks already free are rejected. */
+    CHECK( osMemoryPoolFree( xPool, ( uint8_t * ) pvBlocks[ 0 ] + 4 ) == osErrorParameter );
+    CHECK( osMemoryPoolFree( xPool, &ullOutside[ 0 ] ) == osErrorParameter );
+    CHECK( osMemoryPoolFree( xPool, pvBlocks[ 3 ] ) == osOK );
+    CHECK( osMemoryPoolFree( xPool, pvBlocks[ 3 ] ) == osErrorParameter );
+    CHECK( osMemoryPoolGetCount( xPool ) == 3U );
+    memset( pvBlocks[ 0 ], 0, 16 );
+    CHECK( osMemoryPoolFree( xPool, pvBlocks[ 0 ] ) == osOK );
+    CHECK( osMemoryPoolFree( xPool, pvBlocks[ 0 ] ) == osErrorParameter );
+
+    /* Allocated blocks whose contents are a plain link to another block, or
+    NULL, are not mistaken for free blocks. */
+    CHECK( osMemoryPoolAlloc( xPool, 0U ) == pvBlocks[ 0 ] );
+    *( void ** ) pvBlocks[ 0 ] = pvBlocks[ 3 ];
+    CHECK( osMemoryPoolAlloc( xPool, 0U ) == pvBlocks[ 3 ] );
+    *( void ** ) pvBlocks[ 3 ] = NULL;
+    CHECK( osMemoryPoolFree( xPool, pvBlocks[ 0 ] ) == osOK );
+    CHECK( osMemoryPoolFree( xPool, pvBlocks[ 3 ] ) == osOK );
+    CHECK( osMemoryPoolAlloc( xPool, 0U ) == pvBlocks[ 3 ] );
+    CHECK( osMemoryPoolAlloc( xPool, 0U ) == pvBlocks[ 0 ] );
+
+    /* A freed block goes to the waiting thread, which foreign thread flags
+    do not wake, and which keeps these flags. */
+    xWaiter = osThreadNew( prvWaiterThread, NULL, NULL );
+    osDelay( 5U );
+    CHECK( iWaiterStage == 0 );
+    ( void ) osThreadFlagsSet( xWaiter, 0x4U );
+    osDelay( 5U );
+    CHECK( iWaiterStage == 0 );
+    CHECK( osMemoryPoolFree( xPool, pvBlocks[ 1 ] ) == osOK );
+    osDelay( 5U );
+    CHECK( pvWaiterBlock == pvBlocks[ 1 ] );
+    CHECK( iWaiterStage == 2 );
+    CHECK( osMemoryPoolGetCount( xPool ) == 4U );
+
+    /* A time-out while the waiting thread gets flagged keeps the flags. */
+    ( void ) osThreadFlagsSet( osThreadGetId(), 0x8U );
+    CHECK( osMemoryPoolAlloc( xPool, 10U ) == NULL );
+    CHECK( osThreadFlagsWait( 0x8U, osFlagsWaitAny, 0U ) == 0x8U );
+
+    /* The last freed block is the next allocated. */
+    CHECK( osMemoryPoolFree( xPool, pvBlocks[ 2 ] ) == osOK );
+    CHECK( osMemoryPoolGetSpace( xPool ) == 1U );
+    CHECK( osMemoryPoolAlloc( xPool, 0U ) == pvBlocks[ 2 ] );
+
+    /* Deleting the pool releases the waiting threads with NULL. */
+    pvWaiterBlock = ( void * ) 1;
+    ( void ) osThreadNew( prvDeletedWaiterThread, NULL, NULL );
+    osDelay( 5U );
+    CHECK( osMemoryPoolDelete( xPool ) == osOK );
+    osDelay( 5U );
+    CHECK( iWaiterStage == 3 );
+    CHECK( pvWaiterBlock == NULL );
+    CHECK( osMemoryPoolGetCapacity( xPool ) == 0U );
+}
+
+static void prvProducerThread( void *argument )
+{
+uint32_t *pulMessage;
+unsigned long i;
+
+    ( void ) argument;
+
+    for( i = 0; i < ulMessages; i++ )
+    {
+        if( xUsePool )
+        {
+            pulMessage = osMemoryPoolAlloc( xPool, osWaitForever );
+        }
+        else
+        {
+            pulMessage = pvPortMalloc( MESSAGE_SIZE );
+        }
+
+        if( pulMessage == NULL )
+        {
+            ulHarnessFailures++;
+            break;
+        }
+
+        pulMessage[ 0 ] = ( uint32_t ) i;
+        ( void ) osMessageQueuePut( xQueue, &pulMessage, 0U, osWaitForever );
+    }
+
+    osThreadExit();
+}
+
+static void prvConsumerThread( void *argument )
+{
+uint32_t *pulMessage;
+uint32_t ulExpected = 0;
+
+    ( void ) argument;
+
+    for( ;; )
+    {
+        ( void ) osMessageQueueGet( xQueue, &pulMessage, NULL, osWaitForever );
+        if( pulMessage[ 0 ] != ulExpected )
+        {
+            ulHarnessFailures++;
+        }
+        ulExpected = ( pulMessage[ 0 ] + 1U == ulMessages ) ? 0U : pulMessage[ 0 ] + 1U;
+
+        if( xUsePool )
+        {
+            ( void ) osMemoryPoolFree( xPool, pulMessage );
+        }
+        else
+        {
+            vPortFree( pulMessage );
+        }
+        ulReceived++;
+    }
+}
+
+static void prvBench( void )
+{
+static const char * const pcNames[ 2 ] = { "heap_4", "osMemoryPool" };
+osThreadAttr_t xThreadAttr = { 0 };
+unsigned long ulBase, i;
+double dStart, dPassing[ 2 ], dAllocFree[ 2 ];
+void *pvBlock;
+int k;
+
+    ulMessages = xHarnessBench ? 200000UL : 2000UL;
+
+    xPool = osMemoryPoolNew( 8U, MESSAGE_SIZE, NULL );
+    CHECK( xPool != NULL );
+    CHECK( osMemoryPoolGetBlockSize( xPool ) == MESSAGE_SIZE );
+    xQueue = osMessageQueueNew( 8U, sizeof( void * ), NULL );
+    CHECK( xQueue != NULL );
+
+    xThreadAttr.priority = osPriorityNormal;
+    xThreadAttr.stack_size = 4096U;
+    ( void ) osThreadNew( prvConsumerThread, NULL, &xThreadAttr );
+
+    for( k = 0; k < 2; k++ )
+    {
+        xUsePool = k;
+        ulBase = ulReceived;
+        dStart = dHarnessNow();
+        ( void ) osThreadNew( prvProducerThread, NULL, &xThreadAttr );
+        while( ( ulReceived - ulBase ) < ulMessages )
+        {
+            osDelay( 1U );
+        }
+        dPassing[ k ] = ( dHarnessNow() - dStart ) / ( double ) ulMessages;
+    }
+    CHECK( osMemoryPoolGetCount( xPool ) == 0U );
+
+    for( k = 0; k < 2; k++ )
+    {
+        dStart = dHarnessNow();
+        for( i = 0; i < ulMessages; i++ )
+        {
+            if( k != 0 )
+            {
+                pvBlock = osMemoryPoolAlloc( xPool, 0U );
+                ( void ) osMemoryPoolFree( xPool, pvBlock );
+            }
+            else
+            {
+                pvBlock = pvPortMalloc( MESSAGE_SIZE );
+                vPortFree( pvBlock );
+            }
+        }
+        dAllocFree[ k ] = ( dHarnessNow() - dStart ) / ( double ) ulMessages;
+    }
+
+    if( xHarnessBench )
+    {
+        printf( "%lu %u-byte messages from a producer to a consumer, ns/msg:\n", ulMessages, MESSAGE_SIZE );
+        for( k = 0; k < 2; k++ )
+        {
+            printf( "  %-14s %6.0f\n", pcNames[ k ], dPassing[ k ] );
+        }
+        printf( "uncontended alloc+free, ns:\n" );
+        for( k = 0; k < 2; k++ )
+        {
+            printf( "  %-14s %6.0f\n", pcNames[ k ], dAllocFree[ k ] );
+        }
+    }
+}
+
+static void prvTestThread( void *argument )
+{
+    ( void ) argument;
+
+    prvCheckStaticPool();
+    prvBench();
+
+    vHarnessExit( "mpool_v2" );
+}
+
+int main( int argc, char **argv )
+{
+osThreadAttr_t xThreadAttr = { 0 };
+
+    vHarnessInit( argc, argv );
+
+    osKernelInitialize();
+    xThreadAttr.priority = osPriorityHigh;
+    xThreadAttr.stack_size = 8192U;
+    ( void ) osThreadNew( prvTestThread, NULL, &xThreadAttr );
+    osKernelStart();
+    return 1;
+}
@@ -0,0 +1,165 @@
+/*
+ * CMSIS-RTOS v1 memory pools (CMSIS_RTOS/cmsis_os.c): osPoolAlloc(),
+ * osPoolCAlloc(), osPoolFree() and osPoolGetInfo().
+ *
+ * The checks cover the pool exhaustion, the release of invalid or already
+ * free blocks and the usage statistics.  The benchmark frees a block at a
+ * random position of a full pool and allocates it again, for several pool
+ * sizes: the time must not depend on the pool size.
+ */
+
+#include "cmsis_os.h"
+#include "harness.h"
+
+#define ITEM_SIZE       32
+#define MAX_BLOCKS      1024
+
+static void *pvBlocks[ MAX_BLOCKS ];
+
+static void prvCheckPool( void )
+{
+osPoolDef_t xDef = { 8, 13, NULL };
+osPoolId xPool;
+osPoolInfo_t xInfo;
+unsigned i, j;
+uint8_t *pucBlock;
+
+    xPool = osPoolCreate( &xDef );
+    CHECK( xPool != NULL );
+
+    /* Every block is handed out once, then the pool is empty. */
+    for( i = 0; i < 8; i++ )
+    {
+        pvBlocks[ i ] = osPoolAlloc( xPool );
+        CHECK( pvBlocks[ i ] != NULL );
+        CHECK( ( ( uintptr_t ) pvBlocks[ i ] % sizeof( void * ) ) == 0 );
+        for( j = 0; j < i; j++ )
+        {
+            CHECK( pvBlocks[ i ] != pvBlocks[ j ] );
+        }
+        memset( pvBlocks[ i ], 0xa5, 13 );
+    }
+    CHECK( osPoolAlloc( xPool ) == NULL );
+
+    CHECK( osPoolGetInfo( xPool, &xInfo ) == osOK );
+    CHECK( xInfo.pool_sz == 8 );
+    CHECK( xInfo.item_sz == 16 );
+    CHECK( xInfo.used == 8 );
+    CHECK( xInfo.max_used == 8 );
+
+    /* Invalid blocks and blocks already free are rejected, and leave the
+    free list intact. */
+    CHECK( osPoolFree( xPool, NULL ) == osErrorParameter );
+    CHECK( osPoolFree( xPool, ( uint8_t * ) pvBlocks[ 0 ] + 4 ) == osErrorParameter );
+    CHECK( osPoolFree( xPool, ( uint8_t * ) pvBlocks[ 0 ] - 4096 ) == osErrorParameter );
+    CHECK( osPoolFree( NULL, pvBlocks[ 0 ] ) == osErrorParameter );
+    CHECK( osPoolFree( xPool, pvBlocks[ 3 ] ) == osOK );
+    CHECK( osPoolFree( xPool, pvBlocks[ 3 ] ) == osErrorParameter );
+    CHECK( osPoolFree( xPool, pvBlocks[ 5 ] ) == osOK );
+
+    CHECK( osPoolGetInfo( xPool, &xInfo ) == osOK );
+    CHECK( xInfo.used == 6 );
+    CHECK( xInfo.max_used == 8 );
+
+    /* The freed blocks come back, cleared by osPoolCAlloc() on their whole
+    size, and no other. */
+    pucBlock = osPoolCAlloc( xPool );
+    CHECK( ( pucBlock == pvBlocks[ 5 ] ) || ( pucBlock == pvBlocks[ 3 ] ) );
+    for( i = 0; i < 16; i++ )
+    {
+        CHECK( pucBlock[ i ] == 0 );
+    }
+    pucBlock = osPoolAlloc( xPool );
+    CHECK( ( pucBlock == pvBlocks[ 5 ] ) || ( pucBlock == pvBlocks[ 3 ] ) );
+    CHECK( osPoolAlloc( xPool ) == NULL );
+
+    for( i = 0; i < 8; i++ )
+    {
+        CHECK( osPoolFree( xPool, pvBlocks[ i ] ) == osOK );
+    }
+    CHECK( osPoolGetInfo( xPool, &xInfo ) == osOK );
+    CHECK( xInfo.used == 0 );
+}
+
+/* Returns the time of a free then alloc pair, in nanoseconds, on a full pool
+of ulBlocks blocks. */
+static double prvBenchPool( unsigned ulBlocks, unsigned long ulIterations )
+{
+osPoolDef_t xDef = { ulBlocks, ITEM_SIZE, NULL };
+osPoolId xPool;
+unsigned long k, ulSeed = 1;
+unsigned j;
+double dStart, dEnd;
+
+    xPool = osPoolCreate( &xDef );
+    CHECK( xPool != NULL );
+    if( xPool == NULL )
+    {
+        return 0.0;
+    }
+
+    for( j = 0; j < ulBlocks; j++ )
+    {
+        pvBlocks[ j ] = osPoolAlloc( xPool );
+    }
+    CHECK( osPoolFree( xPool, pvBlocks[ 0 ] ) == osOK );
+    pvBlocks[ 0 ] = osPoolAlloc( xPool );
+
+    vTaskSuspendAll();
+    dStart = dHarnessNow();
+    for( k = 0; k < ulIterations; k++ )
+    {
+        j = ( unsigned ) ( ulHarnessRand( &ulSeed ) % ulBlocks );
+        if( osPoolFree( xPool, pvBlocks[ j ] ) != osOK )
+        {
+            ulHarnessFailures++;
+        }
+        pvBlocks[ j ] = osPoolAlloc( xPool );
+        if( pvBlocks[ j ] == NULL )
+        {
+            ulHarnessFailures++;
+        }
+    }
+    dEnd = dHarnessNow();
+    ( void ) xTaskResumeAll();
+
+    /* The pools of the benchmark are not deleted: there is no osPoolDelete()
+    in CMSIS-RTOS v1, and the heap is large enough for all of them. */
+    return ( dEnd - dStart ) / ( double ) ulIterations;
+}
+
+static void prvTestThread( void const *argument )
+{
+static const unsigned ulSizes[] = { 16, 64, 256, 1024 };
+unsigned long ulIterations = xHarnessBench ? 200000UL : 2000UL;
+double dTimes[ 4 ];
+unsigned i;
+
+    ( void ) argument;
+
+    prvCheckPool();
+
+    for( i = 0; i < 4; i++ )
+    {
+        dTimes[ i ] = prvBenchPool( ulSizes[ i ], ulIterations );
+    }
+
+    if( xHarnessBench )
+    {
+        printf( "osPoolFree + osPoolAlloc at a random position of a full pool, ns:\n" );
+        printf( "  blocks  %6u %6u %6u %6u\n", ulSizes[ 0 ], ulSizes[ 1 ], ulSizes[ 2 ], ulSizes[ 3 ] );
+        printf( "  time    %6.0f %6.0f %6.0f %6.0f\n", dTimes[ 0 ], dTimes[ 1 ], dTimes[ 2 ], dTimes[ 3 ] );
+    }
+
+    vHarnessExit( "pool_v1" );
+}
+
+osThreadDef( TestThread, prvTestThread, osPriorityNormal, 0, 1024 );
+
+int main( int argc, char **argv )
+{
+    vHarnessInit( argc, argv );
+    osThreadCreate( osThread( TestThread ), NULL );
+    osKernelStart();
+    return 1;
+}
@@ -0,0 +1,341 @@
+/*
+ * Batch queue functions (queue.c): xQueueSendMultiple(),
+ * xQueueReceiveMultiple(), their FromISR versions, and the CMSIS-RTOS v2
+ * osMessageQueuePutMultiple()/osMessageQueueGetMultiple() wrappers.
+ *
+ * The checks replay random single item and batch operations, from a task and
+ * with the FromISR versions, on a queue of 7 3-byte items against a reference
+ * FIFO, so that every wrap position is exercised.  They then cover a batch
+ * that unblocks several receivers or senders, the time-out, a queue set (one
+ * handle per item) and the CMSIS-RTOS v2 status codes.
+ *
+ * The benchmark times a send+receive round trip of 4-byte items through a
+ * queue of 64, with single item calls or one batch call, from a task and with
+ * the FromISR versions.
+ */
+
+#include "cmsis_os2.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "harness.h"
+
+#define QUEUE_LENGTH    7
+#define ITEM_SIZE       3
+#define MAX_BATCH       9
+
+static QueueHandle_t xQueue;
+static volatile int iWoken;
+
+/* Builds item ulSequence. */
+static void prvMakeItem( uint8_t *pucItem, unsigned long ulSequence )
+{
+    pucItem[ 0 ] = ( uint8_t ) ulSequence;
+    pucItem[ 1 ] = ( uint8_t ) ( ulSequence >> 8 );
+    pucItem[ 2 ] = ( uint8_t ) ~ulSequence;
+}
+
+static void prvCheckRandomOperations( unsigned long ulOperations )
+{
+uint8_t ucReference[ QUEUE_LENGTH * ITEM_SIZE ], ucBuffer[ MAX_BATCH * ITEM_SIZE ];
+UBaseType_t uxCount, uxExpected, uxHeld = 0, i;
+unsigned long ulSeed = 3, ulSequence = 0, k, ulOperation;
+BaseType_t xWoken = pdFALSE;
+
+    xQueue = xQueueCreate( QUEUE_LENGTH, ITEM_SIZE );
+    CHECK( xQueue != NULL );
+
+    for( k = 0; k < ulOperations; k++ )
+    {
+        ulOperation = ulHarnessRand( &ulSeed ) % 6;
+        uxCount = ( UBaseType_t ) ( ulHarnessRand( &ulSeed ) % ( MAX_BATCH + 1 ) );
+
+        if( ulOperation < 2 )
+        {
+            /* A batch send moves what fits. */
+            for( i = 0; i < uxCount; i++ )
+            {
+                prvMakeItem( &ucBuffer[ i * ITEM_SIZE ], ulSequence + i );
+            }
+            uxExpected = ( uxCount < QUEUE_LENGTH - uxHeld ) ? uxCount : QUEUE_LENGTH - uxHeld;
+            if( ulOperation == 0 )
+            {
+                uxCount = xQueueSendMultiple( xQueue, ucBuffer, uxCount, 0 );
+            }
+            else
+            {
+                uxCount = xQueueSendMultipleFromISR( xQueue, ucBuffer, uxCount, &xWoken );
+            }
+            CHECK( uxCount == uxExpected );
+            memcpy( &ucReference[ uxHeld * ITEM_SIZE ], ucBuffer, uxCount * ITEM_SIZE );
+            uxHeld += uxCount;
+            ulSequence += uxCount;
+        }
+        else if( ulOperation < 4 )
+        {
+            /* A batch receive moves what is there, in order. */
+            uxExpected = ( uxCount < uxHeld ) ? uxCount : uxHeld;
+            if( ulOperation == 2 )
+            {
+                uxCount = xQueueReceiveMultiple( xQueue, ucBuffer, uxCount, 0 );
+            }
+            else
+            {
+                uxCount = xQueueReceiveMultipleFromISR( xQueue, ucBuffer, uxCount, &xWoken );
+            }
+            CHECK( uxCount == uxExpected );
+            CHECK( memcmp( ucBuffer, ucReference, uxCount * ITEM_SIZE ) == 0 );
+            memmove( ucReference, &ucReference[ uxCount * ITEM_SIZE ], ( uxHeld - uxCount ) * ITEM_SIZE );
+            uxHeld -= uxCount;
+        }
+        else if( ulOperation == 4 )
+        {
+            prvMakeItem( ucBuffer, ulSequence );
+            if( xQueueSend( xQueue, ucBuffer, 0 ) == pdPASS )
+            {
+                memcpy( &ucReference[ uxHeld * ITEM_SIZE ], ucBuffer, ITEM_SIZE );
+                uxHeld++;
+                ulSequence++;
+            }
+            else
+            {
+                CHECK( uxHeld == QUEUE_LENGTH );
+            }
+        }
+        else
+        {
+            if( xQueueReceive( xQueue, ucBuffer, 0 ) == pdPASS )
+            {
+                CHECK( memcmp( ucBuffer, ucReference, ITEM_SIZE ) == 0 );
+                memmove( ucReference, &ucReference[ ITEM_SIZE ], ( uxHeld - 1 ) * ITEM_SIZE );
+                uxHeld--;
+            }
+            else
+            {
+                CHECK( uxHeld == 0 );
+            }
+        }
+
+        CHECK( uxQueueMessagesWaiting( xQueue ) == uxHeld );
+    }
+}
+
+/* Waits for one item, then records how many it got. */
+static void prvReceiverTask( void *pvParameters )
+{
+uint8_t ucBuffer[ 4 * ITEM_SIZE ];
+UBaseType_t uxCount;
+
+    ( void ) pvParameters;
+
+    uxCount = xQueueReceiveMultiple( xQueue, ucBuffer, 1, portMAX_DELAY );
+    taskENTER_CRITICAL();
+    iWoken += ( int ) uxCount * 10 + 1;
+    taskEXIT_CRITICAL();
+    vTaskDelete( NULL );
+}
+
+/* Waits for room, then records how many items it sent out of 4. */
+static void prvSenderTask( void *pvParameters )
+{
+uint8_t ucBuffer[ 4 * ITEM_SIZE ];
+UBaseType_t uxCount;
+
+    ( void ) pvParameters;
+
+    memset( ucBuffer, 0, sizeof( ucBuffer ) );
+    uxCount = xQueueSendMultiple( xQueue, ucBuffer, 4, portMAX_DELAY );
+    taskENTER_CRITICAL();
+    iWoken += ( int ) uxCount * 10 + 1;
+    taskEXIT_CRITICAL();
+    vTaskDelete( NULL );
+}
+
+static void prvCheckBlocking( void )
+{
+uint8_t ucBuffer[ QUEUE_LENGTH * ITEM_SIZE ];
+QueueHandle_t xMember;
+QueueSetHandle_t xSet;
+TickType_t xStart;
+int i;
+
+    memset( ucBuffer, 0, sizeof( ucBuffer ) );
+
+    /* One batch send unblocks three receivers, one item each. */
+    CHECK( xQueueReset( xQueue ) == pdPASS );
+    iWoken = 0;
+    for( i = 0; i < 3; i++ )
+    {
+        CHECK( xTaskCreate( prvReceiverTask, "Receiver", 1024, NULL, 3, NULL ) == pdPASS );
+    }
+    vTaskDelay( 2 );
+    CHECK( iWoken == 0 );
+    CHECK( xQueueSendMultiple( xQueue, ucBuffer, 3, 0 ) == 3 );
+    vTaskDelay( 2 );
+    CHECK( iWoken == 33 );
+    CHECK( uxQueueMessagesWaiting( xQueue ) == 0 );
+
+    /* One batch receive of 7 items unblocks the senders: the first sends its
+    4 items, the second 3 of its 4, the third finds the queue full again and
+    keeps waiting. */
+    CHECK( xQueueSendMultiple( xQueue, ucBuffer, QUEUE_LENGTH, 0 ) == QUEUE_LENGTH );
+    iWoken = 0;
+    for( i = 0; i < 3; i++ )
+    {
+        CHECK( xTaskCreate( prvSenderTask, "Sender", 1024, NULL, 3, NULL ) == pdPASS );
+    }
+    vTaskDelay( 2 );
+    CHECK( iWoken == 0 );
+    CHECK( xQueueReceiveMultiple( xQueue, ucBuffer, QUEUE_LENGTH, 0 ) == QUEUE_LENGTH );
+    vTaskDelay( 2 );
+    CHECK( iWoken == 41 + 31 );
+    CHECK( uxQueueMessagesWaiting( xQueue ) == QUEUE_LENGTH );
+
+    /* Time-out on a full queue. */
+    CHECK( xQueueSendMultiple( xQueue, ucBuffer, QUEUE_LENGTH, 0 ) == 0 );
+    xStart = xTaskGetTickCount();
+    CHECK( xQueueSendMultiple( xQueue, ucBuffer, QUEUE_LENGTH, 5 ) == 0 );
+    CHECK( ( TickType_t ) ( xTaskGetTickCount() - xStart ) >= 5 );
+
+    /* A member of a queue set posts one handle per item. */
+    xMember = xQueueCreate( 8, ITEM_SIZE );
+    xSet = xQueueCreateSet( 8 );
+    CHECK( ( xMember != NULL ) && ( xSet != NULL ) );
+    CHECK( xQueueAddToSet( xMember, xSet ) == pdPASS );
+    CHECK( xQueueSendMultiple( xMember, ucBuffer, 5, 0 ) == 5 );
+    CHECK( uxQueueMessagesWaiting( xSet ) == 5 );
+    for( i = 0; i < 5; i++ )
+    {
+        CHECK( xQueueSelectFromSet( xSet, 0 ) == xMember );
+        CHECK( xQueueReceive( xMember, ucBuffer, 0 ) == pdPASS );
+    }
+    CHECK( xQueueSelectFromSet( xSet, 0 ) == NULL );
+}
+
+static void prvCheckCmsisV2( void )
+{
+osMessageQueueId_t xMessages;
+uint32_t ulData[ 6 ] = { 1, 2, 3, 4, 5, 6 }, ulCount;
+
+    xMessages = osMessageQueueNew( 4U, sizeof( uint32_t ), NULL );
+    CHECK( xMessages != NULL );
+
+    CHECK( osMessageQueuePutMultiple( xMessages, ulData, 0U, &ulCount, 0U ) == osErrorParameter );
+    CHECK( osMessageQueuePutMultiple( xMessages, ulData, 6U, &ulCount, 0U ) == osOK );
+    CHECK( ulCount == 4U );
+    CHECK( osMessageQueuePutMultiple( xMessages, ulData, 1U, &ulCount, 0U ) == osErrorResource );
+    CHECK( osMessageQueuePutMultiple( xMessages, ulData, 1U, NULL, 2U ) == osErrorTimeout );
+
+    memset( ulData, 0, sizeof( ulData ) );
+    CHECK( osMessageQueueGetMultiple( xMessages, ulData, 3U, &ulCount, 0U ) == osOK );
+    CHECK( ( ulCount == 3U ) && ( ulData[ 0 ] == 1U ) && ( ulData[ 2 ] == 3U ) );
+    CHECK( osMessageQueueGetMultiple( xMessages, ulData, 3U, &ulCount, 0U ) == osOK );
+    CHECK( ( ulCount == 1U ) && ( ulData[ 0 ] == 4U ) );
+    CHECK( osMessageQueueGetMultiple( xMessages, ulData, 3U, &ulCount, 0U ) == osErrorResource );
+    CHECK( ulCount == 0U );
+    CHECK( osMessageQueueGetMultiple( xMessages, ulData, 3U, NULL, 2U ) == osErrorTimeout );
+
+    CHECK( osMessageQueueDelete( xMessages ) == osOK );
+}
+
+/* Returns the time per item of a send+receive round trip of uxBatch items,
+in nanoseconds, by single item calls or by one batch call, from a task or
+with the FromISR versions. */
+static double prvBenchRoundTrip( QueueHandle_t xBench, UBaseType_t uxBatch, int xMultiple, int xFromISR, unsigned long ulItems )
+{
+static uint32_t ulSource[ 32 ], ulDestination[ 32 ];
+BaseType_t xWoken = pdFALSE;
+unsigned long k;
+UBaseType_t i;
+double dStart;
+
+    dStart = dHarnessNow();
+    for( k = 0; k < ulItems; k += uxBatch )
+    {
+        if( xMultiple && xFromISR )
+        {
+            ( void ) xQueueSendMultipleFromISR( xBench, ulSource, uxBatch, &xWoken );
+            ( void ) xQueueReceiveMultipleFromISR( xBench, ulDestination, uxBatch, &xWoken );
+        }
+        else if( xMultiple )
+        {
+            ( void ) xQueueSendMultiple( xBench, ulSource, uxBatch, 0 );
+            ( void ) xQueueReceiveMultiple( xBench, ulDestination, uxBatch, 0 );
+        }
+        else if( xFromISR )
+        {
+            for( i = 0; i < uxBatch; i++ )
+            {
+                ( void ) xQueueSendFromISR( xBench, &ulSource[ i ], &xWoken );
+            }
+            for( i = 0; i < uxBatch; i++ )
+            {
+                ( void ) xQueueReceiveFromISR( xBench, &ulDestination[ i ], &xWoken );
+            }
+        }
+        else
+        {
+            for( i = 0; i < uxBatch; i++ )
+            {
+                ( void ) xQueueSend( xBench, &ulSource[ i ], 0 );
+            }
+            for( i = 0; i < uxBatch; i++ )
+            {
+                ( void ) xQueueReceive( xBench, &ulDestination[ i ], 0 );
+            }
+        }
+    }
+
+    return ( dHarnessNow() - dStart ) / ( double ) ulItems;
+}
+
+static void prvBench( void )
+{
+QueueHandle_t xBench;
+unsigned long ulItems = xHarnessBench ? 2000000UL : 20000UL;
+UBaseType_t uxBatch;
+double dTimes[ 4 ];
+int k;
+
+    xBench = xQueueCreate( 64, sizeof( uint32_t ) );
+    CHECK( xBench != NULL );
+
+    if( xHarnessBench )
+    {
+        printf( "send+receive round trip, 4-byte items, ns/item:\n" );
+        printf( "  batch   task single/batch   ISR single/batch\n" );
+    }
+    for( uxBatch = 1; uxBatch <= 32; uxBatch *= 2 )
+    {
+        for( k = 0; k < 4; k++ )
+        {
+            dTimes[ k ] = prvBenchRoundTrip( xBench, uxBatch, k & 1, k >> 1, ulItems );
+        }
+        CHECK( uxQueueMessagesWaiting( xBench ) == 0 );
+
+        if( xHarnessBench )
+        {
+            printf( "  %5u   %6.0f / %-6.0f     %6.0f / %.0f\n", ( unsigned ) uxBatch, dTimes[ 0 ], dTimes[ 1 ], dTimes[ 2 ], dTimes[ 3 ] );
+        }
+    }
+}
+
+static void prvTestTask( void *pvParameters )
+{
+    ( void ) pvParameters;
+
+    prvCheckRandomOperations( xHarnessBench ? 1000000UL : 200000UL );
+    prvCheckBlocking();
+    prvCheckCmsisV2();
+    prvBench();
+
+    vHarnessExit( "queue_batch" );
+}
+
+int main( int argc, char **argv )
+{
+    vHarnessInit( argc, argv );
+    xTaskCreate( prvTestTask, "Test", 8192, NULL, 2, NULL );
+    vTaskStartScheduler();
+    return 1;
+}
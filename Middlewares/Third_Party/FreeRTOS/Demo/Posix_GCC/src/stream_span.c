@@ -0,0 +1,245 @@
+/*
+ * Zero copy access to stream and message buffers (stream_buffer.c):
+ * xStreamBufferReserve()/xStreamBufferCommit(), xStreamBufferPeek()/
+ * xStreamBufferRelease(), their FromISR versions and the xMessageBuffer
+ * equivalents.
+ *
+ * The checks cover the two part spans of a region that wraps around the end
+ * of the storage area, stream reservations larger than the space, the trigger
+ * level, a writer blocked in xStreamBufferReserve() woken by a release, and
+ * message reservations that do not fit or are committed shorter than
+ * reserved.
+ *
+ * The benchmark moves 512-byte blocks through a 4KB stream buffer, copied
+ * with xStreamBufferSend()/xStreamBufferReceive() or written and read in
+ * place.
+ */
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "stream_buffer.h"
+#include "message_buffer.h"
+#include "harness.h"
+
+#define BLOCK_SIZE      512
+
+static StreamBufferHandle_t xStream;
+static volatile int iStage;
+
+/* Fills a span with ucFirst, ucFirst + 1... */
+static void prvFillSpan( StreamBufferSpan_t *pxSpan, uint8_t ucFirst )
+{
+size_t i;
+
+    for( i = 0; i < pxSpan->xFirstLength; i++ )
+    {
+        pxSpan->pucFirst[ i ] = ( uint8_t ) ( ucFirst + i );
+    }
+    for( i = 0; i < pxSpan->xSecondLength; i++ )
+    {
+        pxSpan->pucSecond[ i ] = ( uint8_t ) ( ucFirst + pxSpan->xFirstLength + i );
+    }
+}
+
+/* Waits for the trigger level, then records how many bytes it got. */
+static void prvReaderTask( void *pvParameters )
+{
+uint8_t ucData[ 64 ];
+
+    ( void ) pvParameters;
+
+    iStage = ( int ) xStreamBufferReceive( xStream, ucData, sizeof( ucData ), portMAX_DELAY );
+    vTaskDelete( NULL );
+}
+
+/* Waits for space, then records how much it reserved. */
+static void prvWriterTask( void *pvParameters )
+{
+StreamBufferSpan_t xSpan;
+
+    ( void ) pvParameters;
+
+    iStage = 100 + ( int ) xStreamBufferReserve( xStream, 12, &xSpan, portMAX_DELAY );
+    vTaskDelete( NULL );
+}
+
+static void prvCheckStreamBuffer( void )
+{
+StreamBufferSpan_t xSpan;
+uint8_t ucData[ 64 ];
+BaseType_t xWoken = pdFALSE;
+
+    memset( ucData, 0, sizeof( ucData ) );
+    xStream = xStreamBufferCreate( 16, 10 );
+    CHECK( xStream != NULL );
+
+    /* Move the head and the tail to 12, so that a region of 8 bytes wraps. */
+    CHECK( xStreamBufferSend( xStream, ucData, 12, 0 ) == 12 );
+    CHECK( xStreamBufferReceive( xStream, ucData, 12, 0 ) == 12 );
+
+    CHECK( xStreamBufferReserve( xStream, 8, &xSpan, 0 ) == 8 );
+    CHECK( ( xSpan.xFirstLength == 5 ) && ( xSpan.xSecondLength == 3 ) && ( xSpan.pucSecond != NULL ) );
+    prvFillSpan( &xSpan, 1 );
+    CHECK( xStreamBufferBytesAvailable( xStream ) == 0 );
+    CHECK( xStreamBufferCommit( xStream, 8 ) == 8 );
+    CHECK( xStreamBufferBytesAvailable( xStream ) == 8 );
+
+    /* A peek sees the same two parts, a partial release drops the start. */
+    CHECK( xStreamBufferPeek( xStream, &xSpan, 0 ) == 8 );
+    CHECK( ( xSpan.xFirstLength == 5 ) && ( xSpan.xSecondLength == 3 ) );
+    CHECK( ( xSpan.pucFirst[ 0 ] == 1 ) && ( xSpan.pucSecond[ 2 ] == 8 ) );
+    CHECK( xStreamBufferRelease( xStream, 3 ) == 3 );
+    CHECK( xStreamBufferReceive( xStream, ucData, sizeof( ucData ), 0 ) == 5 );
+    CHECK( ( ucData[ 0 ] == 4 ) && ( ucData[ 4 ] == 8 ) );
+
+    /* A stream reservation larger than the space is cut to the space. */
+    CHECK( xStreamBufferReserveFromISR( xStream, 40, &xSpan ) == 16 );
+    CHECK( xStreamBufferCommitFromISR( xStream, 0, &xWoken ) == 0 );
+
+    /* Committed bytes wake the reader once the trigger level is reached. */
+    iStage = 0;
+    CHECK( xTaskCreate( prvReaderTask, "Reader", 4096, NULL, 3, NULL ) == pdPASS );
+    vTaskDelay( 2 );
+    CHECK( iStage == 0 );
+    CHECK( xStreamBufferReserve( xStream, 5, &xSpan, 0 ) == 5 );
+    prvFillSpan( &xSpan, 0 );
+    CHECK( xStreamBufferCommit( xStream, 5 ) == 5 );
+    vTaskDelay( 2 );
+    CHECK( iStage == 0 );
+    CHECK( xStreamBufferReserve( xStream, 5, &xSpan, 0 ) == 5 );
+    prvFillSpan( &xSpan, 0 );
+    CHECK( xStreamBufferCommit( xStream, 5 ) == 5 );
+    vTaskDelay( 2 );
+    CHECK( iStage == 10 );
+
+    /* A writer blocked in xStreamBufferReserve() is woken by a release. */
+    iStage = 0;
+    CHECK( xStreamBufferSend( xStream, ucData, 16, 0 ) == 16 );
+    CHECK( xTaskCreate( prvWriterTask, "Writer", 4096, NULL, 3, NULL ) == pdPASS );
+    vTaskDelay( 2 );
+    CHECK( iStage == 0 );
+    CHECK( xStreamBufferPeek( xStream, &xSpan, 0 ) == 16 );
+    CHECK( xStreamBufferReleaseFromISR( xStream, 12, &xWoken ) == 12 );
+    vTaskDelay( 2 );
+    CHECK( iStage == 112 );
+
+    CHECK( xStreamBufferCommit( xStream, 0 ) == 0 );
+    CHECK( xStreamBufferReset( xStream ) == pdPASS );
+    vStreamBufferDelete( xStream );
+}
+
+static void prvCheckMessageBuffer( void )
+{
+MessageBufferHandle_t xMessages;
+StreamBufferSpan_t xSpan;
+uint8_t ucData[ 64 ];
+
+    memset( ucData, 0, sizeof( ucData ) );
+    xMessages = xMessageBufferCreate( 39 );
+    CHECK( xMessages != NULL );
+    CHECK( xMessageBufferSend( xMessages, ucData, 20, 0 ) == 20 );
+    CHECK( xMessageBufferReceive( xMessages, ucData, sizeof( ucData ), 0 ) == 20 );
+
+    /* A message is reserved whole, after its length, or not at all. */
+    CHECK( xMessageBufferReserve( xMessages, 32, &xSpan, 0 ) == 0 );
+    CHECK( xMessageBufferReserve( xMessages, 31, &xSpan, 0 ) == 31 );
+
+    /* The length is written at commit: a message can be shorter than
+    reserved. */
+    CHECK( xMessageBufferReserve( xMessages, 10, &xSpan, 0 ) == 10 );
+    prvFillSpan( &xSpan, 50 );
+    CHECK( xMessageBufferCommit( xMessages, 7 ) == 7 );
+    CHECK( xMessageBufferReserve( xMessages, 6, &xSpan, 0 ) == 6 );
+    prvFillSpan( &xSpan, 70 );
+    CHECK( xMessageBufferCommit( xMessages, 6 ) == 6 );
+
+    CHECK( xMessageBufferPeek( xMessages, &xSpan, 0 ) == 7 );
+    CHECK( xSpan.xFirstLength + xSpan.xSecondLength == 7 );
+    CHECK( xSpan.pucFirst[ 0 ] == 50 );
+    CHECK( xMessageBufferRelease( xMessages, 7 ) == 7 );
+    CHECK( xMessageBufferReceive( xMessages, ucData, sizeof( ucData ), 0 ) == 6 );
+    CHECK( ( ucData[ 0 ] == 70 ) && ( ucData[ 5 ] == 75 ) );
+    CHECK( xMessageBufferPeekFromISR( xMessages, &xSpan ) == 0 );
+
+    vMessageBufferDelete( xMessages );
+}
+
+/* Returns the time to move one block through a 4KB stream buffer, in
+nanoseconds, copied or in place. */
+static double prvBenchBlocks( int xInPlace, unsigned long ulBlocks )
+{
+static uint8_t ucSource[ BLOCK_SIZE ], ucDestination[ BLOCK_SIZE ];
+StreamBufferHandle_t xBuffer;
+StreamBufferSpan_t xSpan;
+unsigned long i;
+double dStart, dEnd;
+
+    xBuffer = xStreamBufferCreate( 4096, 1 );
+    CHECK( xBuffer != NULL );
+
+    dStart = dHarnessNow();
+    for( i = 0; i < ulBlocks; i++ )
+    {
+        if( xInPlace )
+        {
+            ( void ) xStreamBufferReserve( xBuffer, BLOCK_SIZE, &xSpan, 0 );
+            memset( xSpan.pucFirst, ( int ) ( i & 0xffUL ), xSpan.xFirstLength );
+            if( xSpan.xSecondLength != 0 )
+            {
+                memset( xSpan.pucSecond, ( int ) ( i & 0xffUL ), xSpan.xSecondLength );
+            }
+            ( void ) xStreamBufferCommit( xBuffer, BLOCK_SIZE );
+
+            if( ( xStreamBufferPeek( xBuffer, &xSpan, 0 ) != BLOCK_SIZE ) || ( xSpan.pucFirst[ 0 ] != ( uint8_t ) i ) )
+            {
+                ulHarnessFailures++;
+            }
+            ( void ) xStreamBufferRelease( xBuffer, BLOCK_SIZE );
+        }
+        else
+        {
+            memset( ucSource, ( int ) ( i & 0xffUL ), BLOCK_SIZE );
+            ( void ) xStreamBufferSend( xBuffer, ucSource, BLOCK_SIZE, 0 );
+
+            if( ( xStreamBufferReceive( xBuffer, ucDestination, BLOCK_SIZE, 0 ) != BLOCK_SIZE ) || ( ucDestination[ BLOCK_SIZE - 1 ] != ( uint8_t ) i ) )
+            {
+                ulHarnessFailures++;
+            }
+        }
+    }
+    dEnd = dHarnessNow();
+
+    vStreamBufferDelete( xBuffer );
+    return ( dEnd - dStart ) / ( double ) ulBlocks;
+}
+
+static void prvTestTask( void *pvParameters )
+{
+unsigned long ulBlocks = xHarnessBench ? 200000UL : 2000UL;
+double dCopy, dInPlace;
+
+    ( void ) pvParameters;
+
+    prvCheckStreamBuffer();
+    prvCheckMessageBuffer();
+
+    dCopy = prvBenchBlocks( pdFALSE, ulBlocks );
+    dInPlace = prvBenchBlocks( pdTRUE, ulBlocks );
+
+    if( xHarnessBench )
+    {
+        printf( "%u-byte blocks through a 4KB stream buffer, ns/block:\n", BLOCK_SIZE );
+        printf( "  send/receive (copy)            %6.0f\n", dCopy );
+        printf( "  reserve/commit + peek/release  %6.0f\n", dInPlace );
+    }
+
+    vHarnessExit( "stream_span" );
+}
+
+int main( int argc, char **argv )
+{
+    vHarnessInit( argc, argv );
+    xTaskCreate( prvTestTask, "Test", 8192, NULL, 2, NULL );
+    vTaskStartScheduler();
+    return 1;
+}
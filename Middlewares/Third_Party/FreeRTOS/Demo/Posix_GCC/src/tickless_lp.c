@@ -0,0 +1,424 @@
+/*
+ * Tickless idle mode of the GCC ARM_CM3 port with a low power timebase
+ * (configUSE_TICKLESS_LP_TIMEBASE), and coalescing of the task wake times
+ * (configTICKLESS_SLACK_TICKS of tasks.c), built once per slack value.
+ *
+ * vPortSuppressTicksAndSleep() is extracted from port.c by
+ * src/tickless_port.sed, and runs on a simulated STM32L1 (src/tickless_lp.h):
+ * a SysTick, interrupt masking, wfi, a low power counter with a wake up alarm
+ * and a random external interrupt.  The host tick is stopped: the simulated
+ * time only advances when the idle task waits for an interrupt or reads the
+ * low power counter, and by 50 us of processing after each wake up.
+ *
+ * The workload is 4 periodic tasks (10, 15, 22 and 100 ms), 2 auto-reload
+ * timers (33 and 250 ms) and a task woken by the external interrupt, every 5
+ * to 75 ms.  The checks cover the lateness of the periodic tasks (at most the
+ * slack), the timer callback counts, the handling of every external interrupt
+ * and the drift of the kernel time from the simulated time.
+ *
+ * The benchmark reports the wake ups per second and the average current, for
+ * 7 mA running, 1.6 mA in sleep mode and 1.5 uA in stop mode, and for the
+ * same sleeps in sleep mode, where the SysTick tickless mode has to stay.
+ */
+
+#include <stdint.h>
+#include <sys/time.h>
+
+#include "tickless_lp.h"
+#include "timers.h"
+#include "semphr.h"
+#include "harness.h"
+
+#ifndef TICKLESS_LP_NAME
+    #define TICKLESS_LP_NAME    "tickless_lp"
+#endif
+
+/* Simulated times are in SysTick counts. */
+#define TICK_COUNTS         ( configSYSTICK_CLOCK_HZ / configTICK_RATE_HZ )
+#define WAKEUP_COUNTS       configLP_TIMEBASE_WAKEUP_LATENCY
+#define WORK_COUNTS         ( 1600ULL )
+#define READ_COUNTS         ( 8ULL )
+
+/* Offset of the low power counter edges from the SysTick ones. */
+#define LP_PHASE            ( 12345ULL )
+
+#define PERIODIC_TASKS      4
+
+/* Static in port.c. */
+uint32_t ulTimerCountsForOneTick = TICK_COUNTS;
+uint32_t xMaximumPossibleSuppressedTicks = ( uint32_t ) ( ( ( uint64_t ) ( configLP_TIMEBASE_COUNTER_MASK >> 1UL ) * ( uint64_t ) configTICK_RATE_HZ ) / ( uint64_t ) configLP_TIMEBASE_CLOCK_HZ );
+uint32_t ulStoppedTimerCompensation = 45UL;
+
+/* Simulated time, and the time spent running, in sleep mode (SysTick
+running) and in stop mode. */
+static uint64_t ullNow, ullRunCounts, ullSleepCounts, ullStopCounts;
+
+static int xSysTickEnabled;
+static uint32_t ulSysTickLoad = TICK_COUNTS - 1UL, ulSysTickValue;
+static uint64_t ullSysTickNext;
+
+static int xInterruptsMasked, xTickPending, xExternalPending;
+static int xAlarmArmed;
+static uint32_t ulAlarmCount;
+static uint64_t ullNextExternal = UINT64_MAX;
+static unsigned long ulExternalSeed = 1;
+static SemaphoreHandle_t xExternalSemaphore;
+
+static unsigned long ulWakeups, ulTickWakeups, ulExternalWakeups, ulExternalInterrupts, ulAlarmSleeps;
+static int xSleepCalled, xWokenUp;
+
+/* Workload. */
+static const TickType_t xPeriods[ PERIODIC_TASKS ] = { 10, 15, 22, 100 };
+static TickType_t xMaxLateness[ PERIODIC_TASKS ];
+static unsigned long ulLatenessSum[ PERIODIC_TASKS ], ulRuns[ PERIODIC_TASKS ];
+static const TickType_t xTimerPeriods[ 2 ] = { 33, 250 };
+static unsigned long ulTimerRuns[ 2 ], ulExternalHandled;
+
+static uint64_t prvLPCount( uint64_t ullTime )
+{
+    return ( ( ullTime + LP_PHASE ) * configLP_TIMEBASE_CLOCK_HZ ) / configSYSTICK_CLOCK_HZ;
+}
+
+/* Time at which the low power counter reaches ullCount. */
+static uint64_t prvLPEdge( uint64_t ullCount )
+{
+    return ( ( ullCount * configSYSTICK_CLOCK_HZ ) + configLP_TIMEBASE_CLOCK_HZ - 1ULL ) / configLP_TIMEBASE_CLOCK_HZ - LP_PHASE;
+}
+
+/* Runs the pending interrupt handlers, unless interrupts are masked.  The
+simulated time only advances in the idle task, with the scheduler suspended,
+so the ticks are pended as on target. */
+static void prvServiceInterrupts( void )
+{
+BaseType_t xWoken = pdFALSE;
+
+    while( ( xInterruptsMasked == pdFALSE ) && ( xTickPending || xExternalPending ) )
+    {
+        if( xTickPending )
+        {
+            xTickPending = pdFALSE;
+            ( void ) xTaskIncrementTick();
+        }
+        else
+        {
+            xExternalPending = pdFALSE;
+            ulExternalInterrupts++;
+            ( void ) xSemaphoreGiveFromISR( xExternalSemaphore, &xWoken );
+        }
+    }
+}
+
+/* Advances the simulated time to ullEnd, raising the SysTick and external
+interrupts on the way, and accounts the time to *pullCounts. */
+static void prvAdvance( uint64_t ullEnd, uint64_t *pullCounts )
+{
+uint64_t ullNext;
+
+    *pullCounts += ullEnd - ullNow;
+    for( ;; )
+    {
+        ullNext = ullNextExternal;
+        if( xSysTickEnabled && ( ullSysTickNext < ullNext ) )
+        {
+            ullNext = ullSysTickNext;
+        }
+        if( ullNext > ullEnd )
+        {
+            break;
+        }
+
+        ullNow = ullNext;
+        if( xSysTickEnabled && ( ullSysTickNext == ullNow ) )
+        {
+            ullSysTickNext += ( uint64_t ) ulSysTickLoad + 1ULL;
+            xTickPending = pdTRUE;
+        }
+        else
+        {
+            ullNextExternal = ullNow + TICK_COUNTS * ( 5ULL + ( uint64_t ) ( ulHarnessRand( &ulExternalSeed ) % 70UL ) );
+            xExternalPending = pdTRUE;
+        }
+        prvServiceInterrupts();
+    }
+    ullNow = ullEnd;
+}
+
+/* Each read of the low power counter takes 250 ns. */
+uint32_t ulPortLPTimebaseGetCount( void )
+{
+    prvAdvance( ullNow + READ_COUNTS, &ullRunCounts );
+    return ( uint32_t ) prvLPCount( ullNow ) & ( uint32_t ) configLP_TIMEBASE_COUNTER_MASK;
+}
+
+void vPortLPTimebaseSetWakeup( uint32_t ulCount )
+{
+    xAlarmArmed = pdTRUE;
+    ulAlarmCount = ulCount;
+    ulAlarmSleeps++;
+}
+
+void vPortLPTimebaseClearWakeup( void )
+{
+    xAlarmArmed = pdFALSE;
+}
+
+void vSimSysTickStop( void )
+{
+    if( xSysTickEnabled )
+    {
+        ulSysTickValue = ( uint32_t ) ( ullSysTickNext - ullNow );
+        xSysTickEnabled = pdFALSE;
+    }
+}
+
+/* A cleared SysTick reloads on its next count, it then counts the load value
+down to 0. */
+void vSimSysTickStart( void )
+{
+    if( xSysTickEnabled == pdFALSE )
+    {
+        ullSysTickNext = ullNow + ( ( ulSysTickValue == 0UL ) ? ( ( uint64_t ) ulSysTickLoad + 1ULL ) : ( uint64_t ) ulSysTickValue );
+        xSysTickEnabled = pdTRUE;
+    }
+}
+
+void vSimSysTickClear( void )
+{
+    if( xSysTickEnabled )
+    {
+        ullSysTickNext = ullNow + ( uint64_t ) ulSysTickLoad + 1ULL;
+    }
+    else
+    {
+        ulSysTickValue = 0UL;
+    }
+}
+
+void vSimSysTickLoad( uint32_t ulLoad )
+{
+    ulSysTickLoad = ulLoad;
+}
+
+uint32_t ulSimSysTickValue( void )
+{
+    return xSysTickEnabled ? ( uint32_t ) ( ullSysTickNext - ullNow ) : ulSysTickValue;
+}
+
+void vSimDisableInterrupts( void )
+{
+    xInterruptsMasked = pdTRUE;
+}
+
+void vSimEnableInterrupts( void )
+{
+    xInterruptsMasked = pdFALSE;
+    prvServiceInterrupts();
+}
+
+/* Sleeps until the next interrupt or the alarm: in sleep mode while the
+SysTick runs, in stop mode otherwise, the wake up from which takes
+WAKEUP_COUNTS.  A pending interrupt ends the wait at once, even if it is
+masked. */
+void vSimWaitForInterrupt( void )
+{
+uint64_t ullWake = ullNextExternal, ullAlarm, ullCount;
+int xStopMode = ( xSysTickEnabled == pdFALSE );
+
+    if( xTickPending || xExternalPending )
+    {
+        return;
+    }
+
+    if( xSysTickEnabled && ( ullSysTickNext < ullWake ) )
+    {
+        ullWake = ullSysTickNext;
+    }
+    if( xAlarmArmed )
+    {
+        ullCount = prvLPCount( ullNow );
+        ullCount += ( ( ulAlarmCount - ( uint32_t ) ullCount ) & configLP_TIMEBASE_COUNTER_MASK );
+        ullAlarm = prvLPEdge( ullCount );
+        if( ullAlarm < ullWake )
+        {
+            ullWake = ullAlarm;
+        }
+    }
+
+    ulWakeups++;
+    if( ullWake == ullNextExternal )
+    {
+        ulExternalWakeups++;
+    }
+    else if( xStopMode == pdFALSE )
+    {
+        ulTickWakeups++;
+    }
+    prvAdvance( ullWake, xStopMode ? &ullStopCounts : &ullSleepCounts );
+
+    if( xStopMode )
+    {
+        prvAdvance( ullNow + WAKEUP_COUNTS, &ullRunCounts );
+    }
+    xWokenUp = pdTRUE;
+}
+
+/* The processing that follows a wake up, once the SysTick runs again. */
+static void prvWork( void )
+{
+    if( xWokenUp )
+    {
+        xWokenUp = pdFALSE;
+        prvAdvance( ullNow + WORK_COUNTS, &ullRunCounts );
+    }
+}
+
+/* portSUPPRESS_TICKS_AND_SLEEP(), see FreeRTOSConfig.h. */
+void vSimSuppressTicksAndSleep( uint32_t ulExpectedIdleTime )
+{
+    xSleepCalled = pdTRUE;
+    vPortSuppressTicksAndSleep( ( TickType_t ) ulExpectedIdleTime );
+    prvWork();
+}
+
+/* When the previous idle loop did not call the tickless idle function, for
+less than configEXPECTED_IDLE_TIME_BEFORE_SLEEP ticks, waits for the next
+interrupt in sleep mode. */
+void vApplicationIdleHook( void )
+{
+    if( xSleepCalled == pdFALSE )
+    {
+        vTaskSuspendAll();
+        vSimWaitForInterrupt();
+        prvWork();
+        ( void ) xTaskResumeAll();
+    }
+    xSleepCalled = pdFALSE;
+}
+
+static void prvPeriodicTask( void *pvParameters )
+{
+unsigned i = ( unsigned ) ( uintptr_t ) pvParameters;
+TickType_t xWakeTime = xTaskGetTickCount(), xLateness;
+
+    for( ;; )
+    {
+        vTaskDelayUntil( &xWakeTime, xPeriods[ i ] );
+        xLateness = xTaskGetTickCount() - xWakeTime;
+        if( xLateness > xMaxLateness[ i ] )
+        {
+            xMaxLateness[ i ] = xLateness;
+        }
+        ulLatenessSum[ i ] += xLateness;
+        ulRuns[ i ]++;
+    }
+}
+
+static void prvExternalTask( void *pvParameters )
+{
+    ( void ) pvParameters;
+
+    for( ;; )
+    {
+        ( void ) xSemaphoreTake( xExternalSemaphore, portMAX_DELAY );
+        ulExternalHandled++;
+    }
+}
+
+static void prvTimerCallback( TimerHandle_t xTimer )
+{
+    ulTimerRuns[ ( uintptr_t ) pvTimerGetTimerID( xTimer ) ]++;
+}
+
+static void prvControlTask( void *pvParameters )
+{
+const TickType_t xRunTicks = xHarnessBench ? 60000 : 10000;
+struct itimerval xStopTimer;
+TickType_t xStart, xTicks, xNow;
+uint64_t ullStart, ullTotal;
+double dSeconds, dRun, dSleep, dStop, dDrift;
+unsigned i;
+
+    ( void ) pvParameters;
+
+    /* From now on the simulated SysTick drives the kernel. */
+    memset( &xStopTimer, 0, sizeof( xStopTimer ) );
+    ( void ) setitimer( ITIMER_REAL, &xStopTimer, NULL );
+
+    xStart = xTaskGetTickCount();
+    ullStart = ullNow;
+    vSimSysTickLoad( TICK_COUNTS - 1UL );
+    vSimSysTickClear();
+    vSimSysTickStart();
+    ullNextExternal = ullNow + 40ULL * TICK_COUNTS;
+
+    vTaskDelay( xRunTicks );
+
+    /* The kernel time ends with the current tick period.  The tasks and
+    timers started at tick 0. */
+    xNow = xTaskGetTickCount();
+    xTicks = xNow - xStart;
+    ullTotal = ullNow - ullStart;
+    dDrift = ( ( double ) ( xTicks + 1 ) * TICK_COUNTS - ( double ) ulSimSysTickValue() - ( double ) ullTotal ) * 1e6 / configSYSTICK_CLOCK_HZ;
+
+    for( i = 0; i < PERIODIC_TASKS; i++ )
+    {
+        CHECK( xMaxLateness[ i ] <= configTICKLESS_SLACK_TICKS );
+        CHECK( ( ulRuns[ i ] + 1 ) * xPeriods[ i ] + configTICKLESS_SLACK_TICKS >= xNow );
+    }
+    for( i = 0; i < 2; i++ )
+    {
+        CHECK( ( ulTimerRuns[ i ] + 1 ) * xTimerPeriods[ i ] + configTICKLESS_SLACK_TICKS >= xNow );
+        CHECK( ulTimerRuns[ i ] * xTimerPeriods[ i ] <= xNow );
+    }
+    CHECK( ulExternalInterrupts > 0 );
+    CHECK( ulExternalHandled + 1 >= ulExternalInterrupts );
+    CHECK( ulAlarmSleeps > 0 );
+    /* The kernel time keeps within 100 ppm of the simulated time. */
+    CHECK( ( dDrift < ( double ) xTicks * 0.1 ) && ( dDrift > -( double ) xTicks * 0.1 ) );
+
+    if( xHarnessBench )
+    {
+        dSeconds = ( double ) ullTotal / configSYSTICK_CLOCK_HZ;
+        dSleep = ( double ) ullSleepCounts / configSYSTICK_CLOCK_HZ;
+        dStop = ( double ) ullStopCounts / configSYSTICK_CLOCK_HZ;
+        dRun = dSeconds - dSleep - dStop;
+
+        printf( "%s, slack %d ticks, %.0f s simulated:\n", TICKLESS_LP_NAME, configTICKLESS_SLACK_TICKS, dSeconds );
+        printf( "  wake ups/s        %7.1f  (%lu by the SysTick, %lu external)\n", ( double ) ulWakeups / dSeconds, ulTickWakeups, ulExternalWakeups );
+        printf( "  average current   %7.1f uA  (%.1f uA with the same sleeps in sleep mode)\n",
+                ( 7e-3 * dRun + 1.6e-3 * dSleep + 1.5e-6 * dStop ) / dSeconds * 1e6,
+                ( 7e-3 * dRun + 1.6e-3 * ( dSleep + dStop ) ) / dSeconds * 1e6 );
+        printf( "  lateness max/mean, ticks:" );
+        for( i = 0; i < PERIODIC_TASKS; i++ )
+        {
+            printf( "  %u/%.2f", ( unsigned ) xMaxLateness[ i ], ( ulRuns[ i ] != 0 ) ? ( double ) ulLatenessSum[ i ] / ( double ) ulRuns[ i ] : 0.0 );
+        }
+        printf( "\n  kernel time drift %+7.1f us\n", dDrift );
+    }
+
+    vHarnessExit( TICKLESS_LP_NAME );
+}
+
+int main( int argc, char **argv )
+{
+TimerHandle_t xTimer;
+unsigned i;
+
+    vHarnessInit( argc, argv );
+
+    xExternalSemaphore = xSemaphoreCreateBinary();
+    CHECK( xExternalSemaphore != NULL );
+    for( i = 0; i < PERIODIC_TASKS; i++ )
+    {
+        xTaskCreate( prvPeriodicTask, "Periodic", configMINIMAL_STACK_SIZE * 2, ( void * ) ( uintptr_t ) i, 2, NULL );
+    }
+    for( i = 0; i < 2; i++ )
+    {
+        xTimer = xTimerCreate( "Timer", xTimerPeriods[ i ], pdTRUE, ( void * ) ( uintptr_t ) i, prvTimerCallback );
+        CHECK( ( xTimer != NULL ) && ( xTimerStart( xTimer, 0 ) == pdPASS ) );
+    }
+    xTaskCreate( prvExternalTask, "External", configMINIMAL_STACK_SIZE * 2, NULL, 3, NULL );
+    xTaskCreate( prvControlTask, "Control", configMINIMAL_STACK_SIZE * 8, NULL, configMAX_PRIORITIES - 1, NULL );
+    vTaskStartScheduler();
+    return 1;
+}
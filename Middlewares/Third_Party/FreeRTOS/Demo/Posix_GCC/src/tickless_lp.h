@@ -0,0 +1,45 @@
+/*
+ * Simulated STM32L1 seen by the tickless idle mode of the GCC ARM_CM3 port,
+ * shared by src/tickless_lp.c and the port code that src/tickless_port.sed
+ * extracts from portable/GCC/ARM_CM3/port.c.
+ */
+
+#ifndef TICKLESS_LP_H
+#define TICKLESS_LP_H
+
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* A 32 MHz core clocking the SysTick, and a 16-bit low power counter at
+32768 Hz (an LPTIM on the LSE), from which a wake up takes 8 us. */
+#define configSYSTICK_CLOCK_HZ              ( 32000000UL )
+#define configUSE_TICKLESS_LP_TIMEBASE      1
+#define configLP_TIMEBASE_CLOCK_HZ          ( 32768UL )
+#define configLP_TIMEBASE_COUNTER_MASK      ( 0xffffUL )
+#define configLP_TIMEBASE_WAKEUP_LATENCY    ( 256UL )
+
+/* Static in port.c, set up by vPortSetupTimerInterrupt(). */
+extern uint32_t ulTimerCountsForOneTick;
+extern uint32_t xMaximumPossibleSuppressedTicks;
+extern uint32_t ulStoppedTimerCompensation;
+
+/* Low power timebase, implemented by the application on target. */
+uint32_t ulPortLPTimebaseGetCount( void );
+void vPortLPTimebaseSetWakeup( uint32_t ulCount );
+void vPortLPTimebaseClearWakeup( void );
+
+/* SysTick register accesses, cpsid i, cpsie i and wfi. */
+void vSimSysTickStop( void );
+void vSimSysTickStart( void );
+void vSimSysTickClear( void );
+void vSimSysTickLoad( uint32_t ulLoad );
+uint32_t ulSimSysTickValue( void );
+void vSimDisableInterrupts( void );
+void vSimEnableInterrupts( void );
+void vSimWaitForInterrupt( void );
+
+void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime );
+
+#endif /* TICKLESS_LP_H */
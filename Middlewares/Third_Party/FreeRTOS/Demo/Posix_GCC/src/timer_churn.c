@@ -0,0 +1,412 @@
+/*
+ * Software timers (timers.c), built once with the sorted list backend and
+ * twice with the timing wheel (configUSE_TIMER_WHEEL): with the default
+ * geometry, and with a small wheel that most periods overflow.
+ *
+ * The checks cover the expiry tick and xTimerGetExpiryTime() of one-shot and
+ * auto-reload timers, timers restarted or changed from timer callbacks (which
+ * the wheel executes directly), a timer deleting itself from its callback, a
+ * timer stopped before its expiry, and random start/stop/change period
+ * commands from a task.  A timer may run late when the host delays the timer
+ * task, never early.
+ *
+ * The benchmark measures the CPU time of the timer task, from the timer task
+ * thread: per random start/stop/reset command with 10 to 2000 active timers,
+ * then per callback of periodic timers that each reset 2 of 1000 active
+ * timers.
+ */
+
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+#include "harness.h"
+
+#ifndef TIMER_CHURN_NAME
+    #define TIMER_CHURN_NAME    "timer_churn"
+#endif
+
+/* A callback this many ticks after the expiry time counts as a failure. */
+#define MAX_LATENESS        50
+
+#define EXPIRY_TIMERS       300
+#define CHURN_TIMERS        200
+#define BENCH_TIMERS        2000
+#define CHAIN_TIMERS        50
+
+static unsigned long ulSeed = 1;
+
+/* Expiry checks. */
+static TimerHandle_t xExpiryTimers[ EXPIRY_TIMERS ];
+static TickType_t xStarted[ EXPIRY_TIMERS ], xPeriods[ EXPIRY_TIMERS ];
+static unsigned long ulFired[ EXPIRY_TIMERS ];
+static unsigned long ulLate;
+static volatile int iSelfDeleted, iStoppedFired;
+
+/* Set before the timers of a check are deleted, so that their callbacks no
+longer restart other timers. */
+static volatile int xDeleting;
+
+/* Random commands. */
+static TimerHandle_t xChurnTimers[ CHURN_TIMERS ];
+static unsigned long ulChurnSeed = 2, ulChurnFired;
+
+/* Benchmark. */
+static TimerHandle_t xBenchTimers[ BENCH_TIMERS ];
+static volatile double dDaemonStart, dDaemonEnd;
+static unsigned long ulChainCallbacks;
+
+/* CPU time of the calling thread, in nanoseconds. */
+static double prvThreadTime( void )
+{
+struct timespec xTime;
+
+    clock_gettime( CLOCK_THREAD_CPUTIME_ID, &xTime );
+    return ( double ) xTime.tv_sec * 1e9 + ( double ) xTime.tv_nsec;
+}
+
+/* Checks that a timer expires at xExpected, counting the late ones. */
+static void prvCheckExpiry( TickType_t xExpected )
+{
+TickType_t xLateness = xTaskGetTickCount() - xExpected;
+
+    CHECK( xLateness <= MAX_LATENESS );
+    if( xLateness > 1 )
+    {
+        ulLate++;
+    }
+}
+
+static void prvExpiryCallback( TimerHandle_t xTimer )
+{
+unsigned i = ( unsigned ) ( uintptr_t ) pvTimerGetTimerID( xTimer ), j;
+TickType_t xExpected = xStarted[ i ] + xPeriods[ i ] * ( TickType_t ) ( ulFired[ i ] + 1 );
+
+    prvCheckExpiry( xExpected );
+    if( ( i % 3 ) == 0 )
+    {
+        /* Auto-reload timers restart from their expiry time.  When the timer
+        task is late, the sorted list backend may call the callback again from
+        its command queue before it sets the next expiry time. */
+        #if( configUSE_TIMER_WHEEL == 0 )
+            CHECK( ( xTimerGetExpiryTime( xTimer ) == xExpected + xPeriods[ i ] ) || ( xTimerGetExpiryTime( xTimer ) == xExpected ) );
+        #else
+            CHECK( xTimerGetExpiryTime( xTimer ) == xExpected + xPeriods[ i ] );
+        #endif
+    }
+    else
+    {
+        CHECK( xTimerGetExpiryTime( xTimer ) == xExpected );
+    }
+    ulFired[ i ]++;
+
+    /* Every 7th timer restarts the next one from the callback. */
+    j = ( i + 1 ) % EXPIRY_TIMERS;
+    if( ( xDeleting == pdFALSE ) && ( ( i % 7 ) == 0 ) && ( xTimerIsTimerActive( xExpiryTimers[ j ] ) == pdFALSE ) )
+    {
+        taskENTER_CRITICAL();
+        {
+            if( xTimerReset( xExpiryTimers[ j ], 0 ) == pdPASS )
+            {
+                xStarted[ j ] = xTaskGetTickCount();
+                ulFired[ j ] = 0;
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+}
+
+static void prvSelfDeletingCallback( TimerHandle_t xTimer )
+{
+    iSelfDeleted++;
+    CHECK( xTimerDelete( xTimer, 0 ) == pdPASS );
+}
+
+static void prvStoppedCallback( TimerHandle_t xTimer )
+{
+    ( void ) xTimer;
+    iStoppedFired++;
+}
+
+static void prvCheckExpiryTimes( TickType_t xRunTime )
+{
+TimerHandle_t xSelfDeleting, xStopped;
+unsigned i;
+
+    /* The first timers have long periods, which also overflow the small
+    wheel.  Every third one auto-reloads. */
+    for( i = 0; i < EXPIRY_TIMERS; i++ )
+    {
+        xPeriods[ i ] = 1 + ( TickType_t ) ( ulHarnessRand( &ulSeed ) % ( ( i < 20 ) ? xRunTime - 100 : 400 ) );
+        xExpiryTimers[ i ] = xTimerCreate( "Expiry", xPeriods[ i ], ( i % 3 ) == 0, ( void * ) ( uintptr_t ) i, prvExpiryCallback );
+        CHECK( xExpiryTimers[ i ] != NULL );
+    }
+
+    vTaskDelay( 3 );
+    for( i = 0; i < EXPIRY_TIMERS; i++ )
+    {
+        taskENTER_CRITICAL();
+        {
+            xStarted[ i ] = xTaskGetTickCount();
+            CHECK( xTimerStart( xExpiryTimers[ i ], 0 ) == pdPASS );
+        }
+        taskEXIT_CRITICAL();
+
+        /* Leave the timer task some room in its queue. */
+        if( ( i % 32 ) == 31 )
+        {
+            vTaskDelay( 1 );
+        }
+    }
+
+    xSelfDeleting = xTimerCreate( "Delete", 10, pdTRUE, NULL, prvSelfDeletingCallback );
+    CHECK( xTimerStart( xSelfDeleting, 0 ) == pdPASS );
+    xStopped = xTimerCreate( "Stopped", 50, pdFALSE, NULL, prvStoppedCallback );
+    CHECK( xTimerStart( xStopped, 0 ) == pdPASS );
+    vTaskDelay( 20 );
+    CHECK( xTimerStop( xStopped, 0 ) == pdPASS );
+
+    vTaskDelay( xRunTime );
+
+    xDeleting = pdTRUE;
+    for( i = 0; i < EXPIRY_TIMERS; i++ )
+    {
+        /* Every timer has fired. */
+        CHECK( ( ulFired[ i ] > 0 ) || ( xTimerIsTimerActive( xExpiryTimers[ i ] ) != pdFALSE ) );
+        CHECK( xTimerDelete( xExpiryTimers[ i ], portMAX_DELAY ) == pdPASS );
+    }
+    CHECK( iSelfDeleted == 1 );
+    CHECK( iStoppedFired == 0 );
+    CHECK( xTimerDelete( xStopped, portMAX_DELAY ) == pdPASS );
+    xDeleting = pdFALSE;
+}
+
+/* The commands of the test task race with the expiries, so the callback
+checks the timer against its own expiry time. */
+static void prvChurnCallback( TimerHandle_t xTimer )
+{
+unsigned i = ( unsigned ) ( uintptr_t ) pvTimerGetTimerID( xTimer ), j;
+TickType_t xExpiry = xTimerGetExpiryTime( xTimer ), xPeriod;
+
+    if( ( i % 2 ) != 0 )
+    {
+        /* The expiry time is already the next one, see
+        prvExpiryCallback(). */
+        #if( configUSE_TIMER_WHEEL == 0 )
+            if( ( TickType_t ) ( xTaskGetTickCount() - xExpiry ) > MAX_LATENESS )
+        #endif
+        {
+            xExpiry -= xTimerGetPeriod( xTimer );
+        }
+    }
+    prvCheckExpiry( xExpiry );
+    ulChurnFired++;
+
+    /* One callback in four changes the period of a random timer. */
+    if( ( xDeleting == pdFALSE ) && ( ( ulHarnessRand( &ulChurnSeed ) % 4 ) == 0 ) )
+    {
+        j = ( unsigned ) ( ulHarnessRand( &ulChurnSeed ) % CHURN_TIMERS );
+        xPeriod = 1 + ( TickType_t ) ( ulHarnessRand( &ulChurnSeed ) % 300 );
+        ( void ) xTimerChangePeriod( xChurnTimers[ j ], xPeriod, 0 );
+    }
+}
+
+static void prvCheckRandomCommands( unsigned long ulCommands )
+{
+unsigned long k;
+unsigned i;
+TickType_t xPeriod;
+
+    for( i = 0; i < CHURN_TIMERS; i++ )
+    {
+        xChurnTimers[ i ] = xTimerCreate( "Churn", 1 + ( TickType_t ) ( ulHarnessRand( &ulSeed ) % 500 ), i % 2, ( void * ) ( uintptr_t ) i, prvChurnCallback );
+        CHECK( xChurnTimers[ i ] != NULL );
+    }
+
+    /* One command in three stops a timer, the others change its period,
+    which starts it.  One period in ten can be very long. */
+    for( k = 0; k < ulCommands; k++ )
+    {
+        i = ( unsigned ) ( ulHarnessRand( &ulSeed ) % CHURN_TIMERS );
+        xPeriod = 1 + ( TickType_t ) ( ulHarnessRand( &ulSeed ) % ( ( ( ulHarnessRand( &ulSeed ) % 10 ) == 0 ) ? 200000 : 400 ) );
+
+        if( ( k % 3 ) == 0 )
+        {
+            ( void ) xTimerStop( xChurnTimers[ i ], 0 );
+        }
+        else
+        {
+            ( void ) xTimerChangePeriod( xChurnTimers[ i ], xPeriod, 0 );
+        }
+
+        vTaskDelay( ( TickType_t ) ( ulHarnessRand( &ulSeed ) % 3 ) );
+    }
+    vTaskDelay( 500 );
+    CHECK( ulChurnFired > 0 );
+
+    /* Stopped timers stay quiet. */
+    xDeleting = pdTRUE;
+    for( i = 0; i < CHURN_TIMERS; i++ )
+    {
+        CHECK( xTimerStop( xChurnTimers[ i ], portMAX_DELAY ) == pdPASS );
+    }
+    vTaskDelay( 2 );
+    k = ulChurnFired;
+    vTaskDelay( 300 );
+    CHECK( ulChurnFired == k );
+
+    for( i = 0; i < CHURN_TIMERS; i++ )
+    {
+        CHECK( xTimerDelete( xChurnTimers[ i ], portMAX_DELAY ) == pdPASS );
+    }
+    xDeleting = pdFALSE;
+}
+
+/* Pended to the timer task to mark the start and the end of a measure. */
+static void prvMarkStart( void *pvParameter1, uint32_t ulParameter2 )
+{
+    ( void ) pvParameter1;
+    ( void ) ulParameter2;
+    dDaemonStart = prvThreadTime();
+}
+
+static void prvMarkEnd( void *pvParameter1, uint32_t ulParameter2 )
+{
+    ( void ) ulParameter2;
+    dDaemonEnd = prvThreadTime();
+    xTaskNotifyGive( ( TaskHandle_t ) pvParameter1 );
+}
+
+static void prvMeasureEnd( void )
+{
+    CHECK( xTimerPendFunctionCall( prvMarkEnd, xTaskGetCurrentTaskHandle(), 0, portMAX_DELAY ) == pdPASS );
+    ( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+}
+
+static void prvNoCallback( TimerHandle_t xTimer )
+{
+    ( void ) xTimer;
+}
+
+static void prvChainCallback( TimerHandle_t xTimer )
+{
+int k;
+
+    ( void ) xTimer;
+
+    for( k = 0; k < 2; k++ )
+    {
+        ( void ) xTimerReset( xBenchTimers[ ulHarnessRand( &ulChurnSeed ) % 1000 ], 0 );
+    }
+    ulChainCallbacks++;
+}
+
+static void prvBench( unsigned long ulCommands, TickType_t xChainTime )
+{
+static const unsigned uxActive[] = { 10, 100, 1000, 2000 };
+static TimerHandle_t xChainTimers[ CHAIN_TIMERS ];
+double dCommand[ 4 ];
+unsigned long k;
+unsigned i, s, n;
+
+    /* The timer task gets the commands as they come, from a task of higher
+    priority. */
+    vTaskPrioritySet( NULL, configTIMER_TASK_PRIORITY + 1 );
+
+    for( i = 0; i < BENCH_TIMERS; i++ )
+    {
+        xBenchTimers[ i ] = xTimerCreate( "Bench", 1000 + ( TickType_t ) ( ulHarnessRand( &ulSeed ) % 60000 ), pdFALSE, NULL, prvNoCallback );
+        CHECK( xBenchTimers[ i ] != NULL );
+    }
+
+    /* Random start/stop/reset commands: 1.5 commands per iteration. */
+    for( s = 0; s < 4; s++ )
+    {
+        n = uxActive[ s ];
+        for( i = 0; i < BENCH_TIMERS; i++ )
+        {
+            ( void ) xTimerStop( xBenchTimers[ i ], portMAX_DELAY );
+        }
+        for( i = 0; i < n; i++ )
+        {
+            ( void ) xTimerStart( xBenchTimers[ i ], portMAX_DELAY );
+        }
+        vTaskDelay( 2 );
+
+        CHECK( xTimerPendFunctionCall( prvMarkStart, NULL, 0, portMAX_DELAY ) == pdPASS );
+        for( k = 0; k < ulCommands; k++ )
+        {
+            i = ( unsigned ) ( ulHarnessRand( &ulSeed ) % n );
+            if( ( k & 1 ) != 0 )
+            {
+                ( void ) xTimerReset( xBenchTimers[ i ], portMAX_DELAY );
+            }
+            else
+            {
+                ( void ) xTimerStop( xBenchTimers[ i ], portMAX_DELAY );
+                ( void ) xTimerStart( xBenchTimers[ i ], portMAX_DELAY );
+            }
+        }
+        prvMeasureEnd();
+        dCommand[ s ] = ( dDaemonEnd - dDaemonStart ) / ( ( double ) ulCommands * 1.5 );
+    }
+
+    /* Periodic timers whose callbacks reset 2 of 1000 active timers. */
+    for( i = 0; i < BENCH_TIMERS; i++ )
+    {
+        ( void ) xTimerStop( xBenchTimers[ i ], portMAX_DELAY );
+    }
+    for( i = 0; i < 1000; i++ )
+    {
+        ( void ) xTimerStart( xBenchTimers[ i ], portMAX_DELAY );
+    }
+    for( i = 0; i < CHAIN_TIMERS; i++ )
+    {
+        xChainTimers[ i ] = xTimerCreate( "Chain", 2 + ( i % 5 ), pdTRUE, NULL, prvChainCallback );
+        CHECK( xChainTimers[ i ] != NULL );
+    }
+    vTaskDelay( 2 );
+
+    CHECK( xTimerPendFunctionCall( prvMarkStart, NULL, 0, portMAX_DELAY ) == pdPASS );
+    for( i = 0; i < CHAIN_TIMERS; i++ )
+    {
+        ( void ) xTimerStart( xChainTimers[ i ], portMAX_DELAY );
+    }
+    vTaskDelay( xChainTime );
+    for( i = 0; i < CHAIN_TIMERS; i++ )
+    {
+        ( void ) xTimerStop( xChainTimers[ i ], portMAX_DELAY );
+    }
+    prvMeasureEnd();
+    CHECK( ulChainCallbacks > 0 );
+
+    if( xHarnessBench )
+    {
+        printf( "%s, timer task CPU time per start/stop/reset command, %lu random commands, ns:\n", TIMER_CHURN_NAME, ulCommands );
+        printf( "  active timers %6u %6u %6u %6u\n", uxActive[ 0 ], uxActive[ 1 ], uxActive[ 2 ], uxActive[ 3 ] );
+        printf( "  time          %6.0f %6.0f %6.0f %6.0f\n", dCommand[ 0 ], dCommand[ 1 ], dCommand[ 2 ], dCommand[ 3 ] );
+        printf( "%d periodic timers resetting 2 of 1000 timers each: %lu callbacks, %.0f ns each\n",
+                CHAIN_TIMERS, ulChainCallbacks, ( dDaemonEnd - dDaemonStart ) / ( double ) ulChainCallbacks );
+        printf( "late callbacks (more than 1 tick): %lu\n", ulLate );
+    }
+}
+
+static void prvTestTask( void *pvParameters )
+{
+    ( void ) pvParameters;
+
+    prvCheckExpiryTimes( xHarnessBench ? 3500 : 1000 );
+    prvCheckRandomCommands( xHarnessBench ? 6000UL : 1000UL );
+    prvBench( xHarnessBench ? 20000UL : 2000UL, xHarnessBench ? 500 : 50 );
+
+    vHarnessExit( TIMER_CHURN_NAME );
+}
+
+int main( int argc, char **argv )
+{
+    vHarnessInit( argc, argv );
+    xTaskCreate( prvTestTask, "Test", 1024, NULL, 2, NULL );
+    vTaskStartScheduler();
+    return 1;
+}
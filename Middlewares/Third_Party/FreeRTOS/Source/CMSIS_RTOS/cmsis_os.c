@@ -860,17 +860,19 @@ osStatus osSemaphoreDelete (osSemaphoreId semaphore_id)
 
 #if (defined (osFeature_Pool)  &&  (osFeature_Pool != 0)) 
 
-//TODO
-//This is a primitive and inefficient wrapper around the existing FreeRTOS memory management.
-//A better implementation will have to modify heap_x.c!
-
+/* Fixed-size block pool with an intrusive free list: a free block holds the
+   address of the next free block, so osPoolAlloc() and osPoolFree() are
+   constant time whatever the pool size, and the interrupt mask is held only
+   for a few instructions. */
 
 typedef struct os_pool_cb {
   void *pool;
   uint8_t *markers;
   uint32_t pool_sz;
   uint32_t item_sz;
-  uint32_t currentIndex;
+  void *free_list;
+  uint32_t used;
+  uint32_t max_used;
 } os_pool_cb_t;
 
 
@@ -884,29 +886,40 @@ osPoolId osPoolCreate (const osPoolDef_t *pool_def)
 {
 #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
   osPoolId thePool;
-  int itemSize = 4 * ((pool_def->item_sz + 3) / 4);
+  /* Blocks are word aligned and large enough to hold the free list link */
+  uint32_t itemSize = sizeof(void *) * ((pool_def->item_sz + sizeof(void *) - 1) / sizeof(void *));
   uint32_t i;
-  
+  uint8_t *block;
+
+  if ((pool_def->pool_sz == 0) || (itemSize == 0)) {
+    return NULL;
+  }
+
   /* First have to allocate memory for the pool control block. */
- thePool = pvPortMalloc(sizeof(os_pool_cb_t));
+  thePool = pvPortMalloc(sizeof(os_pool_cb_t));
 
-  
   if (thePool) {
     thePool->pool_sz = pool_def->pool_sz;
     thePool->item_sz = itemSize;
-    thePool->currentIndex = 0;
-    
-    /* Memory for markers */
+    thePool->used = 0;
+    thePool->max_used = 0;
+
+    /* Memory for markers, used to reject the release of a free block */
     thePool->markers = pvPortMalloc(pool_def->pool_sz);
-   
+
     if (thePool->markers) {
       /* Now allocate the pool itself. */
-     thePool->pool = pvPortMalloc(pool_def->pool_sz * itemSize);
-      
+      thePool->pool = pvPortMalloc(pool_def->pool_sz * itemSize);
+
       if (thePool->pool) {
+        /* Chain all the blocks in address order */
+        block = (uint8_t *)thePool->pool;
         for (i = 0; i < pool_def->pool_sz; i++) {
           thePool->markers[i] = 0;
+          *(void **)block = (i < (pool_def->pool_sz - 1)) ? (void *)(block + itemSize) : NULL;
+          block += itemSize;
         }
+        thePool->free_list = thePool->pool;
       }
       else {
         vPortFree(thePool->markers);
@@ -921,7 +934,7 @@ osPoolId osPoolCreate (const osPoolDef_t *pool_def)
   }
 
   return thePool;
- 
+
 #else
   return NULL;
 #endif
@@ -935,36 +948,39 @@ osPoolId osPoolCreate (const osPoolDef_t *pool_def)
 */
 void *osPoolAlloc (osPoolId pool_id)
 {
-  int dummy = 0;
-  void *p = NULL;
-  uint32_t i;
-  uint32_t index;
-  
-  if (inHandlerMode()) {
+  UBaseType_t dummy = 0;
+  int isr;
+  void *p;
+
+  if (pool_id == NULL) {
+    return NULL;
+  }
+
+  isr = inHandlerMode();
+  if (isr) {
     dummy = portSET_INTERRUPT_MASK_FROM_ISR();
   }
   else {
     vPortEnterCritical();
   }
-  
-  for (i = 0; i < pool_id->pool_sz; i++) {
-    index = (pool_id->currentIndex + i) % pool_id->pool_sz;
-    
-    if (pool_id->markers[index] == 0) {
-      pool_id->markers[index] = 1;
-      p = (void *)((uint32_t)(pool_id->pool) + (index * pool_id->item_sz));
-      pool_id->currentIndex = index;
-      break;
+
+  p = pool_id->free_list;
+  if (p != NULL) {
+    pool_id->free_list = *(void **)p;
+    pool_id->markers[((uint8_t *)p - (uint8_t *)pool_id->pool) / pool_id->item_sz] = 1;
+    pool_id->used++;
+    if (pool_id->used > pool_id->max_used) {
+      pool_id->max_used = pool_id->used;
     }
   }
-  
-  if (inHandlerMode()) {
+
+  if (isr) {
     portCLEAR_INTERRUPT_MASK_FROM_ISR(dummy);
   }
   else {
     vPortExitCritical();
   }
-  
+
   return p;
 }
 
@@ -977,12 +993,12 @@ void *osPoolAlloc (osPoolId pool_id)
 void *osPoolCAlloc (osPoolId pool_id)
 {
   void *p = osPoolAlloc(pool_id);
-  
+
   if (p != NULL)
   {
-    memset(p, 0, sizeof(pool_id->pool_sz));
+    memset(p, 0, pool_id->item_sz);
   }
-  
+
   return p;
 }
 
@@ -995,21 +1011,24 @@ void *osPoolCAlloc (osPoolId pool_id)
 */
 osStatus osPoolFree (osPoolId pool_id, void *block)
 {
+  UBaseType_t dummy = 0;
+  int isr;
   uint32_t index;
-  
+  osStatus status = osOK;
+
   if (pool_id == NULL) {
     return osErrorParameter;
   }
-  
+
   if (block == NULL) {
     return osErrorParameter;
   }
-  
-  if (block < pool_id->pool) {
+
+  if ((uint8_t *)block < (uint8_t *)pool_id->pool) {
     return osErrorParameter;
   }
-  
-  index = (uint32_t)block - (uint32_t)(pool_id->pool);
+
+  index = (uint32_t)((uint8_t *)block - (uint8_t *)pool_id->pool);
   if (index % pool_id->item_sz) {
     return osErrorParameter;
   }
@@ -1017,9 +1036,72 @@ osStatus osPoolFree (osPoolId pool_id, void *block)
   if (index >= pool_id->pool_sz) {
     return osErrorParameter;
   }
-  
-  pool_id->markers[index] = 0;
-  
+
+  isr = inHandlerMode();
+  if (isr) {
+    dummy = portSET_INTERRUPT_MASK_FROM_ISR();
+  }
+  else {
+    vPortEnterCritical();
+  }
+
+  if (pool_id->markers[index] != 0) {
+    pool_id->markers[index] = 0;
+    *(void **)block = pool_id->free_list;
+    pool_id->free_list = block;
+    pool_id->used--;
+  }
+  else {
+    /* Block already free: linking it again would corrupt the free list */
+    status = osErrorParameter;
+  }
+
+  if (isr) {
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(dummy);
+  }
+  else {
+    vPortExitCritical();
+  }
+
+  return status;
+}
+
+/**
+* @brief  Get the usage statistics of a memory pool
+* @param  pool_id       memory pool ID obtain referenced with \ref osPoolCreate.
+* @param  info          structure filled with the pool geometry, the number of
+*                       blocks in use and the high-water mark of that number.
+* @retval  status code that indicates the execution status of the function.
+*/
+osStatus osPoolGetInfo (osPoolId pool_id, osPoolInfo_t *info)
+{
+  UBaseType_t dummy = 0;
+  int isr;
+
+  if ((pool_id == NULL) || (info == NULL)) {
+    return osErrorParameter;
+  }
+
+  isr = inHandlerMode();
+  if (isr) {
+    dummy = portSET_INTERRUPT_MASK_FROM_ISR();
+  }
+  else {
+    vPortEnterCritical();
+  }
+
+  info->pool_sz = pool_id->pool_sz;
+  info->item_sz = pool_id->item_sz;
+  info->used = pool_id->used;
+  info->max_used = pool_id->max_used;
+
+  if (isr) {
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(dummy);
+  }
+  else {
+    vPortExitCritical();
+  }
+
   return osOK;
 }
 
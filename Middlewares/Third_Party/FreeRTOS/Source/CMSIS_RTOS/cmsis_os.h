@@ -1019,6 +1019,24 @@ osStatus osRecursiveMutexWait (osMutexId mutex_id, uint32_t millisec);
 */
 uint32_t osSemaphoreGetCount(osSemaphoreId semaphore_id);
 
+#if (defined (osFeature_Pool)  &&  (osFeature_Pool != 0))
+/// Memory pool usage statistics, see \ref osPoolGetInfo.
+typedef struct os_pool_info {
+  uint32_t                 pool_sz;    ///< number of blocks in the pool
+  uint32_t                 item_sz;    ///< size of a block, rounded up to the word size
+  uint32_t                    used;    ///< number of blocks currently allocated
+  uint32_t                max_used;    ///< high-water mark of used
+} osPoolInfo_t;
+
+/**
+* @brief  Get the usage statistics of a memory pool
+* @param  pool_id       memory pool ID obtain referenced with \ref osPoolCreate.
+* @param  info          structure filled with the pool statistics.
+* @retval  status code that indicates the execution status of the function.
+*/
+osStatus osPoolGetInfo (osPoolId pool_id, osPoolInfo_t *info);
+#endif /* osFeature_Pool */
+
 #ifdef  __cplusplus
 }
 #endif
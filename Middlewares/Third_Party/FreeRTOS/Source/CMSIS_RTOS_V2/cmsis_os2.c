@@ -32,6 +32,8 @@
 #include "event_groups.h"               // ARM.FreeRTOS::RTOS:Event Groups
 #include "semphr.h"                     // ARM.FreeRTOS::RTOS:Core
 
+#include "freertos_mpool.h"             // ARM.FreeRTOS::RTOS:MemoryPool
+
 /*---------------------------------------------------------------------------*/
 #ifndef __ARM_ARCH_6M__
   #define __ARM_ARCH_6M__         0
@@ -96,8 +98,8 @@ typedef struct {
 /* Kernel initialization state */
 static osKernelState_t KernelState;
 
-/* Heap region definition used by heap_5 variant */
-#if defined(USE_FreeRTOS_HEAP_5)
+/* Heap region definition used by heap_5 and heap_tlsf variants */
+#if defined(USE_FreeRTOS_HEAP_5) || defined(USE_FreeRTOS_HEAP_TLSF)
 #if (configAPPLICATION_ALLOCATED_HEAP == 1)
 /*
   The application writer has already defined the array used for the RTOS
@@ -112,7 +114,7 @@ static HeapRegion_t xHeapRegions[] = {
   { ucHeap, configTOTAL_HEAP_SIZE },
   { NULL,   0                     }
 };
-#endif /* USE_FreeRTOS_HEAP_5 */
+#endif /* USE_FreeRTOS_HEAP_5 || USE_FreeRTOS_HEAP_TLSF */
 
 #if defined(SysTick)
 /* FreeRTOS tick timer interrupt handler prototype */
@@ -140,7 +142,7 @@ osStatus_t osKernelInitialize (void) {
   }
   else {
     if (KernelState == osKernelInactive) {
-      #if defined(USE_FreeRTOS_HEAP_5)
+      #if defined(USE_FreeRTOS_HEAP_5) || defined(USE_FreeRTOS_HEAP_TLSF)
         vPortDefineHeapRegions (xHeapRegions);
       #endif
       KernelState = osKernelReady;
@@ -1240,7 +1242,7 @@ osMutexId_t osMutexNew (const osMutexAttr_t *attr) {
       #endif
 
       if ((hMutex != NULL) && (rmtx != 0U)) {
-        hMutex = (SemaphoreHandle_t)((uint32_t)hMutex | 1U);
+        hMutex = (SemaphoreHandle_t)((uintptr_t)hMutex | 1U);
       }
     }
   }
@@ -1253,9 +1255,9 @@ osStatus_t osMutexAcquire (osMutexId_t mutex_id, uint32_t timeout) {
   osStatus_t stat;
   uint32_t rmtx;
 
-  hMutex = (SemaphoreHandle_t)((uint32_t)mutex_id & ~1U);
+  hMutex = (SemaphoreHandle_t)((uintptr_t)mutex_id & ~(uintptr_t)1U);
 
-  rmtx = (uint32_t)mutex_id & 1U;
+  rmtx = (uint32_t)((uintptr_t)mutex_id & 1U);
 
   stat = osOK;
 
@@ -1294,9 +1296,9 @@ osStatus_t osMutexRelease (osMutexId_t mutex_id) {
   osStatus_t stat;
   uint32_t rmtx;
 
-  hMutex = (SemaphoreHandle_t)((uint32_t)mutex_id & ~1U);
+  hMutex = (SemaphoreHandle_t)((uintptr_t)mutex_id & ~(uintptr_t)1U);
 
-  rmtx = (uint32_t)mutex_id & 1U;
+  rmtx = (uint32_t)((uintptr_t)mutex_id & 1U);
 
   stat = osOK;
 
@@ -1326,7 +1328,7 @@ osThreadId_t osMutexGetOwner (osMutexId_t mutex_id) {
   SemaphoreHandle_t hMutex;
   osThreadId_t owner;
 
-  hMutex = (SemaphoreHandle_t)((uint32_t)mutex_id & ~1U);
+  hMutex = (SemaphoreHandle_t)((uintptr_t)mutex_id & ~(uintptr_t)1U);
 
   if (IS_IRQ() || (hMutex == NULL)) {
     owner = NULL;
@@ -1342,7 +1344,7 @@ osStatus_t osMutexDelete (osMutexId_t mutex_id) {
 #ifndef USE_FreeRTOS_HEAP_1
   SemaphoreHandle_t hMutex;
 
-  hMutex = (SemaphoreHandle_t)((uint32_t)mutex_id & ~1U);
+  hMutex = (SemaphoreHandle_t)((uintptr_t)mutex_id & ~(uintptr_t)1U);
 
   if (IS_IRQ()) {
     stat = osErrorISR;
@@ -1542,6 +1544,530 @@ osStatus_t osSemaphoreDelete (osSemaphoreId_t semaphore_id) {
 
 /*---------------------------------------------------------------------------*/
 
+/*
+  Memory pools keep their free blocks in an intrusive singly linked list, so
+  that osMemoryPoolAlloc and osMemoryPoolFree run in constant time. The list
+  is only touched inside a critical section of a few instructions: a lock-free
+  pop is not ABA-safe when blocks are recycled by other threads or interrupts.
+
+  A thread that waits for a block queues a MemPoolWaiter_t from its own stack
+  and sleeps on its task notification. osMemoryPoolFree hands the released
+  block over to the first waiter and wakes it with eNoAction, which leaves the
+  thread flags (notification value) untouched.
+
+  The link held by a free block is XORed with MPOOL_LINK_KEY. The first word
+  of an allocated block is application data, which hardly ever decodes to
+  NULL or to a block of the same pool: osMemoryPoolFree only walks the free
+  list to confirm a double free when it does.
+*/
+
+static void MemPool_SetLink (void *block, void *next) {
+  *(uintptr_t *)block = (uintptr_t)next ^ MPOOL_LINK_KEY;
+}
+
+static void *MemPool_GetLink (void *block) {
+  return ((void *)(*(uintptr_t *)block ^ MPOOL_LINK_KEY));
+}
+
+static uint32_t MemPool_IsBlock (MemPool_t *mp, void *p) {
+  uint32_t offs;
+
+  if (((uint8_t *)p < mp->mem_arr) || ((uint8_t *)p >= (mp->mem_arr + mp->mem_sz))) {
+    return (0U);
+  }
+
+  offs = (uint32_t)((uint8_t *)p - mp->mem_arr);
+
+  return (((offs % mp->bl_sz) == 0U) ? 1U : 0U);
+}
+
+static uint32_t MemPool_IsFree (MemPool_t *mp, void *block) {
+  void *p;
+
+  p = MemPool_GetLink (block);
+
+  if ((p != NULL) && (MemPool_IsBlock (mp, p) == 0U)) {
+    /* Application data: the block is allocated */
+    return (0U);
+  }
+
+  for (p = mp->free_head; p != NULL; p = MemPool_GetLink (p)) {
+    if (p == block) {
+      return (1U);
+    }
+  }
+
+  return (0U);
+}
+
+static void *MemPool_Pop (MemPool_t *mp) {
+  void *block;
+
+  block = mp->free_head;
+
+  if (block != NULL) {
+    mp->free_head = MemPool_GetLink (block);
+    mp->n++;
+
+    if (mp->n > mp->max_n) {
+      mp->max_n = mp->n;
+    }
+  }
+
+  return (block);
+}
+
+static void MemPool_Unlink (MemPool_t *mp, MemPoolWaiter_t *wt) {
+  MemPoolWaiter_t *prev, *curr;
+
+  prev = NULL;
+  curr = mp->wait_head;
+
+  while ((curr != NULL) && (curr != wt)) {
+    prev = curr;
+    curr = curr->next;
+  }
+
+  if (curr != NULL) {
+    if (prev == NULL) {
+      mp->wait_head = curr->next;
+    } else {
+      prev->next = curr->next;
+    }
+
+    if (mp->wait_tail == curr) {
+      mp->wait_tail = prev;
+    }
+  }
+}
+
+osMemoryPoolId_t osMemoryPoolNew (uint32_t block_count, uint32_t block_size, const osMemoryPoolAttr_t *attr) {
+  MemPool_t *mp;
+  const char *name;
+  int32_t mem_cb, mem_mp;
+  uint32_t sz, i;
+  uint8_t *block;
+
+  mp = NULL;
+
+  if (!IS_IRQ() && (block_count > 0U) && (block_size > 0U)) {
+    sz = MEMPOOL_BLOCK_SIZE (block_size);
+
+    if ((sz >= block_size) && (block_count <= (0xFFFFFFFFU / sz))) {
+      sz *= block_count;
+      name = NULL;
+      mem_cb = -1;
+      mem_mp = -1;
+
+      if (attr != NULL) {
+        name = attr->name;
+
+        if ((attr->cb_mem != NULL) && (attr->cb_size >= sizeof(MemPool_t))) {
+          mem_cb = 1;
+        }
+        else {
+          if ((attr->cb_mem == NULL) && (attr->cb_size == 0U)) {
+            mem_cb = 0;
+          }
+        }
+
+        if ((attr->mp_mem != NULL) && (attr->mp_size >= sz) &&
+            ((((uint32_t)(uintptr_t)attr->mp_mem) & (sizeof(void *) - 1U)) == 0U)) {
+          mem_mp = 1;
+        }
+        else {
+          if ((attr->mp_mem == NULL) && (attr->mp_size == 0U)) {
+            mem_mp = 0;
+          }
+        }
+      }
+      else {
+        mem_cb = 0;
+        mem_mp = 0;
+      }
+
+      #if (configSUPPORT_DYNAMIC_ALLOCATION == 0)
+      if ((mem_cb == 0) || (mem_mp == 0)) {
+        mem_cb = -1;
+      }
+      #endif
+
+      if ((mem_cb != -1) && (mem_mp != -1)) {
+        if (mem_cb == 1) {
+          mp = (MemPool_t *)attr->cb_mem;
+          mp->status = MPOOL_STATUS;
+        }
+        else {
+          #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+          mp = pvPortMalloc (sizeof(MemPool_t));
+
+          if (mp != NULL) {
+            mp->status = MPOOL_STATUS | MPOOL_STATUS_DMEM_CB;
+          }
+          #endif
+        }
+
+        if (mp != NULL) {
+          if (mem_mp == 1) {
+            mp->mem_arr = (uint8_t *)attr->mp_mem;
+          }
+          else {
+            #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+            mp->mem_arr = pvPortMalloc (sz);
+
+            if (mp->mem_arr != NULL) {
+              mp->status |= MPOOL_STATUS_DMEM_MP;
+            }
+            #endif
+          }
+
+          if (mp->mem_arr == NULL) {
+            #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+            if ((mp->status & MPOOL_STATUS_DMEM_CB) != 0U) {
+              vPortFree (mp);
+            }
+            #endif
+            mp = NULL;
+          }
+        }
+
+        if (mp != NULL) {
+          mp->name      = name;
+          mp->mem_sz    = sz;
+          mp->bl_sz     = MEMPOOL_BLOCK_SIZE (block_size);
+          mp->bl_cnt    = block_count;
+          mp->n         = 0U;
+          mp->max_n     = 0U;
+          mp->wait_head = NULL;
+          mp->wait_tail = NULL;
+
+          /* Chain the blocks in address order */
+          block = mp->mem_arr;
+          for (i = 1U; i < block_count; i++) {
+            MemPool_SetLink (block, block + mp->bl_sz);
+            block += mp->bl_sz;
+          }
+          MemPool_SetLink (block, NULL);
+
+          mp->free_head = mp->mem_arr;
+          mp->status   |= MPOOL_STATUS_ACTIVE;
+        }
+      }
+    }
+  }
+
+  return ((osMemoryPoolId_t)mp);
+}
+
+const char *osMemoryPoolGetName (osMemoryPoolId_t mp_id) {
+  MemPool_t *mp = (MemPool_t *)mp_id;
+  const char *p;
+
+  if (IS_IRQ() || (mp == NULL)) {
+    p = NULL;
+  }
+  else {
+    p = mp->name;
+  }
+
+  return (p);
+}
+
+void *osMemoryPoolAlloc (osMemoryPoolId_t mp_id, uint32_t timeout) {
+  MemPool_t *mp = (MemPool_t *)mp_id;
+  MemPoolWaiter_t wt;
+  TickType_t t0, td, tout;
+  BaseType_t rval, spurious;
+  uint32_t isrm;
+  void *block;
+
+  block = NULL;
+
+  if (mp == NULL) {
+    /* Invalid input parameters */
+  }
+  else if (IS_IRQ()) {
+    if (timeout == 0U) {
+      isrm = taskENTER_CRITICAL_FROM_ISR();
+
+      if ((mp->status & MPOOL_STATUS_ACTIVE) != 0U) {
+        block = MemPool_Pop (mp);
+      }
+
+      taskEXIT_CRITICAL_FROM_ISR (isrm);
+    }
+  }
+  else {
+    wt.next      = NULL;
+    wt.task      = xTaskGetCurrentTaskHandle();
+    wt.block     = NULL;
+    wt.cancelled = 0U;
+
+    taskENTER_CRITICAL();
+
+    if ((mp->status & MPOOL_STATUS_ACTIVE) != 0U) {
+      block = MemPool_Pop (mp);
+
+      if ((block == NULL) && (timeout != 0U)) {
+        /* Queue behind the threads already waiting for a block */
+        if (mp->wait_tail == NULL) {
+          mp->wait_head = &wt;
+        } else {
+          mp->wait_tail->next = &wt;
+        }
+        mp->wait_tail = &wt;
+      }
+      else {
+        timeout = 0U;
+      }
+    }
+    else {
+      timeout = 0U;
+    }
+
+    taskEXIT_CRITICAL();
+
+    if (timeout != 0U) {
+      spurious = pdFALSE;
+      tout = (TickType_t)timeout;
+      t0 = xTaskGetTickCount();
+
+      for (;;) {
+        rval = xTaskNotifyWait (0U, 0U, NULL, tout);
+
+        taskENTER_CRITICAL();
+
+        if ((wt.block != NULL) || (wt.cancelled != 0U)) {
+          /* Block handed over by osMemoryPoolFree, or pool deleted */
+          block = wt.block;
+          taskEXIT_CRITICAL();
+          break;
+        }
+
+        if (rval == pdPASS) {
+          /* Woken by osThreadFlagsSet or a direct task notification */
+          spurious = pdTRUE;
+
+          if (tout != portMAX_DELAY) {
+            td = xTaskGetTickCount() - t0;
+
+            if (td >= (TickType_t)timeout) {
+              rval = pdFAIL;
+            } else {
+              tout = (TickType_t)timeout - td;
+            }
+          }
+        }
+
+        if (rval != pdPASS) {
+          MemPool_Unlink (mp, &wt);
+          taskEXIT_CRITICAL();
+          break;
+        }
+
+        taskEXIT_CRITICAL();
+      }
+
+      if (spurious != pdFALSE) {
+        /* Give the consumed notification back to osThreadFlagsWait */
+        xTaskNotify (wt.task, 0U, eNoAction);
+      }
+    }
+  }
+
+  return (block);
+}
+
+osStatus_t osMemoryPoolFree (osMemoryPoolId_t mp_id, void *block) {
+  MemPool_t *mp = (MemPool_t *)mp_id;
+  MemPoolWaiter_t *wt;
+  TaskHandle_t hTask;
+  osStatus_t stat;
+  BaseType_t yield;
+  uint32_t isrm;
+  int32_t isr;
+
+  if ((mp == NULL) || (block == NULL)) {
+    stat = osErrorParameter;
+  }
+  else if (MemPool_IsBlock (mp, block) == 0U) {
+    stat = osErrorParameter;
+  }
+  else {
+    stat  = osOK;
+    hTask = NULL;
+    isrm  = 0U;
+    isr   = IS_IRQ() ? 1 : 0;
+
+    if (isr != 0) {
+      isrm = taskENTER_CRITICAL_FROM_ISR();
+    } else {
+      taskENTER_CRITICAL();
+    }
+
+    if (((mp->status & MPOOL_STATUS_ACTIVE) == 0U) || (mp->n == 0U)) {
+      stat = osErrorResource;
+    }
+    else if (MemPool_IsFree (mp, block) != 0U) {
+      /* Block already released */
+      stat = osErrorParameter;
+    }
+    else {
+      wt = mp->wait_head;
+
+      if (wt != NULL) {
+        /* Hand the block over: it stays allocated */
+        mp->wait_head = wt->next;
+        if (mp->wait_head == NULL) {
+          mp->wait_tail = NULL;
+        }
+        hTask = wt->task;
+        wt->block = block;
+      }
+      else {
+        MemPool_SetLink (block, mp->free_head);
+        mp->free_head = block;
+        mp->n--;
+      }
+    }
+
+    if (isr != 0) {
+      taskEXIT_CRITICAL_FROM_ISR (isrm);
+    } else {
+      taskEXIT_CRITICAL();
+    }
+
+    if (hTask != NULL) {
+      if (isr != 0) {
+        yield = pdFALSE;
+        xTaskNotifyFromISR (hTask, 0U, eNoAction, &yield);
+        portYIELD_FROM_ISR (yield);
+      } else {
+        xTaskNotify (hTask, 0U, eNoAction);
+      }
+    }
+  }
+
+  return (stat);
+}
+
+uint32_t osMemoryPoolGetCapacity (osMemoryPoolId_t mp_id) {
+  MemPool_t *mp = (MemPool_t *)mp_id;
+  uint32_t n;
+
+  if ((mp == NULL) || ((mp->status & MPOOL_STATUS) != MPOOL_STATUS)) {
+    n = 0U;
+  } else {
+    n = mp->bl_cnt;
+  }
+
+  return (n);
+}
+
+uint32_t osMemoryPoolGetBlockSize (osMemoryPoolId_t mp_id) {
+  MemPool_t *mp = (MemPool_t *)mp_id;
+  uint32_t sz;
+
+  if ((mp == NULL) || ((mp->status & MPOOL_STATUS) != MPOOL_STATUS)) {
+    sz = 0U;
+  } else {
+    sz = mp->bl_sz;
+  }
+
+  return (sz);
+}
+
+uint32_t osMemoryPoolGetCount (osMemoryPoolId_t mp_id) {
+  MemPool_t *mp = (MemPool_t *)mp_id;
+  uint32_t n;
+
+  if ((mp == NULL) || ((mp->status & MPOOL_STATUS) != MPOOL_STATUS)) {
+    n = 0U;
+  } else {
+    /* Single aligned word: read atomically */
+    n = mp->n;
+  }
+
+  return (n);
+}
+
+uint32_t osMemoryPoolGetSpace (osMemoryPoolId_t mp_id) {
+  MemPool_t *mp = (MemPool_t *)mp_id;
+  uint32_t n;
+
+  if ((mp == NULL) || ((mp->status & MPOOL_STATUS) != MPOOL_STATUS)) {
+    n = 0U;
+  } else {
+    n = mp->bl_cnt - mp->n;
+  }
+
+  return (n);
+}
+
+osStatus_t osMemoryPoolDelete (osMemoryPoolId_t mp_id) {
+  MemPool_t *mp = (MemPool_t *)mp_id;
+  MemPoolWaiter_t *wt;
+  TaskHandle_t hTask;
+  osStatus_t stat;
+
+#ifndef USE_FreeRTOS_HEAP_1
+  if (IS_IRQ()) {
+    stat = osErrorISR;
+  }
+  else if ((mp == NULL) || ((mp->status & MPOOL_STATUS) != MPOOL_STATUS)) {
+    stat = osErrorParameter;
+  }
+  else {
+    stat = osOK;
+
+    taskENTER_CRITICAL();
+    mp->status &= ~MPOOL_STATUS_ACTIVE;
+    taskEXIT_CRITICAL();
+
+    /* Release the waiting threads one at a time: osMemoryPoolAlloc returns NULL */
+    do {
+      taskENTER_CRITICAL();
+
+      wt = mp->wait_head;
+      hTask = NULL;
+
+      if (wt != NULL) {
+        mp->wait_head = wt->next;
+        if (mp->wait_head == NULL) {
+          mp->wait_tail = NULL;
+        }
+        hTask = wt->task;
+        wt->cancelled = 1U;
+      }
+
+      taskEXIT_CRITICAL();
+
+      if (hTask != NULL) {
+        xTaskNotify (hTask, 0U, eNoAction);
+      }
+    }
+    while (wt != NULL);
+
+    mp->status &= ~MPOOL_STATUS;
+
+    #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+    if ((mp->status & MPOOL_STATUS_DMEM_MP) != 0U) {
+      vPortFree (mp->mem_arr);
+    }
+    if ((mp->status & MPOOL_STATUS_DMEM_CB) != 0U) {
+      vPortFree (mp);
+    }
+    #endif
+  }
+#else
+  stat = osError;
+#endif
+
+  return (stat);
+}
+
+/*---------------------------------------------------------------------------*/
+
 osMessageQueueId_t osMessageQueueNew (uint32_t msg_count, uint32_t msg_size, const osMessageQueueAttr_t *attr) {
   QueueHandle_t hQueue;
   int32_t mem;
@@ -1677,6 +2203,100 @@ osStatus_t osMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *
   return (stat);
 }
 
+osStatus_t osMessageQueuePutMultiple (osMessageQueueId_t mq_id, const void *msg_ptr, uint32_t msg_count, uint32_t *msg_put, uint32_t timeout) {
+  QueueHandle_t hQueue = (QueueHandle_t)mq_id;
+  osStatus_t stat;
+  BaseType_t yield;
+  UBaseType_t count;
+
+  stat  = osOK;
+  count = 0U;
+
+  if ((hQueue == NULL) || (msg_ptr == NULL) || (msg_count == 0U)) {
+    stat = osErrorParameter;
+  }
+  else if (IS_IRQ()) {
+    if (timeout != 0U) {
+      stat = osErrorParameter;
+    }
+    else {
+      yield = pdFALSE;
+
+      count = xQueueSendMultipleFromISR (hQueue, msg_ptr, (UBaseType_t)msg_count, &yield);
+
+      if (count == 0U) {
+        stat = osErrorResource;
+      } else {
+        portYIELD_FROM_ISR (yield);
+      }
+    }
+  }
+  else {
+    count = xQueueSendMultiple (hQueue, msg_ptr, (UBaseType_t)msg_count, (TickType_t)timeout);
+
+    if (count == 0U) {
+      if (timeout != 0U) {
+        stat = osErrorTimeout;
+      } else {
+        stat = osErrorResource;
+      }
+    }
+  }
+
+  if (msg_put != NULL) {
+    *msg_put = (uint32_t)count;
+  }
+
+  return (stat);
+}
+
+osStatus_t osMessageQueueGetMultiple (osMessageQueueId_t mq_id, void *msg_ptr, uint32_t msg_count, uint32_t *msg_got, uint32_t timeout) {
+  QueueHandle_t hQueue = (QueueHandle_t)mq_id;
+  osStatus_t stat;
+  BaseType_t yield;
+  UBaseType_t count;
+
+  stat  = osOK;
+  count = 0U;
+
+  if ((hQueue == NULL) || (msg_ptr == NULL) || (msg_count == 0U)) {
+    stat = osErrorParameter;
+  }
+  else if (IS_IRQ()) {
+    if (timeout != 0U) {
+      stat = osErrorParameter;
+    }
+    else {
+      yield = pdFALSE;
+
+      count = xQueueReceiveMultipleFromISR (hQueue, msg_ptr, (UBaseType_t)msg_count, &yield);
+
+      if (count == 0U) {
+        stat = osErrorResource;
+      } else {
+        portYIELD_FROM_ISR (yield);
+      }
+    }
+  }
+  else {
+    count = xQueueReceiveMultiple (hQueue, msg_ptr, (UBaseType_t)msg_count, (TickType_t)timeout);
+
+    if (count == 0U) {
+      if (timeout != 0U) {
+        stat = osErrorTimeout;
+      } else {
+        stat = osErrorResource;
+      }
+    }
+  }
+
+  if (msg_got != NULL) {
+    *msg_got = (uint32_t)count;
+  }
+
+  return (stat);
+}
+
 uint32_t osMessageQueueGetCapacity (osMessageQueueId_t mq_id) {
   StaticQueue_t *mq = (StaticQueue_t *)mq_id;
   uint32_t capacity;
@@ -696,6 +696,24 @@ osStatus_t osMessageQueuePut (osMessageQueueId_t mq_id, const void *msg_ptr, uin
 /// \return status code that indicates the execution status of the function.
 osStatus_t osMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout);
 
+/// Put up to msg_count Messages into a Queue, waiting for at least one free slot or timeout if Queue is full.
+/// \param[in]     mq_id         message queue ID obtained by \ref osMessageQueueNew.
+/// \param[in]     msg_ptr       pointer to an array of msg_count messages to put into a queue.
+/// \param[in]     msg_count     number of messages in the array.
+/// \param[out]    msg_put       pointer to buffer for the number of messages put, from the start of the array, or NULL.
+/// \param[in]     timeout       \ref CMSIS_RTOS_TimeOutValue or 0 in case of no time-out.
+/// \return status code that indicates the execution status of the function.
+osStatus_t osMessageQueuePutMultiple (osMessageQueueId_t mq_id, const void *msg_ptr, uint32_t msg_count, uint32_t *msg_put, uint32_t timeout);
+
+/// Get up to msg_count Messages from a Queue, waiting for at least one message or timeout if Queue is empty.
+/// \param[in]     mq_id         message queue ID obtained by \ref osMessageQueueNew.
+/// \param[out]    msg_ptr       pointer to buffer for up to msg_count messages to get from a queue.
+/// \param[in]     msg_count     maximum number of messages to get.
+/// \param[out]    msg_got       pointer to buffer for the number of messages got, or NULL.
+/// \param[in]     timeout       \ref CMSIS_RTOS_TimeOutValue or 0 in case of no time-out.
+/// \return status code that indicates the execution status of the function.
+osStatus_t osMessageQueueGetMultiple (osMessageQueueId_t mq_id, void *msg_ptr, uint32_t msg_count, uint32_t *msg_got, uint32_t timeout);
+
 /// Get maximum number of messages in a Message Queue.
 /// \param[in]     mq_id         message queue ID obtained by \ref osMessageQueueNew.
 /// \return maximum number of messages.
@@ -0,0 +1,73 @@
+/* --------------------------------------------------------------------------
+ * Portions Copyright © 2017 STMicroelectronics International N.V. All rights reserved.
+ * Portions Copyright (c) 2013-2017 ARM Limited. All rights reserved.
+ * --------------------------------------------------------------------------
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *      Name:    freertos_mpool.h
+ *      Purpose: CMSIS RTOS2 wrapper for FreeRTOS, memory pool control block
+ *
+ *---------------------------------------------------------------------------*/
+
+#ifndef FREERTOS_MPOOL_H_
+#define FREERTOS_MPOOL_H_
+
+#include <stdint.h>
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Memory pool status flags (MemPool_t::status) */
+#define MPOOL_STATUS              0x5EED0000U   /* Valid control block marker */
+#define MPOOL_STATUS_ACTIVE       0x00000001U   /* Pool can be used */
+#define MPOOL_STATUS_DMEM_CB      0x00000002U   /* Control block allocated from the heap */
+#define MPOOL_STATUS_DMEM_MP      0x00000004U   /* Storage allocated from the heap */
+
+/* Task blocked in osMemoryPoolAlloc, linked from MemPool_t::wait_head */
+typedef struct MemPoolWaiter_s {
+  struct MemPoolWaiter_s *next;         /* Next waiting task (FIFO order) */
+  TaskHandle_t            task;         /* Waiting task */
+  void                   *block;        /* Block handed over by osMemoryPoolFree */
+  uint32_t                cancelled;    /* Pool deleted while waiting */
+} MemPoolWaiter_t;
+
+/* Key scrambling the link stored in a free block, see MemPool_IsFree */
+#define MPOOL_LINK_KEY            ((uintptr_t)0xA5C3E1F0U)
+
+/* Memory pool control block: a free block holds the address of the next
+   free block, so that allocation and release are constant time */
+typedef struct {
+  uint32_t                status;       /* Status flags */
+  const char             *name;         /* Pool name */
+  uint8_t                *mem_arr;      /* Block storage */
+  uint32_t                mem_sz;       /* Block storage size in bytes */
+  uint32_t                bl_sz;        /* Block size, rounded up to the word size */
+  uint32_t                bl_cnt;       /* Number of blocks */
+  uint32_t                n;            /* Number of allocated blocks */
+  uint32_t                max_n;        /* High-water mark of n */
+  void                   *free_head;    /* First free block */
+  MemPoolWaiter_t        *wait_head;    /* First task waiting for a block */
+  MemPoolWaiter_t        *wait_tail;    /* Last task waiting for a block */
+} MemPool_t;
+
+/* Block size actually used for a requested block size */
+#define MEMPOOL_BLOCK_SIZE(block_size) \
+  ((((block_size) + sizeof(void *) - 1U) / sizeof(void *)) * sizeof(void *))
+
+/* Storage size (osMemoryPoolAttr_t::mp_size) for block_count blocks */
+#define MEMPOOL_ARR_SIZE(block_count, block_size) \
+  ((block_count) * MEMPOOL_BLOCK_SIZE(block_size))
+
+#endif /* FREERTOS_MPOOL_H_ */
@@ -206,6 +206,10 @@ extern "C" {
 	#define configUSE_TIMERS 0
 #endif
 
+#ifndef configUSE_TIMER_WHEEL
+	#define configUSE_TIMER_WHEEL 0
+#endif
+
 #ifndef configUSE_COUNTING_SEMAPHORES
 	#define configUSE_COUNTING_SEMAPHORES 0
 #endif
@@ -738,6 +742,10 @@ extern "C" {
 	#define configUSE_TICKLESS_IDLE 0
 #endif
 
+#ifndef configTICKLESS_SLACK_TICKS
+	#define configTICKLESS_SLACK_TICKS 0
+#endif
+
 #ifndef configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING
 	#define configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING( x )
 #endif
@@ -772,6 +772,54 @@ BaseType_t xMessageBufferReceiveCompletedFromISR( MessageBufferHandle_t xStreamB
  */
 #define xMessageBufferReceiveCompletedFromISR( xMessageBuffer, pxHigherPriorityTaskWoken ) xStreamBufferReceiveCompletedFromISR( ( StreamBufferHandle_t ) xMessageBuffer, pxHigherPriorityTaskWoken )
 
+/**
+ * message_buffer.h
+ *
+<pre>
+size_t xMessageBufferReserve( MessageBufferHandle_t xMessageBuffer, size_t xDataLengthBytes, StreamBufferSpan_t * const pxSpan, TickType_t xTicksToWait );
+size_t xMessageBufferReserveFromISR( MessageBufferHandle_t xMessageBuffer, size_t xDataLengthBytes, StreamBufferSpan_t * const pxSpan );
+size_t xMessageBufferCommit( MessageBufferHandle_t xMessageBuffer, size_t xDataLengthBytes );
+size_t xMessageBufferCommitFromISR( MessageBufferHandle_t xMessageBuffer, size_t xDataLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * Zero copy alternative to xMessageBufferSend(): reserves space for a message
+ * of xDataLengthBytes bytes, which the writer fills in place before calling
+ * xMessageBufferCommit() with the actual message length (at most the length
+ * reserved).  See xStreamBufferReserve() and xStreamBufferCommit() in
+ * stream_buffer.h.
+ *
+ * \defgroup xMessageBufferReserve xMessageBufferReserve
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferReserve( xMessageBuffer, xDataLengthBytes, pxSpan, xTicksToWait ) xStreamBufferReserve( ( StreamBufferHandle_t ) xMessageBuffer, xDataLengthBytes, pxSpan, xTicksToWait )
+#define xMessageBufferReserveFromISR( xMessageBuffer, xDataLengthBytes, pxSpan ) xStreamBufferReserveFromISR( ( StreamBufferHandle_t ) xMessageBuffer, xDataLengthBytes, pxSpan )
+#define xMessageBufferCommit( xMessageBuffer, xDataLengthBytes ) xStreamBufferCommit( ( StreamBufferHandle_t ) xMessageBuffer, xDataLengthBytes )
+#define xMessageBufferCommitFromISR( xMessageBuffer, xDataLengthBytes, pxHigherPriorityTaskWoken ) xStreamBufferCommitFromISR( ( StreamBufferHandle_t ) xMessageBuffer, xDataLengthBytes, pxHigherPriorityTaskWoken )
+
+/**
+ * message_buffer.h
+ *
+<pre>
+size_t xMessageBufferPeek( MessageBufferHandle_t xMessageBuffer, StreamBufferSpan_t * const pxSpan, TickType_t xTicksToWait );
+size_t xMessageBufferPeekFromISR( MessageBufferHandle_t xMessageBuffer, StreamBufferSpan_t * const pxSpan );
+size_t xMessageBufferRelease( MessageBufferHandle_t xMessageBuffer, size_t xReleaseBytes );
+size_t xMessageBufferReleaseFromISR( MessageBufferHandle_t xMessageBuffer, size_t xReleaseBytes, BaseType_t * const pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * Zero copy alternative to xMessageBufferReceive(): gives access in place to
+ * the next message, which is removed by xMessageBufferRelease().  A message is
+ * always released as a whole, xReleaseBytes must be the length returned by
+ * xMessageBufferPeek().  See xStreamBufferPeek() and xStreamBufferRelease() in
+ * stream_buffer.h.
+ *
+ * \defgroup xMessageBufferPeek xMessageBufferPeek
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferPeek( xMessageBuffer, pxSpan, xTicksToWait ) xStreamBufferPeek( ( StreamBufferHandle_t ) xMessageBuffer, pxSpan, xTicksToWait )
+#define xMessageBufferPeekFromISR( xMessageBuffer, pxSpan ) xStreamBufferPeekFromISR( ( StreamBufferHandle_t ) xMessageBuffer, pxSpan )
+#define xMessageBufferRelease( xMessageBuffer, xReleaseBytes ) xStreamBufferRelease( ( StreamBufferHandle_t ) xMessageBuffer, xReleaseBytes )
+#define xMessageBufferReleaseFromISR( xMessageBuffer, xReleaseBytes, pxHigherPriorityTaskWoken ) xStreamBufferReleaseFromISR( ( StreamBufferHandle_t ) xMessageBuffer, xReleaseBytes, pxHigherPriorityTaskWoken )
+
 #if defined( __cplusplus )
 } /* extern "C" */
 #endif
@@ -132,6 +132,26 @@ void vPortInitialiseBlocks( void ) PRIVILEGED_FUNCTION;
 size_t xPortGetFreeHeapSize( void ) PRIVILEGED_FUNCTION;
 size_t xPortGetMinimumEverFreeHeapSize( void ) PRIVILEGED_FUNCTION;
 
+/* Used by heap_tlsf.c. */
+typedef struct xHeapStats
+{
+	size_t xAvailableHeapSpaceInBytes;		/* The total heap size currently available - this is the sum of all the free blocks, not the largest block that can be allocated. */
+	size_t xSizeOfLargestFreeBlockInBytes;	/* The maximum size, in bytes, of all the free blocks within the heap at the time vPortGetHeapStats() is called. */
+	size_t xSizeOfSmallestFreeBlockInBytes;	/* The minimum size, in bytes, of all the free blocks within the heap at the time vPortGetHeapStats() is called. */
+	size_t xNumberOfFreeBlocks;				/* The number of free memory blocks within the heap at the time vPortGetHeapStats() is called. */
+	size_t xMinimumEverFreeBytesRemaining;	/* The minimum amount of total free memory (sum of all free blocks) there has been in the heap since the system booted. */
+	size_t xNumberOfSuccessfulAllocations;	/* The number of calls to pvPortMalloc() that have returned a valid memory block. */
+	size_t xNumberOfSuccessfulFrees;		/* The number of calls to vPortFree() that has successfully freed a block of memory. */
+	uint32_t ulMaxMallocTime;				/* The longest execution time of pvPortMalloc(), in configTLSF_TIMESTAMP() units (0 if not defined). */
+	uint32_t ulMaxFreeTime;					/* The longest execution time of vPortFree(), in configTLSF_TIMESTAMP() units (0 if not defined). */
+} HeapStats_t;
+
+/*
+ * Returns the state of the heap.  The fragmentation can be estimated as
+ * 1 - ( xSizeOfLargestFreeBlockInBytes / xAvailableHeapSpaceInBytes ).
+ */
+void vPortGetHeapStats( HeapStats_t *pxHeapStats ) PRIVILEGED_FUNCTION;
+
 /*
  * Setup the hardware ready for the scheduler to take control.  This generally
  * sets up a tick interrupt and sets timers for the correct tick frequency.
@@ -1382,6 +1382,197 @@ BaseType_t xQueueGiveFromISR( QueueHandle_t xQueue, BaseType_t * const pxHigherP
  */
 BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue, void * const pvBuffer, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+/**
+ * queue. h
+ * <pre>
+ UBaseType_t xQueueSendMultiple(
+								   QueueHandle_t xQueue,
+								   const void *pvItems,
+								   UBaseType_t uxCount,
+								   TickType_t xTicksToWait
+							   );
+ * </pre>
+ *
+ * Post up to uxCount items to the back of a queue.  The items are copied in
+ * a single critical section, and the tasks waiting to receive from the queue
+ * are unblocked once for the whole batch, which is significantly cheaper
+ * than calling xQueueSend() once per item.
+ *
+ * If the queue has room for fewer than uxCount items only the items that
+ * fit are posted.  The calling task only blocks if the queue is full, until
+ * room for at least one item becomes available.
+ *
+ * This function must not be used on a semaphore or a mutex, or from an
+ * interrupt service routine.  See xQueueSendMultipleFromISR() for an
+ * alternative which may be used in an ISR.
+ *
+ * @param xQueue The handle to the queue on which the items are to be posted.
+ *
+ * @param pvItems A pointer to an array of uxCount items, stored one after
+ * the other.  The size of each item was defined when the queue was created.
+ *
+ * @param uxCount The number of items in the pvItems array.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for space to become available on the queue, should it already
+ * be full.  The call will return immediately if this is set to 0.
+ *
+ * @return The number of items posted, from the start of the pvItems array.
+ * 0 if the queue remained full for the whole block time.
+ *
+ * Example usage:
+   <pre>
+ void vFlushSamples( QueueHandle_t xQueue, uint16_t *pusSamples, UBaseType_t uxCount )
+ {
+ UBaseType_t uxSent;
+
+	while( uxCount > 0 )
+	{
+		// Post as many samples as possible, waiting up to 10 ticks for
+		// room if the queue is full.
+		uxSent = xQueueSendMultiple( xQueue, pusSamples, uxCount, ( TickType_t ) 10 );
+		if( uxSent == 0 )
+		{
+			// The queue stayed full.
+			break;
+		}
+
+		pusSamples += uxSent;
+		uxCount -= uxSent;
+	}
+ }
+ </pre>
+ * \defgroup xQueueSendMultiple xQueueSendMultiple
+ * \ingroup QueueManagement
+ */
+UBaseType_t xQueueSendMultiple( QueueHandle_t xQueue, const void * const pvItems, const UBaseType_t uxCount, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ UBaseType_t xQueueSendMultipleFromISR(
+										  QueueHandle_t xQueue,
+										  const void *pvItems,
+										  UBaseType_t uxCount,
+										  BaseType_t *pxHigherPriorityTaskWoken
+									  );
+ * </pre>
+ *
+ * Version of xQueueSendMultiple() that can be used from an interrupt service
+ * routine.  The items that do not fit in the queue are not posted.
+ *
+ * @param xQueue The handle to the queue on which the items are to be posted.
+ *
+ * @param pvItems A pointer to an array of uxCount items.
+ *
+ * @param uxCount The number of items in the pvItems array.
+ *
+ * @param pxHigherPriorityTaskWoken xQueueSendMultipleFromISR() will set
+ * *pxHigherPriorityTaskWoken to pdTRUE if posting the items caused a task
+ * with a priority higher than the currently running task to unblock.  In
+ * that case a context switch should be requested before the interrupt is
+ * exited.
+ *
+ * @return The number of items posted, from the start of the pvItems array.
+ *
+ * \defgroup xQueueSendMultipleFromISR xQueueSendMultipleFromISR
+ * \ingroup QueueManagement
+ */
+UBaseType_t xQueueSendMultipleFromISR( QueueHandle_t xQueue, const void * const pvItems, const UBaseType_t uxCount, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ UBaseType_t xQueueReceiveMultiple(
+									  QueueHandle_t xQueue,
+									  void *pvBuffer,
+									  UBaseType_t uxCount,
+									  TickType_t xTicksToWait
+								  );
+ * </pre>
+ *
+ * Receive up to uxCount items from a queue.  The items are copied in a single
+ * critical section, and the tasks waiting to post to the queue are unblocked
+ * once for the whole batch.
+ *
+ * If the queue holds fewer than uxCount items all the items are received.
+ * The calling task only blocks if the queue is empty, until at least one
+ * item becomes available.
+ *
+ * This function must not be used on a semaphore or a mutex, or from an
+ * interrupt service routine.  See xQueueReceiveMultipleFromISR() for an
+ * alternative which may be used in an ISR.
+ *
+ * @param xQueue The handle to the queue from which the items are to be
+ * received.
+ *
+ * @param pvBuffer Pointer to the buffer into which the received items will
+ * be copied.  It must be large enough to hold uxCount items.
+ *
+ * @param uxCount The maximum number of items to receive.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for an item to receive should the queue be empty at the time
+ * of the call.  The call will return immediately if this is set to 0.
+ *
+ * @return The number of items received.  0 if the queue remained empty for
+ * the whole block time.
+ *
+ * Example usage:
+   <pre>
+ void vConsumerTask( void *pvParameters )
+ {
+ uint16_t usSamples[ 16 ];
+ UBaseType_t uxReceived;
+
+	for( ;; )
+	{
+		// Wait for at least one sample, then take all the samples queued
+		// so far, up to 16.
+		uxReceived = xQueueReceiveMultiple( xQueue, usSamples, 16, portMAX_DELAY );
+
+		vProcessSamples( usSamples, uxReceived );
+	}
+ }
+ </pre>
+ * \defgroup xQueueReceiveMultiple xQueueReceiveMultiple
+ * \ingroup QueueManagement
+ */
+UBaseType_t xQueueReceiveMultiple( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxCount, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ UBaseType_t xQueueReceiveMultipleFromISR(
+											 QueueHandle_t xQueue,
+											 void *pvBuffer,
+											 UBaseType_t uxCount,
+											 BaseType_t *pxHigherPriorityTaskWoken
+										 );
+ * </pre>
+ *
+ * Version of xQueueReceiveMultiple() that can be used from an interrupt
+ * service routine.
+ *
+ * @param xQueue The handle to the queue from which the items are to be
+ * received.
+ *
+ * @param pvBuffer Pointer to the buffer into which the received items will
+ * be copied.  It must be large enough to hold uxCount items.
+ *
+ * @param uxCount The maximum number of items to receive.
+ *
+ * @param pxHigherPriorityTaskWoken xQueueReceiveMultipleFromISR() will set
+ * *pxHigherPriorityTaskWoken to pdTRUE if removing the items caused a task
+ * with a priority higher than the currently running task to unblock.
+ *
+ * @return The number of items received.
+ *
+ * \defgroup xQueueReceiveMultipleFromISR xQueueReceiveMultipleFromISR
+ * \ingroup QueueManagement
+ */
+UBaseType_t xQueueReceiveMultipleFromISR( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxCount, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
 /*
  * Utilities to query queues that are safe to use from an ISR.  These utilities
  * should be used only from witin an ISR, or within a critical section.
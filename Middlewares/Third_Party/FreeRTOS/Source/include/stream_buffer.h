@@ -63,6 +63,19 @@ extern "C" {
  */
 typedef void * StreamBufferHandle_t;
 
+/**
+ * Location of a region of the storage area of a stream buffer, as returned by
+ * the zero copy functions xStreamBufferReserve() and xStreamBufferPeek().  A
+ * region that wraps around the end of the storage area is split in two parts.
+ */
+typedef struct xSTREAM_BUFFER_SPAN
+{
+	uint8_t *pucFirst;		/* Start of the region. */
+	size_t xFirstLength;	/* Number of bytes at pucFirst. */
+	uint8_t *pucSecond;		/* Start of the storage area if the region wraps around, otherwise NULL. */
+	size_t xSecondLength;	/* Number of bytes at pucSecond, 0 if the region does not wrap around. */
+} StreamBufferSpan_t;
+
 
 /**
  * message_buffer.h
@@ -828,6 +841,252 @@ BaseType_t xStreamBufferReceiveCompletedFromISR( StreamBufferHandle_t xStreamBuf
  */
 BaseType_t xStreamBufferReceiveCompletedFromISR( StreamBufferHandle_t xStreamBuffer, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferReserve( StreamBufferHandle_t xStreamBuffer,
+                             size_t xDataLengthBytes,
+                             StreamBufferSpan_t * const pxSpan,
+                             TickType_t xTicksToWait );
+</pre>
+ *
+ * Zero copy alternative to xStreamBufferSend().  Reserves space in the stream
+ * buffer so the writer can produce its data directly in the storage area, for
+ * example as the destination of a DMA transfer, then makes the data visible to
+ * the reader with xStreamBufferCommit().  Nothing is copied.
+ *
+ * The reserved space is described by *pxSpan.  When it wraps around the end of
+ * the storage area it is split in two parts: pucFirst/xFirstLength up to the
+ * end of the storage area, then pucSecond/xSecondLength from its start.
+ * pucSecond is NULL and xSecondLength is 0 when the space is contiguous.
+ *
+ * The same single writer rule as for xStreamBufferSend() applies: the writer
+ * must not send or reserve again before it has called xStreamBufferCommit().
+ * Use xStreamBufferReserveFromISR() from an interrupt service routine.
+ *
+ * @param xStreamBuffer The handle of the stream buffer.
+ *
+ * @param xDataLengthBytes The number of bytes wanted.  For a message buffer,
+ * the length of the message to write.
+ *
+ * @param pxSpan Set to the location of the reserved space.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for xDataLengthBytes bytes to become free, as for
+ * xStreamBufferSend().  On time out as many bytes as possible are reserved in
+ * a stream buffer, none in a message buffer.
+ *
+ * @return The number of bytes reserved.  For a stream buffer this can be less
+ * than xDataLengthBytes.  For a message buffer this is either xDataLengthBytes
+ * or 0.
+ *
+ * Example use:
+<pre>
+void vADCHalfTransferComplete( StreamBufferHandle_t xStreamBuffer )
+{
+StreamBufferSpan_t xSpan;
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    // Publish the samples written by the DMA, then hand the next free part
+    // of the buffer to the DMA.
+    xStreamBufferCommitFromISR( xStreamBuffer, HALF_BUFFER_BYTES, &xHigherPriorityTaskWoken );
+
+    if( xStreamBufferReserveFromISR( xStreamBuffer, HALF_BUFFER_BYTES, &xSpan ) == HALF_BUFFER_BYTES )
+    {
+        vStartDMA( xSpan.pucFirst, xSpan.xFirstLength, xSpan.pucSecond, xSpan.xSecondLength );
+    }
+
+    portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+}
+</pre>
+ * \defgroup xStreamBufferReserve xStreamBufferReserve
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReserve( StreamBufferHandle_t xStreamBuffer,
+							 size_t xDataLengthBytes,
+							 StreamBufferSpan_t * const pxSpan,
+							 TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferReserveFromISR( StreamBufferHandle_t xStreamBuffer,
+                                    size_t xDataLengthBytes,
+                                    StreamBufferSpan_t * const pxSpan );
+</pre>
+ *
+ * A version of xStreamBufferReserve() that can be called from an interrupt
+ * service routine.  It never blocks.
+ *
+ * \defgroup xStreamBufferReserveFromISR xStreamBufferReserveFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReserveFromISR( StreamBufferHandle_t xStreamBuffer,
+									size_t xDataLengthBytes,
+									StreamBufferSpan_t * const pxSpan ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferCommit( StreamBufferHandle_t xStreamBuffer, size_t xDataLengthBytes );
+</pre>
+ *
+ * Makes the first xDataLengthBytes bytes of the space obtained from
+ * xStreamBufferReserve() available to the reader.  The task waiting to
+ * receive, if any, is unblocked when the trigger level is reached, exactly as
+ * by xStreamBufferSend().  Committing 0 bytes abandons the reservation.  Use
+ * xStreamBufferCommitFromISR() from an interrupt service routine.
+ *
+ * @param xStreamBuffer The handle of the stream buffer.
+ *
+ * @param xDataLengthBytes The number of bytes written, which must not be more
+ * than the number of bytes reserved.  For a message buffer, the length of the
+ * message, which can be shorter than the length reserved.
+ *
+ * @return The number of bytes made available to the reader.
+ *
+ * \defgroup xStreamBufferCommit xStreamBufferCommit
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferCommit( StreamBufferHandle_t xStreamBuffer, size_t xDataLengthBytes ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+                                   size_t xDataLengthBytes,
+                                   BaseType_t * const pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * A version of xStreamBufferCommit() that can be called from an interrupt
+ * service routine.  pxHigherPriorityTaskWoken is used as by
+ * xStreamBufferSendFromISR().
+ *
+ * \defgroup xStreamBufferCommitFromISR xStreamBufferCommitFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+								   size_t xDataLengthBytes,
+								   BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferPeek( StreamBufferHandle_t xStreamBuffer,
+                          StreamBufferSpan_t * const pxSpan,
+                          TickType_t xTicksToWait );
+</pre>
+ *
+ * Zero copy alternative to xStreamBufferReceive().  Gives the reader access to
+ * the data in the storage area, in one or two parts as described for
+ * xStreamBufferReserve(), without removing it.  The data stays in the buffer,
+ * and keeps occupying its space, until xStreamBufferRelease() is called.
+ *
+ * The same single reader rule as for xStreamBufferReceive() applies.  Use
+ * xStreamBufferPeekFromISR() from an interrupt service routine.
+ *
+ * @param xStreamBuffer The handle of the stream buffer.
+ *
+ * @param pxSpan Set to the location of the data.  For a stream buffer all the
+ * bytes available are described, for a message buffer the next message.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for data, as for xStreamBufferReceive().
+ *
+ * @return The number of bytes described by *pxSpan, 0 if the buffer is empty.
+ *
+ * Example use:
+<pre>
+void vWriterTask( void *pvParameters )
+{
+StreamBufferSpan_t xSpan;
+size_t xLength;
+
+    for( ;; )
+    {
+        xLength = xStreamBufferPeek( xStreamBuffer, &xSpan, portMAX_DELAY );
+
+        // Write the samples to the card straight from the stream buffer.
+        f_write( &xFile, xSpan.pucFirst, xSpan.xFirstLength, &uxWritten );
+        f_write( &xFile, xSpan.pucSecond, xSpan.xSecondLength, &uxWritten );
+
+        xStreamBufferRelease( xStreamBuffer, xLength );
+    }
+}
+</pre>
+ * \defgroup xStreamBufferPeek xStreamBufferPeek
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferPeek( StreamBufferHandle_t xStreamBuffer,
+						  StreamBufferSpan_t * const pxSpan,
+						  TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferPeekFromISR( StreamBufferHandle_t xStreamBuffer,
+                                 StreamBufferSpan_t * const pxSpan );
+</pre>
+ *
+ * A version of xStreamBufferPeek() that can be called from an interrupt
+ * service routine.  It never blocks.
+ *
+ * \defgroup xStreamBufferPeekFromISR xStreamBufferPeekFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferPeekFromISR( StreamBufferHandle_t xStreamBuffer,
+								 StreamBufferSpan_t * const pxSpan ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferRelease( StreamBufferHandle_t xStreamBuffer, size_t xReleaseBytes );
+</pre>
+ *
+ * Removes data obtained with xStreamBufferPeek() from the buffer.  The task
+ * waiting for space, if any, is unblocked as by xStreamBufferReceive().  Use
+ * xStreamBufferReleaseFromISR() from an interrupt service routine.
+ *
+ * @param xStreamBuffer The handle of the stream buffer.
+ *
+ * @param xReleaseBytes The number of bytes consumed from the start of the data.
+ * A message buffer always releases the whole message: xReleaseBytes must be
+ * the length returned by xStreamBufferPeek().
+ *
+ * @return The number of bytes removed from the buffer.
+ *
+ * \defgroup xStreamBufferRelease xStreamBufferRelease
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferRelease( StreamBufferHandle_t xStreamBuffer, size_t xReleaseBytes ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferReleaseFromISR( StreamBufferHandle_t xStreamBuffer,
+                                    size_t xReleaseBytes,
+                                    BaseType_t * const pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * A version of xStreamBufferRelease() that can be called from an interrupt
+ * service routine.  pxHigherPriorityTaskWoken is used as by
+ * xStreamBufferReceiveFromISR().
+ *
+ * \defgroup xStreamBufferReleaseFromISR xStreamBufferReleaseFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReleaseFromISR( StreamBufferHandle_t xStreamBuffer,
+									size_t xReleaseBytes,
+									BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
 /* Functions below here are not part of the public API. */
 StreamBufferHandle_t xStreamBufferGenericCreate( size_t xBufferSizeBytes,
 												 size_t xTriggerLevelBytes,
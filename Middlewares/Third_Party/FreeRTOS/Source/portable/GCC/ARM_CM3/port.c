@@ -50,6 +50,43 @@ FreeRTOS.org versions prior to V4.4.0 did not include this definition. */
 	#define portNVIC_SYSTICK_CLK_BIT	( 0 )
 #endif
 
+/* Set configUSE_TICKLESS_LP_TIMEBASE to 1 to have the tickless idle mode timed
+by a free running low power counter (LPTIM, RTC sub-seconds...) that keeps
+counting in the deep sleep modes where the SysTick is stopped, instead of by
+the SysTick.  The application then provides the functions declared below, and
+defines configLP_TIMEBASE_CLOCK_HZ, the counting frequency, and
+configLP_TIMEBASE_COUNTER_MASK, the counter range minus one (0xffff for a 16
+bit counter). */
+#ifndef configUSE_TICKLESS_LP_TIMEBASE
+	#define configUSE_TICKLESS_LP_TIMEBASE 0
+#endif
+
+#if( ( configUSE_TICKLESS_IDLE == 1 ) && ( configUSE_TICKLESS_LP_TIMEBASE == 1 ) )
+	#ifndef configLP_TIMEBASE_CLOCK_HZ
+		#error configLP_TIMEBASE_CLOCK_HZ must be defined to the low power counter frequency when configUSE_TICKLESS_LP_TIMEBASE is 1
+	#endif
+	#ifndef configLP_TIMEBASE_COUNTER_MASK
+		#error configLP_TIMEBASE_COUNTER_MASK must be defined to the low power counter range minus one when configUSE_TICKLESS_LP_TIMEBASE is 1
+	#endif
+
+	/* SysTick counts that elapse from the low power counter wake up to the
+	counter being read back (wake up from the low power mode, clock restart in
+	the post sleep processing...), too short to be seen on the counter itself
+	but that would otherwise make the time maintained by the kernel lag. */
+	#ifndef configLP_TIMEBASE_WAKEUP_LATENCY
+		#define configLP_TIMEBASE_WAKEUP_LATENCY 0
+	#endif
+
+	/* The wake up is never programmed further than half the counter range
+	ahead, the other half leaving room for the wake up latency and the post
+	sleep processing before the counter is read back. */
+	#define portLP_TIMEBASE_MAX_COUNTS		( ( ( uint32_t ) configLP_TIMEBASE_COUNTER_MASK ) >> 1UL )
+
+	/* The wake up is programmed at least that many counts ahead, so that it
+	cannot be missed when the counter moves on while it is programmed. */
+	#define portLP_TIMEBASE_MIN_COUNTS		( 2UL )
+#endif
+
 /* Constants required to manipulate the core.  Registers first... */
 #define portNVIC_SYSTICK_CTRL_REG			( * ( ( volatile uint32_t * ) 0xe000e010 ) )
 #define portNVIC_SYSTICK_LOAD_REG			( * ( ( volatile uint32_t * ) 0xe000e014 ) )
@@ -109,6 +146,23 @@ debugger. */
  */
 void vPortSetupTimerInterrupt( void );
 
+/*
+ * Low power timebase used by the tickless idle mode when
+ * configUSE_TICKLESS_LP_TIMEBASE is 1, implemented by the application.
+ * ulPortLPTimebaseGetCount() returns the value of the free running counter.
+ * vPortLPTimebaseSetWakeup() arms an interrupt, able to wake the MCU up from
+ * the low power mode in use, for when the counter reaches ulCount (already
+ * masked with configLP_TIMEBASE_COUNTER_MASK).  vPortLPTimebaseClearWakeup()
+ * disarms it and clears it if it is pending.  They are called with interrupts
+ * disabled, except ulPortLPTimebaseGetCount() which is also called with
+ * interrupts enabled.
+ */
+#if( ( configUSE_TICKLESS_IDLE == 1 ) && ( configUSE_TICKLESS_LP_TIMEBASE == 1 ) )
+	extern uint32_t ulPortLPTimebaseGetCount( void );
+	extern void vPortLPTimebaseSetWakeup( uint32_t ulCount );
+	extern void vPortLPTimebaseClearWakeup( void );
+#endif
+
 /*
  * Exception handlers.
  */
@@ -141,7 +195,8 @@ static UBaseType_t uxCriticalNesting = 0xaaaaaaaa;
 
 /*
  * The maximum number of tick periods that can be suppressed is limited by the
- * 24 bit resolution of the SysTick timer.
+ * 24 bit resolution of the SysTick timer, or by the range of the low power
+ * counter when it is used.
  */
 #if( configUSE_TICKLESS_IDLE == 1 )
 	static uint32_t xMaximumPossibleSuppressedTicks = 0;
@@ -443,7 +498,7 @@ void xPortSysTickHandler( void )
 }
 /*-----------------------------------------------------------*/
 
-#if( configUSE_TICKLESS_IDLE == 1 )
+#if( ( configUSE_TICKLESS_IDLE == 1 ) && ( configUSE_TICKLESS_LP_TIMEBASE == 0 ) )
 
 	__attribute__((weak)) void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
 	{
@@ -607,7 +662,174 @@ void xPortSysTickHandler( void )
 		}
 	}
 
-#endif /* configUSE_TICKLESS_IDLE */
+#endif /* configUSE_TICKLESS_IDLE && !configUSE_TICKLESS_LP_TIMEBASE */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_TICKLESS_IDLE == 1 ) && ( configUSE_TICKLESS_LP_TIMEBASE == 1 ) )
+
+	__attribute__((weak)) void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
+	{
+	uint32_t ulSysTickRemaining, ulStartCount, ulWakeupCounts, ulLowPowerCounts, ulReloadValue, ulCompleteTickPeriods;
+	uint64_t ullSysTickCounts;
+	TickType_t xModifiableIdleTime;
+
+		/* Make sure the wake up can be programmed on the low power counter. */
+		if( xExpectedIdleTime > xMaximumPossibleSuppressedTicks )
+		{
+			xExpectedIdleTime = xMaximumPossibleSuppressedTicks;
+		}
+
+		/* Wait for the low power counter to count, so that the time spent
+		asleep, which is measured on that counter, is measured from a known
+		point within a count: the error made on each sleep then does not
+		depend on where the previous sleep ended.  Interrupts stay enabled
+		during the wait, which lasts at most one count. */
+		ulStartCount = ulPortLPTimebaseGetCount();
+		while( ulPortLPTimebaseGetCount() == ulStartCount )
+		{
+		}
+		ulStartCount = ( ulStartCount + 1UL ) & ( uint32_t ) configLP_TIMEBASE_COUNTER_MASK;
+
+		/* Enter a critical section but don't use the taskENTER_CRITICAL()
+		method as that will mask interrupts that should exit sleep mode. */
+		__asm volatile( "cpsid i" ::: "memory" );
+		__asm volatile( "dsb" );
+		__asm volatile( "isb" );
+
+		/* If an interrupt delayed the critical section past the next count the
+		start of the sleep is no longer known within a count: give up, the idle
+		task tries again on its next iteration. */
+		if( ulPortLPTimebaseGetCount() != ulStartCount )
+		{
+			__asm volatile( "cpsie i" ::: "memory" );
+			return;
+		}
+
+		/* Stop the SysTick, which would otherwise wake the MCU up on every
+		tick in sleep mode, and does not count in stop mode anyway. */
+		portNVIC_SYSTICK_CTRL_REG &= ~portNVIC_SYSTICK_ENABLE_BIT;
+
+		/* SysTick counts left to complete the current tick period.  If the
+		SysTick reached zero before it was stopped the tick interrupt is
+		pending and the count was reloaded, so the sleep ends as soon as it
+		starts and that tick is processed as usual. */
+		ulSysTickRemaining = portNVIC_SYSTICK_CURRENT_VALUE_REG;
+
+		/* Low power counts to the end of tick period xExpectedIdleTime,
+		rounded down so that the wake up is never late. */
+		ullSysTickCounts = ( uint64_t ) ulSysTickRemaining + ( ( uint64_t ) ulTimerCountsForOneTick * ( uint64_t ) ( xExpectedIdleTime - 1UL ) );
+		ulWakeupCounts = ( uint32_t ) ( ( ullSysTickCounts * ( uint64_t ) configLP_TIMEBASE_CLOCK_HZ ) / ( uint64_t ) configSYSTICK_CLOCK_HZ );
+
+		/* If a context switch is pending or a task is waiting for the scheduler
+		to be unsuspended then abandon the low power entry, as well as when the
+		low power counter is too coarse to time the sleep. */
+		if( ( ulWakeupCounts < portLP_TIMEBASE_MIN_COUNTS ) || ( eTaskConfirmSleepModeStatus() == eAbortSleep ) )
+		{
+			/* Restart from whatever is left in the count register to complete
+			this tick period. */
+			portNVIC_SYSTICK_LOAD_REG = portNVIC_SYSTICK_CURRENT_VALUE_REG;
+
+			/* Restart SysTick. */
+			portNVIC_SYSTICK_CTRL_REG |= portNVIC_SYSTICK_ENABLE_BIT;
+
+			/* Reset the reload register to the value required for normal tick
+			periods. */
+			portNVIC_SYSTICK_LOAD_REG = ulTimerCountsForOneTick - 1UL;
+
+			/* Re-enable interrupts - see comments above the cpsid instruction()
+			above. */
+			__asm volatile( "cpsie i" ::: "memory" );
+		}
+		else
+		{
+			vPortLPTimebaseSetWakeup( ( ulStartCount + ulWakeupCounts ) & ( uint32_t ) configLP_TIMEBASE_COUNTER_MASK );
+
+			/* Sleep until something happens.  configPRE_SLEEP_PROCESSING() can
+			set its parameter to 0 to indicate that its implementation contains
+			its own wait for interrupt or wait for event instruction, and so wfi
+			should not be executed again.  However, the original expected idle
+			time variable must remain unmodified, so a copy is taken.  The
+			post sleep processing must restore the clock the SysTick counts
+			at if the low power mode changed it. */
+			xModifiableIdleTime = xExpectedIdleTime;
+			configPRE_SLEEP_PROCESSING( &xModifiableIdleTime );
+			if( xModifiableIdleTime > 0 )
+			{
+				__asm volatile( "dsb" ::: "memory" );
+				__asm volatile( "wfi" );
+				__asm volatile( "isb" );
+			}
+			configPOST_SLEEP_PROCESSING( &xExpectedIdleTime );
+
+			/* Re-enable interrupts to allow the interrupt that brought the MCU
+			out of sleep mode to execute immediately, then disable them again
+			while the time maintained by the kernel is corrected. */
+			__asm volatile( "cpsie i" ::: "memory" );
+			__asm volatile( "dsb" );
+			__asm volatile( "isb" );
+			__asm volatile( "cpsid i" ::: "memory" );
+			__asm volatile( "dsb" );
+			__asm volatile( "isb" );
+
+			/* How long was the MCU asleep, in SysTick counts?  The sleep
+			started right after a count of the low power counter.  The low
+			power counter wake up happens right after a count too, and is only
+			followed by the wake up latency, while another interrupt ends the
+			sleep anywhere within a count: half a count is then added.  Errors
+			in the same direction on each sleep would otherwise accumulate in
+			the time maintained by the kernel. */
+			vPortLPTimebaseClearWakeup();
+			ulLowPowerCounts = ( ulPortLPTimebaseGetCount() - ulStartCount ) & ( uint32_t ) configLP_TIMEBASE_COUNTER_MASK;
+
+			if( ulLowPowerCounts >= ulWakeupCounts )
+			{
+				ullSysTickCounts = ( ( uint64_t ) ulLowPowerCounts * ( uint64_t ) configSYSTICK_CLOCK_HZ ) / ( uint64_t ) configLP_TIMEBASE_CLOCK_HZ;
+				ullSysTickCounts += ( uint64_t ) configLP_TIMEBASE_WAKEUP_LATENCY;
+			}
+			else
+			{
+				ullSysTickCounts = ( ( ( ( uint64_t ) ulLowPowerCounts * 2ULL ) + 1ULL ) * ( uint64_t ) configSYSTICK_CLOCK_HZ ) / ( 2ULL * ( uint64_t ) configLP_TIMEBASE_CLOCK_HZ );
+			}
+
+			if( ullSysTickCounts < ( uint64_t ) ulSysTickRemaining )
+			{
+				/* Woken up before the end of the tick period the sleep started
+				in. */
+				ulCompleteTickPeriods = 0UL;
+				ulReloadValue = ulSysTickRemaining - ( uint32_t ) ullSysTickCounts;
+			}
+			else
+			{
+				ullSysTickCounts -= ( uint64_t ) ulSysTickRemaining;
+				ulCompleteTickPeriods = 1UL + ( uint32_t ) ( ullSysTickCounts / ulTimerCountsForOneTick );
+				ulReloadValue = ulTimerCountsForOneTick - ( uint32_t ) ( ullSysTickCounts % ulTimerCountsForOneTick );
+			}
+
+			/* Don't restart the SysTick for a tiny fraction of a tick period,
+			account for the end of that tick period now instead. */
+			if( ulReloadValue < ( ulStoppedTimerCompensation + 2UL ) )
+			{
+				ulCompleteTickPeriods++;
+				ulReloadValue += ulTimerCountsForOneTick;
+			}
+
+			/* Restart SysTick so it runs from portNVIC_SYSTICK_LOAD_REG
+			again, then set portNVIC_SYSTICK_LOAD_REG back to its standard
+			value.  vTaskStepTick() pends the ticks that reach or pass the next
+			unblock time, for them to be processed when the scheduler is
+			resumed. */
+			portNVIC_SYSTICK_LOAD_REG = ulReloadValue - 1UL;
+			portNVIC_SYSTICK_CURRENT_VALUE_REG = 0UL;
+			portNVIC_SYSTICK_CTRL_REG |= portNVIC_SYSTICK_ENABLE_BIT;
+			vTaskStepTick( ( TickType_t ) ulCompleteTickPeriods );
+			portNVIC_SYSTICK_LOAD_REG = ulTimerCountsForOneTick - 1UL;
+
+			/* Exit with interrupts enabled. */
+			__asm volatile( "cpsie i" ::: "memory" );
+		}
+	}
+
+#endif /* configUSE_TICKLESS_IDLE && configUSE_TICKLESS_LP_TIMEBASE */
 /*-----------------------------------------------------------*/
 
 /*
@@ -620,7 +842,15 @@ __attribute__(( weak )) void vPortSetupTimerInterrupt( void )
 	#if( configUSE_TICKLESS_IDLE == 1 )
 	{
 		ulTimerCountsForOneTick = ( configSYSTICK_CLOCK_HZ / configTICK_RATE_HZ );
-		xMaximumPossibleSuppressedTicks = portMAX_24_BIT_NUMBER / ulTimerCountsForOneTick;
+		#if( configUSE_TICKLESS_LP_TIMEBASE == 1 )
+		{
+			xMaximumPossibleSuppressedTicks = ( uint32_t ) ( ( ( uint64_t ) portLP_TIMEBASE_MAX_COUNTS * ( uint64_t ) configTICK_RATE_HZ ) / ( uint64_t ) configLP_TIMEBASE_CLOCK_HZ );
+		}
+		#else
+		{
+			xMaximumPossibleSuppressedTicks = portMAX_24_BIT_NUMBER / ulTimerCountsForOneTick;
+		}
+		#endif /* configUSE_TICKLESS_LP_TIMEBASE */
 		ulStoppedTimerCompensation = portMISSED_COUNTS_FACTOR / ( configCPU_CLOCK_HZ / configSYSTICK_CLOCK_HZ );
 	}
 	#endif /* configUSE_TICKLESS_IDLE */
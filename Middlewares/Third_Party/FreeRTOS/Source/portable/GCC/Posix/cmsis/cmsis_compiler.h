@@ -0,0 +1,12 @@
+/*
+ * FreeRTOS Kernel V10.0.1 - POSIX simulator port
+ *
+ * Host replacement of the CMSIS generic compiler header, see cmsis_gcc.h.
+ */
+
+#ifndef __CMSIS_COMPILER_H
+#define __CMSIS_COMPILER_H
+
+#include "cmsis_gcc.h"
+
+#endif /* __CMSIS_COMPILER_H */
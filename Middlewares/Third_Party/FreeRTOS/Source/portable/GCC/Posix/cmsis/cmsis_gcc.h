@@ -0,0 +1,64 @@
+/*
+ * FreeRTOS Kernel V10.0.1 - POSIX simulator port
+ *
+ * Host replacement of the CMSIS core compiler header, so that the
+ * CMSIS-RTOS v1 (cmsis_os.c) and v2 (cmsis_os2.c) wrappers build unchanged
+ * against the POSIX port.  Add this directory to the include path of host
+ * builds only, ahead of Drivers/CMSIS/Include.
+ *
+ * The core registers used by the wrappers to detect interrupt context are
+ * mapped onto the port: IPSR is non zero inside the simulated tick
+ * interrupt, PRIMASK and BASEPRI always read as zero.
+ */
+
+#ifndef __CMSIS_GCC_H
+#define __CMSIS_GCC_H
+
+#include <stdint.h>
+
+#ifndef   __ASM
+  #define __ASM                                  __asm
+#endif
+#ifndef   __INLINE
+  #define __INLINE                               inline
+#endif
+#ifndef   __STATIC_INLINE
+  #define __STATIC_INLINE                        static inline
+#endif
+#ifndef   __STATIC_FORCEINLINE
+  #define __STATIC_FORCEINLINE                   __attribute__((always_inline)) static inline
+#endif
+#ifndef   __NO_RETURN
+  #define __NO_RETURN                            __attribute__((__noreturn__))
+#endif
+#ifndef   __USED
+  #define __USED                                 __attribute__((used))
+#endif
+#ifndef   __WEAK
+  #define __WEAK                                 __attribute__((weak))
+#endif
+#ifndef   __PACKED
+  #define __PACKED                               __attribute__((packed, aligned(1)))
+#endif
+#ifndef   __ALIGNED
+  #define __ALIGNED(x)                           __attribute__((aligned(x)))
+#endif
+
+extern long xPortIsInsideInterrupt( void );
+
+__STATIC_FORCEINLINE uint32_t __get_IPSR(void)
+{
+  return (xPortIsInsideInterrupt() != 0L) ? 15U : 0U;  /* SysTick exception number */
+}
+
+__STATIC_FORCEINLINE uint32_t __get_PRIMASK(void)
+{
+  return 0U;
+}
+
+__STATIC_FORCEINLINE uint32_t __get_BASEPRI(void)
+{
+  return 0U;
+}
+
+#endif /* __CMSIS_GCC_H */
@@ -0,0 +1,526 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+
+/*-----------------------------------------------------------
+ * Implementation of functions defined in portable.h for the POSIX (Linux)
+ * simulator port.
+ *
+ * Each task runs in its own pthread, but only one of them is ever allowed to
+ * run: every other task thread waits on its own event until the scheduler
+ * selects it.  A context switch signals the event of the thread to resume and
+ * then waits on the event of the thread being suspended.
+ *
+ * The tick interrupt is simulated with SIGALRM from an interval timer.
+ * Masking "interrupts" blocks that signal in the calling thread.  Only the
+ * running task thread has it unblocked (outside critical sections), so the
+ * tick handler always executes in the context of the running task and can
+ * switch away from it as a real interrupt would.
+ *----------------------------------------------------------*/
+
+/* Standard includes. */
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#if( INCLUDE_xTaskGetCurrentTaskHandle != 1 )
+	#error The POSIX port requires INCLUDE_xTaskGetCurrentTaskHandle to be set to 1 in FreeRTOSConfig.h.
+#endif
+
+/* The signal used to simulate the tick interrupt. */
+#define portSIG_TICK				SIGALRM
+
+/* Number of StackType_t words reserved at the top of each task stack to hold
+the thread control structure. */
+#define portTHREAD_WORDS			( ( sizeof( Thread_t ) + sizeof( StackType_t ) - 1U ) / sizeof( StackType_t ) )
+
+/*-----------------------------------------------------------*/
+
+/* Binary event a thread waits on until it is allowed to run. */
+typedef struct EVENT
+{
+	pthread_mutex_t xMutex;
+	pthread_cond_t xCond;
+	BaseType_t xSignalled;
+} Event_t;
+
+/* Host thread of a task, stored at the top of the task stack. */
+typedef struct THREAD
+{
+	pthread_t xThread;
+	TaskFunction_t pxCode;
+	void *pvParams;
+	volatile BaseType_t xDying;
+	Event_t xEvent;
+} Thread_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Setup the interval timer and the signal handler that generate the tick.
+ */
+static void prvSetupTimerInterrupt( void );
+
+/*
+ * The tick "interrupt" handler.
+ */
+static void prvSystemTickHandler( int iSignal );
+
+/*
+ * Tick handler entry point of the MCU ports, a no-op here.
+ */
+void xPortSysTickHandler( void );
+
+/*
+ * Entry point of each task thread: wait to be scheduled for the first time,
+ * then run the task function.
+ */
+static void *prvWaitForStart( void *pvParams );
+
+/*
+ * Hand the CPU from one task thread to another.
+ */
+static void prvSwitchThread( Thread_t *pxThreadToResume, Thread_t *pxThreadToSuspend );
+static void prvSuspendSelf( Thread_t *pxThread );
+static void prvResumeThread( Thread_t *pxThread );
+
+/*
+ * Event helpers.
+ */
+static void prvEventInit( Event_t *pxEvent );
+static void prvEventDelete( Event_t *pxEvent );
+static void prvEventSignal( Event_t *pxEvent );
+static void prvEventWait( Event_t *pxEvent );
+
+/*
+ * Retrieve the thread control structure of a task from its TCB.
+ */
+static Thread_t *prvGetThreadFromTask( TaskHandle_t xTask );
+
+/*
+ * Report an unrecoverable host error and abort.
+ */
+static void prvFatalError( const char *pcCall, int iErrno );
+
+/*-----------------------------------------------------------*/
+
+/* Only one task thread runs at a time, so a single nesting count suffices.
+It is saved and restored around each context switch. */
+static volatile UBaseType_t uxCriticalNesting = 0;
+
+/* Set while the tick handler runs, saved and restored with the nesting count
+as the handler may switch to another thread. */
+static volatile BaseType_t xInsideInterrupt = pdFALSE;
+
+/* The signal set masked by portDISABLE_INTERRUPTS(). */
+static sigset_t xTickSignal;
+
+/* Signalled by vPortEndScheduler() to release the thread that called
+vTaskStartScheduler(). */
+static Event_t xSchedulerEndEvent;
+
+/* Origin of the run time statistics counter. */
+static struct timespec xStartTime;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters )
+{
+Thread_t *pxThread;
+pthread_attr_t xThreadAttributes;
+int iRet;
+
+	/* The task stack is not used for the execution of the task (the host
+	thread has its own), it only holds the thread control structure. */
+	pxThread = ( Thread_t * ) ( ( pxTopOfStack + 1 ) - portTHREAD_WORDS );
+	pxTopOfStack = ( ( StackType_t * ) pxThread ) - 1;
+
+	pxThread->pxCode = pxCode;
+	pxThread->pvParams = pvParameters;
+	pxThread->xDying = pdFALSE;
+	prvEventInit( &pxThread->xEvent );
+
+	( void ) sigemptyset( &xTickSignal );
+	( void ) sigaddset( &xTickSignal, portSIG_TICK );
+
+	/* Create the thread with the tick masked: the new thread inherits the
+	signal mask of the critical section. */
+	vPortEnterCritical();
+
+	( void ) pthread_attr_init( &xThreadAttributes );
+	( void ) pthread_attr_setdetachstate( &xThreadAttributes, PTHREAD_CREATE_JOINABLE );
+	iRet = pthread_create( &pxThread->xThread, &xThreadAttributes, prvWaitForStart, pxThread );
+	( void ) pthread_attr_destroy( &xThreadAttributes );
+	if( iRet != 0 )
+	{
+		prvFatalError( "pthread_create", iRet );
+	}
+
+	vPortExitCritical();
+
+	return pxTopOfStack;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortStartScheduler( void )
+{
+	( void ) sigemptyset( &xTickSignal );
+	( void ) sigaddset( &xTickSignal, portSIG_TICK );
+
+	prvEventInit( &xSchedulerEndEvent );
+	( void ) clock_gettime( CLOCK_MONOTONIC, &xStartTime );
+
+	/* The thread calling vTaskStartScheduler() keeps the tick masked (see
+	vTaskStartScheduler()) and never runs task code: it only waits for the
+	scheduler to end. */
+	prvSetupTimerInterrupt();
+
+	/* Start the first task. */
+	prvResumeThread( prvGetThreadFromTask( xTaskGetCurrentTaskHandle() ) );
+
+	prvEventWait( &xSchedulerEndEvent );
+	prvEventDelete( &xSchedulerEndEvent );
+
+	return 0;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+struct itimerval xTimer;
+
+	/* Stop the tick. */
+	( void ) memset( &xTimer, 0, sizeof( xTimer ) );
+	( void ) setitimer( ITIMER_REAL, &xTimer, NULL );
+
+	/* Release the thread waiting in xPortStartScheduler() and park the
+	calling task thread for ever. */
+	prvEventSignal( &xSchedulerEndEvent );
+	prvSuspendSelf( prvGetThreadFromTask( xTaskGetCurrentTaskHandle() ) );
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+Thread_t *pxThreadToSuspend, *pxThreadToResume;
+
+	vPortEnterCritical();
+
+	pxThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+	vTaskSwitchContext();
+	pxThreadToResume = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+	prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
+
+	vPortExitCritical();
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+	if( uxCriticalNesting == 0 )
+	{
+		vPortDisableInterrupts();
+	}
+	uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+	configASSERT( uxCriticalNesting );
+	uxCriticalNesting--;
+
+	/* If we have reached 0 then re-enable the interrupts. */
+	if( uxCriticalNesting == 0 )
+	{
+		vPortEnableInterrupts();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortDisableInterrupts( void )
+{
+	( void ) pthread_sigmask( SIG_BLOCK, &xTickSignal, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnableInterrupts( void )
+{
+	( void ) pthread_sigmask( SIG_UNBLOCK, &xTickSignal, NULL );
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxPortSetInterruptMask( void )
+{
+sigset_t xOldMask;
+
+	/* Returns pdTRUE if the tick was already masked, i.e. when called from
+	the tick handler or from within a critical section. */
+	( void ) pthread_sigmask( SIG_BLOCK, &xTickSignal, &xOldMask );
+
+	return ( sigismember( &xOldMask, portSIG_TICK ) == 1 ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortClearInterruptMask( UBaseType_t uxMask )
+{
+	if( uxMask == pdFALSE )
+	{
+		vPortEnableInterrupts();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortPreDeleteThread( void *pvTaskToDelete )
+{
+	/* The task is deleting itself: its thread exits as soon as it has handed
+	over to the next task. */
+	prvGetThreadFromTask( ( TaskHandle_t ) pvTaskToDelete )->xDying = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortCancelThread( void *pvTaskToDelete )
+{
+Thread_t *pxThread = prvGetThreadFromTask( ( TaskHandle_t ) pvTaskToDelete );
+
+	/* The thread is either suspended in prvSuspendSelf() or has already
+	exited.  Wake it with the dying flag set so it exits, then reclaim it. */
+	pxThread->xDying = pdTRUE;
+	prvEventSignal( &pxThread->xEvent );
+	( void ) pthread_join( pxThread->xThread, NULL );
+	prvEventDelete( &pxThread->xEvent );
+}
+/*-----------------------------------------------------------*/
+
+void xPortSysTickHandler( void )
+{
+	/* The tick is generated by the port itself (see prvSystemTickHandler()).
+	This entry point only exists so that code written for the MCU ports, such
+	as osSystickHandler() in the CMSIS-RTOS v1 wrapper, links unchanged. */
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortIsInsideInterrupt( void )
+{
+	return xInsideInterrupt;
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulPortGetRunTime( void )
+{
+struct timespec xNow;
+uint64_t ullElapsedUs;
+
+	( void ) clock_gettime( CLOCK_MONOTONIC, &xNow );
+	ullElapsedUs = ( ( uint64_t ) ( xNow.tv_sec - xStartTime.tv_sec ) * 1000000ULL );
+	ullElapsedUs += ( uint64_t ) ( ( xNow.tv_nsec - xStartTime.tv_nsec ) / 1000L );
+
+	return ( uint32_t ) ullElapsedUs;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetupTimerInterrupt( void )
+{
+struct sigaction xTickAction;
+struct itimerval xTimer;
+
+	( void ) memset( &xTickAction, 0, sizeof( xTickAction ) );
+	xTickAction.sa_handler = prvSystemTickHandler;
+	xTickAction.sa_flags = SA_RESTART;
+	( void ) sigfillset( &xTickAction.sa_mask );
+	if( sigaction( portSIG_TICK, &xTickAction, NULL ) != 0 )
+	{
+		prvFatalError( "sigaction", errno );
+	}
+
+	xTimer.it_interval.tv_sec = 0;
+	xTimer.it_interval.tv_usec = ( suseconds_t ) ( 1000000UL / configTICK_RATE_HZ );
+	xTimer.it_value = xTimer.it_interval;
+	if( setitimer( ITIMER_REAL, &xTimer, NULL ) != 0 )
+	{
+		prvFatalError( "setitimer", errno );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvSystemTickHandler( int iSignal )
+{
+Thread_t *pxThreadToSuspend, *pxThreadToResume;
+
+	( void ) iSignal;
+
+	/* The tick is masked while the handler runs, as in a critical section. */
+	uxCriticalNesting++;
+	xInsideInterrupt = pdTRUE;
+
+	pxThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+	if( xTaskIncrementTick() != pdFALSE )
+	{
+		vTaskSwitchContext();
+		pxThreadToResume = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+		prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
+	}
+
+	xInsideInterrupt = pdFALSE;
+	uxCriticalNesting--;
+}
+/*-----------------------------------------------------------*/
+
+static void *prvWaitForStart( void *pvParams )
+{
+Thread_t *pxThread = ( Thread_t * ) pvParams;
+
+	prvSuspendSelf( pxThread );
+
+	/* First time the task is scheduled: it was switched in from a critical
+	section or from the tick handler of another thread, so start with a clean
+	nesting count and the tick unmasked. */
+	uxCriticalNesting = 0;
+	xInsideInterrupt = pdFALSE;
+	vPortEnableInterrupts();
+
+	pxThread->pxCode( pxThread->pvParams );
+
+	/* Tasks must not return, delete them instead. */
+	configASSERT( pdFALSE );
+	vTaskDelete( NULL );
+
+	return NULL;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchThread( Thread_t *pxThreadToResume, Thread_t *pxThreadToSuspend )
+{
+UBaseType_t uxSavedCriticalNesting;
+BaseType_t xSavedInsideInterrupt;
+
+	if( pxThreadToSuspend != pxThreadToResume )
+	{
+		/* The nesting count and the interrupt flag belong to the running
+		thread: save them across the period the other thread owns them. */
+		uxSavedCriticalNesting = uxCriticalNesting;
+		xSavedInsideInterrupt = xInsideInterrupt;
+
+		prvResumeThread( pxThreadToResume );
+		if( pxThreadToSuspend->xDying != pdFALSE )
+		{
+			pthread_exit( NULL );
+		}
+		prvSuspendSelf( pxThreadToSuspend );
+
+		uxCriticalNesting = uxSavedCriticalNesting;
+		xInsideInterrupt = xSavedInsideInterrupt;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvSuspendSelf( Thread_t *pxThread )
+{
+	prvEventWait( &pxThread->xEvent );
+
+	/* Woken only to be reclaimed by vPortCancelThread(). */
+	if( pxThread->xDying != pdFALSE )
+	{
+		pthread_exit( NULL );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvResumeThread( Thread_t *pxThread )
+{
+	prvEventSignal( &pxThread->xEvent );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventInit( Event_t *pxEvent )
+{
+	( void ) pthread_mutex_init( &pxEvent->xMutex, NULL );
+	( void ) pthread_cond_init( &pxEvent->xCond, NULL );
+	pxEvent->xSignalled = pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventDelete( Event_t *pxEvent )
+{
+	( void ) pthread_cond_destroy( &pxEvent->xCond );
+	( void ) pthread_mutex_destroy( &pxEvent->xMutex );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventSignal( Event_t *pxEvent )
+{
+	( void ) pthread_mutex_lock( &pxEvent->xMutex );
+	pxEvent->xSignalled = pdTRUE;
+	( void ) pthread_cond_signal( &pxEvent->xCond );
+	( void ) pthread_mutex_unlock( &pxEvent->xMutex );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventWait( Event_t *pxEvent )
+{
+	( void ) pthread_mutex_lock( &pxEvent->xMutex );
+	while( pxEvent->xSignalled == pdFALSE )
+	{
+		( void ) pthread_cond_wait( &pxEvent->xCond, &pxEvent->xMutex );
+	}
+	pxEvent->xSignalled = pdFALSE;
+	( void ) pthread_mutex_unlock( &pxEvent->xMutex );
+}
+/*-----------------------------------------------------------*/
+
+static Thread_t *prvGetThreadFromTask( TaskHandle_t xTask )
+{
+StackType_t *pxTopOfStack;
+
+	/* The first member of the TCB is the top of stack returned by
+	pxPortInitialiseStack(), just below the thread control structure. */
+	pxTopOfStack = *( StackType_t ** ) xTask;
+
+	return ( Thread_t * ) ( pxTopOfStack + 1 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvFatalError( const char *pcCall, int iErrno )
+{
+	( void ) fprintf( stderr, "FreeRTOS POSIX port: %s: %s\n", pcCall, strerror( iErrno ) );
+	abort();
+}
+/*-----------------------------------------------------------*/
+
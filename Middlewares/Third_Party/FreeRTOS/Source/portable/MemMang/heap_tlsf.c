@@ -0,0 +1,756 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * A sample implementation of pvPortMalloc() and vPortFree() based on a two
+ * level segregated fit (TLSF) allocator.  Like heap_5.c the heap can span
+ * multiple non-contiguous memory regions, and adjacent free blocks are
+ * combined (coalesced) as they are freed.
+ *
+ * Unlike heap_2.c, heap_4.c and heap_5.c no list is ever walked: free blocks
+ * are kept in one list per size class, and two levels of bitmaps record which
+ * lists are not empty.  pvPortMalloc() and vPortFree() therefore execute in a
+ * bounded time whatever the number of free blocks, which also bounds the time
+ * the scheduler is suspended.  The size class of a request is rounded up
+ * (good fit), so pvPortMalloc() never has to search within a list.
+ *
+ * See heap_1.c, heap_2.c, heap_3.c, heap_4.c and heap_5.c for alternative
+ * implementations, and the memory management pages of http://www.FreeRTOS.org
+ * for more information.
+ *
+ * Usage notes:
+ *
+ * vPortDefineHeapRegions() ***must*** be called before pvPortMalloc(), exactly
+ * as with heap_5.c (see the description of the HeapRegion_t array in
+ * heap_5.c).  With heap_tlsf.c the regions do not have to be listed in address
+ * order, and vPortDefineHeapRegions() can be called again to add regions.
+ *
+ * The following optional definitions can be placed in FreeRTOSConfig.h:
+ *
+ * configTLSF_SL_INDEX_COUNT_LOG2: log2 of the number of lists each power of
+ * two size range is split into (default 3, so 8 lists).  A higher value wastes
+ * less memory to rounding but increases the size of the list head array.
+ *
+ * configTLSF_FL_INDEX_MAX: log2 of the largest block size (default 17, so
+ * blocks up to 256KB).  Regions larger than that are split into several
+ * blocks.  The list head array holds
+ * ( configTLSF_FL_INDEX_MAX - configTLSF_SL_INDEX_COUNT_LOG2 - log2( portBYTE_ALIGNMENT ) + 2 )
+ * x ( 1 << configTLSF_SL_INDEX_COUNT_LOG2 ) pointers: 96 with the defaults.
+ *
+ * configTLSF_TIMESTAMP(): a free running counter, for example the DWT cycle
+ * counter of a Cortex-M3.  When it is defined vPortGetHeapStats() reports the
+ * longest time spent in pvPortMalloc() and vPortFree(), measured while the
+ * scheduler is suspended.
+ */
+#include <stdlib.h>
+#include <stddef.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+	#error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
+#endif
+
+#ifndef configTLSF_SL_INDEX_COUNT_LOG2
+	#define configTLSF_SL_INDEX_COUNT_LOG2	3
+#endif
+
+#ifndef configTLSF_FL_INDEX_MAX
+	#define configTLSF_FL_INDEX_MAX			17
+#endif
+
+#ifdef configTLSF_TIMESTAMP
+	#define heapTIMESTAMP()		( ( uint32_t ) configTLSF_TIMESTAMP() )
+#else
+	#define heapTIMESTAMP()		( ( uint32_t ) 0 )
+#endif
+
+#if portBYTE_ALIGNMENT == 32
+	#define heapALIGNMENT_LOG2	5
+#elif portBYTE_ALIGNMENT == 16
+	#define heapALIGNMENT_LOG2	4
+#elif portBYTE_ALIGNMENT == 8
+	#define heapALIGNMENT_LOG2	3
+#elif portBYTE_ALIGNMENT == 4
+	#define heapALIGNMENT_LOG2	2
+#elif portBYTE_ALIGNMENT == 2
+	#define heapALIGNMENT_LOG2	1
+#else
+	#define heapALIGNMENT_LOG2	0
+#endif
+
+/* Second level: each power of two size range is split into heapSL_INDEX_COUNT
+lists.  First level: one entry per power of two, blocks smaller than
+heapSMALL_BLOCK_SIZE all share the first entry and are split linearly. */
+#define heapSL_INDEX_COUNT		( 1UL << configTLSF_SL_INDEX_COUNT_LOG2 )
+#define heapFL_INDEX_SHIFT		( configTLSF_SL_INDEX_COUNT_LOG2 + heapALIGNMENT_LOG2 )
+#define heapFL_INDEX_COUNT		( configTLSF_FL_INDEX_MAX - heapFL_INDEX_SHIFT + 2 )
+#define heapSMALL_BLOCK_SIZE	( ( size_t ) 1 << heapFL_INDEX_SHIFT )
+
+#if( ( configTLSF_SL_INDEX_COUNT_LOG2 < 1 ) || ( configTLSF_SL_INDEX_COUNT_LOG2 > 5 ) )
+	#error configTLSF_SL_INDEX_COUNT_LOG2 must be in the range 1 to 5
+#endif
+
+#if( ( heapFL_INDEX_COUNT < 2 ) || ( heapFL_INDEX_COUNT > 31 ) || ( configTLSF_FL_INDEX_MAX > 30 ) )
+	#error configTLSF_FL_INDEX_MAX is out of range
+#endif
+
+/* Largest block, kept aligned. */
+#define heapMAX_BLOCK_SIZE		( ( ( ( size_t ) 1 ) << ( configTLSF_FL_INDEX_MAX + 1 ) ) - ( size_t ) portBYTE_ALIGNMENT )
+
+/* Block sizes must not get too small: a free block holds the free list links
+in addition to the header. */
+#define heapMINIMUM_BLOCK_SIZE	( ( sizeof( TlsfBlock_t ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+/* Assumes 8bit bytes! */
+#define heapBITS_PER_BYTE		( ( size_t ) 8 )
+
+/* When this bit is set in the xBlockSize member of a TlsfBlock_t structure the
+block belongs to the application (or is a region end marker).  When the bit is
+clear the block is part of the free heap space. */
+#define heapBLOCK_ALLOCATED_BIT	( ( ( size_t ) 1 ) << ( ( sizeof( size_t ) * heapBITS_PER_BYTE ) - 1 ) )
+
+#define heapBLOCK_SIZE( pxBlock )		( ( pxBlock )->xBlockSize & ~heapBLOCK_ALLOCATED_BIT )
+#define heapBLOCK_IS_FREE( pxBlock )	( ( ( pxBlock )->xBlockSize & heapBLOCK_ALLOCATED_BIT ) == 0 )
+#define heapNEXT_PHYS_BLOCK( pxBlock )	( ( TlsfBlock_t * ) ( ( ( uint8_t * ) ( pxBlock ) ) + heapBLOCK_SIZE( pxBlock ) ) )
+
+/* Index of the most significant bit set, ulValue must not be 0. */
+#if defined( __GNUC__ )
+	#define heapFLS( ulValue )	( ( UBaseType_t ) ( 31 - __builtin_clz( ( unsigned int ) ( ulValue ) ) ) )
+#else
+	#define heapFLS( ulValue )	prvFLS( ulValue )
+#endif
+
+/* Index of the least significant bit set, ulValue must not be 0. */
+#define heapFFS( ulValue )		heapFLS( ( ulValue ) & ( 0UL - ( ulValue ) ) )
+
+/* Header of every block.  The free list links only exist in free blocks, in
+allocated blocks they are part of the memory returned to the application. */
+typedef struct TLSF_BLOCK_LINK
+{
+	struct TLSF_BLOCK_LINK *pxPrevPhysBlock;	/*<< The block just below this one in memory, NULL for the first block of a region. */
+	size_t xBlockSize;							/*<< The size of the block including its header. */
+	struct TLSF_BLOCK_LINK *pxNextFreeBlock;	/*<< The next free block of the same size class. */
+	struct TLSF_BLOCK_LINK *pxPrevFreeBlock;	/*<< The previous free block of the same size class. */
+} TlsfBlock_t;
+
+/*-----------------------------------------------------------*/
+
+#if !defined( __GNUC__ )
+	/*
+	 * Software implementation of heapFLS() for compilers without a count
+	 * leading zeros builtin.  Executes in constant time.
+	 */
+	static UBaseType_t prvFLS( uint32_t ulValue );
+#endif
+
+/*
+ * Computes the first and second level indexes of the list that holds free
+ * blocks of size xBlockSize.
+ */
+static void prvMappingInsert( size_t xBlockSize, UBaseType_t *puxFL, UBaseType_t *puxSL );
+
+/*
+ * Returns a free block of at least xBlockSize bytes, or NULL, and removes it
+ * from its free list.  Only the first block of a list is ever considered.
+ */
+static TlsfBlock_t *prvTakeSuitableBlock( size_t xBlockSize );
+
+/*
+ * Adds a free block to, or removes a free block from, the list of its size
+ * class and updates the bitmaps.
+ */
+static void prvInsertFreeBlock( TlsfBlock_t *pxBlock );
+static void prvRemoveFreeBlock( TlsfBlock_t *pxBlock );
+
+/*-----------------------------------------------------------*/
+
+/* The size of the header placed at the beginning of each allocated memory
+block must by correctly byte aligned. */
+static const size_t xHeapStructSize	= ( offsetof( TlsfBlock_t, pxNextFreeBlock ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* Bit n of ulFLBitmap is set when ulSLBitmap[ n ] is not 0.  Bit m of
+ulSLBitmap[ n ] is set when pxFreeLists[ n ][ m ] is not empty. */
+static uint32_t ulFLBitmap = 0U;
+static uint32_t ulSLBitmap[ heapFL_INDEX_COUNT ];
+static TlsfBlock_t *pxFreeLists[ heapFL_INDEX_COUNT ][ heapSL_INDEX_COUNT ];
+
+/* Keeps track of the number of free bytes remaining.  vPortGetHeapStats()
+reports the fragmentation. */
+static size_t xTotalHeapSize = 0U;
+static size_t xFreeBytesRemaining = 0U;
+static size_t xMinimumEverFreeBytesRemaining = 0U;
+static size_t xNumberOfSuccessfulAllocations = 0U;
+static size_t xNumberOfSuccessfulFrees = 0U;
+static uint32_t ulMaxMallocTime = 0U;
+static uint32_t ulMaxFreeTime = 0U;
+
+/*-----------------------------------------------------------*/
+
+void *pvPortMalloc( size_t xWantedSize )
+{
+TlsfBlock_t *pxBlock, *pxNewBlockLink;
+void *pvReturn = NULL;
+uint32_t ulStartTime, ulElapsed;
+
+	/* The heap must be initialised before the first call to
+	prvPortMalloc(). */
+	configASSERT( xTotalHeapSize );
+
+	vTaskSuspendAll();
+	{
+		ulStartTime = heapTIMESTAMP();
+
+		/* The wanted size is increased so it can contain a TlsfBlock_t header
+		in addition to the requested amount of bytes, and so that the block
+		can hold the free list links once it is freed. */
+		if( ( xWantedSize > 0 ) && ( xWantedSize <= ( heapMAX_BLOCK_SIZE - xHeapStructSize ) ) )
+		{
+			xWantedSize += xHeapStructSize;
+
+			/* Ensure that blocks are always aligned to the required number of
+			bytes. */
+			if( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) != 0x00 )
+			{
+				/* Byte alignment required. */
+				xWantedSize += ( portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK ) );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( xWantedSize < heapMINIMUM_BLOCK_SIZE )
+			{
+				xWantedSize = heapMINIMUM_BLOCK_SIZE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxBlock = prvTakeSuitableBlock( xWantedSize );
+
+			if( pxBlock != NULL )
+			{
+				/* If the block is larger than required it can be split into
+				two.  The remainder goes back to the free list of its size. */
+				if( ( pxBlock->xBlockSize - xWantedSize ) >= heapMINIMUM_BLOCK_SIZE )
+				{
+					pxNewBlockLink = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
+					pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+					pxNewBlockLink->pxPrevPhysBlock = pxBlock;
+					heapNEXT_PHYS_BLOCK( pxNewBlockLink )->pxPrevPhysBlock = pxNewBlockLink;
+					pxBlock->xBlockSize = xWantedSize;
+
+					prvInsertFreeBlock( pxNewBlockLink );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+				if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+				{
+					xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* The block is being returned - it is allocated and owned by
+				the application. */
+				pxBlock->xBlockSize |= heapBLOCK_ALLOCATED_BIT;
+				xNumberOfSuccessfulAllocations++;
+
+				/* Return the memory space pointed to - jumping over the
+				header at its start. */
+				pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xHeapStructSize );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		ulElapsed = heapTIMESTAMP() - ulStartTime;
+		if( ulElapsed > ulMaxMallocTime )
+		{
+			ulMaxMallocTime = ulElapsed;
+		}
+
+		traceMALLOC( pvReturn, xWantedSize );
+	}
+	( void ) xTaskResumeAll();
+
+	#if( configUSE_MALLOC_FAILED_HOOK == 1 )
+	{
+		if( pvReturn == NULL )
+		{
+			extern void vApplicationMallocFailedHook( void );
+			vApplicationMallocFailedHook();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void *pv )
+{
+uint8_t *puc = ( uint8_t * ) pv;
+TlsfBlock_t *pxLink, *pxNeighbour;
+uint32_t ulStartTime, ulElapsed;
+
+	if( pv != NULL )
+	{
+		/* The memory being freed will have a TlsfBlock_t header immediately
+		before it. */
+		puc -= xHeapStructSize;
+
+		/* This casting is to keep the compiler from issuing warnings. */
+		pxLink = ( void * ) puc;
+
+		/* Check the block is actually allocated. */
+		configASSERT( ( pxLink->xBlockSize & heapBLOCK_ALLOCATED_BIT ) != 0 );
+
+		if( ( pxLink->xBlockSize & heapBLOCK_ALLOCATED_BIT ) != 0 )
+		{
+			vTaskSuspendAll();
+			{
+				ulStartTime = heapTIMESTAMP();
+
+				/* The block is being returned to the heap - it is no longer
+				allocated. */
+				pxLink->xBlockSize &= ~heapBLOCK_ALLOCATED_BIT;
+				xFreeBytesRemaining += pxLink->xBlockSize;
+				xNumberOfSuccessfulFrees++;
+				traceFREE( pv, pxLink->xBlockSize );
+
+				/* Merge with the block below if it is free. */
+				pxNeighbour = pxLink->pxPrevPhysBlock;
+				if( ( pxNeighbour != NULL ) && heapBLOCK_IS_FREE( pxNeighbour ) && ( ( pxNeighbour->xBlockSize + pxLink->xBlockSize ) <= heapMAX_BLOCK_SIZE ) )
+				{
+					prvRemoveFreeBlock( pxNeighbour );
+					pxNeighbour->xBlockSize += pxLink->xBlockSize;
+					pxLink = pxNeighbour;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* Merge with the block above if it is free.  The end of a
+				region is marked by a block that is always allocated. */
+				pxNeighbour = heapNEXT_PHYS_BLOCK( pxLink );
+				if( heapBLOCK_IS_FREE( pxNeighbour ) && ( ( pxNeighbour->xBlockSize + pxLink->xBlockSize ) <= heapMAX_BLOCK_SIZE ) )
+				{
+					prvRemoveFreeBlock( pxNeighbour );
+					pxLink->xBlockSize += pxNeighbour->xBlockSize;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				heapNEXT_PHYS_BLOCK( pxLink )->pxPrevPhysBlock = pxLink;
+				prvInsertFreeBlock( pxLink );
+
+				ulElapsed = heapTIMESTAMP() - ulStartTime;
+				if( ulElapsed > ulMaxFreeTime )
+				{
+					ulMaxFreeTime = ulElapsed;
+				}
+			}
+			( void ) xTaskResumeAll();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+	return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+	return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapStats( HeapStats_t *pxHeapStats )
+{
+TlsfBlock_t *pxBlock;
+size_t xBlocks = 0, xMaxSize = 0, xMinSize = 0;
+UBaseType_t uxFL, uxSL;
+
+	vTaskSuspendAll();
+	{
+		/* Diagnostic only: this walks every free block. */
+		for( uxFL = 0; uxFL < heapFL_INDEX_COUNT; uxFL++ )
+		{
+			for( uxSL = 0; uxSL < heapSL_INDEX_COUNT; uxSL++ )
+			{
+				for( pxBlock = pxFreeLists[ uxFL ][ uxSL ]; pxBlock != NULL; pxBlock = pxBlock->pxNextFreeBlock )
+				{
+					xBlocks++;
+
+					if( pxBlock->xBlockSize > xMaxSize )
+					{
+						xMaxSize = pxBlock->xBlockSize;
+					}
+
+					if( ( xMinSize == 0 ) || ( pxBlock->xBlockSize < xMinSize ) )
+					{
+						xMinSize = pxBlock->xBlockSize;
+					}
+				}
+			}
+		}
+
+		pxHeapStats->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
+		pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
+		pxHeapStats->xSizeOfSmallestFreeBlockInBytes = xMinSize;
+		pxHeapStats->xNumberOfFreeBlocks = xBlocks;
+		pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+		pxHeapStats->xNumberOfSuccessfulAllocations = xNumberOfSuccessfulAllocations;
+		pxHeapStats->xNumberOfSuccessfulFrees = xNumberOfSuccessfulFrees;
+		pxHeapStats->ulMaxMallocTime = ulMaxMallocTime;
+		pxHeapStats->ulMaxFreeTime = ulMaxFreeTime;
+	}
+	( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+#if !defined( __GNUC__ )
+
+	static UBaseType_t prvFLS( uint32_t ulValue )
+	{
+	UBaseType_t uxBit = 0;
+
+		if( ( ulValue & 0xFFFF0000UL ) != 0 ) { ulValue >>= 16; uxBit += 16; }
+		if( ( ulValue & 0x0000FF00UL ) != 0 ) { ulValue >>= 8; uxBit += 8; }
+		if( ( ulValue & 0x000000F0UL ) != 0 ) { ulValue >>= 4; uxBit += 4; }
+		if( ( ulValue & 0x0000000CUL ) != 0 ) { ulValue >>= 2; uxBit += 2; }
+		if( ( ulValue & 0x00000002UL ) != 0 ) { uxBit += 1; }
+
+		return uxBit;
+	}
+
+#endif
+/*-----------------------------------------------------------*/
+
+static void prvMappingInsert( size_t xBlockSize, UBaseType_t *puxFL, UBaseType_t *puxSL )
+{
+UBaseType_t uxFL, uxSL;
+
+	if( xBlockSize < heapSMALL_BLOCK_SIZE )
+	{
+		/* Small blocks are spread linearly over the first level 0 lists. */
+		uxFL = 0;
+		uxSL = ( UBaseType_t ) ( xBlockSize / ( heapSMALL_BLOCK_SIZE / heapSL_INDEX_COUNT ) );
+	}
+	else
+	{
+		uxFL = heapFLS( ( uint32_t ) xBlockSize );
+		uxSL = ( UBaseType_t ) ( ( ( uint32_t ) xBlockSize >> ( uxFL - configTLSF_SL_INDEX_COUNT_LOG2 ) ) ^ heapSL_INDEX_COUNT );
+		uxFL -= ( heapFL_INDEX_SHIFT - 1 );
+	}
+
+	*puxFL = uxFL;
+	*puxSL = uxSL;
+}
+/*-----------------------------------------------------------*/
+
+static TlsfBlock_t *prvTakeSuitableBlock( size_t xBlockSize )
+{
+TlsfBlock_t *pxBlock = NULL;
+UBaseType_t uxFL, uxSL;
+uint32_t ulMap;
+size_t xRoundedSize = xBlockSize;
+
+	/* Round the request up to the next list boundary, so that every block of
+	the list found is large enough. */
+	if( xBlockSize >= heapSMALL_BLOCK_SIZE )
+	{
+		xRoundedSize += ( ( ( size_t ) 1 ) << ( heapFLS( ( uint32_t ) xBlockSize ) - configTLSF_SL_INDEX_COUNT_LOG2 ) ) - 1;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	prvMappingInsert( xRoundedSize, &uxFL, &uxSL );
+
+	if( uxFL < heapFL_INDEX_COUNT )
+	{
+		/* First look for a non empty list in the same power of two range,
+		then in the next non empty range. */
+		ulMap = ulSLBitmap[ uxFL ] & ( ~0UL << uxSL );
+
+		if( ulMap == 0 )
+		{
+			ulMap = ulFLBitmap & ( ~0UL << ( uxFL + 1 ) );
+
+			if( ulMap != 0 )
+			{
+				uxFL = heapFFS( ulMap );
+				ulMap = ulSLBitmap[ uxFL ];
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( ulMap != 0 )
+		{
+			uxSL = heapFFS( ulMap );
+			pxBlock = pxFreeLists[ uxFL ][ uxSL ];
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( ( pxBlock == NULL ) && ( xRoundedSize != xBlockSize ) )
+	{
+		/* No list guaranteed to fit is populated, but the first block of the
+		list the request itself maps to may be large enough.  This delays the
+		out of memory condition when the heap is nearly exhausted. */
+		prvMappingInsert( xBlockSize, &uxFL, &uxSL );
+		pxBlock = pxFreeLists[ uxFL ][ uxSL ];
+
+		if( ( pxBlock != NULL ) && ( pxBlock->xBlockSize < xBlockSize ) )
+		{
+			pxBlock = NULL;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( pxBlock != NULL )
+	{
+		prvRemoveFreeBlock( pxBlock );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pxBlock;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertFreeBlock( TlsfBlock_t *pxBlock )
+{
+UBaseType_t uxFL, uxSL;
+
+	prvMappingInsert( pxBlock->xBlockSize, &uxFL, &uxSL );
+
+	pxBlock->pxPrevFreeBlock = NULL;
+	pxBlock->pxNextFreeBlock = pxFreeLists[ uxFL ][ uxSL ];
+
+	if( pxBlock->pxNextFreeBlock != NULL )
+	{
+		pxBlock->pxNextFreeBlock->pxPrevFreeBlock = pxBlock;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	pxFreeLists[ uxFL ][ uxSL ] = pxBlock;
+	ulFLBitmap |= ( 1UL << uxFL );
+	ulSLBitmap[ uxFL ] |= ( 1UL << uxSL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveFreeBlock( TlsfBlock_t *pxBlock )
+{
+UBaseType_t uxFL, uxSL;
+
+	prvMappingInsert( pxBlock->xBlockSize, &uxFL, &uxSL );
+
+	if( pxBlock->pxNextFreeBlock != NULL )
+	{
+		pxBlock->pxNextFreeBlock->pxPrevFreeBlock = pxBlock->pxPrevFreeBlock;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( pxBlock->pxPrevFreeBlock != NULL )
+	{
+		pxBlock->pxPrevFreeBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+	}
+	else
+	{
+		/* The block was the head of its list. */
+		pxFreeLists[ uxFL ][ uxSL ] = pxBlock->pxNextFreeBlock;
+
+		if( pxFreeLists[ uxFL ][ uxSL ] == NULL )
+		{
+			ulSLBitmap[ uxFL ] &= ~( 1UL << uxSL );
+
+			if( ulSLBitmap[ uxFL ] == 0 )
+			{
+				ulFLBitmap &= ~( 1UL << uxFL );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions )
+{
+TlsfBlock_t *pxBlock, *pxPreviousBlock;
+size_t xAddress, xEndAddress, xAvailable, xBlockSize;
+size_t xRegionsSize = 0;
+BaseType_t xDefinedRegions = 0;
+const HeapRegion_t *pxHeapRegion;
+
+	pxHeapRegion = &( pxHeapRegions[ xDefinedRegions ] );
+
+	while( pxHeapRegion->xSizeInBytes > 0 )
+	{
+		/* Ensure the heap region starts and ends on a correctly aligned
+		boundary. */
+		xAddress = ( size_t ) pxHeapRegion->pucStartAddress;
+		xEndAddress = xAddress + pxHeapRegion->xSizeInBytes;
+		xAddress = ( xAddress + ( portBYTE_ALIGNMENT - 1 ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+		xEndAddress &= ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+		/* The end of the region is marked by a header that is always
+		allocated, so blocks are never merged across regions. */
+		configASSERT( xEndAddress >= ( xAddress + xHeapStructSize + heapMINIMUM_BLOCK_SIZE ) );
+		xAvailable = xEndAddress - xAddress - xHeapStructSize;
+
+		pxPreviousBlock = NULL;
+
+		/* A region larger than the largest block size is split into several
+		free blocks. */
+		while( xAvailable >= heapMINIMUM_BLOCK_SIZE )
+		{
+			xBlockSize = xAvailable;
+
+			if( xBlockSize > heapMAX_BLOCK_SIZE )
+			{
+				xBlockSize = heapMAX_BLOCK_SIZE;
+
+				if( ( xAvailable - xBlockSize ) < heapMINIMUM_BLOCK_SIZE )
+				{
+					xBlockSize -= heapMINIMUM_BLOCK_SIZE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxBlock = ( TlsfBlock_t * ) xAddress;
+			pxBlock->pxPrevPhysBlock = pxPreviousBlock;
+			pxBlock->xBlockSize = xBlockSize;
+			prvInsertFreeBlock( pxBlock );
+
+			xRegionsSize += xBlockSize;
+			pxPreviousBlock = pxBlock;
+			xAddress += xBlockSize;
+			xAvailable -= xBlockSize;
+		}
+
+		pxBlock = ( TlsfBlock_t * ) xAddress;
+		pxBlock->pxPrevPhysBlock = pxPreviousBlock;
+		pxBlock->xBlockSize = heapBLOCK_ALLOCATED_BIT;
+
+		/* Move onto the next HeapRegion_t structure. */
+		xDefinedRegions++;
+		pxHeapRegion = &( pxHeapRegions[ xDefinedRegions ] );
+	}
+
+	/* Check something was actually defined before it is accessed. */
+	configASSERT( xRegionsSize );
+
+	xTotalHeapSize += xRegionsSize;
+	xMinimumEverFreeBytesRemaining += xRegionsSize;
+	xFreeBytesRemaining += xRegionsSize;
+}
+
@@ -52,6 +52,10 @@ privileged Vs unprivileged linkage and placement. */
 #define queueUNLOCKED					( ( int8_t ) -1 )
 #define queueLOCKED_UNMODIFIED			( ( int8_t ) 0 )
 
+/* Largest value a lock count can hold.  A batch posted to or read from a
+locked queue by an ISR is truncated so the lock count cannot overflow. */
+#define queueLOCK_COUNT_MAX				( ( int8_t ) 127 )
+
 /* When the Queue_t structure is used to represent a base queue its pcHead and
 pcTail members are used as pointers into the queue storage area.  When the
 Queue_t structure is used to represent a mutex pcHead and pcTail pointers are
@@ -190,6 +194,25 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue, const void *pvIte
  */
 static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const pvBuffer ) PRIVILEGED_FUNCTION;
 
+/*
+ * Copies uxCount items to the back of a queue, and out of the front of a
+ * queue, using at most two memcpy() calls each.  The caller must have checked
+ * there is enough space, or enough items, in the queue.
+ */
+static void prvCopyDataToQueueMultiple( Queue_t * const pxQueue, const void *pvItems, const UBaseType_t uxCount ) PRIVILEGED_FUNCTION;
+static void prvCopyDataFromQueueMultiple( Queue_t * const pxQueue, void * const pvBuffer, const UBaseType_t uxCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unblocks up to uxCount tasks waiting to receive from, or to send to, the
+ * queue once uxCount items have been added to, or removed from, the queue.
+ * Must be called from a critical section with the queue unlocked.
+ *
+ * @return pdTRUE if an unblocked task has a priority above the priority of
+ * the calling task, otherwise pdFALSE.
+ */
+static BaseType_t prvUnblockTasksWaitingToReceive( Queue_t * const pxQueue, UBaseType_t uxCount ) PRIVILEGED_FUNCTION;
+static BaseType_t prvUnblockTasksWaitingToSend( Queue_t * const pxQueue, UBaseType_t uxCount ) PRIVILEGED_FUNCTION;
+
 #if ( configUSE_QUEUE_SETS == 1 )
 	/*
 	 * Checks to see if a queue is a member of a queue set, and if so, notifies
@@ -1891,6 +1914,479 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 }
 /*-----------------------------------------------------------*/
 
+UBaseType_t xQueueSendMultiple( QueueHandle_t xQueue, const void * const pvItems, const UBaseType_t uxCount, TickType_t xTicksToWait )
+{
+BaseType_t xEntryTimeSet = pdFALSE;
+TimeOut_t xTimeOut;
+UBaseType_t uxItemsToCopy;
+Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( !( ( pvItems == NULL ) && ( uxCount != ( UBaseType_t ) 0U ) ) );
+	configASSERT( pxQueue->uxItemSize != 0 ); /* Semaphores and mutexes are not supported. */
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	if( uxCount == ( UBaseType_t ) 0 )
+	{
+		return ( UBaseType_t ) 0;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* This function relaxes the coding standard somewhat to allow return
+	statements within the function itself.  This is done in the interest
+	of execution time efficiency. */
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			uxItemsToCopy = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+
+			/* Is there room for at least one item?  As many items as fit are
+			copied at once, then the tasks waiting for data are unblocked, so
+			the cost of the critical section and of the wake up decision is
+			paid once for the whole batch. */
+			if( uxItemsToCopy > ( UBaseType_t ) 0 )
+			{
+				if( uxItemsToCopy > uxCount )
+				{
+					uxItemsToCopy = uxCount;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				traceQUEUE_SEND( pxQueue );
+				prvCopyDataToQueueMultiple( pxQueue, pvItems, uxItemsToCopy );
+
+				if( prvUnblockTasksWaitingToReceive( pxQueue, uxItemsToCopy ) != pdFALSE )
+				{
+					/* An unblocked task has a priority higher than our own so
+					yield immediately.  Yes it is ok to do this from within the
+					critical section - the kernel takes care of that. */
+					queueYIELD_IF_USING_PREEMPTION();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				taskEXIT_CRITICAL();
+				return uxItemsToCopy;
+			}
+			else
+			{
+				if( xTicksToWait == ( TickType_t ) 0 )
+				{
+					/* The queue was full and no block time is specified (or
+					the block time has expired) so leave now. */
+					taskEXIT_CRITICAL();
+					traceQUEUE_SEND_FAILED( pxQueue );
+					return ( UBaseType_t ) 0;
+				}
+				else if( xEntryTimeSet == pdFALSE )
+				{
+					/* The queue was full and a block time was specified so
+					configure the timeout structure. */
+					vTaskInternalSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+				}
+				else
+				{
+					/* Entry time was already set. */
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		/* Interrupts and other tasks can send to and receive from the queue
+		now the critical section has been exited. */
+
+		vTaskSuspendAll();
+		prvLockQueue( pxQueue );
+
+		/* Update the timeout state to see if it has expired yet. */
+		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+		{
+			if( prvIsQueueFull( pxQueue ) != pdFALSE )
+			{
+				traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+				prvUnlockQueue( pxQueue );
+
+				if( xTaskResumeAll() == pdFALSE )
+				{
+					portYIELD_WITHIN_API();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				/* Try again. */
+				prvUnlockQueue( pxQueue );
+				( void ) xTaskResumeAll();
+			}
+		}
+		else
+		{
+			/* The timeout has expired. */
+			prvUnlockQueue( pxQueue );
+			( void ) xTaskResumeAll();
+
+			traceQUEUE_SEND_FAILED( pxQueue );
+			return ( UBaseType_t ) 0;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t xQueueSendMultipleFromISR( QueueHandle_t xQueue, const void * const pvItems, const UBaseType_t uxCount, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+UBaseType_t uxItemsToCopy;
+UBaseType_t uxSavedInterruptStatus;
+Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( !( ( pvItems == NULL ) && ( uxCount != ( UBaseType_t ) 0U ) ) );
+	configASSERT( pxQueue->uxItemSize != 0 ); /* Semaphores and mutexes are not supported. */
+
+	/* RTOS ports that support interrupt nesting have the concept of a maximum
+	system call (or maximum API call) interrupt priority.  Interrupts that are
+	above the maximum system call priority are kept permanently enabled, even
+	when the RTOS kernel is in a critical section, but cannot make any calls to
+	FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
+	then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+	failure if a FreeRTOS API function is called from an interrupt that has been
+	assigned a priority above the configured maximum system call priority.
+	Only FreeRTOS functions that end in FromISR can be called from interrupts
+	that have been assigned a priority at or (logically) below the maximum
+	system call	interrupt priority.  FreeRTOS maintains a separate interrupt
+	safe API to ensure interrupt entry is as fast and as simple as possible.
+	More information (albeit Cortex-M specific) is provided on the following
+	link: http://www.freertos.org/RTOS-Cortex-M3-M4.html */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		const int8_t cTxLock = pxQueue->cTxLock;
+
+		uxItemsToCopy = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+
+		if( uxItemsToCopy > uxCount )
+		{
+			uxItemsToCopy = uxCount;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* If the queue is locked each item posted increments the lock count,
+		so the task that unlocks the queue can unblock one task per item. */
+		if( ( cTxLock != queueUNLOCKED ) && ( uxItemsToCopy > ( UBaseType_t ) ( queueLOCK_COUNT_MAX - cTxLock ) ) )
+		{
+			uxItemsToCopy = ( UBaseType_t ) ( queueLOCK_COUNT_MAX - cTxLock );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( uxItemsToCopy > ( UBaseType_t ) 0 )
+		{
+			traceQUEUE_SEND_FROM_ISR( pxQueue );
+			prvCopyDataToQueueMultiple( pxQueue, pvItems, uxItemsToCopy );
+
+			/* The event list is not altered if the queue is locked.  This will
+			be done when the queue is unlocked later. */
+			if( cTxLock == queueUNLOCKED )
+			{
+				if( prvUnblockTasksWaitingToReceive( pxQueue, uxItemsToCopy ) != pdFALSE )
+				{
+					if( pxHigherPriorityTaskWoken != NULL )
+					{
+						*pxHigherPriorityTaskWoken = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				pxQueue->cTxLock = ( int8_t ) ( cTxLock + ( int8_t ) uxItemsToCopy );
+			}
+		}
+		else
+		{
+			traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return uxItemsToCopy;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t xQueueReceiveMultiple( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxCount, TickType_t xTicksToWait )
+{
+BaseType_t xEntryTimeSet = pdFALSE;
+TimeOut_t xTimeOut;
+UBaseType_t uxItemsToCopy;
+Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( !( ( pvBuffer == NULL ) && ( uxCount != ( UBaseType_t ) 0U ) ) );
+	configASSERT( pxQueue->uxItemSize != 0 ); /* Semaphores and mutexes are not supported. */
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	if( uxCount == ( UBaseType_t ) 0 )
+	{
+		return ( UBaseType_t ) 0;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* This function relaxes the coding standard somewhat to allow return
+	statements within the function itself.  This is done in the interest
+	of execution time efficiency. */
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			uxItemsToCopy = pxQueue->uxMessagesWaiting;
+
+			/* Is there data in the queue now?  To be running the calling task
+			must be the highest priority task wanting to access the queue. */
+			if( uxItemsToCopy > ( UBaseType_t ) 0 )
+			{
+				if( uxItemsToCopy > uxCount )
+				{
+					uxItemsToCopy = uxCount;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				prvCopyDataFromQueueMultiple( pxQueue, pvBuffer, uxItemsToCopy );
+				traceQUEUE_RECEIVE( pxQueue );
+				pxQueue->uxMessagesWaiting -= uxItemsToCopy;
+
+				/* There is now space in the queue, unblock the tasks waiting
+				to post to the queue, one per item removed. */
+				if( prvUnblockTasksWaitingToSend( pxQueue, uxItemsToCopy ) != pdFALSE )
+				{
+					queueYIELD_IF_USING_PREEMPTION();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				taskEXIT_CRITICAL();
+				return uxItemsToCopy;
+			}
+			else
+			{
+				if( xTicksToWait == ( TickType_t ) 0 )
+				{
+					/* The queue was empty and no block time is specified (or
+					the block time has expired) so leave now. */
+					taskEXIT_CRITICAL();
+					traceQUEUE_RECEIVE_FAILED( pxQueue );
+					return ( UBaseType_t ) 0;
+				}
+				else if( xEntryTimeSet == pdFALSE )
+				{
+					/* The queue was empty and a block time was specified so
+					configure the timeout structure. */
+					vTaskInternalSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+				}
+				else
+				{
+					/* Entry time was already set. */
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		/* Interrupts and other tasks can send to and receive from the queue
+		now the critical section has been exited. */
+
+		vTaskSuspendAll();
+		prvLockQueue( pxQueue );
+
+		/* Update the timeout state to see if it has expired yet. */
+		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+		{
+			/* The timeout has not expired.  If the queue is still empty place
+			the task on the list of tasks waiting to receive from the queue. */
+			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+			{
+				traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+				prvUnlockQueue( pxQueue );
+				if( xTaskResumeAll() == pdFALSE )
+				{
+					portYIELD_WITHIN_API();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				/* The queue contains data again.  Loop back to try and read the
+				data. */
+				prvUnlockQueue( pxQueue );
+				( void ) xTaskResumeAll();
+			}
+		}
+		else
+		{
+			/* Timed out.  If there is no data in the queue exit, otherwise loop
+			back and attempt to read the data. */
+			prvUnlockQueue( pxQueue );
+			( void ) xTaskResumeAll();
+
+			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+			{
+				traceQUEUE_RECEIVE_FAILED( pxQueue );
+				return ( UBaseType_t ) 0;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t xQueueReceiveMultipleFromISR( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxCount, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+UBaseType_t uxItemsToCopy;
+UBaseType_t uxSavedInterruptStatus;
+Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( !( ( pvBuffer == NULL ) && ( uxCount != ( UBaseType_t ) 0U ) ) );
+	configASSERT( pxQueue->uxItemSize != 0 ); /* Semaphores and mutexes are not supported. */
+
+	/* RTOS ports that support interrupt nesting have the concept of a maximum
+	system call (or maximum API call) interrupt priority.  Interrupts that are
+	above the maximum system call priority are kept permanently enabled, even
+	when the RTOS kernel is in a critical section, but cannot make any calls to
+	FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
+	then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+	failure if a FreeRTOS API function is called from an interrupt that has been
+	assigned a priority above the configured maximum system call priority.
+	Only FreeRTOS functions that end in FromISR can be called from interrupts
+	that have been assigned a priority at or (logically) below the maximum
+	system call	interrupt priority.  FreeRTOS maintains a separate interrupt
+	safe API to ensure interrupt entry is as fast and as simple as possible.
+	More information (albeit Cortex-M specific) is provided on the following
+	link: http://www.freertos.org/RTOS-Cortex-M3-M4.html */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		const int8_t cRxLock = pxQueue->cRxLock;
+
+		uxItemsToCopy = pxQueue->uxMessagesWaiting;
+
+		if( uxItemsToCopy > uxCount )
+		{
+			uxItemsToCopy = uxCount;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* If the queue is locked each item removed increments the lock count,
+		so the task that unlocks the queue can unblock one task per item. */
+		if( ( cRxLock != queueUNLOCKED ) && ( uxItemsToCopy > ( UBaseType_t ) ( queueLOCK_COUNT_MAX - cRxLock ) ) )
+		{
+			uxItemsToCopy = ( UBaseType_t ) ( queueLOCK_COUNT_MAX - cRxLock );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Cannot block in an ISR, so check there is data available. */
+		if( uxItemsToCopy > ( UBaseType_t ) 0 )
+		{
+			traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
+
+			prvCopyDataFromQueueMultiple( pxQueue, pvBuffer, uxItemsToCopy );
+			pxQueue->uxMessagesWaiting -= uxItemsToCopy;
+
+			/* If the queue is locked the event list will not be modified.
+			Instead update the lock count so the task that unlocks the queue
+			will know that an ISR has removed data while the queue was
+			locked. */
+			if( cRxLock == queueUNLOCKED )
+			{
+				if( prvUnblockTasksWaitingToSend( pxQueue, uxItemsToCopy ) != pdFALSE )
+				{
+					if( pxHigherPriorityTaskWoken != NULL )
+					{
+						*pxHigherPriorityTaskWoken = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				pxQueue->cRxLock = ( int8_t ) ( cRxLock + ( int8_t ) uxItemsToCopy );
+			}
+		}
+		else
+		{
+			traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return uxItemsToCopy;
+}
+/*-----------------------------------------------------------*/
+
 UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue )
 {
 UBaseType_t uxReturn;
@@ -2133,6 +2629,164 @@ static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const pvBuffer
 }
 /*-----------------------------------------------------------*/
 
+static void prvCopyDataToQueueMultiple( Queue_t * const pxQueue, const void *pvItems, const UBaseType_t uxCount )
+{
+const size_t xBytes = ( size_t ) uxCount * ( size_t ) pxQueue->uxItemSize;
+size_t xFirstBytes;
+
+	/* This function is called from a critical section. */
+
+	/* Copy up to the end of the storage area, then wrap to its start. */
+	xFirstBytes = ( size_t ) ( pxQueue->pcTail - pxQueue->pcWriteTo ); /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+	if( xFirstBytes > xBytes )
+	{
+		xFirstBytes = xBytes;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItems, xFirstBytes ); /*lint !e961 !e418 MISRA exception as the casts are only redundant for some ports. */
+	pxQueue->pcWriteTo += xFirstBytes;
+
+	if( xFirstBytes < xBytes )
+	{
+		( void ) memcpy( ( void * ) pxQueue->pcHead, ( const void * ) ( ( const int8_t * ) pvItems + xFirstBytes ), xBytes - xFirstBytes ); /*lint !e961 !e418 MISRA exception as the casts are only redundant for some ports. */
+		pxQueue->pcWriteTo = pxQueue->pcHead + ( xBytes - xFirstBytes );
+	}
+	else if( pxQueue->pcWriteTo >= pxQueue->pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+	{
+		pxQueue->pcWriteTo = pxQueue->pcHead;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	pxQueue->uxMessagesWaiting += uxCount;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCopyDataFromQueueMultiple( Queue_t * const pxQueue, void * const pvBuffer, const UBaseType_t uxCount )
+{
+const size_t xBytes = ( size_t ) uxCount * ( size_t ) pxQueue->uxItemSize;
+size_t xFirstBytes;
+int8_t *pcReadFrom;
+
+	/* This function is called from a critical section.  As in
+	prvCopyDataFromQueue(), u.pcReadFrom points to the last item read. */
+	pcReadFrom = pxQueue->u.pcReadFrom + pxQueue->uxItemSize;
+	if( pcReadFrom >= pxQueue->pcTail ) /*lint !e946 MISRA exception justified as use of the relational operator is the cleanest solutions. */
+	{
+		pcReadFrom = pxQueue->pcHead;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	xFirstBytes = ( size_t ) ( pxQueue->pcTail - pcReadFrom ); /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+	if( xFirstBytes > xBytes )
+	{
+		xFirstBytes = xBytes;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	( void ) memcpy( pvBuffer, ( void * ) pcReadFrom, xFirstBytes ); /*lint !e961 !e418 MISRA exception as the casts are only redundant for some ports. */
+
+	if( xFirstBytes < xBytes )
+	{
+		( void ) memcpy( ( void * ) ( ( int8_t * ) pvBuffer + xFirstBytes ), ( void * ) pxQueue->pcHead, xBytes - xFirstBytes ); /*lint !e961 !e418 MISRA exception as the casts are only redundant for some ports. */
+		pxQueue->u.pcReadFrom = pxQueue->pcHead + ( xBytes - xFirstBytes ) - pxQueue->uxItemSize;
+	}
+	else
+	{
+		pxQueue->u.pcReadFrom = pcReadFrom + xFirstBytes - pxQueue->uxItemSize;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvUnblockTasksWaitingToReceive( Queue_t * const pxQueue, UBaseType_t uxCount )
+{
+BaseType_t xReturn = pdFALSE;
+
+	#if ( configUSE_QUEUE_SETS == 1 )
+	{
+		if( pxQueue->pxQueueSetContainer != NULL )
+		{
+			/* The queue set holds one handle per item posted. */
+			while( uxCount > ( UBaseType_t ) 0 )
+			{
+				if( prvNotifyQueueSetContainer( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
+				{
+					xReturn = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				--uxCount;
+			}
+
+			/* No task can be waiting on a queue that is in a set. */
+			uxCount = ( UBaseType_t ) 0;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configUSE_QUEUE_SETS */
+
+	/* Each item can satisfy one waiting task, the highest priority tasks being
+	unblocked first. */
+	while( ( uxCount > ( UBaseType_t ) 0 ) && ( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE ) )
+	{
+		if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+		{
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		--uxCount;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvUnblockTasksWaitingToSend( Queue_t * const pxQueue, UBaseType_t uxCount )
+{
+BaseType_t xReturn = pdFALSE;
+
+	/* Each free space can satisfy one waiting task, the highest priority tasks
+	being unblocked first. */
+	while( ( uxCount > ( UBaseType_t ) 0 ) && ( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE ) )
+	{
+		if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+		{
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		--uxCount;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
 static void prvUnlockQueue( Queue_t * const pxQueue )
 {
 	/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED. */
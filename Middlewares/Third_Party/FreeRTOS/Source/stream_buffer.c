@@ -202,6 +202,32 @@ static size_t prvReadBytesFromBuffer( StreamBuffer_t *pxStreamBuffer,
 									  size_t xMaxCount,
 									  size_t xBytesAvailable ); PRIVILEGED_FUNCTION
 
+/*
+ * Fills pxSpan with the location of xCount bytes of the storage area starting
+ * at index xIndex.  The region is split in two parts if it wraps around the
+ * end of the storage area.
+ */
+static void prvGetSpan( const StreamBuffer_t * const pxStreamBuffer, size_t xIndex, size_t xCount, StreamBufferSpan_t * const pxSpan ) PRIVILEGED_FUNCTION;
+
+/*
+ * Common parts of the zero copy functions called from tasks and from
+ * interrupts.  Reserve and peek leave the head and the tail unchanged, commit
+ * and release move them.
+ */
+static size_t prvReserve( StreamBuffer_t * const pxStreamBuffer, size_t xDataLengthBytes, size_t xSpace, StreamBufferSpan_t * const pxSpan ) PRIVILEGED_FUNCTION;
+static size_t prvCommit( StreamBuffer_t * const pxStreamBuffer, size_t xDataLengthBytes ) PRIVILEGED_FUNCTION;
+static size_t prvPeek( StreamBuffer_t * const pxStreamBuffer, size_t xBytesAvailable, size_t xBytesToStoreMessageLength, StreamBufferSpan_t * const pxSpan ) PRIVILEGED_FUNCTION;
+static size_t prvRelease( StreamBuffer_t * const pxStreamBuffer, size_t xReleaseBytes ) PRIVILEGED_FUNCTION;
+
+/*
+ * Block the calling task until at least xRequiredSpace bytes are free
+ * (prvWaitForSpace()), or until more than xBytesToStoreMessageLength bytes are
+ * available (prvWaitForData()), or until xTicksToWait expires.  Return the
+ * number of bytes free or available.
+ */
+static size_t prvWaitForSpace( StreamBuffer_t * const pxStreamBuffer, size_t xRequiredSpace, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+static size_t prvWaitForData( StreamBuffer_t * const pxStreamBuffer, size_t xBytesToStoreMessageLength, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
 /*
  * Called by both pxStreamBufferCreate() and pxStreamBufferCreateStatic() to
  * initialise the members of the newly created stream buffer structure.
@@ -1017,6 +1043,519 @@ UBaseType_t uxSavedInterruptStatus;
 }
 /*-----------------------------------------------------------*/
 
+static void prvGetSpan( const StreamBuffer_t * const pxStreamBuffer, size_t xIndex, size_t xCount, StreamBufferSpan_t * const pxSpan )
+{
+	if( xIndex >= pxStreamBuffer->xLength )
+	{
+		xIndex -= pxStreamBuffer->xLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* The first part runs up to the end of the storage area at most, the
+	remainder, if any, starts at the beginning of the storage area. */
+	pxSpan->pucFirst = &( pxStreamBuffer->pucBuffer[ xIndex ] );
+	pxSpan->xFirstLength = configMIN( pxStreamBuffer->xLength - xIndex, xCount );
+	pxSpan->pucSecond = pxStreamBuffer->pucBuffer;
+	pxSpan->xSecondLength = xCount - pxSpan->xFirstLength;
+
+	if( pxSpan->xSecondLength == ( size_t ) 0 )
+	{
+		pxSpan->pucSecond = NULL;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvReserve( StreamBuffer_t * const pxStreamBuffer, size_t xDataLengthBytes, size_t xSpace, StreamBufferSpan_t * const pxSpan )
+{
+size_t xReturn;
+
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		/* The message length is written in front of the message when it is
+		committed, so the data starts after the space needed to store it. */
+		if( xSpace >= ( xDataLengthBytes + sbBYTES_TO_STORE_MESSAGE_LENGTH ) )
+		{
+			xReturn = xDataLengthBytes;
+			prvGetSpan( pxStreamBuffer, pxStreamBuffer->xHead + sbBYTES_TO_STORE_MESSAGE_LENGTH, xReturn, pxSpan );
+		}
+		else
+		{
+			xReturn = 0;
+		}
+	}
+	else
+	{
+		/* Reserve as many bytes as possible. */
+		xReturn = configMIN( xDataLengthBytes, xSpace );
+		prvGetSpan( pxStreamBuffer, pxStreamBuffer->xHead, xReturn, pxSpan );
+	}
+
+	if( xReturn == ( size_t ) 0 )
+	{
+		prvGetSpan( pxStreamBuffer, pxStreamBuffer->xHead, 0, pxSpan );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvCommit( StreamBuffer_t * const pxStreamBuffer, size_t xDataLengthBytes )
+{
+size_t xSpace, xNextHead;
+
+	xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
+
+	if( xDataLengthBytes == ( size_t ) 0 )
+	{
+		/* The reservation is abandoned. */
+		mtCOVERAGE_TEST_MARKER();
+	}
+	else if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		/* Cannot commit more than was reserved, and nothing else can have
+		written to the buffer in between. */
+		configASSERT( ( xDataLengthBytes + sbBYTES_TO_STORE_MESSAGE_LENGTH ) <= xSpace );
+
+		if( ( xDataLengthBytes + sbBYTES_TO_STORE_MESSAGE_LENGTH ) <= xSpace )
+		{
+			/* Write the length in front of the data, which moves the head past
+			the length. */
+			( void ) prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) &( xDataLengthBytes ), sbBYTES_TO_STORE_MESSAGE_LENGTH );
+		}
+		else
+		{
+			xDataLengthBytes = 0;
+		}
+	}
+	else
+	{
+		configASSERT( xDataLengthBytes <= xSpace );
+		xDataLengthBytes = configMIN( xDataLengthBytes, xSpace );
+	}
+
+	if( xDataLengthBytes > ( size_t ) 0 )
+	{
+		/* The data is already in place, publish it by moving the head. */
+		xNextHead = pxStreamBuffer->xHead + xDataLengthBytes;
+
+		if( xNextHead >= pxStreamBuffer->xLength )
+		{
+			xNextHead -= pxStreamBuffer->xLength;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		pxStreamBuffer->xHead = xNextHead;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xDataLengthBytes;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvPeek( StreamBuffer_t * const pxStreamBuffer, size_t xBytesAvailable, size_t xBytesToStoreMessageLength, StreamBufferSpan_t * const pxSpan )
+{
+size_t xOriginalTail, xNextMessageLength = 0;
+
+	if( xBytesAvailable > xBytesToStoreMessageLength )
+	{
+		if( xBytesToStoreMessageLength != ( size_t ) 0 )
+		{
+			/* Read the length of the next message without removing it from
+			the buffer. */
+			xOriginalTail = pxStreamBuffer->xTail;
+			( void ) prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xNextMessageLength, xBytesToStoreMessageLength, xBytesAvailable );
+			pxStreamBuffer->xTail = xOriginalTail;
+		}
+		else
+		{
+			/* All the bytes in a stream buffer can be read. */
+			xNextMessageLength = xBytesAvailable;
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	prvGetSpan( pxStreamBuffer, pxStreamBuffer->xTail + xBytesToStoreMessageLength, xNextMessageLength, pxSpan );
+
+	return xNextMessageLength;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvRelease( StreamBuffer_t * const pxStreamBuffer, size_t xReleaseBytes )
+{
+size_t xBytesAvailable, xNextMessageLength, xNextTail;
+
+	xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		/* A message is always released as a whole, together with its
+		length. */
+		if( ( xReleaseBytes > ( size_t ) 0 ) && ( xBytesAvailable > sbBYTES_TO_STORE_MESSAGE_LENGTH ) )
+		{
+			( void ) prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xNextMessageLength, sbBYTES_TO_STORE_MESSAGE_LENGTH, xBytesAvailable );
+			configASSERT( xReleaseBytes == xNextMessageLength );
+			xReleaseBytes = xNextMessageLength;
+		}
+		else
+		{
+			xReleaseBytes = 0;
+		}
+	}
+	else
+	{
+		configASSERT( xReleaseBytes <= xBytesAvailable );
+		xReleaseBytes = configMIN( xReleaseBytes, xBytesAvailable );
+	}
+
+	if( xReleaseBytes > ( size_t ) 0 )
+	{
+		xNextTail = pxStreamBuffer->xTail + xReleaseBytes;
+
+		if( xNextTail >= pxStreamBuffer->xLength )
+		{
+			xNextTail -= pxStreamBuffer->xLength;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		pxStreamBuffer->xTail = xNextTail;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReleaseBytes;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWaitForSpace( StreamBuffer_t * const pxStreamBuffer, size_t xRequiredSpace, TickType_t xTicksToWait )
+{
+size_t xSpace = 0;
+TimeOut_t xTimeOut;
+
+	/* Same as the wait performed by xStreamBufferSend(). */
+	vTaskSetTimeOutState( &xTimeOut );
+
+	do
+	{
+		/* Wait until the required number of bytes are free in the buffer. */
+		taskENTER_CRITICAL();
+		{
+			xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
+
+			if( xSpace < xRequiredSpace )
+			{
+				/* Clear notification state as going to wait for space. */
+				( void ) xTaskNotifyStateClear( NULL );
+
+				/* Should only be one writer. */
+				configASSERT( pxStreamBuffer->xTaskWaitingToSend == NULL );
+				pxStreamBuffer->xTaskWaitingToSend = xTaskGetCurrentTaskHandle();
+			}
+			else
+			{
+				taskEXIT_CRITICAL();
+				break;
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		traceBLOCKING_ON_STREAM_BUFFER_SEND( pxStreamBuffer );
+		( void ) xTaskNotifyWait( ( uint32_t ) 0, UINT32_MAX, NULL, xTicksToWait );
+		pxStreamBuffer->xTaskWaitingToSend = NULL;
+
+	} while( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE );
+
+	return xStreamBufferSpacesAvailable( pxStreamBuffer );
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWaitForData( StreamBuffer_t * const pxStreamBuffer, size_t xBytesToStoreMessageLength, TickType_t xTicksToWait )
+{
+size_t xBytesAvailable;
+
+	/* Same as the wait performed by xStreamBufferReceive().  Checking if there
+	is data and clearing the notification state must be performed
+	atomically. */
+	taskENTER_CRITICAL();
+	{
+		xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+
+		if( xBytesAvailable <= xBytesToStoreMessageLength )
+		{
+			/* Clear notification state as going to wait for data. */
+			( void ) xTaskNotifyStateClear( NULL );
+
+			/* Should only be one reader. */
+			configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
+			pxStreamBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	if( xBytesAvailable <= xBytesToStoreMessageLength )
+	{
+		/* Wait for data to be available. */
+		traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( pxStreamBuffer );
+		( void ) xTaskNotifyWait( ( uint32_t ) 0, UINT32_MAX, NULL, xTicksToWait );
+		pxStreamBuffer->xTaskWaitingToReceive = NULL;
+
+		/* Recheck the data available after blocking. */
+		xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xBytesAvailable;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReserve( StreamBufferHandle_t xStreamBuffer,
+							 size_t xDataLengthBytes,
+							 StreamBufferSpan_t * const pxSpan,
+							 TickType_t xTicksToWait )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+size_t xSpace, xRequiredSpace = xDataLengthBytes;
+
+	configASSERT( pxSpan );
+	configASSERT( pxStreamBuffer );
+
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		xRequiredSpace += sbBYTES_TO_STORE_MESSAGE_LENGTH;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( xTicksToWait != ( TickType_t ) 0 )
+	{
+		xSpace = prvWaitForSpace( pxStreamBuffer, xRequiredSpace, xTicksToWait );
+	}
+	else
+	{
+		xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
+	}
+
+	return prvReserve( pxStreamBuffer, xDataLengthBytes, xSpace, pxSpan );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReserveFromISR( StreamBufferHandle_t xStreamBuffer,
+									size_t xDataLengthBytes,
+									StreamBufferSpan_t * const pxSpan )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+
+	configASSERT( pxSpan );
+	configASSERT( pxStreamBuffer );
+
+	return prvReserve( pxStreamBuffer, xDataLengthBytes, xStreamBufferSpacesAvailable( pxStreamBuffer ), pxSpan );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferCommit( StreamBufferHandle_t xStreamBuffer, size_t xDataLengthBytes )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+size_t xReturn;
+
+	configASSERT( pxStreamBuffer );
+
+	xReturn = prvCommit( pxStreamBuffer, xDataLengthBytes );
+
+	if( xReturn > ( size_t ) 0 )
+	{
+		traceSTREAM_BUFFER_SEND( xStreamBuffer, xReturn );
+
+		/* Was a task waiting for the data? */
+		if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+		{
+			sbSEND_COMPLETED( pxStreamBuffer );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+								   size_t xDataLengthBytes,
+								   BaseType_t * const pxHigherPriorityTaskWoken )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+size_t xReturn;
+
+	configASSERT( pxStreamBuffer );
+
+	xReturn = prvCommit( pxStreamBuffer, xDataLengthBytes );
+
+	if( xReturn > ( size_t ) 0 )
+	{
+		/* Was a task waiting for the data? */
+		if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+		{
+			sbSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xReturn );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferPeek( StreamBufferHandle_t xStreamBuffer,
+						  StreamBufferSpan_t * const pxSpan,
+						  TickType_t xTicksToWait )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+size_t xBytesAvailable, xBytesToStoreMessageLength;
+
+	configASSERT( pxSpan );
+	configASSERT( pxStreamBuffer );
+
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
+	}
+	else
+	{
+		xBytesToStoreMessageLength = 0;
+	}
+
+	if( xTicksToWait != ( TickType_t ) 0 )
+	{
+		xBytesAvailable = prvWaitForData( pxStreamBuffer, xBytesToStoreMessageLength, xTicksToWait );
+	}
+	else
+	{
+		xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+	}
+
+	return prvPeek( pxStreamBuffer, xBytesAvailable, xBytesToStoreMessageLength, pxSpan );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferPeekFromISR( StreamBufferHandle_t xStreamBuffer,
+								 StreamBufferSpan_t * const pxSpan )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+size_t xBytesToStoreMessageLength;
+
+	configASSERT( pxSpan );
+	configASSERT( pxStreamBuffer );
+
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
+	}
+	else
+	{
+		xBytesToStoreMessageLength = 0;
+	}
+
+	return prvPeek( pxStreamBuffer, prvBytesInBuffer( pxStreamBuffer ), xBytesToStoreMessageLength, pxSpan );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferRelease( StreamBufferHandle_t xStreamBuffer, size_t xReleaseBytes )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+size_t xReturn;
+
+	configASSERT( pxStreamBuffer );
+
+	xReturn = prvRelease( pxStreamBuffer, xReleaseBytes );
+
+	/* Was a task waiting for space in the buffer? */
+	if( xReturn > ( size_t ) 0 )
+	{
+		traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReturn );
+		sbRECEIVE_COMPLETED( pxStreamBuffer );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReleaseFromISR( StreamBufferHandle_t xStreamBuffer,
+									size_t xReleaseBytes,
+									BaseType_t * const pxHigherPriorityTaskWoken )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+size_t xReturn;
+
+	configASSERT( pxStreamBuffer );
+
+	xReturn = prvRelease( pxStreamBuffer, xReleaseBytes );
+
+	/* Was a task waiting for space in the buffer? */
+	if( xReturn > ( size_t ) 0 )
+	{
+		sbRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xReturn );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
 static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer, const uint8_t *pucData, size_t xCount )
 {
 size_t xNextHead, xFirstLength;
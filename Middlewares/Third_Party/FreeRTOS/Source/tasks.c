@@ -2088,6 +2088,43 @@ void vTaskSuspendAll( void )
 		else
 		{
 			xReturn = xNextTaskUnblockTime - xTickCount;
+
+			#if( configTICKLESS_SLACK_TICKS > 0 )
+			{
+				/* Coalesce the wake times that fall within the slack window
+				following the next one, so that a single wake up serves them
+				all.  The delayed list is only walked when the scheduler is
+				suspended, as the tick interrupt could otherwise remove items
+				from it - the preliminary estimate made by the idle task without
+				the scheduler suspended is not extended. */
+				if( ( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE ) && ( listLIST_IS_EMPTY( pxDelayedTaskList ) == pdFALSE ) )
+				{
+				const ListItem_t *pxItem = listGET_HEAD_ENTRY( pxDelayedTaskList );
+				const ListItem_t * const pxEnd = listGET_END_MARKER( pxDelayedTaskList );
+				const TickType_t xNextIdleTime = xReturn;
+				TickType_t xItemIdleTime;
+
+					/* Items in pxDelayedTaskList are sorted and have not
+					overflowed with respect to xTickCount. */
+					while( pxItem != pxEnd )
+					{
+						xItemIdleTime = listGET_LIST_ITEM_VALUE( pxItem ) - xTickCount;
+
+						if( ( xItemIdleTime - xNextIdleTime ) > ( TickType_t ) configTICKLESS_SLACK_TICKS )
+						{
+							break;
+						}
+
+						xReturn = xItemIdleTime;
+						pxItem = listGET_NEXT( pxItem );
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configTICKLESS_SLACK_TICKS */
 		}
 
 		return xReturn;
@@ -2493,12 +2530,37 @@ implementations require configUSE_TICKLESS_IDLE to be set to a value other than
 
 	void vTaskStepTick( const TickType_t xTicksToJump )
 	{
+	TickType_t xTicksToStep = xTicksToJump;
+	const TickType_t xTicksToNextUnblock = xNextTaskUnblockTime - xTickCount;
+
 		/* Correct the tick count value after a period during which the tick
 		was suppressed.  Note this does *not* call the tick hook function for
-		each stepped tick. */
-		configASSERT( ( xTickCount + xTicksToJump ) <= xNextTaskUnblockTime );
-		xTickCount += xTicksToJump;
-		traceINCREASE_TICK_COUNT( xTicksToJump );
+		each stepped tick.  The sleep can end on or after the next unblock
+		time, when wake times were coalesced (configTICKLESS_SLACK_TICKS) or
+		when the low power timebase woke up late.  The tick count is then only
+		stepped to one less than the unblock time, and the remaining ticks are
+		pended so that xTaskResumeAll() processes them one by one, unblocking
+		the tasks in order. */
+		if( xTicksToStep >= xTicksToNextUnblock )
+		{
+			if( xTicksToNextUnblock > ( TickType_t ) 0 )
+			{
+				xTicksToStep = xTicksToNextUnblock - ( TickType_t ) 1;
+			}
+			else
+			{
+				xTicksToStep = 0;
+			}
+
+			uxPendedTicks += ( UBaseType_t ) ( xTicksToJump - xTicksToStep );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		xTickCount += xTicksToStep;
+		traceINCREASE_TICK_COUNT( xTicksToStep );
 	}
 
 #endif /* configUSE_TICKLESS_IDLE */
@@ -3350,6 +3412,13 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
 			/* A yield was pended while the scheduler was suspended. */
 			eReturn = eAbortSleep;
 		}
+		else if( uxPendedTicks != ( UBaseType_t ) 0U )
+		{
+			/* A tick interrupt occurred while the scheduler was suspended, so
+			the expected idle time passed to portSUPPRESS_TICKS_AND_SLEEP() is
+			one tick too long. */
+			eReturn = eAbortSleep;
+		}
 		else
 		{
 			/* If all the tasks are in the suspended list (which might mean they
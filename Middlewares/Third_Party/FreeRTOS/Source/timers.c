@@ -64,6 +64,50 @@ defining trmTIMER_SERVICE_TASK_NAME in FreeRTOSConfig.h. */
 	#define configTIMER_SERVICE_TASK_NAME "Tmr Svc"
 #endif
 
+#if( configUSE_TIMER_WHEEL == 1 )
+
+	/* Geometry of the timing wheel: configTIMER_WHEEL_LEVELS levels of
+	2^configTIMER_WHEEL_SLOT_BITS slots.  A slot of level n spans
+	2^( n * configTIMER_WHEEL_SLOT_BITS ) ticks.  Timers further away than the
+	wheel range wait in the last slot of the top level and are placed again
+	when that slot is reached. */
+	#ifndef configTIMER_WHEEL_SLOT_BITS
+		#define configTIMER_WHEEL_SLOT_BITS		4
+	#endif
+
+	#ifndef configTIMER_WHEEL_LEVELS
+		#define configTIMER_WHEEL_LEVELS		4
+	#endif
+
+	#if( ( configTIMER_WHEEL_SLOT_BITS < 1 ) || ( configTIMER_WHEEL_SLOT_BITS > 5 ) )
+		#error configTIMER_WHEEL_SLOT_BITS must be between 1 and 5.
+	#endif
+
+	#if( configUSE_16_BIT_TICKS == 1 )
+		#if( ( configTIMER_WHEEL_SLOT_BITS * configTIMER_WHEEL_LEVELS ) > 16 )
+			#error The timing wheel cannot span more than the 16 bit tick count.
+		#endif
+	#else
+		#if( ( configTIMER_WHEEL_SLOT_BITS * configTIMER_WHEEL_LEVELS ) > 32 )
+			#error The timing wheel cannot span more than the 32 bit tick count.
+		#endif
+	#endif
+
+	#define tmrWHEEL_SLOTS			( ( UBaseType_t ) 1U << configTIMER_WHEEL_SLOT_BITS )
+	#define tmrWHEEL_SLOT_MASK		( tmrWHEEL_SLOTS - ( UBaseType_t ) 1U )
+	#define tmrWHEEL_SHIFT( uxLevel )	( ( UBaseType_t ) ( uxLevel ) * ( UBaseType_t ) configTIMER_WHEEL_SLOT_BITS )
+
+	/* Commands sent by the timer service task to itself, from a timer
+	callback, are executed straight away rather than posted to the timer
+	queue.  That needs the handle of the running task. */
+	#if( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) )
+		#define tmrDIRECT_COMMANDS		1
+	#else
+		#define tmrDIRECT_COMMANDS		0
+	#endif
+
+#endif /* configUSE_TIMER_WHEEL */
+
 /* The definition of the timers themselves. */
 typedef struct tmrTimerControl
 {
@@ -128,10 +172,27 @@ which static variables must be declared volatile. */
 /* The list in which active timers are stored.  Timers are referenced in expire
 time order, with the nearest expiry time at the front of the list.  Only the
 timer service task is allowed to access these lists. */
-PRIVILEGED_DATA static List_t xActiveTimerList1 = {0};
-PRIVILEGED_DATA static List_t xActiveTimerList2 = {0};
-PRIVILEGED_DATA static List_t *pxCurrentTimerList = NULL;
-PRIVILEGED_DATA static List_t *pxOverflowTimerList = NULL;
+#if( configUSE_TIMER_WHEEL == 0 )
+
+	PRIVILEGED_DATA static List_t xActiveTimerList1 = {0};
+	PRIVILEGED_DATA static List_t xActiveTimerList2 = {0};
+	PRIVILEGED_DATA static List_t *pxCurrentTimerList = NULL;
+	PRIVILEGED_DATA static List_t *pxOverflowTimerList = NULL;
+
+#else
+
+	/* With the timing wheel, active timers are instead referenced from the
+	slot of the wheel that matches their expiry time, in no particular order,
+	or from xDueTimerList once their expiry time has been reached.
+	xWheelTime is the tick count up to which the wheel has been processed, and
+	ulWheelOccupied[] has one bit set per non empty slot.  Only the timer
+	service task is allowed to access these. */
+	PRIVILEGED_DATA static List_t xTimerWheel[ configTIMER_WHEEL_LEVELS ][ tmrWHEEL_SLOTS ];
+	PRIVILEGED_DATA static uint32_t ulWheelOccupied[ configTIMER_WHEEL_LEVELS ] = {0};
+	PRIVILEGED_DATA static List_t xDueTimerList = {0};
+	PRIVILEGED_DATA static TickType_t xWheelTime = ( TickType_t ) 0U;
+
+#endif /* configUSE_TIMER_WHEEL */
 
 /* A queue that is used to send commands to the timer service task. */
 PRIVILEGED_DATA static QueueHandle_t xTimerQueue = NULL;
@@ -171,42 +232,91 @@ static void prvTimerTask( void *pvParameters ) PRIVILEGED_FUNCTION;
 static void prvProcessReceivedCommands( void ) PRIVILEGED_FUNCTION;
 
 /*
- * Insert the timer into either xActiveTimerList1, or xActiveTimerList2,
- * depending on if the expire time causes a timer counter overflow.
- */
-static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime ) PRIVILEGED_FUNCTION;
-
-/*
- * An active timer has reached its expire time.  Reload the timer if it is an
- * auto reload timer, then call its callback.
+ * Apply a start, reset, stop, change period or delete command to a timer.
  */
-static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
-
-/*
- * The tick count has overflowed.  Switch the timer lists after ensuring the
- * current timer list does not still reference some timers.
- */
-static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
-
-/*
- * Obtain the current tick count, setting *pxTimerListsWereSwitched to pdTRUE
- * if a tick count overflow occurred since prvSampleTimeNow() was last called.
- */
-static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched ) PRIVILEGED_FUNCTION;
-
-/*
- * If the timer list contains any active timers then return the expire time of
- * the timer that will expire first and set *pxListWasEmpty to false.  If the
- * timer list does not contain any timers then return 0 and set *pxListWasEmpty
- * to pdTRUE.
- */
-static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty ) PRIVILEGED_FUNCTION;
-
-/*
- * If a timer has expired, process it.  Otherwise, block the timer service task
- * until either a timer does expire or a command is received.
- */
-static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty ) PRIVILEGED_FUNCTION;
+static void prvProcessTimerCommand( const DaemonTaskMessage_t * const pxMessage ) PRIVILEGED_FUNCTION;
+
+#if( configUSE_TIMER_WHEEL == 0 )
+
+	/*
+	 * Insert the timer into either xActiveTimerList1, or xActiveTimerList2,
+	 * depending on if the expire time causes a timer counter overflow.
+	 */
+	static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * An active timer has reached its expire time.  Reload the timer if it is an
+	 * auto reload timer, then call its callback.
+	 */
+	static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * The tick count has overflowed.  Switch the timer lists after ensuring the
+	 * current timer list does not still reference some timers.
+	 */
+	static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Obtain the current tick count, setting *pxTimerListsWereSwitched to pdTRUE
+	 * if a tick count overflow occurred since prvSampleTimeNow() was last called.
+	 */
+	static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * If the timer list contains any active timers then return the expire time of
+	 * the timer that will expire first and set *pxListWasEmpty to false.  If the
+	 * timer list does not contain any timers then return 0 and set *pxListWasEmpty
+	 * to pdTRUE.
+	 */
+	static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * If a timer has expired, process it.  Otherwise, block the timer service task
+	 * until either a timer does expire or a command is received.
+	 */
+	static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty ) PRIVILEGED_FUNCTION;
+
+#else
+
+	/*
+	 * Make a timer expire xCommandTime + period ticks.  The timer is referenced
+	 * from the wheel slot matching its expiry time, or from xDueTimerList if
+	 * the expiry time has already been reached.  Constant time.
+	 */
+	static void prvWheelInsert( Timer_t * const pxTimer, const TickType_t xCommandTime ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Reference a timer, whose list item value holds the expiry time, from the
+	 * right slot relative to xWheelTime.  Constant time.
+	 */
+	static void prvWheelPlace( Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Remove a timer from the wheel or from xDueTimerList, if it is in one of
+	 * them.  Constant time.
+	 */
+	static void prvWheelRemove( Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Return the number of ticks after xWheelTime at which a timer expires or a
+	 * slot has to be spread over the lower levels, 0 if timers are already due.
+	 * *pxWheelWasEmpty is set to pdTRUE if there are no active timers.
+	 */
+	static TickType_t prvWheelGetNextEvent( BaseType_t * const pxWheelWasEmpty ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Move the wheel forward to xTimeNow, calling the callbacks of the timers
+	 * that expire on the way in expiry time order.
+	 */
+	static void prvWheelAdvance( const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * If a timer has expired, process it.  Otherwise, block the timer service task
+	 * until either a timer does expire or a command is received.
+	 */
+	static void prvWheelProcessOrBlockTask( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TIMER_WHEEL */
 
 /*
  * Called after a Timer_t structure has been allocated either statically or
@@ -394,6 +504,18 @@ DaemonTaskMessage_t xMessage;
 		xMessage.u.xTimerParameters.xMessageValue = xOptionalValue;
 		xMessage.u.xTimerParameters.pxTimer = ( Timer_t * ) xTimer;
 
+		#if( ( configUSE_TIMER_WHEEL == 1 ) && ( tmrDIRECT_COMMANDS == 1 ) )
+		if( ( xCommandID < tmrFIRST_FROM_ISR_COMMAND ) && ( xTimerTaskHandle != NULL ) && ( xTaskGetCurrentTaskHandle() == xTimerTaskHandle ) )
+		{
+			/* Called from a timer callback, or from a pended function, in the
+			timer service task itself: the active timers can be updated
+			directly.  This saves a round trip through the timer queue, and the
+			command cannot fail because the queue is full. */
+			prvProcessTimerCommand( &xMessage );
+			xReturn = pdPASS;
+		}
+		else
+		#endif /* configUSE_TIMER_WHEEL */
 		if( xCommandID < tmrFIRST_FROM_ISR_COMMAND )
 		{
 			if( xTaskGetSchedulerState() == taskSCHEDULER_RUNNING )
@@ -459,6 +581,8 @@ Timer_t *pxTimer = ( Timer_t * ) xTimer;
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_TIMER_WHEEL == 0 )
+
 static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow )
 {
 BaseType_t xResult;
@@ -497,12 +621,16 @@ Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTi
 	/* Call the timer callback. */
 	pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
 }
+
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static void prvTimerTask( void *pvParameters )
 {
-TickType_t xNextExpireTime;
-BaseType_t xListWasEmpty;
+#if( configUSE_TIMER_WHEEL == 0 )
+	TickType_t xNextExpireTime;
+	BaseType_t xListWasEmpty;
+#endif
 
 	/* Just to avoid compiler warnings. */
 	( void ) pvParameters;
@@ -521,13 +649,23 @@ BaseType_t xListWasEmpty;
 
 	for( ;; )
 	{
-		/* Query the timers list to see if it contains any timers, and if so,
-		obtain the time at which the next timer will expire. */
-		xNextExpireTime = prvGetNextExpireTime( &xListWasEmpty );
+		#if( configUSE_TIMER_WHEEL == 0 )
+		{
+			/* Query the timers list to see if it contains any timers, and if so,
+			obtain the time at which the next timer will expire. */
+			xNextExpireTime = prvGetNextExpireTime( &xListWasEmpty );
 
-		/* If a timer has expired, process it.  Otherwise, block this task
-		until either a timer does expire, or a command is received. */
-		prvProcessTimerOrBlockTask( xNextExpireTime, xListWasEmpty );
+			/* If a timer has expired, process it.  Otherwise, block this task
+			until either a timer does expire, or a command is received. */
+			prvProcessTimerOrBlockTask( xNextExpireTime, xListWasEmpty );
+		}
+		#else
+		{
+			/* Process the timers that have expired, all of them, or block
+			this task until one does expire or a command is received. */
+			prvWheelProcessOrBlockTask();
+		}
+		#endif /* configUSE_TIMER_WHEEL */
 
 		/* Empty the command queue. */
 		prvProcessReceivedCommands();
@@ -535,6 +673,8 @@ BaseType_t xListWasEmpty;
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_TIMER_WHEEL == 0 )
+
 static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty )
 {
 TickType_t xTimeNow;
@@ -683,14 +823,289 @@ BaseType_t xProcessTimerNow = pdFALSE;
 
 	return xProcessTimerNow;
 }
+
+#else /* configUSE_TIMER_WHEEL */
+
+static void prvWheelInsert( Timer_t * const pxTimer, const TickType_t xCommandTime )
+{
+TickType_t xTimeNow, xWheelAge, xCommandAge;
+
+	listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xCommandTime + pxTimer->xTimerPeriodInTicks );
+	listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
+
+	/* Both the wheel time and the command time are at or before the current
+	time, so their ages give their order whatever the tick count overflows. */
+	xTimeNow = xTaskGetTickCount();
+	xWheelAge = ( TickType_t ) ( xTimeNow - xWheelTime );
+	xCommandAge = ( TickType_t ) ( xTimeNow - xCommandTime );
+
+	if( ( xCommandAge >= xWheelAge ) && ( ( TickType_t ) ( xCommandAge - xWheelAge ) >= pxTimer->xTimerPeriodInTicks ) )
+	{
+		/* The expiry time is already behind the wheel, for example because
+		the command was queued for longer than the timer period.  The timer
+		is processed as soon as the timer service task gets to it. */
+		vListInsertEnd( &xDueTimerList, &( pxTimer->xTimerListItem ) );
+	}
+	else
+	{
+		prvWheelPlace( pxTimer );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvWheelPlace( Timer_t * const pxTimer )
+{
+const TickType_t xExpiryTime = listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) );
+TickType_t xSlotDistance;
+UBaseType_t uxLevel, uxSlot;
+
+	if( xExpiryTime == xWheelTime )
+	{
+		vListInsertEnd( &xDueTimerList, &( pxTimer->xTimerListItem ) );
+		return;
+	}
+
+	/* Use the lowest level on which the expiry time is less than a turn of
+	the wheel away.  The slot is never the current slot of its level, which
+	has already been processed. */
+	for( uxLevel = 0; uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS; uxLevel++ )
+	{
+		xSlotDistance = ( TickType_t ) ( ( xExpiryTime >> tmrWHEEL_SHIFT( uxLevel ) ) - ( xWheelTime >> tmrWHEEL_SHIFT( uxLevel ) ) );
+		xSlotDistance &= ( TickType_t ) ( portMAX_DELAY >> tmrWHEEL_SHIFT( uxLevel ) );
+
+		if( xSlotDistance < ( TickType_t ) tmrWHEEL_SLOTS )
+		{
+			break;
+		}
+	}
+
+	if( uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS )
+	{
+		uxSlot = ( UBaseType_t ) ( xExpiryTime >> tmrWHEEL_SHIFT( uxLevel ) ) & tmrWHEEL_SLOT_MASK;
+	}
+	else
+	{
+		/* Beyond the range of the wheel: wait in the furthest slot of the top
+		level, the timer is placed again when that slot is reached. */
+		uxLevel = ( UBaseType_t ) configTIMER_WHEEL_LEVELS - ( UBaseType_t ) 1U;
+		uxSlot = ( ( UBaseType_t ) ( xWheelTime >> tmrWHEEL_SHIFT( uxLevel ) ) + tmrWHEEL_SLOT_MASK ) & tmrWHEEL_SLOT_MASK;
+	}
+
+	vListInsertEnd( &( xTimerWheel[ uxLevel ][ uxSlot ] ), &( pxTimer->xTimerListItem ) );
+	ulWheelOccupied[ uxLevel ] |= ( ( uint32_t ) 1U << uxSlot );
+}
+/*-----------------------------------------------------------*/
+
+static void prvWheelRemove( Timer_t * const pxTimer )
+{
+List_t * const pxList = ( List_t * ) listLIST_ITEM_CONTAINER( &( pxTimer->xTimerListItem ) );
+UBaseType_t uxIndex;
+
+	if( pxList != NULL )
+	{
+		if( ( uxListRemove( &( pxTimer->xTimerListItem ) ) == ( UBaseType_t ) 0U ) && ( pxList != &xDueTimerList ) )
+		{
+			/* The slot is now empty. */
+			uxIndex = ( UBaseType_t ) ( pxList - &( xTimerWheel[ 0 ][ 0 ] ) );
+			ulWheelOccupied[ uxIndex >> configTIMER_WHEEL_SLOT_BITS ] &= ~( ( uint32_t ) 1U << ( uxIndex & tmrWHEEL_SLOT_MASK ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static TickType_t prvWheelGetNextEvent( BaseType_t * const pxWheelWasEmpty )
+{
+TickType_t xNextEvent = portMAX_DELAY, xEvent;
+UBaseType_t uxLevel, uxCurrentSlot, uxDistance;
+uint32_t ulOccupied;
+
+	*pxWheelWasEmpty = pdTRUE;
+
+	if( listLIST_IS_EMPTY( &xDueTimerList ) == pdFALSE )
+	{
+		*pxWheelWasEmpty = pdFALSE;
+		return ( TickType_t ) 0U;
+	}
+
+	for( uxLevel = 0; uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS; uxLevel++ )
+	{
+		ulOccupied = ulWheelOccupied[ uxLevel ];
+
+		if( ulOccupied != 0U )
+		{
+			*pxWheelWasEmpty = pdFALSE;
+
+			/* Distance, in slots of this level, to the next non empty slot.
+			The current slot is empty so at most tmrWHEEL_SLOTS - 1. */
+			uxCurrentSlot = ( UBaseType_t ) ( xWheelTime >> tmrWHEEL_SHIFT( uxLevel ) ) & tmrWHEEL_SLOT_MASK;
+			for( uxDistance = 1; uxDistance < tmrWHEEL_SLOTS; uxDistance++ )
+			{
+				if( ( ulOccupied & ( ( uint32_t ) 1U << ( ( uxCurrentSlot + uxDistance ) & tmrWHEEL_SLOT_MASK ) ) ) != 0U )
+				{
+					break;
+				}
+			}
+
+			/* The slot is reached at the start of its time span. */
+			xEvent = ( TickType_t ) ( ( TickType_t ) uxDistance << tmrWHEEL_SHIFT( uxLevel ) );
+			xEvent -= ( TickType_t ) ( xWheelTime & ( TickType_t ) ( ( ( TickType_t ) 1U << tmrWHEEL_SHIFT( uxLevel ) ) - ( TickType_t ) 1U ) );
+
+			if( xEvent < xNextEvent )
+			{
+				xNextEvent = xEvent;
+			}
+		}
+	}
+
+	return xNextEvent;
+}
+/*-----------------------------------------------------------*/
+
+static void prvWheelAdvance( const TickType_t xTimeNow )
+{
+TickType_t xNextEvent;
+BaseType_t xWheelWasEmpty;
+UBaseType_t uxLevel, uxSlot;
+List_t *pxSlot;
+Timer_t *pxTimer;
+
+	for( ;; )
+	{
+		/* Process the timers that have reached their expiry time.  A timer is
+		removed from xDueTimerList before its callback runs, so the callback
+		can restart, stop or delete any timer, itself included. */
+		while( listLIST_IS_EMPTY( &xDueTimerList ) == pdFALSE )
+		{
+			pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( &xDueTimerList );
+			( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+			traceTIMER_EXPIRED( pxTimer );
+
+			if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
+			{
+				/* Reload relative to the expiry time, so the period does not
+				drift.  If the timer service task is late the timer can
+				already be due again, in which case it is processed again
+				in this loop. */
+				prvWheelInsert( pxTimer, listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) ) );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+		}
+
+		xNextEvent = prvWheelGetNextEvent( &xWheelWasEmpty );
+		if( ( xWheelWasEmpty != pdFALSE ) || ( xNextEvent > ( TickType_t ) ( xTimeNow - xWheelTime ) ) )
+		{
+			/* Nothing happens up to xTimeNow, the empty slots in between do
+			not need to be visited. */
+			xWheelTime = xTimeNow;
+			break;
+		}
+
+		xWheelTime += xNextEvent;
+
+		/* Spread the slots reached on the upper levels over the lower levels,
+		top level first, then collect the timers expiring now. */
+		for( uxLevel = ( UBaseType_t ) configTIMER_WHEEL_LEVELS - ( UBaseType_t ) 1U; uxLevel > ( UBaseType_t ) 0U; uxLevel-- )
+		{
+			if( ( xWheelTime & ( TickType_t ) ( ( ( TickType_t ) 1U << tmrWHEEL_SHIFT( uxLevel ) ) - ( TickType_t ) 1U ) ) == ( TickType_t ) 0U )
+			{
+				uxSlot = ( UBaseType_t ) ( xWheelTime >> tmrWHEEL_SHIFT( uxLevel ) ) & tmrWHEEL_SLOT_MASK;
+				pxSlot = &( xTimerWheel[ uxLevel ][ uxSlot ] );
+
+				while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+				{
+					pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxSlot );
+					( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+					prvWheelPlace( pxTimer );
+				}
+
+				ulWheelOccupied[ uxLevel ] &= ~( ( uint32_t ) 1U << uxSlot );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		uxSlot = ( UBaseType_t ) xWheelTime & tmrWHEEL_SLOT_MASK;
+		pxSlot = &( xTimerWheel[ 0 ][ uxSlot ] );
+
+		while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+		{
+			pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxSlot );
+			( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+			vListInsertEnd( &xDueTimerList, &( pxTimer->xTimerListItem ) );
+		}
+
+		ulWheelOccupied[ 0 ] &= ~( ( uint32_t ) 1U << uxSlot );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvWheelProcessOrBlockTask( void )
+{
+TickType_t xTimeNow, xNextEvent;
+BaseType_t xWheelWasEmpty;
+
+	xNextEvent = prvWheelGetNextEvent( &xWheelWasEmpty );
+
+	vTaskSuspendAll();
+	{
+		xTimeNow = xTaskGetTickCount();
+
+		if( ( xWheelWasEmpty == pdFALSE ) && ( ( TickType_t ) ( xTimeNow - xWheelTime ) >= xNextEvent ) )
+		{
+			( void ) xTaskResumeAll();
+			prvWheelAdvance( xTimeNow );
+		}
+		else
+		{
+			if( xWheelWasEmpty != pdFALSE )
+			{
+				/* Keep the wheel time close to the tick count while there are
+				no active timers. */
+				xWheelTime = xTimeNow;
+				xNextEvent = portMAX_DELAY;
+			}
+			else
+			{
+				xNextEvent -= ( TickType_t ) ( xTimeNow - xWheelTime );
+			}
+
+			vQueueWaitForMessageRestricted( xTimerQueue, xNextEvent, xWheelWasEmpty );
+
+			if( xTaskResumeAll() == pdFALSE )
+			{
+				/* Yield to wait for either a command to arrive, or the block
+				time to expire. */
+				portYIELD_WITHIN_API();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+}
+
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static void	prvProcessReceivedCommands( void )
 {
 DaemonTaskMessage_t xMessage;
-Timer_t *pxTimer;
-BaseType_t xTimerListsWereSwitched, xResult;
-TickType_t xTimeNow;
 
 	while( xQueueReceive( xTimerQueue, &xMessage, tmrNO_DELAY ) != pdFAIL ) /*lint !e603 xMessage does not have to be initialised as it is passed out, not in, and it is not used unless xQueueReceive() returns pdTRUE. */
 	{
@@ -720,118 +1135,163 @@ TickType_t xTimeNow;
 		function calls. */
 		if( xMessage.xMessageID >= ( BaseType_t ) 0 )
 		{
-			/* The messages uses the xTimerParameters member to work on a
-			software timer. */
-			pxTimer = xMessage.u.xTimerParameters.pxTimer;
+			prvProcessTimerCommand( &xMessage );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
 
-			if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE ) /*lint !e961. The cast is only redundant when NULL is passed into the macro. */
-			{
-				/* The timer is in a list, remove it. */
-				( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
-			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
+static void prvProcessTimerCommand( const DaemonTaskMessage_t * const pxMessage )
+{
+Timer_t *pxTimer;
 
-			traceTIMER_COMMAND_RECEIVED( pxTimer, xMessage.xMessageID, xMessage.u.xTimerParameters.xMessageValue );
+#if( configUSE_TIMER_WHEEL == 0 )
+	BaseType_t xTimerListsWereSwitched, xResult;
+	TickType_t xTimeNow;
+#endif
 
-			/* In this case the xTimerListsWereSwitched parameter is not used, but
-			it must be present in the function call.  prvSampleTimeNow() must be
-			called after the message is received from xTimerQueue so there is no
-			possibility of a higher priority task adding a message to the message
-			queue with a time that is ahead of the timer daemon task (because it
-			pre-empted the timer daemon task after the xTimeNow value was set). */
-			xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
+	/* The messages uses the xTimerParameters member to work on a
+	software timer. */
+	pxTimer = pxMessage->u.xTimerParameters.pxTimer;
 
-			switch( xMessage.xMessageID )
-			{
-				case tmrCOMMAND_START :
-			    case tmrCOMMAND_START_FROM_ISR :
-			    case tmrCOMMAND_RESET :
-			    case tmrCOMMAND_RESET_FROM_ISR :
-				case tmrCOMMAND_START_DONT_TRACE :
-					/* Start or restart a timer. */
-					if( prvInsertTimerInActiveList( pxTimer,  xMessage.u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow, xMessage.u.xTimerParameters.xMessageValue ) != pdFALSE )
-					{
-						/* The timer expired before it was added to the active
-						timer list.  Process it now. */
-						pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
-						traceTIMER_EXPIRED( pxTimer );
-
-						if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
-						{
-							xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xMessage.u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, NULL, tmrNO_DELAY );
-							configASSERT( xResult );
-							( void ) xResult;
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-					break;
+	#if( configUSE_TIMER_WHEEL == 0 )
+	{
+		if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE ) /*lint !e961. The cast is only redundant when NULL is passed into the macro. */
+		{
+			/* The timer is in a list, remove it. */
+			( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#else
+	{
+		prvWheelRemove( pxTimer );
+	}
+	#endif /* configUSE_TIMER_WHEEL */
 
-				case tmrCOMMAND_STOP :
-				case tmrCOMMAND_STOP_FROM_ISR :
-					/* The timer has already been removed from the active list.
-					There is nothing to do here. */
-					break;
+	traceTIMER_COMMAND_RECEIVED( pxTimer, pxMessage->xMessageID, pxMessage->u.xTimerParameters.xMessageValue );
 
-				case tmrCOMMAND_CHANGE_PERIOD :
-				case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR :
-					pxTimer->xTimerPeriodInTicks = xMessage.u.xTimerParameters.xMessageValue;
-					configASSERT( ( pxTimer->xTimerPeriodInTicks > 0 ) );
-
-					/* The new period does not really have a reference, and can
-					be longer or shorter than the old one.  The command time is
-					therefore set to the current time, and as the period cannot
-					be zero the next expiry time can only be in the future,
-					meaning (unlike for the xTimerStart() case above) there is
-					no fail case that needs to be handled here. */
-					( void ) prvInsertTimerInActiveList( pxTimer, ( xTimeNow + pxTimer->xTimerPeriodInTicks ), xTimeNow, xTimeNow );
-					break;
+	#if( configUSE_TIMER_WHEEL == 0 )
+	{
+		/* In this case the xTimerListsWereSwitched parameter is not used, but
+		it must be present in the function call.  prvSampleTimeNow() must be
+		called after the message is received from xTimerQueue so there is no
+		possibility of a higher priority task adding a message to the message
+		queue with a time that is ahead of the timer daemon task (because it
+		pre-empted the timer daemon task after the xTimeNow value was set). */
+		xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
+	}
+	#endif /* configUSE_TIMER_WHEEL */
 
-				case tmrCOMMAND_DELETE :
-					/* The timer has already been removed from the active list,
-					just free up the memory if the memory was dynamically
-					allocated. */
-					#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+	switch( pxMessage->xMessageID )
+	{
+		case tmrCOMMAND_START :
+	    case tmrCOMMAND_START_FROM_ISR :
+	    case tmrCOMMAND_RESET :
+	    case tmrCOMMAND_RESET_FROM_ISR :
+		case tmrCOMMAND_START_DONT_TRACE :
+			/* Start or restart a timer. */
+			#if( configUSE_TIMER_WHEEL == 0 )
+			{
+				if( prvInsertTimerInActiveList( pxTimer,  pxMessage->u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow, pxMessage->u.xTimerParameters.xMessageValue ) != pdFALSE )
+				{
+					/* The timer expired before it was added to the active
+					timer list.  Process it now. */
+					pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+					traceTIMER_EXPIRED( pxTimer );
+
+					if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
 					{
-						/* The timer can only have been allocated dynamically -
-						free it again. */
-						vPortFree( pxTimer );
+						xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, pxMessage->u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, NULL, tmrNO_DELAY );
+						configASSERT( xResult );
+						( void ) xResult;
 					}
-					#elif( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+					else
 					{
-						/* The timer could have been allocated statically or
-						dynamically, so check before attempting to free the
-						memory. */
-						if( pxTimer->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
-						{
-							vPortFree( pxTimer );
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
+						mtCOVERAGE_TEST_MARKER();
 					}
-					#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
-					break;
-
-				default	:
-					/* Don't expect to get here. */
-					break;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
-		}
+			#else
+			{
+				/* A timer that expired before the command was processed is
+				due, its callback is called from prvWheelAdvance(). */
+				prvWheelInsert( pxTimer, pxMessage->u.xTimerParameters.xMessageValue );
+			}
+			#endif /* configUSE_TIMER_WHEEL */
+			break;
+
+		case tmrCOMMAND_STOP :
+		case tmrCOMMAND_STOP_FROM_ISR :
+			/* The timer has already been removed from the active list.
+			There is nothing to do here. */
+			break;
+
+		case tmrCOMMAND_CHANGE_PERIOD :
+		case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR :
+			pxTimer->xTimerPeriodInTicks = pxMessage->u.xTimerParameters.xMessageValue;
+			configASSERT( ( pxTimer->xTimerPeriodInTicks > 0 ) );
+
+			/* The new period does not really have a reference, and can
+			be longer or shorter than the old one.  The command time is
+			therefore set to the current time, and as the period cannot
+			be zero the next expiry time can only be in the future,
+			meaning (unlike for the xTimerStart() case above) there is
+			no fail case that needs to be handled here. */
+			#if( configUSE_TIMER_WHEEL == 0 )
+			{
+				( void ) prvInsertTimerInActiveList( pxTimer, ( xTimeNow + pxTimer->xTimerPeriodInTicks ), xTimeNow, xTimeNow );
+			}
+			#else
+			{
+				prvWheelInsert( pxTimer, xTaskGetTickCount() );
+			}
+			#endif /* configUSE_TIMER_WHEEL */
+			break;
+
+		case tmrCOMMAND_DELETE :
+			/* The timer has already been removed from the active list,
+			just free up the memory if the memory was dynamically
+			allocated. */
+			#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+			{
+				/* The timer can only have been allocated dynamically -
+				free it again. */
+				vPortFree( pxTimer );
+			}
+			#elif( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+			{
+				/* The timer could have been allocated statically or
+				dynamically, so check before attempting to free the
+				memory. */
+				if( pxTimer->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+				{
+					vPortFree( pxTimer );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+			break;
+
+		default	:
+			/* Don't expect to get here. */
+			break;
 	}
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_TIMER_WHEEL == 0 )
+
 static void prvSwitchTimerLists( void )
 {
 TickType_t xNextExpireTime, xReloadTime;
@@ -889,6 +1349,8 @@ BaseType_t xResult;
 	pxCurrentTimerList = pxOverflowTimerList;
 	pxOverflowTimerList = pxTemp;
 }
+
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static void prvCheckForValidListAndQueue( void )
@@ -900,10 +1362,27 @@ static void prvCheckForValidListAndQueue( void )
 	{
 		if( xTimerQueue == NULL )
 		{
-			vListInitialise( &xActiveTimerList1 );
-			vListInitialise( &xActiveTimerList2 );
-			pxCurrentTimerList = &xActiveTimerList1;
-			pxOverflowTimerList = &xActiveTimerList2;
+			#if( configUSE_TIMER_WHEEL == 0 )
+			{
+				vListInitialise( &xActiveTimerList1 );
+				vListInitialise( &xActiveTimerList2 );
+				pxCurrentTimerList = &xActiveTimerList1;
+				pxOverflowTimerList = &xActiveTimerList2;
+			}
+			#else
+			{
+			UBaseType_t uxLevel, uxSlot;
+
+				for( uxLevel = 0; uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS; uxLevel++ )
+				{
+					for( uxSlot = 0; uxSlot < tmrWHEEL_SLOTS; uxSlot++ )
+					{
+						vListInitialise( &( xTimerWheel[ uxLevel ][ uxSlot ] ) );
+					}
+				}
+				vListInitialise( &xDueTimerList );
+			}
+			#endif /* configUSE_TIMER_WHEEL */
 
 			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
 			{
@@ -176,6 +176,17 @@ provided in this demo can be extended to save even more power. */
 #define configPOST_SLEEP_PROCESSING                       PostSleepProcessing
 #endif /* configUSE_TICKLESS_IDLE == 1 */
 
+/* With the GCC port the tickless idle mode is timed by the RTC sub-second
+counter (see freertos_lp_timebase_rtc.c), which keeps counting in STOP mode:
+the MCU is then placed into STOP mode instead of sleep mode. */
+#if defined(__GNUC__) && !defined(__CC_ARM) && !defined(__ARMCC_VERSION)
+#define configUSE_TICKLESS_LP_TIMEBASE                    1
+#define configLP_TIMEBASE_CLOCK_HZ                        16384
+#define configLP_TIMEBASE_COUNTER_MASK                    0x3FFF
+#else
+#define configUSE_TICKLESS_LP_TIMEBASE                    0
+#endif
+
 /* IMPORTANT: This define MUST be commented when used with STM32Cube firmware,
               to prevent overwriting SysTick_Handler defined within STM32Cube HAL */
 /* #define xPortSysTickHandler SysTick_Handler */
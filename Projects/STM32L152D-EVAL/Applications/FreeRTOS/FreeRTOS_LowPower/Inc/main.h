@@ -33,6 +33,7 @@ extern "C" {
 /* Exported constants --------------------------------------------------------*/
 /* Exported macro ------------------------------------------------------------*/
 /* Exported functions ------------------------------------------------------- */
+void RTC_LPTimebase_Config(void);
 
 #ifdef __cplusplus
 }
@@ -37,6 +37,7 @@ void BusFault_Handler(void);
 void UsageFault_Handler(void);
 void DebugMon_Handler(void);
 void SysTick_Handler(void);
+void RTC_Alarm_IRQHandler(void);
 
 #ifdef __cplusplus
 }
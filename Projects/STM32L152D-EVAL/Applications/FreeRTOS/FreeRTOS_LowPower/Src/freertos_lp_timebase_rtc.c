@@ -0,0 +1,210 @@
+/**
+  ******************************************************************************
+  * @file    FreeRTOS\FreeRTOS_LowPower\Src\freertos_lp_timebase_rtc.c
+  * @author  MCD Application Team
+  * @brief   FreeRTOS tickless idle low power timebase based on the RTC.
+  *
+  *          This file implements the low power counter used by the GCC
+  *          ARM_CM3 port when configUSE_TICKLESS_LP_TIMEBASE is 1:
+  *           + The RTC sub-second counter, clocked by the LSE, is the free
+  *             running counter: it keeps counting in STOP mode where the
+  *             SysTick is stopped
+  *           + The RTC Alarm A, matching on the sub-seconds only, is the wake
+  *             up from STOP mode, through the EXTI line 17
+  *
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    (#) Add this file and the RTC HAL driver files to your project and make
+        sure HAL_RTC_MODULE_ENABLED is defined in stm32l1xx_hal_conf.h
+    (#) Define in FreeRTOSConfig.h:
+        configUSE_TICKLESS_LP_TIMEBASE to 1,
+        configLP_TIMEBASE_CLOCK_HZ to 16384,
+        configLP_TIMEBASE_COUNTER_MASK to 0x3FFF
+    (#) Call RTC_LPTimebase_Config() before the scheduler is started, and
+        HAL_RTC_AlarmIRQHandler() from RTC_Alarm_IRQHandler().
+
+    [..]
+    (@) The RTC asynchronous prescaler is set to 2 and the synchronous one to
+        16384, so the calendar still counts seconds from the 32768 Hz LSE and
+        the sub-second counter counts 16384 times per second.  A sleep lasts
+        at most half the counter range, 500 ms.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "cmsis_os.h"
+
+#if (configUSE_TICKLESS_IDLE == 1) && (configUSE_TICKLESS_LP_TIMEBASE == 1)
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* RTC prescalers: ck_apre = LSE / 2, ck_spre = ck_apre / 16384 = 1 Hz */
+#define RTC_LP_ASYNCH_PREDIV      1U
+#define RTC_LP_SYNCH_PREDIV       configLP_TIMEBASE_COUNTER_MASK
+
+/* Alarm A compares the 14 bits of the sub-second counter only */
+#define RTC_LP_ALARM_SS_MASK      (14U * RTC_ALRMASSR_MASKSS_0)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* RTC handler, also used by RTC_Alarm_IRQHandler() */
+RTC_HandleTypeDef RtcHandle;
+
+/* Private function prototypes -----------------------------------------------*/
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Configures the RTC as the low power timebase of the tickless idle
+  *         mode.
+  * @note   To be called before the scheduler is started.
+  * @param  None
+  * @retval None
+  */
+void RTC_LPTimebase_Config(void)
+{
+  RtcHandle.Instance = RTC;
+  RtcHandle.Init.HourFormat     = RTC_HOURFORMAT_24;
+  RtcHandle.Init.AsynchPrediv   = RTC_LP_ASYNCH_PREDIV;
+  RtcHandle.Init.SynchPrediv    = RTC_LP_SYNCH_PREDIV;
+  RtcHandle.Init.OutPut         = RTC_OUTPUT_DISABLE;
+  RtcHandle.Init.OutPutPolarity = RTC_OUTPUT_POLARITY_HIGH;
+  RtcHandle.Init.OutPutType     = RTC_OUTPUT_TYPE_OPENDRAIN;
+  if (HAL_RTC_Init(&RtcHandle) != HAL_OK)
+  {
+    /* Initialization Error */
+    while(1);
+  }
+
+  /* Read the sub-second counter directly instead of through the shadow
+     registers, which are only updated every two RTCCLK periods and stay
+     locked until the date register is read */
+  HAL_RTCEx_EnableBypassShadow(&RtcHandle);
+
+  /* The alarm wakes the MCU up from STOP mode through the EXTI line 17 */
+  __HAL_RTC_ALARM_EXTI_ENABLE_IT();
+  __HAL_RTC_ALARM_EXTI_ENABLE_RISING_EDGE();
+
+  HAL_NVIC_SetPriority(RTC_Alarm_IRQn, configLIBRARY_LOWEST_INTERRUPT_PRIORITY, 0U);
+  HAL_NVIC_EnableIRQ(RTC_Alarm_IRQn);
+}
+
+/**
+  * @brief  RTC MSP Initialization: LSE as the RTC clock source.
+  * @param  hrtc: RTC handle pointer
+  * @retval None
+  */
+void HAL_RTC_MspInit(RTC_HandleTypeDef *hrtc)
+{
+  RCC_OscInitTypeDef        RCC_OscInitStruct = {0};
+  RCC_PeriphCLKInitTypeDef  PeriphClkInitStruct = {0};
+
+  /* Enable write access to the backup domain */
+  __HAL_RCC_PWR_CLK_ENABLE();
+  HAL_PWR_EnableBkUpAccess();
+
+  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_LSE;
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_NONE;
+  RCC_OscInitStruct.LSEState = RCC_LSE_ON;
+  if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
+  {
+    /* Initialization Error */
+    while(1);
+  }
+
+  PeriphClkInitStruct.PeriphClockSelection = RCC_PERIPHCLK_RTC;
+  PeriphClkInitStruct.RTCClockSelection = RCC_RTCCLKSOURCE_LSE;
+  if (HAL_RCCEx_PeriphCLKConfig(&PeriphClkInitStruct) != HAL_OK)
+  {
+    /* Initialization Error */
+    while(1);
+  }
+
+  /* Enable RTC Clock */
+  __HAL_RCC_RTC_ENABLE();
+}
+
+/**
+  * @brief  Returns the low power counter: the RTC sub-second counter, which
+  *         counts down, turned into an up counter.
+  * @note   Called by the kernel with interrupts enabled or disabled.
+  * @param  None
+  * @retval Counter value, between 0 and configLP_TIMEBASE_COUNTER_MASK
+  */
+uint32_t ulPortLPTimebaseGetCount(void)
+{
+  uint32_t subseconds;
+
+  /* With the shadow registers bypassed the counter can be read while it
+     changes: read it until two reads agree */
+  do
+  {
+    subseconds = RtcHandle.Instance->SSR;
+  } while (subseconds != RtcHandle.Instance->SSR);
+
+  return (configLP_TIMEBASE_COUNTER_MASK - subseconds) & configLP_TIMEBASE_COUNTER_MASK;
+}
+
+/**
+  * @brief  Arms the RTC Alarm A for when the low power counter reaches ulCount.
+  * @note   Called by the kernel with interrupts disabled.  The alarm was
+  *         disabled by vPortLPTimebaseClearWakeup() at the end of the previous
+  *         sleep, so the alarm registers are normally writable already.
+  * @param  ulCount: Counter value to wake up at
+  * @retval None
+  */
+void vPortLPTimebaseSetWakeup(uint32_t ulCount)
+{
+  __HAL_RTC_WRITEPROTECTION_DISABLE(&RtcHandle);
+
+  __HAL_RTC_ALARMA_DISABLE(&RtcHandle);
+  while (__HAL_RTC_ALARM_GET_FLAG(&RtcHandle, RTC_FLAG_ALRAWF) == RESET)
+  {
+  }
+
+  /* Match on the sub-seconds only, every second */
+  RtcHandle.Instance->ALRMAR = (RTC_ALRMAR_MSK4 | RTC_ALRMAR_MSK3 | RTC_ALRMAR_MSK2 | RTC_ALRMAR_MSK1);
+  RtcHandle.Instance->ALRMASSR = RTC_LP_ALARM_SS_MASK | (configLP_TIMEBASE_COUNTER_MASK - ulCount);
+
+  __HAL_RTC_ALARM_CLEAR_FLAG(&RtcHandle, RTC_FLAG_ALRAF);
+  __HAL_RTC_ALARM_EXTI_CLEAR_FLAG();
+  __HAL_RTC_ALARM_ENABLE_IT(&RtcHandle, RTC_IT_ALRA);
+  __HAL_RTC_ALARMA_ENABLE(&RtcHandle);
+
+  __HAL_RTC_WRITEPROTECTION_ENABLE(&RtcHandle);
+}
+
+/**
+  * @brief  Disarms the RTC Alarm A and clears it if it is pending.
+  * @note   Called by the kernel with interrupts disabled.
+  * @param  None
+  * @retval None
+  */
+void vPortLPTimebaseClearWakeup(void)
+{
+  __HAL_RTC_WRITEPROTECTION_DISABLE(&RtcHandle);
+  __HAL_RTC_ALARM_DISABLE_IT(&RtcHandle, RTC_IT_ALRA);
+  __HAL_RTC_ALARMA_DISABLE(&RtcHandle);
+  __HAL_RTC_WRITEPROTECTION_ENABLE(&RtcHandle);
+
+  __HAL_RTC_ALARM_CLEAR_FLAG(&RtcHandle, RTC_FLAG_ALRAF);
+  __HAL_RTC_ALARM_EXTI_CLEAR_FLAG();
+  HAL_NVIC_ClearPendingIRQ(RTC_Alarm_IRQn);
+}
+
+#endif /* (configUSE_TICKLESS_IDLE == 1) && (configUSE_TICKLESS_LP_TIMEBASE == 1) */
@@ -92,6 +92,11 @@ int main(void)
   osThreadDef(TxThread, QueueSendThread, osPriorityBelowNormal, 0, configMINIMAL_STACK_SIZE);
   osThreadCreate(osThread(TxThread), NULL);
 
+#if (configUSE_TICKLESS_LP_TIMEBASE == 1)
+  /* Configure the RTC that times the tickless idle mode in STOP mode */
+  RTC_LPTimebase_Config();
+#endif
+
   /* Start scheduler */
   osKernelStart();
 
@@ -171,8 +176,16 @@ void PreSleepProcessing(uint32_t * ulExpectedIdleTime)
   */
   *ulExpectedIdleTime = 0;
   
+#if (configUSE_TICKLESS_LP_TIMEBASE == 1)
+  /* The RTC keeps timing the sleep in STOP mode, where the timer of the HAL
+  time base does not count: suspend the HAL tick and enter STOP mode with the
+  low power regulator using the HAL function HAL_PWR_EnterSTOPMode */
+  HAL_SuspendTick();
+  HAL_PWR_EnterSTOPMode(PWR_LOWPOWERREGULATOR_ON, PWR_STOPENTRY_WFI);
+#else
   /*Enter to sleep Mode using the HAL function HAL_PWR_EnterSLEEPMode with WFI instruction*/
   HAL_PWR_EnterSLEEPMode(PWR_MAINREGULATOR_ON, PWR_SLEEPENTRY_WFI);  
+#endif
 }
 
 /**
@@ -187,6 +200,13 @@ void PostSleepProcessing(uint32_t * ulExpectedIdleTime)
 
   /* Avoid compiler warnings about the unused parameter. */
   (void) ulExpectedIdleTime;
+
+#if (configUSE_TICKLESS_LP_TIMEBASE == 1)
+  /* The MCU exits STOP mode running on the MSI: restore the 32 MHz system
+  clock the SysTick counts at, then the HAL tick */
+  SystemClock_Config();
+  HAL_ResumeTick();
+#endif
 }
 
 /**
@@ -26,6 +26,11 @@
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
 /* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+#if (configUSE_TICKLESS_LP_TIMEBASE == 1)
+/* RTC handler declared in "freertos_lp_timebase_rtc.c" file */
+extern RTC_HandleTypeDef RtcHandle;
+#endif
 /* Private function prototypes -----------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
 
@@ -120,6 +125,19 @@ void SysTick_Handler(void)
 /*  file (startup_stm32l1xx.s).                                               */
 /******************************************************************************/
 
+#if (configUSE_TICKLESS_LP_TIMEBASE == 1)
+/**
+  * @brief  This function handles RTC Alarm interrupt request, the wake up
+  *         of the tickless idle mode.
+  * @param  None
+  * @retval None
+  */
+void RTC_Alarm_IRQHandler(void)
+{
+  HAL_RTC_AlarmIRQHandler(&RtcHandle);
+}
+#endif /* configUSE_TICKLESS_LP_TIMEBASE == 1 */
+
 /**
   * @brief  This function handles PPP interrupt request.
   * @param  None
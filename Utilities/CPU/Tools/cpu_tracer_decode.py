@@ -0,0 +1,394 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 STMicroelectronics.
+# All rights reserved.
+#
+# This software is licensed under terms that can be found in the LICENSE file
+# in the root directory of this software component.
+# If no LICENSE file comes with this software, it is provided AS-IS.
+#
+"""Decoder of the cpu_tracer binary traces (TRC_Snapshot() or stream).
+
+Reconstructs from the recorded FreeRTOS events:
+  - the scheduling timeline: when each task runs, CPU time, context switches;
+  - the scheduling latencies: time from a task made ready to the task running,
+    the largest ones being listed with the task that was running meanwhile;
+  - the blocking periods, with the chain of tasks and objects the task waits
+    for (a task blocked on a mutex waits for the holder of the mutex, which
+    may itself be blocked...);
+  - the number of items of each queue, semaphore and mutex over time.
+
+Usage:
+  cpu_tracer_decode.py trace.bin                 summary and outliers
+  cpu_tracer_decode.py trace.bin --events        list of the decoded events
+  cpu_tracer_decode.py trace.bin --chrome t.json timeline for chrome://tracing
+                                                 or https://ui.perfetto.dev
+  cpu_tracer_decode.py trace.bin --depth-csv q.csv  queue depths over time
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+TRC_TRACE_MAGIC = 0x31435254
+TRC_MODE_STREAM = 2
+
+EV_NAMES = {
+    0x01: "TASK_CREATE", 0x02: "TASK_DELETE", 0x03: "TASK_SWITCH_IN",
+    0x04: "TASK_READY", 0x05: "TASK_DELAY", 0x06: "TASK_SUSPEND",
+    0x07: "TASK_RESUME", 0x08: "TASK_PRIORITY_SET", 0x09: "TASK_INHERIT",
+    0x0A: "TASK_DISINHERIT", 0x0B: "TASK_NOTIFY", 0x0C: "TASK_NOTIFY_BLOCK",
+    0x0D: "TICK", 0x10: "OBJECT_CREATE", 0x11: "OBJECT_DELETE",
+    0x12: "QUEUE_SEND", 0x13: "QUEUE_SEND_FAILED", 0x14: "QUEUE_RECEIVE",
+    0x15: "QUEUE_RECEIVE_FAILED", 0x16: "QUEUE_PEEK", 0x17: "BLOCK_SEND",
+    0x18: "BLOCK_RECEIVE", 0x19: "EVENT_GROUP_SET", 0x1A: "STREAM_SEND",
+    0x1B: "STREAM_RECEIVE", 0x30: "NAME", 0x31: "LOST",
+}
+EV_ISR = 0x80
+
+KIND_NAMES = ["queue", "mutex", "counting semaphore", "binary semaphore",
+              "recursive mutex", "event group", "stream buffer",
+              "message buffer"]
+KIND_MUTEX = (1, 4)
+KIND_QUEUES = (0, 1, 2, 3, 4)
+
+TASK_EVENTS = (0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A,
+               0x0B, 0x0C)
+
+
+class Trace(object):
+    """Parsed trace: header fields, tables and raw events."""
+
+    def __init__(self, data):
+        for endian in ("<", ">"):
+            if len(data) >= 36 and struct.unpack_from(endian + "I", data)[0] == TRC_TRACE_MAGIC:
+                break
+        else:
+            raise ValueError("not a cpu_tracer trace")
+        self.endian = endian
+        (_, self.version, size, self.freq, self.mode, task_count, object_count,
+         event_count, self.lost) = struct.unpack_from(endian + "9I", data)
+        if self.freq == 0:
+            raise ValueError("null timestamp frequency")
+        offset = 36
+        self.tasks = {}
+        for _ in range(task_count):
+            name, tid, prio = struct.unpack_from(endian + "16s2I", data, offset)
+            self.tasks[tid] = {"name": _cstr(name), "priority": prio}
+            offset += 24
+        self.objects = {}
+        for _ in range(object_count):
+            name, oid, kind, length = struct.unpack_from(endian + "16s3I", data, offset)
+            self.objects[oid] = {"name": _cstr(name), "kind": kind, "length": length}
+            offset += 28
+        if self.mode == TRC_MODE_STREAM:
+            event_count = (len(data) - offset) // 8
+        elif offset + 8 * event_count > len(data):
+            raise ValueError("truncated snapshot")
+        self.events = [struct.unpack_from(endian + "2I", data, offset + 8 * i)
+                       for i in range(event_count)]
+
+
+def _cstr(raw):
+    return raw.split(b"\0", 1)[0].decode("latin-1")
+
+
+class Decoder(object):
+    """Replays the events to rebuild the task and object states."""
+
+    def __init__(self, trace):
+        self.trace = trace
+        self.freq = float(trace.freq)
+        self.tasks = dict((k, dict(v)) for k, v in trace.tasks.items())
+        self.objects = dict((k, dict(v)) for k, v in trace.objects.items())
+        self.name_chunks = {}
+        self.records = []           # (time, code, isr, id, arg, current)
+        self.segments = []          # (task, start, end) running periods
+        self.latencies = []         # (latency, task, ready time, running task, isr)
+        self.blocks = []            # (duration, task, start, what, chain)
+        self.depths = {}            # object -> [(time, items)]
+        self.inversions = []        # (time, holder, priority)
+        self.lost = trace.lost
+        self.start = None
+        self.end = None
+        self._run()
+
+    # Names -----------------------------------------------------------------
+    def task_name(self, tid):
+        if tid in self.tasks and self.tasks[tid]["name"]:
+            return self.tasks[tid]["name"]
+        return "task#%d" % tid
+
+    def object_name(self, oid):
+        obj = self.objects.get(oid)
+        if obj is None:
+            return "object#%d" % oid
+        kind = KIND_NAMES[obj["kind"]] if obj["kind"] < len(KIND_NAMES) else "object"
+        return obj["name"] or "%s#%d" % (kind, oid)
+
+    def us(self, ticks):
+        return ticks * 1e6 / self.freq
+
+    # Replay ----------------------------------------------------------------
+    def _run(self):
+        t = None
+        current = None
+        run_start = None
+        ready = {}                  # task -> (time, isr)
+        blocked = {}                # task -> (time, what, object, chain)
+        holders = {}                # mutex -> task
+        for word, info in self.trace.events:
+            code = info & 0x7F
+            isr = (info & EV_ISR) != 0
+            ident = (info >> 8) & 0xFF
+            arg = info >> 16
+            if code == 0x30:
+                self._name(ident, arg, word)
+                continue
+            if code == 0:
+                continue
+            # Extend the timestamps to 64 bits; small backward steps come from
+            # events recorded by interrupts between slot claim and timestamp
+            if t is None:
+                t = word
+            else:
+                delta = (word - t) & 0xFFFFFFFF
+                if delta >= 0x80000000:
+                    delta -= 0x100000000
+                t += delta
+            if self.start is None:
+                self.start = t
+            self.end = t
+            self.records.append((t, code, isr, ident, arg, current))
+
+            if code == 0x31:
+                # Events are missing: the states are unknown until rebuilt
+                self.lost += arg
+                ready.clear()
+                blocked.clear()
+            elif code == 0x03:
+                if current is None:
+                    # The first task starts without a switch: the tasks made
+                    # ready before the scheduler started have no latency
+                    ready.clear()
+                if current is not None and run_start is not None:
+                    self.segments.append((current, run_start, t))
+                if ident in ready:
+                    rt, risr = ready.pop(ident)
+                    self.latencies.append((t - rt, ident, rt, current, risr))
+                current = ident
+                run_start = t
+            elif code == 0x04:
+                if ident in blocked:
+                    bt, what, _, chain = blocked.pop(ident)
+                    self.blocks.append((t - bt, ident, bt, what, chain))
+                if ident != current and ident not in ready:
+                    ready[ident] = (t, isr)
+            elif code == 0x05:
+                blocked[current] = (t, "delay", None, [])
+            elif code == 0x06:
+                blocked[ident] = (t, "suspended", None, [])
+            elif code == 0x0C:
+                # Stream buffers wait for a notification after their own event
+                blocked.setdefault(current, (t, "notification", None, []))
+            elif code in (0x17, 0x18):
+                what = "send to" if code == 0x17 else "receive from"
+                blocked[current] = (t, what, ident,
+                                    self._chain(current, ident, holders, blocked))
+            elif code == 0x09:
+                self.inversions.append((t, ident, arg))
+            elif code == 0x01:
+                self.tasks.setdefault(ident, {"name": "", "priority": arg})
+            elif code == 0x10:
+                obj = self.objects.setdefault(ident, {"name": "", "kind": arg >> 12,
+                                                      "length": arg & 0xFFF})
+                obj["kind"] = arg >> 12
+                self.depths.pop(ident, None)
+                holders.pop(ident, None)
+            elif code in (0x12, 0x14):
+                kind = self.objects.get(ident, {}).get("kind", 0)
+                if kind in KIND_QUEUES:
+                    items = arg + 1 if code == 0x12 else max(arg - 1, 0)
+                    length = self.objects.get(ident, {}).get("length", 0)
+                    if length:
+                        items = min(items, length)
+                    self.depths.setdefault(ident, []).append((t, items))
+                if kind in KIND_MUTEX and not isr:
+                    if code == 0x14:
+                        holders[ident] = current
+                    else:
+                        holders.pop(ident, None)
+        if current is not None and run_start is not None and self.end is not None:
+            self.segments.append((current, run_start, self.end))
+
+    def _name(self, ident, arg, word):
+        key = ("o" if arg & 0x8000 else "t", ident)
+        chunk = arg & 0x7FFF
+        chars = struct.pack("<I", word)
+        if chunk == 0:
+            self.name_chunks[key] = b""
+        self.name_chunks[key] = self.name_chunks.get(key, b"") + chars
+        name = _cstr(self.name_chunks[key])
+        table = self.objects if key[0] == "o" else self.tasks
+        table.setdefault(ident, {"name": "", "kind": 0, "length": 0, "priority": 0})["name"] = name
+
+    def _chain(self, tid, oid, holders, blocked):
+        """Tasks and objects a task blocking on an object waits for."""
+        chain = []
+        seen = set([tid])
+        while oid is not None:
+            chain.append(self.object_name(oid))
+            holder = holders.get(oid)
+            if holder is None or holder in seen:
+                break
+            chain.append(self.task_name(holder))
+            seen.add(holder)
+            oid = blocked[holder][2] if holder in blocked else None
+        return chain
+
+    # Reports ---------------------------------------------------------------
+    def summary(self, out, top):
+        span = (self.end - self.start) if self.records else 0
+        out.write("Trace: %d events over %.3f ms, %d %s, timestamps at %.0f Hz\n"
+                  % (len(self.records), self.us(span) / 1000.0, self.lost,
+                     "lost" if self.trace.mode == TRC_MODE_STREAM else "overwritten",
+                     self.freq))
+
+        out.write("\nTasks:\n")
+        out.write("  %-16s %4s %10s %6s %8s %14s %14s\n"
+                  % ("name", "id", "cpu (us)", "cpu %", "switches",
+                     "max lat. (us)", "max wait (us)"))
+        cpu = {}
+        switches = {}
+        for tid, start, end in self.segments:
+            cpu[tid] = cpu.get(tid, 0) + (end - start)
+            switches[tid] = switches.get(tid, 0) + 1
+        max_lat = {}
+        for lat, tid, _, _, _ in self.latencies:
+            max_lat[tid] = max(max_lat.get(tid, 0), lat)
+        max_block = {}
+        for dur, tid, _, what, _ in self.blocks:
+            if what not in ("delay", "suspended"):
+                max_block[tid] = max(max_block.get(tid, 0), dur)
+        for tid in sorted(set(self.tasks) | set(cpu)):
+            out.write("  %-16s %4d %10.1f %6.1f %8d %14.1f %14.1f\n"
+                      % (self.task_name(tid), tid, self.us(cpu.get(tid, 0)),
+                         100.0 * cpu.get(tid, 0) / span if span else 0.0,
+                         switches.get(tid, 0), self.us(max_lat.get(tid, 0)),
+                         self.us(max_block.get(tid, 0))))
+
+        if self.depths:
+            out.write("\nQueue depths:\n")
+            out.write("  %-20s %-18s %6s %8s %8s %8s\n"
+                      % ("name", "kind", "length", "ops", "max", "mean"))
+            for oid in sorted(self.depths):
+                series = self.depths[oid]
+                obj = self.objects.get(oid, {})
+                weighted = 0
+                for (t0, n0), (t1, _) in zip(series, series[1:] + [(self.end, 0)]):
+                    weighted += n0 * (t1 - t0)
+                duration = self.end - series[0][0]
+                kind = obj.get("kind", 0)
+                out.write("  %-20s %-18s %6d %8d %8d %8.2f\n"
+                          % (self.object_name(oid),
+                             KIND_NAMES[kind] if kind < len(KIND_NAMES) else "?",
+                             obj.get("length", 0), len(series),
+                             max(n for _, n in series),
+                             float(weighted) / duration if duration else series[-1][1]))
+
+        out.write("\nLongest scheduling latencies (ready to running):\n")
+        for lat, tid, rt, running, isr in sorted(self.latencies, reverse=True)[:top]:
+            out.write("  %10.1f us  %-16s ready at %.1f us%s, %s was running\n"
+                      % (self.us(lat), self.task_name(tid), self.us(rt - self.start),
+                         " by an interrupt" if isr else "",
+                         self.task_name(running) if running is not None else "nothing"))
+
+        out.write("\nLongest waits (blocking chains):\n")
+        waits = [b for b in self.blocks if b[3] not in ("delay", "suspended")]
+        for dur, tid, bt, what, chain in sorted(waits, key=lambda b: b[0],
+                                                 reverse=True)[:top]:
+            out.write("  %10.1f us  %-16s from %.1f us, %s%s\n"
+                      % (self.us(dur), self.task_name(tid), self.us(bt - self.start),
+                         what, (" " + " -> ".join(chain)) if chain else ""))
+
+        if self.inversions:
+            out.write("\nPriority inheritance: %d times\n" % len(self.inversions))
+            for t, tid, prio in self.inversions[:top]:
+                out.write("  at %.1f us %s raised to priority %d\n"
+                          % (self.us(t - self.start), self.task_name(tid), prio))
+
+    def events(self, out):
+        for t, code, isr, ident, arg, current in self.records:
+            name = EV_NAMES.get(code, "0x%02X" % code)
+            if code in TASK_EVENTS:
+                subject = self.task_name(ident)
+            elif code in (0x0D, 0x31):
+                subject = ""
+            else:
+                subject = self.object_name(ident)
+            out.write("%12.1f  %-16s %-22s %-20s %5d%s\n"
+                      % (self.us(t - self.start),
+                         self.task_name(current) if current is not None else "-",
+                         name, subject, arg, "  (ISR)" if isr else ""))
+
+    def chrome(self, out):
+        """Trace Event Format: one thread per task, one counter per queue."""
+        evs = []
+        for tid in sorted(set(self.tasks) | set(s[0] for s in self.segments)):
+            evs.append({"ph": "M", "name": "thread_name", "pid": 1, "tid": tid,
+                        "args": {"name": self.task_name(tid)}})
+        for tid, start, end in self.segments:
+            evs.append({"ph": "X", "name": self.task_name(tid), "pid": 1, "tid": tid,
+                        "ts": self.us(start - self.start), "dur": self.us(end - start)})
+        for dur, tid, bt, what, chain in self.blocks:
+            evs.append({"ph": "X", "name": "blocked", "cat": "block", "pid": 2,
+                        "tid": tid, "ts": self.us(bt - self.start), "dur": self.us(dur),
+                        "args": {"wait": what, "chain": " -> ".join(chain)}})
+        for lat, tid, rt, running, isr in self.latencies:
+            evs.append({"ph": "X", "name": "ready", "cat": "latency", "pid": 3,
+                        "tid": tid, "ts": self.us(rt - self.start), "dur": self.us(lat),
+                        "args": {"from_isr": isr}})
+        for oid, series in self.depths.items():
+            for t, n in series:
+                evs.append({"ph": "C", "name": self.object_name(oid), "pid": 4,
+                            "ts": self.us(t - self.start), "args": {"items": n}})
+        for pid, name in ((1, "running"), (2, "blocked"), (3, "ready"), (4, "queues")):
+            evs.append({"ph": "M", "name": "process_name", "pid": pid,
+                        "args": {"name": name}})
+        json.dump({"traceEvents": evs, "displayTimeUnit": "ns"}, out)
+
+    def depth_csv(self, out):
+        out.write("object,time_us,items\n")
+        for oid in sorted(self.depths):
+            for t, n in self.depths[oid]:
+                out.write("%s,%.3f,%d\n" % (self.object_name(oid), self.us(t - self.start), n))
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description="Decode a cpu_tracer trace")
+    parser.add_argument("trace", help="binary trace: snapshot, or stream capture")
+    parser.add_argument("--events", action="store_true", help="list the events")
+    parser.add_argument("--chrome", metavar="FILE", help="write a Trace Event Format timeline")
+    parser.add_argument("--depth-csv", metavar="FILE", help="write the queue depths as CSV")
+    parser.add_argument("--top", type=int, default=10, help="number of outliers listed")
+    args = parser.parse_args(argv)
+
+    with open(args.trace, "rb") as f:
+        dec = Decoder(Trace(f.read()))
+
+    if args.events:
+        dec.events(sys.stdout)
+    else:
+        dec.summary(sys.stdout, args.top)
+    if args.chrome:
+        with open(args.chrome, "w") as f:
+            dec.chrome(f)
+    if args.depth_csv:
+        with open(args.depth_csv, "w") as f:
+            dec.depth_csv(f)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
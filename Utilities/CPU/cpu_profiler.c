@@ -0,0 +1,589 @@
+/**
+  ******************************************************************************
+  * @file    cpu_profiler.c
+  * @author  MCD Application Team
+  * @brief   Per task run time, latency, stack and wait time profiling
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- in the _OS_Config.h file (ex. FreeRTOSConfig.h) enable the following macros :
+      - #define configUSE_TRACE_FACILITY                 1
+      - #define INCLUDE_uxTaskPriorityGet                1
+      - #define INCLUDE_uxTaskGetStackHighWaterMark      1
+      - #define INCLUDE_xTaskGetIdleTaskHandle           1
+
+2- at the end of the _OS_Config.h file include the trace macros :
+      - #include "cpu_profiler_trace.h"
+   They use the trace hooks also used by cpu_utils.c: only one of the two
+   modules can be linked, PROF_GetCPULoad() replaces osGetCPUUsage().
+   When configGENERATE_RUN_TIME_STATS is 1, vTaskGetRunTimeStats() uses the
+   profiler timebase.
+
+3- call PROF_TimebaseInit() before starting the scheduler, unless
+   configGENERATE_RUN_TIME_STATS is 1 (the kernel calls it then).
+
+4- call PROF_Snapshot() from a task to export the statistics, and optionally
+   PROF_WatchObject() to get the wait time histogram of a given queue,
+   semaphore, mutex or event group.
+
+The timebase is the DWT cycle counter. Another free running 32-bit counter,
+for instance a timer or the host clock of a simulator build, can be selected
+by defining in main.h :
+      - PROF_TIMESTAMP()       : current counter value
+      - PROF_TIMESTAMP_FREQ    : counter frequency in Hz
+      - PROF_TIMEBASE_INIT()   : counter start-up, may be empty
+      - PROF_IN_ISR()          : non zero in interrupt context
+      - PROF_IN_TICK_ISR()     : non zero in the RTOS tick interrupt
+The counter must not wrap more than once between two context switches.
+
+Tasks made ready by the tick interrupt (end of a delay or of a time-out) are
+counted in max_latency only, so that max_isr_wakeup measures the response to
+the application interrupts. By default the tick interrupt is the SysTick
+exception: define PROF_IN_TICK_ISR() in main.h when another timer drives the
+RTOS tick.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "cpu_profiler.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  void       *task;             /* Task handle, NULL for a free slot */
+  uint64_t    runtime;          /* Accumulated run time */
+  uint32_t    switch_in;        /* Time of the last switch in */
+  uint32_t    switches;         /* Number of switches in */
+  uint32_t    ready_time;       /* Time the task was made ready */
+  uint32_t    max_latency;      /* Longest ready to running time */
+  uint32_t    max_isr_wakeup;   /* Same, when made ready from an interrupt
+                                   other than the tick */
+  const void *wait_object;      /* Object the task is blocked on */
+  uint32_t    wait_start;       /* Time the task blocked */
+  uint8_t     wait_kind;        /* PROF_WAIT_xxx + 1, 0 when not blocked */
+  uint8_t     ready;            /* PROF_READY_xxx */
+} PROF_Task_t;
+
+typedef struct
+{
+  const void *object;           /* Watched object, NULL for a wait kind */
+  const char *name;
+  uint32_t    count;
+  uint32_t    max;
+  uint32_t    bins[PROF_HIST_BINS];
+} PROF_Hist_t;
+
+/* Private define ------------------------------------------------------------*/
+#define PROF_READY_NONE       0U
+#define PROF_READY_TASK       1U
+#define PROF_READY_ISR        2U
+#define PROF_READY_TICK       3U
+
+#if (configUSE_TRACE_FACILITY != 1)
+#error "cpu_profiler requires configUSE_TRACE_FACILITY"
+#endif
+
+/* Private macro -------------------------------------------------------------*/
+#ifndef PROF_TIMESTAMP
+#define PROF_TIMESTAMP()      (DWT->CYCCNT)
+#define PROF_TIMESTAMP_FREQ   SystemCoreClock
+#define PROF_TIMEBASE_INIT()  do {                                              \
+                                CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk; \
+                                DWT->CYCCNT = 0U;                               \
+                                DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;            \
+                              } while (0)
+#endif
+
+#ifndef PROF_IN_ISR
+#define PROF_IN_ISR()         (__get_IPSR() != 0U)
+#endif
+
+/* Exception number of SysTick */
+#ifndef PROF_IN_TICK_ISR
+#define PROF_IN_TICK_ISR()    (__get_IPSR() == 15U)
+#endif
+
+#if defined(__GNUC__)
+#define PROF_CLZ(x)           ((uint32_t)__builtin_clz(x))
+#else
+#define PROF_CLZ(x)           ((uint32_t)__CLZ(x))
+#endif
+
+/* Private function prototypes -----------------------------------------------*/
+static PROF_Task_t *PROF_FindTask(void *task);
+static void PROF_HistAdd(PROF_Hist_t *hist, uint32_t time);
+static void PROF_CopyName(char *dest, const char *name);
+
+/* Private variables ---------------------------------------------------------*/
+static PROF_Task_t  prof_tasks[PROF_MAX_TASKS];
+static PROF_Hist_t  prof_hists[PROF_WAIT_KINDS + PROF_MAX_OBJECTS] =
+{
+  { NULL, "receive", 0U, 0U, { 0U } },
+  { NULL, "send",    0U, 0U, { 0U } },
+  { NULL, "notify",  0U, 0U, { 0U } },
+  { NULL, "event",   0U, 0U, { 0U } }
+};
+static uint32_t     prof_object_count = 0;
+static PROF_Task_t *prof_current = NULL;
+static uint64_t     prof_load_idle = 0;
+static uint32_t     prof_load_time = 0;
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Get the slot of a task
+  * @param  task: task handle
+  * @retval Task slot, NULL if the task is not profiled
+  */
+static PROF_Task_t *PROF_FindTask(void *task)
+{
+  UBaseType_t n = uxTaskGetTaskNumber((TaskHandle_t)task);
+
+  /* The task number is the slot index plus one, check the handle in case the
+     application also uses vTaskSetTaskNumber() */
+  if ((n == 0U) || (n > PROF_MAX_TASKS) || (prof_tasks[n - 1U].task != task))
+  {
+    return NULL;
+  }
+  return &prof_tasks[n - 1U];
+}
+
+/**
+  * @brief  Add a wait time to a histogram
+  * @param  hist: histogram
+  * @param  time: wait time in timestamp ticks
+  * @retval None
+  */
+static void PROF_HistAdd(PROF_Hist_t *hist, uint32_t time)
+{
+  uint32_t bin = 0U;
+
+  if (time >= (1UL << PROF_HIST_SHIFT))
+  {
+    bin = 32U - PROF_CLZ(time) - PROF_HIST_SHIFT;
+    if (bin >= PROF_HIST_BINS)
+    {
+      bin = PROF_HIST_BINS - 1U;
+    }
+  }
+  hist->bins[bin]++;
+  hist->count++;
+  if (time > hist->max)
+  {
+    hist->max = time;
+  }
+}
+
+/**
+  * @brief  Copy a name into a fixed size, NUL padded snapshot field
+  * @param  dest: PROF_NAME_LEN bytes field
+  * @param  name: name, may be NULL
+  * @retval None
+  */
+static void PROF_CopyName(char *dest, const char *name)
+{
+  uint32_t i = 0U;
+
+  if (name != NULL)
+  {
+    for (; (i < (PROF_NAME_LEN - 1U)) && (name[i] != '\0'); i++)
+    {
+      dest[i] = name[i];
+    }
+  }
+  for (; i < PROF_NAME_LEN; i++)
+  {
+    dest[i] = '\0';
+  }
+}
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  Start the timebase
+  * @param  None
+  * @retval None
+  */
+void PROF_TimebaseInit(void)
+{
+  PROF_TIMEBASE_INIT();
+}
+
+/**
+  * @brief  Read the timebase
+  * @param  None
+  * @retval Current timestamp
+  */
+uint32_t PROF_GetTimestamp(void)
+{
+  return PROF_TIMESTAMP();
+}
+
+/**
+  * @brief  traceTASK_CREATE hook: assign a slot to a new task
+  * @param  task: task handle
+  * @retval None
+  */
+void PROF_TaskCreate(void *task)
+{
+  uint32_t i;
+
+  for (i = 0U; i < PROF_MAX_TASKS; i++)
+  {
+    if (prof_tasks[i].task == NULL)
+    {
+      memset(&prof_tasks[i], 0, sizeof(PROF_Task_t));
+      prof_tasks[i].task = task;
+      vTaskSetTaskNumber((TaskHandle_t)task, (UBaseType_t)(i + 1U));
+      break;
+    }
+  }
+}
+
+/**
+  * @brief  traceTASK_DELETE hook: release the slot of a task
+  * @param  task: task handle, the task control block may already be freed
+  * @retval None
+  */
+void PROF_TaskDelete(void *task)
+{
+  uint32_t i;
+
+  for (i = 0U; i < PROF_MAX_TASKS; i++)
+  {
+    if (prof_tasks[i].task == task)
+    {
+      prof_tasks[i].task = NULL;
+      break;
+    }
+  }
+}
+
+/**
+  * @brief  traceTASK_SWITCHED_OUT hook: account the run time of a task
+  * @param  task: handle of the running task
+  * @retval None
+  */
+void PROF_TaskSwitchedOut(void *task)
+{
+  PROF_Task_t *p = prof_current;
+
+  if ((p != NULL) && (p->task == task))
+  {
+    p->runtime += (uint32_t)(PROF_TIMESTAMP() - p->switch_in);
+  }
+}
+
+/**
+  * @brief  traceTASK_SWITCHED_IN hook: measure the scheduling latency
+  * @param  task: handle of the selected task
+  * @retval None
+  */
+void PROF_TaskSwitchedIn(void *task)
+{
+  uint32_t now = PROF_TIMESTAMP();
+  uint32_t latency;
+  PROF_Task_t *p = PROF_FindTask(task);
+
+  prof_current = p;
+  if (p != NULL)
+  {
+    p->switch_in = now;
+    p->switches++;
+    if (p->ready != PROF_READY_NONE)
+    {
+      latency = now - p->ready_time;
+      if (latency > p->max_latency)
+      {
+        p->max_latency = latency;
+      }
+      if ((p->ready == PROF_READY_ISR) && (latency > p->max_isr_wakeup))
+      {
+        p->max_isr_wakeup = latency;
+      }
+      p->ready = PROF_READY_NONE;
+    }
+  }
+}
+
+/**
+  * @brief  traceMOVED_TASK_TO_READY_STATE hook: end of a wait
+  * @param  task: handle of the task made ready
+  * @retval None
+  */
+void PROF_TaskReady(void *task)
+{
+  uint32_t now;
+  uint32_t i;
+  PROF_Task_t *p = PROF_FindTask(task);
+
+  if (p == NULL)
+  {
+    return;
+  }
+
+  now = PROF_TIMESTAMP();
+  if (p->wait_kind != 0U)
+  {
+    PROF_HistAdd(&prof_hists[p->wait_kind - 1U], now - p->wait_start);
+    if (p->wait_object != NULL)
+    {
+      for (i = PROF_WAIT_KINDS; i < (PROF_WAIT_KINDS + prof_object_count); i++)
+      {
+        if (prof_hists[i].object == p->wait_object)
+        {
+          PROF_HistAdd(&prof_hists[i], now - p->wait_start);
+          break;
+        }
+      }
+    }
+    p->wait_kind = 0U;
+  }
+
+  /* Tasks made ready before the first context switch are not woken up, and
+     neither is the running task moved between ready lists when its priority
+     changes. The first event of a wake up is kept. */
+  if ((prof_current != NULL) && (p != prof_current) && (p->ready == PROF_READY_NONE))
+  {
+    p->ready_time = now;
+    if (!PROF_IN_ISR())
+    {
+      p->ready = PROF_READY_TASK;
+    }
+    else
+    {
+      p->ready = PROF_IN_TICK_ISR() ? PROF_READY_TICK : PROF_READY_ISR;
+    }
+  }
+}
+
+/**
+  * @brief  traceBLOCKING_ON_xxx hooks: start of a wait of the running task
+  * @param  object: queue, semaphore, mutex or event group, NULL for a
+  *         task notification
+  * @param  kind: PROF_WAIT_xxx
+  * @retval None
+  */
+void PROF_TaskBlocking(const void *object, uint32_t kind)
+{
+  PROF_Task_t *p = prof_current;
+
+  if (p != NULL)
+  {
+    p->wait_object = object;
+    p->wait_start = PROF_TIMESTAMP();
+    p->wait_kind = (uint8_t)(kind + 1U);
+  }
+}
+
+/**
+  * @brief  Give a queue, semaphore, mutex or event group its own wait time
+  *         histogram, in addition to the histogram of the wait kind
+  * @param  object: object handle
+  * @param  name: name reported in the snapshot, must remain valid
+  * @retval 0 on success, -1 if PROF_MAX_OBJECTS objects are already watched
+  */
+int32_t PROF_WatchObject(const void *object, const char *name)
+{
+  int32_t ret = -1;
+  uint32_t i;
+
+  taskENTER_CRITICAL();
+  for (i = PROF_WAIT_KINDS; i < (PROF_WAIT_KINDS + prof_object_count); i++)
+  {
+    if (prof_hists[i].object == object)
+    {
+      prof_hists[i].name = name;
+      ret = 0;
+      break;
+    }
+  }
+  if ((ret != 0) && (prof_object_count < PROF_MAX_OBJECTS))
+  {
+    memset(&prof_hists[i], 0, sizeof(PROF_Hist_t));
+    prof_hists[i].object = object;
+    prof_hists[i].name = name;
+    prof_object_count++;
+    ret = 0;
+  }
+  taskEXIT_CRITICAL();
+
+  return ret;
+}
+
+/**
+  * @brief  Export the statistics as a binary snapshot, see PROF_SnapshotHeader_t
+  * @note   The stack high-water marks are computed with the scheduler
+  *         suspended, which takes a time proportional to the stack sizes.
+  * @param  buffer: word aligned destination, PROF_SNAPSHOT_SIZE bytes are
+  *         enough in every case
+  * @param  size: size of the buffer in bytes
+  * @retval Size of the snapshot in bytes, 0 if the buffer is too small
+  */
+uint32_t PROF_Snapshot(void *buffer, uint32_t size)
+{
+  PROF_SnapshotHeader_t *header = (PROF_SnapshotHeader_t *)buffer;
+  PROF_SnapshotTask_t *rec;
+  PROF_SnapshotHist_t *hist;
+  PROF_Task_t t;
+  uint32_t task_count = 0U;
+  uint32_t hist_count;
+  uint32_t total;
+  uint32_t now;
+  uint32_t i;
+
+  vTaskSuspendAll();
+
+  for (i = 0U; i < PROF_MAX_TASKS; i++)
+  {
+    if (prof_tasks[i].task != NULL)
+    {
+      task_count++;
+    }
+  }
+  hist_count = PROF_WAIT_KINDS + prof_object_count;
+  total = sizeof(PROF_SnapshotHeader_t) + (task_count * sizeof(PROF_SnapshotTask_t)) +
+          (hist_count * sizeof(PROF_SnapshotHist_t));
+  if ((buffer == NULL) || (size < total))
+  {
+    (void)xTaskResumeAll();
+    return 0U;
+  }
+
+  rec = (PROF_SnapshotTask_t *)(header + 1);
+  for (i = 0U; i < PROF_MAX_TASKS; i++)
+  {
+    /* Tasks cannot be created or deleted while the scheduler is suspended */
+    if (prof_tasks[i].task == NULL)
+    {
+      continue;
+    }
+    PROF_CopyName(rec->name, pcTaskGetName((TaskHandle_t)prof_tasks[i].task));
+    rec->priority = (uint32_t)uxTaskPriorityGet((TaskHandle_t)prof_tasks[i].task);
+    rec->stack_free = (uint32_t)uxTaskGetStackHighWaterMark((TaskHandle_t)prof_tasks[i].task) *
+                      (uint32_t)sizeof(StackType_t);
+
+    taskENTER_CRITICAL();
+    t = prof_tasks[i];
+    now = PROF_TIMESTAMP();
+    taskEXIT_CRITICAL();
+
+    /* Include the current run of the calling task */
+    if (&prof_tasks[i] == prof_current)
+    {
+      t.runtime += (uint32_t)(now - t.switch_in);
+    }
+    rec->runtime_lo = (uint32_t)t.runtime;
+    rec->runtime_hi = (uint32_t)(t.runtime >> 32);
+    rec->switches = t.switches;
+    rec->max_latency = t.max_latency;
+    rec->max_isr_wakeup = t.max_isr_wakeup;
+    rec++;
+  }
+
+  hist = (PROF_SnapshotHist_t *)rec;
+  for (i = 0U; i < hist_count; i++)
+  {
+    PROF_CopyName(hist->name, prof_hists[i].name);
+    hist->kind = (i < PROF_WAIT_KINDS) ? i : PROF_HIST_OBJECT;
+    taskENTER_CRITICAL();
+    hist->count = prof_hists[i].count;
+    hist->max = prof_hists[i].max;
+    memcpy(hist->bins, prof_hists[i].bins, sizeof(hist->bins));
+    taskEXIT_CRITICAL();
+    hist++;
+  }
+
+  header->magic = PROF_SNAPSHOT_MAGIC;
+  header->version = PROF_SNAPSHOT_VERSION;
+  header->size = total;
+  header->timestamp_freq = PROF_TIMESTAMP_FREQ;
+  header->timestamp = PROF_TIMESTAMP();
+  header->task_count = task_count;
+  header->hist_count = hist_count;
+  header->hist_bins = PROF_HIST_BINS;
+  header->hist_shift = PROF_HIST_SHIFT;
+
+  (void)xTaskResumeAll();
+
+  return total;
+}
+
+/**
+  * @brief  Clear the statistics, the watched objects remain registered
+  * @param  None
+  * @retval None
+  */
+void PROF_Reset(void)
+{
+  uint32_t i;
+
+  taskENTER_CRITICAL();
+  for (i = 0U; i < PROF_MAX_TASKS; i++)
+  {
+    prof_tasks[i].runtime = 0U;
+    prof_tasks[i].switches = 0U;
+    prof_tasks[i].max_latency = 0U;
+    prof_tasks[i].max_isr_wakeup = 0U;
+  }
+  for (i = 0U; i < (PROF_WAIT_KINDS + PROF_MAX_OBJECTS); i++)
+  {
+    prof_hists[i].count = 0U;
+    prof_hists[i].max = 0U;
+    memset(prof_hists[i].bins, 0, sizeof(prof_hists[i].bins));
+  }
+  prof_load_idle = 0U;
+  prof_load_time = PROF_TIMESTAMP();
+  taskEXIT_CRITICAL();
+}
+
+/**
+  * @brief  CPU load since the previous call, from the idle task run time
+  * @param  None
+  * @retval CPU load in percent
+  */
+uint16_t PROF_GetCPULoad(void)
+{
+  PROF_Task_t *idle;
+  uint64_t idle_time = 0U;
+  uint32_t now;
+  uint32_t elapsed;
+  uint32_t busy;
+
+  taskENTER_CRITICAL();
+  now = PROF_TIMESTAMP();
+  idle = PROF_FindTask(xTaskGetIdleTaskHandle());
+  if (idle != NULL)
+  {
+    idle_time = idle->runtime;
+    if (idle == prof_current)
+    {
+      idle_time += (uint32_t)(now - idle->switch_in);
+    }
+  }
+  elapsed = now - prof_load_time;
+  busy = elapsed - (uint32_t)(idle_time - prof_load_idle);
+  prof_load_idle = idle_time;
+  prof_load_time = now;
+  taskEXIT_CRITICAL();
+
+  if ((elapsed == 0U) || (busy > elapsed))
+  {
+    return 0U;
+  }
+  return (uint16_t)(((uint64_t)busy * 100U) / elapsed);
+}
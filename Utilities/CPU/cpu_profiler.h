@@ -0,0 +1,123 @@
+/**
+  ******************************************************************************
+  * @file    cpu_profiler.h
+  * @author  MCD Application Team
+  * @brief   Header for cpu_profiler module
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _CPU_PROFILER_H__
+#define _CPU_PROFILER_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "cpu_profiler_trace.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Number of task slots. Tasks created once all the slots are used are not
+   profiled. */
+#ifndef PROF_MAX_TASKS
+#define PROF_MAX_TASKS        16U
+#endif
+
+/* Number of kernel objects that can get their own wait time histogram */
+#ifndef PROF_MAX_OBJECTS
+#define PROF_MAX_OBJECTS      8U
+#endif
+
+/* Wait time histograms: bin 0 counts the waits shorter than
+   2^PROF_HIST_SHIFT timestamp ticks, bin n the waits in
+   [2^(PROF_HIST_SHIFT+n-1), 2^(PROF_HIST_SHIFT+n)[, the last bin is open. */
+#ifndef PROF_HIST_BINS
+#define PROF_HIST_BINS        16U
+#endif
+#ifndef PROF_HIST_SHIFT
+#define PROF_HIST_SHIFT       6U
+#endif
+
+/* Length of the names stored in the snapshot, NUL padded */
+#define PROF_NAME_LEN         16U
+
+/* Histogram kind of the objects registered with PROF_WatchObject(), which
+   count every wait on the object whatever its kind */
+#define PROF_HIST_OBJECT      0xFFFFFFFFU
+
+/* Snapshot format */
+#define PROF_SNAPSHOT_MAGIC   0x31465250U   /* "PRF1" */
+#define PROF_SNAPSHOT_VERSION 1U
+
+/* Exported types ------------------------------------------------------------*/
+/* The snapshot is a PROF_SnapshotHeader_t followed by task_count
+   PROF_SnapshotTask_t and hist_count PROF_SnapshotHist_t records. All the
+   fields are 32-bit words in the target byte order, so that the layout is the
+   same for every compiler and for a host decoder. Times are expressed in
+   timestamp ticks, at timestamp_freq Hz. */
+typedef struct
+{
+  uint32_t magic;               /* PROF_SNAPSHOT_MAGIC */
+  uint32_t version;             /* PROF_SNAPSHOT_VERSION */
+  uint32_t size;                /* Total snapshot size in bytes */
+  uint32_t timestamp_freq;      /* Timestamp frequency in Hz */
+  uint32_t timestamp;           /* Time of the snapshot */
+  uint32_t task_count;          /* Number of task records */
+  uint32_t hist_count;          /* Number of histogram records */
+  uint32_t hist_bins;           /* PROF_HIST_BINS */
+  uint32_t hist_shift;          /* PROF_HIST_SHIFT */
+} PROF_SnapshotHeader_t;
+
+typedef struct
+{
+  char     name[PROF_NAME_LEN]; /* Task name */
+  uint32_t priority;            /* Current priority */
+  uint32_t runtime_lo;          /* Accumulated run time, low word */
+  uint32_t runtime_hi;          /* Accumulated run time, high word */
+  uint32_t switches;            /* Number of times the task was switched in */
+  uint32_t max_latency;         /* Longest time from ready to running */
+  uint32_t max_isr_wakeup;      /* Same, for tasks made ready by an interrupt
+                                   other than the RTOS tick: the ends of
+                                   delays and time-outs only count in
+                                   max_latency */
+  uint32_t stack_free;          /* Stack high-water mark: minimum free bytes */
+} PROF_SnapshotTask_t;
+
+typedef struct
+{
+  char     name[PROF_NAME_LEN]; /* Object name, or wait kind for the global ones */
+  uint32_t kind;                /* PROF_WAIT_xxx, or PROF_HIST_OBJECT */
+  uint32_t count;               /* Number of waits */
+  uint32_t max;                 /* Longest wait */
+  uint32_t bins[PROF_HIST_BINS];
+} PROF_SnapshotHist_t;
+
+/* Exported macro ------------------------------------------------------------*/
+/* Buffer size needed by PROF_Snapshot() in the worst case */
+#define PROF_SNAPSHOT_SIZE    (sizeof(PROF_SnapshotHeader_t) + \
+                               (PROF_MAX_TASKS * sizeof(PROF_SnapshotTask_t)) + \
+                               ((PROF_WAIT_KINDS + PROF_MAX_OBJECTS) * sizeof(PROF_SnapshotHist_t)))
+
+/* Exported functions ------------------------------------------------------- */
+int32_t  PROF_WatchObject(const void *object, const char *name);
+uint32_t PROF_Snapshot(void *buffer, uint32_t size);
+void     PROF_Reset(void);
+uint16_t PROF_GetCPULoad(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CPU_PROFILER_H__ */
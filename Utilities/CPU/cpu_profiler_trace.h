@@ -0,0 +1,87 @@
+/**
+  ******************************************************************************
+  * @file    cpu_profiler_trace.h
+  * @author  MCD Application Team
+  * @brief   FreeRTOS trace macros feeding the cpu_profiler module.
+  *          Include this file at the end of FreeRTOSConfig.h.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _CPU_PROFILER_TRACE_H__
+#define _CPU_PROFILER_TRACE_H__
+
+/* FreeRTOSConfig.h is also included by the assembler files of some ports */
+#if !defined(__IAR_SYSTEMS_ASM__) && !defined(__ASSEMBLER__)
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/* Wait kinds, used to select the wait time histogram of a blocked task */
+#define PROF_WAIT_RECEIVE     0U    /* Queue receive/peek, semaphore or mutex take */
+#define PROF_WAIT_SEND        1U    /* Queue send, semaphore give on a full queue  */
+#define PROF_WAIT_NOTIFY      2U    /* Task notification (also stream buffers)    */
+#define PROF_WAIT_EVENT       3U    /* Event group wait or sync                   */
+#define PROF_WAIT_KINDS       4U
+
+/* Exported functions ------------------------------------------------------- */
+/* Kernel hooks: the handles are passed untyped, as FreeRTOSConfig.h is parsed
+   before the kernel types are declared */
+void PROF_TimebaseInit(void);
+uint32_t PROF_GetTimestamp(void);
+void PROF_TaskCreate(void *task);
+void PROF_TaskDelete(void *task);
+void PROF_TaskSwitchedIn(void *task);
+void PROF_TaskSwitchedOut(void *task);
+void PROF_TaskReady(void *task);
+void PROF_TaskBlocking(const void *object, uint32_t kind);
+
+/* Exported macro ------------------------------------------------------------*/
+#define traceTASK_CREATE(pxNewTCB)                PROF_TaskCreate((void *)(pxNewTCB))
+#define traceTASK_DELETE(pxTCB)                   PROF_TaskDelete((void *)(pxTCB))
+#define traceTASK_SWITCHED_OUT()                  PROF_TaskSwitchedOut((void *)pxCurrentTCB)
+#define traceTASK_SWITCHED_IN()                   PROF_TaskSwitchedIn((void *)pxCurrentTCB)
+#define traceMOVED_TASK_TO_READY_STATE(pxTCB)     PROF_TaskReady((void *)(pxTCB))
+
+#define traceBLOCKING_ON_QUEUE_RECEIVE(pxQueue)   PROF_TaskBlocking((pxQueue), PROF_WAIT_RECEIVE)
+#define traceBLOCKING_ON_QUEUE_PEEK(pxQueue)      PROF_TaskBlocking((pxQueue), PROF_WAIT_RECEIVE)
+#define traceBLOCKING_ON_QUEUE_SEND(pxQueue)      PROF_TaskBlocking((pxQueue), PROF_WAIT_SEND)
+#define traceTASK_NOTIFY_TAKE_BLOCK()             PROF_TaskBlocking((void *)0, PROF_WAIT_NOTIFY)
+#define traceTASK_NOTIFY_WAIT_BLOCK()             PROF_TaskBlocking((void *)0, PROF_WAIT_NOTIFY)
+#define traceEVENT_GROUP_WAIT_BITS_BLOCK(xEventGroup, uxBitsToWaitFor) \
+  PROF_TaskBlocking((xEventGroup), PROF_WAIT_EVENT)
+#define traceEVENT_GROUP_SYNC_BLOCK(xEventGroup, uxBitsToSet, uxBitsToWaitFor) \
+  PROF_TaskBlocking((xEventGroup), PROF_WAIT_EVENT)
+
+/* Run time statistics (vTaskGetRunTimeStats) share the profiler timebase */
+#if (configGENERATE_RUN_TIME_STATS == 1)
+#ifndef portCONFIGURE_TIMER_FOR_RUN_TIME_STATS
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()  PROF_TimebaseInit()
+#endif
+#ifndef portGET_RUN_TIME_COUNTER_VALUE
+#define portGET_RUN_TIME_COUNTER_VALUE()          PROF_GetTimestamp()
+#endif
+#endif /* configGENERATE_RUN_TIME_STATS */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !__IAR_SYSTEMS_ASM__ && !__ASSEMBLER__ */
+
+#endif /* _CPU_PROFILER_TRACE_H__ */
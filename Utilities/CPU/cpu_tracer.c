@@ -0,0 +1,665 @@
+/**
+  ******************************************************************************
+  * @file    cpu_tracer.c
+  * @author  MCD Application Team
+  * @brief   Binary recorder of the FreeRTOS scheduling and kernel object events
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- in the _OS_Config.h file (ex. FreeRTOSConfig.h) enable the following macro :
+      - #define configUSE_TRACE_FACILITY                 1
+
+2- at the end of the _OS_Config.h file include the trace macros :
+      - #include "cpu_tracer_trace.h"
+   They use the trace hooks also used by cpu_utils.c and cpu_profiler.c: only
+   one of the three modules can be linked. The task, queue, event group and
+   stream buffer numbers (vTaskSetTaskNumber()...) are used by the tracer.
+
+3- call TRC_TimebaseInit() before starting the scheduler, unless
+   configGENERATE_RUN_TIME_STATS is 1 (the kernel calls it then).
+
+4- call TRC_Start() with one of the modes :
+      - TRC_MODE_SNAPSHOT : the ring keeps the last TRC_BUFFER_EVENTS events.
+        TRC_Snapshot() copies them, with the task and object tables, into a
+        buffer that can be saved or dumped by a debugger, for instance when a
+        deadline is missed.
+      - TRC_MODE_STREAM : a low priority task sends the output of
+        TRC_GetHeader() once, then the output of TRC_Read() in a loop, to a
+        UART, USB or debug probe channel. Events that do not fit in the ring
+        are counted and reported by a TRC_EV_LOST event.
+
+5- decode the trace on the host with Tools/cpu_tracer_decode.py.
+
+Recording an event costs a timestamp read, a compare and swap of the ring
+write index and two stores: no critical section is used, so the interrupts
+calling FromISR functions are traced with the same ordering as the tasks.
+
+The timebase is the DWT cycle counter. Another free running 32-bit counter,
+for instance a timer or the host clock of a simulator build, can be selected
+by defining in main.h :
+      - TRC_TIMESTAMP()       : current counter value
+      - TRC_TIMESTAMP_FREQ    : counter frequency in Hz
+      - TRC_TIMEBASE_INIT()   : counter start-up, may be empty
+      - TRC_IN_ISR()          : non zero in interrupt context
+The host decoder extends the timestamps to 64 bits, so the trace must not be
+idle for a whole counter period: define TRC_TRACE_TICKS to 1 to record the
+ticks when that can happen.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "cpu_tracer.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  void       *task;             /* Task handle, NULL for a free slot */
+  uint32_t    priority;         /* Priority at creation */
+  char        name[TRC_NAME_LEN];
+} TRC_Task_t;
+
+typedef struct
+{
+  const void *object;           /* Object handle, NULL for a free slot */
+  uint32_t    kind;             /* TRC_KIND_xxx */
+  uint32_t    length;           /* Queue length, buffer size */
+  char        name[TRC_NAME_LEN];
+} TRC_Object_t;
+
+/* Private define ------------------------------------------------------------*/
+#if (configUSE_TRACE_FACILITY != 1)
+#error "cpu_tracer requires configUSE_TRACE_FACILITY"
+#endif
+
+#if ((TRC_BUFFER_EVENTS & (TRC_BUFFER_EVENTS - 1U)) != 0U)
+#error "TRC_BUFFER_EVENTS must be a power of two"
+#endif
+
+#if ((TRC_MAX_TASKS > 255U) || (TRC_MAX_OBJECTS > 255U))
+#error "The task and object numbers are 8-bit"
+#endif
+
+/* Largest argument and length that fit in an event */
+#define TRC_ARG_MAX           0xFFFFU
+#define TRC_LENGTH_MAX        0x0FFFU
+
+/* Flag of the TRC_EV_NAME argument for an object name */
+#define TRC_NAME_OBJECT       0x8000U
+
+/* Private macro -------------------------------------------------------------*/
+#ifndef TRC_TIMESTAMP
+#define TRC_TIMESTAMP()       (DWT->CYCCNT)
+#define TRC_TIMESTAMP_FREQ    SystemCoreClock
+#define TRC_TIMEBASE_INIT()   do {                                              \
+                                CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk; \
+                                DWT->CYCCNT = 0U;                               \
+                                DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;            \
+                              } while (0)
+#endif
+
+#ifndef TRC_IN_ISR
+#define TRC_IN_ISR()          (__get_IPSR() != 0U)
+#endif
+
+/* Private function prototypes -----------------------------------------------*/
+static volatile TRC_Event_t *TRC_Reserve(void);
+static void TRC_Write(uint32_t word, uint32_t info);
+static void TRC_WriteName(uint32_t id, uint32_t flags, const char *name);
+static void TRC_CopyName(char *dest, const char *name);
+static uint32_t TRC_WriteTables(void *buffer, uint32_t size, uint32_t mode,
+                                uint32_t event_count, uint32_t lost);
+
+/* Private variables ---------------------------------------------------------*/
+static volatile TRC_Event_t trc_buffer[TRC_BUFFER_EVENTS];
+static volatile uint32_t    trc_head = 0;       /* Events reserved since start */
+static volatile uint32_t    trc_tail = 0;       /* Events read since start (stream) */
+static volatile uint32_t    trc_lost = 0;       /* Events dropped (stream) */
+static uint32_t             trc_lost_reported = 0;
+static volatile uint32_t    trc_mode = TRC_MODE_OFF;
+static TRC_Task_t           trc_tasks[TRC_MAX_TASKS];
+static TRC_Object_t         trc_objects[TRC_MAX_OBJECTS];
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Reserve the next event of the ring
+  * @note   The write index is claimed with a compare and swap, so that an
+  *         interrupt recording an event in between gets the next slot.
+  *         Cortex-M0 cores have no exclusive access: the interrupts are
+  *         masked for the few instructions of the update instead.
+  * @param  None
+  * @retval Event to fill, NULL in stream mode when the ring is full
+  */
+static volatile TRC_Event_t *TRC_Reserve(void)
+{
+  uint32_t head;
+
+#if defined(__ARM_ARCH_6M__)
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  head = trc_head;
+  if ((trc_mode == TRC_MODE_STREAM) && ((head - trc_tail) >= TRC_BUFFER_EVENTS))
+  {
+    __set_PRIMASK(primask);
+    trc_lost++;
+    return NULL;
+  }
+  trc_head = head + 1U;
+  __set_PRIMASK(primask);
+#elif defined(__GNUC__)
+  head = __atomic_load_n(&trc_head, __ATOMIC_RELAXED);
+  do
+  {
+    if ((trc_mode == TRC_MODE_STREAM) && ((head - trc_tail) >= TRC_BUFFER_EVENTS))
+    {
+      /* A concurrent increment may be missed: the count is a diagnostic */
+      trc_lost++;
+      return NULL;
+    }
+  } while (!__atomic_compare_exchange_n(&trc_head, &head, head + 1U, 1,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+#else
+  do
+  {
+    head = __LDREXW(&trc_head);
+    if ((trc_mode == TRC_MODE_STREAM) && ((head - trc_tail) >= TRC_BUFFER_EVENTS))
+    {
+      __CLREX();
+      trc_lost++;
+      return NULL;
+    }
+  } while (__STREXW(head + 1U, &trc_head) != 0U);
+#endif
+
+  return &trc_buffer[head & (TRC_BUFFER_EVENTS - 1U)];
+}
+
+/**
+  * @brief  Record an event
+  * @param  word: timestamp, or name characters for a TRC_EV_NAME event
+  * @param  info: code, number and argument, never zero
+  * @retval None
+  */
+static void TRC_Write(uint32_t word, uint32_t info)
+{
+  volatile TRC_Event_t *e;
+
+  if (trc_mode == TRC_MODE_OFF)
+  {
+    return;
+  }
+  e = TRC_Reserve();
+  if (e != NULL)
+  {
+    /* The info word is written last: a reader seeing it non zero also sees
+       the timestamp */
+    e->timestamp = word;
+    e->info = info;
+  }
+}
+
+/**
+  * @brief  Record a name as TRC_EV_NAME events of 4 characters
+  * @param  id: task or object number
+  * @param  flags: TRC_NAME_OBJECT for an object, 0 for a task
+  * @param  name: TRC_NAME_LEN bytes, NUL padded
+  * @retval None
+  */
+static void TRC_WriteName(uint32_t id, uint32_t flags, const char *name)
+{
+  uint32_t chunk;
+  uint32_t chars;
+
+  for (chunk = 0U; chunk < (TRC_NAME_LEN / 4U); chunk++)
+  {
+    chars = (uint32_t)(uint8_t)name[4U * chunk] |
+            ((uint32_t)(uint8_t)name[(4U * chunk) + 1U] << 8) |
+            ((uint32_t)(uint8_t)name[(4U * chunk) + 2U] << 16) |
+            ((uint32_t)(uint8_t)name[(4U * chunk) + 3U] << 24);
+    TRC_Write(chars, TRC_EV_NAME | (id << 8) | ((flags | chunk) << 16));
+    if ((chars >> 24) == 0U)
+    {
+      break;
+    }
+  }
+}
+
+/**
+  * @brief  Copy a name into a fixed size, NUL padded field
+  * @param  dest: TRC_NAME_LEN bytes field
+  * @param  name: name, may be NULL
+  * @retval None
+  */
+static void TRC_CopyName(char *dest, const char *name)
+{
+  uint32_t i = 0U;
+
+  if (name != NULL)
+  {
+    for (; (i < (TRC_NAME_LEN - 1U)) && (name[i] != '\0'); i++)
+    {
+      dest[i] = name[i];
+    }
+  }
+  for (; i < TRC_NAME_LEN; i++)
+  {
+    dest[i] = '\0';
+  }
+}
+
+/**
+  * @brief  Write the trace header and the task and object tables
+  * @param  buffer: word aligned destination
+  * @param  size: size of the buffer in bytes
+  * @param  mode: TRC_MODE_xxx
+  * @param  event_count: number of events that follow the tables
+  * @param  lost: number of events lost or overwritten
+  * @retval Size of the header and tables in bytes, 0 if the buffer is too small
+  */
+static uint32_t TRC_WriteTables(void *buffer, uint32_t size, uint32_t mode,
+                                uint32_t event_count, uint32_t lost)
+{
+  TRC_Header_t *header = (TRC_Header_t *)buffer;
+  TRC_TaskInfo_t *task;
+  TRC_ObjectInfo_t *object;
+  uint32_t task_count = 0U;
+  uint32_t object_count = 0U;
+  uint32_t total;
+  uint32_t i;
+
+  for (i = 0U; i < TRC_MAX_TASKS; i++)
+  {
+    if (trc_tasks[i].task != NULL)
+    {
+      task_count++;
+    }
+  }
+  for (i = 0U; i < TRC_MAX_OBJECTS; i++)
+  {
+    if (trc_objects[i].object != NULL)
+    {
+      object_count++;
+    }
+  }
+  total = sizeof(TRC_Header_t) + (task_count * sizeof(TRC_TaskInfo_t)) +
+          (object_count * sizeof(TRC_ObjectInfo_t));
+  if ((buffer == NULL) || (size < (total + (event_count * sizeof(TRC_Event_t)))))
+  {
+    return 0U;
+  }
+
+  task = (TRC_TaskInfo_t *)(header + 1);
+  for (i = 0U; i < TRC_MAX_TASKS; i++)
+  {
+    if (trc_tasks[i].task != NULL)
+    {
+      memcpy(task->name, trc_tasks[i].name, TRC_NAME_LEN);
+      task->id = i + 1U;
+      task->priority = trc_tasks[i].priority;
+      task++;
+    }
+  }
+
+  object = (TRC_ObjectInfo_t *)task;
+  for (i = 0U; i < TRC_MAX_OBJECTS; i++)
+  {
+    if (trc_objects[i].object != NULL)
+    {
+      memcpy(object->name, trc_objects[i].name, TRC_NAME_LEN);
+      object->id = i + 1U;
+      object->kind = trc_objects[i].kind;
+      object->length = trc_objects[i].length;
+      object++;
+    }
+  }
+
+  header->magic = TRC_TRACE_MAGIC;
+  header->version = TRC_TRACE_VERSION;
+  header->size = total + (event_count * sizeof(TRC_Event_t));
+  header->timestamp_freq = TRC_TIMESTAMP_FREQ;
+  header->mode = mode;
+  header->task_count = task_count;
+  header->object_count = object_count;
+  header->event_count = event_count;
+  header->lost = lost;
+
+  return total;
+}
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  Start the timebase
+  * @param  None
+  * @retval None
+  */
+void TRC_TimebaseInit(void)
+{
+  TRC_TIMEBASE_INIT();
+}
+
+/**
+  * @brief  Read the timebase
+  * @param  None
+  * @retval Current timestamp
+  */
+uint32_t TRC_GetTimestamp(void)
+{
+  return TRC_TIMESTAMP();
+}
+
+/**
+  * @brief  Kernel hooks: record an event
+  * @param  code: TRC_EV_xxx, optionally with TRC_EV_ISR
+  * @param  id: task or object number
+  * @param  arg: argument, saturated to 16 bits
+  * @retval None
+  */
+void TRC_Event(uint32_t code, uint32_t id, uint32_t arg)
+{
+  if (trc_mode == TRC_MODE_OFF)
+  {
+    return;
+  }
+  if (arg > TRC_ARG_MAX)
+  {
+    arg = TRC_ARG_MAX;
+  }
+  TRC_Write(TRC_TIMESTAMP(), code | ((id & 0xFFU) << 8) | (arg << 16));
+}
+
+/**
+  * @brief  traceTASK_CREATE hook: assign a number to a new task
+  * @param  task: task handle
+  * @param  name: task name
+  * @param  priority: task priority
+  * @retval None
+  */
+void TRC_TaskCreate(void *task, const char *name, uint32_t priority)
+{
+  uint32_t i;
+  uint32_t id = 0U;
+
+  /* Called in a critical section */
+  for (i = 0U; i < TRC_MAX_TASKS; i++)
+  {
+    if (trc_tasks[i].task == NULL)
+    {
+      trc_tasks[i].task = task;
+      trc_tasks[i].priority = priority;
+      TRC_CopyName(trc_tasks[i].name, name);
+      id = i + 1U;
+      break;
+    }
+  }
+  vTaskSetTaskNumber((TaskHandle_t)task, (UBaseType_t)id);
+
+  TRC_Event(TRC_EV_TASK_CREATE, id, priority);
+  if (id != 0U)
+  {
+    TRC_WriteName(id, 0U, trc_tasks[id - 1U].name);
+  }
+}
+
+/**
+  * @brief  traceTASK_DELETE hook: release the number of a task
+  * @param  id: task number
+  * @retval None
+  */
+void TRC_TaskDelete(uint32_t id)
+{
+  TRC_Event(TRC_EV_TASK_DELETE, id, 0U);
+  if ((id != 0U) && (id <= TRC_MAX_TASKS))
+  {
+    trc_tasks[id - 1U].task = NULL;
+  }
+}
+
+/**
+  * @brief  traceMOVED_TASK_TO_READY_STATE hook
+  * @param  id: number of the task made ready
+  * @retval None
+  */
+void TRC_TaskReady(uint32_t id)
+{
+  TRC_Event(TRC_IN_ISR() ? (TRC_EV_TASK_READY | TRC_EV_ISR) : TRC_EV_TASK_READY, id, 0U);
+}
+
+/**
+  * @brief  Object creation hooks: assign a number to a new kernel object
+  * @param  object: queue, semaphore, mutex, event group or stream buffer
+  * @param  kind: TRC_KIND_xxx
+  * @param  length: queue length or buffer size
+  * @retval Object number, 0 if all the slots are used
+  */
+uint32_t TRC_ObjectCreate(const void *object, uint32_t kind, uint32_t length)
+{
+  uint32_t i;
+  uint32_t id = 0U;
+
+  taskENTER_CRITICAL();
+  for (i = 0U; i < TRC_MAX_OBJECTS; i++)
+  {
+    if (trc_objects[i].object == NULL)
+    {
+      trc_objects[i].object = object;
+      trc_objects[i].kind = kind;
+      trc_objects[i].length = length;
+      TRC_CopyName(trc_objects[i].name, NULL);
+      id = i + 1U;
+      break;
+    }
+  }
+  taskEXIT_CRITICAL();
+
+  TRC_Event(TRC_EV_OBJECT_CREATE, id,
+            (kind << 12) | ((length > TRC_LENGTH_MAX) ? TRC_LENGTH_MAX : length));
+
+  return id;
+}
+
+/**
+  * @brief  Object deletion hooks: release the number of a kernel object
+  * @param  id: object number
+  * @retval None
+  */
+void TRC_ObjectDelete(uint32_t id)
+{
+  TRC_Event(TRC_EV_OBJECT_DELETE, id, 0U);
+  if ((id != 0U) && (id <= TRC_MAX_OBJECTS))
+  {
+    trc_objects[id - 1U].object = NULL;
+  }
+}
+
+/**
+  * @brief  Name a kernel object in the trace. Queues, semaphores and mutexes
+  *         added to the queue registry are named automatically.
+  * @param  object: object handle
+  * @param  name: object name, copied
+  * @retval None
+  */
+void TRC_NameObject(const void *object, const char *name)
+{
+  uint32_t i;
+
+  for (i = 0U; i < TRC_MAX_OBJECTS; i++)
+  {
+    if ((object != NULL) && (trc_objects[i].object == object))
+    {
+      TRC_CopyName(trc_objects[i].name, name);
+      TRC_WriteName(i + 1U, TRC_NAME_OBJECT, trc_objects[i].name);
+      break;
+    }
+  }
+}
+
+/**
+  * @brief  Clear the ring and start recording
+  * @param  mode: TRC_MODE_SNAPSHOT or TRC_MODE_STREAM
+  * @retval None
+  */
+void TRC_Start(uint32_t mode)
+{
+  uint32_t i;
+
+  taskENTER_CRITICAL();
+  trc_mode = TRC_MODE_OFF;
+  for (i = 0U; i < TRC_BUFFER_EVENTS; i++)
+  {
+    trc_buffer[i].info = 0U;
+  }
+  trc_head = 0U;
+  trc_tail = 0U;
+  trc_lost = 0U;
+  trc_lost_reported = 0U;
+  trc_mode = mode;
+  taskEXIT_CRITICAL();
+}
+
+/**
+  * @brief  Stop recording, the recorded events remain readable
+  * @param  None
+  * @retval None
+  */
+void TRC_Stop(void)
+{
+  trc_mode = TRC_MODE_OFF;
+}
+
+/**
+  * @brief  Export the header, the tables and the events of the ring
+  * @note   Recording is suspended during the copy. In stream mode, the events
+  *         are read with TRC_Read() instead and nothing is copied.
+  * @param  buffer: word aligned destination, TRC_SNAPSHOT_SIZE bytes are
+  *         enough in every case
+  * @param  size: size of the buffer in bytes
+  * @retval Size of the snapshot in bytes, 0 if the buffer is too small
+  */
+uint32_t TRC_Snapshot(void *buffer, uint32_t size)
+{
+  TRC_Event_t *event;
+  uint32_t mode = trc_mode;
+  uint32_t head;
+  uint32_t count;
+  uint32_t total;
+  uint32_t i;
+
+  if (mode == TRC_MODE_STREAM)
+  {
+    return 0U;
+  }
+
+  trc_mode = TRC_MODE_OFF;
+  vTaskSuspendAll();
+
+  head = trc_head;
+  count = (head > TRC_BUFFER_EVENTS) ? TRC_BUFFER_EVENTS : head;
+  total = TRC_WriteTables(buffer, size, TRC_MODE_SNAPSHOT, count, head - count);
+  if (total != 0U)
+  {
+    /* Oldest event first */
+    event = (TRC_Event_t *)((uint8_t *)buffer + total);
+    for (i = head - count; i != head; i++)
+    {
+      event->timestamp = trc_buffer[i & (TRC_BUFFER_EVENTS - 1U)].timestamp;
+      event->info = trc_buffer[i & (TRC_BUFFER_EVENTS - 1U)].info;
+      event++;
+    }
+    total += count * sizeof(TRC_Event_t);
+  }
+
+  (void)xTaskResumeAll();
+  trc_mode = mode;
+
+  return total;
+}
+
+/**
+  * @brief  Export the header and the tables that start a stream
+  * @param  buffer: word aligned destination, TRC_HEADER_SIZE bytes are
+  *         enough in every case
+  * @param  size: size of the buffer in bytes
+  * @retval Size in bytes, 0 if the buffer is too small
+  */
+uint32_t TRC_GetHeader(void *buffer, uint32_t size)
+{
+  uint32_t total;
+
+  vTaskSuspendAll();
+  total = TRC_WriteTables(buffer, size, TRC_MODE_STREAM, 0U, trc_lost);
+  (void)xTaskResumeAll();
+
+  return total;
+}
+
+/**
+  * @brief  Stream mode: move the recorded events to a buffer, oldest first
+  * @note   A single task may call this function. The events that were lost
+  *         since the previous call are reported first by a TRC_EV_LOST event.
+  * @param  buffer: word aligned destination
+  * @param  size: size of the buffer in bytes
+  * @retval Number of bytes written, a multiple of sizeof(TRC_Event_t)
+  */
+uint32_t TRC_Read(void *buffer, uint32_t size)
+{
+  TRC_Event_t *out = (TRC_Event_t *)buffer;
+  volatile TRC_Event_t *e;
+  uint32_t max = size / sizeof(TRC_Event_t);
+  uint32_t tail = trc_tail;
+  uint32_t lost;
+  uint32_t info;
+  uint32_t n = 0U;
+
+  if ((trc_mode != TRC_MODE_STREAM) || (buffer == NULL))
+  {
+    return 0U;
+  }
+
+  lost = trc_lost - trc_lost_reported;
+  if ((lost != 0U) && (max != 0U))
+  {
+    if (lost > TRC_ARG_MAX)
+    {
+      lost = TRC_ARG_MAX;
+    }
+    out[n].timestamp = TRC_TIMESTAMP();
+    out[n].info = TRC_EV_LOST | (lost << 16);
+    trc_lost_reported += lost;
+    n++;
+  }
+
+  while ((n < max) && (tail != trc_head))
+  {
+    e = &trc_buffer[tail & (TRC_BUFFER_EVENTS - 1U)];
+    info = e->info;
+    if (info == 0U)
+    {
+      /* Reserved by an interrupted writer, not filled yet */
+      break;
+    }
+    out[n].timestamp = e->timestamp;
+    out[n].info = info;
+    e->info = 0U;
+    n++;
+    tail++;
+  }
+  trc_tail = tail;
+
+  return n * sizeof(TRC_Event_t);
+}
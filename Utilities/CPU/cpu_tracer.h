@@ -0,0 +1,126 @@
+/**
+  ******************************************************************************
+  * @file    cpu_tracer.h
+  * @author  MCD Application Team
+  * @brief   Header for cpu_tracer module
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _CPU_TRACER_H__
+#define _CPU_TRACER_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "cpu_tracer_trace.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Number of events held by the ring, must be a power of two. Each event takes
+   8 bytes. */
+#ifndef TRC_BUFFER_EVENTS
+#define TRC_BUFFER_EVENTS     512U
+#endif
+
+/* Number of task and kernel object slots. Tasks and objects created once all
+   the slots are used are traced with the number 0. */
+#ifndef TRC_MAX_TASKS
+#define TRC_MAX_TASKS         16U
+#endif
+#ifndef TRC_MAX_OBJECTS
+#define TRC_MAX_OBJECTS       16U
+#endif
+
+/* Length of the names stored in the tables, NUL padded */
+#define TRC_NAME_LEN          16U
+
+/* Recording modes */
+#define TRC_MODE_OFF          0U    /* Events are not recorded              */
+#define TRC_MODE_SNAPSHOT     1U    /* The newest events overwrite the oldest */
+#define TRC_MODE_STREAM       2U    /* Events are drained with TRC_Read(), the
+                                       events that do not fit are counted lost */
+
+/* Trace format */
+#define TRC_TRACE_MAGIC       0x31435254U   /* "TRC1" */
+#define TRC_TRACE_VERSION     1U
+
+/* Exported types ------------------------------------------------------------*/
+/* A trace is a TRC_Header_t followed by task_count TRC_TaskInfo_t and
+   object_count TRC_ObjectInfo_t records, then by the events: event_count
+   TRC_Event_t in a snapshot, or the TRC_Read() output until the end of the
+   stream. All the fields are 32-bit words in the target byte order. */
+typedef struct
+{
+  uint32_t magic;               /* TRC_TRACE_MAGIC */
+  uint32_t version;             /* TRC_TRACE_VERSION */
+  uint32_t size;                /* Size in bytes of the header, the tables and
+                                   the snapshot events */
+  uint32_t timestamp_freq;      /* Timestamp frequency in Hz */
+  uint32_t mode;                /* TRC_MODE_SNAPSHOT or TRC_MODE_STREAM */
+  uint32_t task_count;          /* Number of task records */
+  uint32_t object_count;        /* Number of object records */
+  uint32_t event_count;         /* Number of events, 0 for a stream */
+  uint32_t lost;                /* Events lost (stream) or overwritten (snapshot) */
+} TRC_Header_t;
+
+typedef struct
+{
+  char     name[TRC_NAME_LEN];  /* Task name */
+  uint32_t id;                  /* Task number used in the events */
+  uint32_t priority;            /* Priority at creation */
+} TRC_TaskInfo_t;
+
+typedef struct
+{
+  char     name[TRC_NAME_LEN];  /* Name given by vQueueAddToRegistry() or
+                                   TRC_NameObject(), may be empty */
+  uint32_t id;                  /* Object number used in the events */
+  uint32_t kind;                /* TRC_KIND_xxx */
+  uint32_t length;              /* Queue length, buffer size in bytes */
+} TRC_ObjectInfo_t;
+
+/* Event record: info holds the TRC_EV_xxx code in bits 0-7, the task or
+   object number in bits 8-15 and the argument in bits 16-31. An info word of
+   zero marks a record that is not written yet. */
+typedef struct
+{
+  uint32_t timestamp;
+  uint32_t info;
+} TRC_Event_t;
+
+/* Exported macro ------------------------------------------------------------*/
+/* Buffer size needed by TRC_Snapshot() in the worst case */
+#define TRC_SNAPSHOT_SIZE     (sizeof(TRC_Header_t) + \
+                               (TRC_MAX_TASKS * sizeof(TRC_TaskInfo_t)) + \
+                               (TRC_MAX_OBJECTS * sizeof(TRC_ObjectInfo_t)) + \
+                               (TRC_BUFFER_EVENTS * sizeof(TRC_Event_t)))
+
+/* Buffer size needed by TRC_GetHeader() in the worst case */
+#define TRC_HEADER_SIZE       (TRC_SNAPSHOT_SIZE - (TRC_BUFFER_EVENTS * sizeof(TRC_Event_t)))
+
+/* Exported functions ------------------------------------------------------- */
+void     TRC_Start(uint32_t mode);
+void     TRC_Stop(void);
+uint32_t TRC_Snapshot(void *buffer, uint32_t size);
+uint32_t TRC_GetHeader(void *buffer, uint32_t size);
+uint32_t TRC_Read(void *buffer, uint32_t size);
+void     TRC_NameObject(const void *object, const char *name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CPU_TRACER_H__ */
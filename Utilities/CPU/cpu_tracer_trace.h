@@ -0,0 +1,196 @@
+/**
+  ******************************************************************************
+  * @file    cpu_tracer_trace.h
+  * @author  MCD Application Team
+  * @brief   FreeRTOS trace macros feeding the cpu_tracer module.
+  *          Include this file at the end of FreeRTOSConfig.h.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _CPU_TRACER_TRACE_H__
+#define _CPU_TRACER_TRACE_H__
+
+/* FreeRTOSConfig.h is also included by the assembler files of some ports */
+#if !defined(__IAR_SYSTEMS_ASM__) && !defined(__ASSEMBLER__)
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/* Event codes. The task events carry a task number, the current task being
+   the one of the last TRC_EV_TASK_SWITCH_IN. The object events carry an object
+   number and, for queues, semaphores and mutexes, the number of items in the
+   queue before the operation. */
+#define TRC_EV_NONE               0x00U
+#define TRC_EV_TASK_CREATE        0x01U   /* Task,    priority            */
+#define TRC_EV_TASK_DELETE        0x02U   /* Task                         */
+#define TRC_EV_TASK_SWITCH_IN     0x03U   /* Task,    priority            */
+#define TRC_EV_TASK_READY         0x04U   /* Task                         */
+#define TRC_EV_TASK_DELAY         0x05U   /* Current task                 */
+#define TRC_EV_TASK_SUSPEND       0x06U   /* Task                         */
+#define TRC_EV_TASK_RESUME        0x07U   /* Task                         */
+#define TRC_EV_TASK_PRIORITY_SET  0x08U   /* Task,    new priority        */
+#define TRC_EV_TASK_INHERIT       0x09U   /* Mutex holder, raised priority */
+#define TRC_EV_TASK_DISINHERIT    0x0AU   /* Mutex holder, base priority  */
+#define TRC_EV_TASK_NOTIFY        0x0BU   /* Notified task                */
+#define TRC_EV_TASK_NOTIFY_BLOCK  0x0CU   /* Current task                 */
+#define TRC_EV_TICK               0x0DU   /* -,       tick count bits 0-15 */
+#define TRC_EV_OBJECT_CREATE      0x10U   /* Object,  kind << 12 | length */
+#define TRC_EV_OBJECT_DELETE      0x11U   /* Object                       */
+#define TRC_EV_QUEUE_SEND         0x12U   /* Object,  items               */
+#define TRC_EV_QUEUE_SEND_FAILED  0x13U   /* Object,  items               */
+#define TRC_EV_QUEUE_RECEIVE      0x14U   /* Object,  items               */
+#define TRC_EV_QUEUE_RECEIVE_FAILED 0x15U /* Object,  items               */
+#define TRC_EV_QUEUE_PEEK         0x16U   /* Object,  items               */
+#define TRC_EV_BLOCK_SEND         0x17U   /* Object                       */
+#define TRC_EV_BLOCK_RECEIVE      0x18U   /* Object                       */
+#define TRC_EV_EVENT_GROUP_SET    0x19U   /* Object,  bits 0-15           */
+#define TRC_EV_STREAM_SEND        0x1AU   /* Object,  bytes               */
+#define TRC_EV_STREAM_RECEIVE     0x1BU   /* Object,  bytes               */
+#define TRC_EV_NAME               0x30U   /* Task or object, name chunk: the
+                                             timestamp field holds 4 chars */
+#define TRC_EV_LOST               0x31U   /* -,       lost events         */
+#define TRC_EV_ISR                0x80U   /* Flag: event from an interrupt */
+
+/* Kinds of objects, the queue kinds match the queueQUEUE_TYPE_xxx values */
+#define TRC_KIND_QUEUE            0U
+#define TRC_KIND_MUTEX            1U
+#define TRC_KIND_COUNTING_SEM     2U
+#define TRC_KIND_BINARY_SEM       3U
+#define TRC_KIND_RECURSIVE_MUTEX  4U
+#define TRC_KIND_EVENT_GROUP      5U
+#define TRC_KIND_STREAM_BUFFER    6U
+#define TRC_KIND_MESSAGE_BUFFER   7U
+
+/* Exported functions ------------------------------------------------------- */
+/* Kernel hooks: the handles are passed untyped, as FreeRTOSConfig.h is parsed
+   before the kernel types are declared */
+void TRC_TimebaseInit(void);
+uint32_t TRC_GetTimestamp(void);
+void TRC_Event(uint32_t code, uint32_t id, uint32_t arg);
+void TRC_TaskCreate(void *task, const char *name, uint32_t priority);
+void TRC_TaskDelete(uint32_t id);
+void TRC_TaskReady(uint32_t id);
+uint32_t TRC_ObjectCreate(const void *object, uint32_t kind, uint32_t length);
+void TRC_ObjectDelete(uint32_t id);
+void TRC_NameObject(const void *object, const char *name);
+
+/* Exported macro ------------------------------------------------------------*/
+/* The macros expand in the kernel sources, where the control block members
+   can be read directly */
+#define traceTASK_CREATE(pxNewTCB)                TRC_TaskCreate((void *)(pxNewTCB), (pxNewTCB)->pcTaskName, (uint32_t)(pxNewTCB)->uxPriority)
+#define traceTASK_DELETE(pxTCB)                   TRC_TaskDelete((uint32_t)(pxTCB)->uxTaskNumber)
+#define traceTASK_SWITCHED_IN()                   TRC_Event(TRC_EV_TASK_SWITCH_IN, (uint32_t)pxCurrentTCB->uxTaskNumber, (uint32_t)pxCurrentTCB->uxPriority)
+#define traceMOVED_TASK_TO_READY_STATE(pxTCB)     TRC_TaskReady((uint32_t)(pxTCB)->uxTaskNumber)
+#define traceTASK_DELAY()                         TRC_Event(TRC_EV_TASK_DELAY, (uint32_t)pxCurrentTCB->uxTaskNumber, 0U)
+#define traceTASK_DELAY_UNTIL(xTimeToWake)        TRC_Event(TRC_EV_TASK_DELAY, (uint32_t)pxCurrentTCB->uxTaskNumber, 0U)
+#define traceTASK_SUSPEND(pxTCB)                  TRC_Event(TRC_EV_TASK_SUSPEND, (uint32_t)(pxTCB)->uxTaskNumber, 0U)
+#define traceTASK_RESUME(pxTCB)                   TRC_Event(TRC_EV_TASK_RESUME, (uint32_t)(pxTCB)->uxTaskNumber, 0U)
+#define traceTASK_RESUME_FROM_ISR(pxTCB)          TRC_Event(TRC_EV_TASK_RESUME | TRC_EV_ISR, (uint32_t)(pxTCB)->uxTaskNumber, 0U)
+#define traceTASK_PRIORITY_SET(pxTCB, uxNewPriority) \
+  TRC_Event(TRC_EV_TASK_PRIORITY_SET, (uint32_t)(pxTCB)->uxTaskNumber, (uint32_t)(uxNewPriority))
+#define traceTASK_PRIORITY_INHERIT(pxTCBOfMutexHolder, uxInheritedPriority) \
+  TRC_Event(TRC_EV_TASK_INHERIT, (uint32_t)(pxTCBOfMutexHolder)->uxTaskNumber, (uint32_t)(uxInheritedPriority))
+#define traceTASK_PRIORITY_DISINHERIT(pxTCBOfMutexHolder, uxOriginalPriority) \
+  TRC_Event(TRC_EV_TASK_DISINHERIT, (uint32_t)(pxTCBOfMutexHolder)->uxTaskNumber, (uint32_t)(uxOriginalPriority))
+
+/* The notification macros have no parameter, the notified task is pxTCB in
+   the kernel functions that expand them */
+#define traceTASK_NOTIFY()                        TRC_Event(TRC_EV_TASK_NOTIFY, (uint32_t)pxTCB->uxTaskNumber, 0U)
+#define traceTASK_NOTIFY_FROM_ISR()               TRC_Event(TRC_EV_TASK_NOTIFY | TRC_EV_ISR, (uint32_t)pxTCB->uxTaskNumber, 0U)
+#define traceTASK_NOTIFY_GIVE_FROM_ISR()          TRC_Event(TRC_EV_TASK_NOTIFY | TRC_EV_ISR, (uint32_t)pxTCB->uxTaskNumber, 0U)
+#define traceTASK_NOTIFY_TAKE_BLOCK()             TRC_Event(TRC_EV_TASK_NOTIFY_BLOCK, (uint32_t)pxCurrentTCB->uxTaskNumber, 0U)
+#define traceTASK_NOTIFY_WAIT_BLOCK()             TRC_Event(TRC_EV_TASK_NOTIFY_BLOCK, (uint32_t)pxCurrentTCB->uxTaskNumber, 0U)
+
+/* One event per tick: only needed when the trace can be idle for longer than
+   a timestamp counter period */
+#if defined(TRC_TRACE_TICKS) && (TRC_TRACE_TICKS != 0)
+#define traceTASK_INCREMENT_TICK(xTickCount)      TRC_Event(TRC_EV_TICK, 0U, (uint32_t)(xTickCount) & 0xFFFFU)
+#endif
+
+/* Queues, semaphores and mutexes */
+#define traceQUEUE_CREATE(pxNewQueue) \
+  vQueueSetQueueNumber((pxNewQueue), TRC_ObjectCreate((pxNewQueue), (uint32_t)(pxNewQueue)->ucQueueType, (uint32_t)(pxNewQueue)->uxLength))
+#define traceQUEUE_DELETE(pxQueue)                TRC_ObjectDelete((uint32_t)(pxQueue)->uxQueueNumber)
+#define traceQUEUE_REGISTRY_ADD(xQueue, pcQueueName) TRC_NameObject((xQueue), (pcQueueName))
+
+#define TRC_QUEUE_EVENT(code, pxQueue)            TRC_Event((code), (uint32_t)(pxQueue)->uxQueueNumber, (uint32_t)(pxQueue)->uxMessagesWaiting)
+#define traceQUEUE_SEND(pxQueue)                  TRC_QUEUE_EVENT(TRC_EV_QUEUE_SEND, pxQueue)
+#define traceQUEUE_SEND_FAILED(pxQueue)           TRC_QUEUE_EVENT(TRC_EV_QUEUE_SEND_FAILED, pxQueue)
+#define traceQUEUE_SEND_FROM_ISR(pxQueue)         TRC_QUEUE_EVENT(TRC_EV_QUEUE_SEND | TRC_EV_ISR, pxQueue)
+#define traceQUEUE_SEND_FROM_ISR_FAILED(pxQueue)  TRC_QUEUE_EVENT(TRC_EV_QUEUE_SEND_FAILED | TRC_EV_ISR, pxQueue)
+#define traceQUEUE_RECEIVE(pxQueue)               TRC_QUEUE_EVENT(TRC_EV_QUEUE_RECEIVE, pxQueue)
+#define traceQUEUE_RECEIVE_FAILED(pxQueue)        TRC_QUEUE_EVENT(TRC_EV_QUEUE_RECEIVE_FAILED, pxQueue)
+#define traceQUEUE_RECEIVE_FROM_ISR(pxQueue)      TRC_QUEUE_EVENT(TRC_EV_QUEUE_RECEIVE | TRC_EV_ISR, pxQueue)
+#define traceQUEUE_RECEIVE_FROM_ISR_FAILED(pxQueue) TRC_QUEUE_EVENT(TRC_EV_QUEUE_RECEIVE_FAILED | TRC_EV_ISR, pxQueue)
+#define traceQUEUE_PEEK(pxQueue)                  TRC_QUEUE_EVENT(TRC_EV_QUEUE_PEEK, pxQueue)
+#define traceQUEUE_PEEK_FROM_ISR(pxQueue)         TRC_QUEUE_EVENT(TRC_EV_QUEUE_PEEK | TRC_EV_ISR, pxQueue)
+#define traceBLOCKING_ON_QUEUE_SEND(pxQueue)      TRC_Event(TRC_EV_BLOCK_SEND, (uint32_t)(pxQueue)->uxQueueNumber, 0U)
+#define traceBLOCKING_ON_QUEUE_RECEIVE(pxQueue)   TRC_Event(TRC_EV_BLOCK_RECEIVE, (uint32_t)(pxQueue)->uxQueueNumber, 0U)
+#define traceBLOCKING_ON_QUEUE_PEEK(pxQueue)      TRC_Event(TRC_EV_BLOCK_RECEIVE, (uint32_t)(pxQueue)->uxQueueNumber, 0U)
+
+/* Event groups */
+#define traceEVENT_GROUP_CREATE(xEventGroup) \
+  vEventGroupSetNumber((xEventGroup), TRC_ObjectCreate((xEventGroup), TRC_KIND_EVENT_GROUP, 0U))
+#define traceEVENT_GROUP_DELETE(xEventGroup)      TRC_ObjectDelete((uint32_t)uxEventGroupGetNumber(xEventGroup))
+#define traceEVENT_GROUP_SET_BITS(xEventGroup, uxBitsToSet) \
+  TRC_Event(TRC_EV_EVENT_GROUP_SET, (uint32_t)uxEventGroupGetNumber(xEventGroup), (uint32_t)(uxBitsToSet) & 0xFFFFU)
+#define traceEVENT_GROUP_SET_BITS_FROM_ISR(xEventGroup, uxBitsToSet) \
+  TRC_Event(TRC_EV_EVENT_GROUP_SET | TRC_EV_ISR, (uint32_t)uxEventGroupGetNumber(xEventGroup), (uint32_t)(uxBitsToSet) & 0xFFFFU)
+#define traceEVENT_GROUP_WAIT_BITS_BLOCK(xEventGroup, uxBitsToWaitFor) \
+  TRC_Event(TRC_EV_BLOCK_RECEIVE, (uint32_t)uxEventGroupGetNumber(xEventGroup), 0U)
+#define traceEVENT_GROUP_SYNC_BLOCK(xEventGroup, uxBitsToSet, uxBitsToWaitFor) \
+  TRC_Event(TRC_EV_BLOCK_RECEIVE, (uint32_t)uxEventGroupGetNumber(xEventGroup), 0U)
+
+/* Stream and message buffers */
+#define traceSTREAM_BUFFER_CREATE(pxStreamBuffer, xIsMessageBuffer) \
+  vStreamBufferSetStreamBufferNumber((pxStreamBuffer), \
+    TRC_ObjectCreate((pxStreamBuffer), ((xIsMessageBuffer) != 0) ? TRC_KIND_MESSAGE_BUFFER : TRC_KIND_STREAM_BUFFER, \
+                     (uint32_t)(pxStreamBuffer)->xLength))
+#define traceSTREAM_BUFFER_DELETE(xStreamBuffer) \
+  TRC_ObjectDelete((uint32_t)uxStreamBufferGetStreamBufferNumber(xStreamBuffer))
+#define traceSTREAM_BUFFER_SEND(xStreamBuffer, xBytesSent) \
+  TRC_Event(TRC_EV_STREAM_SEND, (uint32_t)uxStreamBufferGetStreamBufferNumber(xStreamBuffer), (uint32_t)(xBytesSent))
+#define traceSTREAM_BUFFER_SEND_FROM_ISR(xStreamBuffer, xBytesSent) \
+  TRC_Event(TRC_EV_STREAM_SEND | TRC_EV_ISR, (uint32_t)uxStreamBufferGetStreamBufferNumber(xStreamBuffer), (uint32_t)(xBytesSent))
+#define traceSTREAM_BUFFER_RECEIVE(xStreamBuffer, xReceivedLength) \
+  TRC_Event(TRC_EV_STREAM_RECEIVE, (uint32_t)uxStreamBufferGetStreamBufferNumber(xStreamBuffer), (uint32_t)(xReceivedLength))
+#define traceSTREAM_BUFFER_RECEIVE_FROM_ISR(xStreamBuffer, xReceivedLength) \
+  TRC_Event(TRC_EV_STREAM_RECEIVE | TRC_EV_ISR, (uint32_t)uxStreamBufferGetStreamBufferNumber(xStreamBuffer), (uint32_t)(xReceivedLength))
+#define traceBLOCKING_ON_STREAM_BUFFER_SEND(xStreamBuffer) \
+  TRC_Event(TRC_EV_BLOCK_SEND, (uint32_t)uxStreamBufferGetStreamBufferNumber(xStreamBuffer), 0U)
+#define traceBLOCKING_ON_STREAM_BUFFER_RECEIVE(xStreamBuffer) \
+  TRC_Event(TRC_EV_BLOCK_RECEIVE, (uint32_t)uxStreamBufferGetStreamBufferNumber(xStreamBuffer), 0U)
+
+/* Run time statistics (vTaskGetRunTimeStats) share the tracer timebase */
+#if (configGENERATE_RUN_TIME_STATS == 1)
+#ifndef portCONFIGURE_TIMER_FOR_RUN_TIME_STATS
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()  TRC_TimebaseInit()
+#endif
+#ifndef portGET_RUN_TIME_COUNTER_VALUE
+#define portGET_RUN_TIME_COUNTER_VALUE()          TRC_GetTimestamp()
+#endif
+#endif /* configGENERATE_RUN_TIME_STATS */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !__IAR_SYSTEMS_ASM__ && !__ASSEMBLER__ */
+
+#endif /* _CPU_TRACER_TRACE_H__ */